@@ -22,6 +22,7 @@ VULKAN_INCLUDE := $(LOCAL_PATH)/$(THIRD_PARTY)/Vulkan-Headers/include
 
 include $(CLEAR_VARS)
 LOCAL_MODULE := layer_utils
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_binary_log.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_config.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_extension_utils.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_utils.cpp
@@ -37,10 +38,20 @@ include $(BUILD_STATIC_LIBRARY)
 include $(CLEAR_VARS)
 LOCAL_MODULE := VkLayer_khronos_validation
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/state_tracker.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/state_memory_accounting.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/validation_worker_pool.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/housekeeping.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/validation_cache_log.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/validation_window.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/validation_counters.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/low_memory_profile.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/call_context.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/device_memory_state.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/base_node.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/create_info_cache.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/buffer_state.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/cmd_buffer_state.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/device_state.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/image_state.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/pipeline_state.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/pipeline_layout_state.cpp
@@ -70,6 +81,8 @@ LOCAL_SRC_FILES += $(SRC_DIR)/layers/convert_to_renderpass2.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/layer_chassis_dispatch.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/chassis.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/layer_options.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/hook_timing.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/layer_trace.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/xxhash.c
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/parameter_validation.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/parameter_validation_utils.cpp
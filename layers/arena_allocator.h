@@ -0,0 +1,141 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for state that is torn down all at once, such as everything recorded into a command buffer.
+//
+// Deallocation is a no-op; memory is only reclaimed by Reset(), which rewinds the arena so the next round of recording reuses
+// it. Reset() keeps the largest block and frees the others, so an object that records similar amounts of state each time
+// settles on a single block and stops touching the heap.
+class MonotonicArena {
+  public:
+    MonotonicArena() = default;
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    void *Allocate(size_t bytes, size_t alignment) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        if (!blocks_.empty()) {
+            void *result = AllocateFromCurrent(bytes, alignment);
+            if (result) return result;
+        }
+        const size_t last_size = blocks_.empty() ? 0 : blocks_.back().size;
+        const size_t min_block_size = kMinBlockSize;
+        const size_t max_block_size = kMaxBlockSize;
+        size_t block_size = std::max(min_block_size, std::min(max_block_size, last_size * 2));
+        block_size = std::max(block_size, bytes + alignment);
+        blocks_.emplace_back(block_size);
+        offset_ = 0;
+        return AllocateFromCurrent(bytes, alignment);
+    }
+
+    // Total size of the blocks currently owned by the arena
+    size_t Capacity() const {
+        size_t capacity = 0;
+        for (const auto &block : blocks_) {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    void Reset() {
+        if (blocks_.size() > 1) {
+            Block largest(std::move(blocks_.back()));
+            blocks_.clear();
+            blocks_.emplace_back(std::move(largest));
+        }
+        offset_ = 0;
+    }
+
+  private:
+    static const size_t kMinBlockSize = 4096;
+    static const size_t kMaxBlockSize = 256 * 1024;
+
+    struct Block {
+        explicit Block(size_t block_size) : data(new uint8_t[block_size]), size(block_size) {}
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    void *AllocateFromCurrent(size_t bytes, size_t alignment) {
+        Block &block = blocks_.back();
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        const uintptr_t aligned = (base + offset_ + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (end > block.size) return nullptr;
+        offset_ = end;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    std::vector<Block> blocks_;
+    size_t offset_ = 0;
+};
+
+// Standard library allocator handing out memory from a MonotonicArena. Containers using it must give their storage back (see
+// ReleaseArenaStorage) before the arena is reset.
+template <typename T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator(MonotonicArena *arena) : arena_(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena()) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T *, size_t) {}
+
+    MonotonicArena *arena() const { return arena_; }
+
+  private:
+    MonotonicArena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) {
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename T, typename Compare = std::less<T>>
+using ArenaSet = std::set<T, Compare, ArenaAllocator<T>>;
+
+// Destroy the contents of an arena backed container and drop its storage, unlike clear() which keeps the capacity.
+template <typename Container>
+void ReleaseArenaStorage(Container &container) {
+    Container(container.get_allocator()).swap(container);
+}
@@ -28,7 +28,77 @@
 #include "base_node.h"
 #include "vk_layer_utils.h"
 
-BASE_NODE::~BASE_NODE() { Destroy(); }
+static thread_local BASE_NODE::InvalidationBatch *active_invalidation_batch = nullptr;
+
+BASE_NODE::InvalidationBatch::InvalidationBatch() : active_(active_invalidation_batch == nullptr) {
+    if (active_) {
+        active_invalidation_batch = this;
+    }
+}
+
+BASE_NODE::InvalidationBatch::~InvalidationBatch() {
+    if (active_) {
+        Flush();
+        active_invalidation_batch = nullptr;
+    }
+}
+
+void BASE_NODE::InvalidationBatch::Flush() {
+    // Handling a notification can notify further parents, which are queued in this batch, so
+    // keep going until nothing new was queued.
+    while (!entries_.empty()) {
+        std::vector<Entry> entries;
+        entries.swap(entries_);
+        entry_index_.clear();
+        for (auto &entry : entries) {
+            if (!entry.node->Destroyed()) {
+                entry.node->NotifyInvalidateBatch(entry.notifications);
+            }
+        }
+    }
+}
+
+bool BASE_NODE::DeferInvalidate(const NodeList &invalid_nodes, bool unlink) {
+    auto *batch = active_invalidation_batch;
+    if (!batch) {
+        return false;
+    }
+    auto result = batch->entry_index_.emplace(this, batch->entries_.size());
+    if (result.second) {
+        batch->entries_.emplace_back();
+        batch->entries_.back().node = shared_from_this();
+    }
+    batch->entries_[result.first->second].notifications.emplace_back(PendingInvalidate{invalid_nodes, unlink});
+    return true;
+}
+
+void BASE_NODE::NotifyInvalidateBatch(const std::vector<PendingInvalidate> &notifications) {
+    for (const auto &notification : notifications) {
+        NotifyInvalidate(notification.invalid_nodes, notification.unlink);
+    }
+}
+
+BASE_NODE::~BASE_NODE() {
+    Destroy();
+    if (memory_counter_) {
+        memory_counter_->Remove(accounted_bytes_);
+    }
+}
+
+void BASE_NODE::AccountMemory(StateMemoryCounter &counter, size_t shallow_bytes) {
+    if (memory_counter_) return;
+    memory_counter_ = &counter;
+    accounted_shallow_bytes_ = static_cast<uint32_t>(shallow_bytes);
+    accounted_bytes_ = shallow_bytes + DynamicMemoryUsage();
+    counter.Add(accounted_bytes_);
+}
+
+void BASE_NODE::UpdateAccountedMemory() {
+    if (!memory_counter_) return;
+    const size_t bytes = accounted_shallow_bytes_ + DynamicMemoryUsage();
+    memory_counter_->Resize(accounted_bytes_, bytes);
+    accounted_bytes_ = bytes;
+}
 
 void BASE_NODE::Destroy() {
     Invalidate();
@@ -36,6 +106,9 @@ void BASE_NODE::Destroy() {
 }
 
 bool BASE_NODE::InUse() const {
+    if (parent_count_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
     // NOTE: for performance reasons, this method calls up the tree
     // with the read lock held.
     auto guard = ReadLockTree();
@@ -55,24 +128,30 @@ bool BASE_NODE::InUse() const {
 
 bool BASE_NODE::AddParent(BASE_NODE *parent_node) {
     auto guard = WriteLockTree();
-    auto result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<BASE_NODE>(parent_node->shared_from_this()));
-    return result.second;
+    bool result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<BASE_NODE>(parent_node->shared_from_this()));
+    parent_count_.store(static_cast<uint32_t>(parent_nodes_.size()), std::memory_order_release);
+    return result;
 }
 
 void BASE_NODE::RemoveParent(BASE_NODE *parent_node) {
     assert(parent_node);
     auto guard = WriteLockTree();
     parent_nodes_.erase(parent_node->Handle());
+    parent_count_.store(static_cast<uint32_t>(parent_nodes_.size()), std::memory_order_release);
 }
 
 // copy the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
 BASE_NODE::NodeMap BASE_NODE::GetParentsForInvalidate(bool unlink) {
     NodeMap result;
+    if (parent_count_.load(std::memory_order_acquire) == 0) {
+        return result;
+    }
     if (unlink) {
         auto guard = WriteLockTree();
         result = std::move(parent_nodes_);
         parent_nodes_.clear();
+        parent_count_.store(0, std::memory_order_release);
     } else {
         auto guard = ReadLockTree();
         result = parent_nodes_;
@@ -81,6 +160,9 @@ BASE_NODE::NodeMap BASE_NODE::GetParentsForInvalidate(bool unlink) {
 }
 
 BASE_NODE::NodeMap BASE_NODE::ObjectBindings() const {
+    if (parent_count_.load(std::memory_order_acquire) == 0) {
+        return NodeMap();
+    }
     auto guard = ReadLockTree();
     return parent_nodes_;
 }
@@ -32,8 +32,13 @@
 #include "vk_layer_data.h"
 #include "vk_layer_logging.h"
 #include "vk_layer_utils.h"
+#include "state_memory_accounting.h"
 
+#include <algorithm>
 #include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
 
 // Intentionally ignore VulkanTypedHandle::node, it is optional
 inline bool operator==(const VulkanTypedHandle &a, const VulkanTypedHandle &b) NOEXCEPT {
@@ -46,20 +51,103 @@ struct hash<VulkanTypedHandle> {
 };
 }  // namespace std
 
+class BASE_NODE;
+
+// Set of weak_ptrs to the parents of a state object, keyed by VulkanTypedHandle.
+// Most objects have one or two parents, which are stored inline. Objects used by many
+// command buffers (bindless descriptor sets, global uniform buffers) keep their parents
+// in one sorted array, so adding, removing and walking them doesn't allocate a node or
+// hash per parent.
+class ParentNodeSet {
+  public:
+    using value_type = std::pair<VulkanTypedHandle, std::weak_ptr<BASE_NODE>>;
+    using iterator = value_type *;
+    using const_iterator = const value_type *;
+
+    // Returns false if a parent with this handle is already present
+    bool emplace(const VulkanTypedHandle &handle, std::weak_ptr<BASE_NODE> &&node) {
+        auto pos = LowerBound(handle);
+        if (pos != nodes_.end() && pos->first == handle) {
+            return false;
+        }
+        const auto index = pos - nodes_.begin();
+        nodes_.emplace_back(handle, std::move(node));
+        std::rotate(nodes_.begin() + index, nodes_.end() - 1, nodes_.end());
+        return true;
+    }
+
+    size_t erase(const VulkanTypedHandle &handle) {
+        auto pos = LowerBound(handle);
+        if (pos == nodes_.end() || !(pos->first == handle)) {
+            return 0;
+        }
+        std::move(pos + 1, nodes_.end(), pos);
+        nodes_.pop_back();
+        return 1;
+    }
+
+    void clear() { nodes_.clear(); }
+    size_t size() const { return nodes_.size(); }
+    bool empty() const { return nodes_.empty(); }
+
+    iterator begin() { return nodes_.begin(); }
+    iterator end() { return nodes_.end(); }
+    const_iterator begin() const { return nodes_.begin(); }
+    const_iterator end() const { return nodes_.end(); }
+
+  private:
+    static bool Less(const value_type &entry, const VulkanTypedHandle &handle) {
+        return (entry.first.handle < handle.handle) || (entry.first.handle == handle.handle && entry.first.type < handle.type);
+    }
+    iterator LowerBound(const VulkanTypedHandle &handle) { return std::lower_bound(nodes_.begin(), nodes_.end(), handle, Less); }
+
+    small_vector<value_type, 2, uint32_t> nodes_;
+};
+
 // inheriting from enable_shared_from_this<> adds a method, shared_from_this(), which
 // returns a shared_ptr version of the current object. It requires the object to
 // be created with std::make_shared<> and it MUST NOT be used from the constructor
 class BASE_NODE : public std::enable_shared_from_this<BASE_NODE> {
   public:
     // Parent nodes are stored as weak_ptrs to avoid cyclic memory dependencies.
-    // Because weak_ptrs cannot safely be used as hash keys, the parents are stored
-    // in a map keyed by VulkanTypedHandle. This also allows looking for specific
+    // Because weak_ptrs cannot safely be used as keys, the parents are stored
+    // in a set keyed by VulkanTypedHandle. This also allows looking for specific
     // parent types without locking every weak_ptr.
-    using NodeMap = layer_data::unordered_map<VulkanTypedHandle, std::weak_ptr<BASE_NODE>>;
+    using NodeMap = ParentNodeSet;
     using NodeList = small_vector<std::shared_ptr<BASE_NODE>, 4, uint32_t>;
 
+    struct PendingInvalidate {
+        NodeList invalid_nodes;
+        bool unlink;
+    };
+
+    // While an InvalidationBatch is alive on a thread, nodes that opt in (see DeferInvalidate())
+    // queue the notifications they receive instead of handling them one at a time. When the
+    // outermost batch goes out of scope each node gets all of its notifications in a single
+    // NotifyInvalidateBatch() call, so destroying many objects that share command buffers locks
+    // and updates every affected command buffer once instead of once per destroyed object.
+    class InvalidationBatch {
+      public:
+        InvalidationBatch();
+        ~InvalidationBatch();
+        InvalidationBatch(const InvalidationBatch &) = delete;
+        InvalidationBatch &operator=(const InvalidationBatch &) = delete;
+
+      private:
+        friend class BASE_NODE;
+        struct Entry {
+            std::shared_ptr<BASE_NODE> node;
+            std::vector<PendingInvalidate> notifications;
+        };
+        void Flush();
+
+        bool active_;
+        std::vector<Entry> entries_;
+        layer_data::unordered_map<BASE_NODE *, size_t> entry_index_;
+    };
+
     template <typename Handle>
-    BASE_NODE(Handle h, VulkanObjectType t) : handle_(h, t), destroyed_(false) {}
+    BASE_NODE(Handle h, VulkanObjectType t) : handle_(h, t), destroyed_(false), parent_count_(0) {}
 
     // because shared_from_this() does not work from the constructor, this 2nd phase
     // constructor is where a state object should call AddParent() on its child nodes.
@@ -94,10 +182,27 @@ class BASE_NODE : public std::enable_shared_from_this<BASE_NODE> {
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // Memory accounting. AccountMemory() charges counter for this object until it is deleted; shallow_bytes is the size
+    // of the most derived type known to the caller. Objects whose contents grow after creation call UpdateAccountedMemory()
+    // when they have settled.
+    void AccountMemory(StateMemoryCounter &counter, size_t shallow_bytes);
+    void UpdateAccountedMemory();
+    // Estimate of the heap memory owned by this object, not including sizeof(*this)
+    virtual size_t DynamicMemoryUsage() const { return 0; }
+
   protected:
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
 
+    // Called when an InvalidationBatch is flushed, with every notification queued by
+    // DeferInvalidate() for this node.
+    virtual void NotifyInvalidateBatch(const std::vector<PendingInvalidate> &notifications);
+
+    // Queue a notification in this thread's InvalidationBatch. Returns false if no batch is
+    // active, in which case the caller must handle the notification itself. Nodes using this
+    // must override NotifyInvalidateBatch() to handle the queued notifications directly.
+    bool DeferInvalidate(const NodeList &invalid_nodes, bool unlink);
+
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
     NodeMap GetParentsForInvalidate(bool unlink);
@@ -115,8 +220,15 @@ class BASE_NODE : public std::enable_shared_from_this<BASE_NODE> {
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
     NodeMap parent_nodes_;
+    // Size of parent_nodes_, updated with tree_lock_ held. Objects without parents are
+    // common, reading this lets them skip the tree lock entirely.
+    std::atomic<uint32_t> parent_count_;
     // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
     mutable ReadWriteLock tree_lock_;
+
+    StateMemoryCounter *memory_counter_{nullptr};
+    uint32_t accounted_shallow_bytes_{0};
+    size_t accounted_bytes_{0};
 };
 
 class REFCOUNTED_NODE : public BASE_NODE {
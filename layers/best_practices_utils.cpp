@@ -27,9 +27,11 @@
 #include "cmd_buffer_state.h"
 #include "device_state.h"
 #include "render_pass_state.h"
+#include "xxhash.h"
 
 #include <string>
 #include <bitset>
+#include <limits>
 #include <memory>
 
 struct VendorSpecificInfo {
@@ -83,15 +85,6 @@ bp_state::CommandBuffer::CommandBuffer(BestPractices* bp, VkCommandBuffer cb, co
                                        const COMMAND_POOL_STATE* pool)
     : CMD_BUFFER_STATE(bp, cb, pCreateInfo, pool) {}
 
-bool BestPractices::VendorCheckEnabled(BPVendorFlags vendors) const {
-    for (const auto& vendor : kVendorInfo) {
-        if (vendors & vendor.first && enabled[vendor.second.vendor_id]) {
-            return true;
-        }
-    }
-    return false;
-}
-
 const char* VendorSpecificTag(BPVendorFlags vendors) {
     // Cache built vendor tags in a map
     static layer_data::unordered_map<BPVendorFlags, std::string> tag_map;
@@ -1076,6 +1069,21 @@ std::shared_ptr<PIPELINE_STATE> BestPractices::CreateGraphicsPipelineState(
         std::make_shared<bp_state::Pipeline>(this, pCreateInfo, std::move(render_pass), std::move(layout)));
 }
 
+std::shared_ptr<PIPELINE_STATE> BestPractices::CreateComputePipelineState(
+    const VkComputePipelineCreateInfo* pCreateInfo, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const {
+    return std::static_pointer_cast<PIPELINE_STATE>(std::make_shared<bp_state::Pipeline>(this, pCreateInfo, std::move(layout)));
+}
+
+std::shared_ptr<PIPELINE_STATE> BestPractices::CreateRayTracingPipelineState(
+    const VkRayTracingPipelineCreateInfoNV* pCreateInfo, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const {
+    return std::static_pointer_cast<PIPELINE_STATE>(std::make_shared<bp_state::Pipeline>(this, pCreateInfo, std::move(layout)));
+}
+
+std::shared_ptr<PIPELINE_STATE> BestPractices::CreateRayTracingPipelineState(
+    const VkRayTracingPipelineCreateInfoKHR* pCreateInfo, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const {
+    return std::static_pointer_cast<PIPELINE_STATE>(std::make_shared<bp_state::Pipeline>(this, pCreateInfo, std::move(layout)));
+}
+
 void BestPractices::ManualPostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                 const VkGraphicsPipelineCreateInfo* pCreateInfos,
                                                                 const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
@@ -1167,8 +1175,9 @@ bool BestPractices::ValidateCreateComputePipelineArm(const VkComputePipelineCrea
                                       kThreadGroupDispatchCountAlignmentArm);
     }
 
-    auto accessible_ids = module_state->MarkAccessibleIds(entrypoint);
-    auto descriptor_uses = module_state->CollectInterfaceByDescriptorSlot(accessible_ids);
+    // The analysis is shared with the pipeline's stage state once the pipeline is created
+    const auto entry_point_state = module_state->GetEntryPointState(createInfo.stage.pName, createInfo.stage.stage);
+    const auto &descriptor_uses = entry_point_state->descriptor_uses;
 
     unsigned dimensions = 0;
     if (x > 1) dimensions++;
@@ -1519,46 +1528,48 @@ void BestPractices::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
                                                   VkPipeline pipeline) {
     StateTracker::PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
 
+    auto pipeline_state = Get<bp_state::Pipeline>(pipeline);
+    if (!pipeline_state) return;
+
     // AMD best practice
-    PipelineUsedInFrame(pipeline);
+    if (VendorCheckEnabled(kBPVendorAMD)) {
+        PipelineUsedInFrame(*pipeline_state);
+    }
 
     if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        auto pipeline_state = Get<bp_state::Pipeline>(pipeline);
         // check for depth/blend state tracking
-        if (pipeline_state) {
-            auto cb_node = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-            assert(cb_node);
-            auto& render_pass_state = cb_node->render_pass_state;
-
-            render_pass_state.nextDrawTouchesAttachments = pipeline_state->access_framebuffer_attachments;
-            render_pass_state.drawTouchAttachments = true;
-
-            const auto* blend_state = pipeline_state->ColorBlendState();
-            const auto* stencil_state = pipeline_state->DepthStencilState();
-
-            if (blend_state) {
-                // assume the pipeline is depth-only unless any of the attachments have color writes enabled
-                render_pass_state.depthOnly = true;
-                for (size_t i = 0; i < blend_state->attachmentCount; i++) {
-                    if (blend_state->pAttachments[i].colorWriteMask != 0) {
-                        render_pass_state.depthOnly = false;
-                    }
+        auto cb_node = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+        assert(cb_node);
+        auto& render_pass_state = cb_node->render_pass_state;
+
+        render_pass_state.nextDrawTouchesAttachments = pipeline_state->access_framebuffer_attachments;
+        render_pass_state.drawTouchAttachments = true;
+
+        const auto* blend_state = pipeline_state->ColorBlendState();
+        const auto* stencil_state = pipeline_state->DepthStencilState();
+
+        if (blend_state) {
+            // assume the pipeline is depth-only unless any of the attachments have color writes enabled
+            render_pass_state.depthOnly = true;
+            for (size_t i = 0; i < blend_state->attachmentCount; i++) {
+                if (blend_state->pAttachments[i].colorWriteMask != 0) {
+                    render_pass_state.depthOnly = false;
                 }
             }
+        }
 
-            // check for depth value usage
-            render_pass_state.depthEqualComparison = false;
+        // check for depth value usage
+        render_pass_state.depthEqualComparison = false;
 
-            if (stencil_state && stencil_state->depthTestEnable) {
-                switch (stencil_state->depthCompareOp) {
-                    case VK_COMPARE_OP_EQUAL:
-                    case VK_COMPARE_OP_GREATER_OR_EQUAL:
-                    case VK_COMPARE_OP_LESS_OR_EQUAL:
-                        render_pass_state.depthEqualComparison = true;
-                        break;
-                    default:
-                        break;
-                }
+        if (stencil_state && stencil_state->depthTestEnable) {
+            switch (stencil_state->depthCompareOp) {
+                case VK_COMPARE_OP_EQUAL:
+                case VK_COMPARE_OP_GREATER_OR_EQUAL:
+                case VK_COMPARE_OP_LESS_OR_EQUAL:
+                    render_pass_state.depthEqualComparison = true;
+                    break;
+                default:
+                    break;
             }
         }
     }
@@ -1699,12 +1710,8 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* functi
     const uint32_t max_levels = state->createInfo.mipLevels - subresource_range.baseMipLevel;
     const uint32_t mip_levels = std::min(state->createInfo.mipLevels, max_levels);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        for (uint32_t level = 0; level < mip_levels; level++) {
-            QueueValidateImage(funcs, function_name, state, usage, layer + base_array_layer,
-                               level + subresource_range.baseMipLevel);
-        }
-    }
+    QueueValidateImage(funcs, function_name, state, usage, base_array_layer, array_layers, subresource_range.baseMipLevel,
+                       mip_levels);
 }
 
 void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* function_name, std::shared_ptr<bp_state::Image>& state,
@@ -1712,18 +1719,23 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* functi
     const uint32_t max_layers = state->createInfo.arrayLayers - subresource_layers.baseArrayLayer;
     const uint32_t array_layers = std::min(subresource_layers.layerCount, max_layers);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        QueueValidateImage(funcs, function_name, state, usage, layer + subresource_layers.baseArrayLayer, subresource_layers.mipLevel);
-    }
+    QueueValidateImage(funcs, function_name, state, usage, subresource_layers.baseArrayLayer, array_layers,
+                       subresource_layers.mipLevel, 1);
 }
 
 void BestPractices::QueueValidateImage(QueueCallbacks &funcs, const char* function_name,
                                        std::shared_ptr<bp_state::Image> &state, IMAGE_SUBRESOURCE_USAGE_BP usage,
-                                       uint32_t array_layer, uint32_t mip_level) {
-    if (VendorCheckEnabled(kBPVendorArm)) {
-        funcs.push_back([this, function_name, state, usage, array_layer, mip_level](
+                                       uint32_t base_array_layer, uint32_t array_layers, uint32_t base_mip_level,
+                                       uint32_t mip_levels) {
+    if (VendorCheckEnabled(kBPVendorArm) && array_layers > 0 && mip_levels > 0) {
+        // One callback for all the subresources, a texture array can have thousands of layers
+        funcs.push_back([this, function_name, state, usage, base_array_layer, array_layers, base_mip_level, mip_levels](
                             const ValidationStateTracker&, const QUEUE_STATE&, const CMD_BUFFER_STATE&) -> bool {
-            ValidateImageInQueue(function_name, *state, usage, array_layer, mip_level);
+            for (uint32_t layer = base_array_layer; layer < base_array_layer + array_layers; layer++) {
+                for (uint32_t level = base_mip_level; level < base_mip_level + mip_levels; level++) {
+                    ValidateImageInQueue(function_name, *state, usage, layer, level);
+                }
+            }
             return false;
         });
     }
@@ -1969,7 +1981,6 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, Rend
     cb->hasDrawCmd = false;
     assert(cb);
     auto& render_pass_state = cb->render_pass_state;
-    render_pass_state.touchesAttachments.clear();
     render_pass_state.earlyClearAttachments.clear();
     render_pass_state.numDrawCallsDepthOnly = 0;
     render_pass_state.numDrawCallsDepthEqualCompare = 0;
@@ -1979,6 +1990,7 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, Rend
     // Don't reset state related to pipeline state.
 
     auto rp_state = Get<RENDER_PASS_STATE>(pRenderPassBegin->renderPass);
+    render_pass_state.touchedAspects.assign(rp_state->createInfo.attachmentCount, 0);
 
     // track depth / color attachment usage within the renderpass
     for (size_t i = 0; i < rp_state->createInfo.subpassCount; i++) {
@@ -2130,6 +2142,133 @@ bool BestPractices::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
     return skip;
 }
 
+// Min and max of the indices. Each block of kLanes indices is folded into independent lanes so that the loop vectorizes.
+template <typename IndexType>
+static void IndexMinMax(const IndexType* indices, uint32_t index_count, uint32_t& min_index, uint32_t& max_index) {
+    const uint32_t kLanes = 32;
+    IndexType lane_min[kLanes];
+    IndexType lane_max[kLanes];
+    for (uint32_t lane = 0; lane < kLanes; ++lane) {
+        lane_min[lane] = std::numeric_limits<IndexType>::max();
+        lane_max[lane] = 0;
+    }
+
+    uint32_t i = 0;
+    for (; i + kLanes <= index_count; i += kLanes) {
+        for (uint32_t lane = 0; lane < kLanes; ++lane) {
+            const IndexType index = indices[i + lane];
+            lane_min[lane] = (index < lane_min[lane]) ? index : lane_min[lane];
+            lane_max[lane] = (index > lane_max[lane]) ? index : lane_max[lane];
+        }
+    }
+    for (; i < index_count; ++i) {
+        lane_min[0] = std::min(lane_min[0], indices[i]);
+        lane_max[0] = std::max(lane_max[0], indices[i]);
+    }
+
+    // start with minimum as 0xFFFFFFFF and maximum as 0, so that a draw without indices has max_index < min_index
+    min_index = ~0u;
+    max_index = 0u;
+    if (index_count == 0) return;
+    for (uint32_t lane = 0; lane < kLanes; ++lane) {
+        min_index = std::min(min_index, static_cast<uint32_t>(lane_min[lane]));
+        max_index = std::max(max_index, static_cast<uint32_t>(lane_max[lane]));
+    }
+}
+
+template <typename IndexType>
+BestPractices::IndexBufferScan BestPractices::ScanIndices(const IndexType* indices, uint32_t index_count,
+                                                          bool primitive_restart_enable) {
+    IndexBufferScan scan = {};
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    IndexMinMax(indices, index_count, scan.min_index, scan.max_index);
+
+    // The range alone is enough when all indices are the same or the index buffer is sparse
+    if (scan.max_index <= scan.min_index || scan.max_index - scan.min_index >= index_count) return scan;
+
+    // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
+    // for the given index buffer
+    PostTransformLRUCacheModel post_transform_cache;
+
+    // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+    // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+    // target architecture.
+    // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+    // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+    post_transform_cache.resize(32);
+
+    const IndexType primitive_restart_value = std::numeric_limits<IndexType>::max();
+    for (uint32_t i = 0; i < index_count; ++i) {
+        const IndexType scan_index = indices[i];
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) scan.vertex_shade_count++;
+        }
+    }
+
+    // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
+    const size_t refs_per_bucket = 64;
+    std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
+
+    const uint32_t n_indices = scan.max_index - scan.min_index + 1;
+    const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
+                               ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
+
+    // there needs to be at least one bitset to store a set of indices smaller than n_buckets
+    vertex_reference_buckets.resize(std::max(1u, n_buckets));
+
+    // To avoid using too much memory, we run over the indices again.
+    // Knowing the size from the last scan allows us to record index usage with bitsets
+    for (uint32_t i = 0; i < index_count; ++i) {
+        // keep track of the set of all indices used to reference vertices in the draw call
+        size_t index_offset = indices[i] - scan.min_index;
+        size_t bitset_bucket_index = index_offset / refs_per_bucket;
+        uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
+        vertex_reference_buckets[bitset_bucket_index] |= used_indices;
+    }
+
+    for (const auto& bitset : vertex_reference_buckets) {
+        scan.vertex_reference_count += static_cast<uint32_t>(bitset.count());
+    }
+    return scan;
+}
+
+BestPractices::IndexBufferScan BestPractices::ScanIndexBufferArm(const uint8_t* indices, uint32_t index_count,
+                                                                 VkIndexType index_type, uint32_t index_size,
+                                                                 bool primitive_restart_enable) const {
+    const bool cached = index_count >= kMinCachedIndexBufferScan;
+    const IndexBufferScanKey key = {indices, index_count, index_type, primitive_restart_enable};
+    uint64_t content_hash = 0;
+    if (cached) {
+        // Static meshes are drawn many times with the same ranges, and hashing their indices costs far less than scanning them
+        content_hash = XXH64(indices, static_cast<size_t>(index_count) * index_size, 0);
+        std::lock_guard<std::mutex> guard(index_buffer_scan_lock_);
+        const auto entry = index_buffer_scans_.find(key);
+        if (entry != index_buffer_scans_.end() && entry->second.content_hash == content_hash) return entry->second.scan;
+    }
+
+    IndexBufferScan scan;
+    if (index_type == VK_INDEX_TYPE_UINT8_EXT) {
+        scan = ScanIndices(indices, index_count, primitive_restart_enable);
+    } else if (index_type == VK_INDEX_TYPE_UINT16) {
+        scan = ScanIndices(reinterpret_cast<const uint16_t*>(indices), index_count, primitive_restart_enable);
+    } else {
+        scan = ScanIndices(reinterpret_cast<const uint32_t*>(indices), index_count, primitive_restart_enable);
+    }
+
+    if (cached) {
+        std::lock_guard<std::mutex> guard(index_buffer_scan_lock_);
+        if (index_buffer_scans_.size() >= kMaxCachedIndexBufferScans) index_buffer_scans_.clear();
+        index_buffer_scans_[key] = IndexBufferScanEntry{content_hash, scan};
+    }
+    return scan;
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
                                            uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const {
     bool skip = false;
@@ -2166,53 +2305,9 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
         }
 
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + ib_mem_offset + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
-            }
-
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
-            }
-        }
+        const IndexBufferScan scan = ScanIndexBufferArm(scan_begin, indexCount, ib_type, scan_stride, primitive_restart_enable);
+        const uint32_t min_index = scan.min_index;
+        const uint32_t max_index = scan.max_index;
 
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
@@ -2230,40 +2325,8 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
+        const uint32_t vertex_shade_count = scan.vertex_shade_count;
+        const uint32_t vertex_reference_count = scan.vertex_reference_count;
 
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
         float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
@@ -2342,8 +2405,11 @@ void BestPractices::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
             }
         }
 
-        for (auto& touch : secondary->render_pass_state.touchesAttachments) {
-            RecordAttachmentAccess(*primary, touch.framebufferAttachment, touch.aspects);
+        const auto& secondary_touched_aspects = secondary->render_pass_state.touchedAspects;
+        for (uint32_t fb_attachment = 0; fb_attachment < secondary_touched_aspects.size(); fb_attachment++) {
+            if (secondary_touched_aspects[fb_attachment]) {
+                RecordAttachmentAccess(*primary, fb_attachment, secondary_touched_aspects[fb_attachment]);
+            }
         }
 
         primary->render_pass_state.numDrawCallsDepthEqualCompare += secondary->render_pass_state.numDrawCallsDepthEqualCompare;
@@ -2359,15 +2425,7 @@ void BestPractices::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
 void BestPractices::RecordAttachmentAccess(bp_state::CommandBuffer& cb_state, uint32_t fb_attachment, VkImageAspectFlags aspects) {
     auto& state = cb_state.render_pass_state;
     // Called when we have a partial clear attachment, or a normal draw call which accesses an attachment.
-    auto itr =
-        std::find_if(state.touchesAttachments.begin(), state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    if (itr != state.touchesAttachments.end()) {
-        itr->aspects |= aspects;
-    } else {
-        state.touchesAttachments.push_back({ fb_attachment, aspects });
-    }
+    state.TouchAttachment(fb_attachment, aspects);
 }
 
 void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cmd_state, uint32_t fb_attachment,
@@ -2376,17 +2434,7 @@ void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cm
     auto& state = cmd_state.render_pass_state;
     // If we observe a full clear before any other access to a frame buffer attachment,
     // we have candidate for redundant clear attachments.
-    auto itr =
-        std::find_if(state.touchesAttachments.begin(), state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    uint32_t new_aspects = aspects;
-    if (itr != state.touchesAttachments.end()) {
-        new_aspects = aspects & ~itr->aspects;
-        itr->aspects |= aspects;
-    } else {
-        state.touchesAttachments.push_back({ fb_attachment, aspects });
-    }
+    const uint32_t new_aspects = aspects & ~state.TouchAttachment(fb_attachment, aspects);
 
     if (new_aspects == 0) {
         return;
@@ -2454,7 +2502,8 @@ void BestPractices::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, u
                                                         firstInstance);
 
     auto cmd_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    if ((indexCount * instanceCount) <= kSmallIndexedDrawcallIndices) {
+    if ((indexCount * instanceCount) <= kSmallIndexedDrawcallIndices &&
+        (VendorCheckEnabled(kBPVendorArm) || VendorCheckEnabled(kBPVendorIMG))) {
         cmd_state->small_indexed_draw_call_count++;
     }
 
@@ -2523,6 +2572,9 @@ void BestPractices::PostCallRecordCmdDrawIndexedIndirect(VkCommandBuffer command
 }
 
 void BestPractices::ValidateBoundDescriptorSets(bp_state::CommandBuffer& cb_state, const char* function_name) {
+    // The descriptor accesses are only used by the Arm image usage checks, see QueueValidateImage
+    if (!VendorCheckEnabled(kBPVendorArm)) return;
+
     for (auto descriptor_set : cb_state.validated_descriptor_sets) {
         const auto& layout = *descriptor_set->GetLayout();
 
@@ -2693,12 +2745,7 @@ bool BestPractices::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer) cons
                 continue;
             }
 
-            auto itr = std::find_if(render_pass_state.touchesAttachments.begin(), render_pass_state.touchesAttachments.end(),
-                                    [i](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == i; });
-            uint32_t untouched_aspects = bandwidth_aspects;
-            if (itr != render_pass_state.touchesAttachments.end()) {
-                untouched_aspects &= ~itr->aspects;
-            }
+            const uint32_t untouched_aspects = bandwidth_aspects & ~render_pass_state.TouchedAspects(i);
 
             if (untouched_aspects) {
                 skip |= LogPerformanceWarning(
@@ -3043,15 +3090,8 @@ bool BestPractices::ValidateClearAttachment(const bp_state::CommandBuffer& cmd,
 
     const auto& rp_state = cmd.render_pass_state;
 
-    auto attachment_itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
     // Only report aspects which haven't been touched yet.
-    VkImageAspectFlags new_aspects = aspects;
-    if (attachment_itr != rp_state.touchesAttachments.end()) {
-        new_aspects &= ~attachment_itr->aspects;
-    }
+    const VkImageAspectFlags new_aspects = aspects & ~rp_state.TouchedAspects(fb_attachment);
 
     // Warn if this is issued prior to Draw Cmd and clearing the entire attachment
     if (!cmd.hasDrawCmd) {
@@ -3413,7 +3453,9 @@ void BestPractices::PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipe
     ValidationStateTracker::PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                  pPipelines);
     // AMD best practice
-    num_pso_ += createInfoCount;
+    if (VendorCheckEnabled(kBPVendorAMD)) {
+        num_pso_ += createInfoCount;
+    }
 }
 
 bool BestPractices::PreCallValidateUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
@@ -3547,7 +3589,8 @@ bool BestPractices::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer
     bool skip = false;
 
     if (VendorCheckEnabled(kBPVendorAMD)) {
-        if (IsPipelineUsedInFrame(pipeline)) {
+        const auto pipeline_state = Get<bp_state::Pipeline>(pipeline);
+        if (pipeline_state && IsPipelineUsedInFrame(*pipeline_state)) {
             skip |= LogPerformanceWarning(device, kVUID_BestPractices_Pipeline_SortAndBind,
                         "%s Performance warning: Pipeline %s was bound twice in the frame. Keep pipeline state changes to a minimum,"
                         "for example, by sorting draw calls by pipeline.",
@@ -3561,7 +3604,9 @@ bool BestPractices::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer
 void BestPractices::ManualPostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits,
                                                     VkFence fence, VkResult result) {
     // AMD best practice
-    num_queue_submissions_ += submitCount;
+    if (VendorCheckEnabled(kBPVendorAMD)) {
+        num_queue_submissions_ += submitCount;
+    }
 }
 
 bool BestPractices::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const {
@@ -3588,7 +3633,9 @@ void BestPractices::PostCallRecordCmdPipelineBarrier(VkCommandBuffer commandBuff
                                                      const VkBufferMemoryBarrier* pBufferMemoryBarriers,
                                                      uint32_t imageMemoryBarrierCount,
                                                      const VkImageMemoryBarrier* pImageMemoryBarriers) {
-    num_barriers_objects_ += (memoryBarrierCount + imageMemoryBarrierCount + bufferMemoryBarrierCount);
+    if (VendorCheckEnabled(kBPVendorAMD)) {
+        num_barriers_objects_ += (memoryBarrierCount + imageMemoryBarrierCount + bufferMemoryBarrierCount);
+    }
 }
 
 bool BestPractices::PreCallValidateCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
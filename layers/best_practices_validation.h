@@ -25,6 +25,7 @@
 #include "state_tracker.h"
 #include "image_state.h"
 #include "cmd_buffer_state.h"
+#include "hash_util.h"
 #include <string>
 
 static const uint32_t kMemoryObjectWarningLimit = 250;
@@ -166,23 +167,21 @@ class Image : public IMAGE_STATE {
     }
 
     IMAGE_SUBRESOURCE_USAGE_BP UpdateUsage(uint32_t array_layer, uint32_t mip_level, IMAGE_SUBRESOURCE_USAGE_BP usage) {
-        auto last_usage = usages_[array_layer][mip_level];
-        usages_[array_layer][mip_level] = usage;
+        auto& subresource_usage = usages_[static_cast<size_t>(array_layer) * createInfo.mipLevels + mip_level];
+        auto last_usage = subresource_usage;
+        subresource_usage = usage;
         return last_usage;
     }
 
   private:
     void SetupUsages() {
-        usages_.resize(createInfo.arrayLayers);
-        for (auto& mip_vec : usages_) {
-            mip_vec.resize(createInfo.mipLevels, IMAGE_SUBRESOURCE_USAGE_BP::UNDEFINED);
-        }
+        usages_.resize(static_cast<size_t>(createInfo.arrayLayers) * createInfo.mipLevels, IMAGE_SUBRESOURCE_USAGE_BP::UNDEFINED);
     }
-    // A 2d vector for all the array layers and mip levels.
+    // The usages of all the array layers and mip levels, in one allocation, with the mip levels of each layer next to each other.
     // This does not split usages per aspect.
     // Aspects are generally read and written together,
     // and tracking them independently could be misleading.
-    std::vector<std::vector<IMAGE_SUBRESOURCE_USAGE_BP>> usages_;
+    std::vector<IMAGE_SUBRESOURCE_USAGE_BP> usages_;
 };
 
 class PhysicalDevice : public PHYSICAL_DEVICE_STATE {
@@ -234,9 +233,25 @@ struct RenderPassState {
     };
 
     std::vector<ClearInfo> earlyClearAttachments;
-    std::vector<AttachmentInfo> touchesAttachments;
+    // The aspects of each framebuffer attachment that a pipeline or clear command has accessed, indexed by attachment.
+    // Sized at vkCmdBeginRenderPass, and grown as attachments are touched in secondary command buffers.
+    std::vector<VkImageAspectFlags> touchedAspects;
     std::vector<AttachmentInfo> nextDrawTouchesAttachments;
     bool drawTouchAttachments = false;
+
+    VkImageAspectFlags TouchedAspects(uint32_t fb_attachment) const {
+        return fb_attachment < touchedAspects.size() ? touchedAspects[fb_attachment] : 0;
+    }
+
+    // Returns the aspects that were touched before
+    VkImageAspectFlags TouchAttachment(uint32_t fb_attachment, VkImageAspectFlags aspects) {
+        if (fb_attachment >= touchedAspects.size()) {
+            touchedAspects.resize(fb_attachment + 1, 0);
+        }
+        const VkImageAspectFlags touched = touchedAspects[fb_attachment];
+        touchedAspects[fb_attachment] = touched | aspects;
+        return touched;
+    }
 };
 
 class CommandBuffer : public CMD_BUFFER_STATE {
@@ -260,7 +275,16 @@ class Pipeline : public PIPELINE_STATE {
     Pipeline(const ValidationStateTracker* state_data, const VkGraphicsPipelineCreateInfo* pCreateInfo,
              std::shared_ptr<const RENDER_PASS_STATE>&& rpstate, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout);
 
+    template <typename CreateInfo>
+    Pipeline(const ValidationStateTracker* state_data, const CreateInfo* pCreateInfo,
+             std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout)
+        : PIPELINE_STATE(state_data, pCreateInfo, std::move(layout)) {}
+
     const std::vector<AttachmentInfo> access_framebuffer_attachments;
+
+    // The frame, counted by BestPractices::frame_count_, in which the pipeline was last bound.
+    // Everything else here is set at creation, so the checks of bound pipelines need no lock.
+    mutable std::atomic<uint64_t> last_bound_frame{UINT64_MAX};
 };
 }  // namespace bp_state
 
@@ -508,7 +532,7 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer,
                                          const VkResolveImageInfo2* pResolveImageInfo) const override;
 
-    using QueueCallbacks = std::vector<CMD_BUFFER_STATE::QueueCallback>;
+    using QueueCallbacks = CMD_BUFFER_STATE::QueueCallbacks;
 
     void QueueValidateImageView(QueueCallbacks &func, const char* function_name,
                                 IMAGE_VIEW_STATE* view, IMAGE_SUBRESOURCE_USAGE_BP usage);
@@ -517,7 +541,8 @@ class BestPractices : public ValidationStateTracker {
     void QueueValidateImage(QueueCallbacks& func, const char* function_name, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& range);
     void QueueValidateImage(QueueCallbacks& func, const char* function_name, std::shared_ptr<bp_state::Image>& state,
-                            IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
+                            IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t base_array_layer, uint32_t array_layers,
+                            uint32_t base_mip_level, uint32_t mip_levels);
     void ValidateImageInQueue(const char* function_name, bp_state::Image& state, IMAGE_SUBRESOURCE_USAGE_BP usage,
                               uint32_t array_layer, uint32_t mip_level);
     void ValidateImageInQueueArmImg(const char* function_name, const bp_state::Image& image, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
@@ -704,6 +729,12 @@ class BestPractices : public ValidationStateTracker {
     std::shared_ptr<PIPELINE_STATE> CreateGraphicsPipelineState(const VkGraphicsPipelineCreateInfo* pCreateInfo,
                                                                 std::shared_ptr<const RENDER_PASS_STATE>&& render_pass,
                                                                 std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const final;
+    std::shared_ptr<PIPELINE_STATE> CreateComputePipelineState(const VkComputePipelineCreateInfo* pCreateInfo,
+                                                               std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const final;
+    std::shared_ptr<PIPELINE_STATE> CreateRayTracingPipelineState(
+        const VkRayTracingPipelineCreateInfoNV* pCreateInfo, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const final;
+    std::shared_ptr<PIPELINE_STATE> CreateRayTracingPipelineState(
+        const VkRayTracingPipelineCreateInfoKHR* pCreateInfo, std::shared_ptr<const PIPELINE_LAYOUT_STATE>&& layout) const final;
 
   private:
     // CacheEntry and PostTransformLRUCacheModel are used on the stack
@@ -726,8 +757,58 @@ class BestPractices : public ValidationStateTracker {
         uint32_t iteration = 0;
     };
 
+    // What ValidateIndexBufferArm learns from the indices of a draw. The counts are only filled in when the index range alone
+    // does not decide the checks.
+    struct IndexBufferScan {
+        uint32_t min_index;
+        uint32_t max_index;
+        uint32_t vertex_shade_count;
+        uint32_t vertex_reference_count;
+    };
+
+    struct IndexBufferScanKey {
+        const void* indices;
+        uint32_t index_count;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+
+        bool operator==(const IndexBufferScanKey& other) const {
+            return indices == other.indices && index_count == other.index_count && index_type == other.index_type &&
+                   primitive_restart_enable == other.primitive_restart_enable;
+        }
+
+        struct Hash {
+            size_t operator()(const IndexBufferScanKey& key) const {
+                hash_util::HashCombiner hc;
+                hc << reinterpret_cast<uintptr_t>(key.indices) << key.index_count << static_cast<uint32_t>(key.index_type)
+                   << key.primitive_restart_enable;
+                return hc.Value();
+            }
+        };
+    };
+
+    // Host writes to mapped memory are not seen by the layer, so a scan is only reused while its indices hash the same
+    struct IndexBufferScanEntry {
+        uint64_t content_hash;
+        IndexBufferScan scan;
+    };
+
+    // Ranges with fewer indices are scanned again rather than cached
+    static const uint32_t kMinCachedIndexBufferScan = 256;
+    static const size_t kMaxCachedIndexBufferScans = 1024;
+
+    IndexBufferScan ScanIndexBufferArm(const uint8_t* indices, uint32_t index_count, VkIndexType index_type, uint32_t index_size,
+                                       bool primitive_restart_enable) const;
+    template <typename IndexType>
+    static IndexBufferScan ScanIndices(const IndexType* indices, uint32_t index_count, bool primitive_restart_enable);
+
     // Check that vendor-specific checks are enabled for at least one of the vendors
-    bool VendorCheckEnabled(BPVendorFlags vendors) const;
+    // Called from the per-draw and per-submit hooks, so that the bookkeeping of a vendor whose checks are off is skipped cheaply
+    bool VendorCheckEnabled(BPVendorFlags vendors) const {
+        return ((vendors & kBPVendorArm) && enabled[vendor_specific_arm]) ||
+               ((vendors & kBPVendorAMD) && enabled[vendor_specific_amd]) ||
+               ((vendors & kBPVendorIMG) && enabled[vendor_specific_img]);
+    }
 
     void RecordCmdDrawTypeArm(bp_state::CommandBuffer& cmd_state, uint32_t draw_count, const char* caller);
 
@@ -749,19 +830,14 @@ class BestPractices : public ValidationStateTracker {
     bool ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer) const;
     void RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin);
 
-    void PipelineUsedInFrame(VkPipeline pipeline) {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.insert(pipeline);
+    void PipelineUsedInFrame(const bp_state::Pipeline& pipeline_state) {
+        pipeline_state.last_bound_frame.store(frame_count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
     }
 
-    void ClearPipelinesUsedInFrame() {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.clear();
-    }
+    void ClearPipelinesUsedInFrame() { frame_count_.fetch_add(1, std::memory_order_relaxed); }
 
-    bool IsPipelineUsedInFrame(VkPipeline pipeline) const {
-        ReadLockGuard guard(pipeline_lock_);
-        return pipelines_used_in_frame_.count(pipeline) != 0;
+    bool IsPipelineUsedInFrame(const bp_state::Pipeline& pipeline_state) const {
+        return pipeline_state.last_bound_frame.load(std::memory_order_relaxed) == frame_count_.load(std::memory_order_relaxed);
     }
 
     // AMD tracked
@@ -771,6 +847,9 @@ class BestPractices : public ValidationStateTracker {
 
     std::atomic<VkPipelineCache> pipeline_cache_{VK_NULL_HANDLE};
 
-    layer_data::unordered_set<VkPipeline> pipelines_used_in_frame_;
-    mutable ReadWriteLock pipeline_lock_;
+    // Presents so far, the frames of PipelineUsedInFrame
+    std::atomic<uint64_t> frame_count_{0};
+
+    mutable layer_data::unordered_map<IndexBufferScanKey, IndexBufferScanEntry, IndexBufferScanKey::Hash> index_buffer_scans_;
+    mutable std::mutex index_buffer_scan_lock_;
 };
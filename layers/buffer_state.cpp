@@ -30,7 +30,7 @@
 #include "state_tracker.h"
 
 static VkExternalMemoryHandleTypeFlags GetExternalHandleType(const VkBufferCreateInfo *create_info) {
-    const auto *external_memory_info = LvlFindInChain<VkExternalMemoryBufferCreateInfo>(create_info->pNext);
+    const auto *external_memory_info = CallFindInChain<VkExternalMemoryBufferCreateInfo>(create_info->pNext);
     return external_memory_info ? external_memory_info->handleTypes : 0;
 }
 
@@ -43,8 +43,8 @@ static VkMemoryRequirements GetMemoryRequirements(ValidationStateTracker *dev_da
 BUFFER_STATE::BUFFER_STATE(ValidationStateTracker *dev_data, VkBuffer buff, const VkBufferCreateInfo *pCreateInfo)
     : BINDABLE(buff, kVulkanObjectTypeBuffer, (pCreateInfo->flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_BUFFER_CREATE_PROTECTED_BIT) == 0, GetExternalHandleType(pCreateInfo)),
-          safe_create_info(pCreateInfo),
-          createInfo(*safe_create_info.ptr()),
+          safe_create_info(GetSharedCreateInfo(pCreateInfo)),
+          createInfo(*safe_create_info->ptr()),
           deviceAddress(0),
           requirements(GetMemoryRequirements(dev_data, buff)),
           memory_requirements_checked(false) {}
@@ -28,12 +28,14 @@
 #pragma once
 #include "device_memory_state.h"
 #include "range_vector.h"
+#include "create_info_cache.h"
 
 class ValidationStateTracker;
 
 class BUFFER_STATE : public BINDABLE {
   public:
-    const safe_VkBufferCreateInfo safe_create_info;
+    // Shared with other buffers created with an identical create info, see GetSharedCreateInfo()
+    const std::shared_ptr<const safe_VkBufferCreateInfo> safe_create_info;
     const VkBufferCreateInfo &createInfo;
     VkDeviceAddress deviceAddress;
     const VkMemoryRequirements requirements;
@@ -38,6 +38,7 @@
 #include "chassis.h"
 #include "core_validation.h"
 #include "core_error_location.h"
+#include "hook_timing.h"
 #include "shader_validation.h"
 #include "descriptor_sets.h"
 #include "buffer_validation.h"
@@ -254,7 +255,10 @@ static bool ImageLayoutMatches(const VkImageAspectFlags aspect_mask, VkImageLayo
     return matches;
 }
 
-// Utility type for ForRange callbacks
+using LayoutEntry = ImageSubresourceLayoutMap::LayoutEntry;
+using SubresourceIndex = image_layout_map::IndexType;
+
+// Utility type for ImageSubresourceLayoutMap::AnyInRange visitors
 struct LayoutUseCheckAndMessage {
     const static VkImageAspectFlags kDepthOrStencil = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
     const ImageSubresourceLayoutMap *layout_map;
@@ -265,15 +269,18 @@ struct LayoutUseCheckAndMessage {
     LayoutUseCheckAndMessage() = delete;
     LayoutUseCheckAndMessage(const ImageSubresourceLayoutMap *layout_map_, const VkImageAspectFlags aspect_mask_ = 0)
         : layout_map(layout_map_), aspect_mask{aspect_mask_}, message(nullptr), layout(kInvalidLayout) {}
-    bool Check(const VkImageSubresource &subres, VkImageLayout check, VkImageLayout current_layout, VkImageLayout initial_layout) {
+    // index is a subresource of the entry, the initial layout is only checked when the current layout is unknown
+    bool Check(SubresourceIndex index, VkImageLayout check, const LayoutEntry &entry) {
         message = nullptr;
         layout = kInvalidLayout;  // Success status
+        const VkImageLayout current_layout = entry.CurrentLayout();
+        const VkImageLayout initial_layout = (current_layout == kInvalidLayout) ? entry.InitialLayout() : kInvalidLayout;
         if (current_layout != kInvalidLayout && !ImageLayoutMatches(aspect_mask, check, current_layout)) {
             message = "previous known";
             layout = current_layout;
         } else if ((initial_layout != kInvalidLayout) && !ImageLayoutMatches(aspect_mask, check, initial_layout)) {
             // To check the relaxed rule matching we need to see how the initial use was used
-            const auto initial_layout_state = layout_map->GetSubresourceInitialLayoutState(subres);
+            const auto initial_layout_state = layout_map->GetSubresourceInitialLayoutState(index);
             assert(initial_layout_state);  // If we have an initial layout, we better have a state for it
             if (!((initial_layout_state->aspect_mask & kDepthOrStencil) &&
                   ImageLayoutMatches(initial_layout_state->aspect_mask, check, initial_layout))) {
@@ -334,10 +341,8 @@ uint32_t FullMipChainLevels(VkExtent3D extent) { return FullMipChainLevels(exten
 uint32_t FullMipChainLevels(VkExtent2D extent) { return FullMipChainLevels(extent.height, extent.width); }
 
 bool CoreChecks::FindLayouts(const IMAGE_STATE &image_state, std::vector<VkImageLayout> &layouts) const {
-    const auto *layout_range_map = image_state.layout_range_map.get();
-    if (!layout_range_map) return false;
-
-    auto guard = layout_range_map->ReadLock();
+    if (!image_state.layout_range_map) return false;
+    const auto layout_range_map = image_state.layout_range_map->Snapshot();
     // TODO: FindLayouts function should mutate into a ValidatePresentableLayout with the loop wrapping the LogError
     //       from the caller. You can then use decode to add the subresource of the range::begin to the error message.
 
@@ -581,14 +586,11 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
                     if (subresource_map) {
                         auto normalized_range = view_state->normalized_subresource_range;
                         normalized_range.aspectMask = test_aspect;
-                        auto pos = subresource_map->Find(normalized_range);
                         LayoutUseCheckAndMessage layout_check(subresource_map, test_aspect);
 
-                        // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to the next "constant value" range
-                        for (; !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-                            const VkImageSubresource &subres = pos->subresource;
-
-                            if (!layout_check.Check(subres, check_layout, pos->current_layout, pos->initial_layout)) {
+                        // Each visit covers all the subresources of a "constant value" range
+                        subresource_map->AnyInRange(normalized_range, [&](SubresourceIndex index, const LayoutEntry &entry) {
+                            if (!layout_check.Check(index, check_layout, entry)) {
                                 subres_skip |= LogError(
                                     device, kVUID_Core_DrawState_InvalidRenderpass,
                                     "You cannot start a render pass using attachment %u where the render pass initial layout is %s "
@@ -597,7 +599,8 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
                                     i, string_VkImageLayout(check_layout), layout_check.message,
                                     string_VkImageLayout(layout_check.layout));
                             }
-                        }
+                            return subres_skip;
+                        });
                     }
                 }
             }
@@ -806,7 +809,8 @@ bool CoreChecks::ValidateBarrierLayoutToImageUsage(const Location &loc, VkImage
 // Verify image barriers are compatible with the images they reference.
 template <typename ImageBarrier>
 bool CoreChecks::ValidateBarriersToImages(const Location &outer_loc, const CMD_BUFFER_STATE *cb_state,
-                                          uint32_t imageMemoryBarrierCount, const ImageBarrier *pImageMemoryBarriers) const {
+                                          uint32_t imageMemoryBarrierCount, const ImageBarrier *pImageMemoryBarriers,
+                                          const BarrierImageStates &image_states) const {
     bool skip = false;
     using sync_vuid_maps::GetImageBarrierVUID;
     using sync_vuid_maps::ImageError;
@@ -815,12 +819,15 @@ bool CoreChecks::ValidateBarriersToImages(const Location &outer_loc, const CMD_B
     // Pointers retained in the scoreboard only have the lifetime of *this* call (i.e. within the scope of the API call)
     const CommandBufferImageLayoutMap &current_map = cb_state->GetImageSubresourceLayoutMap();
     CommandBufferImageLayoutMap layout_updates;
+    // The layout update of the image of the previous barrier, as the barriers of an image mostly follow each other
+    const IMAGE_STATE *last_update_image = nullptr;
+    std::shared_ptr<ImageSubresourceLayoutMap> last_update_map;
 
     for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
         auto loc = outer_loc.dot(Field::pImageMemoryBarriers, i);
         const auto &img_barrier = pImageMemoryBarriers[i];
 
-        auto image_state = Get<IMAGE_STATE>(img_barrier.image);
+        const IMAGE_STATE *image_state = image_states[i];
         if (image_state) {
             VkImageUsageFlags usage_flags = image_state->createInfo.usage;
             skip |=
@@ -873,18 +880,23 @@ bool CoreChecks::ValidateBarriersToImages(const Location &outer_loc, const CMD_B
             if (img_barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                 // TODO: Set memory invalid which is in mem_tracker currently
             } else if (!QueueFamilyIsExternal(img_barrier.srcQueueFamilyIndex)) {
-                auto &write_subresource_map = layout_updates[image_state.get()];
                 bool new_write = false;
-                if (!write_subresource_map) {
-                    write_subresource_map = std::make_shared<ImageSubresourceLayoutMap>(*image_state);
-                    new_write = true;
+                if (image_state != last_update_image) {
+                    auto &update_map = layout_updates[image_state];
+                    if (!update_map) {
+                        update_map = std::make_shared<ImageSubresourceLayoutMap>(*image_state);
+                        new_write = true;
+                    }
+                    last_update_image = image_state;
+                    last_update_map = update_map;
                 }
-                const auto &current_subresource_map = current_map.find(image_state.get());
-                const auto &read_subresource_map = (new_write && current_subresource_map != current_map.end())
-                                                       ? (*current_subresource_map).second
-                                                       : write_subresource_map;
+                const auto &write_subresource_map = last_update_map;
+                const auto &current_subresource_map = new_write ? current_map.find(image_state) : current_map.end();
+                const auto &read_subresource_map =
+                    (current_subresource_map != current_map.end()) ? (*current_subresource_map).second : write_subresource_map;
 
                 bool subres_skip = false;
+                const auto barrier_isr = image_state->NormalizeSubresourceRange(img_barrier.subresourceRange);
                 // Validate aspects in isolation.
                 // This is required when handling separate depth-stencil layouts.
                 for (uint32_t aspect_index = 0; aspect_index < 32; aspect_index++) {
@@ -894,25 +906,25 @@ bool CoreChecks::ValidateBarriersToImages(const Location &outer_loc, const CMD_B
                     }
 
                     LayoutUseCheckAndMessage layout_check(read_subresource_map.get(), test_aspect);
-                    auto normalized_isr = image_state->NormalizeSubresourceRange(img_barrier.subresourceRange);
+                    auto normalized_isr = barrier_isr;
                     normalized_isr.aspectMask = test_aspect;
-                    // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to the next "constant value" range
-                    for (auto pos = read_subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip;
-                         pos.IncrementInterval()) {
-                        const auto &value = *pos;
-                        auto old_layout = NormalizeSynchronization2Layout(test_aspect, img_barrier.oldLayout);
-                        if (!layout_check.Check(value.subresource, old_layout, value.current_layout, value.initial_layout)) {
+                    const auto old_layout = NormalizeSynchronization2Layout(test_aspect, img_barrier.oldLayout);
+                    // Each visit covers all the subresources of a "constant value" range
+                    read_subresource_map->AnyInRange(normalized_isr, [&](SubresourceIndex index, const LayoutEntry &entry) {
+                        if (!layout_check.Check(index, old_layout, entry)) {
                             const auto &vuid = GetImageBarrierVUID(loc, ImageError::kConflictingLayout);
+                            const auto subresource = read_subresource_map->Decode(index);
                             subres_skip =
                                 LogError(cb_state->commandBuffer(), vuid,
                                          "%s %s cannot transition the layout of aspect=%d level=%d layer=%d from %s when the "
                                          "%s layout is %s.",
                                          loc.Message().c_str(), report_data->FormatHandle(img_barrier.image).c_str(),
-                                         value.subresource.aspectMask, value.subresource.mipLevel, value.subresource.arrayLayer,
+                                         subresource.aspectMask, subresource.mipLevel, subresource.arrayLayer,
                                          string_VkImageLayout(img_barrier.oldLayout), layout_check.message,
                                          string_VkImageLayout(layout_check.layout));
                         }
-                    }
+                        return subres_skip;
+                    });
                     write_subresource_map->SetSubresourceRangeLayout(*cb_state, normalized_isr, img_barrier.newLayout);
                 }
                 skip |= subres_skip;
@@ -959,6 +971,43 @@ bool CoreChecks::ValidateBarriersToImages(const Location &outer_loc, const CMD_B
     return skip;
 }
 
+template <typename ImageBarrier>
+void CoreChecks::GetBarrierImageStates(uint32_t barrier_count, const ImageBarrier *barriers,
+                                       BarrierImageStates &image_states) const {
+    // The barriers of a batch mostly keep to an image at a time, or alternate between a few images, so the last images looked
+    // up are checked first
+    static const uint32_t kRecentImages = 8;
+    VkImage recent_images[kRecentImages];
+    const IMAGE_STATE *recent_states[kRecentImages];
+    uint32_t recent_count = 0;
+    uint32_t next_recent = 0;
+
+    image_states.states.clear();
+    image_states.states.reserve(barrier_count);
+    image_states.references.clear();
+    for (uint32_t i = 0; i < barrier_count; ++i) {
+        const VkImage image = barriers[i].image;
+        const IMAGE_STATE *image_state = nullptr;
+        bool found = false;
+        for (uint32_t r = 0; r < recent_count; ++r) {
+            if (recent_images[r] == image) {
+                image_state = recent_states[r];
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            auto reference = Get<IMAGE_STATE>(image);
+            image_state = reference.get();
+            if (reference) image_states.references.emplace_back(std::move(reference));
+            const uint32_t slot = (recent_count < kRecentImages) ? recent_count++ : (next_recent++ % kRecentImages);
+            recent_images[slot] = image;
+            recent_states[slot] = image_state;
+        }
+        image_states.states.emplace_back(image_state);
+    }
+}
+
 template <typename Barrier, typename TransferBarrier>
 bool CoreChecks::ValidateQFOTransferBarrierUniqueness(const Location &loc, const CMD_BUFFER_STATE *cb_state, const Barrier &barrier,
                                                       const QFOTransferBarrierSets<TransferBarrier> &barrier_sets) const {
@@ -1227,18 +1276,18 @@ bool CoreChecks::ValidateAndUpdateQFOScoreboard(const debug_report_data *report_
                                                 Scoreboard *scoreboard) const {
     // Record to the scoreboard or report that we have a duplication
     bool skip = false;
-    auto inserted = scoreboard->emplace(barrier, cb_state);
-    if (!inserted.second && inserted.first->second != cb_state) {
+    const CMD_BUFFER_STATE *recorded_cb_state = scoreboard->Emplace(barrier, cb_state);
+    if (recorded_cb_state != cb_state) {
         // This is a duplication (but don't report duplicates from the same CB, as we do that at record time
         LogObjectList objlist(cb_state->commandBuffer());
         objlist.add(barrier.handle);
-        objlist.add(inserted.first->second->commandBuffer());
+        objlist.add(recorded_cb_state->commandBuffer());
         skip = LogWarning(objlist, TransferBarrier::ErrMsgDuplicateQFOInSubmit(),
                           "%s: %s %s queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
                           " to dstQueueFamilyIndex %" PRIu32 " duplicates existing barrier submitted in this batch from %s.",
                           "vkQueueSubmit()", TransferBarrier::BarrierName(), operation, TransferBarrier::HandleName(),
                           report_data->FormatHandle(barrier.handle).c_str(), barrier.srcQueueFamilyIndex,
-                          barrier.dstQueueFamilyIndex, report_data->FormatHandle(inserted.first->second->commandBuffer()).c_str());
+                          barrier.dstQueueFamilyIndex, report_data->FormatHandle(recorded_cb_state->commandBuffer()).c_str());
     }
     return skip;
 }
@@ -1293,6 +1342,7 @@ bool CoreChecks::ValidateQueuedQFOTransfers(const CMD_BUFFER_STATE *cb_state,
                                             QFOTransferCBScoreboards<QFOImageTransferBarrier> *qfo_image_scoreboards,
                                             QFOTransferCBScoreboards<QFOBufferTransferBarrier> *qfo_buffer_scoreboards) const {
     bool skip = false;
+    if (!cb_state->HasQFOTransfers()) return skip;
     skip |=
         ValidateQueuedQFOTransferBarriers<QFOImageTransferBarrier>(cb_state, qfo_image_scoreboards, qfo_release_image_barrier_map);
     skip |= ValidateQueuedQFOTransferBarriers<QFOBufferTransferBarrier>(cb_state, qfo_buffer_scoreboards,
@@ -1332,6 +1382,7 @@ void RecordQueuedQFOTransferBarriers(QFOTransferBarrierSets<TransferBarrier> &cb
 }
 
 void CoreChecks::RecordQueuedQFOTransfers(CMD_BUFFER_STATE *cb_state) {
+    if (!cb_state->HasQFOTransfers()) return;
     RecordQueuedQFOTransferBarriers<QFOImageTransferBarrier>(cb_state->qfo_transfer_image_barriers, qfo_release_image_barrier_map);
     RecordQueuedQFOTransferBarriers<QFOBufferTransferBarrier>(cb_state->qfo_transfer_buffer_barriers,
                                                               qfo_release_buffer_barrier_map);
@@ -1348,14 +1399,35 @@ void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uint32_t bar
     // choose to perform it as part of the acquire operation.
     //
     // However, we still need to record initial layout for the "initial layout" validation
+    BarrierImageStates image_states;
+    GetBarrierImageStates(barrier_count, barriers, image_states);
+
+    // Render graphs transition an image per mip level or array layer, the ranges of consecutive barriers of an image doing the
+    // same transition are merged and recorded at once
+    ImageLayoutTransition pending;
     for (uint32_t i = 0; i < barrier_count; i++) {
         const auto &mem_barrier = barriers[i];
-        const bool is_release_op = cb_state->IsReleaseOp(mem_barrier);
-        auto image_state = Get<IMAGE_STATE>(mem_barrier.image);
-        if (image_state) {
-            RecordTransitionImageLayout(cb_state, image_state.get(), mem_barrier, is_release_op);
+        const IMAGE_STATE *image_state = image_states[i];
+        if (!image_state) continue;
+        if (enabled_features.core13.synchronization2 && (mem_barrier.oldLayout == mem_barrier.newLayout)) continue;
+
+        ImageLayoutTransition transition;
+        transition.image_state = image_state;
+        transition.range = image_state->NormalizeSubresourceRange(mem_barrier.subresourceRange);
+        transition.initial_layout = NormalizeSynchronization2Layout(mem_barrier.subresourceRange.aspectMask, mem_barrier.oldLayout);
+        transition.new_layout = NormalizeSynchronization2Layout(mem_barrier.subresourceRange.aspectMask, mem_barrier.newLayout);
+        // Layout transitions in external instance are not tracked, so don't validate initial layout.
+        if (QueueFamilyIsExternal(mem_barrier.srcQueueFamilyIndex)) {
+            transition.initial_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        transition.is_release_op = cb_state->IsReleaseOp(mem_barrier);
+
+        if (!pending.image_state || !pending.Merge(transition)) {
+            if (pending.image_state) RecordTransitionImageLayout(cb_state, pending);
+            pending = transition;
         }
     }
+    if (pending.image_state) RecordTransitionImageLayout(cb_state, pending);
 }
 // explictly instantiate this template so it can be used in core_validation.cpp
 template void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uint32_t barrier_count,
@@ -1363,30 +1435,29 @@ template void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uin
 template void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uint32_t barrier_count,
                                                  const VkImageMemoryBarrier2KHR *barrier);
 
-VkImageLayout NormalizeSynchronization2Layout(const VkImageAspectFlags aspect_mask, VkImageLayout layout);
-
-template <typename ImgBarrier>
-void CoreChecks::RecordTransitionImageLayout(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE *image_state,
-                                             const ImgBarrier &mem_barrier, bool is_release_op) {
-    if (enabled_features.core13.synchronization2) {
-        if (mem_barrier.oldLayout == mem_barrier.newLayout) {
-            return;
-        }
+bool CoreChecks::ImageLayoutTransition::Merge(const ImageLayoutTransition &next) {
+    if ((next.image_state != image_state) || (next.initial_layout != initial_layout) || (next.new_layout != new_layout) ||
+        (next.is_release_op != is_release_op) || (next.range.aspectMask != range.aspectMask)) {
+        return false;
     }
-    auto normalized_isr = image_state->NormalizeSubresourceRange(mem_barrier.subresourceRange);
-
-    VkImageLayout initial_layout = NormalizeSynchronization2Layout(mem_barrier.subresourceRange.aspectMask, mem_barrier.oldLayout);
-    VkImageLayout new_layout = NormalizeSynchronization2Layout(mem_barrier.subresourceRange.aspectMask, mem_barrier.newLayout);
-
-    // Layout transitions in external instance are not tracked, so don't validate initial layout.
-    if (QueueFamilyIsExternal(mem_barrier.srcQueueFamilyIndex)) {
-        initial_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    if ((next.range.baseMipLevel == range.baseMipLevel) && (next.range.levelCount == range.levelCount) &&
+        (next.range.baseArrayLayer == range.baseArrayLayer + range.layerCount)) {
+        range.layerCount += next.range.layerCount;
+        return true;
+    }
+    if ((next.range.baseArrayLayer == range.baseArrayLayer) && (next.range.layerCount == range.layerCount) &&
+        (next.range.baseMipLevel == range.baseMipLevel + range.levelCount)) {
+        range.levelCount += next.range.levelCount;
+        return true;
     }
+    return false;
+}
 
-    if (is_release_op) {
-        cb_state->SetImageInitialLayout(*image_state, normalized_isr, initial_layout);
+void CoreChecks::RecordTransitionImageLayout(CMD_BUFFER_STATE *cb_state, const ImageLayoutTransition &transition) {
+    if (transition.is_release_op) {
+        cb_state->SetImageInitialLayout(*transition.image_state, transition.range, transition.initial_layout);
     } else {
-        cb_state->SetImageLayout(*image_state, normalized_isr, new_layout, initial_layout);
+        cb_state->SetImageLayout(*transition.image_state, transition.range, transition.new_layout, transition.initial_layout);
     }
 }
 
@@ -1403,20 +1474,21 @@ bool CoreChecks::VerifyImageLayout(const CMD_BUFFER_STATE *cb_node, const IMAGE_
     if (subresource_map) {
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map, aspect_mask);
-        // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
-        // the next "constant value" range
-        for (auto pos = subresource_map->Find(range); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-            if (!layout_check.Check(pos->subresource, explicit_layout, pos->current_layout, pos->initial_layout)) {
+        // Each visit covers all the subresources of a "constant value" range
+        subresource_map->AnyInRange(range, [&](SubresourceIndex index, const LayoutEntry &entry) {
+            if (!layout_check.Check(index, explicit_layout, entry)) {
                 *error = true;
+                const auto subresource = subresource_map->Decode(index);
                 subres_skip |=
                     LogError(cb_node->commandBuffer(), layout_mismatch_msg_code,
                              "%s: Cannot use %s (layer=%u mip=%u) with specific layout %s that doesn't match the "
                              "%s layout %s.",
-                             caller, report_data->FormatHandle(image_state->Handle()).c_str(), pos->subresource.arrayLayer,
-                             pos->subresource.mipLevel, string_VkImageLayout(explicit_layout), layout_check.message,
+                             caller, report_data->FormatHandle(image_state->Handle()).c_str(), subresource.arrayLayer,
+                             subresource.mipLevel, string_VkImageLayout(explicit_layout), layout_check.message,
                              string_VkImageLayout(layout_check.layout));
             }
-        }
+            return subres_skip;
+        });
         skip |= subres_skip;
     }
 
@@ -1670,18 +1742,10 @@ bool CoreChecks::ValidateImageFormatFeatures(const VkImageCreateInfo *pCreateInf
             }
         }
 
-        auto fmt_drm_props = LvlInitStruct<VkDrmFormatModifierPropertiesListEXT>();
-        auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_drm_props);
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, image_format, &fmt_props_2);
-        std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-        drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-        fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, image_format, &fmt_props_2);
-
-        for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-            if (drm_format_modifiers.find(fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier) !=
-                drm_format_modifiers.end()) {
-                tiling_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
+        const auto format_properties = GetFormatPropertiesCache().GetFormatProperties(image_format, has_format_feature2, true);
+        for (const auto &drm_modifier : format_properties->drm_modifiers) {
+            if (drm_format_modifiers.find(drm_modifier.drmFormatModifier) != drm_format_modifiers.end()) {
+                tiling_features |= drm_modifier.drmFormatModifierTilingFeatures;
             }
         }
     } else {
@@ -1779,9 +1843,9 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
     VkImageFormatProperties format_limits = {};
     VkResult result = VK_SUCCESS;
     if (pCreateInfo->tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device, pCreateInfo->format, pCreateInfo->imageType,
-                                                                pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
-                                                                &format_limits);
+        result = GetFormatPropertiesCache().GetImageFormatProperties(pCreateInfo->format, pCreateInfo->imageType,
+                                                                     pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
+                                                                     &format_limits);
     } else {
         auto modifier_list = LvlFindInChain<VkImageDrmFormatModifierListCreateInfoEXT>(pCreateInfo->pNext);
         auto explicit_modifier = LvlFindInChain<VkImageDrmFormatModifierExplicitCreateInfoEXT>(pCreateInfo->pNext);
@@ -1797,8 +1861,7 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
                 image_format_info.flags = pCreateInfo->flags;
                 auto image_format_properties = LvlInitStruct<VkImageFormatProperties2>();
 
-                result =
-                    DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+                result = GetFormatPropertiesCache().GetImageFormatProperties2(&image_format_info, &image_format_properties);
                 format_limits = image_format_properties.imageFormatProperties;
 
                 /* The application gives a list of modifier and the driver
@@ -1817,7 +1880,7 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
             image_format_info.flags = pCreateInfo->flags;
             auto image_format_properties = LvlInitStruct<VkImageFormatProperties2>();
 
-            result = DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+            result = GetFormatPropertiesCache().GetImageFormatProperties2(&image_format_info, &image_format_properties);
             format_limits = image_format_properties.imageFormatProperties;
         }
     }
@@ -2166,10 +2229,9 @@ bool CoreChecks::VerifyClearImageLayout(const CMD_BUFFER_STATE *cb_node, const I
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map);
         auto normalized_isr = image_state->NormalizeSubresourceRange(range);
-        // IncrementInterval skips over all the subresources that have the same state as we just checked, incrementing to
-        // the next "constant value" range
-        for (auto pos = subresource_map->Find(normalized_isr); !(pos.AtEnd()) && !subres_skip; pos.IncrementInterval()) {
-            if (!layout_check.Check(pos->subresource, dest_image_layout, pos->current_layout, pos->initial_layout)) {
+        // Each visit covers all the subresources of a "constant value" range
+        subresource_map->AnyInRange(normalized_isr, [&](SubresourceIndex index, const LayoutEntry &entry) {
+            if (!layout_check.Check(index, dest_image_layout, entry)) {
                 const char *error_code = "VUID-vkCmdClearColorImage-imageLayout-00004";
                 if (strcmp(func_name, "vkCmdClearDepthStencilImage()") == 0) {
                     error_code = "VUID-vkCmdClearDepthStencilImage-imageLayout-00011";
@@ -2181,7 +2243,8 @@ bool CoreChecks::VerifyClearImageLayout(const CMD_BUFFER_STATE *cb_node, const I
                                         func_name, string_VkImageLayout(dest_image_layout), layout_check.message,
                                         string_VkImageLayout(layout_check.layout));
             }
-        }
+            return subres_skip;
+        });
         skip |= subres_skip;
     }
 
@@ -2379,6 +2442,16 @@ static bool RangesIntersect(int32_t start, uint32_t start_offset, int32_t end, u
     return result;
 }
 
+// The range [x, xoffset] that RangesIntersect compares, empty where RangesIntersect can never find an intersection. The ranges of
+// each mip level are kept apart, as regions of different mip levels never intersect.
+static sparse_container::range<uint64_t> IntersectionRange(uint32_t mip_level, int32_t start, uint32_t start_offset) {
+    const uint32_t begin = static_cast<uint32_t>(start);
+    const uint32_t end = begin + start_offset;
+    const uint64_t mip_base = static_cast<uint64_t>(mip_level) << 32;
+    return (end > begin) ? sparse_container::range<uint64_t>(mip_base + begin, mip_base + end)
+                         : sparse_container::range<uint64_t>();
+}
+
 // Returns true if source area of first vkImageCopy/vkImageCopy2KHR region intersects dest area of second region
 // It is assumed that these are copy regions within a single image (otherwise no possibility of collision)
 template <typename RegionType>
@@ -2625,10 +2698,10 @@ bool CoreChecks::ValidateImageArrayLayerRange(const CMD_BUFFER_STATE *cb_node, c
 // Check valid usage Image Transfer Granularity requirements for elements of a VkBufferImageCopy/VkBufferImageCopy2 structure
 template <typename RegionType>
 bool CoreChecks::ValidateCopyBufferImageTransferGranularityRequirements(const CMD_BUFFER_STATE *cb_node, const IMAGE_STATE *img,
-                                                                        const RegionType *region, const uint32_t i,
-                                                                        const char *function, const char *vuid) const {
+                                                                        const VkExtent3D &granularity, const RegionType *region,
+                                                                        const uint32_t i, const char *function,
+                                                                        const char *vuid) const {
     bool skip = false;
-    VkExtent3D granularity = GetScaledItg(cb_node, img);
     skip |= CheckItgOffset(cb_node, &region->imageOffset, &granularity, i, function, "imageOffset", vuid);
     VkExtent3D subresource_extent = img->GetSubresourceExtent(region->imageSubresource);
     skip |= CheckItgExtent(cb_node, &region->imageExtent, &region->imageOffset, &granularity, &subresource_extent,
@@ -2639,7 +2712,8 @@ bool CoreChecks::ValidateCopyBufferImageTransferGranularityRequirements(const CM
 // Check valid usage Image Transfer Granularity requirements for elements of a VkImageCopy/VkImageCopy2KHR structure
 template <typename RegionType>
 bool CoreChecks::ValidateCopyImageTransferGranularityRequirements(const CMD_BUFFER_STATE *cb_node, const IMAGE_STATE *src_img,
-                                                                  const IMAGE_STATE *dst_img, const RegionType *region,
+                                                                  const IMAGE_STATE *dst_img, const VkExtent3D &src_granularity,
+                                                                  const VkExtent3D &dst_granularity, const RegionType *region,
                                                                   const uint32_t i, const char *function,
                                                                   CMD_TYPE cmd_type) const {
     bool skip = false;
@@ -2647,25 +2721,23 @@ bool CoreChecks::ValidateCopyImageTransferGranularityRequirements(const CMD_BUFF
     const char *vuid;
 
     // Source image checks
-    VkExtent3D granularity = GetScaledItg(cb_node, src_img);
     vuid = is_2 ? "VUID-VkCopyImageInfo2-srcOffset-01783" : "VUID-vkCmdCopyImage-srcOffset-01783";
-    skip |= CheckItgOffset(cb_node, &region->srcOffset, &granularity, i, function, "srcOffset", vuid);
+    skip |= CheckItgOffset(cb_node, &region->srcOffset, &src_granularity, i, function, "srcOffset", vuid);
     VkExtent3D subresource_extent = src_img->GetSubresourceExtent(region->srcSubresource);
     const VkExtent3D extent = region->extent;
     vuid = is_2 ? "VUID-VkCopyImageInfo2-srcOffset-01783" : "VUID-vkCmdCopyImage-srcOffset-01783";
-    skip |= CheckItgExtent(cb_node, &extent, &region->srcOffset, &granularity, &subresource_extent, src_img->createInfo.imageType,
-                           i, function, "extent", vuid);
+    skip |= CheckItgExtent(cb_node, &extent, &region->srcOffset, &src_granularity, &subresource_extent,
+                           src_img->createInfo.imageType, i, function, "extent", vuid);
 
     // Destination image checks
-    granularity = GetScaledItg(cb_node, dst_img);
     vuid = is_2 ? "VUID-VkCopyImageInfo2-dstOffset-01784" : "VUID-vkCmdCopyImage-dstOffset-01784";
-    skip |= CheckItgOffset(cb_node, &region->dstOffset, &granularity, i, function, "dstOffset", vuid);
+    skip |= CheckItgOffset(cb_node, &region->dstOffset, &dst_granularity, i, function, "dstOffset", vuid);
     // Adjust dest extent, if necessary
     const VkExtent3D dest_effective_extent =
         GetAdjustedDestImageExtent(src_img->createInfo.format, dst_img->createInfo.format, extent);
     subresource_extent = dst_img->GetSubresourceExtent(region->dstSubresource);
     vuid = is_2 ? "VUID-VkCopyImageInfo2-dstOffset-01784" : "VUID-vkCmdCopyImage-dstOffset-01784";
-    skip |= CheckItgExtent(cb_node, &dest_effective_extent, &region->dstOffset, &granularity, &subresource_extent,
+    skip |= CheckItgExtent(cb_node, &dest_effective_extent, &region->dstOffset, &dst_granularity, &subresource_extent,
                            dst_img->createInfo.imageType, i, function, "extent", vuid);
     return skip;
 }
@@ -2679,6 +2751,12 @@ bool CoreChecks::ValidateImageCopyData(const uint32_t regionCount, const RegionT
     const char *func_name = CommandTypeString(cmd_type);
     const char *vuid;
 
+    // The same for every region
+    const bool src_is_blocked = FormatIsBlockedImage(src_state->createInfo.format);
+    const bool dst_is_blocked = FormatIsBlockedImage(dst_state->createInfo.format);
+    const VkExtent3D src_block_size = FormatTexelBlockExtent(src_state->createInfo.format);
+    const VkExtent3D dst_block_size = FormatTexelBlockExtent(dst_state->createInfo.format);
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const RegionType region = pRegions[i];
 
@@ -2726,8 +2804,8 @@ bool CoreChecks::ValidateImageCopyData(const uint32_t regionCount, const RegionT
         }
 
         // Source checks that apply only to "blocked images"
-        if (FormatIsBlockedImage(src_state->createInfo.format)) {
-            const VkExtent3D block_size = FormatTexelBlockExtent(src_state->createInfo.format);
+        if (src_is_blocked) {
+            const VkExtent3D &block_size = src_block_size;
             //  image offsets must be multiples of block dimensions
             if ((SafeModulo(region.srcOffset.x, block_size.width) != 0) ||
                 (SafeModulo(region.srcOffset.y, block_size.height) != 0) ||
@@ -2837,8 +2915,8 @@ bool CoreChecks::ValidateImageCopyData(const uint32_t regionCount, const RegionT
         }
 
         // Dest checks that apply only to "blocked images"
-        if (FormatIsBlockedImage(dst_state->createInfo.format)) {
-            const VkExtent3D block_size = FormatTexelBlockExtent(dst_state->createInfo.format);
+        if (dst_is_blocked) {
+            const VkExtent3D &block_size = dst_block_size;
 
             //  image offsets must be multiples of block dimensions
             if ((SafeModulo(region.dstOffset.x, block_size.width) != 0) ||
@@ -3137,18 +3215,6 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
                              func_name, i, region.dstOffset.z, dst_copy_extent.depth, subresource_extent.depth);
         }
 
-        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-        // must not overlap in memory
-        if (src_image_state->image() == dst_image_state->image()) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersects(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                     FormatIsMultiplane(src_format))) {
-                    vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
-                    skip |= LogError(command_buffer, vuid, "%s: pRegion[%u] src overlaps with pRegions[%u].", func_name, i, j);
-                }
-            }
-        }
-
         // Check depth for 2D as post Maintaince 1 requires both while prior only required one to be 2D
         if (IsExtEnabled(device_extensions.vk_khr_maintenance1)) {
             if (((VK_IMAGE_TYPE_2D == src_image_state->createInfo.imageType) &&
@@ -3213,6 +3279,27 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         }
     }
 
+    // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+    // must not overlap in memory
+    if (src_image_state->image() == dst_image_state->image()) {
+        const bool is_multiplane = FormatIsMultiplane(src_format);
+        std::vector<sparse_container::range<uint64_t>> src_ranges(regionCount);
+        std::vector<sparse_container::range<uint64_t>> dst_ranges(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            src_ranges[i] =
+                IntersectionRange(pRegions[i].srcSubresource.mipLevel, pRegions[i].srcOffset.x, pRegions[i].extent.width);
+            dst_ranges[i] =
+                IntersectionRange(pRegions[i].dstSubresource.mipLevel, pRegions[i].dstOffset.x, pRegions[i].extent.width);
+        }
+        // Only regions of the same mip level whose x ranges overlap can intersect
+        sparse_container::for_each_intersecting_range(src_ranges, dst_ranges, [&](uint32_t i, uint32_t j) {
+            if (RegionIntersects(&pRegions[i], &pRegions[j], src_image_state->createInfo.imageType, is_multiplane)) {
+                vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
+                skip |= LogError(command_buffer, vuid, "%s: pRegion[%u] src overlaps with pRegions[%u].", func_name, i, j);
+            }
+        });
+    }
+
     // The formats of non-multiplane src_image and dst_image must be compatible. Formats are considered compatible if their texel
     // size in bytes is the same between both formats. For example, VK_FORMAT_R8G8B8A8_UNORM is compatible with VK_FORMAT_R32_UINT
     // because because both texels are 4 bytes in size.
@@ -3305,6 +3392,8 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
             : (is_2 ? "VUID-VkCopyImageInfo2-dstImageLayout-00134" : "VUID-vkCmdCopyImage-dstImageLayout-00134");
 
     bool same_image = (src_image_state == dst_image_state);
+    const VkExtent3D src_granularity = GetScaledItg(cb_node.get(), src_image_state.get());
+    const VkExtent3D dst_granularity = GetScaledItg(cb_node.get(), dst_image_state.get());
     for (uint32_t i = 0; i < regionCount; ++i) {
         // When performing copy from and to same subresource, VK_IMAGE_LAYOUT_GENERAL is the only option
         const RegionType region = pRegions[i];
@@ -3321,7 +3410,8 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         skip |= VerifyImageLayout(cb_node.get(), dst_image_state.get(), region.dstSubresource, dstImageLayout, destination_optimal,
                                   func_name, invalid_dst_layout_vuid, vuid, &hit_error);
         skip |= ValidateCopyImageTransferGranularityRequirements(cb_node.get(), src_image_state.get(), dst_image_state.get(),
-                                                                 &region, i, func_name, cmd_type);
+                                                                 src_granularity, dst_granularity, &region, i, func_name,
+                                                                 cmd_type);
     }
 
     return skip;
@@ -4303,20 +4393,31 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
                                      func_name, i);
                 }
             }
+        }  // per-region checks
 
-            // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
-            // must not overlap in memory
-            if (srcImage == dstImage) {
-                for (uint32_t j = 0; j < regionCount; j++) {
-                    if (RegionIntersectsBlit(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                             FormatIsMultiplane(src_format))) {
-                        vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
-                        skip |= LogError(cb_node->commandBuffer(), vuid,
-                                         "%s: pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", func_name, i, j);
-                    }
+        // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
+        // must not overlap in memory
+        if (srcImage == dstImage) {
+            const bool is_multiplane = FormatIsMultiplane(src_format);
+            std::vector<sparse_container::range<uint64_t>> src_ranges(regionCount);
+            std::vector<sparse_container::range<uint64_t>> dst_ranges(regionCount);
+            for (uint32_t i = 0; i < regionCount; i++) {
+                const auto &src_offsets = pRegions[i].srcOffsets;
+                const auto &dst_offsets = pRegions[i].dstOffsets;
+                src_ranges[i] = IntersectionRange(pRegions[i].srcSubresource.mipLevel, src_offsets[0].x,
+                                                  src_offsets[1].x - src_offsets[0].x);
+                dst_ranges[i] = IntersectionRange(pRegions[i].dstSubresource.mipLevel, dst_offsets[0].x,
+                                                  dst_offsets[1].x - dst_offsets[0].x);
+            }
+            // Only regions of the same mip level whose x ranges overlap can intersect
+            sparse_container::for_each_intersecting_range(src_ranges, dst_ranges, [&](uint32_t i, uint32_t j) {
+                if (RegionIntersectsBlit(&pRegions[i], &pRegions[j], src_image_state->createInfo.imageType, is_multiplane)) {
+                    vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
+                    skip |= LogError(cb_node->commandBuffer(), vuid,
+                                     "%s: pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", func_name, i, j);
                 }
-            }
-        }  // per-region checks
+            });
+        }
     } else {
         assert(0);
     }
@@ -4399,8 +4500,9 @@ const GlobalImageLayoutRangeMap *GetLayoutRangeMap(const GlobalImageLayoutMap &m
 // Helper to update the Global or Overlay layout map
 struct GlobalLayoutUpdater {
     bool update(VkImageLayout &dst, const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
-        if (src.current_layout != image_layout_map::kInvalidLayout && dst != src.current_layout) {
-            dst = src.current_layout;
+        const VkImageLayout current_layout = src.CurrentLayout();
+        if (current_layout != image_layout_map::kInvalidLayout && dst != current_layout) {
+            dst = current_layout;
             return true;
         }
         return false;
@@ -4408,34 +4510,61 @@ struct GlobalLayoutUpdater {
 
     layer_data::optional<VkImageLayout> insert(const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
         layer_data::optional<VkImageLayout> result;
-        if (src.current_layout != image_layout_map::kInvalidLayout) {
-            result.emplace(src.current_layout);
+        const VkImageLayout current_layout = src.CurrentLayout();
+        if (current_layout != image_layout_map::kInvalidLayout) {
+            result.emplace(current_layout);
         }
         return result;
     }
 };
 
+// Checks an image the command buffer uses as a whole without walking its ranges, when the image is also known to be in a single
+// layout (or in none). Returns false if either side is split into ranges, leaving the check to the per range walk.
+static bool UniformImageLayoutMatches(const IMAGE_STATE &image_state, const ImageLayoutSummaryEntry &summary_entry,
+                                      const GlobalImageLayoutRangeMap &overlay_map, const GlobalImageLayoutRangeMap &global_map,
+                                      bool &matches) {
+    const auto *entry = summary_entry.uniform_layout;
+    if (!entry) return false;
+    const VkImageLayout *image_layout = nullptr;
+    if (!overlay_map.empty()) {
+        image_layout = overlay_map.GetUniformLayout();
+        if (!image_layout) return false;
+    } else if (!global_map.empty()) {
+        image_layout = global_map.GetUniformLayout();
+        if (!image_layout) return false;
+    }
+    const VkImageLayout initial_layout = entry->InitialLayout();
+    matches = !image_layout || initial_layout == VK_IMAGE_LAYOUT_UNDEFINED || *image_layout == initial_layout ||
+              ImageLayoutMatches(image_state.subresource_encoder.Decode(0).aspectMask, *image_layout, initial_layout);
+    return true;
+}
+
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFER_STATE *pCB,
-                                            GlobalImageLayoutMap &overlayLayoutMap) const {
-    if (disabled[image_layout_validation]) return false;
+                                            GlobalImageLayoutMap &overlayLayoutMap, const SubmitImageFilter *filter) const {
+    // Record-time layout tracking stays on when only the submit-time check is disabled
+    if (disabled[image_layout_validation] || disabled[submit_image_layout_validation]) return false;
+    CheckTimer check_timer("ValidateCmdBufImageLayouts");
     bool skip = false;
+    // No later command buffer of the submission looks at the overlay of an image it doesn't share
+    const bool update_overlay = !filter || filter->shared;
     // Iterate over the layout maps for each referenced image
-    GlobalImageLayoutRangeMap empty_map(1);
-    for (const auto &layout_map_entry : pCB->image_layout_map) {
-        const auto *image_state = layout_map_entry.first;
-        const auto &subres_map = layout_map_entry.second;
+    std::vector<ImageLayoutSummaryEntry> summary_scratch;
+    for (const auto &summary_entry : pCB->GetImageLayoutSummary(summary_scratch)) {
+        const auto *image_state = summary_entry.image;
+        if (filter && !filter->Includes(image_state)) continue;
+        const auto &subres_map = summary_entry.layout_map;
         const auto &layout_map = subres_map->GetLayoutMap();
-        // Validate the initial_uses for each subresource referenced
-        if (layout_map.empty()) continue;
 
         auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
-        const auto *global_map = image_state->layout_range_map.get();
+        const auto global_map = image_state->layout_range_map->Snapshot();
         assert(global_map);
-        auto global_map_guard = global_map->ReadLock();
 
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
+        bool matches = false;
+        if (UniformImageLayoutMatches(*image_state, summary_entry, *overlay_map, *global_map, matches) && matches) {
+            if (update_overlay) sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            continue;
+        }
 
         auto pos = layout_map.begin();
         const auto end = layout_map.end();
@@ -4486,18 +4615,22 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
             }
         }
         // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+        if (update_overlay) sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
     }
 
     return skip;
 }
 
 void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
-    for (const auto &layout_map_entry : pCB->image_layout_map) {
-        const auto *image_state = layout_map_entry.first;
-        const auto &subres_map = layout_map_entry.second;
-        auto guard = image_state->layout_range_map->WriteLock();
-        sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+    std::vector<ImageLayoutSummaryEntry> summary_scratch;
+    for (const auto &summary_entry : pCB->GetImageLayoutSummary(summary_scratch)) {
+        const auto *image_state = summary_entry.image;
+        const auto &subres_map = summary_entry.layout_map;
+        const auto &layout_map = subres_map->GetLayoutMap();
+        image_state->layout_range_map->Update([&layout_map](GlobalImageLayoutRangeMap &global_map) {
+            sparse_container::splice(global_map, layout_map, GlobalLayoutUpdater());
+            global_map.ConsolidateIfGrown();
+        });
     }
 }
 
@@ -5371,7 +5504,7 @@ bool CoreChecks::ValidateBufferBarrier(const LogObjectList &objects, const Locat
 
 template <typename Barrier>
 bool CoreChecks::ValidateImageBarrier(const LogObjectList &objects, const Location &loc, const CMD_BUFFER_STATE *cb_state,
-                                      const Barrier &mem_barrier) const {
+                                      const Barrier &mem_barrier, const IMAGE_STATE *image_data) const {
     bool skip = false;
 
     skip |= ValidateQFOTransferBarrierUniqueness(loc, cb_state, mem_barrier, cb_state->qfo_transfer_image_barriers);
@@ -5391,19 +5524,18 @@ bool CoreChecks::ValidateImageBarrier(const LogObjectList &objects, const Locati
         }
     }
 
-    auto image_data = Get<IMAGE_STATE>(mem_barrier.image);
     if (image_data) {
         auto image_loc = loc.dot(Field::image);
 
-        skip |= ValidateMemoryIsBoundToImage(image_data.get(), loc);
+        skip |= ValidateMemoryIsBoundToImage(image_data, loc);
 
-        skip |= ValidateBarrierQueueFamilies(image_loc, cb_state, mem_barrier, image_data.get());
+        skip |= ValidateBarrierQueueFamilies(image_loc, cb_state, mem_barrier, image_data);
 
         skip |= ValidateImageAspectMask(image_data->image(), image_data->createInfo.format, mem_barrier.subresourceRange.aspectMask,
                                         loc.StringFunc().c_str());
 
         skip |=
-            ValidateImageBarrierSubresourceRange(loc.dot(Field::subresourceRange), image_data.get(), mem_barrier.subresourceRange);
+            ValidateImageBarrierSubresourceRange(loc.dot(Field::subresourceRange), image_data, mem_barrier.subresourceRange);
         skip |= ValidateImageAcquired(*image_data, loc.StringFunc().c_str());
     }
     return skip;
@@ -5414,6 +5546,7 @@ bool CoreChecks::ValidateBarriers(const Location &outer_loc, const CMD_BUFFER_ST
                                   const VkMemoryBarrier *pMemBarriers, uint32_t bufferBarrierCount,
                                   const VkBufferMemoryBarrier *pBufferMemBarriers, uint32_t imageMemBarrierCount,
                                   const VkImageMemoryBarrier *pImageMemBarriers) const {
+    CheckTimer check_timer("ValidateBarriers");
     bool skip = false;
     LogObjectList objects(cb_state->commandBuffer());
 
@@ -5422,15 +5555,17 @@ bool CoreChecks::ValidateBarriers(const Location &outer_loc, const CMD_BUFFER_ST
         auto loc = outer_loc.dot(Struct::VkMemoryBarrier, Field::pMemoryBarriers, i);
         skip |= ValidateMemoryBarrier(objects, loc, cb_state, mem_barrier, src_stage_mask, dst_stage_mask);
     }
+    BarrierImageStates image_states;
+    GetBarrierImageStates(imageMemBarrierCount, pImageMemBarriers, image_states);
     for (uint32_t i = 0; i < imageMemBarrierCount; ++i) {
         const auto &mem_barrier = pImageMemBarriers[i];
         auto loc = outer_loc.dot(Struct::VkImageMemoryBarrier, Field::pImageMemoryBarriers, i);
         skip |= ValidateMemoryBarrier(objects, loc, cb_state, mem_barrier, src_stage_mask, dst_stage_mask);
-        skip |= ValidateImageBarrier(objects, loc, cb_state, mem_barrier);
+        skip |= ValidateImageBarrier(objects, loc, cb_state, mem_barrier, image_states[i]);
     }
     {
         Location loc(outer_loc.function, Struct::VkImageMemoryBarrier);
-        skip |= ValidateBarriersToImages(loc, cb_state, imageMemBarrierCount, pImageMemBarriers);
+        skip |= ValidateBarriersToImages(loc, cb_state, imageMemBarrierCount, pImageMemBarriers, image_states);
     }
     for (uint32_t i = 0; i < bufferBarrierCount; ++i) {
         const auto &mem_barrier = pBufferMemBarriers[i];
@@ -5454,15 +5589,18 @@ bool CoreChecks::ValidateDependencyInfo(const LogObjectList &objects, const Loca
         auto loc = outer_loc.dot(Struct::VkMemoryBarrier2, Field::pMemoryBarriers, i);
         skip |= ValidateMemoryBarrier(objects, loc, cb_state, mem_barrier);
     }
+    BarrierImageStates image_states;
+    GetBarrierImageStates(dep_info->imageMemoryBarrierCount, dep_info->pImageMemoryBarriers, image_states);
     for (uint32_t i = 0; i < dep_info->imageMemoryBarrierCount; ++i) {
         const auto &mem_barrier = dep_info->pImageMemoryBarriers[i];
         auto loc = outer_loc.dot(Struct::VkImageMemoryBarrier2, Field::pImageMemoryBarriers, i);
         skip |= ValidateMemoryBarrier(objects, loc, cb_state, mem_barrier);
-        skip |= ValidateImageBarrier(objects, loc, cb_state, mem_barrier);
+        skip |= ValidateImageBarrier(objects, loc, cb_state, mem_barrier, image_states[i]);
     }
     {
         Location loc(outer_loc.function, Struct::VkImageMemoryBarrier2);
-        skip |= ValidateBarriersToImages(loc, cb_state, dep_info->imageMemoryBarrierCount, dep_info->pImageMemoryBarriers);
+        skip |= ValidateBarriersToImages(loc, cb_state, dep_info->imageMemoryBarrierCount, dep_info->pImageMemoryBarriers,
+                                         image_states);
     }
 
     for (uint32_t i = 0; i < dep_info->bufferMemoryBarrierCount; ++i) {
@@ -5594,22 +5732,9 @@ bool CoreChecks::ValidateImageViewFormatFeatures(const IMAGE_STATE *image_state,
                                                                        nullptr};
         DispatchGetImageDrmFormatModifierPropertiesEXT(device, image_state->image(), &drm_format_properties);
 
-        auto fmt_drm_props = LvlInitStruct<VkDrmFormatModifierPropertiesListEXT>();
-        auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_drm_props);
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, view_format, &fmt_props_2);
-
-        std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-        drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-        fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, view_format, &fmt_props_2);
-
-        for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-            if (fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_properties.drmFormatModifier) {
-                tiling_features = fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                break;
-            }
-        }
+        tiling_features = GetFormatPropertiesCache()
+                              .GetFormatProperties(view_format, has_format_feature2, true)
+                              ->DrmModifierFeatures(drm_format_properties.drmFormatModifier);
     } else {
         VkFormatProperties3KHR format_properties = GetPDFormatProperties(view_format);
         tiling_features = (image_tiling == VK_IMAGE_TILING_LINEAR) ? format_properties.linearTilingFeatures
@@ -6132,7 +6257,17 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
     VkDeviceSize src_buffer_size = src_buffer_state->createInfo.size;
     VkDeviceSize dst_buffer_size = dst_buffer_state->createInfo.size;
 
+    // Bounds of all regions at once, without branches in the loop, so that the checks of each region below only run when one of
+    // them fails
+    bool out_of_bounds = false;
     for (uint32_t i = 0; i < regionCount; i++) {
+        const RegionType &region = pRegions[i];
+        out_of_bounds |= (region.srcOffset >= src_buffer_size) | (region.dstOffset >= dst_buffer_size) |
+                         (region.size > (src_buffer_size - region.srcOffset)) |
+                         (region.size > (dst_buffer_size - region.dstOffset));
+    }
+
+    for (uint32_t i = 0; out_of_bounds && (i < regionCount); i++) {
         const RegionType region = pRegions[i];
 
         // The srcOffset member of each element of pRegions must be less than the size of srcBuffer
@@ -6170,64 +6305,77 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
                              ") minus pRegions[%d].dstOffset (%" PRIuLEAST64 ").",
                              func_name, i, region.size, dst_buffer_size, i, region.dstOffset);
         }
+    }
 
-        // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (src_buffer_state->buffer() == dst_buffer_state->buffer()) {
-            VkDeviceSize src_min = region.srcOffset;
-            VkDeviceSize src_max = region.srcOffset + region.size;
-            for (uint32_t j = 0; j < regionCount; j++) {
-                VkDeviceSize dst_min = pRegions[j].dstOffset;
-                VkDeviceSize dst_max = pRegions[j].dstOffset + region.size;
-                if (((src_min > dst_min) && (src_min < dst_max)) || ((src_max > dst_min) && (src_max < dst_max)) ||
-                    ((src_min == dst_min && src_max == dst_max))) {
-                    vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
-                    skip |= LogError(src_buffer_state->buffer(), vuid,
-                                     "%s: Detected overlap between source and dest regions in memory.", func_name);
-                }
-            }
+    // The union of the source regions, and the union of the destination regions, must not overlap in memory
+    if (src_buffer_state->buffer() == dst_buffer_state->buffer()) {
+        std::vector<sparse_container::range<uint64_t>> src_ranges(regionCount);
+        std::vector<sparse_container::range<uint64_t>> dst_ranges(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            src_ranges[i] = sparse_container::range<uint64_t>(pRegions[i].srcOffset, pRegions[i].srcOffset + pRegions[i].size);
+            dst_ranges[i] = sparse_container::range<uint64_t>(pRegions[i].dstOffset, pRegions[i].dstOffset + pRegions[i].size);
         }
+        sparse_container::for_each_intersecting_range(src_ranges, dst_ranges, [&](uint32_t i, uint32_t j) {
+            vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
+            skip |= LogError(src_buffer_state->buffer(), vuid,
+                             "%s: Detected overlap between source and dest regions in memory (pRegions[%" PRIu32
+                             "] src and pRegions[%" PRIu32 "] dst).",
+                             func_name, i, j);
+        });
     }
 
-
     return skip;
 }
+// Checks of a buffer copy that only depend on the parameters and the buffers, and so may be deferred to vkEndCommandBuffer
 template <typename RegionType>
-bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
-                                       const RegionType *pRegions, CMD_TYPE cmd_type) const {
-    auto cb_node = GetRead<CMD_BUFFER_STATE>(commandBuffer);
-    auto src_buffer_state = Get<BUFFER_STATE>(srcBuffer);
-    auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
+bool CoreChecks::ValidateCmdCopyBufferResources(const CMD_BUFFER_STATE *cb_node, const BUFFER_STATE *src_buffer_state,
+                                                const BUFFER_STATE *dst_buffer_state, uint32_t regionCount,
+                                                const RegionType *pRegions, CMD_TYPE cmd_type) const {
     const bool is_2 = (cmd_type == CMD_COPYBUFFER2KHR || cmd_type == CMD_COPYBUFFER2);
     const char *func_name = CommandTypeString(cmd_type);
     const char *vuid;
 
     bool skip = false;
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-srcBuffer-00119" : "VUID-vkCmdCopyBuffer-srcBuffer-00119";
-    skip |= ValidateMemoryIsBoundToBuffer(src_buffer_state.get(), func_name, vuid);
+    skip |= ValidateMemoryIsBoundToBuffer(src_buffer_state, func_name, vuid);
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-dstBuffer-00121" : "VUID-vkCmdCopyBuffer-dstBuffer-00121";
-    skip |= ValidateMemoryIsBoundToBuffer(dst_buffer_state.get(), func_name, vuid);
+    skip |= ValidateMemoryIsBoundToBuffer(dst_buffer_state, func_name, vuid);
 
     // Validate that SRC & DST buffers have correct usage flags set
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-srcBuffer-00118" : "VUID-vkCmdCopyBuffer-srcBuffer-00118";
-    skip |= ValidateBufferUsageFlags(src_buffer_state.get(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, true, vuid, func_name,
+    skip |= ValidateBufferUsageFlags(src_buffer_state, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, true, vuid, func_name,
                                      "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-dstBuffer-00120" : "VUID-vkCmdCopyBuffer-dstBuffer-00120";
-    skip |= ValidateBufferUsageFlags(dst_buffer_state.get(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, vuid, func_name,
+    skip |= ValidateBufferUsageFlags(dst_buffer_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, vuid, func_name,
                                      "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
 
-    skip |= ValidateCmd(cb_node.get(), cmd_type);
-    skip |= ValidateCmdCopyBufferBounds(src_buffer_state.get(), dst_buffer_state.get(), regionCount, pRegions, cmd_type);
+    skip |= ValidateCmdCopyBufferBounds(src_buffer_state, dst_buffer_state, regionCount, pRegions, cmd_type);
 
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01822" : "VUID-vkCmdCopyBuffer-commandBuffer-01822";
-    skip |= ValidateProtectedBuffer(cb_node.get(), src_buffer_state.get(), func_name, vuid);
+    skip |= ValidateProtectedBuffer(cb_node, src_buffer_state, func_name, vuid);
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01823" : "VUID-vkCmdCopyBuffer-commandBuffer-01823";
-    skip |= ValidateProtectedBuffer(cb_node.get(), dst_buffer_state.get(), func_name, vuid);
+    skip |= ValidateProtectedBuffer(cb_node, dst_buffer_state, func_name, vuid);
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01824" : "VUID-vkCmdCopyBuffer-commandBuffer-01824";
-    skip |= ValidateUnprotectedBuffer(cb_node.get(), dst_buffer_state.get(), func_name, vuid);
+    skip |= ValidateUnprotectedBuffer(cb_node, dst_buffer_state, func_name, vuid);
 
     return skip;
 }
 
+template <typename RegionType>
+bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                       const RegionType *pRegions, CMD_TYPE cmd_type) const {
+    auto cb_node = GetRead<CMD_BUFFER_STATE>(commandBuffer);
+    bool skip = ValidateCmd(cb_node.get(), cmd_type);
+    // The resource checks are recorded by RecordDeferredCmdCopyBuffer instead
+    if (deferred_command_validation) return skip;
+
+    auto src_buffer_state = Get<BUFFER_STATE>(srcBuffer);
+    auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
+    skip |= ValidateCmdCopyBufferResources(cb_node.get(), src_buffer_state.get(), dst_buffer_state.get(), regionCount, pRegions,
+                                           cmd_type);
+    return skip;
+}
+
 bool CoreChecks::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                               uint32_t regionCount, const VkBufferCopy *pRegions) const {
     return ValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, CMD_COPYBUFFER);
@@ -6244,6 +6392,46 @@ bool CoreChecks::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, co
                                  pCopyBufferInfos->regionCount, pCopyBufferInfos->pRegions, CMD_COPYBUFFER2);
 }
 
+template <typename RegionType>
+void CoreChecks::RecordDeferredCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                             uint32_t regionCount, const RegionType *pRegions, CMD_TYPE cmd_type) {
+    if (!deferred_command_validation) return;
+    auto cb_node = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
+    auto src_buffer_state = Get<BUFFER_STATE>(srcBuffer);
+    auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
+    std::vector<RegionType> regions(pRegions, pRegions + regionCount);
+    if (command_buffer_fingerprinting) {
+        hash_util::HashCombiner hc;
+        for (const auto &region : regions) {
+            hc << region.srcOffset << region.dstOffset << region.size;
+        }
+        FingerprintDeferredCommand(cb_node.get(), cmd_type, hc.Value(), src_buffer_state.get(), dst_buffer_state.get());
+    }
+    cb_node->deferred_validate_functions.emplace_back(
+        [this, src_buffer_state, dst_buffer_state, regions, cmd_type](const CMD_BUFFER_STATE &cb_state) {
+            return ValidateCmdCopyBufferResources(&cb_state, src_buffer_state.get(), dst_buffer_state.get(),
+                                                  static_cast<uint32_t>(regions.size()), regions.data(), cmd_type);
+        });
+}
+
+void CoreChecks::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                            uint32_t regionCount, const VkBufferCopy *pRegions) {
+    StateTracker::PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    RecordDeferredCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, CMD_COPYBUFFER);
+}
+
+void CoreChecks::PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfos) {
+    StateTracker::PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfos);
+    RecordDeferredCmdCopyBuffer(commandBuffer, pCopyBufferInfos->srcBuffer, pCopyBufferInfos->dstBuffer,
+                                pCopyBufferInfos->regionCount, pCopyBufferInfos->pRegions, CMD_COPYBUFFER2KHR);
+}
+
+void CoreChecks::PreCallRecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfos) {
+    StateTracker::PreCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfos);
+    RecordDeferredCmdCopyBuffer(commandBuffer, pCopyBufferInfos->srcBuffer, pCopyBufferInfos->dstBuffer,
+                                pCopyBufferInfos->regionCount, pCopyBufferInfos->pRegions, CMD_COPYBUFFER2);
+}
+
 bool CoreChecks::ValidateIdleBuffer(VkBuffer buffer) const {
     bool skip = false;
     auto buffer_state = Get<BUFFER_STATE>(buffer);
@@ -6271,6 +6459,12 @@ bool CoreChecks::PreCallValidateDestroyBuffer(VkDevice device, VkBuffer buffer,
     return ValidateIdleBuffer(buffer);
 }
 
+void CoreChecks::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
+    // Outstanding jobs may still check this buffer
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordDestroyBuffer(device, buffer, pAllocator);
+}
+
 bool CoreChecks::PreCallValidateDestroyBufferView(VkDevice device, VkBufferView bufferView,
                                                   const VkAllocationCallbacks *pAllocator) const {
     auto buffer_view_state = Get<BUFFER_VIEW_STATE>(bufferView);
@@ -6281,22 +6475,17 @@ bool CoreChecks::PreCallValidateDestroyBufferView(VkDevice device, VkBufferView
     return skip;
 }
 
-bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                              VkDeviceSize size, uint32_t data) const {
-    auto cb_node = GetRead<CMD_BUFFER_STATE>(commandBuffer);
-    auto buffer_state = Get<BUFFER_STATE>(dstBuffer);
+bool CoreChecks::ValidateCmdFillBufferResources(const CMD_BUFFER_STATE *cb_node, const BUFFER_STATE *buffer_state,
+                                                VkDeviceSize dstOffset, VkDeviceSize size) const {
+    const VkBuffer dstBuffer = buffer_state->buffer();
     bool skip = false;
-    skip |= ValidateMemoryIsBoundToBuffer(buffer_state.get(), "vkCmdFillBuffer()", "VUID-vkCmdFillBuffer-dstBuffer-00031");
-    skip |= ValidateCmd(cb_node.get(), CMD_FILLBUFFER);
+    skip |= ValidateMemoryIsBoundToBuffer(buffer_state, "vkCmdFillBuffer()", "VUID-vkCmdFillBuffer-dstBuffer-00031");
     // Validate that DST buffer has correct usage flags set
-    skip |=
-        ValidateBufferUsageFlags(buffer_state.get(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "VUID-vkCmdFillBuffer-dstBuffer-00029",
-                                 "vkCmdFillBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
+    skip |= ValidateBufferUsageFlags(buffer_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "VUID-vkCmdFillBuffer-dstBuffer-00029",
+                                     "vkCmdFillBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
 
-    skip |=
-        ValidateProtectedBuffer(cb_node.get(), buffer_state.get(), "vkCmdFillBuffer()", "VUID-vkCmdFillBuffer-commandBuffer-01811");
-    skip |= ValidateUnprotectedBuffer(cb_node.get(), buffer_state.get(), "vkCmdFillBuffer()",
-                                      "VUID-vkCmdFillBuffer-commandBuffer-01812");
+    skip |= ValidateProtectedBuffer(cb_node, buffer_state, "vkCmdFillBuffer()", "VUID-vkCmdFillBuffer-commandBuffer-01811");
+    skip |= ValidateUnprotectedBuffer(cb_node, buffer_state, "vkCmdFillBuffer()", "VUID-vkCmdFillBuffer-commandBuffer-01812");
 
     if (dstOffset >= buffer_state->createInfo.size) {
         skip |= LogError(dstBuffer, "VUID-vkCmdFillBuffer-dstOffset-00024",
@@ -6311,6 +6500,18 @@ bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkB
                          ") minus dstOffset (0x%" PRIxLEAST64 ").",
                          size, report_data->FormatHandle(dstBuffer).c_str(), buffer_state->createInfo.size, dstOffset);
     }
+    return skip;
+}
+
+bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                              VkDeviceSize size, uint32_t data) const {
+    auto cb_node = GetRead<CMD_BUFFER_STATE>(commandBuffer);
+    bool skip = false;
+    skip |= ValidateCmd(cb_node.get(), CMD_FILLBUFFER);
+    if (!deferred_command_validation) {
+        auto buffer_state = Get<BUFFER_STATE>(dstBuffer);
+        skip |= ValidateCmdFillBufferResources(cb_node.get(), buffer_state.get(), dstOffset, size);
+    }
 
     if (!IsExtEnabled(device_extensions.vk_khr_maintenance1)) {
         skip |= ValidateCmdQueueFlags(cb_node.get(), "vkCmdFillBuffer()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -6320,6 +6521,19 @@ bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkB
     return skip;
 }
 
+void CoreChecks::PreCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                            VkDeviceSize size, uint32_t data) {
+    StateTracker::PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+    if (!deferred_command_validation) return;
+    auto cb_node = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
+    auto buffer_state = Get<BUFFER_STATE>(dstBuffer);
+    FingerprintDeferredCommand(cb_node.get(), CMD_FILLBUFFER, hash_util::HashCombiner().Combine(dstOffset).Combine(size).Value(),
+                               nullptr, buffer_state.get());
+    cb_node->deferred_validate_functions.emplace_back([this, buffer_state, dstOffset, size](const CMD_BUFFER_STATE &cb_state) {
+        return ValidateCmdFillBufferResources(&cb_state, buffer_state.get(), dstOffset, size);
+    });
+}
+
 template <typename RegionType>
 bool CoreChecks::ValidateBufferImageCopyData(const CMD_BUFFER_STATE *cb_node, uint32_t regionCount, const RegionType *pRegions,
                                              const IMAGE_STATE *image_state, const char *function, CMD_TYPE cmd_type,
@@ -6748,6 +6962,7 @@ bool CoreChecks::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkI
             : (vuid = is_2 ? "VUID-VkCopyImageToBufferInfo2-srcImageLayout-00190"
                            : "VUID-vkCmdCopyImageToBuffer-srcImageLayout-00190");
 
+    const VkExtent3D granularity = GetScaledItg(cb_node.get(), src_image_state.get());
     for (uint32_t i = 0; i < regionCount; ++i) {
         const RegionType region = pRegions[i];
         skip |= ValidateImageSubresourceLayers(cb_node.get(), &region.imageSubresource, func_name, "imageSubresource", i);
@@ -6755,8 +6970,8 @@ bool CoreChecks::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkI
         skip |= VerifyImageLayout(cb_node.get(), src_image_state.get(), region.imageSubresource, srcImageLayout,
                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, func_name, src_invalid_layout_vuid, vuid, &hit_error);
         vuid = is_2 ? "VUID-VkCopyImageToBufferInfo2-imageOffset-01794" : "VUID-vkCmdCopyImageToBuffer-imageOffset-01794";
-        skip |= ValidateCopyBufferImageTransferGranularityRequirements(cb_node.get(), src_image_state.get(), &region, i, func_name,
-                                                                       vuid);
+        skip |= ValidateCopyBufferImageTransferGranularityRequirements(cb_node.get(), src_image_state.get(), granularity, &region,
+                                                                       i, func_name, vuid);
         vuid = is_2 ? "VUID-VkCopyImageToBufferInfo2-imageSubresource-01703" : "VUID-vkCmdCopyImageToBuffer-imageSubresource-01703";
         skip |= ValidateImageMipLevel(cb_node.get(), src_image_state.get(), region.imageSubresource.mipLevel, i, func_name,
                                       "imageSubresource", vuid);
@@ -6892,6 +7107,7 @@ bool CoreChecks::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkB
             : (is_2 ? "VUID-VkCopyBufferToImageInfo2-dstImageLayout-00181"
                        : "VUID-vkCmdCopyBufferToImage-dstImageLayout-00181");
 
+    const VkExtent3D granularity = GetScaledItg(cb_node.get(), dst_image_state.get());
     for (uint32_t i = 0; i < regionCount; ++i) {
         const RegionType region = pRegions[i];
         skip |= ValidateImageSubresourceLayers(cb_node.get(), &region.imageSubresource, func_name, "imageSubresource", i);
@@ -6899,8 +7115,8 @@ bool CoreChecks::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkB
         skip |= VerifyImageLayout(cb_node.get(), dst_image_state.get(), region.imageSubresource, dstImageLayout,
                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, func_name, dst_invalid_layout_vuid, vuid, &hit_error);
         vuid = is_2 ? "VUID-VkCopyBufferToImageInfo2-imageOffset-01793" : "VUID-vkCmdCopyBufferToImage-imageOffset-01793";
-        skip |= ValidateCopyBufferImageTransferGranularityRequirements(cb_node.get(), dst_image_state.get(), &region, i, func_name,
-                                                                       vuid);
+        skip |= ValidateCopyBufferImageTransferGranularityRequirements(cb_node.get(), dst_image_state.get(), granularity, &region,
+                                                                       i, func_name, vuid);
         vuid = is_2 ? "VUID-VkCopyBufferToImageInfo2-imageSubresource-01701" : "VUID-vkCmdCopyBufferToImage-imageSubresource-01701";
         skip |= ValidateImageMipLevel(cb_node.get(), dst_image_state.get(), region.imageSubresource.mipLevel, i, func_name,
                                       "imageSubresource", vuid);
@@ -0,0 +1,90 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "call_context.h"
+
+#include <utility>
+
+thread_local ValidationCallContext *ValidationCallContext::current_call_context = nullptr;
+
+const void *ValidationCallContext::FindInChain(const void *next, VkStructureType type) {
+    if (!next) return nullptr;
+    Chain *chain = nullptr;
+    for (uint32_t i = 0; i < chain_count_; ++i) {
+        if (chains_[i].head == next) {
+            chain = &chains_[i];
+            break;
+        }
+    }
+    if (!chain) {
+        if (chain_count_ < kMaxChains) {
+            chain = &chains_[chain_count_++];
+        } else {
+            chain = &chains_[next_chain_++ % kMaxChains];
+        }
+        chain->head = next;
+        chain->count = 0;
+        auto current = static_cast<const VkBaseInStructure *>(next);
+        for (; current && chain->count < kMaxChainStructs; current = current->pNext) {
+            chain->types[chain->count] = current->sType;
+            chain->structs[chain->count] = current;
+            ++chain->count;
+        }
+        chain->truncated = (current != nullptr);
+    }
+
+    for (uint32_t i = 0; i < chain->count; ++i) {
+        if (chain->types[i] == type) return chain->structs[i];
+    }
+    if (chain->truncated) {
+        for (auto current = chain->structs[kMaxChainStructs - 1]->pNext; current; current = current->pNext) {
+            if (current->sType == type) return current;
+        }
+    }
+    return nullptr;
+}
+
+void ValidationCallContext::RememberState(const void *map, uint64_t handle, std::shared_ptr<void> state) {
+    State *entry;
+    if (state_count_ < kMaxStates) {
+        entry = &states_[state_count_++];
+    } else {
+        entry = &states_[next_state_++ % kMaxStates];
+    }
+    entry->map = map;
+    entry->handle = handle;
+    entry->state = std::move(state);
+}
+
+void ValidationCallContext::ForgetState(const void *map, uint64_t handle) {
+    for (uint32_t i = 0; i < state_count_; ++i) {
+        if (states_[i].handle == handle && states_[i].map == map) {
+            // Keep the states in [0, state_count_)
+            --state_count_;
+            if (i != state_count_) states_[i] = std::move(states_[state_count_]);
+            states_[state_count_] = State();
+            return;
+        }
+    }
+}
+
+void ValidationCallContext::ForgetStates() {
+    for (uint32_t i = 0; i < state_count_; ++i) {
+        states_[i] = State();
+    }
+    state_count_ = 0;
+    next_state_ = 0;
+}
@@ -0,0 +1,95 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "vulkan/vulkan.h"
+#include "vk_typemap_helper.h"
+
+// What the validation objects resolved for the API call the chassis is dispatching on this thread, so that the PreCallValidate,
+// PreCallRecord and PostCallRecord hooks of each object don't resolve it again. The chassis puts one on the stack of each
+// intercept, and the hooks reach it through Current() rather than a parameter, leaving their signatures alone. Threads outside
+// an intercept, like the worker threads, have no context and resolve everything themselves.
+//
+// It memoizes
+// - the decoded pNext chains of the call's parameters, shared by all the validation objects, see CallFindInChain(),
+// - the state objects each ValidationStateTracker found for the call's handles, keyed by the state map they came from. The
+//   context holds a reference to each, and the tracker forgets one as soon as it adds or destroys state for its handle.
+class ValidationCallContext {
+  public:
+    ValidationCallContext() : previous_(current_call_context) { current_call_context = this; }
+    ~ValidationCallContext() { current_call_context = previous_; }
+    ValidationCallContext(const ValidationCallContext &) = delete;
+    ValidationCallContext &operator=(const ValidationCallContext &) = delete;
+
+    static ValidationCallContext *Current() { return current_call_context; }
+
+    // The first struct of the type in the chain, decoding the chain on its first lookup in the call
+    const void *FindInChain(const void *next, VkStructureType type);
+
+    std::shared_ptr<void> FindState(const void *map, uint64_t handle) const {
+        for (uint32_t i = 0; i < state_count_; ++i) {
+            if (states_[i].handle == handle && states_[i].map == map) return states_[i].state;
+        }
+        return nullptr;
+    }
+    void RememberState(const void *map, uint64_t handle, std::shared_ptr<void> state);
+    void ForgetState(const void *map, uint64_t handle);
+    void ForgetStates();
+
+  private:
+    static const uint32_t kMaxChains = 4;
+    static const uint32_t kMaxChainStructs = 16;
+    static const uint32_t kMaxStates = 16;
+
+    struct Chain {
+        const void *head;
+        uint32_t count;
+        // Set if the chain has more than kMaxChainStructs structs, the rest of which are walked at each lookup
+        bool truncated;
+        VkStructureType types[kMaxChainStructs];
+        const VkBaseInStructure *structs[kMaxChainStructs];
+    };
+
+    struct State {
+        const void *map = nullptr;
+        uint64_t handle = 0;
+        std::shared_ptr<void> state;
+    };
+
+    static thread_local ValidationCallContext *current_call_context;
+
+    ValidationCallContext *previous_;
+    uint32_t chain_count_ = 0;
+    uint32_t next_chain_ = 0;
+    uint32_t state_count_ = 0;
+    uint32_t next_state_ = 0;
+    Chain chains_[kMaxChains];
+    State states_[kMaxStates];
+};
+
+// LvlFindInChain for the pNext chains of the parameters of the call being validated. The application may not change them during
+// the call, so each is decoded once for all the validation objects. Chains the layer builds itself, whose memory the call may
+// reuse for another chain, must use LvlFindInChain.
+template <typename T>
+const T *CallFindInChain(const void *next) {
+    ValidationCallContext *context = ValidationCallContext::Current();
+    if (!context) return LvlFindInChain<T>(next);
+    return static_cast<const T *>(context->FindInChain(next, LvlTypeMap<T>::kSType));
+}
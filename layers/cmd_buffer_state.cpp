@@ -47,6 +47,7 @@ void COMMAND_POOL_STATE::Allocate(const VkCommandBufferAllocateInfo *create_info
 }
 
 void COMMAND_POOL_STATE::Free(uint32_t count, const VkCommandBuffer *command_buffers) {
+    BASE_NODE::InvalidationBatch invalidation_batch;
     for (uint32_t i = 0; i < count; i++) {
         auto iter = commandBuffers.find(command_buffers[i]);
         if (iter != commandBuffers.end()) {
@@ -64,6 +65,7 @@ void COMMAND_POOL_STATE::Reset() {
 }
 
 void COMMAND_POOL_STATE::Destroy() {
+    BASE_NODE::InvalidationBatch invalidation_batch;
     for (auto &entry : commandBuffers) {
         dev_data->Destroy<CMD_BUFFER_STATE>(entry.first);
     }
@@ -239,7 +241,15 @@ CMD_BUFFER_STATE::CMD_BUFFER_STATE(ValidationStateTracker *dev, VkCommandBuffer
       createInfo(*pCreateInfo),
       command_pool(pool),
       dev_data(dev),
-      unprotected(pool->unprotected) {
+      unprotected(pool->unprotected),
+      inheritedViewportDepths(&arena),
+      attachments_view_states(&arena),
+      event_table(&arena),
+      wait_event_ids(&arena),
+      queue_submit_functions(&arena),
+      queue_submit_functions_after_render_pass(&arena),
+      cmd_execute_commands_functions(&arena),
+      queryUpdates(&arena) {
     Reset();
 }
 
@@ -287,7 +297,8 @@ void CMD_BUFFER_STATE::Reset() {
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
     status = 0;
     static_status = 0;
-    inheritedViewportDepths.clear();
+    DirtyDrawChecks(CB_DRAW_DIRTY_ALL);
+    ReleaseArenaStorage(inheritedViewportDepths);
     usedViewportScissorCount = 0;
     pipelineStaticViewportCount = 0;
     pipelineStaticScissorCount = 0;
@@ -310,18 +321,21 @@ void CMD_BUFFER_STATE::Reset() {
     activeRenderPass = nullptr;
     active_attachments = nullptr;
     active_subpasses = nullptr;
-    attachments_view_states.clear();
+    ReleaseArenaStorage(attachments_view_states);
+    rendering_attachment_view_states.clear();
     activeSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
     activeSubpass = 0;
     broken_bindings.clear();
-    waitedEvents.clear();
-    events.clear();
-    writeEventsBeforeWait.clear();
+    ReleaseArenaStorage(event_table);
+    event_ids.clear();
+    ReleaseArenaStorage(wait_event_ids);
     activeQueries.clear();
     startedQueries.clear();
     image_layout_map.clear();
     aliased_image_layout_map.clear();
-    current_vertex_buffer_binding_info.vertex_buffer_bindings.clear();
+    image_layout_summary.clear();
+    image_layout_summary_valid = false;
+    current_vertex_buffer_binding_info.clear();
     vertex_buffer_used = false;
     primaryCommandBuffer = VK_NULL_HANDLE;
 
@@ -329,11 +343,16 @@ void CMD_BUFFER_STATE::Reset() {
     // Remove reverse command buffer links.
     Invalidate(true);
 
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
-    cmd_execute_commands_functions.clear();
+    ReleaseArenaStorage(queue_submit_functions);
+    ReleaseArenaStorage(queue_submit_functions_after_render_pass);
+    ReleaseArenaStorage(cmd_execute_commands_functions);
+    deferred_validate_functions.clear();
+    deferred_validate_fingerprint = 0;
+    deferred_validate_buffers.clear();
     eventUpdates.clear();
-    queryUpdates.clear();
+    ReleaseArenaStorage(queryUpdates);
+    // Every arena backed container has released its storage above
+    arena.Reset();
 
     // Remove object bindings
     for (const auto &obj : object_bindings) {
@@ -370,21 +389,29 @@ void CMD_BUFFER_STATE::Reset() {
     if (dev_data->command_buffer_reset_callback) {
         (*dev_data->command_buffer_reset_callback)(commandBuffer());
     }
+    UpdateAccountedMemory();
 }
 
-// Track which resources are in-flight by atomically incrementing their "in_use" count
-void CMD_BUFFER_STATE::IncrementResources() {
-    submitCount++;
-
-    // TODO : We should be able to remove the NULL look-up checks from the code below as long as
-    //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
-    //  should then be flagged prior to calling this function
-    for (auto event : writeEventsBeforeWait) {
-        auto event_state = dev_data->Get<EVENT_STATE>(event);
-        if (event_state) event_state->write_in_use++;
+bool EVENT_STATE::WriteInUse() const {
+    for (const auto &item : ObjectBindings()) {
+        if (item.first.type != kVulkanObjectTypeCommandBuffer) continue;
+        auto cb_state = std::static_pointer_cast<CMD_BUFFER_STATE>(item.second.lock());
+        // Also true for a secondary command buffer executed by a pending primary
+        if (!cb_state || !cb_state->InUse()) continue;
+        auto guard = cb_state->ReadLock();
+        for (const auto &cb_event : cb_state->event_table) {
+            if (cb_event.event == event()) {
+                if (cb_event.write_before_wait) return true;
+                break;
+            }
+        }
     }
+    return false;
 }
 
+// Resources bound to the command buffer are in-flight while it is, see BASE_NODE::InUse()
+void CMD_BUFFER_STATE::IncrementResources() { submitCount++; }
+
 // Discussed in details in https://github.com/KhronosGroup/Vulkan-Docs/issues/1081
 // Internal discussion and CTS were written to prove that this is not called after an incompatible vkCmdBindPipeline
 // "Binding a pipeline with a layout that is not compatible with the push constant layout does not disturb the push constant values"
@@ -401,39 +428,9 @@ void CMD_BUFFER_STATE::ResetPushConstantDataIfIncompatible(const PIPELINE_LAYOUT
     }
 
     push_constant_data_ranges = pipeline_layout_state->push_constant_ranges;
-    push_constant_data.clear();
-    push_constant_data_update.clear();
-    uint32_t size_needed = 0;
-    for (const auto &push_constant_range : *push_constant_data_ranges) {
-        auto size = push_constant_range.offset + push_constant_range.size;
-        size_needed = std::max(size_needed, size);
-
-        auto stage_flags = push_constant_range.stageFlags;
-        uint32_t bit_shift = 0;
-        while (stage_flags) {
-            if (stage_flags & 1) {
-                VkShaderStageFlagBits flag = static_cast<VkShaderStageFlagBits>(1 << bit_shift);
-                const auto it = push_constant_data_update.find(flag);
-
-                if (it != push_constant_data_update.end()) {
-                    if (it->second.size() < push_constant_range.offset) {
-                        it->second.resize(push_constant_range.offset, PC_Byte_Not_Set);
-                    }
-                    if (it->second.size() < size) {
-                        it->second.resize(size, PC_Byte_Not_Updated);
-                    }
-                } else {
-                    std::vector<uint8_t> bytes;
-                    bytes.resize(push_constant_range.offset, PC_Byte_Not_Set);
-                    bytes.resize(size, PC_Byte_Not_Updated);
-                    push_constant_data_update[flag] = bytes;
-                }
-            }
-            stage_flags = stage_flags >> 1;
-            ++bit_shift;
-        }
-    }
-    push_constant_data.resize(size_needed, 0);
+    const size_t size_needed = pipeline_layout_state->push_constant_byte_stages.size();
+    push_constant_data.assign(size_needed, 0);
+    push_constant_data_update.assign(size_needed, 0);
 }
 
 void CMD_BUFFER_STATE::Destroy() {
@@ -451,42 +448,91 @@ void CMD_BUFFER_STATE::Destroy() {
     BASE_NODE::Destroy();
 }
 
-void CMD_BUFFER_STATE::NotifyInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink) {
-    {
-        auto guard = WriteLock();
-        if (state == CB_RECORDING) {
-            state = CB_INVALID_INCOMPLETE;
-        } else if (state == CB_RECORDED) {
-            state = CB_INVALID_COMPLETE;
-        }
-        assert(!invalid_nodes.empty());
-        LogObjectList log_list;
+// Must be called with the command buffer write lock held
+void CMD_BUFFER_STATE::RecordInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink) {
+    if (state == CB_RECORDING) {
+        state = CB_INVALID_INCOMPLETE;
+    } else if (state == CB_RECORDED) {
+        state = CB_INVALID_COMPLETE;
+    }
+    assert(!invalid_nodes.empty());
+    // Destroyed objects can change the outcome of draw time checks
+    DirtyDrawChecks(CB_DRAW_DIRTY_ALL);
+    LogObjectList log_list;
+    for (auto &obj : invalid_nodes) {
+        log_list.object_list.emplace_back(obj->Handle());
+    }
+    broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
+
+    if (unlink) {
         for (auto &obj : invalid_nodes) {
-            log_list.object_list.emplace_back(obj->Handle());
-        }
-        broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
-
-        if (unlink) {
-            for (auto &obj : invalid_nodes) {
-                object_bindings.erase(obj);
-                switch (obj->Type()) {
-                    case kVulkanObjectTypeCommandBuffer:
-                        linkedCommandBuffers.erase(static_cast<CMD_BUFFER_STATE *>(obj.get()));
-                        break;
-                    case kVulkanObjectTypeImage:
-                        image_layout_map.erase(static_cast<IMAGE_STATE *>(obj.get()));
-                        break;
-                    default:
-                        break;
+            object_bindings.erase(obj);
+            switch (obj->Type()) {
+                case kVulkanObjectTypeCommandBuffer:
+                    linkedCommandBuffers.erase(static_cast<CMD_BUFFER_STATE *>(obj.get()));
+                    break;
+                case kVulkanObjectTypeImage: {
+                    const auto *image_state = static_cast<IMAGE_STATE *>(obj.get());
+                    image_layout_map.erase(image_state);
+                    image_layout_summary.erase(std::remove_if(image_layout_summary.begin(), image_layout_summary.end(),
+                                                              [image_state](const ImageLayoutSummaryEntry &entry) {
+                                                                  return entry.image == image_state;
+                                                              }),
+                                               image_layout_summary.end());
+                    break;
                 }
+                default:
+                    break;
             }
         }
     }
+}
+
+void CMD_BUFFER_STATE::NotifyInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink) {
+    if (DeferInvalidate(invalid_nodes, unlink)) {
+        return;
+    }
+    {
+        auto guard = WriteLock();
+        RecordInvalidate(invalid_nodes, unlink);
+    }
     BASE_NODE::NotifyInvalidate(invalid_nodes, unlink);
 }
 
+void CMD_BUFFER_STATE::NotifyInvalidateBatch(const std::vector<PendingInvalidate> &notifications) {
+    {
+        auto guard = WriteLock();
+        for (const auto &notification : notifications) {
+            RecordInvalidate(notification.invalid_nodes, notification.unlink);
+        }
+    }
+    for (const auto &notification : notifications) {
+        BASE_NODE::NotifyInvalidate(notification.invalid_nodes, notification.unlink);
+    }
+}
+
 const CommandBufferImageLayoutMap& CMD_BUFFER_STATE::GetImageSubresourceLayoutMap() const { return image_layout_map; }
 
+void CMD_BUFFER_STATE::BuildImageLayoutSummary(std::vector<ImageLayoutSummaryEntry> &summary) const {
+    summary.clear();
+    summary.reserve(image_layout_map.size());
+    for (const auto &layout_map_entry : image_layout_map) {
+        if (layout_map_entry.second->GetLayoutMap().empty()) continue;
+        summary.emplace_back(
+            ImageLayoutSummaryEntry{layout_map_entry.first, layout_map_entry.second, layout_map_entry.second->GetUniformLayout()});
+    }
+    std::sort(summary.begin(), summary.end(), [](const ImageLayoutSummaryEntry &a, const ImageLayoutSummaryEntry &b) {
+        return std::less<const IMAGE_STATE *>()(a.image, b.image);
+    });
+}
+
+const std::vector<ImageLayoutSummaryEntry> &CMD_BUFFER_STATE::GetImageLayoutSummary(
+    std::vector<ImageLayoutSummaryEntry> &scratch) const {
+    if (image_layout_summary_valid) return image_layout_summary;
+    BuildImageLayoutSummary(scratch);
+    return scratch;
+}
+
 // The const variant only need the image as it is the key for the map
 const ImageSubresourceLayoutMap *CMD_BUFFER_STATE::GetImageSubresourceLayoutMap(const IMAGE_STATE &image_state) const {
     auto it = image_layout_map.find(&image_state);
@@ -530,7 +576,7 @@ ImageSubresourceLayoutMap *CMD_BUFFER_STATE::GetImageSubresourceLayoutMap(const
 }
 
 static bool SetQueryState(QueryObject object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+    localQueryToStateMap->Set(object, value);
     return false;
 }
 
@@ -556,10 +602,7 @@ void CMD_BUFFER_STATE::EndQuery(const QueryObject &query_obj) {
 
 static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
                                QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject object = QueryObject(QueryObject(queryPool, firstQuery + i), perfPass);
-        (*localQueryToStateMap)[object] = value;
-    }
+    localQueryToStateMap->SetRange(queryPool, firstQuery, queryCount, perfPass, value);
     return false;
 }
 
@@ -744,23 +787,36 @@ void CMD_BUFFER_STATE::BeginRendering(CMD_TYPE cmd_type, const VkRenderingInfo *
     active_attachments = nullptr;
     uint32_t attachment_count = (pRenderingInfo->colorAttachmentCount + 2) * 2;
 
-    // Set cb_state->active_attachments & cb_state->attachments_view_states
-    active_attachments = std::make_shared<std::vector<IMAGE_VIEW_STATE *>>(attachment_count);
+    // Set cb_state->active_attachments, reusing the attachments of the previous rendering scope unless they are still shared
+    if (!rendering_attachments || rendering_attachments.use_count() > 1) {
+        // Whoever shares the previous attachments still points to their views
+        for (auto &view_state : rendering_attachment_view_states) {
+            attachments_view_states.insert(std::move(view_state));
+        }
+        rendering_attachments = std::make_shared<std::vector<IMAGE_VIEW_STATE *>>();
+    }
+    rendering_attachment_view_states.clear();
+    rendering_attachments->assign(attachment_count, nullptr);
+    active_attachments = rendering_attachments;
     auto &attachments = *(active_attachments.get());
 
+    // Keeps the view of an attachment alive while active_attachments points to it
+    auto add_view_state = [this](VkImageView image_view) {
+        auto view_state = dev_data->Get<IMAGE_VIEW_STATE>(image_view);
+        IMAGE_VIEW_STATE *view_state_ptr = view_state.get();
+        rendering_attachment_view_states.emplace_back(std::move(view_state));
+        return view_state_ptr;
+    };
+
     for (uint32_t i = 0; i < pRenderingInfo->colorAttachmentCount; ++i) {
         auto& colorAttachment = attachments[GetDynamicColorAttachmentImageIndex(i)];
         auto& colorResolveAttachment = attachments[GetDynamicColorResolveAttachmentImageIndex(i)];
-        colorAttachment = nullptr;
-        colorResolveAttachment = nullptr;
 
         if (pRenderingInfo->pColorAttachments[i].imageView != VK_NULL_HANDLE) {
-            auto res =
-                attachments_view_states.insert(dev_data->Get<IMAGE_VIEW_STATE>(pRenderingInfo->pColorAttachments[i].imageView));
-            colorAttachment = res.first->get();
+            colorAttachment = add_view_state(pRenderingInfo->pColorAttachments[i].imageView);
             if (pRenderingInfo->pColorAttachments[i].resolveMode != VK_RESOLVE_MODE_NONE &&
                 pRenderingInfo->pColorAttachments[i].resolveImageView != VK_NULL_HANDLE) {
-                colorResolveAttachment = res.first->get();
+                colorResolveAttachment = colorAttachment;
             }
         }
     }
@@ -768,28 +824,22 @@ void CMD_BUFFER_STATE::BeginRendering(CMD_TYPE cmd_type, const VkRenderingInfo *
     if (pRenderingInfo->pDepthAttachment && pRenderingInfo->pDepthAttachment->imageView != VK_NULL_HANDLE) {
         auto& depthAttachment = attachments[GetDynamicDepthAttachmentImageIndex()];
         auto& depthResolveAttachment = attachments[GetDynamicDepthResolveAttachmentImageIndex()];
-        depthAttachment = nullptr;
-        depthResolveAttachment = nullptr;
 
-        auto res = attachments_view_states.insert(dev_data->Get<IMAGE_VIEW_STATE>(pRenderingInfo->pDepthAttachment->imageView));
-        depthAttachment = res.first->get();
+        depthAttachment = add_view_state(pRenderingInfo->pDepthAttachment->imageView);
         if (pRenderingInfo->pDepthAttachment->resolveMode != VK_RESOLVE_MODE_NONE &&
             pRenderingInfo->pDepthAttachment->resolveImageView != VK_NULL_HANDLE) {
-            depthResolveAttachment = res.first->get();
+            depthResolveAttachment = depthAttachment;
         }
-    } 
+    }
 
     if (pRenderingInfo->pStencilAttachment && pRenderingInfo->pStencilAttachment->imageView != VK_NULL_HANDLE) {
         auto& stencilAttachment = attachments[GetDynamicStencilAttachmentImageIndex()];
         auto& stencilResolveAttachment = attachments[GetDynamicStencilResolveAttachmentImageIndex()];
-        stencilAttachment = nullptr;
-        stencilResolveAttachment = nullptr;
 
-        auto res = attachments_view_states.insert(dev_data->Get<IMAGE_VIEW_STATE>(pRenderingInfo->pStencilAttachment->imageView));
-        stencilAttachment = res.first->get();
+        stencilAttachment = add_view_state(pRenderingInfo->pStencilAttachment->imageView);
         if (pRenderingInfo->pStencilAttachment->resolveMode != VK_RESOLVE_MODE_NONE &&
             pRenderingInfo->pStencilAttachment->resolveImageView != VK_NULL_HANDLE) {
-            stencilResolveAttachment = res.first->get();
+            stencilResolveAttachment = stencilAttachment;
         }
     }
 }
@@ -872,6 +922,22 @@ void CMD_BUFFER_STATE::End(VkResult result) {
     if (VK_SUCCESS == result) {
         state = CB_RECORDED;
     }
+    // Barriers leave the layout maps split at every range they touched, merge them back before submit time validation
+    for (auto &layout_map_entry : image_layout_map) {
+        layout_map_entry.second->Consolidate();
+    }
+    BuildImageLayoutSummary(image_layout_summary);
+    image_layout_summary_valid = true;
+    UpdateAccountedMemory();
+}
+
+size_t CMD_BUFFER_STATE::DynamicMemoryUsage() const {
+    return arena.Capacity() + NodeContainerMemoryUsage(object_bindings) + NodeContainerMemoryUsage(broken_bindings) +
+           NodeContainerMemoryUsage(image_layout_map) + VectorMemoryUsage(image_layout_summary) +
+           NodeContainerMemoryUsage(validate_descriptorsets_in_queuesubmit) +
+           VectorMemoryUsage(deferred_validate_functions) + VectorMemoryUsage(deferred_validate_buffers) +
+           VectorMemoryUsage(eventUpdates) + NodeContainerMemoryUsage(event_ids) + VectorMemoryUsage(push_constant_data) +
+           VectorMemoryUsage(push_constant_data_update);
 }
 
 void CMD_BUFFER_STATE::ExecuteCommands(uint32_t commandBuffersCount, const VkCommandBuffer *pCommandBuffers) {
@@ -891,13 +957,12 @@ void CMD_BUFFER_STATE::ExecuteCommands(uint32_t commandBuffersCount, const VkCom
         // NOTE: The update/population of the image_layout_map is done in CoreChecks, but for other classes derived from
         // ValidationStateTracker these maps will be empty, so leaving the propagation in the the state tracker should be a no-op
         // for those other classes.
-        for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto *image_state = sub_layout_map_entry.first;
-
-            auto *cb_subres_map = GetImageSubresourceLayoutMap(*image_state);
+        // The summary built when the secondary ended is reused by every execution, and leaves out the images it has no layouts for
+        std::vector<ImageLayoutSummaryEntry> summary_scratch;
+        for (const auto &summary_entry : sub_cb_state->GetImageLayoutSummary(summary_scratch)) {
+            auto *cb_subres_map = GetImageSubresourceLayoutMap(*summary_entry.image);
             if (cb_subres_map) {
-                const auto &sub_cb_subres_map = sub_layout_map_entry.second;
-                cb_subres_map->UpdateFrom(*sub_cb_subres_map);
+                cb_subres_map->UpdateFrom(*summary_entry.layout_map);
             }
         }
 
@@ -997,16 +1062,17 @@ void CMD_BUFFER_STATE::UpdateDrawState(CMD_TYPE cmd_type, const VkPipelineBindPo
             // See CoreChecks::ValidateCmdBufDrawState for more details.
             bool descriptor_set_changed =
                 !reduced_map.IsManyDescriptors() ||
-                // Update if descriptor set (or contents) has changed
+                // Update if descriptor set has changed
                 state.per_set[set_index].validated_set != descriptor_set.get() ||
-                state.per_set[set_index].validated_set_change_count != descriptor_set->GetChangeCount() ||
                 (!dev_data->disabled[image_layout_validation] &&
                  state.per_set[set_index].validated_set_image_layout_change_count != image_layout_change_count);
-            bool need_update = descriptor_set_changed ||
+            const uint64_t validated_change_count = state.per_set[set_index].validated_set_change_count;
+            bool contents_changed = validated_change_count != descriptor_set->GetChangeCount();
+            bool need_update = descriptor_set_changed || contents_changed ||
                                // Update if previous bindingReqMap doesn't include new bindingReqMap
-                               !std::includes(state.per_set[set_index].validated_set_binding_req_map.begin(),
-                                              state.per_set[set_index].validated_set_binding_req_map.end(), binding_req_map.begin(),
-                                              binding_req_map.end());
+                               !std::includes(state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                              state.per_set[set_index].validated_set_binding_reqs.end(), binding_req_map.begin(),
+                                              binding_req_map.end(), BindingReqLess());
 
             if (need_update) {
                 if (!dev_data->disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
@@ -1018,10 +1084,21 @@ void CMD_BUFFER_STATE::UpdateDrawState(CMD_TYPE cmd_type, const VkPipelineBindPo
                     // Only record the bindings that haven't already been recorded
                     BindingReqMap delta_reqs;
                     std::set_difference(binding_req_map.begin(), binding_req_map.end(),
-                                        state.per_set[set_index].validated_set_binding_req_map.begin(),
-                                        state.per_set[set_index].validated_set_binding_req_map.end(),
-                                        layer_data::insert_iterator<BindingReqMap>(delta_reqs, delta_reqs.begin()));
+                                        state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                        state.per_set[set_index].validated_set_binding_reqs.end(),
+                                        layer_data::insert_iterator<BindingReqMap>(delta_reqs, delta_reqs.begin()),
+                                        BindingReqLess());
                     descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, delta_reqs);
+                    if (contents_changed) {
+                        // Rewritten descriptors of the bindings already recorded
+                        BindingReqMap recorded_reqs;
+                        std::set_intersection(binding_req_map.begin(), binding_req_map.end(),
+                                              state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                              state.per_set[set_index].validated_set_binding_reqs.end(),
+                                              layer_data::insert_iterator<BindingReqMap>(recorded_reqs, recorded_reqs.begin()),
+                                              BindingReqLess());
+                        descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, recorded_reqs, validated_change_count);
+                    }
                 } else {
                     descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, binding_req_map);
                 }
@@ -1030,13 +1107,10 @@ void CMD_BUFFER_STATE::UpdateDrawState(CMD_TYPE cmd_type, const VkPipelineBindPo
                 state.per_set[set_index].validated_set_change_count = descriptor_set->GetChangeCount();
                 state.per_set[set_index].validated_set_image_layout_change_count = image_layout_change_count;
                 if (reduced_map.IsManyDescriptors()) {
-                    // Check whether old == new before assigning, the equality check is much cheaper than
-                    // freeing and reallocating the map.
-                    if (state.per_set[set_index].validated_set_binding_req_map != set_binding_pair.second) {
-                        state.per_set[set_index].validated_set_binding_req_map = set_binding_pair.second;
-                    }
+                    // Assigning reuses the storage of the previous pipeline's requirements
+                    state.per_set[set_index].validated_set_binding_reqs = pipe->active_slot_flags[set_index];
                 } else {
-                    state.per_set[set_index].validated_set_binding_req_map = BindingReqMap();
+                    state.per_set[set_index].validated_set_binding_reqs.clear();
                 }
             }
         }
@@ -1063,6 +1137,9 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipelin
     const uint32_t last_binding_index = required_size - 1;
     assert(last_binding_index < pipeline_layout->compat_for_set.size());
 
+    // Push descriptor updates do not all go through RecordCmd()
+    DirtyDrawChecks(CB_DRAW_DIRTY_DESCRIPTOR_SETS);
+
     // Some useful shorthand
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1071,6 +1148,9 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipelin
     // Resize binding arrays
     uint32_t last_set_index = first_set + set_count - 1;
     if (last_set_index >= last_bound.per_set.size()) {
+        if (last_set_index >= last_bound.per_set.capacity()) {
+            last_bound.per_set.reserve(std::max(last_set_index + 1, dev_data->phys_dev_props.limits.maxBoundDescriptorSets));
+        }
         last_bound.per_set.resize(last_set_index + 1);
     }
     const uint32_t current_size = static_cast<uint32_t>(last_bound.per_set.size());
@@ -1108,7 +1188,7 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipelin
         if (last_bound.per_set[set_idx].compat_id_for_set != pipe_compat_ids[set_idx]) {
             push_descriptor_cleanup(last_bound.per_set[set_idx].bound_descriptor_set);
             last_bound.per_set[set_idx].bound_descriptor_set = nullptr;
-            last_bound.per_set[set_idx].dynamicOffsets.clear();
+            last_bound.per_set[set_idx].dynamic_offset_count = 0;
             last_bound.per_set[set_idx].compat_id_for_set = pipe_compat_ids[set_idx];
         }
     }
@@ -1132,12 +1212,11 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipelin
             auto set_dynamic_descriptor_count = descriptor_set->GetDynamicDescriptorCount();
             // TODO: Add logic for tracking push_descriptor offsets (here or in caller)
             if (set_dynamic_descriptor_count && input_dynamic_offsets) {
-                const uint32_t *end_offset = input_dynamic_offsets + set_dynamic_descriptor_count;
-                last_bound.per_set[set_idx].dynamicOffsets = std::vector<uint32_t>(input_dynamic_offsets, end_offset);
-                input_dynamic_offsets = end_offset;
+                last_bound.SetDynamicOffsets(last_bound.per_set[set_idx], set_dynamic_descriptor_count, input_dynamic_offsets);
+                input_dynamic_offsets += set_dynamic_descriptor_count;
                 assert(input_dynamic_offsets <= (p_dynamic_offsets + dynamic_offset_count));
             } else {
-                last_bound.per_set[set_idx].dynamicOffsets.clear();
+                last_bound.per_set[set_idx].dynamic_offset_count = 0;
             }
             if (!descriptor_set->IsPushDescriptor()) {
                 // Can't cache validation of push_descriptors
@@ -1204,7 +1283,151 @@ void CMD_BUFFER_STATE::SetImageViewLayout(const IMAGE_VIEW_STATE &view_state, Vk
     }
 }
 
-void CMD_BUFFER_STATE::RecordCmd(CMD_TYPE cmd_type) { commandCount++; }
+// The inputs of the draw time checks a command can change
+static CBDrawDirtyFlags GetDrawDirtyFlags(CMD_TYPE cmd_type) {
+    switch (cmd_type) {
+        case CMD_DRAW:
+        case CMD_DRAWINDEXED:
+        case CMD_DRAWINDEXEDINDIRECT:
+        case CMD_DRAWINDEXEDINDIRECTCOUNT:
+        case CMD_DRAWINDEXEDINDIRECTCOUNTAMD:
+        case CMD_DRAWINDEXEDINDIRECTCOUNTKHR:
+        case CMD_DRAWINDIRECT:
+        case CMD_DRAWINDIRECTBYTECOUNTEXT:
+        case CMD_DRAWINDIRECTCOUNT:
+        case CMD_DRAWINDIRECTCOUNTAMD:
+        case CMD_DRAWINDIRECTCOUNTKHR:
+        case CMD_DRAWMESHTASKSINDIRECTCOUNTNV:
+        case CMD_DRAWMESHTASKSINDIRECTNV:
+        case CMD_DRAWMESHTASKSNV:
+        case CMD_DRAWMULTIEXT:
+        case CMD_DRAWMULTIINDEXEDEXT:
+        case CMD_DISPATCH:
+        case CMD_DISPATCHBASE:
+        case CMD_DISPATCHBASEKHR:
+        case CMD_DISPATCHINDIRECT:
+        case CMD_TRACERAYSINDIRECTKHR:
+        case CMD_TRACERAYSKHR:
+        case CMD_TRACERAYSNV:
+        case CMD_BEGINDEBUGUTILSLABELEXT:
+        case CMD_ENDDEBUGUTILSLABELEXT:
+        case CMD_INSERTDEBUGUTILSLABELEXT:
+        case CMD_DEBUGMARKERBEGINEXT:
+        case CMD_DEBUGMARKERENDEXT:
+        case CMD_DEBUGMARKERINSERTEXT:
+        case CMD_WRITETIMESTAMP:
+        case CMD_WRITETIMESTAMP2:
+        case CMD_WRITETIMESTAMP2KHR:
+            return CB_DRAW_DIRTY_NONE;
+        case CMD_BINDPIPELINE:
+            return CB_DRAW_DIRTY_PIPELINE;
+        case CMD_BINDDESCRIPTORSETS:
+        case CMD_PUSHDESCRIPTORSETKHR:
+        case CMD_PUSHDESCRIPTORSETWITHTEMPLATEKHR:
+            return CB_DRAW_DIRTY_DESCRIPTOR_SETS;
+        case CMD_BINDVERTEXBUFFERS:
+        case CMD_BINDVERTEXBUFFERS2:
+        case CMD_BINDVERTEXBUFFERS2EXT:
+        case CMD_BINDINDEXBUFFER:
+            return CB_DRAW_DIRTY_VERTEX_INDEX;
+        case CMD_PUSHCONSTANTS:
+            return CB_DRAW_DIRTY_PUSH_CONSTANTS;
+        case CMD_BEGINQUERY:
+        case CMD_BEGINQUERYINDEXEDEXT:
+        case CMD_ENDQUERY:
+        case CMD_ENDQUERYINDEXEDEXT:
+        case CMD_BEGINRENDERPASS:
+        case CMD_BEGINRENDERPASS2:
+        case CMD_BEGINRENDERPASS2KHR:
+        case CMD_NEXTSUBPASS:
+        case CMD_NEXTSUBPASS2:
+        case CMD_NEXTSUBPASS2KHR:
+        case CMD_ENDRENDERPASS:
+        case CMD_ENDRENDERPASS2:
+        case CMD_ENDRENDERPASS2KHR:
+        case CMD_BEGINRENDERING:
+        case CMD_BEGINRENDERINGKHR:
+        case CMD_ENDRENDERING:
+        case CMD_ENDRENDERINGKHR:
+            return CB_DRAW_DIRTY_RENDER_PASS;
+        case CMD_SETBLENDCONSTANTS:
+        case CMD_SETCOLORWRITEENABLEEXT:
+        case CMD_SETCULLMODE:
+        case CMD_SETCULLMODEEXT:
+        case CMD_SETDEPTHBIAS:
+        case CMD_SETDEPTHBIASENABLE:
+        case CMD_SETDEPTHBIASENABLEEXT:
+        case CMD_SETDEPTHBOUNDS:
+        case CMD_SETDEPTHBOUNDSTESTENABLE:
+        case CMD_SETDEPTHBOUNDSTESTENABLEEXT:
+        case CMD_SETDEPTHCOMPAREOP:
+        case CMD_SETDEPTHCOMPAREOPEXT:
+        case CMD_SETDEPTHTESTENABLE:
+        case CMD_SETDEPTHTESTENABLEEXT:
+        case CMD_SETDEPTHWRITEENABLE:
+        case CMD_SETDEPTHWRITEENABLEEXT:
+        case CMD_SETDISCARDRECTANGLEEXT:
+        case CMD_SETEXCLUSIVESCISSORNV:
+        case CMD_SETFRAGMENTSHADINGRATEENUMNV:
+        case CMD_SETFRAGMENTSHADINGRATEKHR:
+        case CMD_SETFRONTFACE:
+        case CMD_SETFRONTFACEEXT:
+        case CMD_SETLINESTIPPLEEXT:
+        case CMD_SETLINEWIDTH:
+        case CMD_SETLOGICOPEXT:
+        case CMD_SETPATCHCONTROLPOINTSEXT:
+        case CMD_SETPRIMITIVERESTARTENABLE:
+        case CMD_SETPRIMITIVERESTARTENABLEEXT:
+        case CMD_SETPRIMITIVETOPOLOGY:
+        case CMD_SETPRIMITIVETOPOLOGYEXT:
+        case CMD_SETRASTERIZERDISCARDENABLE:
+        case CMD_SETRASTERIZERDISCARDENABLEEXT:
+        case CMD_SETSAMPLELOCATIONSEXT:
+        case CMD_SETSCISSOR:
+        case CMD_SETSCISSORWITHCOUNT:
+        case CMD_SETSCISSORWITHCOUNTEXT:
+        case CMD_SETSTENCILCOMPAREMASK:
+        case CMD_SETSTENCILOP:
+        case CMD_SETSTENCILOPEXT:
+        case CMD_SETSTENCILREFERENCE:
+        case CMD_SETSTENCILTESTENABLE:
+        case CMD_SETSTENCILTESTENABLEEXT:
+        case CMD_SETSTENCILWRITEMASK:
+        case CMD_SETVERTEXINPUTEXT:
+        case CMD_SETVIEWPORT:
+        case CMD_SETVIEWPORTSHADINGRATEPALETTENV:
+        case CMD_SETVIEWPORTWSCALINGNV:
+        case CMD_SETVIEWPORTWITHCOUNT:
+        case CMD_SETVIEWPORTWITHCOUNTEXT:
+            return CB_DRAW_DIRTY_DYNAMIC_STATE;
+        default:
+            // Anything else may touch state the checks depend on in ways not worth tracking
+            return CB_DRAW_DIRTY_ALL;
+    }
+}
+
+void CMD_BUFFER_STATE::RecordCmd(CMD_TYPE cmd_type) {
+    commandCount++;
+    DirtyDrawChecks(GetDrawDirtyFlags(cmd_type));
+}
+
+void CMD_BUFFER_STATE::DirtyDrawChecks(CBDrawDirtyFlags inputs) {
+    // clang-format off
+    static const CBDrawDirtyFlags group_inputs[kDrawCheckGroupCount] = {
+        CB_DRAW_DIRTY_PIPELINE | CB_DRAW_DIRTY_DESCRIPTOR_SETS,
+        CB_DRAW_DIRTY_PIPELINE | CB_DRAW_DIRTY_DYNAMIC_STATE | CB_DRAW_DIRTY_VERTEX_INDEX | CB_DRAW_DIRTY_RENDER_PASS,
+        CB_DRAW_DIRTY_PIPELINE | CB_DRAW_DIRTY_PUSH_CONSTANTS,
+    };
+    // clang-format on
+    if (inputs == CB_DRAW_DIRTY_NONE) return;
+    for (auto &bind_point_checks : clean_draw_checks) {
+        for (uint32_t group = 0; group < kDrawCheckGroupCount; ++group) {
+            if (group_inputs[group] & inputs) {
+                bind_point_checks[group] = CMD_NONE;
+            }
+        }
+    }
+}
 
 void CMD_BUFFER_STATE::RecordStateCmd(CMD_TYPE cmd_type, CBStatusFlags state_bits) {
     RecordCmd(cmd_type);
@@ -1227,9 +1450,12 @@ void CMD_BUFFER_STATE::RecordTransferCmd(CMD_TYPE cmd_type, std::shared_ptr<BIND
     }
 }
 
-static bool SetEventStageMask(VkEvent event, VkPipelineStageFlags2KHR stageMask, EventToStageMap *localEventToStageMap) {
-    (*localEventToStageMap)[event] = stageMask;
-    return false;
+uint32_t CMD_BUFFER_STATE::GetEventId(VkEvent event) {
+    auto inserted = event_ids.emplace(event, static_cast<uint32_t>(event_table.size()));
+    if (inserted.second) {
+        event_table.push_back(CommandBufferEvent{event, false, false});
+    }
+    return inserted.first->second;
 }
 
 void CMD_BUFFER_STATE::RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
@@ -1240,13 +1466,12 @@ void CMD_BUFFER_STATE::RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipeli
             AddChild(event_state);
         }
     }
-    events.push_back(event);
-    if (!waitedEvents.count(event)) {
-        writeEventsBeforeWait.push_back(event);
+    const uint32_t event_id = GetEventId(event);
+    auto &cb_event = event_table[event_id];
+    if (!cb_event.waited) {
+        cb_event.write_before_wait = true;
     }
-    eventUpdates.emplace_back([event, stageMask](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, stageMask, localEventToStageMap);
-    });
+    eventUpdates.emplace_back(EventUpdate::SetStageMask(event_id, stageMask));
 }
 
 void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
@@ -1257,14 +1482,13 @@ void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipe
             AddChild(event_state);
         }
     }
-    events.push_back(event);
-    if (!waitedEvents.count(event)) {
-        writeEventsBeforeWait.push_back(event);
+    const uint32_t event_id = GetEventId(event);
+    auto &cb_event = event_table[event_id];
+    if (!cb_event.waited) {
+        cb_event.write_before_wait = true;
     }
 
-    eventUpdates.emplace_back([event](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, VkPipelineStageFlags2KHR(0), localEventToStageMap);
-    });
+    eventUpdates.emplace_back(EventUpdate::SetStageMask(event_id, VkPipelineStageFlags2KHR(0)));
 }
 
 void CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent *pEvents,
@@ -1277,8 +1501,9 @@ void CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount,
                 AddChild(event_state);
             }
         }
-        waitedEvents.insert(pEvents[i]);
-        events.push_back(pEvents[i]);
+        const uint32_t event_id = GetEventId(pEvents[i]);
+        event_table[event_id].waited = true;
+        wait_event_ids.push_back(event_id);
     }
 }
 
@@ -1333,45 +1558,60 @@ void CMD_BUFFER_STATE::RecordWriteTimestamp(CMD_TYPE cmd_type, VkPipelineStageFl
 
 void CMD_BUFFER_STATE::Submit(uint32_t perf_submit_pass) {
     VkQueryPool first_pool = VK_NULL_HANDLE;
-    EventToStageMap local_event_to_stage_map;
     QueryMap local_query_to_state_map;
     for (auto &function : queryUpdates) {
         function(nullptr, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_state_pair.first.pool);
-        query_pool_state->SetQueryState(query_state_pair.first.query, query_state_pair.first.perf_pass, query_state_pair.second);
+    for (const auto &pool_pass : local_query_to_state_map.Pools()) {
+        auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(pool_pass.first.first);
+        if (!query_pool_state) continue;
+        for (const auto &query_range : pool_pass.second) {
+            query_pool_state->SetQueryStates(query_range.first.begin, query_range.first.distance(), pool_pass.first.second,
+                                             query_range.second);
+        }
     }
 
-    for (const auto &function : eventUpdates) {
-        function(*this, /*do_validate*/ false, &local_event_to_stage_map);
+    if (eventUpdates.empty()) return;
+    EventStageTable event_stage_masks(event_table.size(), EventStageMask{false, 0});
+    for (const auto &update : eventUpdates) {
+        switch (update.type) {
+            case EventUpdate::kSetStageMask:
+                event_stage_masks[update.event_id] = EventStageMask{true, update.stage_mask};
+                break;
+            case EventUpdate::kWaitStageMask:
+                // Only validated, see CoreChecks
+                break;
+        }
     }
 
-    for (const auto &eventStagePair : local_event_to_stage_map) {
-        auto event_state = dev_data->Get<EVENT_STATE>(eventStagePair.first);
-        event_state->stageMask = eventStagePair.second;
+    for (uint32_t event_id = 0; event_id < event_stage_masks.size(); ++event_id) {
+        if (!event_stage_masks[event_id].set) continue;
+        auto event_state = dev_data->Get<EVENT_STATE>(event_table[event_id].event);
+        if (event_state) {
+            event_state->stageMask = event_stage_masks[event_id].stage_mask;
+        }
     }
 }
 
 void CMD_BUFFER_STATE::Retire(uint32_t perf_submit_pass, const std::function<bool(const QueryObject &)>& is_query_updated_after) {
-    // First perform decrement on general case bound objects
-    for (auto event : writeEventsBeforeWait) {
-        auto event_state = dev_data->Get<EVENT_STATE>(event);
-        if (event_state) {
-            event_state->write_in_use--;
-        }
-    }
     QueryMap local_query_to_state_map;
     VkQueryPool first_pool = VK_NULL_HANDLE;
     for (auto &function : queryUpdates) {
         function(nullptr, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_state_pair.first.pool);
-            query_pool_state->SetQueryState(query_state_pair.first.query, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
+    for (const auto &pool_pass : local_query_to_state_map.Pools()) {
+        const VkQueryPool pool = pool_pass.first.first;
+        const uint32_t perf_pass = pool_pass.first.second;
+        std::shared_ptr<QUERY_POOL_STATE> query_pool_state;
+        for (const auto &query_range : pool_pass.second) {
+            if (query_range.second != QUERYSTATE_ENDED) continue;
+            for (uint32_t query = query_range.first.begin; query < query_range.first.end; ++query) {
+                if (is_query_updated_after(QueryObject(QueryObject(pool, query), perf_pass))) continue;
+                if (!query_pool_state) query_pool_state = dev_data->Get<QUERY_POOL_STATE>(pool);
+                query_pool_state->SetQueryState(query, perf_pass, QUERYSTATE_AVAILABLE);
+            }
         }
     }
 }
@@ -1384,7 +1624,7 @@ void CMD_BUFFER_STATE::UnbindResources() {
     index_buffer_binding.reset();
     status &= ~CBSTATUS_INDEX_BUFFER_BOUND;
     vertex_buffer_used = false;
-    current_vertex_buffer_binding_info.vertex_buffer_bindings.clear();
+    current_vertex_buffer_binding_info.clear();
 
     // Push constants
     push_constant_data.clear();
@@ -1394,4 +1634,6 @@ void CMD_BUFFER_STATE::UnbindResources() {
 
     // Dynamic state
     dynamic_status = CBSTATUS_NONE;
+
+    DirtyDrawChecks(CB_DRAW_DIRTY_ALL);
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
  * Author: Tobias Hector <tobias.hector@amd.com>
  */
 #pragma once
+#include "arena_allocator.h"
 #include "base_node.h"
 #include "query_state.h"
 #include "command_validation.h"
@@ -44,14 +45,16 @@ class ValidationStateTracker;
 
 class EVENT_STATE : public BASE_NODE {
   public:
-    int write_in_use;
     VkPipelineStageFlags2KHR stageMask = VkPipelineStageFlags2KHR(0);
     VkEventCreateFlags flags;
 
-    EVENT_STATE(VkEvent event_, VkEventCreateFlags flags_)
-        : BASE_NODE(event_, kVulkanObjectTypeEvent), write_in_use(0), flags(flags_) {}
+    EVENT_STATE(VkEvent event_, VkEventCreateFlags flags_) : BASE_NODE(event_, kVulkanObjectTypeEvent), flags(flags_) {}
 
     VkEvent event() const { return handle_.Cast<VkEvent>(); }
+
+    // True if a pending command buffer sets or resets the event before waiting on it. Found from the command buffers the
+    // event is bound to when asked, so that submitting and retiring don't have to count the uses of every event.
+    bool WriteInUse() const;
 };
 
 // Only CoreChecks uses this, but the state tracker stores it.
@@ -59,6 +62,42 @@ constexpr static auto kInvalidLayout = image_layout_map::kInvalidLayout;
 using ImageSubresourceLayoutMap = image_layout_map::ImageSubresourceLayoutMap;
 typedef layer_data::unordered_map<VkEvent, VkPipelineStageFlags2KHR> EventToStageMap;
 
+// An event used by a command buffer. Its index in CMD_BUFFER_STATE::event_table is the event ID the command buffer's other
+// event state refers to it by.
+struct CommandBufferEvent {
+    VkEvent event;
+    bool waited;             // vkCmdWaitEvents waits on it
+    bool write_before_wait;  // vkCmdSetEvent or vkCmdResetEvent before the first wait on it
+};
+
+// The stage mask set for each event ID of a command buffer while replaying its EventUpdates
+struct EventStageMask {
+    bool set;
+    VkPipelineStageFlags2KHR stage_mask;
+};
+using EventStageTable = std::vector<EventStageMask>;
+
+// A recorded event operation, replayed in order at queue submit time to track the event stage masks.
+// These are stored by value in CMD_BUFFER_STATE::eventUpdates, replacing per-command callbacks.
+struct EventUpdate {
+    enum Type : uint8_t {
+        kSetStageMask,   // vkCmdSetEvent / vkCmdResetEvent, stage_mask is 0 for a reset
+        kWaitStageMask,  // vkCmdWaitEvents, validate stage_mask against the waited events (CoreChecks only)
+    };
+    Type type;
+    uint32_t event_id;            // kSetStageMask
+    uint32_t first_event_index;   // kWaitStageMask, index into CMD_BUFFER_STATE::wait_event_ids
+    uint32_t event_count;         // kWaitStageMask
+    VkPipelineStageFlags2KHR stage_mask;
+
+    static EventUpdate SetStageMask(uint32_t event_id, VkPipelineStageFlags2KHR stage_mask) {
+        return EventUpdate{kSetStageMask, event_id, 0, 0, stage_mask};
+    }
+    static EventUpdate WaitStageMask(uint32_t first_event_index, uint32_t event_count, VkPipelineStageFlags2KHR stage_mask) {
+        return EventUpdate{kWaitStageMask, 0, first_event_index, event_count, stage_mask};
+    }
+};
+
 // Track command pools and their command buffers
 class COMMAND_POOL_STATE : public BASE_NODE {
   public:
@@ -94,54 +133,23 @@ enum CB_STATE {
     CB_INVALID_INCOMPLETE,  // fouled before recording was completed
 };
 
-// CB Status -- used to track status of various bindings on cmd buffer objects
-typedef uint64_t CBStatusFlags;
-enum CBStatusFlagBits : uint64_t {
+
+// Inputs of the groups of draw time checks in CoreChecks::ValidateCmdBufDrawState. Recording a command marks the inputs it can
+// change, which forgets the cached verdicts of the groups depending on them.
+typedef uint32_t CBDrawDirtyFlags;
+enum CBDrawDirtyFlagBits : uint32_t {
     // clang-format off
-    CBSTATUS_NONE                            = 0x00000000,   // No status is set
-    CBSTATUS_LINE_WIDTH_SET                  = 0x00000001,   // Line width has been set
-    CBSTATUS_DEPTH_BIAS_SET                  = 0x00000002,   // Depth bias has been set
-    CBSTATUS_BLEND_CONSTANTS_SET             = 0x00000004,   // Blend constants state has been set
-    CBSTATUS_DEPTH_BOUNDS_SET                = 0x00000008,   // Depth bounds state object has been set
-    CBSTATUS_STENCIL_READ_MASK_SET           = 0x00000010,   // Stencil read mask has been set
-    CBSTATUS_STENCIL_WRITE_MASK_SET          = 0x00000020,   // Stencil write mask has been set
-    CBSTATUS_STENCIL_REFERENCE_SET           = 0x00000040,   // Stencil reference has been set
-    CBSTATUS_VIEWPORT_SET                    = 0x00000080,
-    CBSTATUS_SCISSOR_SET                     = 0x00000100,
-    CBSTATUS_INDEX_BUFFER_BOUND              = 0x00000200,   // Index buffer has been set
-    CBSTATUS_EXCLUSIVE_SCISSOR_SET           = 0x00000400,
-    CBSTATUS_SHADING_RATE_PALETTE_SET        = 0x00000800,
-    CBSTATUS_LINE_STIPPLE_SET                = 0x00001000,
-    CBSTATUS_VIEWPORT_W_SCALING_SET          = 0x00002000,
-    CBSTATUS_CULL_MODE_SET                   = 0x00004000,
-    CBSTATUS_FRONT_FACE_SET                  = 0x00008000,
-    CBSTATUS_PRIMITIVE_TOPOLOGY_SET          = 0x00010000,
-    CBSTATUS_VIEWPORT_WITH_COUNT_SET         = 0x00020000,
-    CBSTATUS_SCISSOR_WITH_COUNT_SET          = 0x00040000,
-    CBSTATUS_VERTEX_INPUT_BINDING_STRIDE_SET = 0x00080000,
-    CBSTATUS_DEPTH_TEST_ENABLE_SET           = 0x00100000,
-    CBSTATUS_DEPTH_WRITE_ENABLE_SET          = 0x00200000,
-    CBSTATUS_DEPTH_COMPARE_OP_SET            = 0x00400000,
-    CBSTATUS_DEPTH_BOUNDS_TEST_ENABLE_SET    = 0x00800000,
-    CBSTATUS_STENCIL_TEST_ENABLE_SET         = 0x01000000,
-    CBSTATUS_STENCIL_OP_SET                  = 0x02000000,
-    CBSTATUS_DISCARD_RECTANGLE_SET           = 0x04000000,
-    CBSTATUS_SAMPLE_LOCATIONS_SET            = 0x08000000,
-    CBSTATUS_COARSE_SAMPLE_ORDER_SET         = 0x10000000,
-    CBSTATUS_PATCH_CONTROL_POINTS_SET        = 0x20000000,
-    CBSTATUS_RASTERIZER_DISCARD_ENABLE_SET   = 0x40000000,
-    CBSTATUS_DEPTH_BIAS_ENABLE_SET           = 0x80000000,
-    CBSTATUS_LOGIC_OP_SET                    = 0x100000000,
-    CBSTATUS_PRIMITIVE_RESTART_ENABLE_SET    = 0x200000000,
-    CBSTATUS_VERTEX_INPUT_SET                = 0x400000000,
-    CBSTATUS_COLOR_WRITE_ENABLE_SET          = 0x800000000,
-    CBSTATUS_ALL_STATE_SET                   = 0xFFFFFFDFF,   // All state set (intentionally exclude index buffer)
+    CB_DRAW_DIRTY_NONE             = 0x00000000,
+    CB_DRAW_DIRTY_PIPELINE         = 0x00000001,
+    CB_DRAW_DIRTY_DESCRIPTOR_SETS  = 0x00000002,
+    CB_DRAW_DIRTY_DYNAMIC_STATE    = 0x00000004,
+    CB_DRAW_DIRTY_VERTEX_INDEX     = 0x00000008,  // Vertex and index buffer bindings
+    CB_DRAW_DIRTY_PUSH_CONSTANTS   = 0x00000010,
+    CB_DRAW_DIRTY_RENDER_PASS      = 0x00000020,  // Render pass instance, subpass and active queries
+    CB_DRAW_DIRTY_ALL              = 0x0000003F,
     // clang-format on
 };
 
-VkDynamicState ConvertToDynamicState(CBStatusFlagBits flag);
-CBStatusFlagBits ConvertToCBStatusFlagBits(VkDynamicState state);
-std::string DynamicStateString(CBStatusFlags input_value);
 
 struct BufferBinding {
     std::shared_ptr<BUFFER_STATE> buffer_state;
@@ -166,15 +174,42 @@ struct IndexBufferBinding : BufferBinding {
 
 struct CBVertexBufferBindingInfo {
     std::vector<BufferBinding> vertex_buffer_bindings;
+    // Bit b set if binding b, one of the first 64, has no buffer
+    uint64_t null_bindings = 0;
+
+    void UpdateNullBindings() {
+        null_bindings = 0;
+        const size_t count = std::min(vertex_buffer_bindings.size(), size_t(64));
+        for (size_t binding = 0; binding < count; ++binding) {
+            if (!vertex_buffer_bindings[binding].buffer_state) {
+                null_bindings |= 1ull << binding;
+            }
+        }
+    }
+    void clear() {
+        vertex_buffer_bindings.clear();
+        null_bindings = 0;
+    }
 };
 
 typedef layer_data::unordered_map<const IMAGE_STATE *, std::shared_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
 
-typedef layer_data::unordered_map<const GlobalImageLayoutRangeMap *, std::shared_ptr<ImageSubresourceLayoutMap>>
+typedef layer_data::unordered_map<const GlobalImageLayoutState *, std::shared_ptr<ImageSubresourceLayoutMap>>
     CommandBufferAliasedLayoutMap;
 
+// An image with layout state in a command buffer, see CMD_BUFFER_STATE::GetImageLayoutSummary()
+struct ImageLayoutSummaryEntry {
+    const IMAGE_STATE *image;
+    std::shared_ptr<ImageSubresourceLayoutMap> layout_map;
+    // Set if the command buffer leaves every subresource of the image in the same layout state
+    const ImageSubresourceLayoutMap::LayoutEntry *uniform_layout;
+};
+
 class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
   public:
+    // Storage for the per-recording containers below that are declared with arena types. Reset() releases them and rewinds
+    // the arena, so re-recording a command buffer reuses the same memory instead of going back to the heap.
+    MonotonicArena arena;
     VkCommandBufferAllocateInfo createInfo = {};
     VkCommandBufferBeginInfo beginInfo;
     VkCommandBufferInheritanceInfo inheritanceInfo;
@@ -203,6 +238,17 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // Store last bound state for Gfx & Compute pipeline bind points
     std::array<LAST_BOUND_STATE, BindPoint_Count> lastBound;  // index is LvlBindPoint.
 
+    // Groups of draw time checks which are skipped while their inputs stay the same
+    enum DrawCheckGroup {
+        kDrawCheckDescriptorSetLayouts,  // Bound sets against the pipeline layout
+        kDrawCheckGraphicsState,         // Dynamic state, buffers and render pass against the graphics pipeline
+        kDrawCheckPushConstants,
+        kDrawCheckGroupCount,
+    };
+    // For each bind point and group, the command the group last ran for without logging anything, or CMD_NONE. It is written
+    // during validation, which the external synchronization of command buffers makes safe.
+    mutable std::array<std::array<CMD_TYPE, kDrawCheckGroupCount>, BindPoint_Count> clean_draw_checks;
+
     struct CmdDrawDispatchInfo {
         CMD_TYPE cmd_type;
         std::vector<std::pair<const uint32_t, DescriptorRequirement>> binding_infos;
@@ -214,7 +260,7 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
 
     // If VK_NV_inherited_viewport_scissor is enabled and VkCommandBufferInheritanceViewportScissorInfoNV::viewportScissor2D is
     // true, then is the nonempty list of viewports passed in pViewportDepths. Otherwise, this is empty.
-    std::vector<VkViewport> inheritedViewportDepths;
+    ArenaVector<VkViewport> inheritedViewportDepths;
 
     // For each draw command D recorded to this command buffer, let
     //  * g_D be the graphics pipeline used
@@ -254,7 +300,11 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     std::shared_ptr<RENDER_PASS_STATE> activeRenderPass;
     std::shared_ptr<std::vector<SUBPASS_INFO>> active_subpasses;
     std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> active_attachments;
-    std::set<std::shared_ptr<IMAGE_VIEW_STATE>> attachments_view_states;
+    ArenaSet<std::shared_ptr<IMAGE_VIEW_STATE>> attachments_view_states;
+    // The active_attachments of the last dynamic rendering scope and the views they point to, reused by the next scope
+    // rather than allocated and inserted into attachments_view_states for each vkCmdBeginRendering
+    std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> rendering_attachments;
+    std::vector<std::shared_ptr<IMAGE_VIEW_STATE>> rendering_attachment_view_states;
 
     VkSubpassContents activeSubpassContents;
     uint32_t active_render_pass_device_mask;
@@ -269,15 +319,19 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     QFOTransferBarrierSets<QFOBufferTransferBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<QFOImageTransferBarrier> qfo_transfer_image_barriers;
 
-    layer_data::unordered_set<VkEvent> waitedEvents;
-    std::vector<VkEvent> writeEventsBeforeWait;
-    std::vector<VkEvent> events;
+    // The events the command buffer uses, by event ID
+    ArenaVector<CommandBufferEvent> event_table;
+    layer_data::unordered_map<VkEvent, uint32_t> event_ids;
+    // The event IDs of each vkCmdWaitEvents, in recording order
+    ArenaVector<uint32_t> wait_event_ids;
     layer_data::unordered_set<QueryObject> activeQueries;
     layer_data::unordered_set<QueryObject> startedQueries;
     layer_data::unordered_set<QueryObject> resetQueries;
     layer_data::unordered_set<QueryObject> updatedQueries;
     CommandBufferImageLayoutMap image_layout_map;
     CommandBufferAliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
+    std::vector<ImageLayoutSummaryEntry> image_layout_summary;
+    bool image_layout_summary_valid = false;
 
     CBVertexBufferBindingInfo current_vertex_buffer_binding_info;
     bool vertex_buffer_used;  // Track for perf warning to make sure any bound vtx buffer used
@@ -288,15 +342,22 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // Validation functions run at primary CB queue submit time
     using QueueCallback = std::function<bool(const ValidationStateTracker &device_data, const class QUEUE_STATE &queue_state,
                                              const CMD_BUFFER_STATE &cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
+    using QueueCallbacks = ArenaVector<QueueCallback>;
+    QueueCallbacks queue_submit_functions;
     // Used by some layers to defer actions until vkCmdEndRenderPass time.
     // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    QueueCallbacks queue_submit_functions_after_render_pass;
     // Validation functions run when secondary CB is executed in primary
-    std::vector<std::function<bool(const CMD_BUFFER_STATE &secondary, const CMD_BUFFER_STATE *primary, const FRAMEBUFFER_STATE *)>>
+    ArenaVector<std::function<bool(const CMD_BUFFER_STATE &secondary, const CMD_BUFFER_STATE *primary, const FRAMEBUFFER_STATE *)>>
         cmd_execute_commands_functions;
-    std::vector<std::function<bool(CMD_BUFFER_STATE &cb, bool do_validate, EventToStageMap *localEventToStageMap)>> eventUpdates;
-    std::vector<std::function<bool(const ValidationStateTracker *device_data, bool do_validate, VkQueryPool &firstPerfQueryPool,
+    // Validation functions recorded while deferred command validation is enabled, run at vkEndCommandBuffer time
+    std::vector<std::function<bool(const CMD_BUFFER_STATE &cb_state)>> deferred_validate_functions;
+    // With command buffer fingerprinting, the hash of the commands of deferred_validate_functions and of the buffers they use,
+    // and those buffers, whose bound memory is hashed in at vkEndCommandBuffer. The functions keep the buffers alive.
+    size_t deferred_validate_fingerprint = 0;
+    std::vector<const BUFFER_STATE *> deferred_validate_buffers;
+    std::vector<EventUpdate> eventUpdates;
+    ArenaVector<std::function<bool(const ValidationStateTracker *device_data, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                    uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
         queryUpdates;
     layer_data::unordered_set<const cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
@@ -310,11 +371,12 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // Cache of current insert label...
     LoggingLabel debug_label;
 
+    // Sized to the push constant ranges of push_constant_data_ranges
     std::vector<uint8_t> push_constant_data;
     PushConstantRangesId push_constant_data_ranges;
 
-    std::map<VkShaderStageFlagBits, std::vector<uint8_t>>
-        push_constant_data_update;  // vector's value is enum PushConstantByteState.
+    // By byte of push_constant_data, the stages vkCmdPushConstants has updated it for
+    std::vector<VkShaderStageFlags> push_constant_data_update;
     VkPipelineLayout push_constant_pipeline_layout_set;
 
     // Used for Best Practices tracking
@@ -364,6 +426,9 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const IMAGE_STATE &image_state) const;
     ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const IMAGE_STATE &image_state);
     const CommandBufferImageLayoutMap& GetImageSubresourceLayoutMap() const;
+    // The images with layout state, sorted by image. Built once at vkEndCommandBuffer so that submit time validation walks a
+    // flat array, command buffers that were not ended get theirs built into scratch.
+    const std::vector<ImageLayoutSummaryEntry> &GetImageLayoutSummary(std::vector<ImageLayoutSummaryEntry> &scratch) const;
 
     const QFOTransferBarrierSets<QFOImageTransferBarrier> &GetQFOBarrierSets(const QFOImageTransferBarrier &type_tag) const {
         return qfo_transfer_image_barriers;
@@ -381,13 +446,16 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
         return qfo_transfer_buffer_barriers;
     }
 
+    // Whether any queue family ownership transfer is recorded, so that submit time QFO validation can skip the others
+    bool HasQFOTransfers() const { return !qfo_transfer_image_barriers.Empty() || !qfo_transfer_buffer_barriers.Empty(); }
+
     PIPELINE_STATE *GetCurrentPipeline(VkPipelineBindPoint pipelineBindPoint) const {
         const auto lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
         return lastBound[lv_bind_point].pipeline_state;
     }
 
     void GetCurrentPipelineAndDesriptorSets(VkPipelineBindPoint pipelineBindPoint, const PIPELINE_STATE **rtn_pipe,
-                                            const std::vector<LAST_BOUND_STATE::PER_SET> **rtn_sets) const {
+                                            const LAST_BOUND_STATE::PerSets **rtn_sets) const {
         const auto lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
         const auto &last_bound_it = lastBound[lv_bind_point];
         if (!last_bound_it.IsUsing()) {
@@ -413,6 +481,8 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     void Begin(const VkCommandBufferBeginInfo *pBeginInfo);
     void End(VkResult result);
 
+    size_t DynamicMemoryUsage() const override;
+
     void BeginQuery(const QueryObject &query_obj);
     void EndQuery(const QueryObject &query_obj);
     void EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount);
@@ -439,9 +509,18 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     void UpdateDrawState(CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point);
 
     virtual void RecordCmd(CMD_TYPE cmd_type);
+    void DirtyDrawChecks(CBDrawDirtyFlags inputs);
+    bool IsDrawCheckClean(LvlBindPoint bind_point, DrawCheckGroup group, CMD_TYPE cmd_type) const {
+        return clean_draw_checks[bind_point][group] == cmd_type;
+    }
+    void SetDrawCheckClean(LvlBindPoint bind_point, DrawCheckGroup group, CMD_TYPE cmd_type) const {
+        clean_draw_checks[bind_point][group] = cmd_type;
+    }
     void RecordStateCmd(CMD_TYPE cmd_type, CBStatusFlags state_bits);
     void RecordColorWriteEnableStateCmd(CMD_TYPE cmd_type, CBStatusFlags state_bits, uint32_t attachment_count);
     void RecordTransferCmd(CMD_TYPE cmd_type, std::shared_ptr<BINDABLE> &&buf1, std::shared_ptr<BINDABLE> &&buf2 = nullptr);
+    // Adds the event to event_table if it is new to the command buffer
+    uint32_t GetEventId(VkEvent event);
     void RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask);
     void RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask);
     virtual void RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent *pEvents,
@@ -487,8 +566,11 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
 
   protected:
     void NotifyInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink) override;
+    void NotifyInvalidateBatch(const std::vector<PendingInvalidate> &notifications) override;
+    void RecordInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink);
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
     void UnbindResources();
+    void BuildImageLayoutSummary(std::vector<ImageLayoutSummaryEntry> &summary) const;
 };
 
 // specializations for barriers that cannot do queue family ownership transfers
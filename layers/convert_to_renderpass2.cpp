@@ -20,107 +20,114 @@
 
 #include "convert_to_renderpass2.h"
 
-#include <vector>
-
 #include "vk_format_utils.h"
 #include "vk_typemap_helper.h"
 
-static safe_VkAttachmentDescription2 ToV2KHR(const VkAttachmentDescription& in_struct) {
-    safe_VkAttachmentDescription2 v2;
-    v2.sType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
-    v2.pNext = nullptr;
-    v2.flags = in_struct.flags;
-    v2.format = in_struct.format;
-    v2.samples = in_struct.samples;
-    v2.loadOp = in_struct.loadOp;
-    v2.storeOp = in_struct.storeOp;
-    v2.stencilLoadOp = in_struct.stencilLoadOp;
-    v2.stencilStoreOp = in_struct.stencilStoreOp;
-    v2.initialLayout = in_struct.initialLayout;
-    v2.finalLayout = in_struct.finalLayout;
-
-    return v2;
+// The conversions fill the safe structs of out_struct in place, so that no member is deep copied from a temporary
+
+static void ToV2KHR(const VkAttachmentDescription& in_struct, safe_VkAttachmentDescription2* v2) {
+    v2->sType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
+    v2->pNext = nullptr;
+    v2->flags = in_struct.flags;
+    v2->format = in_struct.format;
+    v2->samples = in_struct.samples;
+    v2->loadOp = in_struct.loadOp;
+    v2->storeOp = in_struct.storeOp;
+    v2->stencilLoadOp = in_struct.stencilLoadOp;
+    v2->stencilStoreOp = in_struct.stencilStoreOp;
+    v2->initialLayout = in_struct.initialLayout;
+    v2->finalLayout = in_struct.finalLayout;
 }
 
-static safe_VkAttachmentReference2 ToV2KHR(const VkAttachmentReference& in_struct, const VkImageAspectFlags aspectMask = 0) {
-    safe_VkAttachmentReference2 v2;
-    v2.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
-    v2.pNext = nullptr;
-    v2.attachment = in_struct.attachment;
-    v2.layout = in_struct.layout;
-    v2.aspectMask = aspectMask;
+static void ToV2KHR(const VkAttachmentReference& in_struct, safe_VkAttachmentReference2* v2,
+                    const VkImageAspectFlags aspectMask = 0) {
+    v2->sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
+    v2->pNext = nullptr;
+    v2->attachment = in_struct.attachment;
+    v2->layout = in_struct.layout;
+    v2->aspectMask = aspectMask;
+}
 
-    return v2;
+// The aspects of an input attachment of format, unless VkRenderPassInputAttachmentAspectCreateInfo gives them
+static VkImageAspectFlags DefaultInputAttachmentAspectMask(VkFormat format) {
+    VkImageAspectFlags aspect_mask = 0;
+    if (FormatIsColor(format)) aspect_mask |= VK_IMAGE_ASPECT_COLOR_BIT;
+    if (FormatHasDepth(format)) aspect_mask |= VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (FormatHasStencil(format)) aspect_mask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    if (FormatPlaneCount(format) > 1) {
+        aspect_mask |= VK_IMAGE_ASPECT_PLANE_0_BIT;
+        aspect_mask |= VK_IMAGE_ASPECT_PLANE_1_BIT;
+    }
+    if (FormatPlaneCount(format) > 2) aspect_mask |= VK_IMAGE_ASPECT_PLANE_2_BIT;
+    return aspect_mask;
 }
 
-static safe_VkSubpassDescription2 ToV2KHR(const VkSubpassDescription& in_struct, const uint32_t viewMask,
-                                          const VkImageAspectFlags* input_attachment_aspect_masks) {
-    safe_VkSubpassDescription2 v2;
-    v2.sType = VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2;
-    v2.pNext = nullptr;
-    v2.flags = in_struct.flags;
-    v2.pipelineBindPoint = in_struct.pipelineBindPoint;
-    v2.viewMask = viewMask;
-    v2.inputAttachmentCount = in_struct.inputAttachmentCount;
-    v2.pInputAttachments = nullptr;  // to be filled
-    v2.colorAttachmentCount = in_struct.colorAttachmentCount;
-    v2.pColorAttachments = nullptr;        // to be filled
-    v2.pResolveAttachments = nullptr;      // to be filled
-    v2.pDepthStencilAttachment = nullptr;  // to be filled
-    v2.preserveAttachmentCount = in_struct.preserveAttachmentCount;
-    v2.pPreserveAttachments = nullptr;  // to be filled
-
-    if (v2.inputAttachmentCount && in_struct.pInputAttachments) {
-        v2.pInputAttachments = new safe_VkAttachmentReference2[v2.inputAttachmentCount];
-        for (uint32_t i = 0; i < v2.inputAttachmentCount; ++i) {
-            v2.pInputAttachments[i] = ToV2KHR(in_struct.pInputAttachments[i], input_attachment_aspect_masks[i]);
+static void ToV2KHR(const VkSubpassDescription& in_struct, const uint32_t viewMask, const safe_VkRenderPassCreateInfo2& render_pass,
+                    safe_VkSubpassDescription2* v2) {
+    v2->sType = VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2;
+    v2->pNext = nullptr;
+    v2->flags = in_struct.flags;
+    v2->pipelineBindPoint = in_struct.pipelineBindPoint;
+    v2->viewMask = viewMask;
+    v2->inputAttachmentCount = in_struct.inputAttachmentCount;
+    v2->pInputAttachments = nullptr;  // to be filled
+    v2->colorAttachmentCount = in_struct.colorAttachmentCount;
+    v2->pColorAttachments = nullptr;        // to be filled
+    v2->pResolveAttachments = nullptr;      // to be filled
+    v2->pDepthStencilAttachment = nullptr;  // to be filled
+    v2->preserveAttachmentCount = in_struct.preserveAttachmentCount;
+    v2->pPreserveAttachments = nullptr;  // to be filled
+
+    if (v2->inputAttachmentCount && in_struct.pInputAttachments) {
+        v2->pInputAttachments = new safe_VkAttachmentReference2[v2->inputAttachmentCount];
+        for (uint32_t i = 0; i < v2->inputAttachmentCount; ++i) {
+            const auto& input_attachment = in_struct.pInputAttachments[i];
+            VkImageAspectFlags aspect_mask = 0;
+            if (render_pass.pAttachments && input_attachment.attachment < render_pass.attachmentCount) {
+                aspect_mask = DefaultInputAttachmentAspectMask(render_pass.pAttachments[input_attachment.attachment].format);
+            }
+            ToV2KHR(input_attachment, &v2->pInputAttachments[i], aspect_mask);
         }
     }
-    if (v2.colorAttachmentCount && in_struct.pColorAttachments) {
-        v2.pColorAttachments = new safe_VkAttachmentReference2[v2.colorAttachmentCount];
-        for (uint32_t i = 0; i < v2.colorAttachmentCount; ++i) {
-            v2.pColorAttachments[i] = ToV2KHR(in_struct.pColorAttachments[i]);
+    if (v2->colorAttachmentCount && in_struct.pColorAttachments) {
+        v2->pColorAttachments = new safe_VkAttachmentReference2[v2->colorAttachmentCount];
+        for (uint32_t i = 0; i < v2->colorAttachmentCount; ++i) {
+            ToV2KHR(in_struct.pColorAttachments[i], &v2->pColorAttachments[i]);
         }
     }
-    if (v2.colorAttachmentCount && in_struct.pResolveAttachments) {
-        v2.pResolveAttachments = new safe_VkAttachmentReference2[v2.colorAttachmentCount];
-        for (uint32_t i = 0; i < v2.colorAttachmentCount; ++i) {
-            v2.pResolveAttachments[i] = ToV2KHR(in_struct.pResolveAttachments[i]);
+    if (v2->colorAttachmentCount && in_struct.pResolveAttachments) {
+        v2->pResolveAttachments = new safe_VkAttachmentReference2[v2->colorAttachmentCount];
+        for (uint32_t i = 0; i < v2->colorAttachmentCount; ++i) {
+            ToV2KHR(in_struct.pResolveAttachments[i], &v2->pResolveAttachments[i]);
         }
     }
     if (in_struct.pDepthStencilAttachment) {
-        v2.pDepthStencilAttachment = new safe_VkAttachmentReference2();
-        *v2.pDepthStencilAttachment = ToV2KHR(*in_struct.pDepthStencilAttachment);
+        v2->pDepthStencilAttachment = new safe_VkAttachmentReference2();
+        ToV2KHR(*in_struct.pDepthStencilAttachment, v2->pDepthStencilAttachment);
     }
-    if (v2.preserveAttachmentCount && in_struct.pPreserveAttachments) {
-        auto preserve_attachments = new uint32_t[v2.preserveAttachmentCount];
-        for (uint32_t i = 0; i < v2.preserveAttachmentCount; ++i) {
+    if (v2->preserveAttachmentCount && in_struct.pPreserveAttachments) {
+        auto preserve_attachments = new uint32_t[v2->preserveAttachmentCount];
+        for (uint32_t i = 0; i < v2->preserveAttachmentCount; ++i) {
             preserve_attachments[i] = in_struct.pPreserveAttachments[i];
         }
-        v2.pPreserveAttachments = preserve_attachments;
+        v2->pPreserveAttachments = preserve_attachments;
     }
-
-    return v2;
 }
 
-static safe_VkSubpassDependency2 ToV2KHR(const VkSubpassDependency& in_struct, int32_t viewOffset = 0) {
-    safe_VkSubpassDependency2 v2;
-    v2.sType = VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2;
-    v2.pNext = nullptr;
-    v2.srcSubpass = in_struct.srcSubpass;
-    v2.dstSubpass = in_struct.dstSubpass;
-    v2.srcStageMask = in_struct.srcStageMask;
-    v2.dstStageMask = in_struct.dstStageMask;
-    v2.srcAccessMask = in_struct.srcAccessMask;
-    v2.dstAccessMask = in_struct.dstAccessMask;
-    v2.dependencyFlags = in_struct.dependencyFlags;
-    v2.viewOffset = viewOffset;
-
-    return v2;
+static void ToV2KHR(const VkSubpassDependency& in_struct, safe_VkSubpassDependency2* v2, int32_t viewOffset = 0) {
+    v2->sType = VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2;
+    v2->pNext = nullptr;
+    v2->srcSubpass = in_struct.srcSubpass;
+    v2->dstSubpass = in_struct.dstSubpass;
+    v2->srcStageMask = in_struct.srcStageMask;
+    v2->dstStageMask = in_struct.dstStageMask;
+    v2->srcAccessMask = in_struct.srcAccessMask;
+    v2->dstAccessMask = in_struct.dstAccessMask;
+    v2->dependencyFlags = in_struct.dependencyFlags;
+    v2->viewOffset = viewOffset;
 }
 
 void ConvertVkRenderPassCreateInfoToV2KHR(const VkRenderPassCreateInfo& in_struct, safe_VkRenderPassCreateInfo2* out_struct) {
-    using std::vector;
     const auto multiview_info = LvlFindInChain<VkRenderPassMultiviewCreateInfo>(in_struct.pNext);
     const auto* input_attachment_aspect_info = LvlFindInChain<VkRenderPassInputAttachmentAspectCreateInfo>(in_struct.pNext);
     const auto fragment_density_map_info = LvlFindInChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(in_struct.pNext);
@@ -153,65 +160,42 @@ void ConvertVkRenderPassCreateInfoToV2KHR(const VkRenderPassCreateInfo& in_struc
     if (out_struct->attachmentCount && in_struct.pAttachments) {
         out_struct->pAttachments = new safe_VkAttachmentDescription2[out_struct->attachmentCount];
         for (uint32_t i = 0; i < out_struct->attachmentCount; ++i) {
-            out_struct->pAttachments[i] = ToV2KHR(in_struct.pAttachments[i]);
+            ToV2KHR(in_struct.pAttachments[i], &out_struct->pAttachments[i]);
         }
     }
 
-    // translate VkRenderPassInputAttachmentAspectCreateInfo into vector
-    vector<vector<VkImageAspectFlags>> input_attachment_aspect_masks(out_struct->subpassCount);
-    // set defaults
-    for (uint32_t si = 0; si < out_struct->subpassCount; ++si) {
-        if (in_struct.pSubpasses) {
-            input_attachment_aspect_masks[si].resize(in_struct.pSubpasses[si].inputAttachmentCount, 0);
-
-            for (uint32_t iai = 0; iai < in_struct.pSubpasses[si].inputAttachmentCount; ++iai) {
-                if (out_struct->pAttachments && in_struct.pSubpasses[si].pInputAttachments) {
-                    const auto& input_attachment = in_struct.pSubpasses[si].pInputAttachments[iai];
-                    if (input_attachment.attachment != VK_ATTACHMENT_UNUSED) {
-                        const auto format = out_struct->pAttachments[input_attachment.attachment].format;
-
-                        if (FormatIsColor(format)) input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_COLOR_BIT;
-                        if (FormatHasDepth(format)) input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_DEPTH_BIT;
-                        if (FormatHasStencil(format)) input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_STENCIL_BIT;
-                        if (FormatPlaneCount(format) > 1) {
-                            input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_PLANE_0_BIT;
-                            input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_PLANE_1_BIT;
-                        }
-                        if (FormatPlaneCount(format) > 2) input_attachment_aspect_masks[si][iai] |= VK_IMAGE_ASPECT_PLANE_2_BIT;
-                    }
-                }
-            }
+    // Input attachments get the aspects of their format, see DefaultInputAttachmentAspectMask()
+    const bool has_view_mask = multiview_info && multiview_info->subpassCount && multiview_info->pViewMasks;
+    if (out_struct->subpassCount && in_struct.pSubpasses) {
+        out_struct->pSubpasses = new safe_VkSubpassDescription2[out_struct->subpassCount];
+        for (uint32_t i = 0; i < out_struct->subpassCount; ++i) {
+            const uint32_t view_mask = has_view_mask ? multiview_info->pViewMasks[i] : 0;
+            ToV2KHR(in_struct.pSubpasses[i], view_mask, *out_struct, &out_struct->pSubpasses[i]);
         }
     }
-    // translate VkRenderPassInputAttachmentAspectCreateInfo
-    if (input_attachment_aspect_info && input_attachment_aspect_info->pAspectReferences) {
+
+    // translate VkRenderPassInputAttachmentAspectCreateInfo, overriding the aspects of the format
+    if (out_struct->pSubpasses && input_attachment_aspect_info && input_attachment_aspect_info->pAspectReferences) {
         for (uint32_t i = 0; i < input_attachment_aspect_info->aspectReferenceCount; ++i) {
             const uint32_t subpass = input_attachment_aspect_info->pAspectReferences[i].subpass;
             const uint32_t input_attachment = input_attachment_aspect_info->pAspectReferences[i].inputAttachmentIndex;
             const VkImageAspectFlags aspect_mask = input_attachment_aspect_info->pAspectReferences[i].aspectMask;
 
-            if (subpass < input_attachment_aspect_masks.size() &&
-                input_attachment < input_attachment_aspect_masks[subpass].size()) {
-                input_attachment_aspect_masks[subpass][input_attachment] = aspect_mask;
+            if (subpass < out_struct->subpassCount) {
+                auto& subpass_desc = out_struct->pSubpasses[subpass];
+                if (subpass_desc.pInputAttachments && input_attachment < subpass_desc.inputAttachmentCount) {
+                    subpass_desc.pInputAttachments[input_attachment].aspectMask = aspect_mask;
+                }
             }
         }
     }
 
-    const bool has_view_mask = multiview_info && multiview_info->subpassCount && multiview_info->pViewMasks;
-    if (out_struct->subpassCount && in_struct.pSubpasses) {
-        out_struct->pSubpasses = new safe_VkSubpassDescription2[out_struct->subpassCount];
-        for (uint32_t i = 0; i < out_struct->subpassCount; ++i) {
-            const uint32_t view_mask = has_view_mask ? multiview_info->pViewMasks[i] : 0;
-            out_struct->pSubpasses[i] = ToV2KHR(in_struct.pSubpasses[i], view_mask, input_attachment_aspect_masks[i].data());
-        }
-    }
-
     const bool has_view_offset = multiview_info && multiview_info->dependencyCount && multiview_info->pViewOffsets;
     if (out_struct->dependencyCount && in_struct.pDependencies) {
         out_struct->pDependencies = new safe_VkSubpassDependency2[out_struct->dependencyCount];
         for (uint32_t i = 0; i < out_struct->dependencyCount; ++i) {
             const int32_t view_offset = has_view_offset ? multiview_info->pViewOffsets[i] : 0;
-            out_struct->pDependencies[i] = ToV2KHR(in_struct.pDependencies[i], view_offset);
+            ToV2KHR(in_struct.pDependencies[i], &out_struct->pDependencies[i], view_offset);
         }
     }
 
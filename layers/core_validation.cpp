@@ -72,6 +72,8 @@
 #include "buffer_validation.h"
 #include "shader_validation.h"
 #include "vk_layer_utils.h"
+#include "hook_timing.h"
+#include "layer_trace.h"
 #include "sync_utils.h"
 #include "sync_vuid_maps.h"
 
@@ -382,80 +384,55 @@ bool CoreChecks::ValidateStatus(const CMD_BUFFER_STATE *pNode, CBStatusFlags sta
 
 // Return true if for a given PSO, the given state enum is dynamic, else return false
 bool CoreChecks::IsDynamic(const PIPELINE_STATE *pPipeline, const VkDynamicState state) const {
-    const auto *dynamic_state = pPipeline->DynamicState();
-    if (pPipeline && (pPipeline->GetPipelineType() == VK_PIPELINE_BIND_POINT_GRAPHICS) && dynamic_state) {
-        for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; i++) {
-            if (state == dynamic_state->pDynamicStates[i]) return true;
-        }
-    }
-    return false;
+    return pPipeline && pPipeline->IsDynamic(state);
 }
 
 // Validate state stored as flags at time of draw call
 bool CoreChecks::ValidateDrawStateFlags(const CMD_BUFFER_STATE *pCB, const PIPELINE_STATE *pPipe, bool indexed,
                                         const char *msg_code) const {
-    bool result = false;
-    if (pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_LIST ||
-        pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP) {
-        result |=
-            ValidateStatus(pCB, CBSTATUS_LINE_WIDTH_SET, "Dynamic line width state not set for this command buffer", msg_code);
-    }
-    const auto rp_state = pPipe->RasterizationState();
-    if (rp_state && (rp_state->depthBiasEnable == VK_TRUE)) {
-        result |=
-            ValidateStatus(pCB, CBSTATUS_DEPTH_BIAS_SET, "Dynamic depth bias state not set for this command buffer", msg_code);
-    }
-    if (pPipe->BlendConstantsEnabled()) {
-        result |= ValidateStatus(pCB, CBSTATUS_BLEND_CONSTANTS_SET, "Dynamic blend constants state not set for this command buffer",
-                                 msg_code);
-    }
-
-    const auto ds_state = pPipe->DepthStencilState();
-    if (ds_state && (ds_state->depthBoundsTestEnable == VK_TRUE)) {
-        result |=
-            ValidateStatus(pCB, CBSTATUS_DEPTH_BOUNDS_SET, "Dynamic depth bounds state not set for this command buffer", msg_code);
-    }
-    if (ds_state && (ds_state->stencilTestEnable == VK_TRUE)) {
-        result |= ValidateStatus(pCB, CBSTATUS_STENCIL_READ_MASK_SET,
-                                 "Dynamic stencil read mask state not set for this command buffer", msg_code);
-        result |= ValidateStatus(pCB, CBSTATUS_STENCIL_WRITE_MASK_SET,
-                                 "Dynamic stencil write mask state not set for this command buffer", msg_code);
-        result |= ValidateStatus(pCB, CBSTATUS_STENCIL_REFERENCE_SET,
-                                 "Dynamic stencil reference state not set for this command buffer", msg_code);
-    }
+    if (disabled[dynamic_state_validation]) return false;
+    CBStatusFlags required = pPipe->required_draw_status;
     if (indexed) {
-        result |= ValidateStatus(pCB, CBSTATUS_INDEX_BUFFER_BOUND,
-                                 "Index buffer object not bound to this command buffer when Indexed Draw attempted", msg_code);
+        required |= CBSTATUS_INDEX_BUFFER_BOUND;
     }
-    if (pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_LIST ||
-        pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP) {
-        const auto *line_state = LvlFindInChain<VkPipelineRasterizationLineStateCreateInfoEXT>(rp_state);
-        if (line_state && line_state->stippledLineEnable) {
-            result |= ValidateStatus(pCB, CBSTATUS_LINE_STIPPLE_SET, "Dynamic line stipple state not set for this command buffer",
-                                     msg_code);
-        }
+    if ((required & ~pCB->status) == CBSTATUS_NONE) {
+        return false;
     }
 
+    // In the order they are reported
+    static const struct {
+        CBStatusFlagBits status;
+        const char *message;
+    } kRequiredStatus[] = {
+        {CBSTATUS_LINE_WIDTH_SET, "Dynamic line width state not set for this command buffer"},
+        {CBSTATUS_DEPTH_BIAS_SET, "Dynamic depth bias state not set for this command buffer"},
+        {CBSTATUS_BLEND_CONSTANTS_SET, "Dynamic blend constants state not set for this command buffer"},
+        {CBSTATUS_DEPTH_BOUNDS_SET, "Dynamic depth bounds state not set for this command buffer"},
+        {CBSTATUS_STENCIL_READ_MASK_SET, "Dynamic stencil read mask state not set for this command buffer"},
+        {CBSTATUS_STENCIL_WRITE_MASK_SET, "Dynamic stencil write mask state not set for this command buffer"},
+        {CBSTATUS_STENCIL_REFERENCE_SET, "Dynamic stencil reference state not set for this command buffer"},
+        {CBSTATUS_INDEX_BUFFER_BOUND, "Index buffer object not bound to this command buffer when Indexed Draw attempted"},
+        {CBSTATUS_LINE_STIPPLE_SET, "Dynamic line stipple state not set for this command buffer"},
+    };
+    bool result = false;
+    for (const auto &entry : kRequiredStatus) {
+        if (required & entry.status) {
+            result |= ValidateStatus(pCB, entry.status, entry.message, msg_code);
+        }
+    }
     return result;
 }
 
-bool CoreChecks::LogInvalidAttachmentMessage(const char *type1_string, const RENDER_PASS_STATE *rp1_state, const char *type2_string,
-                                             const RENDER_PASS_STATE *rp2_state, uint32_t primary_attach, uint32_t secondary_attach,
-                                             const char *msg, const char *caller, const char *error_code) const {
-    LogObjectList objlist(rp1_state->renderPass());
-    objlist.add(rp2_state->renderPass());
-    return LogError(objlist, error_code,
-                    "%s: RenderPasses incompatible between %s w/ %s and %s w/ %s Attachment %u is not "
-                    "compatible with %u: %s.",
-                    caller, type1_string, report_data->FormatHandle(rp1_state->renderPass()).c_str(), type2_string,
-                    report_data->FormatHandle(rp2_state->renderPass()).c_str(), primary_attach, secondary_attach, msg);
+static void AddAttachmentIncompatibility(uint32_t primary_attach, uint32_t secondary_attach, const char *msg,
+                                         std::vector<std::string> &incompatibilities) {
+    std::stringstream ss;
+    ss << "Attachment " << primary_attach << " is not compatible with " << secondary_attach << ": " << msg;
+    incompatibilities.emplace_back(ss.str());
 }
 
-bool CoreChecks::ValidateAttachmentCompatibility(const char *type1_string, const RENDER_PASS_STATE *rp1_state,
-                                                 const char *type2_string, const RENDER_PASS_STATE *rp2_state,
-                                                 uint32_t primary_attach, uint32_t secondary_attach, const char *caller,
-                                                 const char *error_code) const {
-    bool skip = false;
+static void GetAttachmentIncompatibilities(const RENDER_PASS_STATE *rp1_state, const RENDER_PASS_STATE *rp2_state,
+                                           uint32_t primary_attach, uint32_t secondary_attach,
+                                           std::vector<std::string> &incompatibilities) {
     const auto &primary_pass_ci = rp1_state->createInfo;
     const auto &secondary_pass_ci = rp2_state->createInfo;
     if (primary_pass_ci.attachmentCount <= primary_attach) {
@@ -465,38 +442,31 @@ bool CoreChecks::ValidateAttachmentCompatibility(const char *type1_string, const
         secondary_attach = VK_ATTACHMENT_UNUSED;
     }
     if (primary_attach == VK_ATTACHMENT_UNUSED && secondary_attach == VK_ATTACHMENT_UNUSED) {
-        return skip;
+        return;
     }
     if (primary_attach == VK_ATTACHMENT_UNUSED) {
-        skip |= LogInvalidAttachmentMessage(type1_string, rp1_state, type2_string, rp2_state, primary_attach, secondary_attach,
-                                            "The first is unused while the second is not.", caller, error_code);
-        return skip;
+        AddAttachmentIncompatibility(primary_attach, secondary_attach, "The first is unused while the second is not.",
+                                     incompatibilities);
+        return;
     }
     if (secondary_attach == VK_ATTACHMENT_UNUSED) {
-        skip |= LogInvalidAttachmentMessage(type1_string, rp1_state, type2_string, rp2_state, primary_attach, secondary_attach,
-                                            "The second is unused while the first is not.", caller, error_code);
-        return skip;
+        AddAttachmentIncompatibility(primary_attach, secondary_attach, "The second is unused while the first is not.",
+                                     incompatibilities);
+        return;
     }
     if (primary_pass_ci.pAttachments[primary_attach].format != secondary_pass_ci.pAttachments[secondary_attach].format) {
-        skip |= LogInvalidAttachmentMessage(type1_string, rp1_state, type2_string, rp2_state, primary_attach, secondary_attach,
-                                            "They have different formats.", caller, error_code);
+        AddAttachmentIncompatibility(primary_attach, secondary_attach, "They have different formats.", incompatibilities);
     }
     if (primary_pass_ci.pAttachments[primary_attach].samples != secondary_pass_ci.pAttachments[secondary_attach].samples) {
-        skip |= LogInvalidAttachmentMessage(type1_string, rp1_state, type2_string, rp2_state, primary_attach, secondary_attach,
-                                            "They have different samples.", caller, error_code);
+        AddAttachmentIncompatibility(primary_attach, secondary_attach, "They have different samples.", incompatibilities);
     }
     if (primary_pass_ci.pAttachments[primary_attach].flags != secondary_pass_ci.pAttachments[secondary_attach].flags) {
-        skip |= LogInvalidAttachmentMessage(type1_string, rp1_state, type2_string, rp2_state, primary_attach, secondary_attach,
-                                            "They have different flags.", caller, error_code);
+        AddAttachmentIncompatibility(primary_attach, secondary_attach, "They have different flags.", incompatibilities);
     }
-
-    return skip;
 }
 
-bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RENDER_PASS_STATE *rp1_state,
-                                              const char *type2_string, const RENDER_PASS_STATE *rp2_state, const int subpass,
-                                              const char *caller, const char *error_code) const {
-    bool skip = false;
+static void GetSubpassIncompatibilities(const RENDER_PASS_STATE *rp1_state, const RENDER_PASS_STATE *rp2_state, const int subpass,
+                                        std::vector<std::string> &incompatibilities) {
     const auto &primary_desc = rp1_state->createInfo.pSubpasses[subpass];
     const auto &secondary_desc = rp2_state->createInfo.pSubpasses[subpass];
     uint32_t max_input_attachment_count = std::max(primary_desc.inputAttachmentCount, secondary_desc.inputAttachmentCount);
@@ -508,8 +478,7 @@ bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RE
         if (i < secondary_desc.inputAttachmentCount) {
             secondary_input_attach = secondary_desc.pInputAttachments[i].attachment;
         }
-        skip |= ValidateAttachmentCompatibility(type1_string, rp1_state, type2_string, rp2_state, primary_input_attach,
-                                                secondary_input_attach, caller, error_code);
+        GetAttachmentIncompatibilities(rp1_state, rp2_state, primary_input_attach, secondary_input_attach, incompatibilities);
     }
     uint32_t max_color_attachment_count = std::max(primary_desc.colorAttachmentCount, secondary_desc.colorAttachmentCount);
     for (uint32_t i = 0; i < max_color_attachment_count; ++i) {
@@ -520,8 +489,7 @@ bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RE
         if (i < secondary_desc.colorAttachmentCount) {
             secondary_color_attach = secondary_desc.pColorAttachments[i].attachment;
         }
-        skip |= ValidateAttachmentCompatibility(type1_string, rp1_state, type2_string, rp2_state, primary_color_attach,
-                                                secondary_color_attach, caller, error_code);
+        GetAttachmentIncompatibilities(rp1_state, rp2_state, primary_color_attach, secondary_color_attach, incompatibilities);
         if (rp1_state->createInfo.subpassCount > 1) {
             uint32_t primary_resolve_attach = VK_ATTACHMENT_UNUSED, secondary_resolve_attach = VK_ATTACHMENT_UNUSED;
             if (i < primary_desc.colorAttachmentCount && primary_desc.pResolveAttachments) {
@@ -530,8 +498,8 @@ bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RE
             if (i < secondary_desc.colorAttachmentCount && secondary_desc.pResolveAttachments) {
                 secondary_resolve_attach = secondary_desc.pResolveAttachments[i].attachment;
             }
-            skip |= ValidateAttachmentCompatibility(type1_string, rp1_state, type2_string, rp2_state, primary_resolve_attach,
-                                                    secondary_resolve_attach, caller, error_code);
+            GetAttachmentIncompatibilities(rp1_state, rp2_state, primary_resolve_attach, secondary_resolve_attach,
+                                           incompatibilities);
         }
     }
     uint32_t primary_depthstencil_attach = VK_ATTACHMENT_UNUSED, secondary_depthstencil_attach = VK_ATTACHMENT_UNUSED;
@@ -541,8 +509,8 @@ bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RE
     if (secondary_desc.pDepthStencilAttachment) {
         secondary_depthstencil_attach = secondary_desc.pDepthStencilAttachment[0].attachment;
     }
-    skip |= ValidateAttachmentCompatibility(type1_string, rp1_state, type2_string, rp2_state, primary_depthstencil_attach,
-                                            secondary_depthstencil_attach, caller, error_code);
+    GetAttachmentIncompatibilities(rp1_state, rp2_state, primary_depthstencil_attach, secondary_depthstencil_attach,
+                                   incompatibilities);
 
     // Both renderpasses must agree on Multiview usage
     if (primary_desc.viewMask && secondary_desc.viewMask) {
@@ -550,63 +518,36 @@ bool CoreChecks::ValidateSubpassCompatibility(const char *type1_string, const RE
             std::stringstream ss;
             ss << "For subpass " << subpass << ", they have a different viewMask. The first has view mask " << primary_desc.viewMask
                << " while the second has view mask " << secondary_desc.viewMask << ".";
-            skip |= LogInvalidPnextMessage(type1_string, rp1_state, type2_string, rp2_state, ss.str().c_str(), caller, error_code);
+            incompatibilities.emplace_back(ss.str());
         }
     } else if (primary_desc.viewMask) {
-        skip |= LogInvalidPnextMessage(type1_string, rp1_state, type2_string, rp2_state,
-                                       "The first uses Multiview (has non-zero viewMasks) while the second one does not.", caller,
-                                       error_code);
+        incompatibilities.emplace_back("The first uses Multiview (has non-zero viewMasks) while the second one does not.");
     } else if (secondary_desc.viewMask) {
-        skip |= LogInvalidPnextMessage(type1_string, rp1_state, type2_string, rp2_state,
-                                       "The second uses Multiview (has non-zero viewMasks) while the first one does not.", caller,
-                                       error_code);
+        incompatibilities.emplace_back("The second uses Multiview (has non-zero viewMasks) while the first one does not.");
     }
-
-    return skip;
-}
-
-bool CoreChecks::LogInvalidPnextMessage(const char *type1_string, const RENDER_PASS_STATE *rp1_state, const char *type2_string,
-                                        const RENDER_PASS_STATE *rp2_state, const char *msg, const char *caller,
-                                        const char *error_code) const {
-    LogObjectList objlist(rp1_state->renderPass());
-    objlist.add(rp2_state->renderPass());
-    return LogError(objlist, error_code, "%s: RenderPasses incompatible between %s w/ %s and %s w/ %s: %s", caller, type1_string,
-                    report_data->FormatHandle(rp1_state->renderPass()).c_str(), type2_string,
-                    report_data->FormatHandle(rp2_state->renderPass()).c_str(), msg);
 }
 
-// Verify that given renderPass CreateInfo for primary and secondary command buffers are compatible.
-//  This function deals directly with the CreateInfo, there are overloaded versions below that can take the renderPass handle and
-//  will then feed into this function
-bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const RENDER_PASS_STATE *rp1_state,
-                                                 const char *type2_string, const RENDER_PASS_STATE *rp2_state, const char *caller,
-                                                 const char *error_code) const {
-    bool skip = false;
+// The reasons rp1_state and rp2_state are incompatible, none if they are compatible
+static std::vector<std::string> GetRenderPassIncompatibilities(const RENDER_PASS_STATE *rp1_state,
+                                                               const RENDER_PASS_STATE *rp2_state) {
+    std::vector<std::string> incompatibilities;
 
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state->createInfo.flags != rp2_state->createInfo.flags) {
-        LogObjectList objlist(rp1_state->renderPass());
-        objlist.add(rp2_state->renderPass());
-        skip |=
-            LogError(objlist, error_code,
-                     "%s: RenderPasses incompatible between %s w/ %s with flags of %u and %s w/ "
-                     "%s with a flags of %u.",
-                     caller, type1_string, report_data->FormatHandle(rp1_state->renderPass()).c_str(), rp1_state->createInfo.flags,
-                     type2_string, report_data->FormatHandle(rp2_state->renderPass()).c_str(), rp2_state->createInfo.flags);
+        std::stringstream ss;
+        ss << "The first has flags of " << rp1_state->createInfo.flags << " while the second has flags of "
+           << rp2_state->createInfo.flags << ".";
+        incompatibilities.emplace_back(ss.str());
     }
 
     if (rp1_state->createInfo.subpassCount != rp2_state->createInfo.subpassCount) {
-        LogObjectList objlist(rp1_state->renderPass());
-        objlist.add(rp2_state->renderPass());
-        skip |= LogError(objlist, error_code,
-                         "%s: RenderPasses incompatible between %s w/ %s with a subpassCount of %u and %s w/ "
-                         "%s with a subpassCount of %u.",
-                         caller, type1_string, report_data->FormatHandle(rp1_state->renderPass()).c_str(),
-                         rp1_state->createInfo.subpassCount, type2_string, report_data->FormatHandle(rp2_state->renderPass()).c_str(),
-                         rp2_state->createInfo.subpassCount);
+        std::stringstream ss;
+        ss << "The first has a subpassCount of " << rp1_state->createInfo.subpassCount
+           << " while the second has a subpassCount of " << rp2_state->createInfo.subpassCount << ".";
+        incompatibilities.emplace_back(ss.str());
     } else {
         for (uint32_t i = 0; i < rp1_state->createInfo.subpassCount; ++i) {
-            skip |= ValidateSubpassCompatibility(type1_string, rp1_state, type2_string, rp2_state, i, caller, error_code);
+            GetSubpassIncompatibilities(rp1_state, rp2_state, i, incompatibilities);
         }
     }
 
@@ -618,14 +559,69 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
     if (fdm1 && fdm2) {
         uint32_t primary_input_attach = fdm1->fragmentDensityMapAttachment.attachment;
         uint32_t secondary_input_attach = fdm2->fragmentDensityMapAttachment.attachment;
-        skip |= ValidateAttachmentCompatibility(type1_string, rp1_state, type2_string, rp2_state, primary_input_attach,
-                                                secondary_input_attach, caller, error_code);
+        GetAttachmentIncompatibilities(rp1_state, rp2_state, primary_input_attach, secondary_input_attach, incompatibilities);
     } else if (fdm1) {
-        skip |= LogInvalidPnextMessage(type1_string, rp1_state, type2_string, rp2_state,
-                                       "The first uses a Fragment Density Map while the second one does not.", caller, error_code);
+        incompatibilities.emplace_back("The first uses a Fragment Density Map while the second one does not.");
     } else if (fdm2) {
-        skip |= LogInvalidPnextMessage(type1_string, rp1_state, type2_string, rp2_state,
-                                       "The second uses a Fragment Density Map while the first one does not.", caller, error_code);
+        incompatibilities.emplace_back("The second uses a Fragment Density Map while the first one does not.");
+    }
+
+    return incompatibilities;
+}
+
+std::vector<std::string> CoreChecks::GetCachedRenderPassIncompatibilities(const RENDER_PASS_STATE *rp1_state,
+                                                                      const RENDER_PASS_STATE *rp2_state) const {
+    const RenderPassStatePair key(rp1_state, rp2_state);
+    const auto cached = render_pass_compatibility_cache.find(key);
+    // The entry holds weak references to the states, so a live state at the same address is the same state
+    if (cached != render_pass_compatibility_cache.end() && !cached->second.rp1_state.expired() &&
+        !cached->second.rp2_state.expired()) {
+        render_pass_compatibility_cache_hits.Add();
+        return cached->second.incompatibilities;
+    }
+    render_pass_compatibility_cache_misses.Add();
+
+    RenderPassCompatibility compatibility;
+    compatibility.rp1_state = rp1_state->shared_from_this();
+    compatibility.rp2_state = rp2_state->shared_from_this();
+    compatibility.incompatibilities = GetRenderPassIncompatibilities(rp1_state, rp2_state);
+    render_pass_compatibility_cache.insert_or_assign(key, compatibility);
+
+    // Drop the entries of freed render pass states each time the cache doubles in size
+    if (render_pass_compatibility_cache.size() >= render_pass_compatibility_prune_size.load()) {
+        PruneRenderPassCompatibilityCache();
+    }
+    return compatibility.incompatibilities;
+}
+
+void CoreChecks::PruneRenderPassCompatibilityCache() const {
+    const size_t cache_size = render_pass_compatibility_cache.size();
+    const auto expired_entries = render_pass_compatibility_cache.snapshot([](const RenderPassCompatibility &entry) {
+        return entry.rp1_state.expired() || entry.rp2_state.expired();
+    });
+    for (const auto &entry : expired_entries) {
+        render_pass_compatibility_cache.erase(entry.first);
+    }
+    render_pass_compatibility_prune_size.store(std::max<size_t>(2 * (cache_size - expired_entries.size()), 64));
+}
+
+// Verify that given renderPass CreateInfo for primary and secondary command buffers are compatible.
+//  The verdict only depends on the two render pass states, it is computed once per pair and kept in
+//  render_pass_compatibility_cache along with the reasons, for the error messages of later checks.
+bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const RENDER_PASS_STATE *rp1_state,
+                                                 const char *type2_string, const RENDER_PASS_STATE *rp2_state, const char *caller,
+                                                 const char *error_code) const {
+    if (disabled[render_pass_compatibility_validation]) return false;
+    CheckTimer check_timer("ValidateRenderPassCompatibility");
+    bool skip = false;
+
+    const auto incompatibilities = GetCachedRenderPassIncompatibilities(rp1_state, rp2_state);
+    for (const auto &incompatibility : incompatibilities) {
+        LogObjectList objlist(rp1_state->renderPass());
+        objlist.add(rp2_state->renderPass());
+        skip |= LogError(objlist, error_code, "%s: RenderPasses incompatible between %s w/ %s and %s w/ %s: %s", caller,
+                         type1_string, report_data->FormatHandle(rp1_state->renderPass()).c_str(), type2_string,
+                         report_data->FormatHandle(rp2_state->renderPass()).c_str(), incompatibility.c_str());
     }
 
     return skip;
@@ -667,9 +663,39 @@ std::string DynamicStateString(CBStatusFlags input_value) {
     return ret;
 }
 
+// True if the vertex buffer bindings meet the binding plan of the pipeline, and so pass the vertex binding checks
+static bool VertexBuffersMeetBindingPlan(const VertexInputState &vertex_input_state, const CBVertexBufferBindingInfo &binding_info,
+                                         bool dynamic_stride, bool null_descriptor) {
+    if (!vertex_input_state.has_binding_plan) {
+        return false;
+    }
+    const auto &bindings = binding_info.vertex_buffer_bindings;
+    if (bindings.size() < vertex_input_state.required_binding_count) {
+        return false;
+    }
+    if (!null_descriptor && (vertex_input_state.required_bindings & binding_info.null_bindings)) {
+        return false;
+    }
+    for (const auto &plan : vertex_input_state.binding_plans) {
+        const auto &binding = bindings[plan.binding];
+        uint32_t stride = plan.stride;
+        if (dynamic_stride) {
+            stride = static_cast<uint32_t>(binding.stride);
+            if (stride != 0 && stride < plan.max_extent) {
+                return false;
+            }
+        }
+        if (((binding.offset + stride) & plan.alignment_mask) != plan.alignment_residue) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Validate draw-time state related to the PSO
 bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, const CMD_BUFFER_STATE *pCB, CMD_TYPE cmd_type,
                                                const PIPELINE_STATE *pPipeline) const {
+    CheckTimer check_timer("ValidatePipelineDrawtimeState");
     bool skip = false;
     const auto &current_vtx_bfr_binding_info = pCB->current_vertex_buffer_binding_info.vertex_buffer_bindings;
     const DrawDispatchVuid vuid = GetDrawDispatchVuid(cmd_type);
@@ -926,7 +952,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
 
     // Verify if using dynamic state setting commands that it doesn't set up in pipeline
     CBStatusFlags invalid_status = CBSTATUS_ALL_STATE_SET & ~(pCB->dynamic_status | pCB->static_status);
-    if (invalid_status) {
+    if (invalid_status && !disabled[dynamic_state_validation]) {
         std::string dynamic_states = DynamicStateString(invalid_status);
         LogObjectList objlist(pCB->commandBuffer());
         objlist.add(pPipeline->pipeline());
@@ -936,7 +962,11 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
     }
 
     // Verify vertex binding
-    if (pPipeline->vertex_input_state && pPipeline->vertex_input_state->binding_descriptions.size() > 0) {
+    if (!disabled[vertex_buffer_validation] && pPipeline->vertex_input_state &&
+        pPipeline->vertex_input_state->binding_descriptions.size() > 0 &&
+        !VertexBuffersMeetBindingPlan(*pPipeline->vertex_input_state, pCB->current_vertex_buffer_binding_info,
+                                      IsDynamic(pPipeline, VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT),
+                                      enabled_features.robustness2_features.nullDescriptor)) {
         for (size_t i = 0; i < pPipeline->vertex_input_state->binding_descriptions.size(); i++) {
             const auto vertex_binding = pPipeline->vertex_input_state->binding_descriptions[i].binding;
             if (current_vtx_bfr_binding_info.size() < (vertex_binding + 1)) {
@@ -1019,8 +1049,8 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
     bool dyn_viewport = IsDynamic(pPipeline, VK_DYNAMIC_STATE_VIEWPORT);
     const auto *raster_state = pPipeline->RasterizationState();
     const auto *viewport_state = pPipeline->ViewportState();
-    if ((!raster_state || (raster_state->rasterizerDiscardEnable == VK_FALSE)) && viewport_state &&
-        (pCB->inheritedViewportDepths.size() == 0)) {
+    if (!disabled[dynamic_state_validation] && (!raster_state || (raster_state->rasterizerDiscardEnable == VK_FALSE)) &&
+        viewport_state && (pCB->inheritedViewportDepths.size() == 0)) {
         bool dyn_scissor = IsDynamic(pPipeline, VK_DYNAMIC_STATE_SCISSOR);
 
         // NB (akeley98): Current validation layers do not detect the error where vkCmdSetViewport (or scissor) was called, but
@@ -1094,7 +1124,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
     }
 
     // If inheriting viewports, verify that not using more than inherited.
-    if (pCB->inheritedViewportDepths.size() != 0 && dyn_viewport) {
+    if (!disabled[dynamic_state_validation] && pCB->inheritedViewportDepths.size() != 0 && dyn_viewport) {
         uint32_t viewport_count = viewport_state->viewportCount;
         uint32_t max_inherited  = uint32_t(pCB->inheritedViewportDepths.size());
         if (viewport_count > max_inherited) {
@@ -1340,6 +1370,7 @@ static bool VerifySetLayoutCompatibility(const debug_report_data *report_data, c
 // Validate overall state at the time of a draw call
 bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TYPE cmd_type, const bool indexed,
                                          const VkPipelineBindPoint bind_point) const {
+    CheckTimer check_timer("ValidateCmdBufDrawState");
     const DrawDispatchVuid vuid = GetDrawDispatchVuid(cmd_type);
     const char *function = CommandTypeString(cmd_type);
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
@@ -1356,7 +1387,10 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
 
     bool result = false;
 
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
+    // Groups of checks that found nothing for this command since their inputs last changed are skipped
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point &&
+        !cb_node->IsDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckGraphicsState, cmd_type)) {
+        const uint64_t message_attempts = log_message_attempts;
         // First check flag states
         result |= ValidateDrawStateFlags(cb_node, pipe, indexed, vuid.dynamic_state);
 
@@ -1383,13 +1417,26 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
                 }
             }
         }
+
+        // Check general pipeline state that needs to be validated at drawtime
+        result |= ValidatePipelineDrawtimeState(state, cb_node, cmd_type, pipe);
+        if (log_message_attempts == message_attempts) {
+            cb_node->SetDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckGraphicsState, cmd_type);
+        }
     }
     // Now complete other state checks
     string error_string;
     auto const &pipeline_layout = pipe->PipelineLayoutState();
 
+    // Once the bound sets were found to match the pipeline layout, only their contents need validating until either changes
+    const bool check_set_layouts =
+        !cb_node->IsDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckDescriptorSetLayouts, cmd_type);
+    bool set_layouts_match = true;
+
     // Check if the current pipeline is compatible for the maximum used set with the bound sets.
-    if (pipe->active_slots.size() > 0 && !CompatForSet(pipe->max_active_slot, state, pipeline_layout->compat_for_set)) {
+    if (check_set_layouts && pipe->active_slots.size() > 0 &&
+        !CompatForSet(pipe->max_active_slot, state, pipeline_layout->compat_for_set)) {
+        set_layouts_match = false;
         LogObjectList objlist(pipe->pipeline());
         objlist.add(pipeline_layout->layout());
         objlist.add(state.pipeline_layout);
@@ -1405,12 +1452,15 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
         uint32_t set_index = set_binding_pair.first;
         // If valid set is not bound throw an error
         if ((state.per_set.size() <= set_index) || (!state.per_set[set_index].bound_descriptor_set)) {
+            set_layouts_match = false;
             result |= LogError(cb_node->commandBuffer(), kVUID_Core_DrawState_DescriptorSetNotBound,
                                "%s(): %s uses set #%u but that set is not bound.", CommandTypeString(cmd_type),
                                report_data->FormatHandle(pipe->pipeline()).c_str(), set_index);
-        } else if (!VerifySetLayoutCompatibility(report_data, state.per_set[set_index].bound_descriptor_set.get(),
+        } else if (check_set_layouts &&
+                   !VerifySetLayoutCompatibility(report_data, state.per_set[set_index].bound_descriptor_set.get(),
                                                  pipeline_layout.get(), set_index, error_string)) {
             // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
+            set_layouts_match = false;
             VkDescriptorSet set_handle = state.per_set[set_index].bound_descriptor_set->GetSet();
             LogObjectList objlist(set_handle);
             objlist.add(pipeline_layout->layout());
@@ -1418,9 +1468,12 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
                                "%s(): %s bound as set #%u is not compatible with overlapping %s due to: %s",
                                CommandTypeString(cmd_type), report_data->FormatHandle(set_handle).c_str(), set_index,
                                report_data->FormatHandle(pipeline_layout->layout()).c_str(), error_string.c_str());
-        } else {  // Valid set is bound and layout compatible, validate that it's updated
+        } else if (!disabled[descriptor_content_validation]) {
+            // Valid set is bound and layout compatible, validate that it's updated
             // Pull the set node
             const auto *descriptor_set = state.per_set[set_index].bound_descriptor_set.get();
+            const uint32_t *dynamic_offsets = state.DynamicOffsets(state.per_set[set_index]);
+            const uint32_t dynamic_offset_count = state.per_set[set_index].dynamic_offset_count;
             // Validate the draw-time state for this descriptor set
             std::string err_str;
             // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor
@@ -1431,63 +1484,85 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
             const auto &binding_req_map = reduced_map.FilteredMap(*cb_node, *pipe);
 
             // We can skip validating the descriptor set if "nothing" has changed since the last validation.
-            // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-            // any dynamic descriptors, always revalidate rather than caching the values. We currently only
+            // Same set, no image layout changes, and same "pipeline state" (binding_req_map). Dynamic offsets
+            // don't matter, they are fully validated when the set is bound. We currently only
             // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
             // binding_req_map which could potentially be expensive.
             bool descriptor_set_changed =
                 !reduced_map.IsManyDescriptors() ||
-                // Revalidate each time if the set has dynamic offsets
-                state.per_set[set_index].dynamicOffsets.size() > 0 ||
-                // Revalidate if descriptor set (or contents) has changed
+                // Revalidate if descriptor set has changed
                 state.per_set[set_index].validated_set != descriptor_set ||
-                state.per_set[set_index].validated_set_change_count != descriptor_set->GetChangeCount() ||
                 (!disabled[image_layout_validation] &&
                  state.per_set[set_index].validated_set_image_layout_change_count != cb_node->image_layout_change_count);
-            bool need_validate = descriptor_set_changed ||
+            // If only the contents changed, the descriptors updated since are all that need revalidating
+            const uint64_t validated_change_count = state.per_set[set_index].validated_set_change_count;
+            bool contents_changed = validated_change_count != descriptor_set->GetChangeCount();
+            bool need_validate = descriptor_set_changed || contents_changed ||
                                  // Revalidate if previous bindingReqMap doesn't include new bindingReqMap
-                                 !std::includes(state.per_set[set_index].validated_set_binding_req_map.begin(),
-                                                state.per_set[set_index].validated_set_binding_req_map.end(),
-                                                binding_req_map.begin(), binding_req_map.end());
+                                 !std::includes(state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                                state.per_set[set_index].validated_set_binding_reqs.end(),
+                                                binding_req_map.begin(), binding_req_map.end(), BindingReqLess());
 
-            if (need_validate) {
+            if (!need_validate) {
+                descriptor_set_skipped_validations.Add();
+            } else {
                 if (!descriptor_set_changed && reduced_map.IsManyDescriptors()) {
+                    descriptor_set_partial_validations.Add();
                     // Only validate the bindings that haven't already been validated
                     BindingReqMap delta_reqs;
                     std::set_difference(binding_req_map.begin(), binding_req_map.end(),
-                                        state.per_set[set_index].validated_set_binding_req_map.begin(),
-                                        state.per_set[set_index].validated_set_binding_req_map.end(),
-                                        layer_data::insert_iterator<BindingReqMap>(delta_reqs, delta_reqs.begin()));
-                    result |=
-                        ValidateDrawState(descriptor_set, delta_reqs, state.per_set[set_index].dynamicOffsets, cb_node,
-                                          cb_node->active_attachments.get(), cb_node->active_subpasses.get(), function, vuid);
+                                        state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                        state.per_set[set_index].validated_set_binding_reqs.end(),
+                                        layer_data::insert_iterator<BindingReqMap>(delta_reqs, delta_reqs.begin()),
+                                        BindingReqLess());
+                    result |= ValidateDrawState(descriptor_set, delta_reqs, dynamic_offsets, dynamic_offset_count, cb_node,
+                                                cb_node->active_attachments.get(), cb_node->active_subpasses.get(), function, vuid);
+                    if (contents_changed) {
+                        // ...and the descriptors of the already validated bindings that were written since
+                        BindingReqMap validated_reqs;
+                        std::set_intersection(binding_req_map.begin(), binding_req_map.end(),
+                                              state.per_set[set_index].validated_set_binding_reqs.begin(),
+                                              state.per_set[set_index].validated_set_binding_reqs.end(),
+                                              layer_data::insert_iterator<BindingReqMap>(validated_reqs, validated_reqs.begin()),
+                                              BindingReqLess());
+                        result |= ValidateDrawState(descriptor_set, validated_reqs, dynamic_offsets, dynamic_offset_count, cb_node,
+                                                    cb_node->active_attachments.get(), cb_node->active_subpasses.get(), function,
+                                                    vuid, validated_change_count);
+                    }
                 } else {
-                    result |=
-                        ValidateDrawState(descriptor_set, binding_req_map, state.per_set[set_index].dynamicOffsets, cb_node,
-                                          cb_node->active_attachments.get(), cb_node->active_subpasses.get(), function, vuid);
+                    descriptor_set_full_validations.Add();
+                    const uint64_t message_attempts = log_message_attempts;
+                    result |= ValidateDrawState(descriptor_set, binding_req_map, dynamic_offsets, dynamic_offset_count, cb_node,
+                                                cb_node->active_attachments.get(), cb_node->active_subpasses.get(), function, vuid);
+                    // Only a complete validation of the bindings that found nothing can be shared with other command buffers
+                    if (log_message_attempts == message_attempts && reduced_map.IsManyDescriptors() &&
+                        !enabled_features.core11.protectedMemory) {
+                        descriptor_set->SetBuffersValidated(binding_req_map);
+                    }
                 }
             }
         }
     }
 
-    // Check general pipeline state that needs to be validated at drawtime
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
-        result |= ValidatePipelineDrawtimeState(state, cb_node, cmd_type, pipe);
+    if (check_set_layouts && set_layouts_match) {
+        cb_node->SetDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckDescriptorSetLayouts, cmd_type);
     }
 
     // Verify if push constants have been set
     // NOTE: Currently not checking whether active push constants are compatible with the active pipeline, nor whether the
     //       "life times" of push constants are correct.
     //       Discussion on validity of these checks can be found at https://gitlab.khronos.org/vulkan/vulkan/-/issues/2602.
-    if (!cb_node->push_constant_data_ranges || (pipeline_layout->push_constant_ranges == cb_node->push_constant_data_ranges)) {
+    if (!cb_node->IsDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckPushConstants, cmd_type) &&
+        (!cb_node->push_constant_data_ranges || (pipeline_layout->push_constant_ranges == cb_node->push_constant_data_ranges))) {
+        bool push_constants_set = true;
         for (const auto &stage : pipe->stage_state) {
-            const auto *entrypoint = stage.module_state->FindEntrypointStruct(stage.create_info->pName, stage.create_info->stage);
-            if (!entrypoint || !entrypoint->push_constant_used_in_shader.IsUsed()) {
+            if (!stage.push_constant_used_in_shader.IsUsed()) {
                 continue;
             }
 
             // Edge case where if the shader is using push constants statically and there never was a vkCmdPushConstants
             if (!cb_node->push_constant_data_ranges && !enabled_features.core13.maintenance4) {
+                push_constants_set = false;
                 LogObjectList objlist(cb_node->commandBuffer());
                 objlist.add(pipeline_layout->layout());
                 objlist.add(pipe->pipeline());
@@ -1498,12 +1573,14 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
                                    report_data->FormatHandle(pipeline_layout->layout()).c_str());
             }
 
-            const auto it = cb_node->push_constant_data_update.find(stage.stage_flag);
-            if (it == cb_node->push_constant_data_update.end()) {
+            if (!cb_node->push_constant_data_ranges || !(pipeline_layout->push_constant_stages & stage.stage_flag)) {
                 // This error has been printed in ValidatePushConstantUsage.
                 break;
             }
         }
+        if (push_constants_set) {
+            cb_node->SetDrawCheckClean(lv_bind_point, CMD_BUFFER_STATE::kDrawCheckPushConstants, cmd_type);
+        }
     }
     return result;
 }
@@ -2289,10 +2366,9 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
     if (vi_state) {
         for (uint32_t j = 0; j < vi_state->vertexAttributeDescriptionCount; j++) {
             VkFormat format = vi_state->pVertexAttributeDescriptions[j].format;
-            // Internal call to get format info.  Still goes through layers, could potentially go directly to ICD.
-            VkFormatProperties properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &properties);
-            if ((properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0) {
+            const VkFormatFeatureFlags2KHR buffer_features =
+                GetFormatPropertiesCache().GetFormatProperties(format, has_format_feature2, false)->properties.bufferFeatures;
+            if ((buffer_features & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0) {
                 skip |= LogError(device, "VUID-VkVertexInputAttributeDescription-format-00623",
                                  "vkCreateGraphicsPipelines: pCreateInfo[%" PRIu32
                                  "].pVertexInputState->vertexAttributeDescriptions[%d].format "
@@ -3544,6 +3620,26 @@ bool CoreChecks::PreCallValidateCreateDevice(VkPhysicalDevice gpu, const VkDevic
     return skip;
 }
 
+void CoreChecks::GetValidationCounters(ValidationCounterList &counters) const {
+    StateTracker::GetValidationCounters(counters);
+    AddValidationCounter(counters, "CoreChecks.descriptor_set_full_validations", descriptor_set_full_validations.Get());
+    AddValidationCounter(counters, "CoreChecks.descriptor_set_partial_validations", descriptor_set_partial_validations.Get());
+    AddValidationCounter(counters, "CoreChecks.descriptor_set_skipped_validations", descriptor_set_skipped_validations.Get());
+    AddValidationCounter(counters, "CoreChecks.shader_validation_cache_hits", shader_validation_cache_hits.Get());
+    AddValidationCounter(counters, "CoreChecks.shader_validation_cache_misses", shader_validation_cache_misses.Get());
+    AddValidationCounter(counters, "CoreChecks.specialization_cache_hits", specialization_cache_hits.Get());
+    AddValidationCounter(counters, "CoreChecks.specialization_cache_misses", specialization_cache_misses.Get());
+    AddValidationCounter(counters, "CoreChecks.render_pass_compatibility_cache_hits", render_pass_compatibility_cache_hits.Get());
+    AddValidationCounter(counters, "CoreChecks.render_pass_compatibility_cache_misses",
+                         render_pass_compatibility_cache_misses.Get());
+    AddValidationCounter(counters, "CoreChecks.render_pass_compatibility_cache_size", render_pass_compatibility_cache.size());
+    AddValidationCounter(counters, "CoreChecks.deferred_validation_fingerprint_hits", deferred_validation_fingerprint_hits.Get());
+    AddValidationCounter(counters, "CoreChecks.deferred_validation_fingerprint_misses",
+                         deferred_validation_fingerprint_misses.Get());
+    AddValidationCounter(counters, "CoreChecks.imageless_begin_cache_hits", imageless_begin_cache_hits.Get());
+    AddValidationCounter(counters, "CoreChecks.imageless_begin_cache_misses", imageless_begin_cache_misses.Get());
+}
+
 void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo);
@@ -3555,29 +3651,42 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         [](CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &iv_state, VkImageLayout layout) -> void {
             cb_node->SetImageViewInitialLayout(iv_state, layout);
         });
+    housekeeping_.Register("PruneRenderPassCompatibilityCache", [this]() { PruneRenderPassCompatibilityCache(); });
+
+    if ((async_validation || async_shader_validation) && thread_pool) {
+        validation_worker_pool.reset(new ValidationWorkerPool(report_data, thread_pool));
+    }
 
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
-        std::string validation_cache_path;
-        auto tmp_path = GetEnvironment("XDG_CACHE_HOME");
-        if (!tmp_path.size()) {
-            auto cachepath = GetEnvironment("HOME") + "/.cache";
-            struct stat info;
-            if (stat(cachepath.c_str(), &info) == 0) {
-                if ((info.st_mode & S_IFMT) == S_IFDIR) {
-                    tmp_path = cachepath;
-                }
-            }
+        validation_cache_path = GetLayerCacheFilePath("shader_validation_cache");
+
+        uint8_t cache_uuid[VK_UUID_SIZE];
+        ValidationCache::MakeCacheUuid(cache_uuid);
+        if (validation_cache_log.Open(validation_cache_path, cache_uuid)) {
+            const bool loaded = validation_cache_log.Load(
+                [this, device](const void *snapshot, size_t snapshot_size, const std::vector<ValidationCacheLog::Record> &records) {
+                    auto cache_ci = LvlInitStruct<VkValidationCacheCreateInfoEXT>();
+                    cache_ci.initialDataSize = snapshot_size;
+                    cache_ci.pInitialData = snapshot;
+                    CoreLayerCreateValidationCacheEXT(device, &cache_ci, nullptr, &core_validation_cache);
+                    if (core_validation_cache) CastFromHandle<ValidationCache *>(core_validation_cache)->LoadRecords(records);
+                });
+            if (loaded && core_validation_cache) {
+                CastFromHandle<ValidationCache *>(core_validation_cache)->SetLog(&validation_cache_log);
+                // Keeps the log, which every load replays, short
+                static const size_t kCompactionRecords = 1024;
+                housekeeping_.Register("CompactValidationCacheLog", [this]() {
+                    if (validation_cache_log.RecordCount() >= kCompactionRecords) CompactValidationCacheLog();
+                });
+                return;
+            }
+            if (core_validation_cache) {
+                CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, nullptr);
+                core_validation_cache = VK_NULL_HANDLE;
+            }
+            validation_cache_log.Close();
         }
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMPDIR");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMP");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
-        if (!tmp_path.size()) tmp_path = "/tmp";
-        validation_cache_path = tmp_path + "/shader_validation_cache";
-#if defined(__linux__) || defined(__FreeBSD__)
-        validation_cache_path += "-" + std::to_string(getuid());
-#endif
-        validation_cache_path += ".bin";
 
         std::vector<char> validation_cache_data;
         std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
@@ -3600,12 +3709,48 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     }
 }
 
+bool CoreChecks::CompactValidationCacheLog() {
+    auto *cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    return validation_cache_log.Compact([this, cache](const void *snapshot, size_t snapshot_size,
+                                                      const std::vector<ValidationCacheLog::Record> &records,
+                                                      std::vector<char> &new_snapshot) {
+        // Other processes may have compacted since the cache was loaded, so take in their snapshot and records as well
+        if (snapshot_size) {
+            auto cache_ci = LvlInitStruct<VkValidationCacheCreateInfoEXT>();
+            cache_ci.initialDataSize = snapshot_size;
+            cache_ci.pInitialData = snapshot;
+            auto *other = CastFromHandle<ValidationCache *>(ValidationCache::Create(&cache_ci, specialization_cache_size));
+            cache->Merge(other);
+            delete other;
+        }
+        cache->LoadRecords(records);
+        size_t size = 0;
+        cache->Write(&size, nullptr);
+        new_snapshot.resize(size);
+        cache->Write(&size, new_snapshot.data());
+        new_snapshot.resize(size);
+    });
+}
+
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
+    // Deliver any outstanding messages while the state the jobs reference still exists
+    validation_worker_pool.reset();
+
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 
-    if (core_validation_cache) {
+    if (core_validation_cache && validation_cache_log.IsOpen()) {
+        // Async spirv-val jobs may still be appending to the log
+        DrainAsyncValidation();
+        if (validation_cache_log.RecordCount() > 0 && !CompactValidationCacheLog()) {
+            LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot compact the shader validation cache log of %s",
+                    validation_cache_path.c_str());
+        }
+        CastFromHandle<ValidationCache *>(core_validation_cache)->SetLog(nullptr);
+        validation_cache_log.Close();
+        CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
+    } else if (core_validation_cache) {
         size_t validation_cache_size = 0;
         void *validation_cache_data = nullptr;
 
@@ -3782,6 +3927,7 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(
     const Location &loc, const CMD_BUFFER_STATE *pCB, int current_submit_count,
     QFOTransferCBScoreboards<QFOImageTransferBarrier> *qfo_image_scoreboards,
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> *qfo_buffer_scoreboards) const {
+    CheckTimer check_timer("ValidatePrimaryCommandBufferState");
     using sync_vuid_maps::GetQueueSubmitVUID;
     using sync_vuid_maps::SubmitError;
 
@@ -4046,6 +4192,7 @@ struct SemaphoreSubmitState {
 
 bool CoreChecks::ValidateSemaphoresForSubmit(SemaphoreSubmitState &state, VkQueue queue, const VkSubmitInfo *submit,
                                              const Location &outer_loc) const {
+    CheckTimer check_timer("ValidateSemaphoresForSubmit");
     bool skip = false;
     auto *timeline_semaphore_submit_info = LvlFindInChain<VkTimelineSemaphoreSubmitInfo>(submit->pNext);
     for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
@@ -4119,6 +4266,7 @@ bool CoreChecks::ValidateSemaphoresForSubmit(SemaphoreSubmitState &state, VkQueu
 
 bool CoreChecks::ValidateSemaphoresForSubmit(SemaphoreSubmitState &state, VkQueue queue, const VkSubmitInfo2KHR *submit,
                                              const Location &outer_loc) const {
+    CheckTimer check_timer("ValidateSemaphoresForSubmit");
     bool skip = false;
     for (uint32_t i = 0; i < submit->waitSemaphoreInfoCount; ++i) {
         const auto &sem_info = submit->pWaitSemaphoreInfos[i];
@@ -4173,26 +4321,136 @@ bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(const Location &loc
     return skip;
 }
 
+// The scoreboards of the batch validated on this thread, reset for each batch
+template <typename TransferBarrier>
+static QFOTransferCBScoreboards<TransferBarrier> &GetBatchQFOScoreboards() {
+    static thread_local QFOTransferCBScoreboards<TransferBarrier> scoreboards;
+    scoreboards.Reset();
+    return scoreboards;
+}
+
+// Submissions with fewer command buffers than this aren't worth handing to the worker threads
+static constexpr size_t kMinParallelSubmitCommandBuffers = 8;
+
+// Validates the command buffers of one queue submission call, in submission order.
+//
+// When Prepare() finds enough of them and parallel_submit_validation is set, the checks of each command buffer that don't depend
+// on the ones before it run up front on the validation batch pool: the layouts of the images no other command buffer of the
+// submission uses, the queue family checks and the descriptor checks. Validate() then delivers their messages along with those of
+// the checks it runs itself, so the errors still come in command buffer order.
 struct CommandBufferSubmitState {
+    using Location = core_error::Location;
+    using Func = core_error::Func;
+    using Struct = core_error::Struct;
+    using Field = core_error::Field;
+
     const CoreChecks *core;
     const QUEUE_STATE *queue_state;
-    QFOTransferCBScoreboards<QFOImageTransferBarrier> qfo_image_scoreboards;
-    QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
+    QFOTransferCBScoreboards<QFOImageTransferBarrier> &qfo_image_scoreboards;
+    QFOTransferCBScoreboards<QFOBufferTransferBarrier> &qfo_buffer_scoreboards;
     vector<VkCommandBuffer> current_cmds;
     GlobalImageLayoutMap overlay_image_layout_map;
     QueryMap local_query_to_state_map;
+    // The stage masks set by the earlier command buffers of the submission, and by the current one for each of its event IDs
     EventToStageMap local_event_to_stage_map;
+    EventStageTable cb_event_stage_masks;
+
+    // A command buffer of the submission, by its index in the pCommandBuffers or pCommandBufferInfos of its submit
+    struct Submitted {
+        uint32_t submit_index;
+        uint32_t index;
+        std::shared_ptr<const CMD_BUFFER_STATE> cb_state;
+    };
+    // Set by Prepare(), two tasks for each of the submitted command buffers: the unshared image layouts, then the rest
+    Func submit_function = Func::Empty;
+    std::vector<Submitted> submitted;
+    layer_data::unordered_set<const IMAGE_STATE *> shared_images;
+    std::vector<uint8_t> task_results;
+    ValidationBatchPool::Messages task_messages;
+    uint32_t next_submitted = 0;
+
+    CommandBufferSubmitState(const CoreChecks *c, const char *func, const QUEUE_STATE *q)
+        : core(c),
+          queue_state(q),
+          qfo_image_scoreboards(GetBatchQFOScoreboards<QFOImageTransferBarrier>()),
+          qfo_buffer_scoreboards(GetBatchQFOScoreboards<QFOBufferTransferBarrier>()) {}
 
-    CommandBufferSubmitState(const CoreChecks *c, const char *func, const QUEUE_STATE *q) : core(c), queue_state(q) {}
+    void Prepare(uint32_t submit_count, const VkSubmitInfo *submits) {
+        if (!core->CanRunSubmitBatch()) return;
+        std::vector<Submitted> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submit_count; submit_idx++) {
+            for (uint32_t i = 0; i < submits[submit_idx].commandBufferCount; i++) {
+                auto cb_state = core->Get<CMD_BUFFER_STATE>(submits[submit_idx].pCommandBuffers[i]);
+                if (cb_state) command_buffers.emplace_back(Submitted{submit_idx, i, std::move(cb_state)});
+            }
+        }
+        Prepare(Func::vkQueueSubmit, std::move(command_buffers));
+    }
 
-    bool Validate(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_node, uint32_t perf_pass) {
+    void Prepare(uint32_t submit_count, const VkSubmitInfo2KHR *submits) {
+        if (!core->CanRunSubmitBatch()) return;
+        std::vector<Submitted> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submit_count; submit_idx++) {
+            for (uint32_t i = 0; i < submits[submit_idx].commandBufferInfoCount; i++) {
+                auto cb_state = core->Get<CMD_BUFFER_STATE>(submits[submit_idx].pCommandBufferInfos[i].commandBuffer);
+                if (cb_state) command_buffers.emplace_back(Submitted{submit_idx, i, std::move(cb_state)});
+            }
+        }
+        Prepare(Func::vkQueueSubmit2, std::move(command_buffers));
+    }
+
+    void Prepare(Func func, std::vector<Submitted> &&command_buffers) {
+        if (command_buffers.size() < kMinParallelSubmitCommandBuffers) return;
+        TraceScope trace("CoreChecks", "PrepareSubmittedCommandBuffers");
+        submit_function = func;
+        submitted = std::move(command_buffers);
+
+        // An image is shared if more than one of the submitted command buffers, or more than one submission of the same one,
+        // has layout state for it
+        if (!core->disabled[image_layout_validation] && !core->disabled[submit_image_layout_validation]) {
+            layer_data::unordered_set<const IMAGE_STATE *> seen_images;
+            std::vector<ImageLayoutSummaryEntry> summary_scratch;
+            for (const auto &entry : submitted) {
+                auto guard = entry.cb_state->ReadLock();
+                for (const auto &summary_entry : entry.cb_state->GetImageLayoutSummary(summary_scratch)) {
+                    if (!seen_images.insert(summary_entry.image).second) shared_images.insert(summary_entry.image);
+                }
+            }
+        }
+
+        core->CollectSubmitBatch(static_cast<uint32_t>(submitted.size() * 2),
+                                 [this](uint32_t task) { return RunTask(task); }, task_results, task_messages);
+    }
+
+    bool RunTask(uint32_t task) const {
+        const Submitted &entry = submitted[task / 2];
+        auto guard = entry.cb_state->ReadLock();
+        if (submit_function == Func::vkQueueSubmit) {
+            Location loc(Func::vkQueueSubmit, Struct::VkSubmitInfo, Field::pSubmits, entry.submit_index);
+            return RunTask(task, loc.dot(Field::pCommandBuffers, entry.index), *entry.cb_state);
+        }
+        Location loc(Func::vkQueueSubmit2, Struct::VkSubmitInfo2, Field::pSubmits, entry.submit_index);
+        auto info_loc = loc.dot(Field::pCommandBufferInfos, entry.index);
+        info_loc.structure = Struct::VkCommandBufferSubmitInfo;
+        return RunTask(task, info_loc.dot(Field::commandBuffer), *entry.cb_state);
+    }
+
+    bool RunTask(uint32_t task, const Location &loc, const CMD_BUFFER_STATE &cb_node) const {
+        if (task % 2 == 0) {
+            GlobalImageLayoutMap unshared_overlay;
+            const CoreChecks::SubmitImageFilter unshared{&shared_images, false};
+            return core->ValidateCmdBufImageLayouts(loc, &cb_node, unshared_overlay, &unshared);
+        }
+        return ValidateIndependentChecks(loc, cb_node);
+    }
+
+    bool DeliverTask(uint32_t task) const {
+        return ValidationBatchPool::Deliver(core->report_data, task_messages[task]) || task_results[task] != 0;
+    }
+
+    // The checks that don't depend on the command buffers submitted before this one
+    bool ValidateIndependentChecks(const Location &loc, const CMD_BUFFER_STATE &cb_node) const {
         bool skip = false;
-        skip |= core->ValidateCmdBufImageLayouts(loc, &cb_node, overlay_image_layout_map);
-        auto cmd = cb_node.commandBuffer();
-        current_cmds.push_back(cmd);
-        skip |= core->ValidatePrimaryCommandBufferState(loc, &cb_node,
-                                                        static_cast<int>(std::count(current_cmds.begin(), current_cmds.end(), cmd)),
-                                                        &qfo_image_scoreboards, &qfo_buffer_scoreboards);
         skip |= core->ValidateQueueFamilyIndices(loc, &cb_node, queue_state->Queue());
 
         for (const auto &descriptor_set : cb_node.validate_descriptorsets_in_queuesubmit) {
@@ -4206,21 +4464,42 @@ struct CommandBufferSubmitState {
                 function += CommandTypeString(cmd_info.cmd_type);
                 for (const auto &binding_info : cmd_info.binding_infos) {
                     std::string error;
-                    std::vector<uint32_t> dynamic_offsets;
-                    // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
+                    // dynamic data isn't allowed in UPDATE_AFTER_BIND, so there are no dynamic offsets.
                     // This submit time not record time...
                     const bool record_time_validate = false;
                     layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> checked_layouts;
                     if (set_node->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
                         checked_layouts.emplace();
                     }
-                    skip |= core->ValidateDescriptorSetBindingData(&cb_node, set_node.get(), dynamic_offsets, binding_info,
+                    skip |= core->ValidateDescriptorSetBindingData(&cb_node, set_node.get(), nullptr, 0, binding_info,
                                                                    cmd_info.framebuffer, cmd_info.attachments.get(),
                                                                    cmd_info.subpasses.get(), record_time_validate, function.c_str(),
                                                                    core->GetDrawDispatchVuid(cmd_info.cmd_type), checked_layouts);
                 }
             }
         }
+        return skip;
+    }
+
+    bool Validate(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_node, uint32_t perf_pass) {
+        TraceScope trace("CoreChecks", "ValidateSubmittedCommandBuffer");
+        bool skip = false;
+        // The command buffers are validated in the order Prepare() was given them
+        const bool prepared = next_submitted < submitted.size() && submitted[next_submitted].cb_state.get() == &cb_node;
+        const uint32_t first_task = prepared ? next_submitted++ * 2 : 0;
+        if (prepared) {
+            skip |= DeliverTask(first_task);
+            const CoreChecks::SubmitImageFilter shared{&shared_images, true};
+            skip |= core->ValidateCmdBufImageLayouts(loc, &cb_node, overlay_image_layout_map, &shared);
+        } else {
+            skip |= core->ValidateCmdBufImageLayouts(loc, &cb_node, overlay_image_layout_map);
+        }
+        auto cmd = cb_node.commandBuffer();
+        current_cmds.push_back(cmd);
+        skip |= core->ValidatePrimaryCommandBufferState(loc, &cb_node,
+                                                        static_cast<int>(std::count(current_cmds.begin(), current_cmds.end(), cmd)),
+                                                        &qfo_image_scoreboards, &qfo_buffer_scoreboards);
+        skip |= prepared ? DeliverTask(first_task + 1) : ValidateIndependentChecks(loc, cb_node);
 
         // Potential early exit here as bad object state may crash in delayed function calls
         if (skip) {
@@ -4231,8 +4510,25 @@ struct CommandBufferSubmitState {
         for (auto &function : cb_node.queue_submit_functions) {
             skip |= function(*core, *queue_state, cb_node);
         }
-        for (auto &function : cb_node.eventUpdates) {
-            skip |= function(const_cast<CMD_BUFFER_STATE &>(cb_node), /*do_validate*/ true, &local_event_to_stage_map);
+        if (!cb_node.eventUpdates.empty()) {
+            cb_event_stage_masks.assign(cb_node.event_table.size(), EventStageMask{false, 0});
+            for (const auto &update : cb_node.eventUpdates) {
+                switch (update.type) {
+                    case EventUpdate::kSetStageMask:
+                        cb_event_stage_masks[update.event_id] = EventStageMask{true, update.stage_mask};
+                        break;
+                    case EventUpdate::kWaitStageMask:
+                        skip |= CoreChecks::ValidateEventStageMask(core, &cb_node, update.event_count, update.first_event_index,
+                                                                   update.stage_mask, cb_event_stage_masks,
+                                                                   local_event_to_stage_map);
+                        break;
+                }
+            }
+            for (uint32_t event_id = 0; event_id < cb_event_stage_masks.size(); ++event_id) {
+                if (cb_event_stage_masks[event_id].set) {
+                    local_event_to_stage_map[cb_node.event_table[event_id].event] = cb_event_stage_masks[event_id].stage_mask;
+                }
+            }
         }
         VkQueryPool first_perf_query_pool = VK_NULL_HANDLE;
         for (auto &function : cb_node.queryUpdates) {
@@ -4244,6 +4540,8 @@ struct CommandBufferSubmitState {
 
 bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                             VkFence fence) const {
+    // Errors from the command buffers' asynchronous checks are delivered before they are submitted
+    DrainAsyncValidation();
     auto fence_state = Get<FENCE_STATE>(fence);
     bool skip = ValidateFenceForSubmit(fence_state.get(), "VUID-vkQueueSubmit-fence-00064", "VUID-vkQueueSubmit-fence-00063",
                                        "vkQueueSubmit()");
@@ -4252,6 +4550,7 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     auto queue_state = Get<QUEUE_STATE>(queue);
     CommandBufferSubmitState cb_submit_state(this, "vkQueueSubmit()", queue_state.get());
+    cb_submit_state.Prepare(submitCount, pSubmits);
     SemaphoreSubmitState sem_submit_state(this,
                                           physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags);
 
@@ -4341,6 +4640,7 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
 
 bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
                                                 VkFence fence, bool is_2khr) const {
+    DrainAsyncValidation();
     auto pFence = Get<FENCE_STATE>(fence);
     const char* func_name = is_2khr ? "vkQueueSubmit2KHR()" : "vkQueueSubmit2()";
     bool skip = ValidateFenceForSubmit(pFence.get(), "VUID-vkQueueSubmit2-fence-04895", "VUID-vkQueueSubmit2-fence-04894",
@@ -4356,6 +4656,7 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
 
     auto queue_state = Get<QUEUE_STATE>(queue);
     CommandBufferSubmitState cb_submit_state(this, func_name, queue_state.get());
+    cb_submit_state.Prepare(submitCount, pSubmits);
     SemaphoreSubmitState sem_submit_state(this,
                                           physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags);
 
@@ -4634,7 +4935,7 @@ bool CoreChecks::ValidateAllocateMemoryANDROID(const VkMemoryAllocateInfo *alloc
             auto ext_img_fmt_props = LvlInitStruct<VkExternalImageFormatProperties>();
             auto ifp2 = LvlInitStruct<VkImageFormatProperties2>(&ext_img_fmt_props);
 
-            VkResult fmt_lookup_result = DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &pdifi2, &ifp2);
+            VkResult fmt_lookup_result = GetFormatPropertiesCache().GetImageFormatProperties2(&pdifi2, &ifp2);
 
             if ((VK_SUCCESS != fmt_lookup_result) || (0 == (ext_img_fmt_props.externalMemoryProperties.externalMemoryFeatures &
                                                             VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT))) {
@@ -5055,6 +5356,12 @@ bool CoreChecks::PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory mem,
     return skip;
 }
 
+void CoreChecks::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator) {
+    // Outstanding jobs may still check the memory bound to their buffers
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordFreeMemory(device, mem, pAllocator);
+}
+
 // Validate that given Map memory range is valid. This means that the memory should not already be mapped,
 //  and that the size of the map range should be:
 //  1. Not zero
@@ -5962,19 +6269,7 @@ bool CoreChecks::PreCallValidateDestroyRenderPass(VkDevice device, VkRenderPass
 
 // Access helper functions for external modules
 VkFormatProperties3KHR CoreChecks::GetPDFormatProperties(const VkFormat format) const {
-    auto fmt_props_3 = LvlInitStruct<VkFormatProperties3KHR>();
-    auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_props_3);
-
-    if (has_format_feature2) {
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        fmt_props_3.linearTilingFeatures = format_properties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures = format_properties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures = format_properties.bufferFeatures;
-    }
-    return fmt_props_3;
+    return GetFormatPropertiesCache().GetFormatProperties(format, has_format_feature2, false)->properties;
 }
 
 bool CoreChecks::ValidatePipelineVertexDivisors(std::vector<std::shared_ptr<PIPELINE_STATE>> const &pipe_state_vec,
@@ -6077,6 +6372,9 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                         const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                         void *cgpl_state_data) const {
+    for (uint32_t i = 0; i < count; i++) {
+        WaitForShaderModuleValidation(pCreateInfos[i].pStages, pCreateInfos[i].stageCount);
+    }
     bool skip = StateTracker::PreCallValidateCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                      pPipelines, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
@@ -6100,13 +6398,11 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
         }
     }
 
-    for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipelineLocked(cgpl_state->pipe_state, i);
-    }
-
-    for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i);
-    }
+    // Two batches, so that messages come out in the same order as when validating one pipeline after the other
+    skip |= RunPipelineBatch(count, [this, cgpl_state](uint32_t i) { return ValidatePipelineLocked(cgpl_state->pipe_state, i); });
+    skip |= RunPipelineBatch(count, [this, cgpl_state](uint32_t i) {
+        return ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i);
+    });
 
     if (IsExtEnabled(device_extensions.vk_ext_vertex_attribute_divisor)) {
         skip |= ValidatePipelineVertexDivisors(cgpl_state->pipe_state, count, pCreateInfos);
@@ -6166,16 +6462,21 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                        const VkComputePipelineCreateInfo *pCreateInfos,
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                        void *ccpl_state_data) const {
+    for (uint32_t i = 0; i < count; i++) {
+        WaitForShaderModuleValidation(&pCreateInfos[i].stage, 1);
+    }
     bool skip = StateTracker::PreCallValidateCreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                     pPipelines, ccpl_state_data);
 
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
-    for (uint32_t i = 0; i < count; i++) {
+    skip |= RunPipelineBatch(count, [this, ccpl_state, pCreateInfos](uint32_t i) {
+        bool skip = false;
         // TODO: Add Compute Pipeline Verification
         skip |= ValidateComputePipelineShaderState(ccpl_state->pipe_state[i].get());
         skip |= ValidatePipelineCacheControlFlags(pCreateInfos->flags, i, "vkCreateComputePipelines",
                                                   "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
-    }
+        return skip;
+    });
     return skip;
 }
 
@@ -6183,6 +6484,9 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                             const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             void *crtpl_state_data) const {
+    for (uint32_t i = 0; i < count; i++) {
+        WaitForShaderModuleValidation(pCreateInfos[i].pStages, pCreateInfos[i].stageCount);
+    }
     bool skip = StateTracker::PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                          pPipelines, crtpl_state_data);
 
@@ -6217,6 +6521,9 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
                                                              const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
                                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                              void *crtpl_state_data) const {
+    for (uint32_t i = 0; i < count; i++) {
+        WaitForShaderModuleValidation(pCreateInfos[i].pStages, pCreateInfos[i].stageCount);
+    }
     bool skip = StateTracker::PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, count,
                                                                           pCreateInfos, pAllocator, pPipelines, crtpl_state_data);
 
@@ -8140,9 +8447,170 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer)
         skip |= LogError(commandBuffer, "VUID-vkEndCommandBuffer-None-01978",
                          "vkEndCommandBuffer(): Ending command buffer with active conditional rendering.");
     }
+    // Run the command checks recorded while deferred command validation is enabled, unless they are handed off to the worker
+    // pool in PreCallRecordEndCommandBuffer, or the same commands already passed them
+    if (!async_validation && !cb_state->deferred_validate_functions.empty()) {
+        const size_t fingerprint = command_buffer_fingerprinting ? DeferredValidationFingerprint(*cb_state) : 0;
+        if (command_buffer_fingerprinting && clean_deferred_validation_fingerprints.contains(fingerprint)) {
+            deferred_validation_fingerprint_hits.Add();
+        } else {
+            if (command_buffer_fingerprinting) deferred_validation_fingerprint_misses.Add();
+            const uint64_t message_attempts = log_message_attempts;
+            for (const auto &function : cb_state->deferred_validate_functions) {
+                skip |= function(*cb_state);
+            }
+            if (command_buffer_fingerprinting && log_message_attempts == message_attempts) {
+                RecordCleanDeferredValidation(fingerprint);
+            }
+        }
+    }
     return skip;
 }
 
+void CoreChecks::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    StateTracker::PreCallRecordEndCommandBuffer(commandBuffer);
+    if (!async_validation) return;
+    auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
+    if (!cb_state || cb_state->deferred_validate_functions.empty()) return;
+
+    const size_t fingerprint = command_buffer_fingerprinting ? DeferredValidationFingerprint(*cb_state) : 0;
+    if (command_buffer_fingerprinting && clean_deferred_validation_fingerprints.contains(fingerprint)) {
+        deferred_validation_fingerprint_hits.Add();
+        return;
+    }
+    if (command_buffer_fingerprinting) deferred_validation_fingerprint_misses.Add();
+
+    // The command buffer may be reset while the job runs, so the job takes the callbacks and keeps the state alive itself
+    auto functions = std::make_shared<std::vector<std::function<bool(const CMD_BUFFER_STATE &)>>>();
+    functions->swap(cb_state->deferred_validate_functions);
+    // Only the callbacks kept the buffers alive
+    cb_state->deferred_validate_buffers.clear();
+    std::shared_ptr<const CMD_BUFFER_STATE> cb_ref = cb_state;
+    const uint64_t sequence = validation_worker_pool->Enqueue([this, cb_ref, functions, fingerprint]() {
+        const uint64_t message_attempts = log_message_attempts;
+        for (const auto &function : *functions) {
+            function(*cb_ref);
+        }
+        if (command_buffer_fingerprinting && log_message_attempts == message_attempts) {
+            RecordCleanDeferredValidation(fingerprint);
+        }
+    });
+    pending_command_buffer_validation.insert_or_assign(commandBuffer, sequence);
+}
+
+void CoreChecks::WaitForCommandBufferValidation(VkCommandBuffer command_buffer) {
+    if (pending_command_buffer_validation.empty()) return;
+    auto pending = pending_command_buffer_validation.find(command_buffer);
+    if (pending != pending_command_buffer_validation.end()) {
+        validation_worker_pool->WaitForDelivery(pending->second);
+        pending_command_buffer_validation.erase(command_buffer);
+    }
+}
+
+void CoreChecks::WaitForCommandPoolValidation(VkCommandPool command_pool) {
+    if (pending_command_buffer_validation.empty()) return;
+    auto pool_state = Get<COMMAND_POOL_STATE>(command_pool);
+    if (!pool_state) return;
+    for (const auto &entry : pool_state->commandBuffers) {
+        WaitForCommandBufferValidation(entry.first);
+    }
+}
+
+void CoreChecks::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
+    // Beginning a recorded command buffer resets it
+    WaitForCommandBufferValidation(commandBuffer);
+    StateTracker::PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+void CoreChecks::PreCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    WaitForCommandBufferValidation(commandBuffer);
+    StateTracker::PreCallRecordResetCommandBuffer(commandBuffer, flags);
+}
+
+void CoreChecks::PreCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    WaitForCommandPoolValidation(commandPool);
+    StateTracker::PreCallRecordResetCommandPool(device, commandPool, flags);
+}
+
+void CoreChecks::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                                 const VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < commandBufferCount; i++) {
+        WaitForCommandBufferValidation(pCommandBuffers[i]);
+    }
+    StateTracker::PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+void CoreChecks::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                 const VkAllocationCallbacks *pAllocator) {
+    WaitForCommandPoolValidation(commandPool);
+    StateTracker::PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
+}
+
+// Outstanding jobs may still check the memory bound to the buffers
+void CoreChecks::PreCallRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+void CoreChecks::PreCallRecordBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo *pBindInfos) {
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
+}
+
+void CoreChecks::PreCallRecordBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
+                                                   const VkBindBufferMemoryInfo *pBindInfos) {
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+}
+
+void CoreChecks::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
+                                              VkFence fence) {
+    DrainAsyncValidation();
+    StateTracker::PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+
+void CoreChecks::FingerprintDeferredCommand(CMD_BUFFER_STATE *cb_state, CMD_TYPE cmd_type, size_t parameters,
+                                            const BUFFER_STATE *src_buffer_state, const BUFFER_STATE *dst_buffer_state) const {
+    if (!command_buffer_fingerprinting) return;
+    hash_util::HashCombiner hc(cb_state->deferred_validate_fingerprint);
+    hc << cmd_type << parameters;
+    for (const BUFFER_STATE *buffer_state : {src_buffer_state, dst_buffer_state}) {
+        if (!buffer_state) continue;
+        // What the checks read of the buffer, which is fixed at creation except for its bound memory. The handle tells which
+        // regions of a copy are in the same buffer.
+        hc << buffer_state->buffer() << buffer_state->createInfo.size << buffer_state->createInfo.usage
+           << buffer_state->createInfo.flags << buffer_state->unprotected;
+        cb_state->deferred_validate_buffers.push_back(buffer_state);
+    }
+    cb_state->deferred_validate_fingerprint = hc.Value();
+}
+
+size_t CoreChecks::DeferredValidationFingerprint(const CMD_BUFFER_STATE &cb_state) const {
+    hash_util::HashCombiner hc(cb_state.deferred_validate_fingerprint);
+    hc << cb_state.unprotected << cb_state.deferred_validate_functions.size();
+    for (const BUFFER_STATE *buffer_state : cb_state.deferred_validate_buffers) {
+        // The memory may have been bound or freed since the command was recorded
+        const DEVICE_MEMORY_STATE *mem_state = buffer_state->MemState();
+        hc << (mem_state != nullptr) << (mem_state && mem_state->Destroyed());
+    }
+    return hc.Value();
+}
+
+void CoreChecks::RecordCleanDeferredValidation(size_t fingerprint) const {
+    // Engines re-record a bounded set of command buffers, start over if the set keeps growing
+    static const size_t kMaxCleanFingerprints = 4096;
+    if (clean_deferred_validation_fingerprints.size() >= kMaxCleanFingerprints) {
+        clean_deferred_validation_fingerprints.clear();
+    }
+    clean_deferred_validation_fingerprints.insert(fingerprint, true);
+}
+
+void CoreChecks::DrainAsyncValidation() const {
+    if (validation_worker_pool) {
+        validation_worker_pool->Drain();
+    }
+}
+
 bool CoreChecks::PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const {
     bool skip = false;
     auto cb_state = GetRead<CMD_BUFFER_STATE>(commandBuffer);
@@ -8697,10 +9165,10 @@ bool CoreChecks::ValidateAccelerationBuffers(uint32_t info_index, const VkAccele
     const auto *p_geometries = info.pGeometries;
     const auto *const *const pp_geometries = info.ppGeometries;
 
-    auto buffer_check = [this, info_index, func_name](uint32_t gi, const VkDeviceOrHostAddressConstKHR address,
-                                                      const char *field) -> bool {
-        // being inside the lambda confuses the compiler about our constness
-        const auto buffer_state = const_cast<const CoreChecks *>(this)->GetBufferByAddress(address.deviceAddress);
+    BufferAddressLookup<const BUFFER_STATE> buffer_lookup(*this);
+    auto buffer_check = [this, info_index, func_name, &buffer_lookup](uint32_t gi, const VkDeviceOrHostAddressConstKHR address,
+                                                                      const char *field) -> bool {
+        const auto buffer_state = buffer_lookup.Get(address.deviceAddress);
         if (buffer_state &&
             !(buffer_state->createInfo.usage & VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR)) {
             LogObjectList objlist(device);
@@ -8748,7 +9216,7 @@ bool CoreChecks::ValidateAccelerationBuffers(uint32_t info_index, const VkAccele
         }
     }
 
-    const auto buffer_state = GetBufferByAddress(info.scratchData.deviceAddress);
+    const auto buffer_state = buffer_lookup.Get(info.scratchData.deviceAddress);
     if (!buffer_state) {
         skip |= LogError(device, "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03802",
                 "vkBuildAccelerationStructuresKHR(): The buffer associated with pInfos[%" PRIu32
@@ -9216,15 +9684,18 @@ bool CoreChecks::PreCallValidateCmdBindDescriptorSets(VkCommandBuffer commandBuf
                             auto *descriptor = descriptor_set->GetDescriptorFromDynamicOffsetIndex(set_dyn_offset);
                             assert(descriptor != nullptr);
                             // Currently only GeneralBuffer are dynamic and need to be checked
-                            if (descriptor->GetClass() == cvdescriptorset::DescriptorClass::GeneralBuffer) {
-                                const auto *buffer_descriptor = static_cast<const cvdescriptorset::BufferDescriptor *>(descriptor);
+                            const auto *buffer_descriptor =
+                                (descriptor->GetClass() == cvdescriptorset::DescriptorClass::GeneralBuffer)
+                                    ? static_cast<const cvdescriptorset::BufferDescriptor *>(descriptor)
+                                    : nullptr;
+                            // The largest valid offset was worked out when the descriptor was updated
+                            if (buffer_descriptor && (offset > buffer_descriptor->GetMaxDynamicOffset())) {
                                 const VkDeviceSize bound_range = buffer_descriptor->GetRange();
-                                const VkDeviceSize bound_offset = buffer_descriptor->GetOffset();
                                 //NOTE: null / invalid buffers may show up here, errors are raised elsewhere for this.
                                 auto buffer_state = buffer_descriptor->GetBufferState();
 
                                 // Validate offset didn't go over buffer
-                                if ((bound_range == VK_WHOLE_SIZE) && (offset > 0)) {
+                                if (bound_range == VK_WHOLE_SIZE) {
                                     LogObjectList objlist(commandBuffer);
                                     objlist.add(pDescriptorSets[set_idx]);
                                     objlist.add(buffer_descriptor->GetBuffer());
@@ -9235,8 +9706,7 @@ bool CoreChecks::PreCallValidateCmdBindDescriptorSets(VkCommandBuffer commandBuf
                                                  "descriptor[%u].",
                                                  cur_dyn_offset, offset, set_idx, binding_index, j);
 
-                                } else if (buffer_state && (bound_range != VK_WHOLE_SIZE) &&
-                                           ((offset + bound_range + bound_offset) > buffer_state->createInfo.size)) {
+                                } else if (buffer_state) {
                                     LogObjectList objlist(commandBuffer);
                                     objlist.add(pDescriptorSets[set_idx]);
                                     objlist.add(buffer_descriptor->GetBuffer());
@@ -9445,23 +9915,18 @@ bool CoreChecks::ValidateImageSampleCount(const IMAGE_STATE *image_state, VkSamp
     return skip;
 }
 
-bool CoreChecks::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                                VkDeviceSize dataSize, const void *pData) const {
-    auto cb_state = GetRead<CMD_BUFFER_STATE>(commandBuffer);
-    assert(cb_state);
-    auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
-    assert(dst_buffer_state);
-
+bool CoreChecks::ValidateCmdUpdateBufferResources(const CMD_BUFFER_STATE *cb_state, const BUFFER_STATE *dst_buffer_state,
+                                                  VkDeviceSize dstOffset, VkDeviceSize dataSize) const {
+    const VkCommandBuffer commandBuffer = cb_state->commandBuffer();
     bool skip = false;
-    skip |= ValidateMemoryIsBoundToBuffer(dst_buffer_state.get(), "vkCmdUpdateBuffer()", "VUID-vkCmdUpdateBuffer-dstBuffer-00035");
+    skip |= ValidateMemoryIsBoundToBuffer(dst_buffer_state, "vkCmdUpdateBuffer()", "VUID-vkCmdUpdateBuffer-dstBuffer-00035");
     // Validate that DST buffer has correct usage flags set
-    skip |= ValidateBufferUsageFlags(dst_buffer_state.get(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
+    skip |= ValidateBufferUsageFlags(dst_buffer_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                      "VUID-vkCmdUpdateBuffer-dstBuffer-00034", "vkCmdUpdateBuffer()",
                                      "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-    skip |= ValidateCmd(cb_state.get(), CMD_UPDATEBUFFER);
-    skip |= ValidateProtectedBuffer(cb_state.get(), dst_buffer_state.get(), "vkCmdUpdateBuffer()",
+    skip |= ValidateProtectedBuffer(cb_state, dst_buffer_state, "vkCmdUpdateBuffer()",
                                     "VUID-vkCmdUpdateBuffer-commandBuffer-01813");
-    skip |= ValidateUnprotectedBuffer(cb_state.get(), dst_buffer_state.get(), "vkCmdUpdateBuffer()",
+    skip |= ValidateUnprotectedBuffer(cb_state, dst_buffer_state, "vkCmdUpdateBuffer()",
                                       "VUID-vkCmdUpdateBuffer-commandBuffer-01814");
     if (dstOffset >= dst_buffer_state->createInfo.size) {
         skip |= LogError(
@@ -9478,6 +9943,36 @@ bool CoreChecks::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, V
     return skip;
 }
 
+bool CoreChecks::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                                VkDeviceSize dataSize, const void *pData) const {
+    auto cb_state = GetRead<CMD_BUFFER_STATE>(commandBuffer);
+    assert(cb_state);
+
+    bool skip = false;
+    skip |= ValidateCmd(cb_state.get(), CMD_UPDATEBUFFER);
+    if (!deferred_command_validation) {
+        auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
+        assert(dst_buffer_state);
+        skip |= ValidateCmdUpdateBufferResources(cb_state.get(), dst_buffer_state.get(), dstOffset, dataSize);
+    }
+    return skip;
+}
+
+void CoreChecks::PreCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                              VkDeviceSize dataSize, const void *pData) {
+    StateTracker::PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    if (!deferred_command_validation) return;
+    auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
+    auto dst_buffer_state = Get<BUFFER_STATE>(dstBuffer);
+    FingerprintDeferredCommand(cb_state.get(), CMD_UPDATEBUFFER,
+                               hash_util::HashCombiner().Combine(dstOffset).Combine(dataSize).Value(), nullptr,
+                               dst_buffer_state.get());
+    cb_state->deferred_validate_functions.emplace_back(
+        [this, dst_buffer_state, dstOffset, dataSize](const CMD_BUFFER_STATE &cb) {
+            return ValidateCmdUpdateBufferResources(&cb, dst_buffer_state.get(), dstOffset, dataSize);
+        });
+}
+
 bool CoreChecks::PreCallValidateCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const {
     auto cb_state = GetRead<CMD_BUFFER_STATE>(commandBuffer);
     bool skip = false;
@@ -9920,14 +10415,20 @@ bool CoreChecks::ValidateAccessMask(const LogObjectList &objects, const Location
 
 bool CoreChecks::ValidateEventStageMask(const ValidationStateTracker *state_data, const CMD_BUFFER_STATE *pCB, size_t eventCount,
                                         size_t firstEventIndex, VkPipelineStageFlags2KHR sourceStageMask,
-                                        EventToStageMap *localEventToStageMap) {
+                                        const EventStageTable &cb_event_stage_masks,
+                                        const EventToStageMap &localEventToStageMap) {
     bool skip = false;
     VkPipelineStageFlags2KHR stage_mask = 0;
-    const auto max_event = std::min((firstEventIndex + eventCount), pCB->events.size());
+    const auto max_event = std::min((firstEventIndex + eventCount), pCB->wait_event_ids.size());
     for (size_t event_index = firstEventIndex; event_index < max_event; ++event_index) {
-        auto event = pCB->events[event_index];
-        auto event_data = localEventToStageMap->find(event);
-        if (event_data != localEventToStageMap->end()) {
+        const uint32_t event_id = pCB->wait_event_ids[event_index];
+        if (cb_event_stage_masks[event_id].set) {
+            stage_mask |= cb_event_stage_masks[event_id].stage_mask;
+            continue;
+        }
+        auto event = pCB->event_table[event_id].event;
+        auto event_data = localEventToStageMap.find(event);
+        if (event_data != localEventToStageMap.end()) {
             stage_mask |= event_data->second;
         } else {
             auto global_event_data = state_data->Get<EVENT_STATE>(event);
@@ -10032,16 +10533,12 @@ bool CoreChecks::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandBuffer, ui
 
 void CORE_CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent *pEvents,
                                              VkPipelineStageFlags2KHR srcStageMask) {
-    // CMD_BUFFER_STATE will add to the events vector.
-    auto first_event_index = events.size();
+    // CMD_BUFFER_STATE will add to the wait_event_ids vector.
+    auto first_event_index = wait_event_ids.size();
     CMD_BUFFER_STATE::RecordWaitEvents(cmd_type, eventCount, pEvents, srcStageMask);
-    auto event_added_count = events.size() - first_event_index;
-    eventUpdates.emplace_back([event_added_count, first_event_index, srcStageMask](CMD_BUFFER_STATE &cb, bool do_validate,
-                                                                                   EventToStageMap *localEventToStageMap) {
-        if (!do_validate) return false;
-        return CoreChecks::ValidateEventStageMask(cb.dev_data, &cb, event_added_count, first_event_index, srcStageMask,
-                                                  localEventToStageMap);
-    });
+    auto event_added_count = wait_event_ids.size() - first_event_index;
+    eventUpdates.emplace_back(EventUpdate::WaitStageMask(static_cast<uint32_t>(first_event_index),
+                                                         static_cast<uint32_t>(event_added_count), srcStageMask));
 }
 
 void CoreChecks::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -10413,12 +10910,7 @@ bool CoreChecks::PreCallValidateCmdBeginQuery(VkCommandBuffer commandBuffer, VkQ
 
 static QueryState GetLocalQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex,
                                      uint32_t perfPass) {
-    QueryObject query = QueryObject(QueryObject(queryPool, queryIndex), perfPass);
-
-    auto iter = localQueryToStateMap->find(query);
-    if (iter != localQueryToStateMap->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
+    return localQueryToStateMap->Get(queryPool, queryIndex, perfPass);
 }
 
 bool CoreChecks::VerifyQueryIsReset(const ValidationStateTracker *state_data, VkCommandBuffer commandBuffer, QueryObject query_obj,
@@ -10789,32 +11281,29 @@ bool CoreChecks::PreCallValidateCmdPushConstants(VkCommandBuffer commandBuffer,
     assert(cb_state);
     skip |= ValidateCmd(cb_state.get(), CMD_PUSHCONSTANTS);
 
-    // Check if pipeline_layout VkPushConstantRange(s) overlapping offset, size have stageFlags set for each stage in the command
-    // stageFlags argument, *and* that the command stageFlags argument has bits set for the stageFlags in each overlapping range.
+    // Check that each byte from offset to offset + size is in VkPushConstantRange(s) of pipeline_layout for each stage in the
+    // command stageFlags argument, *and* that the command stageFlags argument has all stages of the ranges containing the byte.
+    // Both hold when the stages of the ranges containing every byte are stageFlags.
     if (!skip) {
         auto layout_state = Get<PIPELINE_LAYOUT_STATE>(layout);
-        const auto &ranges = *layout_state->push_constant_ranges;
-        VkShaderStageFlags found_stages = 0;
-        for (const auto &range : ranges) {
-            if ((offset >= range.offset) && (offset + size <= range.offset + range.size)) {
-                VkShaderStageFlags matching_stages = range.stageFlags & stageFlags;
-                if (matching_stages != range.stageFlags) {
-                    skip |=
-                        LogError(commandBuffer, "VUID-vkCmdPushConstants-offset-01796",
-                                 "vkCmdPushConstants(): stageFlags (%s, offset (%" PRIu32 "), and size (%" PRIu32
-                                 "),  must contain all stages in overlapping VkPushConstantRange stageFlags (%s), offset (%" PRIu32
-                                 "), and size (%" PRIu32 ") in %s.",
-                                 string_VkShaderStageFlags(stageFlags).c_str(), offset, size,
-                                 string_VkShaderStageFlags(range.stageFlags).c_str(), range.offset, range.size,
-                                 report_data->FormatHandle(layout).c_str());
-                }
-
-                // Accumulate all stages we've found
-                found_stages = matching_stages | found_stages;
-            }
-        }
-        if (found_stages != stageFlags) {
-            uint32_t missing_stages = ~found_stages & stageFlags;
+        const auto &byte_stages = layout_state->push_constant_byte_stages;
+        const uint64_t push_end = static_cast<uint64_t>(offset) + size;
+        // The bytes past the last range are in none
+        VkShaderStageFlags missing_stages = (push_end > byte_stages.size()) ? stageFlags : 0;
+        VkShaderStageFlags extra_stages = 0;
+        const uint32_t end = static_cast<uint32_t>(std::min(push_end, static_cast<uint64_t>(byte_stages.size())));
+        for (uint32_t byte = offset; byte < end; ++byte) {
+            missing_stages |= stageFlags & ~byte_stages[byte];
+            extra_stages |= byte_stages[byte] & ~stageFlags;
+        }
+        if (extra_stages) {
+            skip |= LogError(commandBuffer, "VUID-vkCmdPushConstants-offset-01796",
+                             "vkCmdPushConstants(): stageFlags (%s), offset (%" PRIu32 "), and size (%" PRIu32
+                             "), must contain all stages of the VkPushConstantRanges in %s overlapping them, but not %s.",
+                             string_VkShaderStageFlags(stageFlags).c_str(), offset, size,
+                             report_data->FormatHandle(layout).c_str(), string_VkShaderStageFlags(extra_stages).c_str());
+        }
+        if (missing_stages) {
             skip |= LogError(
                 commandBuffer, "VUID-vkCmdPushConstants-offset-01795",
                 "vkCmdPushConstants(): %s, VkPushConstantRange in %s overlapping offset = %d and size = %d, do not contain %s.",
@@ -13482,6 +13971,45 @@ bool CoreChecks::VerifyRenderAreaBounds(const VkRenderPassBeginInfo *pRenderPass
     return skip;
 }
 
+bool CoreChecks::IsImagelessBeginValidated(const ImagelessBeginKey &key) const {
+    const auto cached = validated_imageless_begins.find(key);
+    if (cached == validated_imageless_begins.end()) return false;
+    const ImagelessBeginStates &states = cached->second;
+    auto is_live = [](const std::weak_ptr<const BASE_NODE> &weak_state) {
+        const auto state = weak_state.lock();
+        return state && !state->Destroyed();
+    };
+    if (!is_live(states.framebuffer_state) || !is_live(states.render_pass_state)) return false;
+    for (const auto &view_state : states.image_view_states) {
+        if (!is_live(view_state)) return false;
+    }
+    return true;
+}
+
+void CoreChecks::RecordImagelessBeginValidated(const ImagelessBeginKey &key) const {
+    ImagelessBeginStates states;
+    auto framebuffer_state = Get<FRAMEBUFFER_STATE>(key.framebuffer);
+    auto render_pass_state = Get<RENDER_PASS_STATE>(key.render_pass);
+    if (!framebuffer_state || !render_pass_state) return;
+    states.framebuffer_state = framebuffer_state;
+    states.render_pass_state = render_pass_state;
+    for (const auto view : key.image_views) {
+        auto view_state = Get<IMAGE_VIEW_STATE>(view);
+        if (!view_state) return;
+        states.image_view_states.emplace_back(view_state);
+    }
+    // Applications begin a bounded set of render pass instances, start over if the set keeps growing, which also drops the
+    // stale entries
+    static const size_t kMaxImagelessBegins = 1024;
+    if (validated_imageless_begins.size() >= kMaxImagelessBegins) {
+        validated_imageless_begins.clear();
+    }
+    validated_imageless_begins.insert_or_assign(key, std::move(states));
+}
+
+// The views of an imageless framebuffer are checked against its attachment image infos and the render pass attachments. The
+// verdict only depends on the framebuffer, render pass and views, a begin with the same ones as a begin that found nothing is
+// skipped.
 bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBeginInfo *pRenderPassBeginInfo,
                                                           const char *func_name) const {
     bool skip = false;
@@ -13489,6 +14017,19 @@ bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBegi
         LvlFindInChain<VkRenderPassAttachmentBeginInfo>(pRenderPassBeginInfo->pNext);
 
     if (render_pass_attachment_begin_info && render_pass_attachment_begin_info->attachmentCount != 0) {
+        ImagelessBeginKey key;
+        key.framebuffer = pRenderPassBeginInfo->framebuffer;
+        key.render_pass = pRenderPassBeginInfo->renderPass;
+        for (uint32_t i = 0; i < render_pass_attachment_begin_info->attachmentCount; ++i) {
+            key.image_views.emplace_back(render_pass_attachment_begin_info->pAttachments[i]);
+        }
+        if (IsImagelessBeginValidated(key)) {
+            imageless_begin_cache_hits.Add();
+            return skip;
+        }
+        imageless_begin_cache_misses.Add();
+        const uint64_t message_attempts = log_message_attempts;
+
         auto framebuffer_state = Get<FRAMEBUFFER_STATE>(pRenderPassBeginInfo->framebuffer);
         const auto *framebuffer_create_info = &framebuffer_state->createInfo;
         const VkFramebufferAttachmentsCreateInfo *framebuffer_attachments_create_info =
@@ -13651,6 +14192,10 @@ bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBegi
                 }
             }
         }
+
+        if (log_message_attempts == message_attempts) {
+            RecordImagelessBeginValidated(key);
+        }
     }
 
     return skip;
@@ -14876,15 +15421,27 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
         // initial layout usage of secondary command buffers resources must match parent command buffer
         const auto const_cb_state = std::static_pointer_cast<const CMD_BUFFER_STATE>(cb_state);
-        for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto *image_state = sub_layout_map_entry.first;
+        std::vector<ImageLayoutSummaryEntry> summary_scratch;
+        for (const auto &summary_entry : sub_cb_state->GetImageLayoutSummary(summary_scratch)) {
+            const auto *image_state = summary_entry.image;
             const auto image = image_state->image();
 
             const auto *cb_subres_map = const_cb_state->GetImageSubresourceLayoutMap(*image_state);
             // Const getter can be null in which case we have nothing to check against for this image...
             if (!cb_subres_map) continue;
 
-            const auto &sub_cb_subres_map = sub_layout_map_entry.second;
+            // When both command buffers hold a single layout for the whole image one comparison settles it, a mismatch is still
+            // reported per subresource below
+            const auto *sub_uniform = summary_entry.uniform_layout;
+            const auto *cb_uniform = cb_subres_map->GetUniformLayout();
+            if (sub_uniform && cb_uniform && sub_uniform->InitialLayout() != kInvalidLayout) {
+                const VkImageLayout sub_layout = sub_uniform->InitialLayout();
+                VkImageLayout cb_layout = cb_uniform->CurrentLayout();
+                if (cb_layout == kInvalidLayout) cb_layout = cb_uniform->InitialLayout();
+                if (sub_layout == VK_IMAGE_LAYOUT_UNDEFINED || cb_layout == kInvalidLayout || cb_layout == sub_layout) continue;
+            }
+
+            const auto &sub_cb_subres_map = summary_entry.layout_map;
             // Validate the initial_uses, that they match the current state of the primary cb, or absent a current state,
             // that the match any initial_layout.
             for (const auto &subres_layout : *sub_cb_subres_map) {
@@ -14894,10 +15451,10 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
 
                 // Look up the layout to compared to the intial layout of the sub command buffer (current else initial)
                 const auto *cb_layouts = cb_subres_map->GetSubresourceLayouts(subresource);
-                auto cb_layout = cb_layouts ? cb_layouts->current_layout : kInvalidLayout;
+                auto cb_layout = cb_layouts ? cb_layouts->CurrentLayout() : kInvalidLayout;
                 const char *layout_type = "current";
                 if (cb_layout == kInvalidLayout) {
-                    cb_layout = cb_layouts ? cb_layouts->initial_layout : kInvalidLayout;
+                    cb_layout = cb_layouts ? cb_layouts->InitialLayout() : kInvalidLayout;
                     layout_type = "initial";
                 }
                 if ((cb_layout != kInvalidLayout) && (cb_layout != sub_layout)) {
@@ -15591,7 +16148,7 @@ bool CoreChecks::PreCallValidateSetEvent(VkDevice device, VkEvent event) const {
     bool skip = false;
     auto event_state = Get<EVENT_STATE>(event);
     if (event_state) {
-        if (event_state->write_in_use) {
+        if (event_state->WriteInUse()) {
             skip |=
                 LogError(event, kVUID_Core_DrawState_QueueForwardProgress,
                          "vkSetEvent(): %s that is already in use by a command buffer.", report_data->FormatHandle(event).c_str());
@@ -15916,7 +16473,7 @@ bool CoreChecks::ValidateSignalSemaphore(VkDevice device, const VkSemaphoreSigna
         return skip;
     } else if (semaphore_state->HasPendingOps()) {
         // look back for the last signal operation, but there could be pending waits with higher payloads behind it.
-        const auto last_op = semaphore_state->LastOp([](const SEMAPHORE_STATE::SemOp &op) { return op.IsSignal(); });
+        const auto last_op = semaphore_state->LastSignal();
         if (last_op && pSignalInfo->value >= last_op->payload) {
             skip |= LogError(
                 pSignalInfo->semaphore, "VUID-VkSemaphoreSignalInfo-value-03259",
@@ -16372,8 +16929,8 @@ bool CoreChecks::ValidateCreateSwapchain(const char *func_name, VkSwapchainCreat
 
     const VkImageCreateInfo image_create_info = GetSwapchainImpliedImageCreateInfo(pCreateInfo);
     VkImageFormatProperties image_properties = {};
-    const VkResult image_properties_result = DispatchGetPhysicalDeviceImageFormatProperties(
-        physical_device, image_create_info.format, image_create_info.imageType, image_create_info.tiling, image_create_info.usage,
+    const VkResult image_properties_result = GetFormatPropertiesCache().GetImageFormatProperties(
+        image_create_info.format, image_create_info.imageType, image_create_info.tiling, image_create_info.usage,
         image_create_info.flags, &image_properties);
 
     if (image_properties_result != VK_SUCCESS) {
@@ -17720,12 +18277,14 @@ bool CoreChecks::PreCallValidateResetQueryPool(VkDevice device, VkQueryPool quer
 VkResult CoreChecks::CoreLayerCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator,
                                                        VkValidationCacheEXT *pValidationCache) {
-    *pValidationCache = ValidationCache::Create(pCreateInfo);
+    *pValidationCache = ValidationCache::Create(pCreateInfo, specialization_cache_size);
     return *pValidationCache ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
 }
 
 void CoreChecks::CoreLayerDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
                                                     const VkAllocationCallbacks *pAllocator) {
+    // Async spirv-val jobs may still be inserting into the cache
+    DrainAsyncValidation();
     delete CastFromHandle<ValidationCache *>(validationCache);
 }
 
@@ -35,6 +35,7 @@
 #include "qfo_transfer.h"
 #include "cmd_buffer_state.h"
 #include "render_pass_state.h"
+#include "validation_worker_pool.h"
 
 // Set of VUID that need to go between core_validation.cpp and drawdispatch.cpp
 struct DrawDispatchVuid {
@@ -151,11 +152,18 @@ typedef layer_data::unordered_map<const IMAGE_STATE*, layer_data::optional<Globa
 // this to all happen completely while the state tracker is holding the lock.
 // Eventually we'll probably want to move all of the core state into this derived
 // class.
+// Autogenerated as part of the command_validation.cpp codegen
+uint32_t CommandBufferFixedStateBits(VkCommandBufferLevel level, VkQueueFlags queue_flags);
+
 class CORE_CMD_BUFFER_STATE : public CMD_BUFFER_STATE {
   public:
     CORE_CMD_BUFFER_STATE(ValidationStateTracker* dev_data, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
                           const COMMAND_POOL_STATE* cmd_pool)
-        : CMD_BUFFER_STATE(dev_data, cb, pCreateInfo, cmd_pool) {}
+        : CMD_BUFFER_STATE(dev_data, cb, pCreateInfo, cmd_pool),
+          fixed_state_bits(CommandBufferFixedStateBits(pCreateInfo->level, cmd_pool->queue_flags)) {}
+
+    // The level and queue family bits of the state word ValidateCmd checks commands against
+    const uint32_t fixed_state_bits;
 
     void RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent* pEvents,
                           VkPipelineStageFlags2KHR src_stage_mask) override;
@@ -173,10 +181,84 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Open when core_validation_cache is kept at validation_cache_path by appending what it learns to a log, see
+    // ValidationCacheLog. Otherwise the whole cache is written back when the device is destroyed.
+    ValidationCacheLog validation_cache_log;
+    // Runs the checks deferred to vkEndCommandBuffer when async validation is enabled, and spirv-val when async shader
+    // validation is enabled
+    std::unique_ptr<ValidationWorkerPool> validation_worker_pool;
+    // Sequence numbers of the worker pool jobs validating each shader module, see async_shader_validation
+    vl_concurrent_unordered_map<VkShaderModule, uint64_t> pending_shader_module_validation;
+    // Sequence numbers of the worker pool jobs running the deferred checks of each command buffer, see async_validation
+    vl_concurrent_unordered_map<VkCommandBuffer, uint64_t> pending_command_buffer_validation;
+
+    // Render pass compatibility verdicts, keyed by the pair of render pass states compared. The weak references tell whether
+    // the states keyed by address are still alive.
+    using RenderPassStatePair = std::pair<const RENDER_PASS_STATE*, const RENDER_PASS_STATE*>;
+    struct RenderPassStatePairHash {
+        size_t operator()(const RenderPassStatePair& pair) const {
+            hash_util::HashCombiner hc;
+            hc << pair.first << pair.second;
+            return hc.Value();
+        }
+    };
+    struct RenderPassCompatibility {
+        std::weak_ptr<const BASE_NODE> rp1_state;
+        std::weak_ptr<const BASE_NODE> rp2_state;
+        // Empty if compatible
+        std::vector<std::string> incompatibilities;
+    };
+    mutable vl_concurrent_unordered_map<RenderPassStatePair, RenderPassCompatibility, 2, RenderPassStatePairHash>
+        render_pass_compatibility_cache;
+    mutable std::atomic<size_t> render_pass_compatibility_prune_size{64};
+    // Fingerprints of the command buffers whose deferred checks found nothing, see command_buffer_fingerprinting
+    mutable vl_concurrent_unordered_map<size_t, bool, 2> clean_deferred_validation_fingerprints;
+    // The begins of imageless framebuffers whose image views were found to match the framebuffer and render pass, keyed by
+    // their handles. The weak references to the states tell whether the handles still name the same objects, an entry is
+    // stale once one of them is destroyed.
+    struct ImagelessBeginKey {
+        VkFramebuffer framebuffer;
+        VkRenderPass render_pass;
+        small_vector<VkImageView, 8, uint32_t> image_views;
+        bool operator==(const ImagelessBeginKey& rhs) const {
+            return framebuffer == rhs.framebuffer && render_pass == rhs.render_pass && image_views == rhs.image_views;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << framebuffer << render_pass;
+            for (const auto view : image_views) {
+                hc << view;
+            }
+            return hc.Value();
+        }
+    };
+    struct ImagelessBeginStates {
+        std::weak_ptr<const BASE_NODE> framebuffer_state;
+        std::weak_ptr<const BASE_NODE> render_pass_state;
+        small_vector<std::weak_ptr<const BASE_NODE>, 8, uint32_t> image_view_states;
+    };
+    mutable vl_concurrent_unordered_map<ImagelessBeginKey, ImagelessBeginStates, 2, hash_util::HasHashMember<ImagelessBeginKey>>
+        validated_imageless_begins;
+
+    // Counted with khronos_validation.validation_counters
+    ValidationCounter descriptor_set_full_validations;
+    ValidationCounter descriptor_set_partial_validations;
+    ValidationCounter descriptor_set_skipped_validations;
+    ValidationCounter shader_validation_cache_hits;
+    ValidationCounter shader_validation_cache_misses;
+    ValidationCounter specialization_cache_hits;
+    ValidationCounter specialization_cache_misses;
+    ValidationCounter render_pass_compatibility_cache_hits;
+    ValidationCounter render_pass_compatibility_cache_misses;
+    ValidationCounter deferred_validation_fingerprint_hits;
+    ValidationCounter deferred_validation_fingerprint_misses;
+    ValidationCounter imageless_begin_cache_hits;
+    ValidationCounter imageless_begin_cache_misses;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() override;
+    void GetValidationCounters(ValidationCounterList& counters) const override;
     WriteLockGuard WriteLock() override;
 
     struct SimpleErrorLocation {
@@ -210,21 +292,16 @@ class CoreChecks : public ValidationStateTracker {
                                                      uint64_t value) const;
     bool ValidateStatus(const CMD_BUFFER_STATE* pNode, CBStatusFlags status_mask, const char* fail_msg, const char* msg_code) const;
     bool ValidateDrawStateFlags(const CMD_BUFFER_STATE* pCB, const PIPELINE_STATE* pPipe, bool indexed, const char* msg_code) const;
-    bool LogInvalidAttachmentMessage(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
-                                     const RENDER_PASS_STATE* rp2_state, uint32_t primary_attach, uint32_t secondary_attach,
-                                     const char* msg, const char* caller, const char* error_code) const;
-    bool LogInvalidPnextMessage(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
-                                const RENDER_PASS_STATE* rp2_state, const char* msg, const char* caller,
-                                const char* error_code) const;
     bool ValidateStageMaskHost(const Location& loc, VkPipelineStageFlags2KHR stageMask) const;
     bool ValidateMapMemRange(const DEVICE_MEMORY_STATE* mem_info, VkDeviceSize offset, VkDeviceSize size) const;
     bool ValidateRenderPassDAG(RenderPassCreateVersion rp_version, const VkRenderPassCreateInfo2* pCreateInfo) const;
-    bool ValidateAttachmentCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
-                                         const RENDER_PASS_STATE* rp2_state, uint32_t primary_attach, uint32_t secondary_attach,
-                                         const char* caller, const char* error_code) const;
-    bool ValidateSubpassCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
-                                      const RENDER_PASS_STATE* rp2_state, const int subpass, const char* caller,
-                                      const char* error_code) const;
+    // The reasons rp1_state and rp2_state are incompatible, looked up in render_pass_compatibility_cache
+    std::vector<std::string> GetCachedRenderPassIncompatibilities(const RENDER_PASS_STATE* rp1_state,
+                                                                  const RENDER_PASS_STATE* rp2_state) const;
+    // Drops the entries of freed render pass states from render_pass_compatibility_cache
+    void PruneRenderPassCompatibilityCache() const;
+    // Folds the log of validation_cache_log and the entries core_validation_cache has into a new snapshot of the cache
+    bool CompactValidationCacheLog();
     bool ValidateRenderPassCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
                                          const RENDER_PASS_STATE* rp2_state, const char* caller, const char* error_code) const;
     bool ReportInvalidCommandBuffer(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
@@ -268,7 +345,17 @@ class CoreChecks : public ValidationStateTracker {
 
     template <typename Barrier>
     bool ValidateImageBarrier(const LogObjectList& objects, const Location& loc, const CMD_BUFFER_STATE* cb_state,
-                              const Barrier& barrier) const;
+                              const Barrier& barrier, const IMAGE_STATE* image_state) const;
+
+    // The states of the images of a call's image barriers, in barrier order and null for unknown images. One reference is held
+    // per distinct image, so the states stay alive if the application destroys an image on another thread meanwhile.
+    struct BarrierImageStates {
+        small_vector<const IMAGE_STATE*, 32, uint32_t> states;
+        small_vector<std::shared_ptr<const IMAGE_STATE>, 8, uint32_t> references;
+        const IMAGE_STATE* operator[](uint32_t i) const { return states[i]; }
+    };
+    template <typename ImageBarrier>
+    void GetBarrierImageStates(uint32_t barrier_count, const ImageBarrier* barriers, BarrierImageStates& image_states) const;
 
     bool ValidateBarriers(const Location& loc, const CMD_BUFFER_STATE* cb_state, VkPipelineStageFlags src_stage_mask,
                           VkPipelineStageFlags dst_stage_mask, uint32_t memBarrierCount, const VkMemoryBarrier* pMemBarriers,
@@ -319,6 +406,8 @@ class CoreChecks : public ValidationStateTracker {
                                   const char* semaphore_type_vuid) const;
     bool VerifyRenderAreaBounds(const VkRenderPassBeginInfo* pRenderPassBegin, const char* func_name) const;
     bool VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBeginInfo* pRenderPassBeginInfo, const char* func_name) const;
+    bool IsImagelessBeginValidated(const ImagelessBeginKey& key) const;
+    void RecordImagelessBeginValidated(const ImagelessBeginKey& key) const;
     bool ValidatePrimaryCommandBuffer(const CMD_BUFFER_STATE* pCB, char const* cmd_name, const char* error_code) const;
 
     void RecordCmdNextSubpassLayouts(VkCommandBuffer commandBuffer, VkSubpassContents contents);
@@ -470,7 +559,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateCmdRayQueryState(const CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) const;
     static bool ValidateEventStageMask(const ValidationStateTracker* state_data, const CMD_BUFFER_STATE* pCB, size_t eventCount,
                                        size_t firstEventIndex, VkPipelineStageFlags2KHR sourceStageMask,
-                                       EventToStageMap* localEventToStageMap);
+                                       const EventStageTable& cb_event_stage_masks, const EventToStageMap& localEventToStageMap);
     bool ValidateQueueFamilyIndices(const Location& loc, const CMD_BUFFER_STATE* pCB, VkQueue queue) const;
     bool ValidatePerformanceQueries(const CMD_BUFFER_STATE* pCB, VkQueue queue, VkQueryPool& first_query_pool,
                                     uint32_t counterPassIndex) const;
@@ -484,17 +573,19 @@ class CoreChecks : public ValidationStateTracker {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData) override;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
+    // A non-zero changed_since only validates the descriptors updated after the set had that change count.
     bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const BindingReqMap& bindings,
-                           const std::vector<uint32_t>& dynamic_offsets, const CMD_BUFFER_STATE* cb_node,
+                           const uint32_t* dynamic_offsets, uint32_t dynamic_offset_count, const CMD_BUFFER_STATE* cb_node,
                            const std::vector<IMAGE_VIEW_STATE*>* attachments, const std::vector<SUBPASS_INFO>* subpasses,
-                           const char* caller, const DrawDispatchVuid& vuids) const;
+                           const char* caller, const DrawDispatchVuid& vuids, uint64_t changed_since = 0) const;
     bool ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE* cb_node, const cvdescriptorset::DescriptorSet* descriptor_set,
-                                          const std::vector<uint32_t>& dynamic_offsets,
+                                          const uint32_t* dynamic_offsets, uint32_t dynamic_offset_count,
                                           const std::pair<const uint32_t, DescriptorRequirement>& binding_info,
                                           VkFramebuffer framebuffer, const std::vector<IMAGE_VIEW_STATE*>* attachments,
                                           const std::vector<SUBPASS_INFO>* subpasses, bool record_time_validate, const char* caller,
                                           const DrawDispatchVuid& vuids,
-                                          layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>>& checked_layouts) const;
+                                          layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>>& checked_layouts,
+                                          uint64_t changed_since = 0) const;
 
     bool ValidateGeneralBufferDescriptor(const char* caller, const DrawDispatchVuid& vuids, const CMD_BUFFER_STATE* cb_node,
                                          const cvdescriptorset::DescriptorSet* descriptor_set,
@@ -556,6 +647,10 @@ class CoreChecks : public ValidationStateTracker {
                                         const cvdescriptorset::AllocateDescriptorSetsData*) const;
     bool ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet* p_wds, uint32_t copy_count,
                                       const VkCopyDescriptorSet* p_cds, const char* func_name) const;
+    bool ValidateWriteUpdates(const VkWriteDescriptorSet* p_wds, uint32_t first, uint32_t end, const char* func_name) const;
+    // Number of descriptor writes of a single call validated together, and on one thread under
+    // parallel_descriptor_update_validation
+    static const uint32_t kWriteUpdateChunkSize = 64;
 
     // Stuff from shader_validation
     bool ValidateGraphicsPipelineShaderState(const PIPELINE_STATE* pPipeline) const;
@@ -568,6 +663,15 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateRayTracingPipeline(PIPELINE_STATE* pipeline, VkPipelineCreateFlags flags, bool isKHR) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const override;
+    void PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
+                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule, VkResult result,
+                                          void* csm_state_data) override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                          const VkAllocationCallbacks* pAllocator) override;
+    bool RunSpirvValidator(const uint32_t* code, size_t code_size, ValidationCache* cache,
+                           const ValidationCache::ShaderHash& hash) const;
+    // Blocks until the messages of any pending async spirv-val run of the stages' modules have been delivered
+    void WaitForShaderModuleValidation(const VkPipelineShaderStageCreateInfo* stages, uint32_t stage_count) const;
     bool ValidatePipelineShaderStage(const PIPELINE_STATE* pipeline, const PipelineStageState& stage_state,
                                      bool check_point_size) const;
     bool ValidatePointListShaderState(const PIPELINE_STATE* pipeline, SHADER_MODULE_STATE const* module_state,
@@ -602,8 +706,8 @@ class CoreChecks : public ValidationStateTracker {
                                             PIPELINE_STATE const* pipeline, uint32_t subpass_index) const;
     bool ValidateFsOutputsAgainstDynamicRenderingRenderPass(SHADER_MODULE_STATE const* module_state, spirv_inst_iter entrypoint,
                                                             PIPELINE_STATE const* pipeline) const;
-    bool ValidatePushConstantUsage(const PIPELINE_STATE& pipeline, SHADER_MODULE_STATE const* module_state,
-                                   safe_VkPipelineShaderStageCreateInfo const* pStage, const std::string& vuid) const;
+    bool ValidatePushConstantUsage(const PIPELINE_STATE& pipeline, const PipelineStageState& stage_state,
+                                   const std::string& vuid) const;
     bool ValidateBuiltinLimits(SHADER_MODULE_STATE const* module_state, spirv_inst_iter entrypoint) const;
     PushConstantByteState ValidatePushConstantSetUpdate(const std::vector<uint8_t>& push_constant_data_update,
                                                         const shader_struct_member& push_constant_used_in_shader,
@@ -621,8 +725,9 @@ class CoreChecks : public ValidationStateTracker {
 
     template <typename RegionType>
     bool ValidateCopyImageTransferGranularityRequirements(const CMD_BUFFER_STATE* cb_node, const IMAGE_STATE* src_img,
-                                                          const IMAGE_STATE* dst_img, const RegionType* region, const uint32_t i,
-                                                          const char* function, CMD_TYPE cmd_type) const;
+                                                          const IMAGE_STATE* dst_img, const VkExtent3D& src_granularity,
+                                                          const VkExtent3D& dst_granularity, const RegionType* region,
+                                                          const uint32_t i, const char* function, CMD_TYPE cmd_type) const;
     bool ValidateIdleBuffer(VkBuffer buffer) const;
     template <typename T1>
     bool ValidateUsageFlags(VkFlags actual, VkFlags desired, VkBool32 strict, const T1 object,
@@ -732,16 +837,26 @@ class CoreChecks : public ValidationStateTracker {
 
     template <typename ImageBarrier>
     bool ValidateBarriersToImages(const Location& loc, const CMD_BUFFER_STATE* cb_state, uint32_t imageMemoryBarrierCount,
-                                  const ImageBarrier* pImageMemoryBarriers) const;
+                                  const ImageBarrier* pImageMemoryBarriers, const BarrierImageStates& image_states) const;
 
     void RecordQueuedQFOTransfers(CMD_BUFFER_STATE* pCB);
 
     template <typename ImgBarrier>
     void TransitionImageLayouts(CMD_BUFFER_STATE* cb_state, uint32_t barrier_count, const ImgBarrier* barrier);
 
-    template <typename ImgBarrier>
-    void RecordTransitionImageLayout(CMD_BUFFER_STATE* cb_state, const IMAGE_STATE* image_state, const ImgBarrier& img_barrier,
-                                     bool is_release_op);
+    // The layout transition of the normalized range of an image by one image barrier, or by consecutive barriers of the image
+    // doing the same transition on adjacent ranges
+    struct ImageLayoutTransition {
+        const IMAGE_STATE* image_state = nullptr;
+        VkImageSubresourceRange range;
+        VkImageLayout initial_layout;
+        VkImageLayout new_layout;
+        bool is_release_op;
+
+        // Extends the range with next's if it is the same transition of an adjacent range of the image
+        bool Merge(const ImageLayoutTransition& next);
+    };
+    void RecordTransitionImageLayout(CMD_BUFFER_STATE* cb_state, const ImageLayoutTransition& transition);
     void RecordBarriers(Func func_name, CMD_BUFFER_STATE* cb_state, uint32_t bufferBarrierCount,
                         const VkBufferMemoryBarrier* pBufferMemBarriers, uint32_t imageMemBarrierCount,
                         const VkImageMemoryBarrier* pImageMemBarriers);
@@ -810,7 +925,15 @@ class CoreChecks : public ValidationStateTracker {
 
     void PreCallRecordCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) override;
 
-    bool ValidateCmdBufImageLayouts(const Location& loc, const CMD_BUFFER_STATE* pCB, GlobalImageLayoutMap& overlayLayoutMap) const;
+    // Limits ValidateCmdBufImageLayouts() to the images a submission shares with its other command buffers, or to the rest.
+    // The layouts of the rest depend on no other command buffer of the submission, see CommandBufferSubmitState.
+    struct SubmitImageFilter {
+        const layer_data::unordered_set<const IMAGE_STATE*>* shared_images;
+        bool shared;
+        bool Includes(const IMAGE_STATE* image_state) const { return (shared_images->count(image_state) != 0) == shared; }
+    };
+    bool ValidateCmdBufImageLayouts(const Location& loc, const CMD_BUFFER_STATE* pCB, GlobalImageLayoutMap& overlayLayoutMap,
+                                    const SubmitImageFilter* filter = nullptr) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
 
@@ -878,9 +1001,10 @@ class CoreChecks : public ValidationStateTracker {
                               const RegionType* pRegions, const char* func_name, const char* msg_code) const;
 
     template <typename RegionType>
+    // granularity is GetScaledItg(cb_node, img), the same for every region of the copy
     bool ValidateCopyBufferImageTransferGranularityRequirements(const CMD_BUFFER_STATE* cb_node, const IMAGE_STATE* img,
-                                                                const RegionType* region, const uint32_t i, const char* function,
-                                                                const char* vuid) const;
+                                                                const VkExtent3D& granularity, const RegionType* region,
+                                                                const uint32_t i, const char* function, const char* vuid) const;
 
     bool ValidateImageMipLevel(const CMD_BUFFER_STATE* cb_node, const IMAGE_STATE* img, uint32_t mip_level, const uint32_t i,
                                const char* function, const char* member, const char* vuid) const;
@@ -897,9 +1021,16 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordCmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) override;
     void PreCallRecordCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) override;
 
+    template <typename RegionType>
+    bool ValidateCmdCopyBufferResources(const CMD_BUFFER_STATE* cb_node, const BUFFER_STATE* src_buffer_state,
+                                        const BUFFER_STATE* dst_buffer_state, uint32_t regionCount, const RegionType* pRegions,
+                                        CMD_TYPE cmd_type) const;
     template <typename RegionType>
     bool ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                const RegionType* pRegions, CMD_TYPE cmd_type) const;
+    template <typename RegionType>
+    void RecordDeferredCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                     const RegionType* pRegions, CMD_TYPE cmd_type);
 
     bool PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                       const VkBufferCopy* pRegions) const override;
@@ -909,16 +1040,26 @@ class CoreChecks : public ValidationStateTracker {
 
     bool PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfos) const override;
 
+    void PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                    const VkBufferCopy* pRegions) override;
+    void PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfos) override;
+    void PreCallRecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfos) override;
+
     bool PreCallValidateDestroyImageView(VkDevice device, VkImageView imageView,
                                          const VkAllocationCallbacks* pAllocator) const override;
 
     bool PreCallValidateDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const override;
+    void PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) override;
 
     bool PreCallValidateDestroyBufferView(VkDevice device, VkBufferView bufferView,
                                           const VkAllocationCallbacks* pAllocator) const override;
 
+    bool ValidateCmdFillBufferResources(const CMD_BUFFER_STATE* cb_node, const BUFFER_STATE* buffer_state, VkDeviceSize dstOffset,
+                                        VkDeviceSize size) const;
     bool PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size,
                                       uint32_t data) const override;
+    void PreCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size,
+                                    uint32_t data) override;
 
     template <typename RegionType>
     bool ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
@@ -1042,8 +1183,12 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
                                      const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const override;
     void CreateDevice(const VkDeviceCreateInfo* pCreateInfo) override;
+    bool ValidateCmdUpdateBufferResources(const CMD_BUFFER_STATE* cb_state, const BUFFER_STATE* dst_buffer_state,
+                                          VkDeviceSize dstOffset, VkDeviceSize dataSize) const;
     bool PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                         VkDeviceSize dataSize, const void* pData) const override;
+    void PreCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                      VkDeviceSize dataSize, const void* pData) override;
     bool PreCallValidateGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex,
                                        VkQueue* pQueue) const override;
     bool PreCallValidateGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) const override;
@@ -1076,6 +1221,7 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                        const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const override;
     bool PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks* pAllocator) const override;
+    void PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks* pAllocator) override;
     bool PreCallValidateCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                         const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const override;
     bool PreCallValidateWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) const override;
@@ -1151,7 +1297,32 @@ class CoreChecks : public ValidationStateTracker {
                                          const char* func_name) const;
     bool PreCallValidateCmdEndRenderingKHR(VkCommandBuffer commandBuffer) const override;
     bool PreCallValidateCmdEndRendering(VkCommandBuffer commandBuffer) const override;
+    // Adds a command whose checks are deferred to vkEndCommandBuffer to the fingerprint of cb_state. parameters is the hash of the
+    // command parameters the checks read, src_buffer_state may be null.
+    void FingerprintDeferredCommand(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, size_t parameters,
+                                    const BUFFER_STATE* src_buffer_state, const BUFFER_STATE* dst_buffer_state) const;
+    size_t DeferredValidationFingerprint(const CMD_BUFFER_STATE& cb_state) const;
+    void RecordCleanDeferredValidation(size_t fingerprint) const;
     bool PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer) const override;
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) override;
+    void DrainAsyncValidation() const;
+    // The deferred checks of a command buffer read its state and that of the buffers it uses without locks, so every hook
+    // that resets or frees the command buffer, or rebinds buffer memory, waits for them first
+    void WaitForCommandBufferValidation(VkCommandBuffer command_buffer);
+    void WaitForCommandPoolValidation(VkCommandPool command_pool);
+    void PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) override;
+    void PreCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) override;
+    void PreCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) override;
+    void PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                         const VkCommandBuffer* pCommandBuffers) override;
+    void PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                         const VkAllocationCallbacks* pAllocator) override;
+    void PreCallRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) override;
+    void PreCallRecordBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) override;
+    void PreCallRecordBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
+                                           const VkBindBufferMemoryInfo* pBindInfos) override;
+    void PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo,
+                                      VkFence fence) override;
     bool PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const override;
     bool PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                         VkPipeline pipeline) const override;
@@ -0,0 +1,172 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "create_info_cache.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#include "vk_layer_data.h"
+
+namespace {
+
+// Keys are built from the fields the safe struct copies, value by value so that padding never takes part in a comparison.
+template <typename T>
+void AppendKey(std::string &key, const T &value) {
+    key.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void AppendQueueFamilies(std::string &key, VkSharingMode sharing_mode, uint32_t count, const uint32_t *indices) {
+    // The safe structs only keep the queue family indices for concurrent sharing
+    if (sharing_mode == VK_SHARING_MODE_CONCURRENT && indices) {
+        AppendKey(key, count);
+        key.append(reinterpret_cast<const char *>(indices), count * sizeof(uint32_t));
+    } else {
+        AppendKey(key, uint32_t(0));
+    }
+}
+
+// Returns false if the chain holds a structure that cannot be compared by value
+bool AppendChain(std::string &key, const void *pnext) {
+    for (auto *header = reinterpret_cast<const VkBaseInStructure *>(pnext); header; header = header->pNext) {
+        AppendKey(key, header->sType);
+        switch (header->sType) {
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+                AppendKey(key, reinterpret_cast<const VkExternalMemoryBufferCreateInfo *>(header)->handleTypes);
+                break;
+            case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+                AppendKey(key, reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo *>(header)->opaqueCaptureAddress);
+                break;
+            case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT:
+                AppendKey(key, reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT *>(header)->deviceAddress);
+                break;
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+                AppendKey(key, reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV *>(header)->dedicatedAllocation);
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+                AppendKey(key, reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(header)->handleTypes);
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+                AppendKey(key, reinterpret_cast<const VkImageStencilUsageCreateInfo *>(header)->stencilUsage);
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+                AppendKey(key, reinterpret_cast<const VkImageSwapchainCreateInfoKHR *>(header)->swapchain);
+                break;
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+                AppendKey(key, reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV *>(header)->dedicatedAllocation);
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: {
+                const auto *format_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(header);
+                AppendKey(key, format_list->viewFormatCount);
+                if (format_list->pViewFormats) {
+                    key.append(reinterpret_cast<const char *>(format_list->pViewFormats),
+                               format_list->viewFormatCount * sizeof(VkFormat));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MakeKey(const VkBufferCreateInfo &ci, std::string &key) {
+    AppendKey(key, ci.flags);
+    AppendKey(key, ci.size);
+    AppendKey(key, ci.usage);
+    AppendKey(key, ci.sharingMode);
+    AppendQueueFamilies(key, ci.sharingMode, ci.queueFamilyIndexCount, ci.pQueueFamilyIndices);
+    return AppendChain(key, ci.pNext);
+}
+
+bool MakeKey(const VkImageCreateInfo &ci, std::string &key) {
+    AppendKey(key, ci.flags);
+    AppendKey(key, ci.imageType);
+    AppendKey(key, ci.format);
+    AppendKey(key, ci.extent.width);
+    AppendKey(key, ci.extent.height);
+    AppendKey(key, ci.extent.depth);
+    AppendKey(key, ci.mipLevels);
+    AppendKey(key, ci.arrayLayers);
+    AppendKey(key, ci.samples);
+    AppendKey(key, ci.tiling);
+    AppendKey(key, ci.usage);
+    AppendKey(key, ci.sharingMode);
+    AppendQueueFamilies(key, ci.sharingMode, ci.queueFamilyIndexCount, ci.pQueueFamilyIndices);
+    AppendKey(key, ci.initialLayout);
+    return AppendChain(key, ci.pNext);
+}
+
+template <typename SafeStruct>
+class CreateInfoCache {
+  public:
+    template <typename CreateInfo>
+    std::shared_ptr<const SafeStruct> Get(const CreateInfo *create_info) {
+        std::string key;
+        if (!MakeKey(*create_info, key)) {
+            return std::shared_ptr<const SafeStruct>(new SafeStruct(create_info));
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        auto &entry = entries_[key];
+        auto shared = entry.lock();
+        if (!shared) {
+            // Not make_shared, so that an expired entry does not keep the struct's storage alive until it is pruned
+            shared = std::shared_ptr<const SafeStruct>(new SafeStruct(create_info));
+            entry = shared;
+            if (entries_.size() >= prune_size_) Prune();
+        }
+        return shared;
+    }
+
+  private:
+    // Drop entries no state object uses anymore, then wait for the cache to double before looking again
+    void Prune() {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.expired()) {
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        const size_t min_prune_size = kMinPruneSize;
+        prune_size_ = std::max(min_prune_size, entries_.size() * 2);
+    }
+
+    static const size_t kMinPruneSize = 256;
+
+    std::mutex lock_;
+    layer_data::unordered_map<std::string, std::weak_ptr<const SafeStruct>> entries_;
+    size_t prune_size_ = kMinPruneSize;
+};
+
+// Leaked on purpose, state objects may be destroyed during static destruction
+template <typename SafeStruct>
+CreateInfoCache<SafeStruct> &GetCache() {
+    static auto *cache = new CreateInfoCache<SafeStruct>;
+    return *cache;
+}
+
+}  // namespace
+
+std::shared_ptr<const safe_VkBufferCreateInfo> GetSharedCreateInfo(const VkBufferCreateInfo *create_info) {
+    return GetCache<safe_VkBufferCreateInfo>().Get(create_info);
+}
+
+std::shared_ptr<const safe_VkImageCreateInfo> GetSharedCreateInfo(const VkImageCreateInfo *create_info) {
+    return GetCache<safe_VkImageCreateInfo>().Get(create_info);
+}
@@ -0,0 +1,30 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+
+#include "vk_safe_struct.h"
+
+// Shared, immutable copies of buffer and image create infos.
+//
+// Applications tend to create most of their buffers and images from a small set of distinct create infos, so state objects
+// hold a reference to a hash-consed copy instead of a deep copy of their own. Create infos are interned when every structure
+// in their pNext chain is one the cache knows how to compare; anything else gets a private copy, exactly as before. Entries
+// are dropped once the last state object using them is gone. The cache is shared by all devices and validation objects.
+std::shared_ptr<const safe_VkBufferCreateInfo> GetSharedCreateInfo(const VkBufferCreateInfo *create_info);
+std::shared_ptr<const safe_VkImageCreateInfo> GetSharedCreateInfo(const VkImageCreateInfo *create_info);
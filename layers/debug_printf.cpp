@@ -20,6 +20,8 @@
 #include "debug_printf.h"
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include "layer_chassis_dispatch.h"
 #include "sync_utils.h"
@@ -52,9 +54,15 @@ void DebugPrintf::PreCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
                                   features);
 }
 
+void DebugPrintf::GetValidationCounters(ValidationCounterList &counters) const {
+    ValidationStateTracker::GetValidationCounters(counters);
+    UtilAddReadbackCounters(async_readback, "DebugPrintf", counters);
+}
+
 // Perform initializations that can be done at Create Device time.
 void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     ValidationStateTracker::CreateDevice(pCreateInfo);
+    housekeeping_.Register("ProcessCompletedReadbacks", [this]() { UtilProcessCompletedReadbacks(this); });
 
     const char *size_string = getLayerOption("khronos_validation.printf_buffer_size");
     output_buffer_size = *size_string ? atoi(size_string) : 1024;
@@ -68,6 +76,22 @@ void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     use_stdout = stdout_string.length() ? !stdout_string.compare("true") : false;
     if (getenv("DEBUG_PRINTF_TO_STDOUT")) use_stdout = true;
 
+    std::string async_readback_string = getLayerOption("khronos_validation.printf_async_readback");
+    transform(async_readback_string.begin(), async_readback_string.end(), async_readback_string.begin(), ::tolower);
+    async_readback.enabled = async_readback_string.length() ? !async_readback_string.compare("true") : false;
+
+    std::string streaming_string = getLayerOption("khronos_validation.printf_streaming");
+    transform(streaming_string.begin(), streaming_string.end(), streaming_string.begin(), ::tolower);
+    stream.enabled = streaming_string.length() ? !streaming_string.compare("true") : false;
+    // Streaming reads the output back asynchronously already
+    if (stream.enabled) async_readback.enabled = false;
+
+    const std::string log_file_name = getLayerOption("khronos_validation.printf_log_file");
+
+    std::string shader_cache_string = getLayerOption("khronos_validation.printf_shader_cache");
+    transform(shader_cache_string.begin(), shader_cache_string.end(), shader_cache_string.begin(), ::tolower);
+    const bool use_shader_cache = shader_cache_string.length() ? !shader_cache_string.compare("true") : true;
+
     if (phys_dev_props.apiVersion < VK_API_VERSION_1_1) {
         ReportSetupProblem(device, "Debug Printf requires Vulkan 1.1 or later.  Debug Printf disabled.");
         aborted = true;
@@ -99,16 +123,56 @@ void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
                                             NULL};
     bindings.push_back(binding);
     UtilPostCallRecordCreateDevice(pCreateInfo, bindings, this, phys_dev_props);
+    if (!aborted && use_shader_cache) shader_cache.Load(GetLayerCacheFilePath("printf_shader_cache"));
+    if (!aborted && !log_file_name.empty()) {
+        log_file = fopen(log_file_name.c_str(), "w");
+        if (!log_file) {
+            ReportSetupProblem(device, "Unable to open the debug printf log file, writing messages to the debug callback instead.");
+        }
+    }
+    if (!aborted && stream.enabled) stream.thread = std::thread(&DebugPrintf::StreamThread, this);
 }
 
 void DebugPrintf::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    StopStream();
     UtilPreCallRecordDestroyDevice(this);
+    if (!shader_cache.Save()) {
+        LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open instrumented shader cache at %s for writing",
+                shader_cache.Path().c_str());
+    }
     ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator);
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
     if (vmaAllocator) {
         vmaDestroyAllocator(vmaAllocator);
     }
     desc_set_manager.reset();
+    if (log_file) {
+        fclose(log_file);
+        log_file = nullptr;
+    }
+}
+
+// Read what is left in the stream and release its resources
+void DebugPrintf::StopStream() {
+    if (!stream.thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> guard(stream.lock);
+        stream.stop = true;
+    }
+    stream.queued.notify_one();
+    stream.thread.join();
+    for (auto fence : stream.free_fences) {
+        DispatchDestroyFence(device, fence, nullptr);
+    }
+    stream.free_fences.clear();
+    for (auto &staging : stream.free_staging) {
+        vmaDestroyBuffer(vmaAllocator, staging.buffer, staging.allocation);
+    }
+    stream.free_staging.clear();
+    for (auto &copy_pool : stream.copy_pools) {
+        DispatchDestroyCommandPool(device, copy_pool.second.pool, nullptr);
+    }
+    stream.copy_pools.clear();
 }
 
 // Modify the pipeline layout to include our debug descriptor set and any needed padding with the dummy descriptor set.
@@ -208,12 +272,10 @@ void DebugPrintf::PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipeli
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                        void *cgpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkGraphicsPipelineCreateInfo> new_pipeline_create_infos;
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, cgpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_GRAPHICS, this);
-    cgpl_state->printf_create_infos = new_pipeline_create_infos;
-    cgpl_state->pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(cgpl_state->printf_create_infos.data());
+                                       &cgpl_state->printf_create_infos, &cgpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_GRAPHICS, this);
 }
 
 void DebugPrintf::PreCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -221,12 +283,10 @@ void DebugPrintf::PreCallRecordCreateComputePipelines(VkDevice device, VkPipelin
                                                       const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                       void *ccpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkComputePipelineCreateInfo> new_pipeline_create_infos;
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, ccpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_COMPUTE, this);
-    ccpl_state->printf_create_infos = new_pipeline_create_infos;
-    ccpl_state->pCreateInfos = reinterpret_cast<VkComputePipelineCreateInfo *>(ccpl_state->printf_create_infos.data());
+                                       &ccpl_state->printf_create_infos, &ccpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_COMPUTE, this);
 }
 
 void DebugPrintf::PreCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -234,12 +294,10 @@ void DebugPrintf::PreCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkPi
                                                            const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                            void *crtpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkRayTracingPipelineCreateInfoCommon> new_pipeline_create_infos;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, crtpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
-    crtpl_state->printf_create_infos = new_pipeline_create_infos;
-    crtpl_state->pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoNV *>(crtpl_state->printf_create_infos.data());
+                                       &crtpl_state->printf_create_infos, &crtpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
 }
 
 void DebugPrintf::PreCallRecordCreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
@@ -248,12 +306,10 @@ void DebugPrintf::PreCallRecordCreateRayTracingPipelinesKHR(VkDevice device, VkD
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             void *crtpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkRayTracingPipelineCreateInfoCommon> new_pipeline_create_infos;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_khr_api_state *>(crtpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, crtpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this);
-    crtpl_state->printf_create_infos = new_pipeline_create_infos;
-    crtpl_state->pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoKHR *>(crtpl_state->printf_create_infos.data());
+                                       &crtpl_state->printf_create_infos, &crtpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this);
 }
 
 void DebugPrintf::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -264,7 +320,8 @@ void DebugPrintf::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                   pPipelines, result, cgpl_state_data);
     if (aborted) return;
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, cgpl_state->printf_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, cgpl_state->printf_create_infos);
+    std::lock_guard<std::mutex> guard(shader_map_lock);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_GRAPHICS, this);
 }
 
@@ -276,7 +333,8 @@ void DebugPrintf::PostCallRecordCreateComputePipelines(VkDevice device, VkPipeli
                                                                  result, ccpl_state_data);
     if (aborted) return;
     create_compute_pipeline_api_state *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, ccpl_state->printf_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, ccpl_state->printf_create_infos);
+    std::lock_guard<std::mutex> guard(shader_map_lock);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_COMPUTE, this);
 }
 
@@ -288,7 +346,8 @@ void DebugPrintf::PostCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkP
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                       pPipelines, result, crtpl_state_data);
     if (aborted) return;
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->printf_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->printf_create_infos);
+    std::lock_guard<std::mutex> guard(shader_map_lock);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
 }
 
@@ -301,12 +360,13 @@ void DebugPrintf::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, Vk
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
         device, deferredOperation, pipelineCache, count, pCreateInfos, pAllocator, pPipelines, result, crtpl_state_data);
     if (aborted) return;
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->printf_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->printf_create_infos);
 
     bool is_operation_deferred = (deferredOperation != VK_NULL_HANDLE && result == VK_OPERATION_DEFERRED_KHR);
     if (is_operation_deferred) {
         std::vector<safe_VkRayTracingPipelineCreateInfoKHR> infos{pCreateInfos, pCreateInfos + count};
         auto register_fn = [this, infos, pAllocator](const std::vector<VkPipeline> &pipelines) {
+            std::lock_guard<std::mutex> guard(shader_map_lock);
             UtilPostCallRecordPipelineCreations(static_cast<uint32_t>(infos.size()),
                                                 reinterpret_cast<const VkRayTracingPipelineCreateInfoKHR *>(infos.data()),
                                                 pAllocator, pipelines.data(), VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this);
@@ -324,13 +384,14 @@ void DebugPrintf::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, Vk
         cleanup_fn.emplace_back(register_fn);
         layer_data->deferred_operation_post_check.insert(deferredOperation, cleanup_fn);
     } else {
+        std::lock_guard<std::mutex> guard(shader_map_lock);
         UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR,
                                             this);
     }
 }
 
 // Remove all the shader trackers associated with this destroyed pipeline.
-void DebugPrintf::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
+static void EraseShaderTrackers(layer_data::unordered_map<uint32_t, DPFShaderTracker> &shader_map, VkPipeline pipeline) {
     for (auto it = shader_map.begin(); it != shader_map.end();) {
         if (it->second.pipeline == pipeline) {
             it = shader_map.erase(it);
@@ -338,14 +399,48 @@ void DebugPrintf::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipel
             ++it;
         }
     }
+}
+
+void DebugPrintf::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
+    bool retired = false;
+    if (stream.enabled) {
+        // Output still in the stream may come from this pipeline
+        std::lock_guard<std::mutex> guard(stream.lock);
+        if (!stream.pending.empty()) {
+            stream.retired_pipelines.emplace_back(pipeline, stream.queued_count);
+            retired = true;
+        }
+    }
+    if (!retired) {
+        std::lock_guard<std::mutex> guard(shader_map_lock);
+        EraseShaderTrackers(shader_map, pipeline);
+    }
     ValidationStateTracker::PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
 }
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+// Called for the pipelines' modules the first time they are used, from any thread (see UtilInstrumentShaderModules()).
 bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo, std::vector<uint32_t> &new_pgm,
-                                   uint32_t *unique_shader_id) {
+                                   uint32_t unique_shader_id) {
+    TraceScope trace("DebugPrintf", "InstrumentShader");
     if (aborted) return false;
     if (pCreateInfo->pCode[0] != spv::MagicNumber) return false;
 
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+
+    // Modules instrumented by an earlier run are taken from the cache, stamped with this module's id
+    const bool use_cache = shader_cache.Enabled() && UtilInstrumentedShaderCache::CanCache(pCreateInfo);
+    UtilInstrumentedShaderCache::Key cache_key = {};
+    if (use_cache) {
+        cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo, UtilInstrumentationOptions(this, target_env));
+        if (shader_cache.Find(cache_key, new_pgm)) {
+            UtilInstrumentedShaderCache::SetShaderId(new_pgm, unique_shader_id);
+            return true;
+        }
+    }
+    const uint32_t placeholder_id = UtilInstrumentedShaderCache::kShaderIdPlaceholder;
+    const uint32_t shader_id = use_cache ? placeholder_id : unique_shader_id;
+
     // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
     new_pgm.clear();
@@ -355,8 +450,6 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     spvtools::ValidatorOptions val_options;
     AdjustValidatorOptions(device_extensions, enabled_features, val_options);
     spvtools::OptimizerOptions opt_options;
@@ -377,24 +470,30 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
     optimizer.SetMessageConsumer(debug_printf_console_message_consumer);
-    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, unique_shader_module_id));
+    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
     }
-    *unique_shader_id = unique_shader_module_id++;
+    if (pass && use_cache) {
+        shader_cache.Insert(cache_key, new_pgm);
+        UtilInstrumentedShaderCache::SetShaderId(new_pgm, unique_shader_id);
+    }
     return pass;
 }
-// Create the instrumented shader data to provide to the driver.
+// Give the module the shader ID its instrumented code will report messages with. The driver gets the application's code,
+// the module is instrumented when a pipeline first uses it.
 void DebugPrintf::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                   void *csm_state_data) {
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
-    bool pass = InstrumentShader(pCreateInfo, csm_state->instrumented_pgm, &csm_state->unique_shader_id);
-    if (pass) {
-        csm_state->instrumented_create_info.pCode = csm_state->instrumented_pgm.data();
-        csm_state->instrumented_create_info.codeSize = csm_state->instrumented_pgm.size() * sizeof(uint32_t);
-    }
+    csm_state->unique_shader_id = unique_shader_module_id++;
+}
+
+void DebugPrintf::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                   const VkAllocationCallbacks *pAllocator) {
+    UtilPreCallRecordDestroyShaderModule(shaderModule, this);
+    ValidationStateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
 }
 
 vartype vartype_lookup(char intype) {
@@ -424,7 +523,7 @@ vartype vartype_lookup(char intype) {
     }
 }
 
-std::vector<DPFSubstring> DebugPrintf::ParseFormatString(const std::string format_string) {
+std::vector<DPFSubstring> DebugPrintf::ParseFormatString(const std::string &format_string) {
     const char types[] = {'d', 'i', 'o', 'u', 'x', 'X', 'a', 'A', 'e', 'E', 'f', 'F', 'g', 'G', 'v', '\0'};
     std::vector<DPFSubstring> parsed_strings;
     size_t pos = 0;
@@ -499,22 +598,69 @@ std::vector<DPFSubstring> DebugPrintf::ParseFormatString(const std::string forma
     return parsed_strings;
 }
 
-std::string DebugPrintf::FindFormatString(std::vector<uint32_t> pgm, uint32_t string_id) {
-    std::string format_string;
-    SHADER_MODULE_STATE module_state(pgm);
-    if (module_state.words.size() > 0) {
-        for (const auto &insn : module_state) {
-            if (insn.opcode() == spv::OpString) {
-                uint32_t offset = insn.offset();
-                if (pgm[offset + 1] == string_id) {
-                    format_string = reinterpret_cast<char *>(&pgm[offset + 2]);
+// Break the format string into steps with 1 or 0 value. 64 bit values are printed with the format macros of <cinttypes> and
+// the text without a value is printed as it is, with its "%%" already resolved.
+DPFFormatProgram DebugPrintf::CompileFormatString(const std::string &format_string) {
+    static const char *const long_specifiers[] = {"%ul", "%lu", "%lx"};
+    DPFFormatProgram program;
+    for (auto &substring : ParseFormatString(format_string)) {
+        DPFFormatStep step = {std::move(substring.string), DPFArgumentNone};
+        size_t ul_pos = std::string::npos;
+        bool print_hex = true;
+        for (const char *long_specifier : long_specifiers) {
+            ul_pos = step.format.find(long_specifier);
+            if (ul_pos != std::string::npos) {
+                print_hex = strcmp(long_specifier, "%lu") != 0;
+                break;
+            }
+        }
+        if (ul_pos != std::string::npos) {
+            // Unsigned 64 bit value
+            step.format.replace(ul_pos + 1, 2, print_hex ? PRIx64 : PRIu64);
+            step.argument = DPFArgumentUint64;
+        } else if (substring.needs_value) {
+            switch (substring.type) {
+                case varunsigned:
+                    step.argument = DPFArgumentUint32;
                     break;
-                }
+                case varsigned:
+                    step.argument = DPFArgumentInt32;
+                    break;
+                case varfloat:
+                    step.argument = DPFArgumentFloat;
+                    break;
+            }
+        } else {
+            std::string text;
+            for (size_t i = 0; i < step.format.size(); ++i) {
+                text.push_back(step.format[i]);
+                if (step.format[i] == '%' && i + 1 < step.format.size() && step.format[i + 1] == '%') ++i;
             }
+            step.format = std::move(text);
         }
+        program.emplace_back(std::move(step));
     }
+    return program;
+}
+
+DPFFormatIndex::DPFFormatIndex(std::shared_ptr<const std::vector<uint32_t>> pgm) : pgm_(std::move(pgm)) {
+    const auto &words = *pgm_;
+    for (size_t offset = 5; offset < words.size();) {
+        const uint32_t length = words[offset] >> 16;
+        const uint32_t opcode = words[offset] & 0xFFFF;
+        if (length == 0 || offset + length > words.size()) break;
+        if (opcode == spv::OpString && length >= 3) {
+            // The literal is nul terminated within the instruction
+            const char *text = reinterpret_cast<const char *>(&words[offset + 2]);
+            programs_.emplace(words[offset + 1], DebugPrintf::CompileFormatString(text));
+        }
+        offset += length;
+    }
+}
 
-    return format_string;
+const DPFFormatProgram *DPFFormatIndex::Find(uint32_t string_id) const {
+    auto it = programs_.find(string_id);
+    return (it == programs_.end()) ? nullptr : &it->second;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -524,29 +670,54 @@ std::string DebugPrintf::FindFormatString(std::vector<uint32_t> pgm, uint32_t st
 #pragma GCC diagnostic ignored "-Wformat-security"
 #endif
 
-void snprintf_with_malloc(std::stringstream &shader_message, DPFSubstring substring, size_t needed, void *values) {
-    char *buffer = static_cast<char *>(malloc((needed + 1) * sizeof(char)));  // Add 1 for terminator
-    if (substring.longval) {
-        snprintf(buffer, needed, substring.string.c_str(), substring.longval);
-    } else if (!substring.needs_value) {
-        snprintf(buffer, needed, substring.string.c_str());
+template <typename T>
+static void AppendFormatted(std::string &message, const char *format, T value) {
+    char text[1024];
+    const int needed = snprintf(text, sizeof(text), format, value);
+    if (needed < 0) return;
+    if (static_cast<size_t>(needed) < sizeof(text)) {
+        message.append(text, needed);
     } else {
-        switch (substring.type) {
-            case varunsigned:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<uint32_t *>(values) - 1);
-                break;
-
-            case varsigned:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<int32_t *>(values) - 1);
-                break;
+        // Static buffer not big enough for message
+        std::vector<char> buffer(needed + 1);
+        snprintf(buffer.data(), buffer.size(), format, value);
+        message.append(buffer.data(), needed);
+    }
+}
 
-            case varfloat:
-                needed = snprintf(buffer, needed, substring.string.c_str(), *static_cast<float *>(values) - 1);
-                break;
+// Prints the step with its value, false if the record has no words left for it
+static bool AppendFormatStep(std::string &message, const DPFFormatStep &step, const uint32_t *&values,
+                             const uint32_t *values_end) {
+    const size_t words = (step.argument == DPFArgumentNone) ? 0 : (step.argument == DPFArgumentUint64) ? 2 : 1;
+    if (values_end - values < static_cast<ptrdiff_t>(words)) return false;
+    switch (step.argument) {
+        case DPFArgumentNone:
+            message += step.format;
+            break;
+        case DPFArgumentUint32:
+            AppendFormatted(message, step.format.c_str(), values[0]);
+            break;
+        case DPFArgumentInt32: {
+            int32_t value;
+            memcpy(&value, values, sizeof(value));
+            AppendFormatted(message, step.format.c_str(), value);
+            break;
+        }
+        case DPFArgumentFloat: {
+            float value;
+            memcpy(&value, values, sizeof(value));
+            AppendFormatted(message, step.format.c_str(), value);
+            break;
+        }
+        case DPFArgumentUint64: {
+            uint64_t value;
+            memcpy(&value, values, sizeof(value));
+            AppendFormatted(message, step.format.c_str(), value);
+            break;
         }
     }
-    shader_message << buffer;
-    free(buffer);
+    values += words;
+    return true;
 }
 
 void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, DPFBufferInfo &buffer_info,
@@ -565,78 +736,39 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     uint32_t expect = debug_output_buffer[0];
     if (!expect) return;
 
+    const uint32_t buffer_words = static_cast<uint32_t>(buffer_info.output_mem_block.size / sizeof(uint32_t));
     uint32_t index = 1;
-    while (debug_output_buffer[index]) {
-        std::stringstream shader_message;
+    while (index < buffer_words && debug_output_buffer[index]) {
+        std::string shader_message;
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
-        std::vector<uint32_t> pgm;
+        std::shared_ptr<const UtilShaderSourceIndex> source_index;
+        std::shared_ptr<const DPFFormatIndex> formats;
 
         DPFOutputRecord *debug_record = reinterpret_cast<DPFOutputRecord *>(&debug_output_buffer[index]);
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
         // by the instrumented shader.
-        auto it = shader_map.find(debug_record->shader_id);
-        if (it != shader_map.end()) {
-            shader_module_handle = it->second.shader_module;
-            pipeline_handle = it->second.pipeline;
-            pgm = it->second.pgm;
-        }
-        // Search through the shader source for the printf format string for this invocation
-        auto format_string = FindFormatString(pgm, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *values = static_cast<void *>(&debug_record->values);
-        const uint32_t static_size = 1024;
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
-            char temp_string[static_size];
-            size_t needed = 0;
-            std::vector<std::string> format_strings = { "%ul", "%lu", "%lx" };
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (auto ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
+        {
+            std::lock_guard<std::mutex> guard(shader_map_lock);
+            auto it = shader_map.find(debug_record->shader_id);
+            if (it != shader_map.end()) {
+                shader_module_handle = it->second.shader_module;
+                pipeline_handle = it->second.pipeline;
+                source_index = UtilMessageSourceIndex(it->second);
+                auto &tracker_formats = it->second.formats;
+                if (it->second.pgm && (!tracker_formats || tracker_formats->Pgm() != it->second.pgm)) {
+                    tracker_formats = std::make_shared<const DPFFormatIndex>(it->second.pgm);
                 }
+                formats = tracker_formats;
             }
-            if (ul_pos != std::string::npos) {
-                // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
-                values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
-                needed = snprintf(temp_string, static_size, substring.string.c_str(), substring.longval);
-            } else {
-                if (substring.needs_value) {
-                    switch (substring.type) {
-                        case varunsigned:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<uint32_t *>(values));
-                            break;
-
-                        case varsigned:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<int32_t *>(values));
-                            break;
-
-                        case varfloat:
-                            needed = snprintf(temp_string, static_size, substring.string.c_str(), *static_cast<float *>(values));
-                            break;
-                    }
-                    values = static_cast<uint32_t *>(values) + 1;
-                } else {
-                    needed = snprintf(temp_string, static_size, substring.string.c_str());
-                }
-            }
-
-            if (needed < static_size) {
-                shader_message << temp_string;
-            } else {
-                // Static buffer not big enough for message, use malloc to get enough
-                snprintf_with_malloc(shader_message, substring, needed, values);
+        }
+        // Apply the compiled printf format string of this invocation to the values of the record
+        const DPFFormatProgram *format_program = formats ? formats->Find(debug_record->format_string_id) : nullptr;
+        if (format_program) {
+            const uint32_t *values = &debug_record->values;
+            const uint32_t *values_end = &debug_output_buffer[std::min(index + debug_record->size, buffer_words)];
+            for (const auto &step : *format_program) {
+                if (!AppendFormatStep(shader_message, step, values, values_end)) break;
             }
         }
 
@@ -647,36 +779,105 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
             std::string source_message;
             UtilGenerateStageMessage(&debug_output_buffer[index], stage_message);
             UtilGenerateCommonMessage(report_data, command_buffer, &debug_output_buffer[index], shader_module_handle,
-                                      pipeline_handle, buffer_info.pipeline_bind_point, operation_index, common_message);
-            UtilGenerateSourceMessages(pgm, &debug_output_buffer[index], true, filename_message, source_message);
-            if (use_stdout) {
+                                      source_index.get(), pipeline_handle, buffer_info.pipeline_bind_point, operation_index,
+                                      common_message);
+            UtilGenerateSourceMessages(source_index.get(), &debug_output_buffer[index], true, filename_message, source_message);
+            if (log_file) {
+                std::lock_guard<std::mutex> guard(log_file_lock);
+                fprintf(log_file, "UNASSIGNED-DEBUG-PRINTF %s %s %s %s %s", common_message.c_str(), stage_message.c_str(),
+                        shader_message.c_str(), filename_message.c_str(), source_message.c_str());
+            } else if (use_stdout) {
                 std::cout << "UNASSIGNED-DEBUG-PRINTF " << common_message.c_str() << " " << stage_message.c_str() << " "
-                          << shader_message.str().c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
+                          << shader_message.c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
             } else {
                 LogInfo(queue, "UNASSIGNED-DEBUG-PRINTF", "%s %s %s %s%s", common_message.c_str(), stage_message.c_str(),
-                        shader_message.str().c_str(), filename_message.c_str(), source_message.c_str());
+                        shader_message.c_str(), filename_message.c_str(), source_message.c_str());
             }
         } else {
-            if (use_stdout) {
-                std::cout << shader_message.str();
+            if (log_file) {
+                std::lock_guard<std::mutex> guard(log_file_lock);
+                fputs(shader_message.c_str(), log_file);
+            } else if (use_stdout) {
+                std::cout << shader_message;
             } else {
                 // Don't let LogInfo process any '%'s in the string
-                LogInfo(device, "UNASSIGNED-DEBUG-PRINTF", "%s", shader_message.str().c_str());
+                LogInfo(device, "UNASSIGNED-DEBUG-PRINTF", "%s", shader_message.c_str());
             }
         }
         index += debug_record->size;
     }
-    if ((index - 1) != expect) {
+    if (log_file) {
+        std::lock_guard<std::mutex> guard(log_file_lock);
+        fflush(log_file);
+    }
+    // The first word counts all the words the shaders tried to write, including the ones that didn't fit
+    const uint64_t needed_size = (static_cast<uint64_t>(expect) + 1) * sizeof(uint32_t);
+    if (stream.enabled && needed_size > buffer_info.output_mem_block.size) {
+        const uint32_t max_size = kMaxStreamingBufferSize;
+        uint32_t new_size = output_buffer_size.load();
+        while (new_size < needed_size && new_size < max_size) {
+            new_size = std::max(new_size * 2, 1024u);
+        }
+        new_size = std::min(new_size, max_size);
+        uint32_t current_size = output_buffer_size.load();
+        while (current_size < new_size && !output_buffer_size.compare_exchange_weak(current_size, new_size)) {
+        }
+        LogWarning(device, "UNASSIGNED-DEBUG-PRINTF",
+                   "WARNING - Debug Printf output of %" PRIu64 " bytes was truncated to the %" PRIu64
+                   " bytes of its buffer. Command buffers recorded from now on use %" PRIu32 " byte buffers.",
+                   needed_size, static_cast<uint64_t>(buffer_info.output_mem_block.size), output_buffer_size.load());
+    } else if ((index - 1) != expect) {
         LogWarning(device, "UNASSIGNED-DEBUG-PRINTF",
                    "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
     }
-    memset(debug_output_buffer, 0, 4 * (debug_output_buffer[0] + 1));
+    memset(debug_output_buffer, 0, static_cast<size_t>(std::min(needed_size, buffer_info.output_mem_block.size)));
 }
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif
 
+// Output of an earlier submission still to be read would be overwritten
+void DebugPrintf::PreRecordCommandBuffer(VkCommandBuffer command_buffer) {
+    if (!async_readback.enabled) return;
+    auto cb_node = Get<debug_printf_state::CommandBuffer>(command_buffer);
+    UtilWaitForReadbacks(this, cb_node.get());
+    for (const auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
+        UtilWaitForReadbacks(this, secondary_cmd_buffer);
+    }
+}
+
+void DebugPrintf::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            PreRecordCommandBuffer(submit->pCommandBuffers[i]);
+        }
+    }
+}
+
+void DebugPrintf::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                               VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo2KHR *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+            PreRecordCommandBuffer(submit->pCommandBufferInfos[i].commandBuffer);
+        }
+    }
+}
+
+void DebugPrintf::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+            PreRecordCommandBuffer(submit->pCommandBufferInfos[i].commandBuffer);
+        }
+    }
+}
+
 bool DebugPrintf::CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) {
     bool buffers_present = false;
     auto cb_node = Get<debug_printf_state::CommandBuffer>(command_buffer);
@@ -691,9 +892,225 @@ bool DebugPrintf::CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) {
     return buffers_present;
 }
 
-void DebugPrintf::ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer) {
-    auto cb_node = Get<debug_printf_state::CommandBuffer>(command_buffer);
-    UtilProcessInstrumentationBuffer(queue, cb_node.get(), this);
+// Copy the output of command_buffers, just submitted to queue, to a staging buffer and queue it for the stream thread. Returns
+// false, with the output left in the output blocks, if the copy can't be submitted.
+bool DebugPrintf::QueueStreamReadback(VkQueue queue, const std::vector<std::shared_ptr<CMD_BUFFER_STATE>> &command_buffers) {
+    DPFStreamReadback readback = {};
+    readback.queue = queue;
+    std::vector<const DPFDeviceMemoryBlock *> output_blocks;
+    VkDeviceSize staging_size = 0;
+    auto add_blocks = [&](const CMD_BUFFER_STATE *cb_state) {
+        uint32_t draw_index = 0;
+        uint32_t compute_index = 0;
+        uint32_t ray_trace_index = 0;
+        readback.sources.push_back(cb_state);
+        for (const auto &buffer_info : GetBufferInfo(cb_state)) {
+            uint32_t operation_index = 0;
+            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+                operation_index = draw_index++;
+            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+                operation_index = compute_index++;
+            } else {
+                operation_index = ray_trace_index++;
+            }
+            const DPFStagedBlock block = {cb_state->commandBuffer(), buffer_info.pipeline_bind_point, operation_index, staging_size,
+                                          buffer_info.output_mem_block.size};
+            readback.blocks.push_back(block);
+            output_blocks.push_back(&buffer_info.output_mem_block);
+            staging_size += buffer_info.output_mem_block.size;
+        }
+    };
+    for (const auto &cb_state : command_buffers) {
+        if (!cb_state) continue;
+        add_blocks(cb_state.get());
+        for (const auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
+            add_blocks(secondary_cmd_buffer);
+        }
+    }
+    if (readback.blocks.empty()) return true;
+
+    DPFCopyCommandPool *copy_pool = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(stream.lock);
+        if (!stream.free_fences.empty()) {
+            readback.fence = stream.free_fences.back();
+            stream.free_fences.pop_back();
+        }
+        for (auto it = stream.free_staging.begin(); it != stream.free_staging.end(); ++it) {
+            if (it->size >= staging_size) {
+                readback.staging = *it;
+                stream.free_staging.erase(it);
+                break;
+            }
+        }
+        copy_pool = &stream.copy_pools[queue];
+        if (!copy_pool->free_command_buffers.empty()) {
+            readback.copy_command_buffer = copy_pool->free_command_buffers.back();
+            copy_pool->free_command_buffers.pop_back();
+        }
+    }
+
+    VkResult result = VK_SUCCESS;
+    if (readback.fence == VK_NULL_HANDLE) {
+        auto fence_ci = LvlInitStruct<VkFenceCreateInfo>();
+        result = DispatchCreateFence(device, &fence_ci, nullptr, &readback.fence);
+    }
+    if (result == VK_SUCCESS && readback.staging.buffer == VK_NULL_HANDLE) {
+        VkDeviceSize size = 64 * 1024;
+        while (size < staging_size) size *= 2;
+        auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+        buffer_ci.size = size;
+        buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        VmaAllocationCreateInfo alloc_ci = {};
+        alloc_ci.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
+        alloc_ci.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        VmaAllocationInfo alloc_info = {};
+        result = vmaCreateBuffer(vmaAllocator, &buffer_ci, &alloc_ci, &readback.staging.buffer, &readback.staging.allocation,
+                                 &alloc_info);
+        if (result == VK_SUCCESS) {
+            readback.staging.data = static_cast<uint32_t *>(alloc_info.pMappedData);
+            readback.staging.size = size;
+        } else {
+            readback.staging.buffer = VK_NULL_HANDLE;
+        }
+    }
+    if (result == VK_SUCCESS && copy_pool->pool == VK_NULL_HANDLE) {
+        auto queue_state = Get<QUEUE_STATE>(queue);
+        auto pool_ci = LvlInitStruct<VkCommandPoolCreateInfo>();
+        pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_ci.queueFamilyIndex = queue_state ? queue_state->queueFamilyIndex : 0;
+        result = DispatchCreateCommandPool(device, &pool_ci, nullptr, &copy_pool->pool);
+        if (result != VK_SUCCESS) copy_pool->pool = VK_NULL_HANDLE;
+    }
+    if (result == VK_SUCCESS && readback.copy_command_buffer == VK_NULL_HANDLE) {
+        auto alloc_ci = LvlInitStruct<VkCommandBufferAllocateInfo>();
+        alloc_ci.commandPool = copy_pool->pool;
+        alloc_ci.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_ci.commandBufferCount = 1;
+        result = DispatchAllocateCommandBuffers(device, &alloc_ci, &readback.copy_command_buffer);
+        if (result == VK_SUCCESS) {
+            vkSetDeviceLoaderData(device, readback.copy_command_buffer);
+        } else {
+            readback.copy_command_buffer = VK_NULL_HANDLE;
+        }
+    }
+
+    if (result == VK_SUCCESS) {
+        auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        result = DispatchBeginCommandBuffer(readback.copy_command_buffer, &begin_info);
+    }
+    if (result == VK_SUCCESS) {
+        const VkCommandBuffer copy_cb = readback.copy_command_buffer;
+        auto barrier = LvlInitStruct<VkMemoryBarrier>();
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        DispatchCmdPipelineBarrier(copy_cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                                   nullptr, 0, nullptr);
+        for (size_t i = 0; i < output_blocks.size(); ++i) {
+            const VkBufferCopy region = {output_blocks[i]->offset, readback.blocks[i].offset, readback.blocks[i].size};
+            DispatchCmdCopyBuffer(copy_cb, output_blocks[i]->buffer, readback.staging.buffer, 1, &region);
+        }
+        // Clear the blocks for the next submission once they have been copied
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        DispatchCmdPipelineBarrier(copy_cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                                   nullptr, 0, nullptr);
+        for (size_t i = 0; i < output_blocks.size(); ++i) {
+            DispatchCmdFillBuffer(copy_cb, output_blocks[i]->buffer, output_blocks[i]->offset, readback.blocks[i].size, 0);
+        }
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        DispatchCmdPipelineBarrier(copy_cb, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0,
+                                   nullptr);
+        result = DispatchEndCommandBuffer(copy_cb);
+    }
+    if (result == VK_SUCCESS) {
+        auto submit_info = LvlInitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &readback.copy_command_buffer;
+        result = DispatchQueueSubmit(queue, 1, &submit_info, readback.fence);
+    }
+
+    std::unique_lock<std::mutex> guard(stream.lock);
+    if (result == VK_SUCCESS) {
+        stream.pending.emplace_back(std::move(readback));
+        ++stream.queued_count;
+        guard.unlock();
+        stream.queued.notify_one();
+        return true;
+    }
+    // Nothing was submitted, so whatever was acquired can be used again
+    if (readback.fence != VK_NULL_HANDLE) stream.free_fences.push_back(readback.fence);
+    if (readback.staging.buffer != VK_NULL_HANDLE) stream.free_staging.push_back(readback.staging);
+    if (readback.copy_command_buffer != VK_NULL_HANDLE) copy_pool->free_command_buffers.push_back(readback.copy_command_buffer);
+    guard.unlock();
+    ReportSetupProblem(device, "Unable to stream debug printf output, waiting for the queue instead.");
+    return false;
+}
+
+// Wait for the staged output in order of submission, and turn it into messages
+void DebugPrintf::StreamThread() {
+    std::unique_lock<std::mutex> guard(stream.lock);
+    while (true) {
+        stream.queued.wait(guard, [this]() { return stream.stop || !stream.pending.empty(); });
+        if (stream.pending.empty()) break;
+        // Only this thread removes readbacks, and a deque keeps references to its elements valid when others are added
+        auto &readback = stream.pending.front();
+        guard.unlock();
+
+        // If the wait fails the device is lost, and the output will never be written
+        const bool signaled = DispatchWaitForFences(device, 1, &readback.fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS;
+        if (signaled) {
+            vmaInvalidateAllocation(vmaAllocator, readback.staging.allocation, 0, VK_WHOLE_SIZE);
+            for (const auto &block : readback.blocks) {
+                const DPFDeviceMemoryBlock staged = {readback.staging.buffer, readback.staging.allocation, block.offset,
+                                                     block.size};
+                DPFBufferInfo buffer_info(staged, VK_NULL_HANDLE, VK_NULL_HANDLE, block.pipeline_bind_point);
+                AnalyzeAndGenerateMessages(block.command_buffer, readback.queue, buffer_info, block.operation_index,
+                                           readback.staging.data + block.offset / sizeof(uint32_t));
+            }
+        }
+
+        guard.lock();
+        if (signaled && DispatchResetFences(device, 1, &readback.fence) == VK_SUCCESS) {
+            stream.free_fences.push_back(readback.fence);
+        } else {
+            DispatchDestroyFence(device, readback.fence, nullptr);
+        }
+        stream.free_staging.push_back(readback.staging);
+        stream.copy_pools[readback.queue].free_command_buffers.push_back(readback.copy_command_buffer);
+        stream.pending.pop_front();
+        ++stream.finished_count;
+        for (auto it = stream.retired_pipelines.begin(); it != stream.retired_pipelines.end();) {
+            if (it->second <= stream.finished_count) {
+                std::lock_guard<std::mutex> shader_map_guard(shader_map_lock);
+                EraseShaderTrackers(shader_map, it->first);
+                it = stream.retired_pipelines.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        stream.finished.notify_all();
+    }
+}
+
+void DebugPrintf::WaitForStream(const CMD_BUFFER_STATE *cb_state) {
+    if (!stream.enabled) return;
+    std::unique_lock<std::mutex> guard(stream.lock);
+    stream.finished.wait(guard, [this, cb_state]() {
+        for (const auto &readback : stream.pending) {
+            if (!cb_state || std::find(readback.sources.begin(), readback.sources.end(), cb_state) != readback.sources.end()) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+void DebugPrintf::ProcessCommandBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
+    UtilProcessInstrumentationBuffer(queue, cb_node, this);
     for (auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
         UtilProcessInstrumentationBuffer(queue, secondary_cmd_buffer, this);
     }
@@ -707,6 +1124,7 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessCompletedReadbacks(this);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -717,6 +1135,21 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
+    if (stream.enabled || async_readback.enabled) {
+        std::vector<std::shared_ptr<CMD_BUFFER_STATE>> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+                command_buffers.emplace_back(Get<CMD_BUFFER_STATE>(submit->pCommandBuffers[i]));
+            }
+        }
+        if (!stream.enabled) {
+            UtilQueueReadback(queue, std::move(command_buffers), this);
+            return;
+        }
+        if (QueueStreamReadback(queue, command_buffers)) return;
+    }
+
     UtilSubmitBarrier(queue, this);
 
     DispatchQueueWaitIdle(queue);
@@ -724,7 +1157,7 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBuffers[i]);
+            ProcessCommandBuffer(queue, Get<CMD_BUFFER_STATE>(submit->pCommandBuffers[i]).get());
         }
     }
 }
@@ -732,6 +1165,7 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
 void DebugPrintf::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                      VkResult result) {
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessCompletedReadbacks(this);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -742,6 +1176,21 @@ void DebugPrintf::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     }
     if (!buffers_present) return;
 
+    if (stream.enabled || async_readback.enabled) {
+        std::vector<std::shared_ptr<CMD_BUFFER_STATE>> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+                command_buffers.emplace_back(Get<CMD_BUFFER_STATE>(submit->pCommandBufferInfos[i].commandBuffer));
+            }
+        }
+        if (!stream.enabled) {
+            UtilQueueReadback(queue, std::move(command_buffers), this);
+            return;
+        }
+        if (QueueStreamReadback(queue, command_buffers)) return;
+    }
+
     UtilSubmitBarrier(queue, this);
 
     DispatchQueueWaitIdle(queue);
@@ -749,7 +1198,7 @@ void DebugPrintf::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBufferInfos[i].commandBuffer);
+            ProcessCommandBuffer(queue, Get<CMD_BUFFER_STATE>(submit->pCommandBufferInfos[i].commandBuffer).get());
         }
     }
 }
@@ -766,6 +1215,30 @@ void DebugPrintf::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount
     RecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
 }
 
+void DebugPrintf::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessCompletedReadbacks(this);
+    // The GPU is done, so this only waits for the messages to be written out
+    WaitForStream();
+}
+
+void DebugPrintf::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessCompletedReadbacks(this);
+    WaitForStream();
+}
+
+void DebugPrintf::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                        uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
+void DebugPrintf::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
 void DebugPrintf::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                        uint32_t firstVertex, uint32_t firstInstance) {
     AllocateDebugPrintfResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS);
@@ -960,8 +1433,9 @@ void DebugPrintf::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer,
         return;
     }
 
+    const uint32_t buffer_size = output_buffer_size.load();
     VkDescriptorBufferInfo output_desc_buffer_info = {};
-    output_desc_buffer_info.range = output_buffer_size;
+    output_desc_buffer_info.range = buffer_size;
 
     auto cb_node = Get<debug_printf_state::CommandBuffer>(cmd_buffer);
     if (!cb_node) {
@@ -983,8 +1457,10 @@ void DebugPrintf::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer,
     // Allocate memory for the output block that the gpu will use to return values for printf
     DPFDeviceMemoryBlock output_block = {};
     VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    buffer_info.size = output_buffer_size;
+    buffer_info.size = buffer_size;
     buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    // Streaming copies the output out and clears the block on the GPU
+    if (stream.enabled) buffer_info.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
     VmaAllocationCreateInfo alloc_info = {};
     alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
     result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
@@ -993,12 +1469,13 @@ void DebugPrintf::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer,
         aborted = true;
         return;
     }
+    output_block.size = buffer_size;
 
     // Clear the output block to zeros so that only printf values from the gpu will be present
     uint32_t *data;
     result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data));
     if (result == VK_SUCCESS) {
-        memset(data, 0, output_buffer_size);
+        memset(data, 0, buffer_size);
         vmaUnmapMemory(vmaAllocator, output_block.allocation);
     }
 
@@ -1044,8 +1521,11 @@ debug_printf_state::CommandBuffer::CommandBuffer(DebugPrintf *dp, VkCommandBuffe
     : CMD_BUFFER_STATE(dp, cb, pCreateInfo, pool) {}
 
 void debug_printf_state::CommandBuffer::Reset() {
-    CMD_BUFFER_STATE::Reset();
     auto debug_printf = static_cast<DebugPrintf *>(dev_data);
+    // Read any output not read yet before the buffers holding it go away
+    UtilWaitForReadbacks(debug_printf, this);
+    debug_printf->WaitForStream(this);
+    CMD_BUFFER_STATE::Reset();
     // Free the device memory and descriptor set(s) associated with a command buffer.
     if (debug_printf->aborted) {
         return;
@@ -23,12 +23,19 @@
 #include "vk_mem_alloc.h"
 #include "state_tracker.h"
 #include "gpu_utils.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
 #include <map>
+#include <thread>
 class DebugPrintf;
 
 struct DPFDeviceMemoryBlock {
     VkBuffer buffer;
     VmaAllocation allocation;
+    // Where the block starts in buffer
+    VkDeviceSize offset;
+    VkDeviceSize size;
 };
 
 struct DPFBufferInfo {
@@ -41,18 +48,98 @@ struct DPFBufferInfo {
         : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
 };
 
-struct DPFShaderTracker {
-    VkPipeline pipeline;
-    VkShaderModule shader_module;
-    std::vector<uint32_t> pgm;
-};
-
 enum vartype { varsigned, varunsigned, varfloat };
 struct DPFSubstring {
     std::string string;
     bool needs_value;
     vartype type;
-    uint64_t longval = 0;
+};
+
+// How the value words of an output record are read for one step of a format program
+enum DPFArgument { DPFArgumentNone, DPFArgumentUint32, DPFArgumentInt32, DPFArgumentFloat, DPFArgumentUint64 };
+struct DPFFormatStep {
+    // Passed to snprintf with the value, or printed as is without one
+    std::string format;
+    DPFArgument argument;
+};
+// A format string split into steps printing at most one value each, so that decoding a record only formats its values
+using DPFFormatProgram = std::vector<DPFFormatStep>;
+
+// The format programs of every OpString of a shader, compiled the first time a record of the shader is decoded
+class DPFFormatIndex {
+  public:
+    explicit DPFFormatIndex(std::shared_ptr<const std::vector<uint32_t>> pgm);
+
+    const std::shared_ptr<const std::vector<uint32_t>>& Pgm() const { return pgm_; }
+    const DPFFormatProgram* Find(uint32_t string_id) const;
+
+  private:
+    std::shared_ptr<const std::vector<uint32_t>> pgm_;
+    layer_data::unordered_map<uint32_t, DPFFormatProgram> programs_;
+};
+
+struct DPFShaderTracker {
+    VkPipeline pipeline;
+    VkShaderModule shader_module;
+    // Shared with the SHADER_MODULE_STATE, see GetSharedSpirv()
+    std::shared_ptr<const std::vector<uint32_t>> pgm;
+    std::shared_ptr<const UtilShaderSourceIndex> source_index;
+    // Of pgm, rebuilt if the tracker gets another one
+    std::shared_ptr<const DPFFormatIndex> formats;
+};
+
+// Streaming readback (printf_streaming). After each submission a copy command buffer moves the output blocks of the command
+// buffers submitted to a persistently mapped staging buffer and clears them on the GPU, so that the command buffers can be
+// submitted again or reset without waiting for their output to be read. A background thread waits for the copies and turns
+// the staged output into messages. Staging buffers are recycled, the one being filled by the GPU and the one being read by
+// the thread alternating in the steady state.
+struct DPFStagingBuffer {
+    VkBuffer buffer;
+    VmaAllocation allocation;
+    uint32_t *data;
+    VkDeviceSize size;
+};
+
+struct DPFStagedBlock {
+    VkCommandBuffer command_buffer;
+    VkPipelineBindPoint pipeline_bind_point;
+    uint32_t operation_index;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+};
+
+struct DPFStreamReadback {
+    VkQueue queue;
+    VkFence fence;
+    VkCommandBuffer copy_command_buffer;
+    DPFStagingBuffer staging;
+    std::vector<DPFStagedBlock> blocks;
+    // The command buffers whose output blocks are copied, which must not be destroyed before the copy has executed
+    std::vector<const CMD_BUFFER_STATE*> sources;
+};
+
+struct DPFCopyCommandPool {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> free_command_buffers;
+};
+
+struct DPFStreamState {
+    bool enabled = false;
+    bool stop = false;
+    std::mutex lock;
+    // Signaled when a readback is queued, and when the drain thread has finished one
+    std::condition_variable queued;
+    std::condition_variable finished;
+    std::deque<DPFStreamReadback> pending;
+    uint64_t queued_count = 0;
+    uint64_t finished_count = 0;
+    // Destroyed pipelines whose shaders are kept in the shader map until the readbacks queued before them are read
+    std::vector<std::pair<VkPipeline, uint64_t>> retired_pipelines;
+    std::vector<VkFence> free_fences;
+    std::vector<DPFStagingBuffer> free_staging;
+    // Only used by submissions to their queue, which the application synchronizes
+    std::map<VkQueue, DPFCopyCommandPool> copy_pools;
+    std::thread thread;
 };
 
 struct DPFOutputRecord {
@@ -90,6 +177,7 @@ class DebugPrintf : public ValidationStateTracker {
     void PreCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
                                    const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, void* modified_create_info) override;
     void CreateDevice(const VkDeviceCreateInfo* pCreateInfo) override;
+    void GetValidationCounters(ValidationCounterList& counters) const override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
     void PreCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout,
@@ -143,14 +231,21 @@ class DebugPrintf : public ValidationStateTracker {
                                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                     VkResult result, void* crtpl_state_data) override;
     void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) override;
-    bool InstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<uint32_t>& new_pgm, uint32_t* unique_shader_id);
+    bool InstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<uint32_t>& new_pgm, uint32_t unique_shader_id);
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          void* csm_state_data) override;
-    std::vector<DPFSubstring> ParseFormatString(std::string format_string);
-    std::string FindFormatString(std::vector<uint32_t> pgm, uint32_t string_id);
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                          const VkAllocationCallbacks* pAllocator) override;
+    static std::vector<DPFSubstring> ParseFormatString(const std::string& format_string);
+    static DPFFormatProgram CompileFormatString(const std::string& format_string);
     void AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, DPFBufferInfo &buffer_info,
                                     uint32_t operation_index, uint32_t* const debug_output_buffer);
+    bool QueueStreamReadback(VkQueue queue, const std::vector<std::shared_ptr<CMD_BUFFER_STATE>>& command_buffers);
+    // Wait until the stream has read the output of cb_state, or all of its output if cb_state is null
+    void WaitForStream(const CMD_BUFFER_STATE* cb_state = nullptr);
+    void StreamThread();
+    void StopStream();
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
                               uint32_t firstInstance) override;
     void PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
@@ -238,6 +333,16 @@ class DebugPrintf : public ValidationStateTracker {
                                        VkResult result) override;
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
                                     VkResult result) override;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits,
+                                      VkFence fence) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) override;
+    void ProcessCommandBuffer(VkQueue queue, CMD_BUFFER_STATE* cb_node);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
     void AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point);
 
     std::shared_ptr<SHADER_MODULE_STATE> GetShaderModuleState(VkShaderModule shader_module) {
@@ -265,13 +370,18 @@ class DebugPrintf : public ValidationStateTracker {
     void DestroyBuffer(DPFBufferInfo& buffer_info);
 
 private:
+    void PreRecordCommandBuffer(VkCommandBuffer command_buffer);
     bool CommandBufferNeedsProcessing(VkCommandBuffer command_buffer);
-    void ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
     VkPhysicalDeviceFeatures supported_features;
 
     uint32_t unique_shader_module_id = 0;
-    uint32_t output_buffer_size;
+    // Grows when streaming and the GPU wrote more than the buffers could hold
+    std::atomic<uint32_t> output_buffer_size;
+    static const uint32_t kMaxStreamingBufferSize = 16 * 1024 * 1024;
+    // Output files are written to by the stream thread and the threads reading output back
+    FILE* log_file = nullptr;
+    std::mutex log_file_lock;
 
 public:
     bool aborted = false;
@@ -283,7 +393,15 @@ public:
     VkDescriptorSetLayout dummy_desc_layout = VK_NULL_HANDLE;
     std::unique_ptr<UtilDescriptorSetManager> desc_set_manager;
     layer_data::unordered_map<uint32_t, DPFShaderTracker> shader_map;
+    // The stream thread reads shader_map while pipelines are being created and destroyed
+    std::mutex shader_map_lock;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     VmaAllocator vmaAllocator = {};
     std::map<VkQueue, UtilQueueBarrierCommandInfo> queue_barrier_command_infos;
+    UtilAsyncReadbackState async_readback;
+    DPFStreamState stream;
+    UtilInstrumentedShaderCache shader_cache;
+    UtilInstrumentedModules instrumented_modules;
+    // Left unset, debug printf instruments every shader
+    UtilInstrumentationFilter instrumentation_filter;
 };
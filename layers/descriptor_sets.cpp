@@ -25,6 +25,7 @@
 #include "core_validation.h"
 #include "descriptor_sets.h"
 #include "hash_vk_types.h"
+#include "hook_timing.h"
 #include "vk_enum_string_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
@@ -46,6 +47,15 @@ static DESCRIPTOR_POOL_STATE::TypeCountMap GetMaxTypeCounts(const VkDescriptorPo
     return counts;
 }
 
+static DESCRIPTOR_POOL_STATE::TypeCountMap GetTypeCountSlots(const DESCRIPTOR_POOL_STATE::TypeCountMap &max_counts) {
+    DESCRIPTOR_POOL_STATE::TypeCountMap slots;
+    for (const auto &entry : max_counts) {
+        const uint32_t slot = static_cast<uint32_t>(slots.size());
+        slots.emplace(entry.first, slot);
+    }
+    return slots;
+}
+
 DESCRIPTOR_POOL_STATE::DESCRIPTOR_POOL_STATE(ValidationStateTracker *dev, const VkDescriptorPool pool,
                                              const VkDescriptorPoolCreateInfo *pCreateInfo)
     : BASE_NODE(pool, kVulkanObjectTypeDescriptorPool),
@@ -53,16 +63,25 @@ DESCRIPTOR_POOL_STATE::DESCRIPTOR_POOL_STATE(ValidationStateTracker *dev, const
       createInfo(pCreateInfo),
       maxDescriptorTypeCount(GetMaxTypeCounts(pCreateInfo)),
       available_sets_(pCreateInfo->maxSets),
-      available_counts_(maxDescriptorTypeCount),
-      dev_data_(dev) {}
+      count_slots_(GetTypeCountSlots(maxDescriptorTypeCount)),
+      available_counts_(new std::atomic<uint32_t>[count_slots_.size()]),
+      dev_data_(dev),
+      recycler_(std::make_shared<cvdescriptorset::DescriptorSetRecycler>(pCreateInfo->maxSets)) {
+    for (const auto &entry : count_slots_) {
+        available_counts_[entry.second].store(maxDescriptorTypeCount.at(entry.first), std::memory_order_relaxed);
+    }
+}
 
 void DESCRIPTOR_POOL_STATE::Allocate(const VkDescriptorSetAllocateInfo *alloc_info, const VkDescriptorSet *descriptor_sets,
                                      const cvdescriptorset::AllocateDescriptorSetsData *ds_data) {
-    auto guard = WriteLock();
-    // Account for sets and individual descriptors allocated from pool
-    available_sets_ -= alloc_info->descriptorSetCount;
-    for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
-        available_counts_[it->first] -= ds_data->required_descriptors_by_type.at(it->first);
+    // Account for sets and individual descriptors allocated from pool. Types the pool has no descriptors of are left
+    // alone, they always have none available.
+    available_sets_.fetch_sub(alloc_info->descriptorSetCount, std::memory_order_acq_rel);
+    for (const auto &required : ds_data->required_descriptors_by_type) {
+        auto slot = count_slots_.find(required.first);
+        if (slot != count_slots_.end()) {
+            available_counts_[slot->second].fetch_sub(required.second, std::memory_order_acq_rel);
+        }
     }
 
     const auto *variable_count_info = LvlFindInChain<VkDescriptorSetVariableDescriptorCountAllocateInfo>(alloc_info->pNext);
@@ -74,49 +93,52 @@ void DESCRIPTOR_POOL_STATE::Allocate(const VkDescriptorSetAllocateInfo *alloc_in
 
         auto new_ds = std::make_shared<cvdescriptorset::DescriptorSet>(descriptor_sets[i], this, ds_data->layout_nodes[i],
                                                                        variable_count, dev_data_);
-        sets_.emplace(descriptor_sets[i], new_ds.get());
+        sets_.insert(descriptor_sets[i], new_ds.get());
         dev_data_->Add(std::move(new_ds));
     }
 }
 
 void DESCRIPTOR_POOL_STATE::Free(uint32_t count, const VkDescriptorSet *descriptor_sets) {
-    auto guard = WriteLock();
+    // Notify the command buffers using the freed sets once all of them are destroyed
+    BASE_NODE::InvalidationBatch invalidation_batch;
     // Update available descriptor sets in pool
-    available_sets_ += count;
+    available_sets_.fetch_add(count, std::memory_order_acq_rel);
 
     // For each freed descriptor add its resources back into the pool as available and remove from pool and device data
     for (uint32_t i = 0; i < count; ++i) {
         if (descriptor_sets[i] != VK_NULL_HANDLE) {
-            auto iter = sets_.find(descriptor_sets[i]);
+            auto iter = sets_.pop(descriptor_sets[i]);
             assert(iter != sets_.end());
+            if (iter == sets_.end()) continue;
             auto *set_state = iter->second;
-            uint32_t type_index = 0, descriptor_count = 0;
             for (uint32_t j = 0; j < set_state->GetBindingCount(); ++j) {
-                type_index = static_cast<uint32_t>(set_state->GetTypeFromIndex(j));
-                descriptor_count = set_state->GetDescriptorCountFromIndex(j);
-                available_counts_[type_index] += descriptor_count;
+                auto slot = count_slots_.find(static_cast<uint32_t>(set_state->GetTypeFromIndex(j)));
+                if (slot != count_slots_.end()) {
+                    available_counts_[slot->second].fetch_add(set_state->GetDescriptorCountFromIndex(j),
+                                                              std::memory_order_acq_rel);
+                }
             }
-            dev_data_->Destroy<cvdescriptorset::DescriptorSet>(iter->first);
-            sets_.erase(iter);
+            dev_data_->Destroy<cvdescriptorset::DescriptorSet>(descriptor_sets[i]);
         }
     }
 }
 
 void DESCRIPTOR_POOL_STATE::Reset() {
-    auto guard = WriteLock();
+    BASE_NODE::InvalidationBatch invalidation_batch;
     // For every set off of this pool, clear it, remove from setMap, and free cvdescriptorset::DescriptorSet
-    for (auto entry : sets_) {
+    for (const auto &entry : sets_.snapshot()) {
         dev_data_->Destroy<cvdescriptorset::DescriptorSet>(entry.first);
     }
     sets_.clear();
     // Reset available count for each type and available sets for this pool
-    available_counts_ = maxDescriptorTypeCount;
-    available_sets_ = maxSets;
+    for (const auto &entry : count_slots_) {
+        available_counts_[entry.second].store(maxDescriptorTypeCount.at(entry.first), std::memory_order_release);
+    }
+    available_sets_.store(maxSets, std::memory_order_release);
 }
 
 bool DESCRIPTOR_POOL_STATE::InUse() const {
-    auto guard = ReadLock();
-    for (const auto &entry : sets_) {
+    for (const auto &entry : sets_.snapshot()) {
         const auto *ds = entry.second;
         if (ds && ds->InUse()) {
             return true;
@@ -127,9 +149,50 @@ bool DESCRIPTOR_POOL_STATE::InUse() const {
 
 void DESCRIPTOR_POOL_STATE::Destroy() {
     Reset();
+    recycler_->Clear();
     BASE_NODE::Destroy();
 }
 
+static StateMemoryCounter &RecycledDescriptorSetMemoryCounter() {
+    static StateMemoryCounter *counter = new StateMemoryCounter("RecycledDescriptorSetStorage");
+    return *counter;
+}
+
+bool cvdescriptorset::DescriptorSetRecycler::Take(const DescriptorSetLayout *layout, DescriptorSet::Storage &storage) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto iter = free_.find(layout);
+    if (iter == free_.end()) return false;
+    storage = std::move(iter->second.back());
+    iter->second.pop_back();
+    if (iter->second.empty()) {
+        free_.erase(iter);
+    }
+    --count_;
+    RecycledDescriptorSetMemoryCounter().Remove(storage.MemoryUsage());
+    return true;
+}
+
+void cvdescriptorset::DescriptorSetRecycler::Give(const DescriptorSetLayout *layout, DescriptorSet::Storage &&storage) {
+    assert(storage.descriptors.empty());
+    std::lock_guard<std::mutex> guard(lock_);
+    if (count_ >= max_count_) return;
+    RecycledDescriptorSetMemoryCounter().Add(storage.MemoryUsage());
+    free_[layout].emplace_back(std::move(storage));
+    ++count_;
+}
+
+void cvdescriptorset::DescriptorSetRecycler::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto &entry : free_) {
+        for (const auto &storage : entry.second) {
+            RecycledDescriptorSetMemoryCounter().Remove(storage.MemoryUsage());
+        }
+    }
+    free_.clear();
+    count_ = 0;
+    max_count_ = 0;
+}
+
 // ExtendedBinding collects a VkDescriptorSetLayoutBinding and any extended
 // state that comes from a different array/structure so they can stay together
 // while being sorted by binding number.
@@ -194,11 +257,22 @@ cvdescriptorset::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescript
     binding_count_ = static_cast<uint32_t>(sorted_bindings.size());
     bindings_.reserve(binding_count_);
     binding_flags_.reserve(binding_count_);
-    binding_to_index_map_.reserve(binding_count_);
+    // Binding numbers are usually small and dense, so look them up in a table unless that would be mostly empty
+    const bool use_index_table =
+        (binding_count_ > 0) && (sorted_bindings.rbegin()->layout_binding->binding < 4 * static_cast<uint64_t>(binding_count_));
+    if (use_index_table) {
+        binding_to_index_table_.resize(sorted_bindings.rbegin()->layout_binding->binding + 1, binding_count_);
+    } else {
+        binding_to_index_map_.reserve(binding_count_);
+    }
     for (const auto &input_binding : sorted_bindings) {
         // Add to binding and map, s.t. it is robust to invalid duplication of binding_num
         const auto binding_num = input_binding.layout_binding->binding;
-        binding_to_index_map_[binding_num] = index++;
+        if (use_index_table) {
+            binding_to_index_table_[binding_num] = index++;
+        } else {
+            binding_to_index_map_[binding_num] = index++;
+        }
         bindings_.emplace_back(input_binding.layout_binding);
         auto &binding_info = bindings_.back();
         binding_flags_.emplace_back(input_binding.binding_flags);
@@ -238,14 +312,18 @@ size_t cvdescriptorset::DescriptorSetLayoutDef::hash() const {
     hc << flags_;
     hc.Combine(bindings_);
     hc.Combine(binding_flags_);
+    // Layouts that only differ in their mutable types would otherwise always collide in the dictionary
+    for (const auto &mutable_types : mutable_types_) {
+        hc.Combine(mutable_types);
+    }
     return hc.Value();
 }
 //
 
 // Return valid index or "end" i.e. binding_count_;
 // The asserts in "Get" are reduced to the set where no valid answer(like null or 0) could be given
-// Common code for all binding lookups.
-uint32_t cvdescriptorset::DescriptorSetLayoutDef::GetIndexFromBinding(uint32_t binding) const {
+// Common code for all binding lookups of layouts with sparse binding numbers.
+uint32_t cvdescriptorset::DescriptorSetLayoutDef::GetIndexFromBindingMap(uint32_t binding) const {
     const auto &bi_itr = binding_to_index_map_.find(binding);
     if (bi_itr != binding_to_index_map_.cend()) return bi_itr->second;
     return GetBindingCount();
@@ -294,9 +372,9 @@ const cvdescriptorset::IndexRange &cvdescriptorset::DescriptorSetLayoutDef::GetG
 
 // For given binding, return ptr to ImmutableSampler array
 VkSampler const *cvdescriptorset::DescriptorSetLayoutDef::GetImmutableSamplerPtrFromBinding(const uint32_t binding) const {
-    const auto &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.end()) {
-        return bindings_[bi_itr->second].pImmutableSamplers;
+    const uint32_t index = GetIndexFromBinding(binding);
+    if (index < binding_count_) {
+        return bindings_[index].pImmutableSamplers;
     }
     return nullptr;
 }
@@ -441,23 +519,19 @@ bool cvdescriptorset::VerifySetLayoutCompatibility(const debug_report_data *repo
 }
 
 bool cvdescriptorset::DescriptorSetLayoutDef::IsNextBindingConsistent(const uint32_t binding) const {
-    if (!binding_to_index_map_.count(binding + 1)) return false;
-    auto const &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.end()) {
-        const auto &next_bi_itr = binding_to_index_map_.find(binding + 1);
-        if (next_bi_itr != binding_to_index_map_.end()) {
-            auto type = bindings_[bi_itr->second].descriptorType;
-            auto stage_flags = bindings_[bi_itr->second].stageFlags;
-            auto immut_samp = bindings_[bi_itr->second].pImmutableSamplers ? true : false;
-            auto flags = binding_flags_[bi_itr->second];
-            if ((type != bindings_[next_bi_itr->second].descriptorType) ||
-                (stage_flags != bindings_[next_bi_itr->second].stageFlags) ||
-                (immut_samp != (bindings_[next_bi_itr->second].pImmutableSamplers ? true : false)) ||
-                (flags != binding_flags_[next_bi_itr->second])) {
-                return false;
-            }
-            return true;
+    const uint32_t next_index = GetIndexFromBinding(binding + 1);
+    if (next_index >= binding_count_) return false;
+    const uint32_t index = GetIndexFromBinding(binding);
+    if (index < binding_count_) {
+        auto type = bindings_[index].descriptorType;
+        auto stage_flags = bindings_[index].stageFlags;
+        auto immut_samp = bindings_[index].pImmutableSamplers ? true : false;
+        auto flags = binding_flags_[index];
+        if ((type != bindings_[next_index].descriptorType) || (stage_flags != bindings_[next_index].stageFlags) ||
+            (immut_samp != (bindings_[next_index].pImmutableSamplers ? true : false)) || (flags != binding_flags_[next_index])) {
+            return false;
         }
+        return true;
     }
     return false;
 }
@@ -805,20 +879,80 @@ void cvdescriptorset::AllocateDescriptorSetsData::Init(uint32_t count) {
     layout_nodes.resize(count);
 }
 
+// Number of backing store entries the descriptors of a binding of the given type take each
+static size_t BackingStoreCount(VkDescriptorType type) {
+    using cvdescriptorset::DescriptorBackingStore;
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            return DescriptorBackingStore::Count<cvdescriptorset::SamplerDescriptor>();
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            return DescriptorBackingStore::Count<cvdescriptorset::ImageSamplerDescriptor>();
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return DescriptorBackingStore::Count<cvdescriptorset::ImageDescriptor>();
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return DescriptorBackingStore::Count<cvdescriptorset::TexelDescriptor>();
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return DescriptorBackingStore::Count<cvdescriptorset::BufferDescriptor>();
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            return DescriptorBackingStore::Count<cvdescriptorset::InlineUniformDescriptor>();
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            return DescriptorBackingStore::Count<cvdescriptorset::AccelerationStructureDescriptor>();
+        case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
+            return DescriptorBackingStore::Count<cvdescriptorset::MutableDescriptor>();
+        default:
+            return 0;
+    }
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIPTOR_POOL_STATE *pool_state,
                                               const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                               const cvdescriptorset::DescriptorSet::StateTracker *state_data)
     : BASE_NODE(set, kVulkanObjectTypeDescriptorSet),
       some_update_(false),
       pool_state_(pool_state),
+      recycler_(pool_state ? pool_state->GetRecycler() : nullptr),
       layout_(layout),
       state_data_(state_data),
       variable_count_(variable_count),
-      change_count_(0) {
+      change_count_(0),
+      shared_validation_change_count_(CachedValidation::kNotValidated),
+      shared_validation_invalidation_count_(0),
+      invalidation_count_(0) {
+    Storage storage;
+    if (recycler_ && recycler_->Take(layout_.get(), storage)) {
+        descriptor_store_ = std::move(storage.descriptor_store);
+        descriptors_ = std::move(storage.descriptors);
+        change_count_levels_ = std::move(storage.change_count_levels);
+        dynamic_offset_idx_to_descriptor_list_ = std::move(storage.dynamic_offset_idx_to_descriptor_list);
+    }
+    // Recycled storage may come from a set with a different layout, so every container is sized from scratch
+    size_t level_count = 0;
+    if (layout_->GetTotalDescriptorCount() > PrefilterBindRequestMap::kManyDescriptors_) {
+        size_t level_size = layout_->GetTotalDescriptorCount();
+        while (true) {
+            if (level_count == change_count_levels_.size()) change_count_levels_.emplace_back();
+            change_count_levels_[level_count++].assign(level_size, 0);
+            if (level_size <= kChangeLevelSize) break;
+            level_size = (level_size + kChangeLevelSize - 1) / kChangeLevelSize;
+        }
+    }
+    change_count_levels_.resize(level_count);
+    dynamic_offset_idx_to_descriptor_list_.clear();
     // Foreach binding, create default descriptors of given type
     descriptors_.reserve(layout_->GetTotalDescriptorCount());
-    descriptor_store_.resize(layout_->GetTotalDescriptorCount());
-    auto free_descriptor = descriptor_store_.data();
+    size_t store_count = 0;
+    for (uint32_t i = 0; i < layout_->GetBindingCount(); ++i) {
+        store_count += layout_->GetDescriptorCountFromIndex(i) * BackingStoreCount(layout_->GetTypeFromIndex(i));
+    }
+    descriptor_store_.resize(store_count);
+    DescriptorStoreAllocator free_descriptor(descriptor_store_.data());
     for (uint32_t i = 0; i < layout_->GetBindingCount(); ++i) {
         auto type = layout_->GetTypeFromIndex(i);
         switch (type) {
@@ -826,11 +960,11 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 auto immut_sampler = layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut_sampler) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler())
+                        descriptors_.emplace_back(new (free_descriptor.Sampler())
                                                       SamplerDescriptor(state_data, immut_sampler + di));
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else {
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler()) SamplerDescriptor(state_data, nullptr));
+                        descriptors_.emplace_back(new (free_descriptor.Sampler()) SamplerDescriptor(state_data, nullptr));
                     }
                 }
                 break;
@@ -839,11 +973,11 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 auto immut = layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
+                        descriptors_.emplace_back(new (free_descriptor.ImageSampler())
                                                       ImageSamplerDescriptor(state_data, immut + di));
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else {
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
+                        descriptors_.emplace_back(new (free_descriptor.ImageSampler())
                                                       ImageSamplerDescriptor(state_data, nullptr));
                     }
                 }
@@ -854,43 +988,43 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Image()) ImageDescriptor(type));
+                    descriptors_.emplace_back(new (free_descriptor.Image()) ImageDescriptor(type));
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Texel()) TexelDescriptor(type));
+                    descriptors_.emplace_back(new (free_descriptor.Texel()) TexelDescriptor(type));
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Buffer()) BufferDescriptor(type));
+                    descriptors_.emplace_back(new (free_descriptor.Buffer()) BufferDescriptor(type));
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->InlineUniform()) InlineUniformDescriptor(type));
+                    descriptors_.emplace_back(new (free_descriptor.InlineUniform()) InlineUniformDescriptor(type));
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->AccelerationStructure())
+                    descriptors_.emplace_back(new (free_descriptor.AccelerationStructure())
                                                   AccelerationStructureDescriptor(type));
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
                 for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
-                    descriptors_.emplace_back(new ((free_descriptor++)->Mutable()) MutableDescriptor());
+                    descriptors_.emplace_back(new (free_descriptor.Mutable()) MutableDescriptor());
                 }
                 break;
             default:
                 if (IsDynamicDescriptor(type) && IsBufferDescriptor(type)) {
                     for (uint32_t di = 0; di < layout_->GetDescriptorCountFromIndex(i); ++di) {
                         dynamic_offset_idx_to_descriptor_list_.push_back(descriptors_.size());
-                        descriptors_.emplace_back(new ((free_descriptor++)->Buffer()) BufferDescriptor(type));
+                        descriptors_.emplace_back(new (free_descriptor.Buffer()) BufferDescriptor(type));
                     }
                 } else {
                     assert(0);  // Bad descriptor type specified
@@ -898,6 +1032,7 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 break;
         }
     }
+    assert(free_descriptor.Next() == descriptor_store_.data() + descriptor_store_.size());
 }
 
 void cvdescriptorset::DescriptorSet::LinkChildNodes() {
@@ -907,6 +1042,19 @@ void cvdescriptorset::DescriptorSet::LinkChildNodes() {
     }
 }
 
+cvdescriptorset::DescriptorSet::~DescriptorSet() {
+    Destroy();
+    if (recycler_) {
+        descriptors_.clear();
+        Storage storage;
+        storage.descriptor_store = std::move(descriptor_store_);
+        storage.descriptors = std::move(descriptors_);
+        storage.change_count_levels = std::move(change_count_levels_);
+        storage.dynamic_offset_idx_to_descriptor_list = std::move(dynamic_offset_idx_to_descriptor_list_);
+        recycler_->Give(layout_.get(), std::move(storage));
+    }
+}
+
 void cvdescriptorset::DescriptorSet::Destroy() {
     for (auto &desc: descriptors_) {
         desc->RemoveParent(this);
@@ -914,6 +1062,12 @@ void cvdescriptorset::DescriptorSet::Destroy() {
     BASE_NODE::Destroy();
 }
 
+void cvdescriptorset::DescriptorSet::NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) {
+    // A resource used by the set became invalid, whatever was validated with it no longer holds
+    invalidation_count_.fetch_add(1, std::memory_order_acq_rel);
+    BASE_NODE::NotifyInvalidate(invalid_nodes, unlink);
+}
+
 static std::string StringDescriptorReqViewType(DescriptorReqFlags req) {
     std::string result("");
     for (unsigned i = 0; i <= VK_IMAGE_VIEW_TYPE_CUBE_ARRAY; i++) {
@@ -950,9 +1104,10 @@ unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt) {
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
 bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const BindingReqMap &bindings,
-                                   const std::vector<uint32_t> &dynamic_offsets, const CMD_BUFFER_STATE *cb_node,
+                                   const uint32_t *dynamic_offsets, uint32_t dynamic_offset_count, const CMD_BUFFER_STATE *cb_node,
                                    const std::vector<IMAGE_VIEW_STATE *> *attachments, const std::vector<SUBPASS_INFO> *subpasses,
-                                   const char *caller, const DrawDispatchVuid &vuids) const {
+                                   const char *caller, const DrawDispatchVuid &vuids, uint64_t changed_since) const {
+    CheckTimer check_timer("ValidateDrawState");
     layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> checked_layouts;
     if (descriptor_set->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
         checked_layouts.emplace();
@@ -979,19 +1134,21 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const Bi
         }
         // // This is a record time only path
         const bool record_time_validate = true;
-        result |= ValidateDescriptorSetBindingData(cb_node, descriptor_set, dynamic_offsets, binding_pair, framebuffer, attachments,
-                                                   subpasses, record_time_validate, caller, vuids, checked_layouts);
+        result |= ValidateDescriptorSetBindingData(cb_node, descriptor_set, dynamic_offsets, dynamic_offset_count, binding_pair,
+                                                   framebuffer, attachments, subpasses, record_time_validate, caller, vuids,
+                                                   checked_layouts, changed_since);
     }
     return result;
 }
 
 bool CoreChecks::ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE *cb_node, const DescriptorSet *descriptor_set,
-                                                  const std::vector<uint32_t> &dynamic_offsets,
+                                                  const uint32_t *dynamic_offsets, uint32_t dynamic_offset_count,
                                                   const std::pair<const uint32_t, DescriptorRequirement> &binding_info,
                                                   VkFramebuffer framebuffer, const std::vector<IMAGE_VIEW_STATE *> *attachments,
                                                   const std::vector<SUBPASS_INFO> *subpasses, bool record_time_validate,
                                                   const char *caller, const DrawDispatchVuid &vuids,
-                                                  layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> &checked_layouts) const {
+                                                  layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> &checked_layouts,
+                                                  uint64_t changed_since) const {
     using DescriptorClass = cvdescriptorset::DescriptorClass;
     using BufferDescriptor = cvdescriptorset::BufferDescriptor;
     using ImageDescriptor = cvdescriptorset::ImageDescriptor;
@@ -1005,13 +1162,12 @@ bool CoreChecks::ValidateDescriptorSetBindingData(const CMD_BUFFER_STATE *cb_nod
     {
         // Copy the range, the end range is subject to update based on variable length descriptor arrays.
         cvdescriptorset::IndexRange index_range = binding_it.GetGlobalIndexRange();
-        auto array_idx = 0;  // Track array idx if we're dealing with array descriptors
-
         if (binding_it.IsVariableDescriptorCount()) {
             // Only validate the first N descriptors if it uses variable_count
             index_range.end = index_range.start + descriptor_set->GetVariableDescriptorCount();
         }
-        for (uint32_t i = index_range.start; !skip && i < index_range.end; ++i, ++array_idx) {
+        for (uint32_t i = descriptor_set->NextChangedDescriptor(index_range.start, index_range.end, changed_since);
+             !skip && i < index_range.end; i = descriptor_set->NextChangedDescriptor(i + 1, index_range.end, changed_since)) {
             uint32_t index = i - index_range.start;
             const auto *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
             const auto descriptor_class = descriptor->GetClass();
@@ -1870,7 +2026,9 @@ void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStat
         PerformWriteUpdate(dev_data, &p_wds[i]);
     }
 
+    // Only GPU-AV reads the writes back, to restore the push descriptors after its own dispatches
     push_descriptor_set_writes.clear();
+    if (!dev_data->retain_push_descriptor_writes) return;
     push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
     for (uint32_t i = 0; i < write_count; i++) {
         push_descriptor_set_writes.push_back(safe_VkWriteDescriptorSet(&p_wds[i]));
@@ -1921,6 +2079,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
                 }
             }
             descriptors_[global_idx + di]->SetDescriptorType(update->descriptorType, buffer_size);
+            RecordDescriptorChange(global_idx + di);
         }
         // Roll over to next binding in case of consecutive update
         descriptors_remaining -= update_count;
@@ -1934,7 +2093,6 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
     }
     if (update->descriptorCount) {
         some_update_ = true;
-        change_count_++;
     }
 
     if (!IsPushDescriptor() && !(layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
@@ -2251,11 +2409,11 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
         if (src->updated) {
             dst->CopyUpdate(this, state_data_, src);
             some_update_ = true;
-            change_count_++;
         } else {
             dst->updated = false;
         }
         dst->SetDescriptorType(src);
+        RecordDescriptorChange(dst_start_idx + di);
     }
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
@@ -2264,6 +2422,36 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
     }
 }
 
+void cvdescriptorset::DescriptorSet::RecordDescriptorChange(uint32_t index) {
+    change_count_++;
+    for (size_t level = 0; level < change_count_levels_.size(); ++level) {
+        change_count_levels_[level][index >> (level * kChangeLevelBits)] = change_count_;
+    }
+}
+
+uint32_t cvdescriptorset::DescriptorSet::NextChangedDescriptor(uint32_t index, uint32_t end, uint64_t changed_since) const {
+    if (changed_since == 0 || change_count_levels_.empty()) {
+        return index;
+    }
+    while (index < end) {
+        // Walk down from the coarsest level, skipping the first block that holds no change
+        bool skipped = false;
+        for (size_t level = change_count_levels_.size(); level-- > 0;) {
+            const uint32_t shift = static_cast<uint32_t>(level * kChangeLevelBits);
+            const uint32_t block = index >> shift;
+            if (change_count_levels_[level][block] <= changed_since) {
+                index = (block + 1) << shift;
+                skipped = true;
+                break;
+            }
+        }
+        if (!skipped) {
+            return index;
+        }
+    }
+    return end;
+}
+
 // Update the drawing state for the affected descriptors.
 // Set cb_node to this set and this set to cb_node.
 // Add the bindings of the descriptor
@@ -2273,7 +2461,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
 //   to be used in a draw by the given cb_node
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
                                                      CMD_TYPE cmd_type, const PIPELINE_STATE *pipe,
-                                                     const BindingReqMap &binding_req_map) {
+                                                     const BindingReqMap &binding_req_map, uint64_t changed_since) {
     // Descriptor UpdateDrawState only call image layout validation callbacks. If it is disabled, skip the entire loop.
     if (device_data->disabled[image_layout_validation]) {
         return;
@@ -2294,7 +2482,8 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             continue;
         }
         auto range = layout_->GetGlobalIndexRangeFromIndex(index);
-        for (uint32_t i = range.start; i < range.end; ++i) {
+        for (uint32_t i = NextChangedDescriptor(range.start, range.end, changed_since); i < range.end;
+             i = NextChangedDescriptor(i + 1, range.end, changed_since)) {
             const auto descriptor_class = descriptors_[i]->GetClass();
             switch (descriptor_class) {
             case DescriptorClass::Image:
@@ -2321,57 +2510,126 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
 }
 
 void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
-                                                         const TrackedBindings &bindings, uint32_t limit) {
-    if (bindings.size() < limit) {
-        const auto it = bindings.find(binding_req_pair.first);
-        if (it == bindings.cend()) out_req->emplace(binding_req_pair);
+                                                         bool validated, uint32_t validated_count, uint32_t limit) {
+    if (validated_count < limit && !validated) {
+        out_req->emplace(binding_req_pair);
+    }
+}
+
+size_t cvdescriptorset::DescriptorSet::CachedValidation::PipelineVersions::Hash(const PIPELINE_STATE *pipeline) {
+    // Pipeline states are heap allocated, so the low bits carry no information
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pipeline) >> 4);
+    hash *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> 32);
+}
+
+void cvdescriptorset::DescriptorSet::CachedValidation::PipelineVersions::Grow() {
+    std::vector<Entry> old_entries(entries_.empty() ? 4 : entries_.size() * 2);
+    old_entries.swap(entries_);
+    const size_t mask = entries_.size() - 1;
+    for (auto &old_entry : old_entries) {
+        if (!old_entry.pipeline) continue;
+        size_t slot = Hash(old_entry.pipeline) & mask;
+        while (entries_[slot].pipeline) {
+            slot = (slot + 1) & mask;
+        }
+        entries_[slot].pipeline = old_entry.pipeline;
+        entries_[slot].versions.swap(old_entry.versions);
+    }
+}
+
+const cvdescriptorset::DescriptorSet::CachedValidation::VersionedBindings *
+cvdescriptorset::DescriptorSet::CachedValidation::PipelineVersions::Find(const PIPELINE_STATE *pipeline) const {
+    if (entries_.empty()) return nullptr;
+    const size_t mask = entries_.size() - 1;
+    for (size_t slot = Hash(pipeline) & mask; entries_[slot].pipeline; slot = (slot + 1) & mask) {
+        if (entries_[slot].pipeline == pipeline) return &entries_[slot].versions;
+    }
+    return nullptr;
+}
+
+cvdescriptorset::DescriptorSet::CachedValidation::VersionedBindings &
+cvdescriptorset::DescriptorSet::CachedValidation::PipelineVersions::Get(const PIPELINE_STATE *pipeline, uint32_t binding_count) {
+    if ((count_ + 1) * 4 > entries_.size() * 3) {
+        Grow();
+    }
+    const size_t mask = entries_.size() - 1;
+    size_t slot = Hash(pipeline) & mask;
+    for (; entries_[slot].pipeline; slot = (slot + 1) & mask) {
+        if (entries_[slot].pipeline == pipeline) return entries_[slot].versions;
+    }
+    const uint64_t not_validated = kNotValidated;
+    entries_[slot].pipeline = pipeline;
+    entries_[slot].versions.assign(binding_count, not_validated);
+    ++count_;
+    return entries_[slot].versions;
+}
+
+bool cvdescriptorset::DescriptorSet::SharedValidationCurrent() const {
+    return !state_data_->enabled_features.core11.protectedMemory && shared_validation_change_count_ == change_count_ &&
+           shared_validation_invalidation_count_ == invalidation_count_.load(std::memory_order_acquire);
+}
+
+void cvdescriptorset::DescriptorSet::SetBuffersValidated(const BindingReqMap &validated_bindings) const {
+    WriteLockGuard guard(shared_validation_lock_);
+    if (!SharedValidationCurrent()) {
+        shared_validated_buffers_.assign(layout_->GetBindingCount(), false);
+        shared_validation_change_count_ = change_count_;
+        shared_validation_invalidation_count_ = invalidation_count_.load(std::memory_order_acquire);
+    }
+    for (const auto &binding_req_pair : validated_bindings) {
+        const uint32_t index = layout_->GetIndexFromBinding(binding_req_pair.first);
+        if (index < shared_validated_buffers_.size() && IsBufferDescriptor(layout_->GetTypeFromIndex(index))) {
+            shared_validated_buffers_[index] = true;
+        }
     }
 }
 
 void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                        const BindingReqMap &in_req, BindingReqMap *out_req) const {
+    // Buffer bindings validated by another command buffer count as validated here too
+    ReadLockGuard shared_guard(shared_validation_lock_);
+    const bool shared_current = SharedValidationCurrent();
     // For const cleanliness we have to find in the maps...
     const auto validated_it = cb_state.descriptorset_cache.find(this);
     if (validated_it == cb_state.descriptorset_cache.end()) {
         // We have nothing validated, copy in to out
         for (const auto &binding_req_pair : in_req) {
-            out_req->emplace(binding_req_pair);
+            if (!shared_current || !SharedBufferValidated(layout_->GetIndexFromBinding(binding_req_pair.first))) {
+                out_req->emplace(binding_req_pair);
+            }
         }
         return;
     }
     const auto &validated = validated_it->second;
 
-    const auto image_sample_version_it = validated.image_samplers.find(&pipeline);
-    const VersionedBindings *image_sample_version = nullptr;
-    if (image_sample_version_it != validated.image_samplers.cend()) {
-        image_sample_version = &(image_sample_version_it->second);
-    }
-    const auto &dynamic_buffers = validated.dynamic_buffers;
-    const auto &non_dynamic_buffers = validated.non_dynamic_buffers;
+    const auto *image_sample_version = validated.image_samplers.Find(&pipeline);
     const auto &stats = layout_->GetBindingTypeStats();
     for (const auto &binding_req_pair : in_req) {
-        auto binding = binding_req_pair.first;
-        VkDescriptorSetLayoutBinding const *layout_binding = layout_->GetDescriptorSetLayoutBindingPtrFromBinding(binding);
+        const uint32_t index = layout_->GetIndexFromBinding(binding_req_pair.first);
+        VkDescriptorSetLayoutBinding const *layout_binding = layout_->GetDescriptorSetLayoutBindingPtrFromIndex(index);
         if (!layout_binding) {
             continue;
         }
         // Caching criteria differs per type.
         // If image_layout have changed , the image descriptors need to be validated against them.
         if (IsBufferDescriptor(layout_binding->descriptorType)) {
+            const bool buffer_validated = (index < validated.buffers.size() && validated.buffers[index]) ||
+                                          (shared_current && SharedBufferValidated(index));
             if (IsDynamicDescriptor(layout_binding->descriptorType)) {
-                FilterOneBindingReq(binding_req_pair, out_req, dynamic_buffers, stats.dynamic_buffer_count);
+                FilterOneBindingReq(binding_req_pair, out_req, buffer_validated, validated.dynamic_buffer_count,
+                                    stats.dynamic_buffer_count);
             } else {
-                FilterOneBindingReq(binding_req_pair, out_req, non_dynamic_buffers, stats.non_dynamic_buffer_count);
+                FilterOneBindingReq(binding_req_pair, out_req, buffer_validated, validated.non_dynamic_buffer_count,
+                                    stats.non_dynamic_buffer_count);
             }
         } else {
             // This is rather crude, as the changed layouts may not impact the bound descriptors,
             // but the simple "versioning" is a simple "dirt" test.
             bool stale = true;
-            if (image_sample_version) {
-                const auto version_it = image_sample_version->find(binding);
-                if (version_it != image_sample_version->cend() && (version_it->second == cb_state.image_layout_change_count)) {
-                    stale = false;
-                }
+            if (image_sample_version && index < image_sample_version->size() &&
+                (*image_sample_version)[index] == cb_state.image_layout_change_count) {
+                stale = false;
             }
             if (stale) {
                 out_req->emplace(binding_req_pair);
@@ -2384,25 +2642,30 @@ void cvdescriptorset::DescriptorSet::UpdateValidationCache(CMD_BUFFER_STATE &cb_
                                                            const BindingReqMap &updated_bindings) {
     auto &validated = cb_state.descriptorset_cache[this];
 
-    auto &image_sample_version = validated.image_samplers[&pipeline];
-    auto &dynamic_buffers = validated.dynamic_buffers;
-    auto &non_dynamic_buffers = validated.non_dynamic_buffers;
+    const uint32_t binding_count = layout_->GetBindingCount();
+    if (validated.buffers.empty()) {
+        validated.buffers.resize(binding_count, false);
+    }
+    auto &image_sample_version = validated.image_samplers.Get(&pipeline, binding_count);
     for (const auto &binding_req_pair : updated_bindings) {
-        auto binding = binding_req_pair.first;
-        VkDescriptorSetLayoutBinding const *layout_binding = layout_->GetDescriptorSetLayoutBindingPtrFromBinding(binding);
+        const uint32_t index = layout_->GetIndexFromBinding(binding_req_pair.first);
+        VkDescriptorSetLayoutBinding const *layout_binding = layout_->GetDescriptorSetLayoutBindingPtrFromIndex(index);
         if (!layout_binding) {
             continue;
         }
         // Caching criteria differs per type.
         if (IsBufferDescriptor(layout_binding->descriptorType)) {
-            if (IsDynamicDescriptor(layout_binding->descriptorType)) {
-                dynamic_buffers.emplace(binding);
-            } else {
-                non_dynamic_buffers.emplace(binding);
+            if (!validated.buffers[index]) {
+                validated.buffers[index] = true;
+                if (IsDynamicDescriptor(layout_binding->descriptorType)) {
+                    validated.dynamic_buffer_count++;
+                } else {
+                    validated.non_dynamic_buffer_count++;
+                }
             }
         } else {
             // Save the layout change version...
-            image_sample_version[binding] = cb_state.image_layout_change_count;
+            image_sample_version[index] = cb_state.image_layout_change_count;
         }
     }
 }
@@ -2808,7 +3071,19 @@ void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *d
 }
 
 cvdescriptorset::BufferDescriptor::BufferDescriptor(const VkDescriptorType type)
-    : Descriptor(GeneralBuffer), offset_(0), range_(0) {}
+    : Descriptor(GeneralBuffer), offset_(0), range_(0), max_dynamic_offset_(0) {}
+
+void cvdescriptorset::BufferDescriptor::UpdateMaxDynamicOffset() {
+    if (range_ == VK_WHOLE_SIZE) {
+        max_dynamic_offset_ = 0;
+    } else if (!buffer_state_) {
+        max_dynamic_offset_ = std::numeric_limits<VkDeviceSize>::max();
+    } else {
+        const VkDeviceSize size = buffer_state_->createInfo.size;
+        // A range that already overruns the buffer allows no offset at all
+        max_dynamic_offset_ = (offset_ <= size && range_ <= size - offset_) ? size - offset_ - range_ : 0;
+    }
+}
 
 void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
                                                     const VkWriteDescriptorSet *update, const uint32_t index) {
@@ -2817,6 +3092,7 @@ void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, co
     offset_ = buffer_info.offset;
     range_ = buffer_info.range;
     ReplaceStatePtr(set_state, buffer_state_, dev_data->GetConstCastShared<BUFFER_STATE>(buffer_info.buffer));
+    UpdateMaxDynamicOffset();
 }
 
 void cvdescriptorset::BufferDescriptor::CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
@@ -2827,12 +3103,14 @@ void cvdescriptorset::BufferDescriptor::CopyUpdate(DescriptorSet *set_state, con
         offset_ = buff_desc->GetOffset();
         range_ = buff_desc->GetRange();
         ReplaceStatePtr(set_state, buffer_state_, buff_desc->GetSharedBufferState());
+        UpdateMaxDynamicOffset();
         return;
     }
     const auto buff_desc = static_cast<const BufferDescriptor *>(src);
     offset_ = buff_desc->offset_;
     range_ = buff_desc->range_;
     ReplaceStatePtr(set_state, buffer_state_, buff_desc->buffer_state_);
+    max_dynamic_offset_ = buff_desc->max_dynamic_offset_;
 }
 
 cvdescriptorset::TexelDescriptor::TexelDescriptor(const VkDescriptorType type) : Descriptor(TexelBuffer) {}
@@ -3144,14 +3422,20 @@ bool cvdescriptorset::MutableDescriptor::Invalid() const {
 // If the update hits an issue for which the callback returns "true", meaning that the call down the chain should
 //  be skipped, then true is returned.
 // If there is no issue with the update, then false is returned.
-bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
-                                              const VkCopyDescriptorSet *p_cds, const char *func_name) const {
+// Validates p_wds[first] to p_wds[end - 1]. Consecutive writes usually update the same set, which is only looked up once.
+bool CoreChecks::ValidateWriteUpdates(const VkWriteDescriptorSet *p_wds, uint32_t first, uint32_t end,
+                                      const char *func_name) const {
     bool skip = false;
-    // Validate Write updates
-    for (uint32_t i = 0; i < write_count; i++) {
+    VkDescriptorSet cached_set = VK_NULL_HANDLE;
+    std::shared_ptr<const cvdescriptorset::DescriptorSet> set_node;
+    for (uint32_t i = first; i < end; i++) {
         auto dest_set = p_wds[i].dstSet;
-        auto set_node = Get<cvdescriptorset::DescriptorSet>(dest_set);
+        if (!set_node || dest_set != cached_set) {
+            set_node = Get<cvdescriptorset::DescriptorSet>(dest_set);
+            cached_set = dest_set;
+        }
         if (!set_node) {
+
             skip |= LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet,
                              "Cannot call %s on %s that has not been allocated in pDescriptorWrites[%u].", func_name,
                              report_data->FormatHandle(dest_set).c_str(), i);
@@ -3197,6 +3481,21 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
             }
         }
     }
+    return skip;
+}
+
+bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
+                                              const VkCopyDescriptorSet *p_cds, const char *func_name) const {
+    CheckTimer check_timer("ValidateUpdateDescriptorSets");
+    bool skip = false;
+    // Validate Write updates, in chunks that can be validated in parallel since validation only reads state. Messages are
+    // delivered in chunk order either way.
+    const uint32_t chunk_size = kWriteUpdateChunkSize;
+    const uint32_t chunk_count = (write_count + chunk_size - 1) / chunk_size;
+    skip |= RunDescriptorUpdateBatch(chunk_count, [this, p_wds, write_count, chunk_size, func_name](uint32_t chunk) {
+        const uint32_t first = chunk * chunk_size;
+        return ValidateWriteUpdates(p_wds, first, std::min(write_count, first + chunk_size), func_name);
+    });
     // Now validate copy updates
     for (uint32_t i = 0; i < copy_count; ++i) {
         auto dst_set = p_cds[i].dstSet;
@@ -3248,10 +3547,198 @@ void cvdescriptorset::PerformUpdateDescriptorSets(ValidationStateTracker *dev_da
     }
 }
 
+// Size of one descriptor's update data in the data passed to a template, 0 for inline uniform blocks which are plain bytes
+static size_t TemplateDataSize(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return sizeof(VkDescriptorImageInfo);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return sizeof(VkDescriptorBufferInfo);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return sizeof(VkBufferView);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            return sizeof(VkAccelerationStructureKHR);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return sizeof(VkAccelerationStructureNV);
+        default:
+            return 0;
+    }
+}
+
+UPDATE_TEMPLATE_STATE::UPDATE_TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template,
+                                             const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                             const cvdescriptorset::DescriptorSetLayout *layout)
+    : BASE_NODE(update_template, kVulkanObjectTypeDescriptorUpdateTemplate),
+      create_info(pCreateInfo),
+      runs(GetDescriptorRuns(create_info, layout)),
+      run_write_count(GetRunWriteCount(runs)),
+      run_extension_count(GetRunExtensionCount(create_info, runs)) {}
+
+std::vector<UPDATE_TEMPLATE_STATE::DescriptorRun> UPDATE_TEMPLATE_STATE::GetDescriptorRuns(
+    const safe_VkDescriptorUpdateTemplateCreateInfo &create_info, const cvdescriptorset::DescriptorSetLayout *layout) {
+    std::vector<DescriptorRun> runs;
+    if (!layout || layout->GetBindingCount() == 0 ||
+        create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        return runs;
+    }
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        if (entry.descriptorCount == 0) continue;
+        if (entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            // descriptorCount and dstArrayElement are in bytes, the whole entry is a single write
+            runs.push_back({i, entry.dstBinding, entry.dstArrayElement, entry.descriptorCount, entry.offset, true});
+            continue;
+        }
+        const size_t data_size = TemplateDataSize(entry.descriptorType);
+        uint32_t binding = entry.dstBinding;
+        uint32_t array_element = entry.dstArrayElement;
+        uint32_t remaining = entry.descriptorCount;
+        size_t offset = entry.offset;
+        while (remaining > 0) {
+            const uint32_t binding_count = layout->GetDescriptorCountFromBinding(binding);
+            if (array_element >= binding_count) {
+                // Consecutive binding updates roll over to the next binding
+                if (binding >= layout->GetMaxBinding()) {
+                    // The template overruns the layout, leave the decoding to the per descriptor path
+                    return {};
+                }
+                array_element = 0;
+                binding = layout->GetNextValidBinding(binding);
+                continue;
+            }
+            const uint32_t count = std::min(remaining, binding_count - array_element);
+            runs.push_back({i, binding, array_element, count, offset, count == 1 || entry.stride == data_size});
+            remaining -= count;
+            array_element += count;
+            offset += count * entry.stride;
+        }
+    }
+    return runs;
+}
+
+uint32_t UPDATE_TEMPLATE_STATE::GetRunWriteCount(const std::vector<DescriptorRun> &runs) {
+    uint32_t write_count = 0;
+    for (const auto &run : runs) {
+        write_count += run.packed ? 1 : run.descriptor_count;
+    }
+    return write_count;
+}
+
+uint32_t UPDATE_TEMPLATE_STATE::GetRunExtensionCount(const safe_VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                                     const std::vector<DescriptorRun> &runs) {
+    uint32_t extension_count = 0;
+    for (const auto &run : runs) {
+        switch (create_info.pDescriptorUpdateEntries[run.entry].descriptorType) {
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                extension_count += run.packed ? 1 : run.descriptor_count;
+                break;
+            default:
+                break;
+        }
+    }
+    return extension_count;
+}
+
+void cvdescriptorset::DecodedTemplateUpdate::DecodeRuns(VkDescriptorSet descriptorSet,
+                                                        const UPDATE_TEMPLATE_STATE &template_state, const void *pData) {
+    auto const &create_info = template_state.create_info;
+    desc_writes.reserve(template_state.run_write_count);
+    // Each write chaining an extension structure gets its own
+    inline_infos.resize(template_state.run_extension_count);
+    inline_infos_khr.resize(template_state.run_extension_count);
+    inline_infos_nv.resize(template_state.run_extension_count);
+    uint32_t extension_index = 0;
+
+    for (const auto &run : template_state.runs) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[run.entry];
+        const uint32_t write_count = run.packed ? 1 : run.descriptor_count;
+        const uint32_t descriptors_per_write = run.packed ? run.descriptor_count : 1;
+        for (uint32_t w = 0; w < write_count; w++) {
+            const char *update_entry = static_cast<const char *>(pData) + run.offset + w * entry.stride;
+            desc_writes.emplace_back();
+            auto &write_entry = desc_writes.back();
+            write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write_entry.pNext = nullptr;
+            write_entry.dstSet = descriptorSet;
+            write_entry.dstBinding = run.binding;
+            write_entry.dstArrayElement = run.array_element + w;
+            write_entry.descriptorCount = descriptors_per_write;
+            write_entry.descriptorType = entry.descriptorType;
+
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    write_entry.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(update_entry);
+                    break;
+
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    write_entry.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(update_entry);
+                    break;
+
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    write_entry.pTexelBufferView = reinterpret_cast<const VkBufferView *>(update_entry);
+                    break;
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
+                    VkWriteDescriptorSetInlineUniformBlockEXT *inline_info = &inline_infos[extension_index++];
+                    inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
+                    inline_info->pNext = nullptr;
+                    inline_info->dataSize = run.descriptor_count;
+                    inline_info->pData = update_entry;
+                    write_entry.pNext = inline_info;
+                    break;
+                }
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
+                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[extension_index++];
+                    inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+                    inline_info_khr->pNext = nullptr;
+                    inline_info_khr->accelerationStructureCount = descriptors_per_write;
+                    inline_info_khr->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(update_entry);
+                    write_entry.pNext = inline_info_khr;
+                    break;
+                }
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
+                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[extension_index++];
+                    inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
+                    inline_info_nv->pNext = nullptr;
+                    inline_info_nv->accelerationStructureCount = descriptors_per_write;
+                    inline_info_nv->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(update_entry);
+                    write_entry.pNext = inline_info_nv;
+                    break;
+                }
+                default:
+                    assert(0);
+                    break;
+            }
+        }
+    }
+}
+
 cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data,
                                                               VkDescriptorSet descriptorSet,
                                                               const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
                                                               VkDescriptorSetLayout push_layout) {
+    if (!template_state->runs.empty()) {
+        // Descriptor set templates were split into runs against their layout when they were created
+        DecodeRuns(descriptorSet, *template_state, pData);
+        return;
+    }
     auto const &create_info = template_state->create_info;
     inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
     inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
@@ -3713,7 +4200,8 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
     auto pool_state = Get<DESCRIPTOR_POOL_STATE>(p_alloc_info->descriptorPool);
 
     for (uint32_t i = 0; i < p_alloc_info->descriptorSetCount; i++) {
-        auto layout = Get<cvdescriptorset::DescriptorSetLayout>(p_alloc_info->pSetLayouts[i]);
+        // Looked up by UpdateAllocateDescriptorSetsData
+        const auto *layout = ds_data->layout_nodes[i].get();
         if (layout) {  // nullptr layout indicates no valid layout handle for this device, validated/logged in object_tracker
             if (layout->IsPushDescriptor()) {
                 skip |= LogError(p_alloc_info->pSetLayouts[i], "VUID-VkDescriptorSetAllocateInfo-pSetLayouts-00308",
@@ -3741,23 +4229,23 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
     }
     if (!IsExtEnabled(device_extensions.vk_khr_maintenance1)) {
         // Track number of descriptorSets allowable in this pool
-        if (pool_state->GetAvailableSets() < p_alloc_info->descriptorSetCount) {
+        const uint32_t available_sets = pool_state->GetAvailableSets();
+        if (available_sets < p_alloc_info->descriptorSetCount) {
             skip |= LogError(pool_state->Handle(), "VUID-VkDescriptorSetAllocateInfo-descriptorSetCount-00306",
                              "vkAllocateDescriptorSets(): Unable to allocate %u descriptorSets from %s"
                              ". This pool only has %d descriptorSets remaining.",
                              p_alloc_info->descriptorSetCount, report_data->FormatHandle(pool_state->Handle()).c_str(),
-                             pool_state->GetAvailableSets());
+                             available_sets);
         }
         // Determine whether descriptor counts are satisfiable
         for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
             auto available_count = pool_state->GetAvailableCount(it->first);
 
-            if (ds_data->required_descriptors_by_type.at(it->first) > available_count) {
+            if (it->second > available_count) {
                 skip |= LogError(pool_state->Handle(), "VUID-VkDescriptorSetAllocateInfo-descriptorPool-00307",
                                  "vkAllocateDescriptorSets(): Unable to allocate %u descriptors of type %s from %s"
                                  ". This pool only has %d descriptors of this type remaining.",
-                                 ds_data->required_descriptors_by_type.at(it->first),
-                                 string_VkDescriptorType(VkDescriptorType(it->first)),
+                                 it->second, string_VkDescriptorType(VkDescriptorType(it->first)),
                                  report_data->FormatHandle(pool_state->Handle()).c_str(), available_count);
             }
         }
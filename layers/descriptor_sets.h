@@ -36,6 +36,7 @@
 #include "command_validation.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -49,6 +50,8 @@ class SAMPLER_STATE;
 
 namespace cvdescriptorset {
 class DescriptorSet;
+class DescriptorSetLayout;
+class DescriptorSetRecycler;
 struct AllocateDescriptorSetsData;
 }
 
@@ -65,36 +68,61 @@ class DESCRIPTOR_POOL_STATE : public BASE_NODE {
 
     bool InUse() const override;
     uint32_t GetAvailableCount(uint32_t type) const {
-        auto guard = ReadLock();
-        auto iter = available_counts_.find(type);
-        return iter != available_counts_.end() ? iter->second : 0;
+        auto iter = count_slots_.find(type);
+        return iter != count_slots_.end() ? available_counts_[iter->second].load(std::memory_order_acquire) : 0;
     }
 
-    uint32_t GetAvailableSets() const {
-        auto guard = ReadLock();
-        return available_sets_;
-    }
+    uint32_t GetAvailableSets() const { return available_sets_.load(std::memory_order_acquire); }
+
+    const std::shared_ptr<cvdescriptorset::DescriptorSetRecycler> &GetRecycler() const { return recycler_; }
 
     const uint32_t maxSets;  // Max descriptor sets allowed in this pool
     const safe_VkDescriptorPoolCreateInfo createInfo;
     using TypeCountMap = layer_data::unordered_map<uint32_t, uint32_t>;
     const TypeCountMap maxDescriptorTypeCount;  // Max # of descriptors of each type in this pool
   private:
-    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
-    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
-    uint32_t available_sets_;  // Available descriptor sets in this pool
-    TypeCountMap available_counts_;         // Available # of descriptors of each type in this pool
-    layer_data::unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> sets_;  // Collection of all sets in this pool
+    // Accounting is lock free, so that validating allocations from a pool doesn't wait on other threads using it. The pool
+    // sizes are fixed at creation, so each descriptor type gets a counter slot up front.
+    std::atomic<uint32_t> available_sets_;  // Available descriptor sets in this pool
+    const TypeCountMap count_slots_;        // Index into available_counts_ of each descriptor type in this pool
+    std::unique_ptr<std::atomic<uint32_t>[]> available_counts_;  // Available # of descriptors of each type in this pool
+    vl_concurrent_unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> sets_;  // Collection of all sets in this pool
     ValidationStateTracker *dev_data_;
-    mutable ReadWriteLock lock_;
+    // Storage of the sets allocated from this pool, kept for the next sets allocated with the same layout once they are gone
+    std::shared_ptr<cvdescriptorset::DescriptorSetRecycler> recycler_;
 };
 
 class UPDATE_TEMPLATE_STATE : public BASE_NODE {
   public:
+    // Consecutive descriptors of a single binding updated by one template entry
+    struct DescriptorRun {
+        uint32_t entry;  // Index into pDescriptorUpdateEntries
+        uint32_t binding;
+        uint32_t array_element;
+        uint32_t descriptor_count;
+        size_t offset;  // Of the run's first descriptor in the update data
+        // The run's update data is an array the write can point at, so it decodes to a single write rather than one per
+        // descriptor
+        bool packed;
+    };
+
     const safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Descriptor set templates are split into runs once, against the layout given at creation, rather than at every update.
+    // Empty if the template updates push descriptors, whose layout is only known when the template is used.
+    const std::vector<DescriptorRun> runs;
+    // Number of writes the runs decode to, and how many of them need an extension structure chained
+    const uint32_t run_write_count;
+    const uint32_t run_extension_count;
+
+    UPDATE_TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                          const cvdescriptorset::DescriptorSetLayout *layout = nullptr);
 
-    UPDATE_TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : BASE_NODE(update_template, kVulkanObjectTypeDescriptorUpdateTemplate), create_info(pCreateInfo) {}
+  private:
+    static std::vector<DescriptorRun> GetDescriptorRuns(const safe_VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                                        const cvdescriptorset::DescriptorSetLayout *layout);
+    static uint32_t GetRunWriteCount(const std::vector<DescriptorRun> &runs);
+    static uint32_t GetRunExtensionCount(const safe_VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                         const std::vector<DescriptorRun> &runs);
 };
 
 // Descriptor Data structures
@@ -159,10 +187,16 @@ class DescriptorSetLayoutDef {
     // Non-empty binding numbers in order
     const std::set<uint32_t> &GetSortedBindingSet() const { return non_empty_bindings_; }
     // Return true if given binding is present in this layout
-    bool HasBinding(const uint32_t binding) const { return binding_to_index_map_.count(binding) > 0; };
+    bool HasBinding(const uint32_t binding) const { return GetIndexFromBinding(binding) < binding_count_; };
     // Return true if binding 1 beyond given exists and has same type, stageFlags & immutable sampler use
     bool IsNextBindingConsistent(const uint32_t) const;
-    uint32_t GetIndexFromBinding(uint32_t binding) const;
+    // Return the index of the given binding, or GetBindingCount() if there is none
+    uint32_t GetIndexFromBinding(uint32_t binding) const {
+        if (!binding_to_index_table_.empty()) {
+            return (binding < binding_to_index_table_.size()) ? binding_to_index_table_[binding] : binding_count_;
+        }
+        return GetIndexFromBindingMap(binding);
+    }
     // Various Get functions that can either be passed a binding#, which will
     //  be automatically translated into the appropriate index, or the index# can be passed in directly
     uint32_t GetMaxBinding() const { return bindings_[bindings_.size() - 1].binding; }
@@ -211,6 +245,8 @@ class DescriptorSetLayoutDef {
     const BindingTypeStats &GetBindingTypeStats() const { return binding_type_stats_; }
 
   private:
+    uint32_t GetIndexFromBindingMap(uint32_t binding) const;
+
     // Only the first three data members are used for hash and equality checks, the other members are derived from them, and are
     // used to speed up the various lookups/queries/validations
     VkDescriptorSetLayoutCreateFlags flags_;
@@ -221,6 +257,9 @@ class DescriptorSetLayoutDef {
 
     // Convenience data structures for rapid lookup of various descriptor set layout properties
     std::set<uint32_t> non_empty_bindings_;  // Containing non-emtpy bindings in numerical order
+    // The index of each binding number, binding_count_ for those not in the layout. Used instead of binding_to_index_map_, which
+    // is then empty, unless the binding numbers are sparse.
+    std::vector<uint32_t> binding_to_index_table_;
     layer_data::unordered_map<uint32_t, uint32_t> binding_to_index_map_;
     // The following map allows an non-iterative lookup of a binding from a global index...
     std::vector<IndexRange> global_index_range_;  // range is exclusive of .end
@@ -589,6 +628,9 @@ class BufferDescriptor : public Descriptor {
     std::shared_ptr<BUFFER_STATE> GetSharedBufferState() const { return buffer_state_; }
     VkDeviceSize GetOffset() const { return offset_; }
     VkDeviceSize GetRange() const { return range_; }
+    // Largest dynamic offset that keeps the descriptor's range within its buffer. Zero for VK_WHOLE_SIZE ranges, which can't be
+    // offset, and no limit without a buffer, whose errors are raised elsewhere.
+    VkDeviceSize GetMaxDynamicOffset() const { return max_dynamic_offset_; }
 
     bool AddParent(BASE_NODE *base_node) override {
         bool result = false;
@@ -605,8 +647,13 @@ class BufferDescriptor : public Descriptor {
     bool Invalid() const override { return !buffer_state_ || buffer_state_->Invalid(); }
 
   private:
+    void UpdateMaxDynamicOffset();
+
     VkDeviceSize offset_;
     VkDeviceSize range_;
+    // Computed when the descriptor is updated, since the buffer size never changes, so that binding with dynamic offsets
+    // only needs one comparison per descriptor
+    VkDeviceSize max_dynamic_offset_;
     std::shared_ptr<BUFFER_STATE> buffer_state_;
 };
 
@@ -758,19 +805,42 @@ union AnyDescriptor {
     ~AnyDescriptor() = delete;
 };
 
+// The descriptors of a set are packed into an array of these, each descriptor taking only as many as its own class needs
+// rather than the size of the largest descriptor class, so each binding is stored as a dense array of its descriptor class.
 struct alignas(alignof(AnyDescriptor)) DescriptorBackingStore {
-    uint8_t data[sizeof(AnyDescriptor)];
-
-    SamplerDescriptor *Sampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->sampler); }
-    ImageSamplerDescriptor *ImageSampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->image_sampler); }
-    ImageDescriptor *Image() { return &(reinterpret_cast<AnyDescriptor *>(this)->image); }
-    TexelDescriptor *Texel() { return &(reinterpret_cast<AnyDescriptor *>(this)->texel); }
-    BufferDescriptor *Buffer() { return &(reinterpret_cast<AnyDescriptor *>(this)->buffer); }
-    InlineUniformDescriptor *InlineUniform() { return &(reinterpret_cast<AnyDescriptor *>(this)->inline_uniform); }
-    AccelerationStructureDescriptor *AccelerationStructure() {
-        return &(reinterpret_cast<AnyDescriptor *>(this)->accelerator_structure);
-    }
-    MutableDescriptor *Mutable() { return &(reinterpret_cast<AnyDescriptor *>(this)->mutable_descriptor); }
+    uint8_t data[alignof(AnyDescriptor)];
+
+    // Number of backing store entries a descriptor of class T occupies
+    template <typename T>
+    static size_t Count() {
+        return (sizeof(T) + sizeof(DescriptorBackingStore) - 1) / sizeof(DescriptorBackingStore);
+    }
+};
+
+// Hands out the storage for consecutive descriptors from a backing store
+class DescriptorStoreAllocator {
+  public:
+    explicit DescriptorStoreAllocator(DescriptorBackingStore *store) : next_(store) {}
+
+    SamplerDescriptor *Sampler() { return Allocate<SamplerDescriptor>(); }
+    ImageSamplerDescriptor *ImageSampler() { return Allocate<ImageSamplerDescriptor>(); }
+    ImageDescriptor *Image() { return Allocate<ImageDescriptor>(); }
+    TexelDescriptor *Texel() { return Allocate<TexelDescriptor>(); }
+    BufferDescriptor *Buffer() { return Allocate<BufferDescriptor>(); }
+    InlineUniformDescriptor *InlineUniform() { return Allocate<InlineUniformDescriptor>(); }
+    AccelerationStructureDescriptor *AccelerationStructure() { return Allocate<AccelerationStructureDescriptor>(); }
+    MutableDescriptor *Mutable() { return Allocate<MutableDescriptor>(); }
+    const DescriptorBackingStore *Next() const { return next_; }
+
+  private:
+    template <typename T>
+    T *Allocate() {
+        T *descriptor = reinterpret_cast<T *>(next_);
+        next_ += DescriptorBackingStore::Count<T>();
+        return descriptor;
+    }
+
+    DescriptorBackingStore *next_;
 };
 
 // Structs to contain common elements that need to be shared between Validate* and Perform* calls below
@@ -809,6 +879,9 @@ struct DecodedTemplateUpdate {
     DecodedTemplateUpdate(const ValidationStateTracker *device_data, VkDescriptorSet descriptorSet,
                           const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
                           VkDescriptorSetLayout push_layout = VK_NULL_HANDLE);
+
+  private:
+    void DecodeRuns(VkDescriptorSet descriptorSet, const UPDATE_TEMPLATE_STATE &template_state, const void *pData);
 };
 
 /*
@@ -835,7 +908,7 @@ class DescriptorSet : public BASE_NODE {
     DescriptorSet(const VkDescriptorSet, DESCRIPTOR_POOL_STATE *, const std::shared_ptr<DescriptorSetLayout const> &,
                   uint32_t variable_count, const StateTracker *state_data_const);
     void LinkChildNodes() override;
-    ~DescriptorSet() { Destroy(); }
+    ~DescriptorSet();
 
     // A number of common Get* functions that return data based on layout from which this set was created
     uint32_t GetTotalDescriptorCount() const { return layout_->GetTotalDescriptorCount(); };
@@ -865,16 +938,19 @@ class DescriptorSet : public BASE_NODE {
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, CMD_TYPE cmd_type, const PIPELINE_STATE *,
-                         const BindingReqMap &);
+                         const BindingReqMap &, uint64_t changed_since = 0);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
-    typedef layer_data::unordered_set<uint32_t> TrackedBindings;
-    static void FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
-                                    const TrackedBindings &set, uint32_t limit);
+    static void FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req, bool validated,
+                                    uint32_t validated_count, uint32_t limit);
     void FilterBindingReqs(const CMD_BUFFER_STATE &, const PIPELINE_STATE &, const BindingReqMap &in_req,
                            BindingReqMap *out_req) const;
     void UpdateValidationCache(CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline, const BindingReqMap &updated_bindings);
+    // Draw time validation of buffer bindings doesn't depend on the command buffer unless protected memory is enabled, so
+    // bindings that validated cleanly are remembered by the set itself, for every command buffer drawing with it. The
+    // results are dropped when the set is updated, or one of the resources it uses becomes invalid.
+    void SetBuffersValidated(const BindingReqMap &validated_bindings) const;
 
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
         return layout_->GetImmutableSamplerPtrFromBinding(index);
@@ -897,6 +973,13 @@ class DescriptorSet : public BASE_NODE {
         return !!(layout_->GetDescriptorBindingFlagsFromBinding(binding) & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT);
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
+    size_t DynamicMemoryUsage() const override {
+        size_t usage = VectorMemoryUsage(descriptor_store_) + VectorMemoryUsage(descriptors_);
+        for (const auto &level : change_count_levels_) {
+            usage += VectorMemoryUsage(level);
+        }
+        return usage;
+    }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
     const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index].get(); }
     const Descriptor *GetDescriptorFromBinding(const uint32_t binding, const uint32_t index = 0) const {
@@ -911,6 +994,10 @@ class DescriptorSet : public BASE_NODE {
         return descriptors_[dynamic_offset_idx_to_descriptor_list_.at(index)].get();
     }
     uint64_t GetChangeCount() const { return change_count_; }
+    // Returns the first global index in [index, end) whose descriptor was updated after the set's change count was
+    // changed_since, or end if there is none. Sets with few descriptors don't track changes per descriptor, and treat every
+    // descriptor as changed, as does a changed_since of 0.
+    uint32_t NextChangedDescriptor(uint32_t index, uint32_t end, uint64_t changed_since) const;
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
@@ -919,6 +1006,24 @@ class DescriptorSet : public BASE_NODE {
         void operator()(Descriptor *desc) { desc->~Descriptor(); }
     };
 
+    // The containers of a destroyed set, handed back to its pool so that a set allocated later with the same layout can
+    // reuse their allocations. Holds no descriptors.
+    struct Storage {
+        std::vector<DescriptorBackingStore> descriptor_store;
+        std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors;
+        std::vector<std::vector<uint64_t>> change_count_levels;
+        std::vector<size_t> dynamic_offset_idx_to_descriptor_list;
+
+        size_t MemoryUsage() const {
+            size_t usage = VectorMemoryUsage(descriptor_store) + VectorMemoryUsage(descriptors) +
+                           VectorMemoryUsage(change_count_levels) + VectorMemoryUsage(dynamic_offset_idx_to_descriptor_list);
+            for (const auto &level : change_count_levels) {
+                usage += VectorMemoryUsage(level);
+            }
+            return usage;
+        }
+    };
+
     void Destroy() override;
 
     // Cached binding and validation support:
@@ -926,19 +1031,54 @@ class DescriptorSet : public BASE_NODE {
     // For the lifespan of a given command buffer recording, do lazy evaluation, caching, and dirtying of
     // expensive validation operation (typically per-draw)
     // Track the validation caching of bindings vs. the command buffer and draw state
-    typedef layer_data::unordered_map<uint32_t, uint64_t> VersionedBindings;
     // this structure is stored in a map in CMD_BUFFER_STATE, with an entry for every descriptor set.
+    // Bindings are tracked by binding index, which the layout numbers densely, so that lookups are array accesses.
     struct CachedValidation {
-        TrackedBindings command_binding_and_usage;                                     // Persistent for the life of the recording
-        TrackedBindings non_dynamic_buffers;                                           // Persistent for the life of the recording
-        TrackedBindings dynamic_buffers;                                               // Dirtied (flushed) each BindDescriptorSet
-        layer_data::unordered_map<const PIPELINE_STATE *, VersionedBindings> image_samplers;  // Tested vs. changes to CB's ImageLayout
+        static const uint64_t kNotValidated = UINT64_MAX;
+        typedef std::vector<uint64_t> VersionedBindings;
+
+        // Small open addressed table from pipelines to the image layout change count each of their image bindings was last
+        // validated at, since a command buffer rarely draws with a given set through more than a handful of pipelines.
+        class PipelineVersions {
+          public:
+            // Returns nullptr if no binding was validated for pipeline
+            const VersionedBindings *Find(const PIPELINE_STATE *pipeline) const;
+            // Adds pipeline with binding_count bindings at kNotValidated if it isn't present
+            VersionedBindings &Get(const PIPELINE_STATE *pipeline, uint32_t binding_count);
+
+          private:
+            struct Entry {
+                const PIPELINE_STATE *pipeline = nullptr;
+                VersionedBindings versions;
+            };
+            static size_t Hash(const PIPELINE_STATE *pipeline);
+            void Grow();
+
+            std::vector<Entry> entries_;  // Power of two size, kept at most three quarters full
+            size_t count_ = 0;
+        };
+
+        std::vector<bool> buffers;              // Persistent for the life of the recording
+        uint32_t non_dynamic_buffer_count = 0;  // Number of non-dynamic buffer bindings set in buffers
+        uint32_t dynamic_buffer_count = 0;      // Number of dynamic buffer bindings set in buffers
+        PipelineVersions image_samplers;        // Tested vs. changes to CB's ImageLayout
     };
+  protected:
+    void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override;
+
   private:
     // Private helper to set all bound cmd buffers to INVALID state
     void InvalidateBoundCmdBuffers(ValidationStateTracker *state_data);
+    void RecordDescriptorChange(uint32_t index);
+    // Must be called with shared_validation_lock_ held
+    bool SharedValidationCurrent() const;
+    bool SharedBufferValidated(uint32_t index) const {
+        return index < shared_validated_buffers_.size() && shared_validated_buffers_[index];
+    }
     bool some_update_;  // has any part of the set ever been updated?
     DESCRIPTOR_POOL_STATE *pool_state_;
+    // Outlives the pool, since a set can be referenced after the pool that allocated it is gone
+    const std::shared_ptr<DescriptorSetRecycler> recycler_;
     const std::shared_ptr<DescriptorSetLayout const> layout_;
     // NOTE: the the backing store for the descriptors must be declared *before* it so it will be destructed *after* it
     // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
@@ -947,15 +1087,54 @@ class DescriptorSet : public BASE_NODE {
     const StateTracker *state_data_;
     uint32_t variable_count_;
     uint64_t change_count_;
+    // For sets with many descriptors, the change count each descriptor was last updated at, and above that levels holding the
+    // latest change count of each block of kChangeLevelSize entries of the level below. Lets a draw that already validated the
+    // set skip straight to the descriptors written since.
+    static const uint32_t kChangeLevelBits = 6;
+    static const uint32_t kChangeLevelSize = 1u << kChangeLevelBits;
+    std::vector<std::vector<uint64_t>> change_count_levels_;
+
+    // Buffer bindings validated by any command buffer (see SetBuffersValidated), by binding index, and the change count and
+    // invalidation count of the set they were validated at
+    mutable ReadWriteLock shared_validation_lock_;
+    mutable std::vector<bool> shared_validated_buffers_;
+    mutable uint64_t shared_validation_change_count_;
+    mutable uint64_t shared_validation_invalidation_count_;
+    std::atomic<uint64_t> invalidation_count_;
 
     // For a given dynamic offset index in the set, map to associated index of the descriptors in the set
     std::vector<size_t> dynamic_offset_idx_to_descriptor_list_;
 
     // If this descriptor set is a push descriptor set, the descriptor
-    // set writes that were last pushed.
+    // set writes that were last pushed. Only kept if the validation object sets retain_push_descriptor_writes.
     std::vector<safe_VkWriteDescriptorSet> push_descriptor_set_writes;
 };
 
+// Per pool free list of DescriptorSet storage, keyed by the layout of the set that used it.
+//
+// Transient pools allocate and free sets with the same few layouts every frame, so the storage of a set is kept when its
+// state object is destroyed and reused by the next allocation with the same layout, rather than going back to the heap. The
+// layout is only a key, the storage is resized to whatever layout takes it, so reuse is safe even if the address of a
+// destroyed layout is reused. At most as much storage as the pool has sets is kept. Shared between the pool and its sets,
+// since the last reference to a set can be dropped on any thread, and after the pool is destroyed.
+class DescriptorSetRecycler {
+  public:
+    explicit DescriptorSetRecycler(uint32_t max_count) : max_count_(max_count) {}
+    ~DescriptorSetRecycler() { Clear(); }
+
+    // Returns false if no storage used by layout is available
+    bool Take(const DescriptorSetLayout *layout, DescriptorSet::Storage &storage);
+    void Give(const DescriptorSetLayout *layout, DescriptorSet::Storage &&storage);
+    // Frees everything kept, and stops keeping storage
+    void Clear();
+
+  private:
+    std::mutex lock_;
+    layer_data::unordered_map<const DescriptorSetLayout *, std::vector<DescriptorSet::Storage>> free_;
+    uint32_t count_ = 0;
+    uint32_t max_count_;
+};
+
 // For the "bindless" style resource usage with many descriptors, need to optimize binding and validation
 class PrefilterBindRequestMap {
   public:
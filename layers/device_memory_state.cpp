@@ -86,24 +86,76 @@ DEVICE_MEMORY_STATE::DEVICE_MEMORY_STATE(VkDeviceMemory mem, const VkMemoryAlloc
       p_driver_data(nullptr),
       fake_base_address(fake_address) {}
 
+void MemoryBindingIndex::Add(VkDeviceSize offset, VkDeviceSize size, const VulkanTypedHandle &handle,
+                             std::weak_ptr<BASE_NODE> &&node) {
+    // Zero sized ranges still overlap the offset they are bound to
+    size = std::max(size, VkDeviceSize(1));
+    auto guard = WriteLockGuard(lock_);
+    ranges_.emplace(offset, Entry{offset + size, handle, std::move(node)});
+    max_size_ = std::max(max_size_, size);
+}
+
+void MemoryBindingIndex::Remove(VkDeviceSize offset, const VulkanTypedHandle &handle) {
+    auto guard = WriteLockGuard(lock_);
+    auto bound = ranges_.equal_range(offset);
+    for (auto pos = bound.first; pos != bound.second; ++pos) {
+        if (pos->second.handle == handle) {
+            ranges_.erase(pos);
+            return;
+        }
+    }
+}
+
+BASE_NODE::NodeList MemoryBindingIndex::Overlapping(VkDeviceSize offset, VkDeviceSize size) const {
+    BASE_NODE::NodeList result;
+    const VkDeviceSize end = offset + std::max(size, VkDeviceSize(1));
+    auto guard = ReadLockGuard(lock_);
+    // A range starting at or before offset - max_size_ ends at or before offset
+    const VkDeviceSize first_begin = (offset >= max_size_) ? offset - max_size_ + 1 : 0;
+    for (auto pos = ranges_.lower_bound(first_begin); pos != ranges_.end() && pos->first < end; ++pos) {
+        if (pos->second.end <= offset) continue;
+        auto node = pos->second.node.lock();
+        if (node) {
+            result.emplace_back(std::move(node));
+        }
+    }
+    return result;
+}
+
 void BINDABLE::Destroy() {
     for (auto &item: bound_memory_) {
         if (item.second.mem_state) {
+            if (!sparse) {
+                item.second.mem_state->bound_ranges.Remove(item.second.offset, Handle());
+            }
             item.second.mem_state->RemoveParent(this);
         }
     }
     bound_memory_.clear();
+    sparse_bindings_.clear();
+    sparse_binding_counts_.clear();
     BASE_NODE::Destroy();
 }
 
+void BINDABLE::NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) {
+    // Bound memory objects are the only children of type VkDeviceMemory, and only become invalid when they are freed
+    if (!invalid_nodes.empty() && invalid_nodes.back()->Type() == kVulkanObjectTypeDeviceMemory) {
+        invalid_memory_count_++;
+    }
+    BASE_NODE::NotifyInvalidate(invalid_nodes, unlink);
+}
+
 // SetMemBinding is used to establish immutable, non-sparse binding between a single image/buffer object and memory object.
 // Corresponding valid usage checks are in ValidateSetMemBinding().
-void BINDABLE::SetMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize memory_offset) {
+void BINDABLE::SetMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize memory_offset, VkDeviceSize size) {
     if (!mem) {
         return;
     }
     assert(!sparse);
     if (bound_memory_.size() > 0) {
+        for (auto &item : bound_memory_) {
+            item.second.mem_state->bound_ranges.Remove(item.second.offset, Handle());
+        }
         bound_memory_.clear();
     }
 
@@ -112,25 +164,72 @@ void BINDABLE::SetMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDevice
         memory_offset,
     };
     binding.mem_state->AddParent(this);
+    mem->bound_ranges.Add(memory_offset, size, Handle(), shared_from_this());
     bound_memory_.insert({mem->mem(), binding});
 }
 
-// For NULL mem case, clear any previous binding Else...
-// Make sure given object is in its object map
-//  IF a previous binding existed, update binding
-//  Add reference from objectInfo to memoryInfo
-//  Add reference off of object's binding info
-// Return VK_TRUE if addition is successful, VK_FALSE otherwise
-void BINDABLE::SetSparseMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, const VkDeviceSize mem_offset,
-                                   const VkDeviceSize mem_size) {
-    if (!mem) {
+// Replaces the part of every binding that overlaps the bound range, and releases the memory objects no binding uses anymore
+void BINDABLE::SetSparseMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize resource_offset,
+                                   VkDeviceSize mem_offset, VkDeviceSize size) {
+    assert(sparse);
+    if (size == 0) {
         return;
     }
+    const SparseBindingMap::key_type range(resource_offset, resource_offset + size);
+
+    // Each binding the new one overlaps loses the overlapped part, and is split in two if it covers both ends of the range
+    small_vector<VkDeviceMemory, 4> released;
+    for (auto pos = sparse_bindings_.lower_bound(range); pos != sparse_bindings_.end() && pos->first.begin < range.end; ++pos) {
+        const VkDeviceMemory mem_handle = pos->second.mem_state->mem();
+        const bool keeps_lower = pos->first.begin < range.begin;
+        const bool keeps_upper = pos->first.end > range.end;
+        if (keeps_lower && keeps_upper) {
+            sparse_binding_counts_[mem_handle]++;
+        } else if (!keeps_lower && !keeps_upper) {
+            released.emplace_back(mem_handle);
+        }
+    }
+
+    if (mem) {
+        MEM_BINDING sparse_binding = {mem, mem_offset - resource_offset, size};
+        sparse_bindings_.overwrite_range(std::make_pair(range, sparse_binding));
+        AddSparseMemory(mem, mem_offset, size);
+    } else {
+        sparse_bindings_.erase_range(range);
+    }
+    for (const auto mem_handle : released) {
+        ReleaseSparseMemory(mem_handle);
+    }
+}
+
+void BINDABLE::SetSparseImageMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize mem_offset, VkDeviceSize size) {
     assert(sparse);
-    MEM_BINDING sparse_binding = {mem, mem_offset, mem_size};
-    sparse_binding.mem_state->AddParent(this);
-    // Need to set mem binding for this object
-    bound_memory_.insert({mem->mem(), sparse_binding});
+    if (mem) {
+        AddSparseMemory(mem, mem_offset, size);
+    }
+}
+
+void BINDABLE::AddSparseMemory(const std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize mem_offset, VkDeviceSize size) {
+    if (sparse_binding_counts_[mem->mem()]++ == 0) {
+        MEM_BINDING sparse_binding = {mem, mem_offset, size};
+        mem->AddParent(this);
+        bound_memory_.insert({mem->mem(), sparse_binding});
+    }
+}
+
+void BINDABLE::ReleaseSparseMemory(VkDeviceMemory mem) {
+    auto &count = sparse_binding_counts_[mem];
+    assert(count > 0);
+    if (--count > 0) {
+        return;
+    }
+    sparse_binding_counts_.erase(mem);
+    auto mem_state = bound_memory_[mem].mem_state;
+    if (mem_state->Destroyed()) {
+        invalid_memory_count_--;
+    }
+    mem_state->RemoveParent(this);
+    bound_memory_.erase(mem);
 }
 
 VkDeviceSize BINDABLE::GetFakeBaseAddress() const {
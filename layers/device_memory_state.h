@@ -27,6 +27,9 @@
  */
 #pragma once
 #include "base_node.h"
+#include "range_vector.h"
+
+#include <map>
 
 class IMAGE_STATE;
 
@@ -51,6 +54,28 @@ struct DedicatedBinding {
         : handle(image, kVulkanObjectTypeImage), create_info(image_create_info) {}
 };
 
+// The ranges of a memory object bound to buffers, images and acceleration structures, sorted by offset. No range is longer than
+// the longest one added, so a query only visits the ranges starting within that distance before it, instead of every
+// sub-allocation of the memory object.
+class MemoryBindingIndex {
+  public:
+    void Add(VkDeviceSize offset, VkDeviceSize size, const VulkanTypedHandle &handle, std::weak_ptr<BASE_NODE> &&node);
+    void Remove(VkDeviceSize offset, const VulkanTypedHandle &handle);
+
+    // The live objects bound to a range overlapping [offset, offset + size)
+    BASE_NODE::NodeList Overlapping(VkDeviceSize offset, VkDeviceSize size) const;
+
+  private:
+    struct Entry {
+        VkDeviceSize end;
+        VulkanTypedHandle handle;
+        std::weak_ptr<BASE_NODE> node;
+    };
+    std::multimap<VkDeviceSize, Entry> ranges_;
+    VkDeviceSize max_size_ = 0;
+    mutable ReadWriteLock lock_;
+};
+
 // Data struct for tracking memory object
 class DEVICE_MEMORY_STATE : public BASE_NODE {
   public:
@@ -62,6 +87,8 @@ class DEVICE_MEMORY_STATE : public BASE_NODE {
     const layer_data::optional<DedicatedBinding> dedicated;
 
     MemRange mapped_range;
+    // Ranges bound with SetMemBinding(), sparse bindings aren't indexed
+    MemoryBindingIndex bound_ranges;
     void *p_driver_data;             // Pointer to application's actual memory
     const VkDeviceSize fake_base_address;  // To allow a unified view of allocations, useful to Synchronization Validation
 
@@ -109,6 +136,16 @@ class BINDABLE : public BASE_NODE {
     using BoundMemoryMap = small_unordered_map<VkDeviceMemory, MEM_BINDING, 1>;
     BoundMemoryMap bound_memory_;
 
+    // The opaque sparse bindings, keyed by resource offset. The offset of each binding is the memory offset that resource
+    // offset 0 would have, so that a binding split by a later bind still maps its resource offsets right.
+    using SparseBindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
+    SparseBindingMap sparse_bindings_;
+    // Number of sparse_bindings_ entries, and of image binds, using each memory object of bound_memory_
+    small_unordered_map<VkDeviceMemory, uint32_t, 1> sparse_binding_counts_;
+    // Number of memory objects in bound_memory_ that have been freed, kept by NotifyInvalidate() so that Invalid() doesn't
+    // have to look at every memory object a sparse resource is bound to
+    std::atomic<uint32_t> invalid_memory_count_;
+
   public:
     // Tracks external memory types creating resource
     const VkExternalMemoryHandleTypeFlags external_memory_handle;
@@ -119,6 +156,7 @@ class BINDABLE : public BASE_NODE {
     BINDABLE(Handle h, VulkanObjectType t, bool is_sparse, bool is_unprotected, VkExternalMemoryHandleTypeFlags handle_type)
         : BASE_NODE(h, t),
           bound_memory_{},
+          invalid_memory_count_(0),
           external_memory_handle(handle_type),
           sparse(is_sparse),
           unprotected(is_unprotected) {}
@@ -141,8 +179,13 @@ class BINDABLE : public BASE_NODE {
 
     const DEVICE_MEMORY_STATE *MemState() const { return Binding() ? Binding()->mem_state.get() : nullptr; }
 
-    virtual void SetMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize memory_offset);
-    void SetSparseMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, const VkDeviceSize mem_offset, const VkDeviceSize mem_size);
+    // size is that of the memory requirements of the object, for the bound range index of the memory
+    virtual void SetMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize memory_offset, VkDeviceSize size);
+    // Binds [resource_offset, resource_offset + size) of the resource to mem, or unbinds it if mem is null
+    void SetSparseMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize resource_offset, VkDeviceSize mem_offset,
+                             VkDeviceSize size);
+    // Non-opaque image binds aren't indexed, the memory they bind stays bound to the image
+    void SetSparseImageMemBinding(std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize mem_offset, VkDeviceSize size);
 
     bool IsExternalAHB() const {
         return (external_memory_handle & VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID) != 0;
@@ -150,15 +193,12 @@ class BINDABLE : public BASE_NODE {
 
     virtual VkDeviceSize GetFakeBaseAddress() const;
 
-    bool Invalid() const override {
-        if (Destroyed()) {
-            return true;
-        }
-        for (const auto &entry : bound_memory_) {
-            if (!entry.second.mem_state || entry.second.mem_state->Invalid()) {
-                return true;
-            }
-        }
-        return false;
-    }
+    bool Invalid() const override { return Destroyed() || invalid_memory_count_.load() > 0; }
+
+  protected:
+    void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override;
+
+  private:
+    void AddSparseMemory(const std::shared_ptr<DEVICE_MEMORY_STATE> &mem, VkDeviceSize mem_offset, VkDeviceSize size);
+    void ReleaseSparseMemory(VkDeviceMemory mem);
 };
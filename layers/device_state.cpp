@@ -0,0 +1,215 @@
+/* Copyright (c) 2015-2022 The Khronos Group Inc.
+ * Copyright (c) 2015-2022 Valve Corporation
+ * Copyright (c) 2015-2022 LunarG, Inc.
+ * Copyright (C) 2015-2022 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "device_state.h"
+#include "vk_typemap_helper.h"
+
+VkFormatFeatureFlags2KHR FormatPropertiesCache::FormatProperties::DrmModifierFeatures(uint64_t modifier) const {
+    for (const auto &drm_modifier : drm_modifiers) {
+        if (drm_modifier.drmFormatModifier == modifier) return drm_modifier.drmFormatModifierTilingFeatures;
+    }
+    return 0;
+}
+
+VkFormatFeatureFlags2KHR FormatPropertiesCache::FormatProperties::AllDrmModifierFeatures() const {
+    VkFormatFeatureFlags2KHR features = 0;
+    for (const auto &drm_modifier : drm_modifiers) {
+        features |= drm_modifier.drmFormatModifierTilingFeatures;
+    }
+    return features;
+}
+
+std::shared_ptr<const FormatPropertiesCache::FormatProperties> FormatPropertiesCache::GetFormatProperties(VkFormat format,
+                                                                                                          bool format_feature2,
+                                                                                                          bool drm_modifiers) const {
+    // Devices of the same physical device may differ in the extensions they enable, each variant of the query has its entry
+    const FormatKey key = (static_cast<uint64_t>(format) << 2) | (format_feature2 ? 2 : 0) | (drm_modifiers ? 1 : 0);
+    {
+        ReadLockGuard guard(format_lock_);
+        auto it = formats_.find(key);
+        if (it != formats_.end()) return it->second;
+    }
+
+    auto entry = std::make_shared<FormatProperties>();
+    entry->format_feature2 = format_feature2;
+    entry->has_drm_modifiers = drm_modifiers;
+    entry->properties = LvlInitStruct<VkFormatProperties3KHR>();
+    if (format_feature2) {
+        auto drm_list = LvlInitStruct<VkDrmFormatModifierPropertiesList2EXT>();
+        auto props_3 = LvlInitStruct<VkFormatProperties3KHR>(drm_modifiers ? &drm_list : nullptr);
+        auto props_2 = LvlInitStruct<VkFormatProperties2>(&props_3);
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device_, format, &props_2);
+        if (drm_list.drmFormatModifierCount > 0) {
+            entry->drm_modifiers.resize(drm_list.drmFormatModifierCount);
+            drm_list.pDrmFormatModifierProperties = entry->drm_modifiers.data();
+            DispatchGetPhysicalDeviceFormatProperties2(physical_device_, format, &props_2);
+            entry->drm_modifiers.resize(drm_list.drmFormatModifierCount);
+        }
+        entry->properties.linearTilingFeatures = props_3.linearTilingFeatures;
+        entry->properties.optimalTilingFeatures = props_3.optimalTilingFeatures;
+        entry->properties.bufferFeatures = props_3.bufferFeatures;
+    } else {
+        VkFormatProperties format_properties = {};
+        if (drm_modifiers) {
+            auto drm_list = LvlInitStruct<VkDrmFormatModifierPropertiesListEXT>();
+            auto props_2 = LvlInitStruct<VkFormatProperties2>(&drm_list);
+            DispatchGetPhysicalDeviceFormatProperties2(physical_device_, format, &props_2);
+            std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties(drm_list.drmFormatModifierCount);
+            if (!drm_properties.empty()) {
+                drm_list.pDrmFormatModifierProperties = drm_properties.data();
+                DispatchGetPhysicalDeviceFormatProperties2(physical_device_, format, &props_2);
+            }
+            for (uint32_t i = 0; i < drm_list.drmFormatModifierCount && i < drm_properties.size(); ++i) {
+                entry->drm_modifiers.push_back({drm_properties[i].drmFormatModifier, drm_properties[i].drmFormatModifierPlaneCount,
+                                                drm_properties[i].drmFormatModifierTilingFeatures});
+            }
+            format_properties = props_2.formatProperties;
+        } else {
+            DispatchGetPhysicalDeviceFormatProperties(physical_device_, format, &format_properties);
+        }
+        entry->properties.linearTilingFeatures = format_properties.linearTilingFeatures;
+        entry->properties.optimalTilingFeatures = format_properties.optimalTilingFeatures;
+        entry->properties.bufferFeatures = format_properties.bufferFeatures;
+    }
+
+    // Threads racing on the same format got the same properties, keep the first
+    WriteLockGuard guard(format_lock_);
+    return formats_.emplace(key, std::move(entry)).first->second;
+}
+
+bool FormatPropertiesCache::ImageFormatQuery::operator==(const ImageFormatQuery &rhs) const {
+    return (query2 == rhs.query2) && (format == rhs.format) && (type == rhs.type) && (tiling == rhs.tiling) &&
+           (usage == rhs.usage) && (flags == rhs.flags) && (has_drm_modifier == rhs.has_drm_modifier) &&
+           (drm_modifier == rhs.drm_modifier) && (drm_sharing_mode == rhs.drm_sharing_mode) &&
+           (has_view_type == rhs.has_view_type) && (view_type == rhs.view_type) && (handle_type == rhs.handle_type) &&
+           (filter_cubic == rhs.filter_cubic) && (external == rhs.external);
+}
+
+size_t FormatPropertiesCache::ImageFormatQuery::hash() const {
+    hash_util::HashCombiner hc;
+    hc << query2 << format << type << tiling << usage << flags << has_drm_modifier << drm_modifier << drm_sharing_mode
+       << has_view_type << view_type << handle_type << filter_cubic << external;
+    return hc.Value();
+}
+
+VkResult FormatPropertiesCache::GetImageFormatProperties(VkFormat format, VkImageType type, VkImageTiling tiling,
+                                                         VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                         VkImageFormatProperties *properties) const {
+    ImageFormatQuery query;
+    query.format = format;
+    query.type = type;
+    query.tiling = tiling;
+    query.usage = usage;
+    query.flags = flags;
+    {
+        ReadLockGuard guard(image_format_lock_);
+        auto it = image_formats_.find(query);
+        if (it != image_formats_.end()) {
+            *properties = it->second.properties;
+            return it->second.result;
+        }
+    }
+
+    ImageFormatResult result = {};
+    result.result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device_, format, type, tiling, usage, flags,
+                                                                   &result.properties);
+    *properties = result.properties;
+    WriteLockGuard guard(image_format_lock_);
+    image_formats_.emplace(query, result);
+    return result.result;
+}
+
+VkResult FormatPropertiesCache::GetImageFormatProperties2(const VkPhysicalDeviceImageFormatInfo2 *info,
+                                                          VkImageFormatProperties2 *properties) const {
+    ImageFormatQuery query;
+    query.query2 = true;
+    query.format = info->format;
+    query.type = info->type;
+    query.tiling = info->tiling;
+    query.usage = info->usage;
+    query.flags = info->flags;
+    bool cacheable = true;
+    for (auto in = static_cast<const VkBaseInStructure *>(info->pNext); in && cacheable; in = in->pNext) {
+        switch (in->sType) {
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: {
+                const auto drm_info = reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT *>(in);
+                query.has_drm_modifier = true;
+                query.drm_modifier = drm_info->drmFormatModifier;
+                query.drm_sharing_mode = drm_info->sharingMode;
+                // The queue families of concurrent sharing are not part of the key
+                cacheable = (drm_info->sharingMode == VK_SHARING_MODE_EXCLUSIVE);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT:
+                query.has_view_type = true;
+                query.view_type = reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT *>(in)->imageViewType;
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+                query.handle_type = reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo *>(in)->handleType;
+                break;
+            default:
+                cacheable = false;
+                break;
+        }
+    }
+    VkFilterCubicImageViewImageFormatPropertiesEXT *filter_cubic = nullptr;
+    VkExternalImageFormatProperties *external = nullptr;
+    for (auto out = static_cast<VkBaseOutStructure *>(properties->pNext); out && cacheable; out = out->pNext) {
+        switch (out->sType) {
+            case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT:
+                filter_cubic = reinterpret_cast<VkFilterCubicImageViewImageFormatPropertiesEXT *>(out);
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+                external = reinterpret_cast<VkExternalImageFormatProperties *>(out);
+                break;
+            default:
+                cacheable = false;
+                break;
+        }
+    }
+    if (!cacheable) {
+        return DispatchGetPhysicalDeviceImageFormatProperties2(physical_device_, info, properties);
+    }
+    query.filter_cubic = (filter_cubic != nullptr);
+    query.external = (external != nullptr);
+
+    {
+        ReadLockGuard guard(image_format_lock_);
+        auto it = image_formats_.find(query);
+        if (it != image_formats_.end()) {
+            const ImageFormatResult &result = it->second;
+            properties->imageFormatProperties = result.properties;
+            if (filter_cubic) {
+                filter_cubic->filterCubic = result.filter_cubic.filterCubic;
+                filter_cubic->filterCubicMinmax = result.filter_cubic.filterCubicMinmax;
+            }
+            if (external) {
+                external->externalMemoryProperties = result.external;
+            }
+            return result.result;
+        }
+    }
+
+    ImageFormatResult result = {};
+    result.result = DispatchGetPhysicalDeviceImageFormatProperties2(physical_device_, info, properties);
+    result.properties = properties->imageFormatProperties;
+    if (filter_cubic) result.filter_cubic = *filter_cubic;
+    if (external) result.external = external->externalMemoryProperties;
+    WriteLockGuard guard(image_format_lock_);
+    image_formats_.emplace(query, result);
+    return result.result;
+}
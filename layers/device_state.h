@@ -26,7 +26,9 @@
  */
 #pragma once
 #include "base_node.h"
+#include "hash_util.h"
 #include "layer_chassis_dispatch.h"
+#include <memory>
 #include <vector>
 
 struct DeviceFeatures {
@@ -106,6 +108,79 @@ class SURFACELESS_QUERY_STATE {
     VkSurfaceCapabilitiesKHR capabilities;
 };
 
+// Format and image format properties of a physical device, queried from the driver once and then answered from memory, as
+// creating images, views and buffer views would otherwise query them again for each object.
+//
+// Format properties are queried per format with the structs the caller asks for: VkFormatProperties3KHR when the device has
+// VK_KHR_format_feature_flags2, else VkFormatProperties widened to 64 bits, and the DRM format modifier list when it has
+// VK_EXT_image_drm_format_modifier. Image format properties are keyed by the whole query, including the DRM format modifier,
+// image view and external memory structs the layer chains. Queries with other structs in their chains go to the driver.
+// Entries are never removed, the properties of a physical device don't change and there are only so many queries.
+class FormatPropertiesCache {
+  public:
+    struct FormatProperties {
+        VkFormatProperties3KHR properties;
+        // Only filled when queried with drm_modifiers
+        std::vector<VkDrmFormatModifierProperties2EXT> drm_modifiers;
+        bool format_feature2 = false;
+        bool has_drm_modifiers = false;
+
+        VkFormatFeatureFlags2KHR TilingFeatures(VkImageTiling tiling) const {
+            return (tiling == VK_IMAGE_TILING_LINEAR) ? properties.linearTilingFeatures : properties.optimalTilingFeatures;
+        }
+        // The features of the DRM format modifier, or 0 if the format doesn't support it
+        VkFormatFeatureFlags2KHR DrmModifierFeatures(uint64_t modifier) const;
+        // The union of the features of all DRM format modifiers of the format
+        VkFormatFeatureFlags2KHR AllDrmModifierFeatures() const;
+    };
+
+    explicit FormatPropertiesCache(VkPhysicalDevice physical_device) : physical_device_(physical_device) {}
+
+    std::shared_ptr<const FormatProperties> GetFormatProperties(VkFormat format, bool format_feature2, bool drm_modifiers) const;
+    // As DispatchGetPhysicalDeviceImageFormatProperties
+    VkResult GetImageFormatProperties(VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage,
+                                      VkImageCreateFlags flags, VkImageFormatProperties *properties) const;
+    // As DispatchGetPhysicalDeviceImageFormatProperties2
+    VkResult GetImageFormatProperties2(const VkPhysicalDeviceImageFormatInfo2 *info, VkImageFormatProperties2 *properties) const;
+
+  private:
+    // The format and which structs were queried
+    using FormatKey = uint64_t;
+    struct ImageFormatQuery {
+        bool query2 = false;
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        VkImageType type = VK_IMAGE_TYPE_2D;
+        VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL;
+        VkImageUsageFlags usage = 0;
+        VkImageCreateFlags flags = 0;
+        bool has_drm_modifier = false;
+        uint64_t drm_modifier = 0;
+        VkSharingMode drm_sharing_mode = VK_SHARING_MODE_EXCLUSIVE;
+        bool has_view_type = false;
+        VkImageViewType view_type = VK_IMAGE_VIEW_TYPE_2D;
+        VkExternalMemoryHandleTypeFlagBits handle_type = static_cast<VkExternalMemoryHandleTypeFlagBits>(0);
+        // The output structs in the chain
+        bool filter_cubic = false;
+        bool external = false;
+
+        bool operator==(const ImageFormatQuery &rhs) const;
+        size_t hash() const;
+    };
+    struct ImageFormatResult {
+        VkResult result;
+        VkImageFormatProperties properties;
+        VkFilterCubicImageViewImageFormatPropertiesEXT filter_cubic;
+        VkExternalMemoryProperties external;
+    };
+
+    const VkPhysicalDevice physical_device_;
+    mutable ReadWriteLock format_lock_;
+    mutable layer_data::unordered_map<FormatKey, std::shared_ptr<const FormatProperties>> formats_;
+    mutable ReadWriteLock image_format_lock_;
+    mutable layer_data::unordered_map<ImageFormatQuery, ImageFormatResult, hash_util::HasHashMember<ImageFormatQuery>>
+        image_formats_;
+};
+
 class PHYSICAL_DEVICE_STATE : public BASE_NODE {
   public:
     uint32_t queue_family_known_count = 1;  // spec implies one QF must always be supported
@@ -120,8 +195,13 @@ class PHYSICAL_DEVICE_STATE : public BASE_NODE {
     // Surfaceless Query extension needs 'global' surface_state data
     SURFACELESS_QUERY_STATE surfaceless_query_state{};
 
+    // Shared by all devices of the physical device, see FormatPropertiesCache
+    const FormatPropertiesCache format_properties;
+
     PHYSICAL_DEVICE_STATE(VkPhysicalDevice phys_dev)
-        : BASE_NODE(phys_dev, kVulkanObjectTypePhysicalDevice), queue_family_properties(GetQueueFamilyProps(phys_dev)) {}
+        : BASE_NODE(phys_dev, kVulkanObjectTypePhysicalDevice),
+          queue_family_properties(GetQueueFamilyProps(phys_dev)),
+          format_properties(phys_dev) {}
 
     VkPhysicalDevice PhysDev() const { return handle_.Cast<VkPhysicalDevice>(); }
 
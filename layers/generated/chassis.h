@@ -50,24 +50,13 @@
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "unique_id_mapping.h"
+#include "handle_registry.h"
+#include "call_context.h"
+#include "validation_counters.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern UniqueIdMapping unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -3446,6 +3435,11 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_OBJECT_IN_USE,
     VALIDATION_CHECK_DISABLE_QUERY_VALIDATION,
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION,
+    VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION,
+    VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION,
 } ValidationCheckDisables;
 
 typedef enum ValidationCheckEnables {
@@ -3474,6 +3468,11 @@ typedef enum DisableFlags {
     handle_wrapping,
     shader_validation,
     shader_validation_caching,
+    descriptor_content_validation,
+    submit_image_layout_validation,
+    dynamic_state_validation,
+    vertex_buffer_validation,
+    render_pass_compatibility_validation,
     // Insert new disables above this line
     kMaxDisableFlags,
 } DisableFlags;
@@ -3499,6 +3498,24 @@ typedef std::array<bool, kMaxEnableFlags> CHECK_ENABLED;
 #else
 #define DECORATE_PRINTF(_fmt_num, _first_param_num)
 #endif
+
+class ValidationThreadPool;
+
+#ifdef VVL_FIXED_CHASSIS
+class StatelessValidation;
+class ObjectLifetimes;
+class CoreChecks;
+
+// With VVL_FIXED_CHASSIS the device-level validation object set is fixed at compile time. The intercepts call through these
+// typed pointers with qualified names, so the compiler can inline the calls (or drop them when the base class no-op is used)
+// instead of going through the ValidationObject vtable. A null pointer means the object was disabled at runtime.
+struct FixedValidationObjects {
+    StatelessValidation *stateless_validation = nullptr;
+    ObjectLifetimes *object_tracker = nullptr;
+    CoreChecks *core_checks = nullptr;
+};
+#endif
+
 // Layer chassis validation object base class definition
 class ValidationObject {
     public:
@@ -3514,6 +3531,29 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{false};
+        bool deferred_command_validation{false};
+        bool async_validation{false};
+        bool command_buffer_fingerprinting{false};
+        uint32_t memory_report_interval{0};
+        bool parallel_pipeline_validation{false};
+        bool async_shader_validation{false};
+        uint32_t specialization_cache_size{0};
+        bool parallel_descriptor_update_validation{false};
+        bool parallel_sync_resolve{false};
+        bool parallel_sync_hazard_detection{false};
+        bool parallel_submit_validation{false};
+        uint32_t syncval_max_memory_mb{0};
+        uint32_t thread_safety_sampling{0};
+        bool stateless_create_info_memo{false};
+        bool async_submission_retirement{false};
+        uint32_t housekeeping_budget_us{0};
+        uint32_t housekeeping_submit_interval{0};
+        // The layer-wide worker threads, set at instance creation when a setting uses them
+        std::shared_ptr<ValidationThreadPool> thread_pool;
+        // The records of each wrapped handle shared by the validation objects, set when handles are wrapped by the slab
+        std::shared_ptr<HandleRegistry> handle_registry;
+        // The PreCallValidate hooks run per intercept, set on the device object with khronos_validation.validation_counters
+        std::unique_ptr<std::atomic<uint64_t>[]> validate_call_counts;
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -3522,6 +3562,9 @@ class ValidationObject {
 
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
+#ifdef VVL_FIXED_CHASSIS
+        FixedValidationObjects fixed_objects;
+#endif
 
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void()>>, 0> deferred_operation_post_completion;
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void(const std::vector<VkPipeline>&)>>, 0> deferred_operation_post_check;
@@ -3544,6 +3587,9 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Appends the counters of this validation object, see validation_counters.h
+        virtual void GetValidationCounters(ValidationCounterList &counters) const {}
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -3558,6 +3604,25 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            deferred_command_validation = framework->deferred_command_validation;
+            async_validation = framework->async_validation;
+            command_buffer_fingerprinting = framework->command_buffer_fingerprinting;
+            memory_report_interval = framework->memory_report_interval;
+            parallel_pipeline_validation = framework->parallel_pipeline_validation;
+            async_shader_validation = framework->async_shader_validation;
+            specialization_cache_size = framework->specialization_cache_size;
+            parallel_descriptor_update_validation = framework->parallel_descriptor_update_validation;
+            parallel_sync_resolve = framework->parallel_sync_resolve;
+            parallel_sync_hazard_detection = framework->parallel_sync_hazard_detection;
+            parallel_submit_validation = framework->parallel_submit_validation;
+            syncval_max_memory_mb = framework->syncval_max_memory_mb;
+            thread_safety_sampling = framework->thread_safety_sampling;
+            stateless_create_info_memo = framework->stateless_create_info_memo;
+            async_submission_retirement = framework->async_submission_retirement;
+            housekeeping_budget_us = framework->housekeeping_budget_us;
+            housekeeping_submit_interval = framework->housekeeping_submit_interval;
+            thread_pool = framework->thread_pool;
+            handle_registry = framework->handle_registry;
             instance = inst;
         }
 
@@ -3573,6 +3638,25 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                deferred_command_validation = inst_obj->deferred_command_validation;
+                async_validation = inst_obj->async_validation;
+                command_buffer_fingerprinting = inst_obj->command_buffer_fingerprinting;
+                memory_report_interval = inst_obj->memory_report_interval;
+                parallel_pipeline_validation = inst_obj->parallel_pipeline_validation;
+                async_shader_validation = inst_obj->async_shader_validation;
+                specialization_cache_size = inst_obj->specialization_cache_size;
+                parallel_descriptor_update_validation = inst_obj->parallel_descriptor_update_validation;
+                parallel_sync_resolve = inst_obj->parallel_sync_resolve;
+                parallel_sync_hazard_detection = inst_obj->parallel_sync_hazard_detection;
+                parallel_submit_validation = inst_obj->parallel_submit_validation;
+                syncval_max_memory_mb = inst_obj->syncval_max_memory_mb;
+                thread_safety_sampling = inst_obj->thread_safety_sampling;
+                stateless_create_info_memo = inst_obj->stateless_create_info_memo;
+                async_submission_retirement = inst_obj->async_submission_retirement;
+                housekeeping_budget_us = inst_obj->housekeeping_budget_us;
+                housekeeping_submit_interval = inst_obj->housekeeping_submit_interval;
+                thread_pool = inst_obj->thread_pool;
+                handle_registry = dev_obj->handle_registry;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -3589,8 +3673,7 @@ class ValidationObject {
         };
 
         // Debug Logging Helpers
-        bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3603,12 +3686,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3622,12 +3704,11 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, single_object, vuid_text, str);
 
         };
 
-        bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3640,12 +3721,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3659,11 +3739,10 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, single_object, vuid_text, str);
         };
 
-        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
@@ -3676,12 +3755,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
@@ -3695,11 +3773,10 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
         };
 
-        bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3712,12 +3789,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -3731,7 +3807,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, single_object, vuid_text, str);
         };
 
         // Handle Wrapping Data
@@ -3764,17 +3840,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -5613,4 +5685,4 @@ class ValidationObject {
         };
 };
 
-extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+extern dispatch_key_map<ValidationObject> layer_data_map;
@@ -1313,6 +1313,1288 @@ typedef enum InterceptId{
     InterceptIdCount,
 } InterceptId;
 
+// The names of the intercepts, for khronos_validation.validation_counters
+static const char *const kInterceptNames[InterceptIdCount] = {
+    "PreCallValidateGetDeviceQueue",
+    "PreCallRecordGetDeviceQueue",
+    "PostCallRecordGetDeviceQueue",
+    "PreCallValidateQueueSubmit",
+    "PreCallRecordQueueSubmit",
+    "PostCallRecordQueueSubmit",
+    "PreCallValidateQueueWaitIdle",
+    "PreCallRecordQueueWaitIdle",
+    "PostCallRecordQueueWaitIdle",
+    "PreCallValidateDeviceWaitIdle",
+    "PreCallRecordDeviceWaitIdle",
+    "PostCallRecordDeviceWaitIdle",
+    "PreCallValidateAllocateMemory",
+    "PreCallRecordAllocateMemory",
+    "PostCallRecordAllocateMemory",
+    "PreCallValidateFreeMemory",
+    "PreCallRecordFreeMemory",
+    "PostCallRecordFreeMemory",
+    "PreCallValidateMapMemory",
+    "PreCallRecordMapMemory",
+    "PostCallRecordMapMemory",
+    "PreCallValidateUnmapMemory",
+    "PreCallRecordUnmapMemory",
+    "PostCallRecordUnmapMemory",
+    "PreCallValidateFlushMappedMemoryRanges",
+    "PreCallRecordFlushMappedMemoryRanges",
+    "PostCallRecordFlushMappedMemoryRanges",
+    "PreCallValidateInvalidateMappedMemoryRanges",
+    "PreCallRecordInvalidateMappedMemoryRanges",
+    "PostCallRecordInvalidateMappedMemoryRanges",
+    "PreCallValidateGetDeviceMemoryCommitment",
+    "PreCallRecordGetDeviceMemoryCommitment",
+    "PostCallRecordGetDeviceMemoryCommitment",
+    "PreCallValidateBindBufferMemory",
+    "PreCallRecordBindBufferMemory",
+    "PostCallRecordBindBufferMemory",
+    "PreCallValidateBindImageMemory",
+    "PreCallRecordBindImageMemory",
+    "PostCallRecordBindImageMemory",
+    "PreCallValidateGetBufferMemoryRequirements",
+    "PreCallRecordGetBufferMemoryRequirements",
+    "PostCallRecordGetBufferMemoryRequirements",
+    "PreCallValidateGetImageMemoryRequirements",
+    "PreCallRecordGetImageMemoryRequirements",
+    "PostCallRecordGetImageMemoryRequirements",
+    "PreCallValidateGetImageSparseMemoryRequirements",
+    "PreCallRecordGetImageSparseMemoryRequirements",
+    "PostCallRecordGetImageSparseMemoryRequirements",
+    "PreCallValidateQueueBindSparse",
+    "PreCallRecordQueueBindSparse",
+    "PostCallRecordQueueBindSparse",
+    "PreCallValidateCreateFence",
+    "PreCallRecordCreateFence",
+    "PostCallRecordCreateFence",
+    "PreCallValidateDestroyFence",
+    "PreCallRecordDestroyFence",
+    "PostCallRecordDestroyFence",
+    "PreCallValidateResetFences",
+    "PreCallRecordResetFences",
+    "PostCallRecordResetFences",
+    "PreCallValidateGetFenceStatus",
+    "PreCallRecordGetFenceStatus",
+    "PostCallRecordGetFenceStatus",
+    "PreCallValidateWaitForFences",
+    "PreCallRecordWaitForFences",
+    "PostCallRecordWaitForFences",
+    "PreCallValidateCreateSemaphore",
+    "PreCallRecordCreateSemaphore",
+    "PostCallRecordCreateSemaphore",
+    "PreCallValidateDestroySemaphore",
+    "PreCallRecordDestroySemaphore",
+    "PostCallRecordDestroySemaphore",
+    "PreCallValidateCreateEvent",
+    "PreCallRecordCreateEvent",
+    "PostCallRecordCreateEvent",
+    "PreCallValidateDestroyEvent",
+    "PreCallRecordDestroyEvent",
+    "PostCallRecordDestroyEvent",
+    "PreCallValidateGetEventStatus",
+    "PreCallRecordGetEventStatus",
+    "PostCallRecordGetEventStatus",
+    "PreCallValidateSetEvent",
+    "PreCallRecordSetEvent",
+    "PostCallRecordSetEvent",
+    "PreCallValidateResetEvent",
+    "PreCallRecordResetEvent",
+    "PostCallRecordResetEvent",
+    "PreCallValidateCreateQueryPool",
+    "PreCallRecordCreateQueryPool",
+    "PostCallRecordCreateQueryPool",
+    "PreCallValidateDestroyQueryPool",
+    "PreCallRecordDestroyQueryPool",
+    "PostCallRecordDestroyQueryPool",
+    "PreCallValidateGetQueryPoolResults",
+    "PreCallRecordGetQueryPoolResults",
+    "PostCallRecordGetQueryPoolResults",
+    "PreCallValidateDestroyBuffer",
+    "PreCallRecordDestroyBuffer",
+    "PostCallRecordDestroyBuffer",
+    "PreCallValidateCreateBufferView",
+    "PreCallRecordCreateBufferView",
+    "PostCallRecordCreateBufferView",
+    "PreCallValidateDestroyBufferView",
+    "PreCallRecordDestroyBufferView",
+    "PostCallRecordDestroyBufferView",
+    "PreCallValidateCreateImage",
+    "PreCallRecordCreateImage",
+    "PostCallRecordCreateImage",
+    "PreCallValidateDestroyImage",
+    "PreCallRecordDestroyImage",
+    "PostCallRecordDestroyImage",
+    "PreCallValidateGetImageSubresourceLayout",
+    "PreCallRecordGetImageSubresourceLayout",
+    "PostCallRecordGetImageSubresourceLayout",
+    "PreCallValidateCreateImageView",
+    "PreCallRecordCreateImageView",
+    "PostCallRecordCreateImageView",
+    "PreCallValidateDestroyImageView",
+    "PreCallRecordDestroyImageView",
+    "PostCallRecordDestroyImageView",
+    "PreCallValidateDestroyShaderModule",
+    "PreCallRecordDestroyShaderModule",
+    "PostCallRecordDestroyShaderModule",
+    "PreCallValidateCreatePipelineCache",
+    "PreCallRecordCreatePipelineCache",
+    "PostCallRecordCreatePipelineCache",
+    "PreCallValidateDestroyPipelineCache",
+    "PreCallRecordDestroyPipelineCache",
+    "PostCallRecordDestroyPipelineCache",
+    "PreCallValidateGetPipelineCacheData",
+    "PreCallRecordGetPipelineCacheData",
+    "PostCallRecordGetPipelineCacheData",
+    "PreCallValidateMergePipelineCaches",
+    "PreCallRecordMergePipelineCaches",
+    "PostCallRecordMergePipelineCaches",
+    "PreCallValidateDestroyPipeline",
+    "PreCallRecordDestroyPipeline",
+    "PostCallRecordDestroyPipeline",
+    "PreCallValidateDestroyPipelineLayout",
+    "PreCallRecordDestroyPipelineLayout",
+    "PostCallRecordDestroyPipelineLayout",
+    "PreCallValidateCreateSampler",
+    "PreCallRecordCreateSampler",
+    "PostCallRecordCreateSampler",
+    "PreCallValidateDestroySampler",
+    "PreCallRecordDestroySampler",
+    "PostCallRecordDestroySampler",
+    "PreCallValidateCreateDescriptorSetLayout",
+    "PreCallRecordCreateDescriptorSetLayout",
+    "PostCallRecordCreateDescriptorSetLayout",
+    "PreCallValidateDestroyDescriptorSetLayout",
+    "PreCallRecordDestroyDescriptorSetLayout",
+    "PostCallRecordDestroyDescriptorSetLayout",
+    "PreCallValidateCreateDescriptorPool",
+    "PreCallRecordCreateDescriptorPool",
+    "PostCallRecordCreateDescriptorPool",
+    "PreCallValidateDestroyDescriptorPool",
+    "PreCallRecordDestroyDescriptorPool",
+    "PostCallRecordDestroyDescriptorPool",
+    "PreCallValidateResetDescriptorPool",
+    "PreCallRecordResetDescriptorPool",
+    "PostCallRecordResetDescriptorPool",
+    "PreCallValidateFreeDescriptorSets",
+    "PreCallRecordFreeDescriptorSets",
+    "PostCallRecordFreeDescriptorSets",
+    "PreCallValidateUpdateDescriptorSets",
+    "PreCallRecordUpdateDescriptorSets",
+    "PostCallRecordUpdateDescriptorSets",
+    "PreCallValidateCreateFramebuffer",
+    "PreCallRecordCreateFramebuffer",
+    "PostCallRecordCreateFramebuffer",
+    "PreCallValidateDestroyFramebuffer",
+    "PreCallRecordDestroyFramebuffer",
+    "PostCallRecordDestroyFramebuffer",
+    "PreCallValidateCreateRenderPass",
+    "PreCallRecordCreateRenderPass",
+    "PostCallRecordCreateRenderPass",
+    "PreCallValidateDestroyRenderPass",
+    "PreCallRecordDestroyRenderPass",
+    "PostCallRecordDestroyRenderPass",
+    "PreCallValidateGetRenderAreaGranularity",
+    "PreCallRecordGetRenderAreaGranularity",
+    "PostCallRecordGetRenderAreaGranularity",
+    "PreCallValidateCreateCommandPool",
+    "PreCallRecordCreateCommandPool",
+    "PostCallRecordCreateCommandPool",
+    "PreCallValidateDestroyCommandPool",
+    "PreCallRecordDestroyCommandPool",
+    "PostCallRecordDestroyCommandPool",
+    "PreCallValidateResetCommandPool",
+    "PreCallRecordResetCommandPool",
+    "PostCallRecordResetCommandPool",
+    "PreCallValidateAllocateCommandBuffers",
+    "PreCallRecordAllocateCommandBuffers",
+    "PostCallRecordAllocateCommandBuffers",
+    "PreCallValidateFreeCommandBuffers",
+    "PreCallRecordFreeCommandBuffers",
+    "PostCallRecordFreeCommandBuffers",
+    "PreCallValidateBeginCommandBuffer",
+    "PreCallRecordBeginCommandBuffer",
+    "PostCallRecordBeginCommandBuffer",
+    "PreCallValidateEndCommandBuffer",
+    "PreCallRecordEndCommandBuffer",
+    "PostCallRecordEndCommandBuffer",
+    "PreCallValidateResetCommandBuffer",
+    "PreCallRecordResetCommandBuffer",
+    "PostCallRecordResetCommandBuffer",
+    "PreCallValidateCmdBindPipeline",
+    "PreCallRecordCmdBindPipeline",
+    "PostCallRecordCmdBindPipeline",
+    "PreCallValidateCmdSetViewport",
+    "PreCallRecordCmdSetViewport",
+    "PostCallRecordCmdSetViewport",
+    "PreCallValidateCmdSetScissor",
+    "PreCallRecordCmdSetScissor",
+    "PostCallRecordCmdSetScissor",
+    "PreCallValidateCmdSetLineWidth",
+    "PreCallRecordCmdSetLineWidth",
+    "PostCallRecordCmdSetLineWidth",
+    "PreCallValidateCmdSetDepthBias",
+    "PreCallRecordCmdSetDepthBias",
+    "PostCallRecordCmdSetDepthBias",
+    "PreCallValidateCmdSetBlendConstants",
+    "PreCallRecordCmdSetBlendConstants",
+    "PostCallRecordCmdSetBlendConstants",
+    "PreCallValidateCmdSetDepthBounds",
+    "PreCallRecordCmdSetDepthBounds",
+    "PostCallRecordCmdSetDepthBounds",
+    "PreCallValidateCmdSetStencilCompareMask",
+    "PreCallRecordCmdSetStencilCompareMask",
+    "PostCallRecordCmdSetStencilCompareMask",
+    "PreCallValidateCmdSetStencilWriteMask",
+    "PreCallRecordCmdSetStencilWriteMask",
+    "PostCallRecordCmdSetStencilWriteMask",
+    "PreCallValidateCmdSetStencilReference",
+    "PreCallRecordCmdSetStencilReference",
+    "PostCallRecordCmdSetStencilReference",
+    "PreCallValidateCmdBindDescriptorSets",
+    "PreCallRecordCmdBindDescriptorSets",
+    "PostCallRecordCmdBindDescriptorSets",
+    "PreCallValidateCmdBindIndexBuffer",
+    "PreCallRecordCmdBindIndexBuffer",
+    "PostCallRecordCmdBindIndexBuffer",
+    "PreCallValidateCmdBindVertexBuffers",
+    "PreCallRecordCmdBindVertexBuffers",
+    "PostCallRecordCmdBindVertexBuffers",
+    "PreCallValidateCmdDraw",
+    "PreCallRecordCmdDraw",
+    "PostCallRecordCmdDraw",
+    "PreCallValidateCmdDrawIndexed",
+    "PreCallRecordCmdDrawIndexed",
+    "PostCallRecordCmdDrawIndexed",
+    "PreCallValidateCmdDrawIndirect",
+    "PreCallRecordCmdDrawIndirect",
+    "PostCallRecordCmdDrawIndirect",
+    "PreCallValidateCmdDrawIndexedIndirect",
+    "PreCallRecordCmdDrawIndexedIndirect",
+    "PostCallRecordCmdDrawIndexedIndirect",
+    "PreCallValidateCmdDispatch",
+    "PreCallRecordCmdDispatch",
+    "PostCallRecordCmdDispatch",
+    "PreCallValidateCmdDispatchIndirect",
+    "PreCallRecordCmdDispatchIndirect",
+    "PostCallRecordCmdDispatchIndirect",
+    "PreCallValidateCmdCopyBuffer",
+    "PreCallRecordCmdCopyBuffer",
+    "PostCallRecordCmdCopyBuffer",
+    "PreCallValidateCmdCopyImage",
+    "PreCallRecordCmdCopyImage",
+    "PostCallRecordCmdCopyImage",
+    "PreCallValidateCmdBlitImage",
+    "PreCallRecordCmdBlitImage",
+    "PostCallRecordCmdBlitImage",
+    "PreCallValidateCmdCopyBufferToImage",
+    "PreCallRecordCmdCopyBufferToImage",
+    "PostCallRecordCmdCopyBufferToImage",
+    "PreCallValidateCmdCopyImageToBuffer",
+    "PreCallRecordCmdCopyImageToBuffer",
+    "PostCallRecordCmdCopyImageToBuffer",
+    "PreCallValidateCmdUpdateBuffer",
+    "PreCallRecordCmdUpdateBuffer",
+    "PostCallRecordCmdUpdateBuffer",
+    "PreCallValidateCmdFillBuffer",
+    "PreCallRecordCmdFillBuffer",
+    "PostCallRecordCmdFillBuffer",
+    "PreCallValidateCmdClearColorImage",
+    "PreCallRecordCmdClearColorImage",
+    "PostCallRecordCmdClearColorImage",
+    "PreCallValidateCmdClearDepthStencilImage",
+    "PreCallRecordCmdClearDepthStencilImage",
+    "PostCallRecordCmdClearDepthStencilImage",
+    "PreCallValidateCmdClearAttachments",
+    "PreCallRecordCmdClearAttachments",
+    "PostCallRecordCmdClearAttachments",
+    "PreCallValidateCmdResolveImage",
+    "PreCallRecordCmdResolveImage",
+    "PostCallRecordCmdResolveImage",
+    "PreCallValidateCmdSetEvent",
+    "PreCallRecordCmdSetEvent",
+    "PostCallRecordCmdSetEvent",
+    "PreCallValidateCmdResetEvent",
+    "PreCallRecordCmdResetEvent",
+    "PostCallRecordCmdResetEvent",
+    "PreCallValidateCmdWaitEvents",
+    "PreCallRecordCmdWaitEvents",
+    "PostCallRecordCmdWaitEvents",
+    "PreCallValidateCmdPipelineBarrier",
+    "PreCallRecordCmdPipelineBarrier",
+    "PostCallRecordCmdPipelineBarrier",
+    "PreCallValidateCmdBeginQuery",
+    "PreCallRecordCmdBeginQuery",
+    "PostCallRecordCmdBeginQuery",
+    "PreCallValidateCmdEndQuery",
+    "PreCallRecordCmdEndQuery",
+    "PostCallRecordCmdEndQuery",
+    "PreCallValidateCmdResetQueryPool",
+    "PreCallRecordCmdResetQueryPool",
+    "PostCallRecordCmdResetQueryPool",
+    "PreCallValidateCmdWriteTimestamp",
+    "PreCallRecordCmdWriteTimestamp",
+    "PostCallRecordCmdWriteTimestamp",
+    "PreCallValidateCmdCopyQueryPoolResults",
+    "PreCallRecordCmdCopyQueryPoolResults",
+    "PostCallRecordCmdCopyQueryPoolResults",
+    "PreCallValidateCmdPushConstants",
+    "PreCallRecordCmdPushConstants",
+    "PostCallRecordCmdPushConstants",
+    "PreCallValidateCmdBeginRenderPass",
+    "PreCallRecordCmdBeginRenderPass",
+    "PostCallRecordCmdBeginRenderPass",
+    "PreCallValidateCmdNextSubpass",
+    "PreCallRecordCmdNextSubpass",
+    "PostCallRecordCmdNextSubpass",
+    "PreCallValidateCmdEndRenderPass",
+    "PreCallRecordCmdEndRenderPass",
+    "PostCallRecordCmdEndRenderPass",
+    "PreCallValidateCmdExecuteCommands",
+    "PreCallRecordCmdExecuteCommands",
+    "PostCallRecordCmdExecuteCommands",
+    "PreCallValidateBindBufferMemory2",
+    "PreCallRecordBindBufferMemory2",
+    "PostCallRecordBindBufferMemory2",
+    "PreCallValidateBindImageMemory2",
+    "PreCallRecordBindImageMemory2",
+    "PostCallRecordBindImageMemory2",
+    "PreCallValidateGetDeviceGroupPeerMemoryFeatures",
+    "PreCallRecordGetDeviceGroupPeerMemoryFeatures",
+    "PostCallRecordGetDeviceGroupPeerMemoryFeatures",
+    "PreCallValidateCmdSetDeviceMask",
+    "PreCallRecordCmdSetDeviceMask",
+    "PostCallRecordCmdSetDeviceMask",
+    "PreCallValidateCmdDispatchBase",
+    "PreCallRecordCmdDispatchBase",
+    "PostCallRecordCmdDispatchBase",
+    "PreCallValidateGetImageMemoryRequirements2",
+    "PreCallRecordGetImageMemoryRequirements2",
+    "PostCallRecordGetImageMemoryRequirements2",
+    "PreCallValidateGetBufferMemoryRequirements2",
+    "PreCallRecordGetBufferMemoryRequirements2",
+    "PostCallRecordGetBufferMemoryRequirements2",
+    "PreCallValidateGetImageSparseMemoryRequirements2",
+    "PreCallRecordGetImageSparseMemoryRequirements2",
+    "PostCallRecordGetImageSparseMemoryRequirements2",
+    "PreCallValidateTrimCommandPool",
+    "PreCallRecordTrimCommandPool",
+    "PostCallRecordTrimCommandPool",
+    "PreCallValidateGetDeviceQueue2",
+    "PreCallRecordGetDeviceQueue2",
+    "PostCallRecordGetDeviceQueue2",
+    "PreCallValidateCreateSamplerYcbcrConversion",
+    "PreCallRecordCreateSamplerYcbcrConversion",
+    "PostCallRecordCreateSamplerYcbcrConversion",
+    "PreCallValidateDestroySamplerYcbcrConversion",
+    "PreCallRecordDestroySamplerYcbcrConversion",
+    "PostCallRecordDestroySamplerYcbcrConversion",
+    "PreCallValidateCreateDescriptorUpdateTemplate",
+    "PreCallRecordCreateDescriptorUpdateTemplate",
+    "PostCallRecordCreateDescriptorUpdateTemplate",
+    "PreCallValidateDestroyDescriptorUpdateTemplate",
+    "PreCallRecordDestroyDescriptorUpdateTemplate",
+    "PostCallRecordDestroyDescriptorUpdateTemplate",
+    "PreCallValidateUpdateDescriptorSetWithTemplate",
+    "PreCallRecordUpdateDescriptorSetWithTemplate",
+    "PostCallRecordUpdateDescriptorSetWithTemplate",
+    "PreCallValidateGetDescriptorSetLayoutSupport",
+    "PreCallRecordGetDescriptorSetLayoutSupport",
+    "PostCallRecordGetDescriptorSetLayoutSupport",
+    "PreCallValidateCmdDrawIndirectCount",
+    "PreCallRecordCmdDrawIndirectCount",
+    "PostCallRecordCmdDrawIndirectCount",
+    "PreCallValidateCmdDrawIndexedIndirectCount",
+    "PreCallRecordCmdDrawIndexedIndirectCount",
+    "PostCallRecordCmdDrawIndexedIndirectCount",
+    "PreCallValidateCreateRenderPass2",
+    "PreCallRecordCreateRenderPass2",
+    "PostCallRecordCreateRenderPass2",
+    "PreCallValidateCmdBeginRenderPass2",
+    "PreCallRecordCmdBeginRenderPass2",
+    "PostCallRecordCmdBeginRenderPass2",
+    "PreCallValidateCmdNextSubpass2",
+    "PreCallRecordCmdNextSubpass2",
+    "PostCallRecordCmdNextSubpass2",
+    "PreCallValidateCmdEndRenderPass2",
+    "PreCallRecordCmdEndRenderPass2",
+    "PostCallRecordCmdEndRenderPass2",
+    "PreCallValidateResetQueryPool",
+    "PreCallRecordResetQueryPool",
+    "PostCallRecordResetQueryPool",
+    "PreCallValidateGetSemaphoreCounterValue",
+    "PreCallRecordGetSemaphoreCounterValue",
+    "PostCallRecordGetSemaphoreCounterValue",
+    "PreCallValidateWaitSemaphores",
+    "PreCallRecordWaitSemaphores",
+    "PostCallRecordWaitSemaphores",
+    "PreCallValidateSignalSemaphore",
+    "PreCallRecordSignalSemaphore",
+    "PostCallRecordSignalSemaphore",
+    "PreCallValidateGetBufferDeviceAddress",
+    "PreCallRecordGetBufferDeviceAddress",
+    "PostCallRecordGetBufferDeviceAddress",
+    "PreCallValidateGetBufferOpaqueCaptureAddress",
+    "PreCallRecordGetBufferOpaqueCaptureAddress",
+    "PostCallRecordGetBufferOpaqueCaptureAddress",
+    "PreCallValidateGetDeviceMemoryOpaqueCaptureAddress",
+    "PreCallRecordGetDeviceMemoryOpaqueCaptureAddress",
+    "PostCallRecordGetDeviceMemoryOpaqueCaptureAddress",
+    "PreCallValidateCreatePrivateDataSlot",
+    "PreCallRecordCreatePrivateDataSlot",
+    "PostCallRecordCreatePrivateDataSlot",
+    "PreCallValidateDestroyPrivateDataSlot",
+    "PreCallRecordDestroyPrivateDataSlot",
+    "PostCallRecordDestroyPrivateDataSlot",
+    "PreCallValidateSetPrivateData",
+    "PreCallRecordSetPrivateData",
+    "PostCallRecordSetPrivateData",
+    "PreCallValidateGetPrivateData",
+    "PreCallRecordGetPrivateData",
+    "PostCallRecordGetPrivateData",
+    "PreCallValidateCmdSetEvent2",
+    "PreCallRecordCmdSetEvent2",
+    "PostCallRecordCmdSetEvent2",
+    "PreCallValidateCmdResetEvent2",
+    "PreCallRecordCmdResetEvent2",
+    "PostCallRecordCmdResetEvent2",
+    "PreCallValidateCmdWaitEvents2",
+    "PreCallRecordCmdWaitEvents2",
+    "PostCallRecordCmdWaitEvents2",
+    "PreCallValidateCmdPipelineBarrier2",
+    "PreCallRecordCmdPipelineBarrier2",
+    "PostCallRecordCmdPipelineBarrier2",
+    "PreCallValidateCmdWriteTimestamp2",
+    "PreCallRecordCmdWriteTimestamp2",
+    "PostCallRecordCmdWriteTimestamp2",
+    "PreCallValidateQueueSubmit2",
+    "PreCallRecordQueueSubmit2",
+    "PostCallRecordQueueSubmit2",
+    "PreCallValidateCmdCopyBuffer2",
+    "PreCallRecordCmdCopyBuffer2",
+    "PostCallRecordCmdCopyBuffer2",
+    "PreCallValidateCmdCopyImage2",
+    "PreCallRecordCmdCopyImage2",
+    "PostCallRecordCmdCopyImage2",
+    "PreCallValidateCmdCopyBufferToImage2",
+    "PreCallRecordCmdCopyBufferToImage2",
+    "PostCallRecordCmdCopyBufferToImage2",
+    "PreCallValidateCmdCopyImageToBuffer2",
+    "PreCallRecordCmdCopyImageToBuffer2",
+    "PostCallRecordCmdCopyImageToBuffer2",
+    "PreCallValidateCmdBlitImage2",
+    "PreCallRecordCmdBlitImage2",
+    "PostCallRecordCmdBlitImage2",
+    "PreCallValidateCmdResolveImage2",
+    "PreCallRecordCmdResolveImage2",
+    "PostCallRecordCmdResolveImage2",
+    "PreCallValidateCmdBeginRendering",
+    "PreCallRecordCmdBeginRendering",
+    "PostCallRecordCmdBeginRendering",
+    "PreCallValidateCmdEndRendering",
+    "PreCallRecordCmdEndRendering",
+    "PostCallRecordCmdEndRendering",
+    "PreCallValidateCmdSetCullMode",
+    "PreCallRecordCmdSetCullMode",
+    "PostCallRecordCmdSetCullMode",
+    "PreCallValidateCmdSetFrontFace",
+    "PreCallRecordCmdSetFrontFace",
+    "PostCallRecordCmdSetFrontFace",
+    "PreCallValidateCmdSetPrimitiveTopology",
+    "PreCallRecordCmdSetPrimitiveTopology",
+    "PostCallRecordCmdSetPrimitiveTopology",
+    "PreCallValidateCmdSetViewportWithCount",
+    "PreCallRecordCmdSetViewportWithCount",
+    "PostCallRecordCmdSetViewportWithCount",
+    "PreCallValidateCmdSetScissorWithCount",
+    "PreCallRecordCmdSetScissorWithCount",
+    "PostCallRecordCmdSetScissorWithCount",
+    "PreCallValidateCmdBindVertexBuffers2",
+    "PreCallRecordCmdBindVertexBuffers2",
+    "PostCallRecordCmdBindVertexBuffers2",
+    "PreCallValidateCmdSetDepthTestEnable",
+    "PreCallRecordCmdSetDepthTestEnable",
+    "PostCallRecordCmdSetDepthTestEnable",
+    "PreCallValidateCmdSetDepthWriteEnable",
+    "PreCallRecordCmdSetDepthWriteEnable",
+    "PostCallRecordCmdSetDepthWriteEnable",
+    "PreCallValidateCmdSetDepthCompareOp",
+    "PreCallRecordCmdSetDepthCompareOp",
+    "PostCallRecordCmdSetDepthCompareOp",
+    "PreCallValidateCmdSetDepthBoundsTestEnable",
+    "PreCallRecordCmdSetDepthBoundsTestEnable",
+    "PostCallRecordCmdSetDepthBoundsTestEnable",
+    "PreCallValidateCmdSetStencilTestEnable",
+    "PreCallRecordCmdSetStencilTestEnable",
+    "PostCallRecordCmdSetStencilTestEnable",
+    "PreCallValidateCmdSetStencilOp",
+    "PreCallRecordCmdSetStencilOp",
+    "PostCallRecordCmdSetStencilOp",
+    "PreCallValidateCmdSetRasterizerDiscardEnable",
+    "PreCallRecordCmdSetRasterizerDiscardEnable",
+    "PostCallRecordCmdSetRasterizerDiscardEnable",
+    "PreCallValidateCmdSetDepthBiasEnable",
+    "PreCallRecordCmdSetDepthBiasEnable",
+    "PostCallRecordCmdSetDepthBiasEnable",
+    "PreCallValidateCmdSetPrimitiveRestartEnable",
+    "PreCallRecordCmdSetPrimitiveRestartEnable",
+    "PostCallRecordCmdSetPrimitiveRestartEnable",
+    "PreCallValidateGetDeviceBufferMemoryRequirements",
+    "PreCallRecordGetDeviceBufferMemoryRequirements",
+    "PostCallRecordGetDeviceBufferMemoryRequirements",
+    "PreCallValidateGetDeviceImageMemoryRequirements",
+    "PreCallRecordGetDeviceImageMemoryRequirements",
+    "PostCallRecordGetDeviceImageMemoryRequirements",
+    "PreCallValidateGetDeviceImageSparseMemoryRequirements",
+    "PreCallRecordGetDeviceImageSparseMemoryRequirements",
+    "PostCallRecordGetDeviceImageSparseMemoryRequirements",
+    "PreCallValidateCreateSwapchainKHR",
+    "PreCallRecordCreateSwapchainKHR",
+    "PostCallRecordCreateSwapchainKHR",
+    "PreCallValidateDestroySwapchainKHR",
+    "PreCallRecordDestroySwapchainKHR",
+    "PostCallRecordDestroySwapchainKHR",
+    "PreCallValidateGetSwapchainImagesKHR",
+    "PreCallRecordGetSwapchainImagesKHR",
+    "PostCallRecordGetSwapchainImagesKHR",
+    "PreCallValidateAcquireNextImageKHR",
+    "PreCallRecordAcquireNextImageKHR",
+    "PostCallRecordAcquireNextImageKHR",
+    "PreCallValidateQueuePresentKHR",
+    "PreCallRecordQueuePresentKHR",
+    "PostCallRecordQueuePresentKHR",
+    "PreCallValidateGetDeviceGroupPresentCapabilitiesKHR",
+    "PreCallRecordGetDeviceGroupPresentCapabilitiesKHR",
+    "PostCallRecordGetDeviceGroupPresentCapabilitiesKHR",
+    "PreCallValidateGetDeviceGroupSurfacePresentModesKHR",
+    "PreCallRecordGetDeviceGroupSurfacePresentModesKHR",
+    "PostCallRecordGetDeviceGroupSurfacePresentModesKHR",
+    "PreCallValidateAcquireNextImage2KHR",
+    "PreCallRecordAcquireNextImage2KHR",
+    "PostCallRecordAcquireNextImage2KHR",
+    "PreCallValidateCreateSharedSwapchainsKHR",
+    "PreCallRecordCreateSharedSwapchainsKHR",
+    "PostCallRecordCreateSharedSwapchainsKHR",
+    "PreCallValidateCreateVideoSessionKHR",
+    "PreCallRecordCreateVideoSessionKHR",
+    "PostCallRecordCreateVideoSessionKHR",
+    "PreCallValidateDestroyVideoSessionKHR",
+    "PreCallRecordDestroyVideoSessionKHR",
+    "PostCallRecordDestroyVideoSessionKHR",
+    "PreCallValidateGetVideoSessionMemoryRequirementsKHR",
+    "PreCallRecordGetVideoSessionMemoryRequirementsKHR",
+    "PostCallRecordGetVideoSessionMemoryRequirementsKHR",
+    "PreCallValidateBindVideoSessionMemoryKHR",
+    "PreCallRecordBindVideoSessionMemoryKHR",
+    "PostCallRecordBindVideoSessionMemoryKHR",
+    "PreCallValidateCreateVideoSessionParametersKHR",
+    "PreCallRecordCreateVideoSessionParametersKHR",
+    "PostCallRecordCreateVideoSessionParametersKHR",
+    "PreCallValidateUpdateVideoSessionParametersKHR",
+    "PreCallRecordUpdateVideoSessionParametersKHR",
+    "PostCallRecordUpdateVideoSessionParametersKHR",
+    "PreCallValidateDestroyVideoSessionParametersKHR",
+    "PreCallRecordDestroyVideoSessionParametersKHR",
+    "PostCallRecordDestroyVideoSessionParametersKHR",
+    "PreCallValidateCmdBeginVideoCodingKHR",
+    "PreCallRecordCmdBeginVideoCodingKHR",
+    "PostCallRecordCmdBeginVideoCodingKHR",
+    "PreCallValidateCmdEndVideoCodingKHR",
+    "PreCallRecordCmdEndVideoCodingKHR",
+    "PostCallRecordCmdEndVideoCodingKHR",
+    "PreCallValidateCmdControlVideoCodingKHR",
+    "PreCallRecordCmdControlVideoCodingKHR",
+    "PostCallRecordCmdControlVideoCodingKHR",
+    "PreCallValidateCmdDecodeVideoKHR",
+    "PreCallRecordCmdDecodeVideoKHR",
+    "PostCallRecordCmdDecodeVideoKHR",
+    "PreCallValidateCmdBeginRenderingKHR",
+    "PreCallRecordCmdBeginRenderingKHR",
+    "PostCallRecordCmdBeginRenderingKHR",
+    "PreCallValidateCmdEndRenderingKHR",
+    "PreCallRecordCmdEndRenderingKHR",
+    "PostCallRecordCmdEndRenderingKHR",
+    "PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR",
+    "PreCallValidateCmdSetDeviceMaskKHR",
+    "PreCallRecordCmdSetDeviceMaskKHR",
+    "PostCallRecordCmdSetDeviceMaskKHR",
+    "PreCallValidateCmdDispatchBaseKHR",
+    "PreCallRecordCmdDispatchBaseKHR",
+    "PostCallRecordCmdDispatchBaseKHR",
+    "PreCallValidateTrimCommandPoolKHR",
+    "PreCallRecordTrimCommandPoolKHR",
+    "PostCallRecordTrimCommandPoolKHR",
+    "PreCallValidateGetMemoryWin32HandleKHR",
+    "PreCallRecordGetMemoryWin32HandleKHR",
+    "PostCallRecordGetMemoryWin32HandleKHR",
+    "PreCallValidateGetMemoryWin32HandlePropertiesKHR",
+    "PreCallRecordGetMemoryWin32HandlePropertiesKHR",
+    "PostCallRecordGetMemoryWin32HandlePropertiesKHR",
+    "PreCallValidateGetMemoryFdKHR",
+    "PreCallRecordGetMemoryFdKHR",
+    "PostCallRecordGetMemoryFdKHR",
+    "PreCallValidateGetMemoryFdPropertiesKHR",
+    "PreCallRecordGetMemoryFdPropertiesKHR",
+    "PostCallRecordGetMemoryFdPropertiesKHR",
+    "PreCallValidateImportSemaphoreWin32HandleKHR",
+    "PreCallRecordImportSemaphoreWin32HandleKHR",
+    "PostCallRecordImportSemaphoreWin32HandleKHR",
+    "PreCallValidateGetSemaphoreWin32HandleKHR",
+    "PreCallRecordGetSemaphoreWin32HandleKHR",
+    "PostCallRecordGetSemaphoreWin32HandleKHR",
+    "PreCallValidateImportSemaphoreFdKHR",
+    "PreCallRecordImportSemaphoreFdKHR",
+    "PostCallRecordImportSemaphoreFdKHR",
+    "PreCallValidateGetSemaphoreFdKHR",
+    "PreCallRecordGetSemaphoreFdKHR",
+    "PostCallRecordGetSemaphoreFdKHR",
+    "PreCallValidateCmdPushDescriptorSetKHR",
+    "PreCallRecordCmdPushDescriptorSetKHR",
+    "PostCallRecordCmdPushDescriptorSetKHR",
+    "PreCallValidateCmdPushDescriptorSetWithTemplateKHR",
+    "PreCallRecordCmdPushDescriptorSetWithTemplateKHR",
+    "PostCallRecordCmdPushDescriptorSetWithTemplateKHR",
+    "PreCallValidateCreateDescriptorUpdateTemplateKHR",
+    "PreCallRecordCreateDescriptorUpdateTemplateKHR",
+    "PostCallRecordCreateDescriptorUpdateTemplateKHR",
+    "PreCallValidateDestroyDescriptorUpdateTemplateKHR",
+    "PreCallRecordDestroyDescriptorUpdateTemplateKHR",
+    "PostCallRecordDestroyDescriptorUpdateTemplateKHR",
+    "PreCallValidateUpdateDescriptorSetWithTemplateKHR",
+    "PreCallRecordUpdateDescriptorSetWithTemplateKHR",
+    "PostCallRecordUpdateDescriptorSetWithTemplateKHR",
+    "PreCallValidateCreateRenderPass2KHR",
+    "PreCallRecordCreateRenderPass2KHR",
+    "PostCallRecordCreateRenderPass2KHR",
+    "PreCallValidateCmdBeginRenderPass2KHR",
+    "PreCallRecordCmdBeginRenderPass2KHR",
+    "PostCallRecordCmdBeginRenderPass2KHR",
+    "PreCallValidateCmdNextSubpass2KHR",
+    "PreCallRecordCmdNextSubpass2KHR",
+    "PostCallRecordCmdNextSubpass2KHR",
+    "PreCallValidateCmdEndRenderPass2KHR",
+    "PreCallRecordCmdEndRenderPass2KHR",
+    "PostCallRecordCmdEndRenderPass2KHR",
+    "PreCallValidateGetSwapchainStatusKHR",
+    "PreCallRecordGetSwapchainStatusKHR",
+    "PostCallRecordGetSwapchainStatusKHR",
+    "PreCallValidateImportFenceWin32HandleKHR",
+    "PreCallRecordImportFenceWin32HandleKHR",
+    "PostCallRecordImportFenceWin32HandleKHR",
+    "PreCallValidateGetFenceWin32HandleKHR",
+    "PreCallRecordGetFenceWin32HandleKHR",
+    "PostCallRecordGetFenceWin32HandleKHR",
+    "PreCallValidateImportFenceFdKHR",
+    "PreCallRecordImportFenceFdKHR",
+    "PostCallRecordImportFenceFdKHR",
+    "PreCallValidateGetFenceFdKHR",
+    "PreCallRecordGetFenceFdKHR",
+    "PostCallRecordGetFenceFdKHR",
+    "PreCallValidateAcquireProfilingLockKHR",
+    "PreCallRecordAcquireProfilingLockKHR",
+    "PostCallRecordAcquireProfilingLockKHR",
+    "PreCallValidateReleaseProfilingLockKHR",
+    "PreCallRecordReleaseProfilingLockKHR",
+    "PostCallRecordReleaseProfilingLockKHR",
+    "PreCallValidateGetImageMemoryRequirements2KHR",
+    "PreCallRecordGetImageMemoryRequirements2KHR",
+    "PostCallRecordGetImageMemoryRequirements2KHR",
+    "PreCallValidateGetBufferMemoryRequirements2KHR",
+    "PreCallRecordGetBufferMemoryRequirements2KHR",
+    "PostCallRecordGetBufferMemoryRequirements2KHR",
+    "PreCallValidateGetImageSparseMemoryRequirements2KHR",
+    "PreCallRecordGetImageSparseMemoryRequirements2KHR",
+    "PostCallRecordGetImageSparseMemoryRequirements2KHR",
+    "PreCallValidateCreateSamplerYcbcrConversionKHR",
+    "PreCallRecordCreateSamplerYcbcrConversionKHR",
+    "PostCallRecordCreateSamplerYcbcrConversionKHR",
+    "PreCallValidateDestroySamplerYcbcrConversionKHR",
+    "PreCallRecordDestroySamplerYcbcrConversionKHR",
+    "PostCallRecordDestroySamplerYcbcrConversionKHR",
+    "PreCallValidateBindBufferMemory2KHR",
+    "PreCallRecordBindBufferMemory2KHR",
+    "PostCallRecordBindBufferMemory2KHR",
+    "PreCallValidateBindImageMemory2KHR",
+    "PreCallRecordBindImageMemory2KHR",
+    "PostCallRecordBindImageMemory2KHR",
+    "PreCallValidateGetDescriptorSetLayoutSupportKHR",
+    "PreCallRecordGetDescriptorSetLayoutSupportKHR",
+    "PostCallRecordGetDescriptorSetLayoutSupportKHR",
+    "PreCallValidateCmdDrawIndirectCountKHR",
+    "PreCallRecordCmdDrawIndirectCountKHR",
+    "PostCallRecordCmdDrawIndirectCountKHR",
+    "PreCallValidateCmdDrawIndexedIndirectCountKHR",
+    "PreCallRecordCmdDrawIndexedIndirectCountKHR",
+    "PostCallRecordCmdDrawIndexedIndirectCountKHR",
+    "PreCallValidateGetSemaphoreCounterValueKHR",
+    "PreCallRecordGetSemaphoreCounterValueKHR",
+    "PostCallRecordGetSemaphoreCounterValueKHR",
+    "PreCallValidateWaitSemaphoresKHR",
+    "PreCallRecordWaitSemaphoresKHR",
+    "PostCallRecordWaitSemaphoresKHR",
+    "PreCallValidateSignalSemaphoreKHR",
+    "PreCallRecordSignalSemaphoreKHR",
+    "PostCallRecordSignalSemaphoreKHR",
+    "PreCallValidateCmdSetFragmentShadingRateKHR",
+    "PreCallRecordCmdSetFragmentShadingRateKHR",
+    "PostCallRecordCmdSetFragmentShadingRateKHR",
+    "PreCallValidateWaitForPresentKHR",
+    "PreCallRecordWaitForPresentKHR",
+    "PostCallRecordWaitForPresentKHR",
+    "PreCallValidateGetBufferDeviceAddressKHR",
+    "PreCallRecordGetBufferDeviceAddressKHR",
+    "PostCallRecordGetBufferDeviceAddressKHR",
+    "PreCallValidateGetBufferOpaqueCaptureAddressKHR",
+    "PreCallRecordGetBufferOpaqueCaptureAddressKHR",
+    "PostCallRecordGetBufferOpaqueCaptureAddressKHR",
+    "PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "PreCallValidateCreateDeferredOperationKHR",
+    "PreCallRecordCreateDeferredOperationKHR",
+    "PostCallRecordCreateDeferredOperationKHR",
+    "PreCallValidateDestroyDeferredOperationKHR",
+    "PreCallRecordDestroyDeferredOperationKHR",
+    "PostCallRecordDestroyDeferredOperationKHR",
+    "PreCallValidateGetDeferredOperationMaxConcurrencyKHR",
+    "PreCallRecordGetDeferredOperationMaxConcurrencyKHR",
+    "PostCallRecordGetDeferredOperationMaxConcurrencyKHR",
+    "PreCallValidateGetDeferredOperationResultKHR",
+    "PreCallRecordGetDeferredOperationResultKHR",
+    "PostCallRecordGetDeferredOperationResultKHR",
+    "PreCallValidateDeferredOperationJoinKHR",
+    "PreCallRecordDeferredOperationJoinKHR",
+    "PostCallRecordDeferredOperationJoinKHR",
+    "PreCallValidateGetPipelineExecutablePropertiesKHR",
+    "PreCallRecordGetPipelineExecutablePropertiesKHR",
+    "PostCallRecordGetPipelineExecutablePropertiesKHR",
+    "PreCallValidateGetPipelineExecutableStatisticsKHR",
+    "PreCallRecordGetPipelineExecutableStatisticsKHR",
+    "PostCallRecordGetPipelineExecutableStatisticsKHR",
+    "PreCallValidateGetPipelineExecutableInternalRepresentationsKHR",
+    "PreCallRecordGetPipelineExecutableInternalRepresentationsKHR",
+    "PostCallRecordGetPipelineExecutableInternalRepresentationsKHR",
+    "PreCallValidateCmdEncodeVideoKHR",
+    "PreCallRecordCmdEncodeVideoKHR",
+    "PostCallRecordCmdEncodeVideoKHR",
+    "PreCallValidateCmdSetEvent2KHR",
+    "PreCallRecordCmdSetEvent2KHR",
+    "PostCallRecordCmdSetEvent2KHR",
+    "PreCallValidateCmdResetEvent2KHR",
+    "PreCallRecordCmdResetEvent2KHR",
+    "PostCallRecordCmdResetEvent2KHR",
+    "PreCallValidateCmdWaitEvents2KHR",
+    "PreCallRecordCmdWaitEvents2KHR",
+    "PostCallRecordCmdWaitEvents2KHR",
+    "PreCallValidateCmdPipelineBarrier2KHR",
+    "PreCallRecordCmdPipelineBarrier2KHR",
+    "PostCallRecordCmdPipelineBarrier2KHR",
+    "PreCallValidateCmdWriteTimestamp2KHR",
+    "PreCallRecordCmdWriteTimestamp2KHR",
+    "PostCallRecordCmdWriteTimestamp2KHR",
+    "PreCallValidateQueueSubmit2KHR",
+    "PreCallRecordQueueSubmit2KHR",
+    "PostCallRecordQueueSubmit2KHR",
+    "PreCallValidateCmdWriteBufferMarker2AMD",
+    "PreCallRecordCmdWriteBufferMarker2AMD",
+    "PostCallRecordCmdWriteBufferMarker2AMD",
+    "PreCallValidateGetQueueCheckpointData2NV",
+    "PreCallRecordGetQueueCheckpointData2NV",
+    "PostCallRecordGetQueueCheckpointData2NV",
+    "PreCallValidateCmdCopyBuffer2KHR",
+    "PreCallRecordCmdCopyBuffer2KHR",
+    "PostCallRecordCmdCopyBuffer2KHR",
+    "PreCallValidateCmdCopyImage2KHR",
+    "PreCallRecordCmdCopyImage2KHR",
+    "PostCallRecordCmdCopyImage2KHR",
+    "PreCallValidateCmdCopyBufferToImage2KHR",
+    "PreCallRecordCmdCopyBufferToImage2KHR",
+    "PostCallRecordCmdCopyBufferToImage2KHR",
+    "PreCallValidateCmdCopyImageToBuffer2KHR",
+    "PreCallRecordCmdCopyImageToBuffer2KHR",
+    "PostCallRecordCmdCopyImageToBuffer2KHR",
+    "PreCallValidateCmdBlitImage2KHR",
+    "PreCallRecordCmdBlitImage2KHR",
+    "PostCallRecordCmdBlitImage2KHR",
+    "PreCallValidateCmdResolveImage2KHR",
+    "PreCallRecordCmdResolveImage2KHR",
+    "PostCallRecordCmdResolveImage2KHR",
+    "PreCallValidateGetDeviceBufferMemoryRequirementsKHR",
+    "PreCallRecordGetDeviceBufferMemoryRequirementsKHR",
+    "PostCallRecordGetDeviceBufferMemoryRequirementsKHR",
+    "PreCallValidateGetDeviceImageMemoryRequirementsKHR",
+    "PreCallRecordGetDeviceImageMemoryRequirementsKHR",
+    "PostCallRecordGetDeviceImageMemoryRequirementsKHR",
+    "PreCallValidateGetDeviceImageSparseMemoryRequirementsKHR",
+    "PreCallRecordGetDeviceImageSparseMemoryRequirementsKHR",
+    "PostCallRecordGetDeviceImageSparseMemoryRequirementsKHR",
+    "PreCallValidateDebugMarkerSetObjectTagEXT",
+    "PreCallRecordDebugMarkerSetObjectTagEXT",
+    "PostCallRecordDebugMarkerSetObjectTagEXT",
+    "PreCallValidateDebugMarkerSetObjectNameEXT",
+    "PreCallRecordDebugMarkerSetObjectNameEXT",
+    "PostCallRecordDebugMarkerSetObjectNameEXT",
+    "PreCallValidateCmdDebugMarkerBeginEXT",
+    "PreCallRecordCmdDebugMarkerBeginEXT",
+    "PostCallRecordCmdDebugMarkerBeginEXT",
+    "PreCallValidateCmdDebugMarkerEndEXT",
+    "PreCallRecordCmdDebugMarkerEndEXT",
+    "PostCallRecordCmdDebugMarkerEndEXT",
+    "PreCallValidateCmdDebugMarkerInsertEXT",
+    "PreCallRecordCmdDebugMarkerInsertEXT",
+    "PostCallRecordCmdDebugMarkerInsertEXT",
+    "PreCallValidateCmdBindTransformFeedbackBuffersEXT",
+    "PreCallRecordCmdBindTransformFeedbackBuffersEXT",
+    "PostCallRecordCmdBindTransformFeedbackBuffersEXT",
+    "PreCallValidateCmdBeginTransformFeedbackEXT",
+    "PreCallRecordCmdBeginTransformFeedbackEXT",
+    "PostCallRecordCmdBeginTransformFeedbackEXT",
+    "PreCallValidateCmdEndTransformFeedbackEXT",
+    "PreCallRecordCmdEndTransformFeedbackEXT",
+    "PostCallRecordCmdEndTransformFeedbackEXT",
+    "PreCallValidateCmdBeginQueryIndexedEXT",
+    "PreCallRecordCmdBeginQueryIndexedEXT",
+    "PostCallRecordCmdBeginQueryIndexedEXT",
+    "PreCallValidateCmdEndQueryIndexedEXT",
+    "PreCallRecordCmdEndQueryIndexedEXT",
+    "PostCallRecordCmdEndQueryIndexedEXT",
+    "PreCallValidateCmdDrawIndirectByteCountEXT",
+    "PreCallRecordCmdDrawIndirectByteCountEXT",
+    "PostCallRecordCmdDrawIndirectByteCountEXT",
+    "PreCallValidateCreateCuModuleNVX",
+    "PreCallRecordCreateCuModuleNVX",
+    "PostCallRecordCreateCuModuleNVX",
+    "PreCallValidateCreateCuFunctionNVX",
+    "PreCallRecordCreateCuFunctionNVX",
+    "PostCallRecordCreateCuFunctionNVX",
+    "PreCallValidateDestroyCuModuleNVX",
+    "PreCallRecordDestroyCuModuleNVX",
+    "PostCallRecordDestroyCuModuleNVX",
+    "PreCallValidateDestroyCuFunctionNVX",
+    "PreCallRecordDestroyCuFunctionNVX",
+    "PostCallRecordDestroyCuFunctionNVX",
+    "PreCallValidateCmdCuLaunchKernelNVX",
+    "PreCallRecordCmdCuLaunchKernelNVX",
+    "PostCallRecordCmdCuLaunchKernelNVX",
+    "PreCallValidateGetImageViewHandleNVX",
+    "PreCallRecordGetImageViewHandleNVX",
+    "PostCallRecordGetImageViewHandleNVX",
+    "PreCallValidateGetImageViewAddressNVX",
+    "PreCallRecordGetImageViewAddressNVX",
+    "PostCallRecordGetImageViewAddressNVX",
+    "PreCallValidateCmdDrawIndirectCountAMD",
+    "PreCallRecordCmdDrawIndirectCountAMD",
+    "PostCallRecordCmdDrawIndirectCountAMD",
+    "PreCallValidateCmdDrawIndexedIndirectCountAMD",
+    "PreCallRecordCmdDrawIndexedIndirectCountAMD",
+    "PostCallRecordCmdDrawIndexedIndirectCountAMD",
+    "PreCallValidateGetShaderInfoAMD",
+    "PreCallRecordGetShaderInfoAMD",
+    "PostCallRecordGetShaderInfoAMD",
+    "PreCallValidateGetMemoryWin32HandleNV",
+    "PreCallRecordGetMemoryWin32HandleNV",
+    "PostCallRecordGetMemoryWin32HandleNV",
+    "PreCallValidateCmdBeginConditionalRenderingEXT",
+    "PreCallRecordCmdBeginConditionalRenderingEXT",
+    "PostCallRecordCmdBeginConditionalRenderingEXT",
+    "PreCallValidateCmdEndConditionalRenderingEXT",
+    "PreCallRecordCmdEndConditionalRenderingEXT",
+    "PostCallRecordCmdEndConditionalRenderingEXT",
+    "PreCallValidateCmdSetViewportWScalingNV",
+    "PreCallRecordCmdSetViewportWScalingNV",
+    "PostCallRecordCmdSetViewportWScalingNV",
+    "PreCallValidateDisplayPowerControlEXT",
+    "PreCallRecordDisplayPowerControlEXT",
+    "PostCallRecordDisplayPowerControlEXT",
+    "PreCallValidateRegisterDeviceEventEXT",
+    "PreCallRecordRegisterDeviceEventEXT",
+    "PostCallRecordRegisterDeviceEventEXT",
+    "PreCallValidateRegisterDisplayEventEXT",
+    "PreCallRecordRegisterDisplayEventEXT",
+    "PostCallRecordRegisterDisplayEventEXT",
+    "PreCallValidateGetSwapchainCounterEXT",
+    "PreCallRecordGetSwapchainCounterEXT",
+    "PostCallRecordGetSwapchainCounterEXT",
+    "PreCallValidateGetRefreshCycleDurationGOOGLE",
+    "PreCallRecordGetRefreshCycleDurationGOOGLE",
+    "PostCallRecordGetRefreshCycleDurationGOOGLE",
+    "PreCallValidateGetPastPresentationTimingGOOGLE",
+    "PreCallRecordGetPastPresentationTimingGOOGLE",
+    "PostCallRecordGetPastPresentationTimingGOOGLE",
+    "PreCallValidateCmdSetDiscardRectangleEXT",
+    "PreCallRecordCmdSetDiscardRectangleEXT",
+    "PostCallRecordCmdSetDiscardRectangleEXT",
+    "PreCallValidateSetHdrMetadataEXT",
+    "PreCallRecordSetHdrMetadataEXT",
+    "PostCallRecordSetHdrMetadataEXT",
+    "PreCallValidateSetDebugUtilsObjectNameEXT",
+    "PreCallRecordSetDebugUtilsObjectNameEXT",
+    "PostCallRecordSetDebugUtilsObjectNameEXT",
+    "PreCallValidateSetDebugUtilsObjectTagEXT",
+    "PreCallRecordSetDebugUtilsObjectTagEXT",
+    "PostCallRecordSetDebugUtilsObjectTagEXT",
+    "PreCallValidateQueueBeginDebugUtilsLabelEXT",
+    "PreCallRecordQueueBeginDebugUtilsLabelEXT",
+    "PostCallRecordQueueBeginDebugUtilsLabelEXT",
+    "PreCallValidateQueueEndDebugUtilsLabelEXT",
+    "PreCallRecordQueueEndDebugUtilsLabelEXT",
+    "PostCallRecordQueueEndDebugUtilsLabelEXT",
+    "PreCallValidateQueueInsertDebugUtilsLabelEXT",
+    "PreCallRecordQueueInsertDebugUtilsLabelEXT",
+    "PostCallRecordQueueInsertDebugUtilsLabelEXT",
+    "PreCallValidateCmdBeginDebugUtilsLabelEXT",
+    "PreCallRecordCmdBeginDebugUtilsLabelEXT",
+    "PostCallRecordCmdBeginDebugUtilsLabelEXT",
+    "PreCallValidateCmdEndDebugUtilsLabelEXT",
+    "PreCallRecordCmdEndDebugUtilsLabelEXT",
+    "PostCallRecordCmdEndDebugUtilsLabelEXT",
+    "PreCallValidateCmdInsertDebugUtilsLabelEXT",
+    "PreCallRecordCmdInsertDebugUtilsLabelEXT",
+    "PostCallRecordCmdInsertDebugUtilsLabelEXT",
+    "PreCallValidateGetAndroidHardwareBufferPropertiesANDROID",
+    "PreCallRecordGetAndroidHardwareBufferPropertiesANDROID",
+    "PostCallRecordGetAndroidHardwareBufferPropertiesANDROID",
+    "PreCallValidateGetMemoryAndroidHardwareBufferANDROID",
+    "PreCallRecordGetMemoryAndroidHardwareBufferANDROID",
+    "PostCallRecordGetMemoryAndroidHardwareBufferANDROID",
+    "PreCallValidateCmdSetSampleLocationsEXT",
+    "PreCallRecordCmdSetSampleLocationsEXT",
+    "PostCallRecordCmdSetSampleLocationsEXT",
+    "PreCallValidateGetImageDrmFormatModifierPropertiesEXT",
+    "PreCallRecordGetImageDrmFormatModifierPropertiesEXT",
+    "PostCallRecordGetImageDrmFormatModifierPropertiesEXT",
+    "PreCallValidateCmdBindShadingRateImageNV",
+    "PreCallRecordCmdBindShadingRateImageNV",
+    "PostCallRecordCmdBindShadingRateImageNV",
+    "PreCallValidateCmdSetViewportShadingRatePaletteNV",
+    "PreCallRecordCmdSetViewportShadingRatePaletteNV",
+    "PostCallRecordCmdSetViewportShadingRatePaletteNV",
+    "PreCallValidateCmdSetCoarseSampleOrderNV",
+    "PreCallRecordCmdSetCoarseSampleOrderNV",
+    "PostCallRecordCmdSetCoarseSampleOrderNV",
+    "PreCallValidateCreateAccelerationStructureNV",
+    "PreCallRecordCreateAccelerationStructureNV",
+    "PostCallRecordCreateAccelerationStructureNV",
+    "PreCallValidateDestroyAccelerationStructureNV",
+    "PreCallRecordDestroyAccelerationStructureNV",
+    "PostCallRecordDestroyAccelerationStructureNV",
+    "PreCallValidateGetAccelerationStructureMemoryRequirementsNV",
+    "PreCallRecordGetAccelerationStructureMemoryRequirementsNV",
+    "PostCallRecordGetAccelerationStructureMemoryRequirementsNV",
+    "PreCallValidateBindAccelerationStructureMemoryNV",
+    "PreCallRecordBindAccelerationStructureMemoryNV",
+    "PostCallRecordBindAccelerationStructureMemoryNV",
+    "PreCallValidateCmdBuildAccelerationStructureNV",
+    "PreCallRecordCmdBuildAccelerationStructureNV",
+    "PostCallRecordCmdBuildAccelerationStructureNV",
+    "PreCallValidateCmdCopyAccelerationStructureNV",
+    "PreCallRecordCmdCopyAccelerationStructureNV",
+    "PostCallRecordCmdCopyAccelerationStructureNV",
+    "PreCallValidateCmdTraceRaysNV",
+    "PreCallRecordCmdTraceRaysNV",
+    "PostCallRecordCmdTraceRaysNV",
+    "PreCallValidateGetRayTracingShaderGroupHandlesKHR",
+    "PreCallRecordGetRayTracingShaderGroupHandlesKHR",
+    "PostCallRecordGetRayTracingShaderGroupHandlesKHR",
+    "PreCallValidateGetRayTracingShaderGroupHandlesNV",
+    "PreCallRecordGetRayTracingShaderGroupHandlesNV",
+    "PostCallRecordGetRayTracingShaderGroupHandlesNV",
+    "PreCallValidateGetAccelerationStructureHandleNV",
+    "PreCallRecordGetAccelerationStructureHandleNV",
+    "PostCallRecordGetAccelerationStructureHandleNV",
+    "PreCallValidateCmdWriteAccelerationStructuresPropertiesNV",
+    "PreCallRecordCmdWriteAccelerationStructuresPropertiesNV",
+    "PostCallRecordCmdWriteAccelerationStructuresPropertiesNV",
+    "PreCallValidateCompileDeferredNV",
+    "PreCallRecordCompileDeferredNV",
+    "PostCallRecordCompileDeferredNV",
+    "PreCallValidateGetMemoryHostPointerPropertiesEXT",
+    "PreCallRecordGetMemoryHostPointerPropertiesEXT",
+    "PostCallRecordGetMemoryHostPointerPropertiesEXT",
+    "PreCallValidateCmdWriteBufferMarkerAMD",
+    "PreCallRecordCmdWriteBufferMarkerAMD",
+    "PostCallRecordCmdWriteBufferMarkerAMD",
+    "PreCallValidateGetCalibratedTimestampsEXT",
+    "PreCallRecordGetCalibratedTimestampsEXT",
+    "PostCallRecordGetCalibratedTimestampsEXT",
+    "PreCallValidateCmdDrawMeshTasksNV",
+    "PreCallRecordCmdDrawMeshTasksNV",
+    "PostCallRecordCmdDrawMeshTasksNV",
+    "PreCallValidateCmdDrawMeshTasksIndirectNV",
+    "PreCallRecordCmdDrawMeshTasksIndirectNV",
+    "PostCallRecordCmdDrawMeshTasksIndirectNV",
+    "PreCallValidateCmdDrawMeshTasksIndirectCountNV",
+    "PreCallRecordCmdDrawMeshTasksIndirectCountNV",
+    "PostCallRecordCmdDrawMeshTasksIndirectCountNV",
+    "PreCallValidateCmdSetExclusiveScissorNV",
+    "PreCallRecordCmdSetExclusiveScissorNV",
+    "PostCallRecordCmdSetExclusiveScissorNV",
+    "PreCallValidateCmdSetCheckpointNV",
+    "PreCallRecordCmdSetCheckpointNV",
+    "PostCallRecordCmdSetCheckpointNV",
+    "PreCallValidateGetQueueCheckpointDataNV",
+    "PreCallRecordGetQueueCheckpointDataNV",
+    "PostCallRecordGetQueueCheckpointDataNV",
+    "PreCallValidateInitializePerformanceApiINTEL",
+    "PreCallRecordInitializePerformanceApiINTEL",
+    "PostCallRecordInitializePerformanceApiINTEL",
+    "PreCallValidateUninitializePerformanceApiINTEL",
+    "PreCallRecordUninitializePerformanceApiINTEL",
+    "PostCallRecordUninitializePerformanceApiINTEL",
+    "PreCallValidateCmdSetPerformanceMarkerINTEL",
+    "PreCallRecordCmdSetPerformanceMarkerINTEL",
+    "PostCallRecordCmdSetPerformanceMarkerINTEL",
+    "PreCallValidateCmdSetPerformanceStreamMarkerINTEL",
+    "PreCallRecordCmdSetPerformanceStreamMarkerINTEL",
+    "PostCallRecordCmdSetPerformanceStreamMarkerINTEL",
+    "PreCallValidateCmdSetPerformanceOverrideINTEL",
+    "PreCallRecordCmdSetPerformanceOverrideINTEL",
+    "PostCallRecordCmdSetPerformanceOverrideINTEL",
+    "PreCallValidateAcquirePerformanceConfigurationINTEL",
+    "PreCallRecordAcquirePerformanceConfigurationINTEL",
+    "PostCallRecordAcquirePerformanceConfigurationINTEL",
+    "PreCallValidateReleasePerformanceConfigurationINTEL",
+    "PreCallRecordReleasePerformanceConfigurationINTEL",
+    "PostCallRecordReleasePerformanceConfigurationINTEL",
+    "PreCallValidateQueueSetPerformanceConfigurationINTEL",
+    "PreCallRecordQueueSetPerformanceConfigurationINTEL",
+    "PostCallRecordQueueSetPerformanceConfigurationINTEL",
+    "PreCallValidateGetPerformanceParameterINTEL",
+    "PreCallRecordGetPerformanceParameterINTEL",
+    "PostCallRecordGetPerformanceParameterINTEL",
+    "PreCallValidateSetLocalDimmingAMD",
+    "PreCallRecordSetLocalDimmingAMD",
+    "PostCallRecordSetLocalDimmingAMD",
+    "PreCallValidateGetBufferDeviceAddressEXT",
+    "PreCallRecordGetBufferDeviceAddressEXT",
+    "PostCallRecordGetBufferDeviceAddressEXT",
+    "PreCallValidateAcquireFullScreenExclusiveModeEXT",
+    "PreCallRecordAcquireFullScreenExclusiveModeEXT",
+    "PostCallRecordAcquireFullScreenExclusiveModeEXT",
+    "PreCallValidateReleaseFullScreenExclusiveModeEXT",
+    "PreCallRecordReleaseFullScreenExclusiveModeEXT",
+    "PostCallRecordReleaseFullScreenExclusiveModeEXT",
+    "PreCallValidateGetDeviceGroupSurfacePresentModes2EXT",
+    "PreCallRecordGetDeviceGroupSurfacePresentModes2EXT",
+    "PostCallRecordGetDeviceGroupSurfacePresentModes2EXT",
+    "PreCallValidateCmdSetLineStippleEXT",
+    "PreCallRecordCmdSetLineStippleEXT",
+    "PostCallRecordCmdSetLineStippleEXT",
+    "PreCallValidateResetQueryPoolEXT",
+    "PreCallRecordResetQueryPoolEXT",
+    "PostCallRecordResetQueryPoolEXT",
+    "PreCallValidateCmdSetCullModeEXT",
+    "PreCallRecordCmdSetCullModeEXT",
+    "PostCallRecordCmdSetCullModeEXT",
+    "PreCallValidateCmdSetFrontFaceEXT",
+    "PreCallRecordCmdSetFrontFaceEXT",
+    "PostCallRecordCmdSetFrontFaceEXT",
+    "PreCallValidateCmdSetPrimitiveTopologyEXT",
+    "PreCallRecordCmdSetPrimitiveTopologyEXT",
+    "PostCallRecordCmdSetPrimitiveTopologyEXT",
+    "PreCallValidateCmdSetViewportWithCountEXT",
+    "PreCallRecordCmdSetViewportWithCountEXT",
+    "PostCallRecordCmdSetViewportWithCountEXT",
+    "PreCallValidateCmdSetScissorWithCountEXT",
+    "PreCallRecordCmdSetScissorWithCountEXT",
+    "PostCallRecordCmdSetScissorWithCountEXT",
+    "PreCallValidateCmdBindVertexBuffers2EXT",
+    "PreCallRecordCmdBindVertexBuffers2EXT",
+    "PostCallRecordCmdBindVertexBuffers2EXT",
+    "PreCallValidateCmdSetDepthTestEnableEXT",
+    "PreCallRecordCmdSetDepthTestEnableEXT",
+    "PostCallRecordCmdSetDepthTestEnableEXT",
+    "PreCallValidateCmdSetDepthWriteEnableEXT",
+    "PreCallRecordCmdSetDepthWriteEnableEXT",
+    "PostCallRecordCmdSetDepthWriteEnableEXT",
+    "PreCallValidateCmdSetDepthCompareOpEXT",
+    "PreCallRecordCmdSetDepthCompareOpEXT",
+    "PostCallRecordCmdSetDepthCompareOpEXT",
+    "PreCallValidateCmdSetDepthBoundsTestEnableEXT",
+    "PreCallRecordCmdSetDepthBoundsTestEnableEXT",
+    "PostCallRecordCmdSetDepthBoundsTestEnableEXT",
+    "PreCallValidateCmdSetStencilTestEnableEXT",
+    "PreCallRecordCmdSetStencilTestEnableEXT",
+    "PostCallRecordCmdSetStencilTestEnableEXT",
+    "PreCallValidateCmdSetStencilOpEXT",
+    "PreCallRecordCmdSetStencilOpEXT",
+    "PostCallRecordCmdSetStencilOpEXT",
+    "PreCallValidateGetGeneratedCommandsMemoryRequirementsNV",
+    "PreCallRecordGetGeneratedCommandsMemoryRequirementsNV",
+    "PostCallRecordGetGeneratedCommandsMemoryRequirementsNV",
+    "PreCallValidateCmdPreprocessGeneratedCommandsNV",
+    "PreCallRecordCmdPreprocessGeneratedCommandsNV",
+    "PostCallRecordCmdPreprocessGeneratedCommandsNV",
+    "PreCallValidateCmdExecuteGeneratedCommandsNV",
+    "PreCallRecordCmdExecuteGeneratedCommandsNV",
+    "PostCallRecordCmdExecuteGeneratedCommandsNV",
+    "PreCallValidateCmdBindPipelineShaderGroupNV",
+    "PreCallRecordCmdBindPipelineShaderGroupNV",
+    "PostCallRecordCmdBindPipelineShaderGroupNV",
+    "PreCallValidateCreateIndirectCommandsLayoutNV",
+    "PreCallRecordCreateIndirectCommandsLayoutNV",
+    "PostCallRecordCreateIndirectCommandsLayoutNV",
+    "PreCallValidateDestroyIndirectCommandsLayoutNV",
+    "PreCallRecordDestroyIndirectCommandsLayoutNV",
+    "PostCallRecordDestroyIndirectCommandsLayoutNV",
+    "PreCallValidateCreatePrivateDataSlotEXT",
+    "PreCallRecordCreatePrivateDataSlotEXT",
+    "PostCallRecordCreatePrivateDataSlotEXT",
+    "PreCallValidateDestroyPrivateDataSlotEXT",
+    "PreCallRecordDestroyPrivateDataSlotEXT",
+    "PostCallRecordDestroyPrivateDataSlotEXT",
+    "PreCallValidateSetPrivateDataEXT",
+    "PreCallRecordSetPrivateDataEXT",
+    "PostCallRecordSetPrivateDataEXT",
+    "PreCallValidateGetPrivateDataEXT",
+    "PreCallRecordGetPrivateDataEXT",
+    "PostCallRecordGetPrivateDataEXT",
+    "PreCallValidateCmdSetFragmentShadingRateEnumNV",
+    "PreCallRecordCmdSetFragmentShadingRateEnumNV",
+    "PostCallRecordCmdSetFragmentShadingRateEnumNV",
+    "PreCallValidateCmdSetVertexInputEXT",
+    "PreCallRecordCmdSetVertexInputEXT",
+    "PostCallRecordCmdSetVertexInputEXT",
+    "PreCallValidateGetMemoryZirconHandleFUCHSIA",
+    "PreCallRecordGetMemoryZirconHandleFUCHSIA",
+    "PostCallRecordGetMemoryZirconHandleFUCHSIA",
+    "PreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA",
+    "PreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA",
+    "PostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA",
+    "PreCallValidateImportSemaphoreZirconHandleFUCHSIA",
+    "PreCallRecordImportSemaphoreZirconHandleFUCHSIA",
+    "PostCallRecordImportSemaphoreZirconHandleFUCHSIA",
+    "PreCallValidateGetSemaphoreZirconHandleFUCHSIA",
+    "PreCallRecordGetSemaphoreZirconHandleFUCHSIA",
+    "PostCallRecordGetSemaphoreZirconHandleFUCHSIA",
+    "PreCallValidateCreateBufferCollectionFUCHSIA",
+    "PreCallRecordCreateBufferCollectionFUCHSIA",
+    "PostCallRecordCreateBufferCollectionFUCHSIA",
+    "PreCallValidateSetBufferCollectionImageConstraintsFUCHSIA",
+    "PreCallRecordSetBufferCollectionImageConstraintsFUCHSIA",
+    "PostCallRecordSetBufferCollectionImageConstraintsFUCHSIA",
+    "PreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA",
+    "PreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA",
+    "PostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA",
+    "PreCallValidateDestroyBufferCollectionFUCHSIA",
+    "PreCallRecordDestroyBufferCollectionFUCHSIA",
+    "PostCallRecordDestroyBufferCollectionFUCHSIA",
+    "PreCallValidateGetBufferCollectionPropertiesFUCHSIA",
+    "PreCallRecordGetBufferCollectionPropertiesFUCHSIA",
+    "PostCallRecordGetBufferCollectionPropertiesFUCHSIA",
+    "PreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "PreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "PostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "PreCallValidateCmdSubpassShadingHUAWEI",
+    "PreCallRecordCmdSubpassShadingHUAWEI",
+    "PostCallRecordCmdSubpassShadingHUAWEI",
+    "PreCallValidateCmdBindInvocationMaskHUAWEI",
+    "PreCallRecordCmdBindInvocationMaskHUAWEI",
+    "PostCallRecordCmdBindInvocationMaskHUAWEI",
+    "PreCallValidateGetMemoryRemoteAddressNV",
+    "PreCallRecordGetMemoryRemoteAddressNV",
+    "PostCallRecordGetMemoryRemoteAddressNV",
+    "PreCallValidateCmdSetPatchControlPointsEXT",
+    "PreCallRecordCmdSetPatchControlPointsEXT",
+    "PostCallRecordCmdSetPatchControlPointsEXT",
+    "PreCallValidateCmdSetRasterizerDiscardEnableEXT",
+    "PreCallRecordCmdSetRasterizerDiscardEnableEXT",
+    "PostCallRecordCmdSetRasterizerDiscardEnableEXT",
+    "PreCallValidateCmdSetDepthBiasEnableEXT",
+    "PreCallRecordCmdSetDepthBiasEnableEXT",
+    "PostCallRecordCmdSetDepthBiasEnableEXT",
+    "PreCallValidateCmdSetLogicOpEXT",
+    "PreCallRecordCmdSetLogicOpEXT",
+    "PostCallRecordCmdSetLogicOpEXT",
+    "PreCallValidateCmdSetPrimitiveRestartEnableEXT",
+    "PreCallRecordCmdSetPrimitiveRestartEnableEXT",
+    "PostCallRecordCmdSetPrimitiveRestartEnableEXT",
+    "PreCallValidateCmdSetColorWriteEnableEXT",
+    "PreCallRecordCmdSetColorWriteEnableEXT",
+    "PostCallRecordCmdSetColorWriteEnableEXT",
+    "PreCallValidateCmdDrawMultiEXT",
+    "PreCallRecordCmdDrawMultiEXT",
+    "PostCallRecordCmdDrawMultiEXT",
+    "PreCallValidateCmdDrawMultiIndexedEXT",
+    "PreCallRecordCmdDrawMultiIndexedEXT",
+    "PostCallRecordCmdDrawMultiIndexedEXT",
+    "PreCallValidateSetDeviceMemoryPriorityEXT",
+    "PreCallRecordSetDeviceMemoryPriorityEXT",
+    "PostCallRecordSetDeviceMemoryPriorityEXT",
+    "PreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "PreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "PostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "PreCallValidateGetDescriptorSetHostMappingVALVE",
+    "PreCallRecordGetDescriptorSetHostMappingVALVE",
+    "PostCallRecordGetDescriptorSetHostMappingVALVE",
+    "PreCallValidateCreateAccelerationStructureKHR",
+    "PreCallRecordCreateAccelerationStructureKHR",
+    "PostCallRecordCreateAccelerationStructureKHR",
+    "PreCallValidateDestroyAccelerationStructureKHR",
+    "PreCallRecordDestroyAccelerationStructureKHR",
+    "PostCallRecordDestroyAccelerationStructureKHR",
+    "PreCallValidateCmdBuildAccelerationStructuresKHR",
+    "PreCallRecordCmdBuildAccelerationStructuresKHR",
+    "PostCallRecordCmdBuildAccelerationStructuresKHR",
+    "PreCallValidateCmdBuildAccelerationStructuresIndirectKHR",
+    "PreCallRecordCmdBuildAccelerationStructuresIndirectKHR",
+    "PostCallRecordCmdBuildAccelerationStructuresIndirectKHR",
+    "PreCallValidateBuildAccelerationStructuresKHR",
+    "PreCallRecordBuildAccelerationStructuresKHR",
+    "PostCallRecordBuildAccelerationStructuresKHR",
+    "PreCallValidateCopyAccelerationStructureKHR",
+    "PreCallRecordCopyAccelerationStructureKHR",
+    "PostCallRecordCopyAccelerationStructureKHR",
+    "PreCallValidateCopyAccelerationStructureToMemoryKHR",
+    "PreCallRecordCopyAccelerationStructureToMemoryKHR",
+    "PostCallRecordCopyAccelerationStructureToMemoryKHR",
+    "PreCallValidateCopyMemoryToAccelerationStructureKHR",
+    "PreCallRecordCopyMemoryToAccelerationStructureKHR",
+    "PostCallRecordCopyMemoryToAccelerationStructureKHR",
+    "PreCallValidateWriteAccelerationStructuresPropertiesKHR",
+    "PreCallRecordWriteAccelerationStructuresPropertiesKHR",
+    "PostCallRecordWriteAccelerationStructuresPropertiesKHR",
+    "PreCallValidateCmdCopyAccelerationStructureKHR",
+    "PreCallRecordCmdCopyAccelerationStructureKHR",
+    "PostCallRecordCmdCopyAccelerationStructureKHR",
+    "PreCallValidateCmdCopyAccelerationStructureToMemoryKHR",
+    "PreCallRecordCmdCopyAccelerationStructureToMemoryKHR",
+    "PostCallRecordCmdCopyAccelerationStructureToMemoryKHR",
+    "PreCallValidateCmdCopyMemoryToAccelerationStructureKHR",
+    "PreCallRecordCmdCopyMemoryToAccelerationStructureKHR",
+    "PostCallRecordCmdCopyMemoryToAccelerationStructureKHR",
+    "PreCallValidateGetAccelerationStructureDeviceAddressKHR",
+    "PreCallRecordGetAccelerationStructureDeviceAddressKHR",
+    "PostCallRecordGetAccelerationStructureDeviceAddressKHR",
+    "PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR",
+    "PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR",
+    "PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR",
+    "PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR",
+    "PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR",
+    "PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR",
+    "PreCallValidateGetAccelerationStructureBuildSizesKHR",
+    "PreCallRecordGetAccelerationStructureBuildSizesKHR",
+    "PostCallRecordGetAccelerationStructureBuildSizesKHR",
+    "PreCallValidateCmdTraceRaysKHR",
+    "PreCallRecordCmdTraceRaysKHR",
+    "PostCallRecordCmdTraceRaysKHR",
+    "PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "PreCallValidateCmdTraceRaysIndirectKHR",
+    "PreCallRecordCmdTraceRaysIndirectKHR",
+    "PostCallRecordCmdTraceRaysIndirectKHR",
+    "PreCallValidateGetRayTracingShaderGroupStackSizeKHR",
+    "PreCallRecordGetRayTracingShaderGroupStackSizeKHR",
+    "PostCallRecordGetRayTracingShaderGroupStackSizeKHR",
+    "PreCallValidateCmdSetRayTracingPipelineStackSizeKHR",
+    "PreCallRecordCmdSetRayTracingPipelineStackSizeKHR",
+    "PostCallRecordCmdSetRayTracingPipelineStackSizeKHR",
+};
+
 void ValidationObject::InitObjectDispatchVectors() {
 
 #define BUILD_DISPATCH_VECTOR(name) \
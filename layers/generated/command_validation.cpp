@@ -778,8 +778,271 @@ static const std::array<const char *, CMD_RANGE_SIZE> kGeneratedBufferLevelList
     nullptr,
 }};
 
+// The command buffer state word ValidateCmd compares to kGeneratedCommandRequirementList, a bit for each state that makes some
+// commands invalid
+enum CMD_STATE_BITS : uint32_t {
+    CMD_STATE_NOT_RECORDING = 0x1,
+    CMD_STATE_OUTSIDE_RENDER_PASS = 0x2,
+    CMD_STATE_INSIDE_RENDER_PASS = 0x4,
+    CMD_STATE_SECONDARY = 0x8,
+    // In a subpass of a primary command buffer recorded with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+    CMD_STATE_SECONDARY_CONTENTS = 0x10,
+    // The queue family of the command pool supports none of the queues of a set
+    CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE = 0x20,
+    CMD_STATE_NO_GRAPHICS_COMPUTE_DECODE_ENCODE_QUEUE = 0x40,
+    CMD_STATE_NO_GRAPHICS_QUEUE = 0x80,
+    CMD_STATE_NO_DECODE_ENCODE_QUEUE = 0x100,
+    CMD_STATE_NO_COMPUTE_QUEUE = 0x200,
+    CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE = 0x400,
+    CMD_STATE_NO_DECODE_QUEUE = 0x800,
+    CMD_STATE_NO_ENCODE_QUEUE = 0x1000,
+    CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_DECODE_ENCODE_QUEUE = 0x2000,
+};
+
+// The bits of the command buffer state word that are fixed at allocation
+uint32_t CommandBufferFixedStateBits(VkCommandBufferLevel level, VkQueueFlags queue_flags) {
+    uint32_t state_bits = (level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) ? 0 : CMD_STATE_SECONDARY;
+    if (!(queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+        state_bits |= CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR))) {
+        state_bits |= CMD_STATE_NO_GRAPHICS_COMPUTE_DECODE_ENCODE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_GRAPHICS_BIT))) {
+        state_bits |= CMD_STATE_NO_GRAPHICS_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR))) {
+        state_bits |= CMD_STATE_NO_DECODE_ENCODE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_COMPUTE_BIT))) {
+        state_bits |= CMD_STATE_NO_COMPUTE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT))) {
+        state_bits |= CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_VIDEO_DECODE_BIT_KHR))) {
+        state_bits |= CMD_STATE_NO_DECODE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_VIDEO_ENCODE_BIT_KHR))) {
+        state_bits |= CMD_STATE_NO_ENCODE_QUEUE;
+    }
+    if (!(queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_VIDEO_DECODE_BIT_KHR | VK_QUEUE_VIDEO_ENCODE_BIT_KHR))) {
+        state_bits |= CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_DECODE_ENCODE_QUEUE;
+    }
+    return state_bits;
+}
+
+static uint32_t CommandBufferStateBits(const CMD_BUFFER_STATE *cb_state) {
+    // Every command buffer of CoreChecks is a CORE_CMD_BUFFER_STATE
+    uint32_t state_bits = static_cast<const CORE_CMD_BUFFER_STATE *>(cb_state)->fixed_state_bits;
+    if (cb_state->state != CB_RECORDING) {
+        state_bits |= CMD_STATE_NOT_RECORDING;
+    }
+    if (cb_state->activeRenderPass) {
+        state_bits |= CMD_STATE_INSIDE_RENDER_PASS;
+        if (cb_state->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY &&
+            cb_state->activeSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) {
+            state_bits |= CMD_STATE_SECONDARY_CONTENTS;
+        }
+    } else if (cb_state->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ||
+               !(cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+        state_bits |= CMD_STATE_OUTSIDE_RENDER_PASS;
+    }
+    return state_bits;
+}
+
+static const std::array<uint32_t, CMD_RANGE_SIZE> kGeneratedCommandRequirementList = {{
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS, // CMD_NONE
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_DECODE_ENCODE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_DECODE_ENCODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_DECODE_ENCODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_DECODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_ENCODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_DECODE_ENCODE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_DECODE_ENCODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS | CMD_STATE_SECONDARY,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_DECODE_ENCODE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_QUEUE | CMD_STATE_OUTSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_COMPUTE_QUEUE | CMD_STATE_INSIDE_RENDER_PASS,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_DECODE_ENCODE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_DECODE_ENCODE_QUEUE,
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS | CMD_STATE_NO_GRAPHICS_COMPUTE_TRANSFER_DECODE_ENCODE_QUEUE,
+}};
+
 // Used to handle all the implicit VUs that are autogenerated from the registry
 bool CoreChecks::ValidateCmd(const CMD_BUFFER_STATE *cb_state, const CMD_TYPE cmd) const {
+    // The command is valid if the command buffer is in none of the states it is invalid in, otherwise find out what is wrong
+    if ((CommandBufferStateBits(cb_state) & kGeneratedCommandRequirementList[cmd]) == 0) {
+        return false;
+    }
+
     bool skip = false;
     const char *caller_name = CommandTypeString(cmd);
 
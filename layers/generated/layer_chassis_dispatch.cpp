@@ -230,11 +230,50 @@ void WrapPnextChainHandles(ValidationObject *layer_data, const void *pNext) {
     }
 }
 
+// Whether WrapPnextChainHandles would unwrap any handle of the chain
+bool PnextChainHasHandles(const void *pNext) {
+    for (auto header = reinterpret_cast<const VkBaseInStructure *>(pNext); header; header = header->pNext) {
+        switch (header->sType) {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+#ifdef VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI:
+            case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
+            case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
+            case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+            case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT:
+            case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
 
-// Manually written Dispatch routines
 
+// Manually written Dispatch routines
 
-#define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
 // The VK_EXT_pipeline_creation_feedback extension returns data from the driver -- we've created a copy of the pnext chain, so
 // copy the returned data to the caller before freeing the copy's data.
@@ -1448,6 +1487,202 @@ VkResult DispatchGetDeferredOperationResultKHR(
     return result;
 }
 
+// vkQueueSubmit and vkUpdateDescriptorSets run every frame, so when no pNext chain of theirs holds a handle, their structs
+// aren't deep copied into safe structs: shallow copies with unwrapped handle arrays are made in a per-thread scratch arena,
+// which keeps its memory from call to call. Chains that hold handles take the safe struct copies like other entry points.
+static ScratchArena &GetDispatchScratchArena() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+template <typename HandleType>
+static const HandleType *UnwrapToScratch(ValidationObject *layer_data, ScratchArena &arena, const HandleType *handles,
+                                         uint32_t count) {
+    HandleType *unwrapped = arena.Allocate<HandleType>(count);
+    for (uint32_t index = 0; index < count; ++index) {
+        unwrapped[index] = layer_data->Unwrap(handles[index]);
+    }
+    return unwrapped;
+}
+
+VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    bool pnext_handles = false;
+    if (pSubmits) {
+        for (uint32_t index0 = 0; (index0 < submitCount) && !pnext_handles; ++index0) {
+            pnext_handles = PnextChainHasHandles(pSubmits[index0].pNext);
+        }
+    }
+    if (!pnext_handles) {
+        ScratchArena &arena = GetDispatchScratchArena();
+        ScratchArena::Mark mark(arena);
+        VkSubmitInfo *local_pSubmits = pSubmits ? arena.Copy(pSubmits, submitCount) : nullptr;
+        for (uint32_t index0 = 0; local_pSubmits && (index0 < submitCount); ++index0) {
+            VkSubmitInfo &submit = local_pSubmits[index0];
+            if (submit.pWaitSemaphores) {
+                submit.pWaitSemaphores = UnwrapToScratch(layer_data, arena, submit.pWaitSemaphores, submit.waitSemaphoreCount);
+            }
+            if (submit.pSignalSemaphores) {
+                submit.pSignalSemaphores =
+                    UnwrapToScratch(layer_data, arena, submit.pSignalSemaphores, submit.signalSemaphoreCount);
+            }
+        }
+        return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, local_pSubmits, layer_data->Unwrap(fence));
+    }
+
+    safe_VkSubmitInfo *local_pSubmits = new safe_VkSubmitInfo[submitCount];
+    for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+        local_pSubmits[index0].initialize(&pSubmits[index0]);
+        WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
+        if (local_pSubmits[index0].pWaitSemaphores) {
+            for (uint32_t index1 = 0; index1 < local_pSubmits[index0].waitSemaphoreCount; ++index1) {
+                local_pSubmits[index0].pWaitSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pWaitSemaphores[index1]);
+            }
+        }
+        if (local_pSubmits[index0].pSignalSemaphores) {
+            for (uint32_t index1 = 0; index1 < local_pSubmits[index0].signalSemaphoreCount; ++index1) {
+                local_pSubmits[index0].pSignalSemaphores[index1] =
+                    layer_data->Unwrap(local_pSubmits[index0].pSignalSemaphores[index1]);
+            }
+        }
+    }
+    fence = layer_data->Unwrap(fence);
+    VkResult result =
+        layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, (const VkSubmitInfo *)local_pSubmits, fence);
+    delete[] local_pSubmits;
+    return result;
+}
+
+// The same descriptor info arrays as safe_VkWriteDescriptorSet copies, unwrapped
+static void UnwrapDescriptorWriteToScratch(ValidationObject *layer_data, ScratchArena &arena, VkWriteDescriptorSet &write) {
+    if (write.dstSet) {
+        write.dstSet = layer_data->Unwrap(write.dstSet);
+    }
+    const VkDescriptorImageInfo *image_info = nullptr;
+    const VkDescriptorBufferInfo *buffer_info = nullptr;
+    const VkBufferView *texel_buffer_view = nullptr;
+    switch (write.descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            if (write.descriptorCount && write.pImageInfo) {
+                VkDescriptorImageInfo *local_image_info = arena.Copy(write.pImageInfo, write.descriptorCount);
+                for (uint32_t index = 0; index < write.descriptorCount; ++index) {
+                    if (local_image_info[index].sampler) {
+                        local_image_info[index].sampler = layer_data->Unwrap(local_image_info[index].sampler);
+                    }
+                    if (local_image_info[index].imageView) {
+                        local_image_info[index].imageView = layer_data->Unwrap(local_image_info[index].imageView);
+                    }
+                }
+                image_info = local_image_info;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            if (write.descriptorCount && write.pBufferInfo) {
+                VkDescriptorBufferInfo *local_buffer_info = arena.Copy(write.pBufferInfo, write.descriptorCount);
+                for (uint32_t index = 0; index < write.descriptorCount; ++index) {
+                    if (local_buffer_info[index].buffer) {
+                        local_buffer_info[index].buffer = layer_data->Unwrap(local_buffer_info[index].buffer);
+                    }
+                }
+                buffer_info = local_buffer_info;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            if (write.descriptorCount && write.pTexelBufferView) {
+                texel_buffer_view = UnwrapToScratch(layer_data, arena, write.pTexelBufferView, write.descriptorCount);
+            }
+            break;
+        default:
+            break;
+    }
+    write.pImageInfo = image_info;
+    write.pBufferInfo = buffer_info;
+    write.pTexelBufferView = texel_buffer_view;
+}
+
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    bool pnext_handles = false;
+    if (pDescriptorWrites) {
+        for (uint32_t index0 = 0; (index0 < descriptorWriteCount) && !pnext_handles; ++index0) {
+            pnext_handles = PnextChainHasHandles(pDescriptorWrites[index0].pNext);
+        }
+    }
+    ScratchArena &arena = GetDispatchScratchArena();
+    ScratchArena::Mark mark(arena);
+    VkCopyDescriptorSet *local_pDescriptorCopies = pDescriptorCopies ? arena.Copy(pDescriptorCopies, descriptorCopyCount) : nullptr;
+    for (uint32_t index0 = 0; local_pDescriptorCopies && (index0 < descriptorCopyCount); ++index0) {
+        if (local_pDescriptorCopies[index0].srcSet) {
+            local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(local_pDescriptorCopies[index0].srcSet);
+        }
+        if (local_pDescriptorCopies[index0].dstSet) {
+            local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(local_pDescriptorCopies[index0].dstSet);
+        }
+    }
+    if (!pnext_handles) {
+        VkWriteDescriptorSet *local_pDescriptorWrites =
+            pDescriptorWrites ? arena.Copy(pDescriptorWrites, descriptorWriteCount) : nullptr;
+        for (uint32_t index0 = 0; local_pDescriptorWrites && (index0 < descriptorWriteCount); ++index0) {
+            UnwrapDescriptorWriteToScratch(layer_data, arena, local_pDescriptorWrites[index0]);
+        }
+        layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, local_pDescriptorWrites,
+                                                               descriptorCopyCount, local_pDescriptorCopies);
+        return;
+    }
+
+    safe_VkWriteDescriptorSet *local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+    for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
+        local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
+        WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
+        if (pDescriptorWrites[index0].dstSet) {
+            local_pDescriptorWrites[index0].dstSet = layer_data->Unwrap(pDescriptorWrites[index0].dstSet);
+        }
+        if (local_pDescriptorWrites[index0].pImageInfo) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                if (pDescriptorWrites[index0].pImageInfo[index1].sampler) {
+                    local_pDescriptorWrites[index0].pImageInfo[index1].sampler =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].sampler);
+                }
+                if (pDescriptorWrites[index0].pImageInfo[index1].imageView) {
+                    local_pDescriptorWrites[index0].pImageInfo[index1].imageView =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].imageView);
+                }
+            }
+        }
+        if (local_pDescriptorWrites[index0].pBufferInfo) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                if (pDescriptorWrites[index0].pBufferInfo[index1].buffer) {
+                    local_pDescriptorWrites[index0].pBufferInfo[index1].buffer =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pBufferInfo[index1].buffer);
+                }
+            }
+        }
+        if (local_pDescriptorWrites[index0].pTexelBufferView) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                local_pDescriptorWrites[index0].pTexelBufferView[index1] =
+                    layer_data->Unwrap(local_pDescriptorWrites[index0].pTexelBufferView[index1]);
+            }
+        }
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount,
+                                                           (const VkWriteDescriptorSet *)local_pDescriptorWrites,
+                                                           descriptorCopyCount, local_pDescriptorCopies);
+    delete[] local_pDescriptorWrites;
+}
+
 
 
 // Skip vkCreateInstance dispatch, manually generated
@@ -1570,41 +1805,7 @@ void DispatchGetDeviceQueue(
 
 }
 
-VkResult DispatchQueueSubmit(
-    VkQueue                                     queue,
-    uint32_t                                    submitCount,
-    const VkSubmitInfo*                         pSubmits,
-    VkFence                                     fence)
-{
-    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
-    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
-    safe_VkSubmitInfo *local_pSubmits = NULL;
-    {
-        if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo[submitCount];
-            for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
-                local_pSubmits[index0].initialize(&pSubmits[index0]);
-                WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
-                if (local_pSubmits[index0].pWaitSemaphores) {
-                    for (uint32_t index1 = 0; index1 < local_pSubmits[index0].waitSemaphoreCount; ++index1) {
-                        local_pSubmits[index0].pWaitSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pWaitSemaphores[index1]);
-                    }
-                }
-                if (local_pSubmits[index0].pSignalSemaphores) {
-                    for (uint32_t index1 = 0; index1 < local_pSubmits[index0].signalSemaphoreCount; ++index1) {
-                        local_pSubmits[index0].pSignalSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pSignalSemaphores[index1]);
-                    }
-                }
-            }
-        }
-        fence = layer_data->Unwrap(fence);
-    }
-    VkResult result = layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, (const VkSubmitInfo*)local_pSubmits, fence);
-    if (local_pSubmits) {
-        delete[] local_pSubmits;
-    }
-    return result;
-}
+// Skip vkQueueSubmit dispatch, manually generated
 
 VkResult DispatchQueueWaitIdle(
     VkQueue                                     queue)
@@ -1704,12 +1905,14 @@ VkResult DispatchFlushMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = scratch_arena.Allocate<VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
-                local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
+                local_pMemoryRanges[index0] = pMemoryRanges[index0];
                 if (pMemoryRanges[index0].memory) {
                     local_pMemoryRanges[index0].memory = layer_data->Unwrap(pMemoryRanges[index0].memory);
                 }
@@ -1717,9 +1920,6 @@ VkResult DispatchFlushMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
     return result;
 }
 
@@ -1730,12 +1930,14 @@ VkResult DispatchInvalidateMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = scratch_arena.Allocate<VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
-                local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
+                local_pMemoryRanges[index0] = pMemoryRanges[index0];
                 if (pMemoryRanges[index0].memory) {
                     local_pMemoryRanges[index0].memory = layer_data->Unwrap(pMemoryRanges[index0].memory);
                 }
@@ -1743,9 +1945,6 @@ VkResult DispatchInvalidateMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
     return result;
 }
 
@@ -1972,19 +2171,18 @@ VkResult DispatchResetFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetFences(device, fenceCount, pFences);
-    VkFence var_local_pFences[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkFence *local_pFences = NULL;
     {
         if (pFences) {
-            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkFence[fenceCount] : var_local_pFences;
+            local_pFences = scratch_arena.Allocate<VkFence>(fenceCount);
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.ResetFences(device, fenceCount, (const VkFence*)local_pFences);
-    if (local_pFences != var_local_pFences)
-        delete[] local_pFences;
     return result;
 }
 
@@ -2011,19 +2209,18 @@ VkResult DispatchWaitForFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
-    VkFence var_local_pFences[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkFence *local_pFences = NULL;
     {
         if (pFences) {
-            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkFence[fenceCount] : var_local_pFences;
+            local_pFences = scratch_arena.Allocate<VkFence>(fenceCount);
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.WaitForFences(device, fenceCount, (const VkFence*)local_pFences, waitAll, timeout);
-    if (local_pFences != var_local_pFences)
-        delete[] local_pFences;
     return result;
 }
 
@@ -2475,20 +2672,19 @@ VkResult DispatchMergePipelineCaches(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
-    VkPipelineCache var_local_pSrcCaches[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkPipelineCache *local_pSrcCaches = NULL;
     {
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkPipelineCache[srcCacheCount] : var_local_pSrcCaches;
+            local_pSrcCaches = scratch_arena.Allocate<VkPipelineCache>(srcCacheCount);
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, (const VkPipelineCache*)local_pSrcCaches);
-    if (local_pSrcCaches != var_local_pSrcCaches)
-        delete[] local_pSrcCaches;
     return result;
 }
 
@@ -2723,71 +2919,7 @@ VkResult DispatchCreateDescriptorPool(
 
 // Skip vkFreeDescriptorSets dispatch, manually generated
 
-void DispatchUpdateDescriptorSets(
-    VkDevice                                    device,
-    uint32_t                                    descriptorWriteCount,
-    const VkWriteDescriptorSet*                 pDescriptorWrites,
-    uint32_t                                    descriptorCopyCount,
-    const VkCopyDescriptorSet*                  pDescriptorCopies)
-{
-    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    if (!wrap_handles) return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
-    safe_VkWriteDescriptorSet *local_pDescriptorWrites = NULL;
-    safe_VkCopyDescriptorSet *local_pDescriptorCopies = NULL;
-    {
-        if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
-            for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
-                local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
-                WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
-                if (pDescriptorWrites[index0].dstSet) {
-                    local_pDescriptorWrites[index0].dstSet = layer_data->Unwrap(pDescriptorWrites[index0].dstSet);
-                }
-                if (local_pDescriptorWrites[index0].pImageInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pImageInfo[index1].sampler) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].sampler = layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].sampler);
-                        }
-                        if (pDescriptorWrites[index0].pImageInfo[index1].imageView) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].imageView = layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].imageView);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pBufferInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pBufferInfo[index1].buffer) {
-                            local_pDescriptorWrites[index0].pBufferInfo[index1].buffer = layer_data->Unwrap(pDescriptorWrites[index0].pBufferInfo[index1].buffer);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pTexelBufferView) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        local_pDescriptorWrites[index0].pTexelBufferView[index1] = layer_data->Unwrap(local_pDescriptorWrites[index0].pTexelBufferView[index1]);
-                    }
-                }
-            }
-        }
-        if (pDescriptorCopies) {
-            local_pDescriptorCopies = new safe_VkCopyDescriptorSet[descriptorCopyCount];
-            for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
-                local_pDescriptorCopies[index0].initialize(&pDescriptorCopies[index0]);
-                if (pDescriptorCopies[index0].srcSet) {
-                    local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(pDescriptorCopies[index0].srcSet);
-                }
-                if (pDescriptorCopies[index0].dstSet) {
-                    local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(pDescriptorCopies[index0].dstSet);
-                }
-            }
-        }
-    }
-    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, (const VkWriteDescriptorSet*)local_pDescriptorWrites, descriptorCopyCount, (const VkCopyDescriptorSet*)local_pDescriptorCopies);
-    if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
-    }
-    if (local_pDescriptorCopies) {
-        delete[] local_pDescriptorCopies;
-    }
-}
+// Skip vkUpdateDescriptorSets dispatch, manually generated
 
 VkResult DispatchCreateFramebuffer(
     VkDevice                                    device,
@@ -3030,20 +3162,19 @@ void DispatchCmdBindDescriptorSets(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    VkDescriptorSet var_local_pDescriptorSets[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkDescriptorSet *local_pDescriptorSets = NULL;
     {
         layout = layer_data->Unwrap(layout);
         if (pDescriptorSets) {
-            local_pDescriptorSets = descriptorSetCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkDescriptorSet[descriptorSetCount] : var_local_pDescriptorSets;
+            local_pDescriptorSets = scratch_arena.Allocate<VkDescriptorSet>(descriptorSetCount);
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, (const VkDescriptorSet*)local_pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    if (local_pDescriptorSets != var_local_pDescriptorSets)
-        delete[] local_pDescriptorSets;
 }
 
 void DispatchCmdBindIndexBuffer(
@@ -3070,19 +3201,18 @@ void DispatchCmdBindVertexBuffers(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-    VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = scratch_arena.Allocate<VkBuffer>(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdDraw(
@@ -3399,30 +3529,31 @@ void DispatchCmdWaitEvents(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkEvent *local_pEvents = NULL;
-    safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
-    safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
+    VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
+    VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
         if (pEvents) {
-            local_pEvents = eventCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkEvent[eventCount] : var_local_pEvents;
+            local_pEvents = scratch_arena.Allocate<VkEvent>(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pEvents[index0] = layer_data->Unwrap(pEvents[index0]);
             }
         }
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = scratch_arena.Allocate<VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
-                local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
+                local_pBufferMemoryBarriers[index0] = pBufferMemoryBarriers[index0];
                 if (pBufferMemoryBarriers[index0].buffer) {
                     local_pBufferMemoryBarriers[index0].buffer = layer_data->Unwrap(pBufferMemoryBarriers[index0].buffer);
                 }
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = scratch_arena.Allocate<VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
-                local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
+                local_pImageMemoryBarriers[index0] = pImageMemoryBarriers[index0];
                 if (pImageMemoryBarriers[index0].image) {
                     local_pImageMemoryBarriers[index0].image = layer_data->Unwrap(pImageMemoryBarriers[index0].image);
                 }
@@ -3430,14 +3561,6 @@ void DispatchCmdWaitEvents(
         }
     }
     layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, (const VkEvent*)local_pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pEvents != var_local_pEvents)
-        delete[] local_pEvents;
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
 }
 
 void DispatchCmdPipelineBarrier(
@@ -3454,22 +3577,24 @@ void DispatchCmdPipelineBarrier(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
-    safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
+    VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = scratch_arena.Allocate<VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
-                local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
+                local_pBufferMemoryBarriers[index0] = pBufferMemoryBarriers[index0];
                 if (pBufferMemoryBarriers[index0].buffer) {
                     local_pBufferMemoryBarriers[index0].buffer = layer_data->Unwrap(pBufferMemoryBarriers[index0].buffer);
                 }
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = scratch_arena.Allocate<VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
-                local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
+                local_pImageMemoryBarriers[index0] = pImageMemoryBarriers[index0];
                 if (pImageMemoryBarriers[index0].image) {
                     local_pImageMemoryBarriers[index0].image = layer_data->Unwrap(pImageMemoryBarriers[index0].image);
                 }
@@ -3477,12 +3602,6 @@ void DispatchCmdPipelineBarrier(
         }
     }
     layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
 }
 
 void DispatchCmdBeginQuery(
@@ -3643,12 +3762,14 @@ VkResult DispatchBindBufferMemory2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, pBindInfos);
-    safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch_arena.Allocate<VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
-                local_pBindInfos[index0].initialize(&pBindInfos[index0]);
+                local_pBindInfos[index0] = pBindInfos[index0];
                 if (pBindInfos[index0].buffer) {
                     local_pBindInfos[index0].buffer = layer_data->Unwrap(pBindInfos[index0].buffer);
                 }
@@ -3659,9 +3780,6 @@ VkResult DispatchBindBufferMemory2(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
     return result;
 }
 
@@ -4330,12 +4448,13 @@ void DispatchCmdWaitEvents2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
-    VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkEvent *local_pEvents = NULL;
     safe_VkDependencyInfo *local_pDependencyInfos = NULL;
     {
         if (pEvents) {
-            local_pEvents = eventCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkEvent[eventCount] : var_local_pEvents;
+            local_pEvents = scratch_arena.Allocate<VkEvent>(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pEvents[index0] = layer_data->Unwrap(pEvents[index0]);
             }
@@ -4362,8 +4481,6 @@ void DispatchCmdWaitEvents2(
         }
     }
     layer_data->device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, (const VkEvent*)local_pEvents, (const VkDependencyInfo*)local_pDependencyInfos);
-    if (local_pEvents != var_local_pEvents)
-        delete[] local_pEvents;
     if (local_pDependencyInfos) {
         delete[] local_pDependencyInfos;
     }
@@ -4711,19 +4828,18 @@ void DispatchCmdBindVertexBuffers2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-    VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = scratch_arena.Allocate<VkBuffer>(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes, pStrides);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdSetDepthTestEnable(
@@ -5336,13 +5452,15 @@ VkResult DispatchBindVideoSessionMemoryKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, pVideoSessionBindMemories);
-    safe_VkVideoBindMemoryKHR *local_pVideoSessionBindMemories = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkVideoBindMemoryKHR *local_pVideoSessionBindMemories = NULL;
     {
         videoSession = layer_data->Unwrap(videoSession);
         if (pVideoSessionBindMemories) {
-            local_pVideoSessionBindMemories = new safe_VkVideoBindMemoryKHR[videoSessionBindMemoryCount];
+            local_pVideoSessionBindMemories = scratch_arena.Allocate<VkVideoBindMemoryKHR>(videoSessionBindMemoryCount);
             for (uint32_t index0 = 0; index0 < videoSessionBindMemoryCount; ++index0) {
-                local_pVideoSessionBindMemories[index0].initialize(&pVideoSessionBindMemories[index0]);
+                local_pVideoSessionBindMemories[index0] = pVideoSessionBindMemories[index0];
                 if (pVideoSessionBindMemories[index0].memory) {
                     local_pVideoSessionBindMemories[index0].memory = layer_data->Unwrap(pVideoSessionBindMemories[index0].memory);
                 }
@@ -5350,9 +5468,6 @@ VkResult DispatchBindVideoSessionMemoryKHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindVideoSessionMemoryKHR(device, videoSession, videoSessionBindMemoryCount, (const VkVideoBindMemoryKHR*)local_pVideoSessionBindMemories);
-    if (local_pVideoSessionBindMemories) {
-        delete[] local_pVideoSessionBindMemories;
-    }
     return result;
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -6356,12 +6471,14 @@ VkResult DispatchBindBufferMemory2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
-    safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
+    VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch_arena.Allocate<VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
-                local_pBindInfos[index0].initialize(&pBindInfos[index0]);
+                local_pBindInfos[index0] = pBindInfos[index0];
                 if (pBindInfos[index0].buffer) {
                     local_pBindInfos[index0].buffer = layer_data->Unwrap(pBindInfos[index0].buffer);
                 }
@@ -6372,9 +6489,6 @@ VkResult DispatchBindBufferMemory2KHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
     return result;
 }
 
@@ -6860,12 +6974,13 @@ void DispatchCmdWaitEvents2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
-    VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkEvent *local_pEvents = NULL;
     safe_VkDependencyInfo *local_pDependencyInfos = NULL;
     {
         if (pEvents) {
-            local_pEvents = eventCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkEvent[eventCount] : var_local_pEvents;
+            local_pEvents = scratch_arena.Allocate<VkEvent>(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pEvents[index0] = layer_data->Unwrap(pEvents[index0]);
             }
@@ -6892,8 +7007,6 @@ void DispatchCmdWaitEvents2KHR(
         }
     }
     layer_data->device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, (const VkEvent*)local_pEvents, (const VkDependencyInfo*)local_pDependencyInfos);
-    if (local_pEvents != var_local_pEvents)
-        delete[] local_pEvents;
     if (local_pDependencyInfos) {
         delete[] local_pDependencyInfos;
     }
@@ -7275,19 +7388,18 @@ void DispatchCmdBindTransformFeedbackBuffersEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
-    VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = scratch_arena.Allocate<VkBuffer>(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdBeginTransformFeedbackEXT(
@@ -7299,19 +7411,18 @@ void DispatchCmdBeginTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    VkBuffer var_local_pCounterBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pCounterBuffers = NULL;
     {
         if (pCounterBuffers) {
-            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[counterBufferCount] : var_local_pCounterBuffers;
+            local_pCounterBuffers = scratch_arena.Allocate<VkBuffer>(counterBufferCount);
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers != var_local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
 }
 
 void DispatchCmdEndTransformFeedbackEXT(
@@ -7323,19 +7434,18 @@ void DispatchCmdEndTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    VkBuffer var_local_pCounterBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pCounterBuffers = NULL;
     {
         if (pCounterBuffers) {
-            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[counterBufferCount] : var_local_pCounterBuffers;
+            local_pCounterBuffers = scratch_arena.Allocate<VkBuffer>(counterBufferCount);
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers != var_local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
 }
 
 void DispatchCmdBeginQueryIndexedEXT(
@@ -7872,19 +7982,18 @@ void DispatchSetHdrMetadataEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
-    VkSwapchainKHR var_local_pSwapchains[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkSwapchainKHR *local_pSwapchains = NULL;
     {
         if (pSwapchains) {
-            local_pSwapchains = swapchainCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkSwapchainKHR[swapchainCount] : var_local_pSwapchains;
+            local_pSwapchains = scratch_arena.Allocate<VkSwapchainKHR>(swapchainCount);
             for (uint32_t index0 = 0; index0 < swapchainCount; ++index0) {
                 local_pSwapchains[index0] = layer_data->Unwrap(pSwapchains[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, (const VkSwapchainKHR*)local_pSwapchains, pMetadata);
-    if (local_pSwapchains != var_local_pSwapchains)
-        delete[] local_pSwapchains;
 }
 
 #ifdef VK_USE_PLATFORM_IOS_MVK
@@ -8138,20 +8247,19 @@ VkResult DispatchMergeValidationCachesEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
-    VkValidationCacheEXT var_local_pSrcCaches[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkValidationCacheEXT *local_pSrcCaches = NULL;
     {
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkValidationCacheEXT[srcCacheCount] : var_local_pSrcCaches;
+            local_pSrcCaches = scratch_arena.Allocate<VkValidationCacheEXT>(srcCacheCount);
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, (const VkValidationCacheEXT*)local_pSrcCaches);
-    if (local_pSrcCaches != var_local_pSrcCaches)
-        delete[] local_pSrcCaches;
     return result;
 }
 
@@ -8520,11 +8628,12 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    VkAccelerationStructureNV var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkAccelerationStructureNV *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureNV[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = scratch_arena.Allocate<VkAccelerationStructureNV>(accelerationStructureCount);
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
@@ -8532,8 +8641,6 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, (const VkAccelerationStructureNV*)local_pAccelerationStructures, queryType, queryPool, firstQuery);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
 }
 
 VkResult DispatchCompileDeferredNV(
@@ -9060,19 +9167,18 @@ void DispatchCmdBindVertexBuffers2EXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-    VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = scratch_arena.Allocate<VkBuffer>(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes, pStrides);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdSetDepthTestEnableEXT(
@@ -10113,19 +10219,18 @@ VkResult DispatchWriteAccelerationStructuresPropertiesKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.WriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
-    VkAccelerationStructureKHR var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkAccelerationStructureKHR *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureKHR[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = scratch_arena.Allocate<VkAccelerationStructureKHR>(accelerationStructureCount);
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.WriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, (const VkAccelerationStructureKHR*)local_pAccelerationStructures, queryType, dataSize, pData, stride);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
     return result;
 }
 
@@ -10227,11 +10332,12 @@ void DispatchCmdWriteAccelerationStructuresPropertiesKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    VkAccelerationStructureKHR var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
+    ScratchArena &scratch_arena = GetDispatchScratchArena();
+    ScratchArena::Mark scratch_mark(scratch_arena);
     VkAccelerationStructureKHR *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureKHR[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = scratch_arena.Allocate<VkAccelerationStructureKHR>(accelerationStructureCount);
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
@@ -10239,8 +10345,6 @@ void DispatchCmdWriteAccelerationStructuresPropertiesKHR(
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, (const VkAccelerationStructureKHR*)local_pAccelerationStructures, queryType, queryPool, firstQuery);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
 }
 
 void DispatchGetDeviceAccelerationStructureCompatibilityKHR(
@@ -39,437 +39,872 @@ struct InstructionInfo {
 };
 
 // Static table to replace having many large switch statement functions for looking up each part
-// of a given SPIR-V opcode instruction
+// of a given SPIR-V opcode instruction, in opcode order. The first entry is for opcodes not in the grammar.
 //
 // clang-format off
-static const layer_data::unordered_map<uint32_t, InstructionInfo> kInstructionTable {
-    {spv::OpNop, {"OpNop", false, false, 0, 0, 0}},
-    {spv::OpUndef, {"OpUndef", true, true, 0, 0, 0}},
-    {spv::OpSourceContinued, {"OpSourceContinued", false, false, 0, 0, 0}},
-    {spv::OpSource, {"OpSource", false, false, 0, 0, 0}},
-    {spv::OpSourceExtension, {"OpSourceExtension", false, false, 0, 0, 0}},
-    {spv::OpName, {"OpName", false, false, 0, 0, 0}},
-    {spv::OpMemberName, {"OpMemberName", false, false, 0, 0, 0}},
-    {spv::OpString, {"OpString", false, true, 0, 0, 0}},
-    {spv::OpLine, {"OpLine", false, false, 0, 0, 0}},
-    {spv::OpExtension, {"OpExtension", false, false, 0, 0, 0}},
-    {spv::OpExtInstImport, {"OpExtInstImport", false, true, 0, 0, 0}},
-    {spv::OpExtInst, {"OpExtInst", true, true, 0, 0, 0}},
-    {spv::OpMemoryModel, {"OpMemoryModel", false, false, 0, 0, 0}},
-    {spv::OpEntryPoint, {"OpEntryPoint", false, false, 0, 0, 0}},
-    {spv::OpExecutionMode, {"OpExecutionMode", false, false, 0, 0, 0}},
-    {spv::OpCapability, {"OpCapability", false, false, 0, 0, 0}},
-    {spv::OpTypeVoid, {"OpTypeVoid", false, true, 0, 0, 0}},
-    {spv::OpTypeBool, {"OpTypeBool", false, true, 0, 0, 0}},
-    {spv::OpTypeInt, {"OpTypeInt", false, true, 0, 0, 0}},
-    {spv::OpTypeFloat, {"OpTypeFloat", false, true, 0, 0, 0}},
-    {spv::OpTypeVector, {"OpTypeVector", false, true, 0, 0, 0}},
-    {spv::OpTypeMatrix, {"OpTypeMatrix", false, true, 0, 0, 0}},
-    {spv::OpTypeImage, {"OpTypeImage", false, true, 0, 0, 0}},
-    {spv::OpTypeSampler, {"OpTypeSampler", false, true, 0, 0, 0}},
-    {spv::OpTypeSampledImage, {"OpTypeSampledImage", false, true, 0, 0, 0}},
-    {spv::OpTypeArray, {"OpTypeArray", false, true, 0, 0, 0}},
-    {spv::OpTypeRuntimeArray, {"OpTypeRuntimeArray", false, true, 0, 0, 0}},
-    {spv::OpTypeStruct, {"OpTypeStruct", false, true, 0, 0, 0}},
-    {spv::OpTypePointer, {"OpTypePointer", false, true, 0, 0, 0}},
-    {spv::OpTypeFunction, {"OpTypeFunction", false, true, 0, 0, 0}},
-    {spv::OpTypeForwardPointer, {"OpTypeForwardPointer", false, false, 0, 0, 0}},
-    {spv::OpConstantTrue, {"OpConstantTrue", true, true, 0, 0, 0}},
-    {spv::OpConstantFalse, {"OpConstantFalse", true, true, 0, 0, 0}},
-    {spv::OpConstant, {"OpConstant", true, true, 0, 0, 0}},
-    {spv::OpConstantComposite, {"OpConstantComposite", true, true, 0, 0, 0}},
-    {spv::OpConstantNull, {"OpConstantNull", true, true, 0, 0, 0}},
-    {spv::OpSpecConstantTrue, {"OpSpecConstantTrue", true, true, 0, 0, 0}},
-    {spv::OpSpecConstantFalse, {"OpSpecConstantFalse", true, true, 0, 0, 0}},
-    {spv::OpSpecConstant, {"OpSpecConstant", true, true, 0, 0, 0}},
-    {spv::OpSpecConstantComposite, {"OpSpecConstantComposite", true, true, 0, 0, 0}},
-    {spv::OpSpecConstantOp, {"OpSpecConstantOp", true, true, 0, 0, 0}},
-    {spv::OpFunction, {"OpFunction", true, true, 0, 0, 0}},
-    {spv::OpFunctionParameter, {"OpFunctionParameter", true, true, 0, 0, 0}},
-    {spv::OpFunctionEnd, {"OpFunctionEnd", false, false, 0, 0, 0}},
-    {spv::OpFunctionCall, {"OpFunctionCall", true, true, 0, 0, 0}},
-    {spv::OpVariable, {"OpVariable", true, true, 0, 0, 0}},
-    {spv::OpImageTexelPointer, {"OpImageTexelPointer", true, true, 0, 0, 0}},
-    {spv::OpLoad, {"OpLoad", true, true, 0, 0, 0}},
-    {spv::OpStore, {"OpStore", false, false, 0, 0, 0}},
-    {spv::OpCopyMemory, {"OpCopyMemory", false, false, 0, 0, 0}},
-    {spv::OpCopyMemorySized, {"OpCopyMemorySized", false, false, 0, 0, 0}},
-    {spv::OpAccessChain, {"OpAccessChain", true, true, 0, 0, 0}},
-    {spv::OpInBoundsAccessChain, {"OpInBoundsAccessChain", true, true, 0, 0, 0}},
-    {spv::OpPtrAccessChain, {"OpPtrAccessChain", true, true, 0, 0, 0}},
-    {spv::OpArrayLength, {"OpArrayLength", true, true, 0, 0, 0}},
-    {spv::OpInBoundsPtrAccessChain, {"OpInBoundsPtrAccessChain", true, true, 0, 0, 0}},
-    {spv::OpDecorate, {"OpDecorate", false, false, 0, 0, 0}},
-    {spv::OpMemberDecorate, {"OpMemberDecorate", false, false, 0, 0, 0}},
-    {spv::OpDecorationGroup, {"OpDecorationGroup", false, true, 0, 0, 0}},
-    {spv::OpGroupDecorate, {"OpGroupDecorate", false, false, 0, 0, 0}},
-    {spv::OpGroupMemberDecorate, {"OpGroupMemberDecorate", false, false, 0, 0, 0}},
-    {spv::OpVectorExtractDynamic, {"OpVectorExtractDynamic", true, true, 0, 0, 0}},
-    {spv::OpVectorInsertDynamic, {"OpVectorInsertDynamic", true, true, 0, 0, 0}},
-    {spv::OpVectorShuffle, {"OpVectorShuffle", true, true, 0, 0, 0}},
-    {spv::OpCompositeConstruct, {"OpCompositeConstruct", true, true, 0, 0, 0}},
-    {spv::OpCompositeExtract, {"OpCompositeExtract", true, true, 0, 0, 0}},
-    {spv::OpCompositeInsert, {"OpCompositeInsert", true, true, 0, 0, 0}},
-    {spv::OpCopyObject, {"OpCopyObject", true, true, 0, 0, 0}},
-    {spv::OpTranspose, {"OpTranspose", true, true, 0, 0, 0}},
-    {spv::OpSampledImage, {"OpSampledImage", true, true, 0, 0, 0}},
-    {spv::OpImageSampleImplicitLod, {"OpImageSampleImplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSampleExplicitLod, {"OpImageSampleExplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSampleDrefImplicitLod, {"OpImageSampleDrefImplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSampleDrefExplicitLod, {"OpImageSampleDrefExplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSampleProjImplicitLod, {"OpImageSampleProjImplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSampleProjExplicitLod, {"OpImageSampleProjExplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSampleProjDrefImplicitLod, {"OpImageSampleProjDrefImplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSampleProjDrefExplicitLod, {"OpImageSampleProjDrefExplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageFetch, {"OpImageFetch", true, true, 0, 0, 5}},
-    {spv::OpImageGather, {"OpImageGather", true, true, 0, 0, 6}},
-    {spv::OpImageDrefGather, {"OpImageDrefGather", true, true, 0, 0, 6}},
-    {spv::OpImageRead, {"OpImageRead", true, true, 0, 0, 5}},
-    {spv::OpImageWrite, {"OpImageWrite", false, false, 0, 0, 4}},
-    {spv::OpImage, {"OpImage", true, true, 0, 0, 0}},
-    {spv::OpImageQuerySizeLod, {"OpImageQuerySizeLod", true, true, 0, 0, 0}},
-    {spv::OpImageQuerySize, {"OpImageQuerySize", true, true, 0, 0, 0}},
-    {spv::OpImageQueryLod, {"OpImageQueryLod", true, true, 0, 0, 0}},
-    {spv::OpImageQueryLevels, {"OpImageQueryLevels", true, true, 0, 0, 0}},
-    {spv::OpImageQuerySamples, {"OpImageQuerySamples", true, true, 0, 0, 0}},
-    {spv::OpConvertFToU, {"OpConvertFToU", true, true, 0, 0, 0}},
-    {spv::OpConvertFToS, {"OpConvertFToS", true, true, 0, 0, 0}},
-    {spv::OpConvertSToF, {"OpConvertSToF", true, true, 0, 0, 0}},
-    {spv::OpConvertUToF, {"OpConvertUToF", true, true, 0, 0, 0}},
-    {spv::OpUConvert, {"OpUConvert", true, true, 0, 0, 0}},
-    {spv::OpSConvert, {"OpSConvert", true, true, 0, 0, 0}},
-    {spv::OpFConvert, {"OpFConvert", true, true, 0, 0, 0}},
-    {spv::OpQuantizeToF16, {"OpQuantizeToF16", true, true, 0, 0, 0}},
-    {spv::OpConvertPtrToU, {"OpConvertPtrToU", true, true, 0, 0, 0}},
-    {spv::OpConvertUToPtr, {"OpConvertUToPtr", true, true, 0, 0, 0}},
-    {spv::OpBitcast, {"OpBitcast", true, true, 0, 0, 0}},
-    {spv::OpSNegate, {"OpSNegate", true, true, 0, 0, 0}},
-    {spv::OpFNegate, {"OpFNegate", true, true, 0, 0, 0}},
-    {spv::OpIAdd, {"OpIAdd", true, true, 0, 0, 0}},
-    {spv::OpFAdd, {"OpFAdd", true, true, 0, 0, 0}},
-    {spv::OpISub, {"OpISub", true, true, 0, 0, 0}},
-    {spv::OpFSub, {"OpFSub", true, true, 0, 0, 0}},
-    {spv::OpIMul, {"OpIMul", true, true, 0, 0, 0}},
-    {spv::OpFMul, {"OpFMul", true, true, 0, 0, 0}},
-    {spv::OpUDiv, {"OpUDiv", true, true, 0, 0, 0}},
-    {spv::OpSDiv, {"OpSDiv", true, true, 0, 0, 0}},
-    {spv::OpFDiv, {"OpFDiv", true, true, 0, 0, 0}},
-    {spv::OpUMod, {"OpUMod", true, true, 0, 0, 0}},
-    {spv::OpSRem, {"OpSRem", true, true, 0, 0, 0}},
-    {spv::OpSMod, {"OpSMod", true, true, 0, 0, 0}},
-    {spv::OpFRem, {"OpFRem", true, true, 0, 0, 0}},
-    {spv::OpFMod, {"OpFMod", true, true, 0, 0, 0}},
-    {spv::OpVectorTimesScalar, {"OpVectorTimesScalar", true, true, 0, 0, 0}},
-    {spv::OpMatrixTimesScalar, {"OpMatrixTimesScalar", true, true, 0, 0, 0}},
-    {spv::OpVectorTimesMatrix, {"OpVectorTimesMatrix", true, true, 0, 0, 0}},
-    {spv::OpMatrixTimesVector, {"OpMatrixTimesVector", true, true, 0, 0, 0}},
-    {spv::OpMatrixTimesMatrix, {"OpMatrixTimesMatrix", true, true, 0, 0, 0}},
-    {spv::OpOuterProduct, {"OpOuterProduct", true, true, 0, 0, 0}},
-    {spv::OpDot, {"OpDot", true, true, 0, 0, 0}},
-    {spv::OpIAddCarry, {"OpIAddCarry", true, true, 0, 0, 0}},
-    {spv::OpISubBorrow, {"OpISubBorrow", true, true, 0, 0, 0}},
-    {spv::OpUMulExtended, {"OpUMulExtended", true, true, 0, 0, 0}},
-    {spv::OpSMulExtended, {"OpSMulExtended", true, true, 0, 0, 0}},
-    {spv::OpAny, {"OpAny", true, true, 0, 0, 0}},
-    {spv::OpAll, {"OpAll", true, true, 0, 0, 0}},
-    {spv::OpIsNan, {"OpIsNan", true, true, 0, 0, 0}},
-    {spv::OpIsInf, {"OpIsInf", true, true, 0, 0, 0}},
-    {spv::OpLogicalEqual, {"OpLogicalEqual", true, true, 0, 0, 0}},
-    {spv::OpLogicalNotEqual, {"OpLogicalNotEqual", true, true, 0, 0, 0}},
-    {spv::OpLogicalOr, {"OpLogicalOr", true, true, 0, 0, 0}},
-    {spv::OpLogicalAnd, {"OpLogicalAnd", true, true, 0, 0, 0}},
-    {spv::OpLogicalNot, {"OpLogicalNot", true, true, 0, 0, 0}},
-    {spv::OpSelect, {"OpSelect", true, true, 0, 0, 0}},
-    {spv::OpIEqual, {"OpIEqual", true, true, 0, 0, 0}},
-    {spv::OpINotEqual, {"OpINotEqual", true, true, 0, 0, 0}},
-    {spv::OpUGreaterThan, {"OpUGreaterThan", true, true, 0, 0, 0}},
-    {spv::OpSGreaterThan, {"OpSGreaterThan", true, true, 0, 0, 0}},
-    {spv::OpUGreaterThanEqual, {"OpUGreaterThanEqual", true, true, 0, 0, 0}},
-    {spv::OpSGreaterThanEqual, {"OpSGreaterThanEqual", true, true, 0, 0, 0}},
-    {spv::OpULessThan, {"OpULessThan", true, true, 0, 0, 0}},
-    {spv::OpSLessThan, {"OpSLessThan", true, true, 0, 0, 0}},
-    {spv::OpULessThanEqual, {"OpULessThanEqual", true, true, 0, 0, 0}},
-    {spv::OpSLessThanEqual, {"OpSLessThanEqual", true, true, 0, 0, 0}},
-    {spv::OpFOrdEqual, {"OpFOrdEqual", true, true, 0, 0, 0}},
-    {spv::OpFUnordEqual, {"OpFUnordEqual", true, true, 0, 0, 0}},
-    {spv::OpFOrdNotEqual, {"OpFOrdNotEqual", true, true, 0, 0, 0}},
-    {spv::OpFUnordNotEqual, {"OpFUnordNotEqual", true, true, 0, 0, 0}},
-    {spv::OpFOrdLessThan, {"OpFOrdLessThan", true, true, 0, 0, 0}},
-    {spv::OpFUnordLessThan, {"OpFUnordLessThan", true, true, 0, 0, 0}},
-    {spv::OpFOrdGreaterThan, {"OpFOrdGreaterThan", true, true, 0, 0, 0}},
-    {spv::OpFUnordGreaterThan, {"OpFUnordGreaterThan", true, true, 0, 0, 0}},
-    {spv::OpFOrdLessThanEqual, {"OpFOrdLessThanEqual", true, true, 0, 0, 0}},
-    {spv::OpFUnordLessThanEqual, {"OpFUnordLessThanEqual", true, true, 0, 0, 0}},
-    {spv::OpFOrdGreaterThanEqual, {"OpFOrdGreaterThanEqual", true, true, 0, 0, 0}},
-    {spv::OpFUnordGreaterThanEqual, {"OpFUnordGreaterThanEqual", true, true, 0, 0, 0}},
-    {spv::OpShiftRightLogical, {"OpShiftRightLogical", true, true, 0, 0, 0}},
-    {spv::OpShiftRightArithmetic, {"OpShiftRightArithmetic", true, true, 0, 0, 0}},
-    {spv::OpShiftLeftLogical, {"OpShiftLeftLogical", true, true, 0, 0, 0}},
-    {spv::OpBitwiseOr, {"OpBitwiseOr", true, true, 0, 0, 0}},
-    {spv::OpBitwiseXor, {"OpBitwiseXor", true, true, 0, 0, 0}},
-    {spv::OpBitwiseAnd, {"OpBitwiseAnd", true, true, 0, 0, 0}},
-    {spv::OpNot, {"OpNot", true, true, 0, 0, 0}},
-    {spv::OpBitFieldInsert, {"OpBitFieldInsert", true, true, 0, 0, 0}},
-    {spv::OpBitFieldSExtract, {"OpBitFieldSExtract", true, true, 0, 0, 0}},
-    {spv::OpBitFieldUExtract, {"OpBitFieldUExtract", true, true, 0, 0, 0}},
-    {spv::OpBitReverse, {"OpBitReverse", true, true, 0, 0, 0}},
-    {spv::OpBitCount, {"OpBitCount", true, true, 0, 0, 0}},
-    {spv::OpDPdx, {"OpDPdx", true, true, 0, 0, 0}},
-    {spv::OpDPdy, {"OpDPdy", true, true, 0, 0, 0}},
-    {spv::OpFwidth, {"OpFwidth", true, true, 0, 0, 0}},
-    {spv::OpDPdxFine, {"OpDPdxFine", true, true, 0, 0, 0}},
-    {spv::OpDPdyFine, {"OpDPdyFine", true, true, 0, 0, 0}},
-    {spv::OpFwidthFine, {"OpFwidthFine", true, true, 0, 0, 0}},
-    {spv::OpDPdxCoarse, {"OpDPdxCoarse", true, true, 0, 0, 0}},
-    {spv::OpDPdyCoarse, {"OpDPdyCoarse", true, true, 0, 0, 0}},
-    {spv::OpFwidthCoarse, {"OpFwidthCoarse", true, true, 0, 0, 0}},
-    {spv::OpEmitVertex, {"OpEmitVertex", false, false, 0, 0, 0}},
-    {spv::OpEndPrimitive, {"OpEndPrimitive", false, false, 0, 0, 0}},
-    {spv::OpEmitStreamVertex, {"OpEmitStreamVertex", false, false, 0, 0, 0}},
-    {spv::OpEndStreamPrimitive, {"OpEndStreamPrimitive", false, false, 0, 0, 0}},
-    {spv::OpControlBarrier, {"OpControlBarrier", false, false, 2, 1, 0}},
-    {spv::OpMemoryBarrier, {"OpMemoryBarrier", false, false, 1, 0, 0}},
-    {spv::OpAtomicLoad, {"OpAtomicLoad", true, true, 4, 0, 0}},
-    {spv::OpAtomicStore, {"OpAtomicStore", false, false, 2, 0, 0}},
-    {spv::OpAtomicExchange, {"OpAtomicExchange", true, true, 4, 0, 0}},
-    {spv::OpAtomicCompareExchange, {"OpAtomicCompareExchange", true, true, 4, 0, 0}},
-    {spv::OpAtomicIIncrement, {"OpAtomicIIncrement", true, true, 4, 0, 0}},
-    {spv::OpAtomicIDecrement, {"OpAtomicIDecrement", true, true, 4, 0, 0}},
-    {spv::OpAtomicIAdd, {"OpAtomicIAdd", true, true, 4, 0, 0}},
-    {spv::OpAtomicISub, {"OpAtomicISub", true, true, 4, 0, 0}},
-    {spv::OpAtomicSMin, {"OpAtomicSMin", true, true, 4, 0, 0}},
-    {spv::OpAtomicUMin, {"OpAtomicUMin", true, true, 4, 0, 0}},
-    {spv::OpAtomicSMax, {"OpAtomicSMax", true, true, 4, 0, 0}},
-    {spv::OpAtomicUMax, {"OpAtomicUMax", true, true, 4, 0, 0}},
-    {spv::OpAtomicAnd, {"OpAtomicAnd", true, true, 4, 0, 0}},
-    {spv::OpAtomicOr, {"OpAtomicOr", true, true, 4, 0, 0}},
-    {spv::OpAtomicXor, {"OpAtomicXor", true, true, 4, 0, 0}},
-    {spv::OpPhi, {"OpPhi", true, true, 0, 0, 0}},
-    {spv::OpLoopMerge, {"OpLoopMerge", false, false, 0, 0, 0}},
-    {spv::OpSelectionMerge, {"OpSelectionMerge", false, false, 0, 0, 0}},
-    {spv::OpLabel, {"OpLabel", false, true, 0, 0, 0}},
-    {spv::OpBranch, {"OpBranch", false, false, 0, 0, 0}},
-    {spv::OpBranchConditional, {"OpBranchConditional", false, false, 0, 0, 0}},
-    {spv::OpSwitch, {"OpSwitch", false, false, 0, 0, 0}},
-    {spv::OpKill, {"OpKill", false, false, 0, 0, 0}},
-    {spv::OpReturn, {"OpReturn", false, false, 0, 0, 0}},
-    {spv::OpReturnValue, {"OpReturnValue", false, false, 0, 0, 0}},
-    {spv::OpUnreachable, {"OpUnreachable", false, false, 0, 0, 0}},
-    {spv::OpGroupAll, {"OpGroupAll", true, true, 0, 3, 0}},
-    {spv::OpGroupAny, {"OpGroupAny", true, true, 0, 3, 0}},
-    {spv::OpGroupBroadcast, {"OpGroupBroadcast", true, true, 0, 3, 0}},
-    {spv::OpGroupIAdd, {"OpGroupIAdd", true, true, 0, 3, 0}},
-    {spv::OpGroupFAdd, {"OpGroupFAdd", true, true, 0, 3, 0}},
-    {spv::OpGroupFMin, {"OpGroupFMin", true, true, 0, 3, 0}},
-    {spv::OpGroupUMin, {"OpGroupUMin", true, true, 0, 3, 0}},
-    {spv::OpGroupSMin, {"OpGroupSMin", true, true, 0, 3, 0}},
-    {spv::OpGroupFMax, {"OpGroupFMax", true, true, 0, 3, 0}},
-    {spv::OpGroupUMax, {"OpGroupUMax", true, true, 0, 3, 0}},
-    {spv::OpGroupSMax, {"OpGroupSMax", true, true, 0, 3, 0}},
-    {spv::OpImageSparseSampleImplicitLod, {"OpImageSparseSampleImplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSparseSampleExplicitLod, {"OpImageSparseSampleExplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSparseSampleDrefImplicitLod, {"OpImageSparseSampleDrefImplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSparseSampleDrefExplicitLod, {"OpImageSparseSampleDrefExplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSparseSampleProjImplicitLod, {"OpImageSparseSampleProjImplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSparseSampleProjExplicitLod, {"OpImageSparseSampleProjExplicitLod", true, true, 0, 0, 5}},
-    {spv::OpImageSparseSampleProjDrefImplicitLod, {"OpImageSparseSampleProjDrefImplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSparseSampleProjDrefExplicitLod, {"OpImageSparseSampleProjDrefExplicitLod", true, true, 0, 0, 6}},
-    {spv::OpImageSparseFetch, {"OpImageSparseFetch", true, true, 0, 0, 5}},
-    {spv::OpImageSparseGather, {"OpImageSparseGather", true, true, 0, 0, 6}},
-    {spv::OpImageSparseDrefGather, {"OpImageSparseDrefGather", true, true, 0, 0, 6}},
-    {spv::OpImageSparseTexelsResident, {"OpImageSparseTexelsResident", true, true, 0, 0, 0}},
-    {spv::OpNoLine, {"OpNoLine", false, false, 0, 0, 0}},
-    {spv::OpImageSparseRead, {"OpImageSparseRead", true, true, 0, 0, 5}},
-    {spv::OpSizeOf, {"OpSizeOf", true, true, 0, 0, 0}},
-    {spv::OpTypePipeStorage, {"OpTypePipeStorage", false, true, 0, 0, 0}},
-    {spv::OpConstantPipeStorage, {"OpConstantPipeStorage", true, true, 0, 0, 0}},
-    {spv::OpCreatePipeFromPipeStorage, {"OpCreatePipeFromPipeStorage", true, true, 0, 0, 0}},
-    {spv::OpGetKernelLocalSizeForSubgroupCount, {"OpGetKernelLocalSizeForSubgroupCount", true, true, 0, 0, 0}},
-    {spv::OpGetKernelMaxNumSubgroups, {"OpGetKernelMaxNumSubgroups", true, true, 0, 0, 0}},
-    {spv::OpModuleProcessed, {"OpModuleProcessed", false, false, 0, 0, 0}},
-    {spv::OpExecutionModeId, {"OpExecutionModeId", false, false, 0, 0, 0}},
-    {spv::OpDecorateId, {"OpDecorateId", false, false, 0, 0, 0}},
-    {spv::OpGroupNonUniformElect, {"OpGroupNonUniformElect", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformAll, {"OpGroupNonUniformAll", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformAny, {"OpGroupNonUniformAny", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformAllEqual, {"OpGroupNonUniformAllEqual", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBroadcast, {"OpGroupNonUniformBroadcast", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBroadcastFirst, {"OpGroupNonUniformBroadcastFirst", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBallot, {"OpGroupNonUniformBallot", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformInverseBallot, {"OpGroupNonUniformInverseBallot", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBallotBitExtract, {"OpGroupNonUniformBallotBitExtract", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBallotBitCount, {"OpGroupNonUniformBallotBitCount", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBallotFindLSB, {"OpGroupNonUniformBallotFindLSB", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBallotFindMSB, {"OpGroupNonUniformBallotFindMSB", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformShuffle, {"OpGroupNonUniformShuffle", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformShuffleXor, {"OpGroupNonUniformShuffleXor", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformShuffleUp, {"OpGroupNonUniformShuffleUp", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformShuffleDown, {"OpGroupNonUniformShuffleDown", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformIAdd, {"OpGroupNonUniformIAdd", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformFAdd, {"OpGroupNonUniformFAdd", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformIMul, {"OpGroupNonUniformIMul", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformFMul, {"OpGroupNonUniformFMul", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformSMin, {"OpGroupNonUniformSMin", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformUMin, {"OpGroupNonUniformUMin", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformFMin, {"OpGroupNonUniformFMin", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformSMax, {"OpGroupNonUniformSMax", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformUMax, {"OpGroupNonUniformUMax", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformFMax, {"OpGroupNonUniformFMax", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBitwiseAnd, {"OpGroupNonUniformBitwiseAnd", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBitwiseOr, {"OpGroupNonUniformBitwiseOr", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformBitwiseXor, {"OpGroupNonUniformBitwiseXor", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformLogicalAnd, {"OpGroupNonUniformLogicalAnd", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformLogicalOr, {"OpGroupNonUniformLogicalOr", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformLogicalXor, {"OpGroupNonUniformLogicalXor", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformQuadBroadcast, {"OpGroupNonUniformQuadBroadcast", true, true, 0, 3, 0}},
-    {spv::OpGroupNonUniformQuadSwap, {"OpGroupNonUniformQuadSwap", true, true, 0, 3, 0}},
-    {spv::OpCopyLogical, {"OpCopyLogical", true, true, 0, 0, 0}},
-    {spv::OpPtrEqual, {"OpPtrEqual", true, true, 0, 0, 0}},
-    {spv::OpPtrNotEqual, {"OpPtrNotEqual", true, true, 0, 0, 0}},
-    {spv::OpPtrDiff, {"OpPtrDiff", true, true, 0, 0, 0}},
-    {spv::OpTerminateInvocation, {"OpTerminateInvocation", false, false, 0, 0, 0}},
-    {spv::OpSubgroupBallotKHR, {"OpSubgroupBallotKHR", true, true, 0, 0, 0}},
-    {spv::OpSubgroupFirstInvocationKHR, {"OpSubgroupFirstInvocationKHR", true, true, 0, 0, 0}},
-    {spv::OpSubgroupAllKHR, {"OpSubgroupAllKHR", true, true, 0, 0, 0}},
-    {spv::OpSubgroupAnyKHR, {"OpSubgroupAnyKHR", true, true, 0, 0, 0}},
-    {spv::OpSubgroupAllEqualKHR, {"OpSubgroupAllEqualKHR", true, true, 0, 0, 0}},
-    {spv::OpSubgroupReadInvocationKHR, {"OpSubgroupReadInvocationKHR", true, true, 0, 0, 0}},
-    {spv::OpTraceRayKHR, {"OpTraceRayKHR", false, false, 0, 0, 0}},
-    {spv::OpExecuteCallableKHR, {"OpExecuteCallableKHR", false, false, 0, 0, 0}},
-    {spv::OpConvertUToAccelerationStructureKHR, {"OpConvertUToAccelerationStructureKHR", true, true, 0, 0, 0}},
-    {spv::OpIgnoreIntersectionKHR, {"OpIgnoreIntersectionKHR", false, false, 0, 0, 0}},
-    {spv::OpTerminateRayKHR, {"OpTerminateRayKHR", false, false, 0, 0, 0}},
-    {spv::OpSDotKHR, {"OpSDotKHR", true, true, 0, 0, 0}},
-    {spv::OpUDotKHR, {"OpUDotKHR", true, true, 0, 0, 0}},
-    {spv::OpSUDotKHR, {"OpSUDotKHR", true, true, 0, 0, 0}},
-    {spv::OpSDotAccSatKHR, {"OpSDotAccSatKHR", true, true, 0, 0, 0}},
-    {spv::OpUDotAccSatKHR, {"OpUDotAccSatKHR", true, true, 0, 0, 0}},
-    {spv::OpSUDotAccSatKHR, {"OpSUDotAccSatKHR", true, true, 0, 0, 0}},
-    {spv::OpTypeRayQueryKHR, {"OpTypeRayQueryKHR", false, true, 0, 0, 0}},
-    {spv::OpRayQueryInitializeKHR, {"OpRayQueryInitializeKHR", false, false, 0, 0, 0}},
-    {spv::OpRayQueryTerminateKHR, {"OpRayQueryTerminateKHR", false, false, 0, 0, 0}},
-    {spv::OpRayQueryGenerateIntersectionKHR, {"OpRayQueryGenerateIntersectionKHR", false, false, 0, 0, 0}},
-    {spv::OpRayQueryConfirmIntersectionKHR, {"OpRayQueryConfirmIntersectionKHR", false, false, 0, 0, 0}},
-    {spv::OpRayQueryProceedKHR, {"OpRayQueryProceedKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionTypeKHR, {"OpRayQueryGetIntersectionTypeKHR", true, true, 0, 0, 0}},
-    {spv::OpGroupIAddNonUniformAMD, {"OpGroupIAddNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupFAddNonUniformAMD, {"OpGroupFAddNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupFMinNonUniformAMD, {"OpGroupFMinNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupUMinNonUniformAMD, {"OpGroupUMinNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupSMinNonUniformAMD, {"OpGroupSMinNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupFMaxNonUniformAMD, {"OpGroupFMaxNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupUMaxNonUniformAMD, {"OpGroupUMaxNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpGroupSMaxNonUniformAMD, {"OpGroupSMaxNonUniformAMD", true, true, 0, 3, 0}},
-    {spv::OpFragmentMaskFetchAMD, {"OpFragmentMaskFetchAMD", true, true, 0, 0, 0}},
-    {spv::OpFragmentFetchAMD, {"OpFragmentFetchAMD", true, true, 0, 0, 0}},
-    {spv::OpReadClockKHR, {"OpReadClockKHR", true, true, 0, 3, 0}},
-    {spv::OpImageSampleFootprintNV, {"OpImageSampleFootprintNV", true, true, 0, 0, 7}},
-    {spv::OpGroupNonUniformPartitionNV, {"OpGroupNonUniformPartitionNV", true, true, 0, 0, 0}},
-    {spv::OpWritePackedPrimitiveIndices4x8NV, {"OpWritePackedPrimitiveIndices4x8NV", false, false, 0, 0, 0}},
-    {spv::OpReportIntersectionKHR, {"OpReportIntersectionKHR", true, true, 0, 0, 0}},
-    {spv::OpIgnoreIntersectionNV, {"OpIgnoreIntersectionNV", false, false, 0, 0, 0}},
-    {spv::OpTerminateRayNV, {"OpTerminateRayNV", false, false, 0, 0, 0}},
-    {spv::OpTraceNV, {"OpTraceNV", false, false, 0, 0, 0}},
-    {spv::OpTraceMotionNV, {"OpTraceMotionNV", false, false, 0, 0, 0}},
-    {spv::OpTraceRayMotionNV, {"OpTraceRayMotionNV", false, false, 0, 0, 0}},
-    {spv::OpTypeAccelerationStructureKHR, {"OpTypeAccelerationStructureKHR", false, true, 0, 0, 0}},
-    {spv::OpExecuteCallableNV, {"OpExecuteCallableNV", false, false, 0, 0, 0}},
-    {spv::OpTypeCooperativeMatrixNV, {"OpTypeCooperativeMatrixNV", false, true, 0, 3, 0}},
-    {spv::OpCooperativeMatrixLoadNV, {"OpCooperativeMatrixLoadNV", true, true, 0, 0, 0}},
-    {spv::OpCooperativeMatrixStoreNV, {"OpCooperativeMatrixStoreNV", false, false, 0, 0, 0}},
-    {spv::OpCooperativeMatrixMulAddNV, {"OpCooperativeMatrixMulAddNV", true, true, 0, 0, 0}},
-    {spv::OpCooperativeMatrixLengthNV, {"OpCooperativeMatrixLengthNV", true, true, 0, 0, 0}},
-    {spv::OpBeginInvocationInterlockEXT, {"OpBeginInvocationInterlockEXT", false, false, 0, 0, 0}},
-    {spv::OpEndInvocationInterlockEXT, {"OpEndInvocationInterlockEXT", false, false, 0, 0, 0}},
-    {spv::OpDemoteToHelperInvocationEXT, {"OpDemoteToHelperInvocationEXT", false, false, 0, 0, 0}},
-    {spv::OpIsHelperInvocationEXT, {"OpIsHelperInvocationEXT", true, true, 0, 0, 0}},
-    {spv::OpConvertUToImageNV, {"OpConvertUToImageNV", true, true, 0, 0, 0}},
-    {spv::OpConvertUToSamplerNV, {"OpConvertUToSamplerNV", true, true, 0, 0, 0}},
-    {spv::OpConvertImageToUNV, {"OpConvertImageToUNV", true, true, 0, 0, 0}},
-    {spv::OpConvertSamplerToUNV, {"OpConvertSamplerToUNV", true, true, 0, 0, 0}},
-    {spv::OpConvertUToSampledImageNV, {"OpConvertUToSampledImageNV", true, true, 0, 0, 0}},
-    {spv::OpConvertSampledImageToUNV, {"OpConvertSampledImageToUNV", true, true, 0, 0, 0}},
-    {spv::OpSamplerImageAddressingModeNV, {"OpSamplerImageAddressingModeNV", false, false, 0, 0, 0}},
-    {spv::OpSubgroupShuffleINTEL, {"OpSubgroupShuffleINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupShuffleDownINTEL, {"OpSubgroupShuffleDownINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupShuffleUpINTEL, {"OpSubgroupShuffleUpINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupShuffleXorINTEL, {"OpSubgroupShuffleXorINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupBlockReadINTEL, {"OpSubgroupBlockReadINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupBlockWriteINTEL, {"OpSubgroupBlockWriteINTEL", false, false, 0, 0, 0}},
-    {spv::OpSubgroupImageBlockReadINTEL, {"OpSubgroupImageBlockReadINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupImageBlockWriteINTEL, {"OpSubgroupImageBlockWriteINTEL", false, false, 0, 0, 0}},
-    {spv::OpSubgroupImageMediaBlockReadINTEL, {"OpSubgroupImageMediaBlockReadINTEL", true, true, 0, 0, 0}},
-    {spv::OpSubgroupImageMediaBlockWriteINTEL, {"OpSubgroupImageMediaBlockWriteINTEL", false, false, 0, 0, 0}},
-    {spv::OpUCountLeadingZerosINTEL, {"OpUCountLeadingZerosINTEL", true, true, 0, 0, 0}},
-    {spv::OpUCountTrailingZerosINTEL, {"OpUCountTrailingZerosINTEL", true, true, 0, 0, 0}},
-    {spv::OpAbsISubINTEL, {"OpAbsISubINTEL", true, true, 0, 0, 0}},
-    {spv::OpAbsUSubINTEL, {"OpAbsUSubINTEL", true, true, 0, 0, 0}},
-    {spv::OpIAddSatINTEL, {"OpIAddSatINTEL", true, true, 0, 0, 0}},
-    {spv::OpUAddSatINTEL, {"OpUAddSatINTEL", true, true, 0, 0, 0}},
-    {spv::OpIAverageINTEL, {"OpIAverageINTEL", true, true, 0, 0, 0}},
-    {spv::OpUAverageINTEL, {"OpUAverageINTEL", true, true, 0, 0, 0}},
-    {spv::OpIAverageRoundedINTEL, {"OpIAverageRoundedINTEL", true, true, 0, 0, 0}},
-    {spv::OpUAverageRoundedINTEL, {"OpUAverageRoundedINTEL", true, true, 0, 0, 0}},
-    {spv::OpISubSatINTEL, {"OpISubSatINTEL", true, true, 0, 0, 0}},
-    {spv::OpUSubSatINTEL, {"OpUSubSatINTEL", true, true, 0, 0, 0}},
-    {spv::OpIMul32x16INTEL, {"OpIMul32x16INTEL", true, true, 0, 0, 0}},
-    {spv::OpUMul32x16INTEL, {"OpUMul32x16INTEL", true, true, 0, 0, 0}},
-    {spv::OpConstantFunctionPointerINTEL, {"OpConstantFunctionPointerINTEL", true, true, 0, 0, 0}},
-    {spv::OpFunctionPointerCallINTEL, {"OpFunctionPointerCallINTEL", true, true, 0, 0, 0}},
-    {spv::OpAsmTargetINTEL, {"OpAsmTargetINTEL", true, true, 0, 0, 0}},
-    {spv::OpAsmINTEL, {"OpAsmINTEL", true, true, 0, 0, 0}},
-    {spv::OpAsmCallINTEL, {"OpAsmCallINTEL", true, true, 0, 0, 0}},
-    {spv::OpAtomicFMinEXT, {"OpAtomicFMinEXT", true, true, 4, 0, 0}},
-    {spv::OpAtomicFMaxEXT, {"OpAtomicFMaxEXT", true, true, 4, 0, 0}},
-    {spv::OpAssumeTrueKHR, {"OpAssumeTrueKHR", false, false, 0, 0, 0}},
-    {spv::OpExpectKHR, {"OpExpectKHR", true, true, 0, 0, 0}},
-    {spv::OpDecorateStringGOOGLE, {"OpDecorateStringGOOGLE", false, false, 0, 0, 0}},
-    {spv::OpMemberDecorateStringGOOGLE, {"OpMemberDecorateStringGOOGLE", false, false, 0, 0, 0}},
-    {spv::OpVariableLengthArrayINTEL, {"OpVariableLengthArrayINTEL", true, true, 0, 0, 0}},
-    {spv::OpSaveMemoryINTEL, {"OpSaveMemoryINTEL", true, true, 0, 0, 0}},
-    {spv::OpRestoreMemoryINTEL, {"OpRestoreMemoryINTEL", false, false, 0, 0, 0}},
-    {spv::OpLoopControlINTEL, {"OpLoopControlINTEL", false, false, 0, 0, 0}},
-    {spv::OpAliasDomainDeclINTEL, {"OpAliasDomainDeclINTEL", false, true, 0, 0, 0}},
-    {spv::OpAliasScopeDeclINTEL, {"OpAliasScopeDeclINTEL", false, true, 0, 0, 0}},
-    {spv::OpAliasScopeListDeclINTEL, {"OpAliasScopeListDeclINTEL", false, true, 0, 0, 0}},
-    {spv::OpPtrCastToCrossWorkgroupINTEL, {"OpPtrCastToCrossWorkgroupINTEL", true, true, 0, 0, 0}},
-    {spv::OpCrossWorkgroupCastToPtrINTEL, {"OpCrossWorkgroupCastToPtrINTEL", true, true, 0, 0, 0}},
-    {spv::OpReadPipeBlockingINTEL, {"OpReadPipeBlockingINTEL", true, true, 0, 0, 0}},
-    {spv::OpWritePipeBlockingINTEL, {"OpWritePipeBlockingINTEL", true, true, 0, 0, 0}},
-    {spv::OpFPGARegINTEL, {"OpFPGARegINTEL", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetRayTMinKHR, {"OpRayQueryGetRayTMinKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetRayFlagsKHR, {"OpRayQueryGetRayFlagsKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionTKHR, {"OpRayQueryGetIntersectionTKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR, {"OpRayQueryGetIntersectionInstanceCustomIndexKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionInstanceIdKHR, {"OpRayQueryGetIntersectionInstanceIdKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR, {"OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionGeometryIndexKHR, {"OpRayQueryGetIntersectionGeometryIndexKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionPrimitiveIndexKHR, {"OpRayQueryGetIntersectionPrimitiveIndexKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionBarycentricsKHR, {"OpRayQueryGetIntersectionBarycentricsKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionFrontFaceKHR, {"OpRayQueryGetIntersectionFrontFaceKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR, {"OpRayQueryGetIntersectionCandidateAABBOpaqueKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionObjectRayDirectionKHR, {"OpRayQueryGetIntersectionObjectRayDirectionKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionObjectRayOriginKHR, {"OpRayQueryGetIntersectionObjectRayOriginKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetWorldRayDirectionKHR, {"OpRayQueryGetWorldRayDirectionKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetWorldRayOriginKHR, {"OpRayQueryGetWorldRayOriginKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionObjectToWorldKHR, {"OpRayQueryGetIntersectionObjectToWorldKHR", true, true, 0, 0, 0}},
-    {spv::OpRayQueryGetIntersectionWorldToObjectKHR, {"OpRayQueryGetIntersectionWorldToObjectKHR", true, true, 0, 0, 0}},
-    {spv::OpAtomicFAddEXT, {"OpAtomicFAddEXT", true, true, 4, 0, 0}},
-    {spv::OpTypeBufferSurfaceINTEL, {"OpTypeBufferSurfaceINTEL", false, true, 0, 0, 0}},
-    {spv::OpTypeStructContinuedINTEL, {"OpTypeStructContinuedINTEL", false, false, 0, 0, 0}},
-    {spv::OpConstantCompositeContinuedINTEL, {"OpConstantCompositeContinuedINTEL", false, false, 0, 0, 0}},
-    {spv::OpSpecConstantCompositeContinuedINTEL, {"OpSpecConstantCompositeContinuedINTEL", false, false, 0, 0, 0}},
-    {spv::OpControlBarrierArriveINTEL, {"OpControlBarrierArriveINTEL", false, false, 2, 1, 0}},
-    {spv::OpControlBarrierWaitINTEL, {"OpControlBarrierWaitINTEL", false, false, 2, 1, 0}},
-    {spv::OpGroupIMulKHR, {"OpGroupIMulKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupFMulKHR, {"OpGroupFMulKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupBitwiseAndKHR, {"OpGroupBitwiseAndKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupBitwiseOrKHR, {"OpGroupBitwiseOrKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupBitwiseXorKHR, {"OpGroupBitwiseXorKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupLogicalAndKHR, {"OpGroupLogicalAndKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupLogicalOrKHR, {"OpGroupLogicalOrKHR", true, true, 0, 3, 0}},
-    {spv::OpGroupLogicalXorKHR, {"OpGroupLogicalXorKHR", true, true, 0, 3, 0}},
+static constexpr InstructionInfo kInstructionTable[] = {
+    {"Unhandled Opcode", false, false, 0, 0, 0},
+    {"OpNop", false, false, 0, 0, 0},
+    {"OpUndef", true, true, 0, 0, 0},
+    {"OpSourceContinued", false, false, 0, 0, 0},
+    {"OpSource", false, false, 0, 0, 0},
+    {"OpSourceExtension", false, false, 0, 0, 0},
+    {"OpName", false, false, 0, 0, 0},
+    {"OpMemberName", false, false, 0, 0, 0},
+    {"OpString", false, true, 0, 0, 0},
+    {"OpLine", false, false, 0, 0, 0},
+    {"OpExtension", false, false, 0, 0, 0},
+    {"OpExtInstImport", false, true, 0, 0, 0},
+    {"OpExtInst", true, true, 0, 0, 0},
+    {"OpMemoryModel", false, false, 0, 0, 0},
+    {"OpEntryPoint", false, false, 0, 0, 0},
+    {"OpExecutionMode", false, false, 0, 0, 0},
+    {"OpCapability", false, false, 0, 0, 0},
+    {"OpTypeVoid", false, true, 0, 0, 0},
+    {"OpTypeBool", false, true, 0, 0, 0},
+    {"OpTypeInt", false, true, 0, 0, 0},
+    {"OpTypeFloat", false, true, 0, 0, 0},
+    {"OpTypeVector", false, true, 0, 0, 0},
+    {"OpTypeMatrix", false, true, 0, 0, 0},
+    {"OpTypeImage", false, true, 0, 0, 0},
+    {"OpTypeSampler", false, true, 0, 0, 0},
+    {"OpTypeSampledImage", false, true, 0, 0, 0},
+    {"OpTypeArray", false, true, 0, 0, 0},
+    {"OpTypeRuntimeArray", false, true, 0, 0, 0},
+    {"OpTypeStruct", false, true, 0, 0, 0},
+    {"OpTypePointer", false, true, 0, 0, 0},
+    {"OpTypeFunction", false, true, 0, 0, 0},
+    {"OpTypeForwardPointer", false, false, 0, 0, 0},
+    {"OpConstantTrue", true, true, 0, 0, 0},
+    {"OpConstantFalse", true, true, 0, 0, 0},
+    {"OpConstant", true, true, 0, 0, 0},
+    {"OpConstantComposite", true, true, 0, 0, 0},
+    {"OpConstantNull", true, true, 0, 0, 0},
+    {"OpSpecConstantTrue", true, true, 0, 0, 0},
+    {"OpSpecConstantFalse", true, true, 0, 0, 0},
+    {"OpSpecConstant", true, true, 0, 0, 0},
+    {"OpSpecConstantComposite", true, true, 0, 0, 0},
+    {"OpSpecConstantOp", true, true, 0, 0, 0},
+    {"OpFunction", true, true, 0, 0, 0},
+    {"OpFunctionParameter", true, true, 0, 0, 0},
+    {"OpFunctionEnd", false, false, 0, 0, 0},
+    {"OpFunctionCall", true, true, 0, 0, 0},
+    {"OpVariable", true, true, 0, 0, 0},
+    {"OpImageTexelPointer", true, true, 0, 0, 0},
+    {"OpLoad", true, true, 0, 0, 0},
+    {"OpStore", false, false, 0, 0, 0},
+    {"OpCopyMemory", false, false, 0, 0, 0},
+    {"OpCopyMemorySized", false, false, 0, 0, 0},
+    {"OpAccessChain", true, true, 0, 0, 0},
+    {"OpInBoundsAccessChain", true, true, 0, 0, 0},
+    {"OpPtrAccessChain", true, true, 0, 0, 0},
+    {"OpArrayLength", true, true, 0, 0, 0},
+    {"OpInBoundsPtrAccessChain", true, true, 0, 0, 0},
+    {"OpDecorate", false, false, 0, 0, 0},
+    {"OpMemberDecorate", false, false, 0, 0, 0},
+    {"OpDecorationGroup", false, true, 0, 0, 0},
+    {"OpGroupDecorate", false, false, 0, 0, 0},
+    {"OpGroupMemberDecorate", false, false, 0, 0, 0},
+    {"OpVectorExtractDynamic", true, true, 0, 0, 0},
+    {"OpVectorInsertDynamic", true, true, 0, 0, 0},
+    {"OpVectorShuffle", true, true, 0, 0, 0},
+    {"OpCompositeConstruct", true, true, 0, 0, 0},
+    {"OpCompositeExtract", true, true, 0, 0, 0},
+    {"OpCompositeInsert", true, true, 0, 0, 0},
+    {"OpCopyObject", true, true, 0, 0, 0},
+    {"OpTranspose", true, true, 0, 0, 0},
+    {"OpSampledImage", true, true, 0, 0, 0},
+    {"OpImageSampleImplicitLod", true, true, 0, 0, 5},
+    {"OpImageSampleExplicitLod", true, true, 0, 0, 5},
+    {"OpImageSampleDrefImplicitLod", true, true, 0, 0, 6},
+    {"OpImageSampleDrefExplicitLod", true, true, 0, 0, 6},
+    {"OpImageSampleProjImplicitLod", true, true, 0, 0, 5},
+    {"OpImageSampleProjExplicitLod", true, true, 0, 0, 5},
+    {"OpImageSampleProjDrefImplicitLod", true, true, 0, 0, 6},
+    {"OpImageSampleProjDrefExplicitLod", true, true, 0, 0, 6},
+    {"OpImageFetch", true, true, 0, 0, 5},
+    {"OpImageGather", true, true, 0, 0, 6},
+    {"OpImageDrefGather", true, true, 0, 0, 6},
+    {"OpImageRead", true, true, 0, 0, 5},
+    {"OpImageWrite", false, false, 0, 0, 4},
+    {"OpImage", true, true, 0, 0, 0},
+    {"OpImageQuerySizeLod", true, true, 0, 0, 0},
+    {"OpImageQuerySize", true, true, 0, 0, 0},
+    {"OpImageQueryLod", true, true, 0, 0, 0},
+    {"OpImageQueryLevels", true, true, 0, 0, 0},
+    {"OpImageQuerySamples", true, true, 0, 0, 0},
+    {"OpConvertFToU", true, true, 0, 0, 0},
+    {"OpConvertFToS", true, true, 0, 0, 0},
+    {"OpConvertSToF", true, true, 0, 0, 0},
+    {"OpConvertUToF", true, true, 0, 0, 0},
+    {"OpUConvert", true, true, 0, 0, 0},
+    {"OpSConvert", true, true, 0, 0, 0},
+    {"OpFConvert", true, true, 0, 0, 0},
+    {"OpQuantizeToF16", true, true, 0, 0, 0},
+    {"OpConvertPtrToU", true, true, 0, 0, 0},
+    {"OpConvertUToPtr", true, true, 0, 0, 0},
+    {"OpBitcast", true, true, 0, 0, 0},
+    {"OpSNegate", true, true, 0, 0, 0},
+    {"OpFNegate", true, true, 0, 0, 0},
+    {"OpIAdd", true, true, 0, 0, 0},
+    {"OpFAdd", true, true, 0, 0, 0},
+    {"OpISub", true, true, 0, 0, 0},
+    {"OpFSub", true, true, 0, 0, 0},
+    {"OpIMul", true, true, 0, 0, 0},
+    {"OpFMul", true, true, 0, 0, 0},
+    {"OpUDiv", true, true, 0, 0, 0},
+    {"OpSDiv", true, true, 0, 0, 0},
+    {"OpFDiv", true, true, 0, 0, 0},
+    {"OpUMod", true, true, 0, 0, 0},
+    {"OpSRem", true, true, 0, 0, 0},
+    {"OpSMod", true, true, 0, 0, 0},
+    {"OpFRem", true, true, 0, 0, 0},
+    {"OpFMod", true, true, 0, 0, 0},
+    {"OpVectorTimesScalar", true, true, 0, 0, 0},
+    {"OpMatrixTimesScalar", true, true, 0, 0, 0},
+    {"OpVectorTimesMatrix", true, true, 0, 0, 0},
+    {"OpMatrixTimesVector", true, true, 0, 0, 0},
+    {"OpMatrixTimesMatrix", true, true, 0, 0, 0},
+    {"OpOuterProduct", true, true, 0, 0, 0},
+    {"OpDot", true, true, 0, 0, 0},
+    {"OpIAddCarry", true, true, 0, 0, 0},
+    {"OpISubBorrow", true, true, 0, 0, 0},
+    {"OpUMulExtended", true, true, 0, 0, 0},
+    {"OpSMulExtended", true, true, 0, 0, 0},
+    {"OpAny", true, true, 0, 0, 0},
+    {"OpAll", true, true, 0, 0, 0},
+    {"OpIsNan", true, true, 0, 0, 0},
+    {"OpIsInf", true, true, 0, 0, 0},
+    {"OpLogicalEqual", true, true, 0, 0, 0},
+    {"OpLogicalNotEqual", true, true, 0, 0, 0},
+    {"OpLogicalOr", true, true, 0, 0, 0},
+    {"OpLogicalAnd", true, true, 0, 0, 0},
+    {"OpLogicalNot", true, true, 0, 0, 0},
+    {"OpSelect", true, true, 0, 0, 0},
+    {"OpIEqual", true, true, 0, 0, 0},
+    {"OpINotEqual", true, true, 0, 0, 0},
+    {"OpUGreaterThan", true, true, 0, 0, 0},
+    {"OpSGreaterThan", true, true, 0, 0, 0},
+    {"OpUGreaterThanEqual", true, true, 0, 0, 0},
+    {"OpSGreaterThanEqual", true, true, 0, 0, 0},
+    {"OpULessThan", true, true, 0, 0, 0},
+    {"OpSLessThan", true, true, 0, 0, 0},
+    {"OpULessThanEqual", true, true, 0, 0, 0},
+    {"OpSLessThanEqual", true, true, 0, 0, 0},
+    {"OpFOrdEqual", true, true, 0, 0, 0},
+    {"OpFUnordEqual", true, true, 0, 0, 0},
+    {"OpFOrdNotEqual", true, true, 0, 0, 0},
+    {"OpFUnordNotEqual", true, true, 0, 0, 0},
+    {"OpFOrdLessThan", true, true, 0, 0, 0},
+    {"OpFUnordLessThan", true, true, 0, 0, 0},
+    {"OpFOrdGreaterThan", true, true, 0, 0, 0},
+    {"OpFUnordGreaterThan", true, true, 0, 0, 0},
+    {"OpFOrdLessThanEqual", true, true, 0, 0, 0},
+    {"OpFUnordLessThanEqual", true, true, 0, 0, 0},
+    {"OpFOrdGreaterThanEqual", true, true, 0, 0, 0},
+    {"OpFUnordGreaterThanEqual", true, true, 0, 0, 0},
+    {"OpShiftRightLogical", true, true, 0, 0, 0},
+    {"OpShiftRightArithmetic", true, true, 0, 0, 0},
+    {"OpShiftLeftLogical", true, true, 0, 0, 0},
+    {"OpBitwiseOr", true, true, 0, 0, 0},
+    {"OpBitwiseXor", true, true, 0, 0, 0},
+    {"OpBitwiseAnd", true, true, 0, 0, 0},
+    {"OpNot", true, true, 0, 0, 0},
+    {"OpBitFieldInsert", true, true, 0, 0, 0},
+    {"OpBitFieldSExtract", true, true, 0, 0, 0},
+    {"OpBitFieldUExtract", true, true, 0, 0, 0},
+    {"OpBitReverse", true, true, 0, 0, 0},
+    {"OpBitCount", true, true, 0, 0, 0},
+    {"OpDPdx", true, true, 0, 0, 0},
+    {"OpDPdy", true, true, 0, 0, 0},
+    {"OpFwidth", true, true, 0, 0, 0},
+    {"OpDPdxFine", true, true, 0, 0, 0},
+    {"OpDPdyFine", true, true, 0, 0, 0},
+    {"OpFwidthFine", true, true, 0, 0, 0},
+    {"OpDPdxCoarse", true, true, 0, 0, 0},
+    {"OpDPdyCoarse", true, true, 0, 0, 0},
+    {"OpFwidthCoarse", true, true, 0, 0, 0},
+    {"OpEmitVertex", false, false, 0, 0, 0},
+    {"OpEndPrimitive", false, false, 0, 0, 0},
+    {"OpEmitStreamVertex", false, false, 0, 0, 0},
+    {"OpEndStreamPrimitive", false, false, 0, 0, 0},
+    {"OpControlBarrier", false, false, 2, 1, 0},
+    {"OpMemoryBarrier", false, false, 1, 0, 0},
+    {"OpAtomicLoad", true, true, 4, 0, 0},
+    {"OpAtomicStore", false, false, 2, 0, 0},
+    {"OpAtomicExchange", true, true, 4, 0, 0},
+    {"OpAtomicCompareExchange", true, true, 4, 0, 0},
+    {"OpAtomicIIncrement", true, true, 4, 0, 0},
+    {"OpAtomicIDecrement", true, true, 4, 0, 0},
+    {"OpAtomicIAdd", true, true, 4, 0, 0},
+    {"OpAtomicISub", true, true, 4, 0, 0},
+    {"OpAtomicSMin", true, true, 4, 0, 0},
+    {"OpAtomicUMin", true, true, 4, 0, 0},
+    {"OpAtomicSMax", true, true, 4, 0, 0},
+    {"OpAtomicUMax", true, true, 4, 0, 0},
+    {"OpAtomicAnd", true, true, 4, 0, 0},
+    {"OpAtomicOr", true, true, 4, 0, 0},
+    {"OpAtomicXor", true, true, 4, 0, 0},
+    {"OpPhi", true, true, 0, 0, 0},
+    {"OpLoopMerge", false, false, 0, 0, 0},
+    {"OpSelectionMerge", false, false, 0, 0, 0},
+    {"OpLabel", false, true, 0, 0, 0},
+    {"OpBranch", false, false, 0, 0, 0},
+    {"OpBranchConditional", false, false, 0, 0, 0},
+    {"OpSwitch", false, false, 0, 0, 0},
+    {"OpKill", false, false, 0, 0, 0},
+    {"OpReturn", false, false, 0, 0, 0},
+    {"OpReturnValue", false, false, 0, 0, 0},
+    {"OpUnreachable", false, false, 0, 0, 0},
+    {"OpGroupAll", true, true, 0, 3, 0},
+    {"OpGroupAny", true, true, 0, 3, 0},
+    {"OpGroupBroadcast", true, true, 0, 3, 0},
+    {"OpGroupIAdd", true, true, 0, 3, 0},
+    {"OpGroupFAdd", true, true, 0, 3, 0},
+    {"OpGroupFMin", true, true, 0, 3, 0},
+    {"OpGroupUMin", true, true, 0, 3, 0},
+    {"OpGroupSMin", true, true, 0, 3, 0},
+    {"OpGroupFMax", true, true, 0, 3, 0},
+    {"OpGroupUMax", true, true, 0, 3, 0},
+    {"OpGroupSMax", true, true, 0, 3, 0},
+    {"OpImageSparseSampleImplicitLod", true, true, 0, 0, 5},
+    {"OpImageSparseSampleExplicitLod", true, true, 0, 0, 5},
+    {"OpImageSparseSampleDrefImplicitLod", true, true, 0, 0, 6},
+    {"OpImageSparseSampleDrefExplicitLod", true, true, 0, 0, 6},
+    {"OpImageSparseSampleProjImplicitLod", true, true, 0, 0, 5},
+    {"OpImageSparseSampleProjExplicitLod", true, true, 0, 0, 5},
+    {"OpImageSparseSampleProjDrefImplicitLod", true, true, 0, 0, 6},
+    {"OpImageSparseSampleProjDrefExplicitLod", true, true, 0, 0, 6},
+    {"OpImageSparseFetch", true, true, 0, 0, 5},
+    {"OpImageSparseGather", true, true, 0, 0, 6},
+    {"OpImageSparseDrefGather", true, true, 0, 0, 6},
+    {"OpImageSparseTexelsResident", true, true, 0, 0, 0},
+    {"OpNoLine", false, false, 0, 0, 0},
+    {"OpImageSparseRead", true, true, 0, 0, 5},
+    {"OpSizeOf", true, true, 0, 0, 0},
+    {"OpTypePipeStorage", false, true, 0, 0, 0},
+    {"OpConstantPipeStorage", true, true, 0, 0, 0},
+    {"OpCreatePipeFromPipeStorage", true, true, 0, 0, 0},
+    {"OpGetKernelLocalSizeForSubgroupCount", true, true, 0, 0, 0},
+    {"OpGetKernelMaxNumSubgroups", true, true, 0, 0, 0},
+    {"OpModuleProcessed", false, false, 0, 0, 0},
+    {"OpExecutionModeId", false, false, 0, 0, 0},
+    {"OpDecorateId", false, false, 0, 0, 0},
+    {"OpGroupNonUniformElect", true, true, 0, 3, 0},
+    {"OpGroupNonUniformAll", true, true, 0, 3, 0},
+    {"OpGroupNonUniformAny", true, true, 0, 3, 0},
+    {"OpGroupNonUniformAllEqual", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBroadcast", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBroadcastFirst", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBallot", true, true, 0, 3, 0},
+    {"OpGroupNonUniformInverseBallot", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBallotBitExtract", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBallotBitCount", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBallotFindLSB", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBallotFindMSB", true, true, 0, 3, 0},
+    {"OpGroupNonUniformShuffle", true, true, 0, 3, 0},
+    {"OpGroupNonUniformShuffleXor", true, true, 0, 3, 0},
+    {"OpGroupNonUniformShuffleUp", true, true, 0, 3, 0},
+    {"OpGroupNonUniformShuffleDown", true, true, 0, 3, 0},
+    {"OpGroupNonUniformIAdd", true, true, 0, 3, 0},
+    {"OpGroupNonUniformFAdd", true, true, 0, 3, 0},
+    {"OpGroupNonUniformIMul", true, true, 0, 3, 0},
+    {"OpGroupNonUniformFMul", true, true, 0, 3, 0},
+    {"OpGroupNonUniformSMin", true, true, 0, 3, 0},
+    {"OpGroupNonUniformUMin", true, true, 0, 3, 0},
+    {"OpGroupNonUniformFMin", true, true, 0, 3, 0},
+    {"OpGroupNonUniformSMax", true, true, 0, 3, 0},
+    {"OpGroupNonUniformUMax", true, true, 0, 3, 0},
+    {"OpGroupNonUniformFMax", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBitwiseAnd", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBitwiseOr", true, true, 0, 3, 0},
+    {"OpGroupNonUniformBitwiseXor", true, true, 0, 3, 0},
+    {"OpGroupNonUniformLogicalAnd", true, true, 0, 3, 0},
+    {"OpGroupNonUniformLogicalOr", true, true, 0, 3, 0},
+    {"OpGroupNonUniformLogicalXor", true, true, 0, 3, 0},
+    {"OpGroupNonUniformQuadBroadcast", true, true, 0, 3, 0},
+    {"OpGroupNonUniformQuadSwap", true, true, 0, 3, 0},
+    {"OpCopyLogical", true, true, 0, 0, 0},
+    {"OpPtrEqual", true, true, 0, 0, 0},
+    {"OpPtrNotEqual", true, true, 0, 0, 0},
+    {"OpPtrDiff", true, true, 0, 0, 0},
+    {"OpTerminateInvocation", false, false, 0, 0, 0},
+    {"OpSubgroupBallotKHR", true, true, 0, 0, 0},
+    {"OpSubgroupFirstInvocationKHR", true, true, 0, 0, 0},
+    {"OpSubgroupAllKHR", true, true, 0, 0, 0},
+    {"OpSubgroupAnyKHR", true, true, 0, 0, 0},
+    {"OpSubgroupAllEqualKHR", true, true, 0, 0, 0},
+    {"OpSubgroupReadInvocationKHR", true, true, 0, 0, 0},
+    {"OpTraceRayKHR", false, false, 0, 0, 0},
+    {"OpExecuteCallableKHR", false, false, 0, 0, 0},
+    {"OpConvertUToAccelerationStructureKHR", true, true, 0, 0, 0},
+    {"OpIgnoreIntersectionKHR", false, false, 0, 0, 0},
+    {"OpTerminateRayKHR", false, false, 0, 0, 0},
+    {"OpSDotKHR", true, true, 0, 0, 0},
+    {"OpUDotKHR", true, true, 0, 0, 0},
+    {"OpSUDotKHR", true, true, 0, 0, 0},
+    {"OpSDotAccSatKHR", true, true, 0, 0, 0},
+    {"OpUDotAccSatKHR", true, true, 0, 0, 0},
+    {"OpSUDotAccSatKHR", true, true, 0, 0, 0},
+    {"OpTypeRayQueryKHR", false, true, 0, 0, 0},
+    {"OpRayQueryInitializeKHR", false, false, 0, 0, 0},
+    {"OpRayQueryTerminateKHR", false, false, 0, 0, 0},
+    {"OpRayQueryGenerateIntersectionKHR", false, false, 0, 0, 0},
+    {"OpRayQueryConfirmIntersectionKHR", false, false, 0, 0, 0},
+    {"OpRayQueryProceedKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionTypeKHR", true, true, 0, 0, 0},
+    {"OpGroupIAddNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupFAddNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupFMinNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupUMinNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupSMinNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupFMaxNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupUMaxNonUniformAMD", true, true, 0, 3, 0},
+    {"OpGroupSMaxNonUniformAMD", true, true, 0, 3, 0},
+    {"OpFragmentMaskFetchAMD", true, true, 0, 0, 0},
+    {"OpFragmentFetchAMD", true, true, 0, 0, 0},
+    {"OpReadClockKHR", true, true, 0, 3, 0},
+    {"OpImageSampleFootprintNV", true, true, 0, 0, 7},
+    {"OpGroupNonUniformPartitionNV", true, true, 0, 0, 0},
+    {"OpWritePackedPrimitiveIndices4x8NV", false, false, 0, 0, 0},
+    {"OpReportIntersectionKHR", true, true, 0, 0, 0},
+    {"OpIgnoreIntersectionNV", false, false, 0, 0, 0},
+    {"OpTerminateRayNV", false, false, 0, 0, 0},
+    {"OpTraceNV", false, false, 0, 0, 0},
+    {"OpTraceMotionNV", false, false, 0, 0, 0},
+    {"OpTraceRayMotionNV", false, false, 0, 0, 0},
+    {"OpTypeAccelerationStructureKHR", false, true, 0, 0, 0},
+    {"OpExecuteCallableNV", false, false, 0, 0, 0},
+    {"OpTypeCooperativeMatrixNV", false, true, 0, 3, 0},
+    {"OpCooperativeMatrixLoadNV", true, true, 0, 0, 0},
+    {"OpCooperativeMatrixStoreNV", false, false, 0, 0, 0},
+    {"OpCooperativeMatrixMulAddNV", true, true, 0, 0, 0},
+    {"OpCooperativeMatrixLengthNV", true, true, 0, 0, 0},
+    {"OpBeginInvocationInterlockEXT", false, false, 0, 0, 0},
+    {"OpEndInvocationInterlockEXT", false, false, 0, 0, 0},
+    {"OpDemoteToHelperInvocationEXT", false, false, 0, 0, 0},
+    {"OpIsHelperInvocationEXT", true, true, 0, 0, 0},
+    {"OpConvertUToImageNV", true, true, 0, 0, 0},
+    {"OpConvertUToSamplerNV", true, true, 0, 0, 0},
+    {"OpConvertImageToUNV", true, true, 0, 0, 0},
+    {"OpConvertSamplerToUNV", true, true, 0, 0, 0},
+    {"OpConvertUToSampledImageNV", true, true, 0, 0, 0},
+    {"OpConvertSampledImageToUNV", true, true, 0, 0, 0},
+    {"OpSamplerImageAddressingModeNV", false, false, 0, 0, 0},
+    {"OpSubgroupShuffleINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupShuffleDownINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupShuffleUpINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupShuffleXorINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupBlockReadINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupBlockWriteINTEL", false, false, 0, 0, 0},
+    {"OpSubgroupImageBlockReadINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupImageBlockWriteINTEL", false, false, 0, 0, 0},
+    {"OpSubgroupImageMediaBlockReadINTEL", true, true, 0, 0, 0},
+    {"OpSubgroupImageMediaBlockWriteINTEL", false, false, 0, 0, 0},
+    {"OpUCountLeadingZerosINTEL", true, true, 0, 0, 0},
+    {"OpUCountTrailingZerosINTEL", true, true, 0, 0, 0},
+    {"OpAbsISubINTEL", true, true, 0, 0, 0},
+    {"OpAbsUSubINTEL", true, true, 0, 0, 0},
+    {"OpIAddSatINTEL", true, true, 0, 0, 0},
+    {"OpUAddSatINTEL", true, true, 0, 0, 0},
+    {"OpIAverageINTEL", true, true, 0, 0, 0},
+    {"OpUAverageINTEL", true, true, 0, 0, 0},
+    {"OpIAverageRoundedINTEL", true, true, 0, 0, 0},
+    {"OpUAverageRoundedINTEL", true, true, 0, 0, 0},
+    {"OpISubSatINTEL", true, true, 0, 0, 0},
+    {"OpUSubSatINTEL", true, true, 0, 0, 0},
+    {"OpIMul32x16INTEL", true, true, 0, 0, 0},
+    {"OpUMul32x16INTEL", true, true, 0, 0, 0},
+    {"OpConstantFunctionPointerINTEL", true, true, 0, 0, 0},
+    {"OpFunctionPointerCallINTEL", true, true, 0, 0, 0},
+    {"OpAsmTargetINTEL", true, true, 0, 0, 0},
+    {"OpAsmINTEL", true, true, 0, 0, 0},
+    {"OpAsmCallINTEL", true, true, 0, 0, 0},
+    {"OpAtomicFMinEXT", true, true, 4, 0, 0},
+    {"OpAtomicFMaxEXT", true, true, 4, 0, 0},
+    {"OpAssumeTrueKHR", false, false, 0, 0, 0},
+    {"OpExpectKHR", true, true, 0, 0, 0},
+    {"OpDecorateStringGOOGLE", false, false, 0, 0, 0},
+    {"OpMemberDecorateStringGOOGLE", false, false, 0, 0, 0},
+    {"OpVariableLengthArrayINTEL", true, true, 0, 0, 0},
+    {"OpSaveMemoryINTEL", true, true, 0, 0, 0},
+    {"OpRestoreMemoryINTEL", false, false, 0, 0, 0},
+    {"OpLoopControlINTEL", false, false, 0, 0, 0},
+    {"OpAliasDomainDeclINTEL", false, true, 0, 0, 0},
+    {"OpAliasScopeDeclINTEL", false, true, 0, 0, 0},
+    {"OpAliasScopeListDeclINTEL", false, true, 0, 0, 0},
+    {"OpPtrCastToCrossWorkgroupINTEL", true, true, 0, 0, 0},
+    {"OpCrossWorkgroupCastToPtrINTEL", true, true, 0, 0, 0},
+    {"OpReadPipeBlockingINTEL", true, true, 0, 0, 0},
+    {"OpWritePipeBlockingINTEL", true, true, 0, 0, 0},
+    {"OpFPGARegINTEL", true, true, 0, 0, 0},
+    {"OpRayQueryGetRayTMinKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetRayFlagsKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionTKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionInstanceCustomIndexKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionInstanceIdKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionGeometryIndexKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionPrimitiveIndexKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionBarycentricsKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionFrontFaceKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionCandidateAABBOpaqueKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionObjectRayDirectionKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionObjectRayOriginKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetWorldRayDirectionKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetWorldRayOriginKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionObjectToWorldKHR", true, true, 0, 0, 0},
+    {"OpRayQueryGetIntersectionWorldToObjectKHR", true, true, 0, 0, 0},
+    {"OpAtomicFAddEXT", true, true, 4, 0, 0},
+    {"OpTypeBufferSurfaceINTEL", false, true, 0, 0, 0},
+    {"OpTypeStructContinuedINTEL", false, false, 0, 0, 0},
+    {"OpConstantCompositeContinuedINTEL", false, false, 0, 0, 0},
+    {"OpSpecConstantCompositeContinuedINTEL", false, false, 0, 0, 0},
+    {"OpControlBarrierArriveINTEL", false, false, 2, 1, 0},
+    {"OpControlBarrierWaitINTEL", false, false, 2, 1, 0},
+    {"OpGroupIMulKHR", true, true, 0, 3, 0},
+    {"OpGroupFMulKHR", true, true, 0, 3, 0},
+    {"OpGroupBitwiseAndKHR", true, true, 0, 3, 0},
+    {"OpGroupBitwiseOrKHR", true, true, 0, 3, 0},
+    {"OpGroupBitwiseXorKHR", true, true, 0, 3, 0},
+    {"OpGroupLogicalAndKHR", true, true, 0, 3, 0},
+    {"OpGroupLogicalOrKHR", true, true, 0, 3, 0},
+    {"OpGroupLogicalXorKHR", true, true, 0, 3, 0},
 };
+
+// Index of the opcode in kInstructionTable. Outside of the extension ranges the opcodes are dense, so the switch is
+// compiled to a jump table.
+static uint32_t InstructionTableIndex(uint32_t opcode) {
+    switch (opcode) {
+        case spv::OpNop: return 1;
+        case spv::OpUndef: return 2;
+        case spv::OpSourceContinued: return 3;
+        case spv::OpSource: return 4;
+        case spv::OpSourceExtension: return 5;
+        case spv::OpName: return 6;
+        case spv::OpMemberName: return 7;
+        case spv::OpString: return 8;
+        case spv::OpLine: return 9;
+        case spv::OpExtension: return 10;
+        case spv::OpExtInstImport: return 11;
+        case spv::OpExtInst: return 12;
+        case spv::OpMemoryModel: return 13;
+        case spv::OpEntryPoint: return 14;
+        case spv::OpExecutionMode: return 15;
+        case spv::OpCapability: return 16;
+        case spv::OpTypeVoid: return 17;
+        case spv::OpTypeBool: return 18;
+        case spv::OpTypeInt: return 19;
+        case spv::OpTypeFloat: return 20;
+        case spv::OpTypeVector: return 21;
+        case spv::OpTypeMatrix: return 22;
+        case spv::OpTypeImage: return 23;
+        case spv::OpTypeSampler: return 24;
+        case spv::OpTypeSampledImage: return 25;
+        case spv::OpTypeArray: return 26;
+        case spv::OpTypeRuntimeArray: return 27;
+        case spv::OpTypeStruct: return 28;
+        case spv::OpTypePointer: return 29;
+        case spv::OpTypeFunction: return 30;
+        case spv::OpTypeForwardPointer: return 31;
+        case spv::OpConstantTrue: return 32;
+        case spv::OpConstantFalse: return 33;
+        case spv::OpConstant: return 34;
+        case spv::OpConstantComposite: return 35;
+        case spv::OpConstantNull: return 36;
+        case spv::OpSpecConstantTrue: return 37;
+        case spv::OpSpecConstantFalse: return 38;
+        case spv::OpSpecConstant: return 39;
+        case spv::OpSpecConstantComposite: return 40;
+        case spv::OpSpecConstantOp: return 41;
+        case spv::OpFunction: return 42;
+        case spv::OpFunctionParameter: return 43;
+        case spv::OpFunctionEnd: return 44;
+        case spv::OpFunctionCall: return 45;
+        case spv::OpVariable: return 46;
+        case spv::OpImageTexelPointer: return 47;
+        case spv::OpLoad: return 48;
+        case spv::OpStore: return 49;
+        case spv::OpCopyMemory: return 50;
+        case spv::OpCopyMemorySized: return 51;
+        case spv::OpAccessChain: return 52;
+        case spv::OpInBoundsAccessChain: return 53;
+        case spv::OpPtrAccessChain: return 54;
+        case spv::OpArrayLength: return 55;
+        case spv::OpInBoundsPtrAccessChain: return 56;
+        case spv::OpDecorate: return 57;
+        case spv::OpMemberDecorate: return 58;
+        case spv::OpDecorationGroup: return 59;
+        case spv::OpGroupDecorate: return 60;
+        case spv::OpGroupMemberDecorate: return 61;
+        case spv::OpVectorExtractDynamic: return 62;
+        case spv::OpVectorInsertDynamic: return 63;
+        case spv::OpVectorShuffle: return 64;
+        case spv::OpCompositeConstruct: return 65;
+        case spv::OpCompositeExtract: return 66;
+        case spv::OpCompositeInsert: return 67;
+        case spv::OpCopyObject: return 68;
+        case spv::OpTranspose: return 69;
+        case spv::OpSampledImage: return 70;
+        case spv::OpImageSampleImplicitLod: return 71;
+        case spv::OpImageSampleExplicitLod: return 72;
+        case spv::OpImageSampleDrefImplicitLod: return 73;
+        case spv::OpImageSampleDrefExplicitLod: return 74;
+        case spv::OpImageSampleProjImplicitLod: return 75;
+        case spv::OpImageSampleProjExplicitLod: return 76;
+        case spv::OpImageSampleProjDrefImplicitLod: return 77;
+        case spv::OpImageSampleProjDrefExplicitLod: return 78;
+        case spv::OpImageFetch: return 79;
+        case spv::OpImageGather: return 80;
+        case spv::OpImageDrefGather: return 81;
+        case spv::OpImageRead: return 82;
+        case spv::OpImageWrite: return 83;
+        case spv::OpImage: return 84;
+        case spv::OpImageQuerySizeLod: return 85;
+        case spv::OpImageQuerySize: return 86;
+        case spv::OpImageQueryLod: return 87;
+        case spv::OpImageQueryLevels: return 88;
+        case spv::OpImageQuerySamples: return 89;
+        case spv::OpConvertFToU: return 90;
+        case spv::OpConvertFToS: return 91;
+        case spv::OpConvertSToF: return 92;
+        case spv::OpConvertUToF: return 93;
+        case spv::OpUConvert: return 94;
+        case spv::OpSConvert: return 95;
+        case spv::OpFConvert: return 96;
+        case spv::OpQuantizeToF16: return 97;
+        case spv::OpConvertPtrToU: return 98;
+        case spv::OpConvertUToPtr: return 99;
+        case spv::OpBitcast: return 100;
+        case spv::OpSNegate: return 101;
+        case spv::OpFNegate: return 102;
+        case spv::OpIAdd: return 103;
+        case spv::OpFAdd: return 104;
+        case spv::OpISub: return 105;
+        case spv::OpFSub: return 106;
+        case spv::OpIMul: return 107;
+        case spv::OpFMul: return 108;
+        case spv::OpUDiv: return 109;
+        case spv::OpSDiv: return 110;
+        case spv::OpFDiv: return 111;
+        case spv::OpUMod: return 112;
+        case spv::OpSRem: return 113;
+        case spv::OpSMod: return 114;
+        case spv::OpFRem: return 115;
+        case spv::OpFMod: return 116;
+        case spv::OpVectorTimesScalar: return 117;
+        case spv::OpMatrixTimesScalar: return 118;
+        case spv::OpVectorTimesMatrix: return 119;
+        case spv::OpMatrixTimesVector: return 120;
+        case spv::OpMatrixTimesMatrix: return 121;
+        case spv::OpOuterProduct: return 122;
+        case spv::OpDot: return 123;
+        case spv::OpIAddCarry: return 124;
+        case spv::OpISubBorrow: return 125;
+        case spv::OpUMulExtended: return 126;
+        case spv::OpSMulExtended: return 127;
+        case spv::OpAny: return 128;
+        case spv::OpAll: return 129;
+        case spv::OpIsNan: return 130;
+        case spv::OpIsInf: return 131;
+        case spv::OpLogicalEqual: return 132;
+        case spv::OpLogicalNotEqual: return 133;
+        case spv::OpLogicalOr: return 134;
+        case spv::OpLogicalAnd: return 135;
+        case spv::OpLogicalNot: return 136;
+        case spv::OpSelect: return 137;
+        case spv::OpIEqual: return 138;
+        case spv::OpINotEqual: return 139;
+        case spv::OpUGreaterThan: return 140;
+        case spv::OpSGreaterThan: return 141;
+        case spv::OpUGreaterThanEqual: return 142;
+        case spv::OpSGreaterThanEqual: return 143;
+        case spv::OpULessThan: return 144;
+        case spv::OpSLessThan: return 145;
+        case spv::OpULessThanEqual: return 146;
+        case spv::OpSLessThanEqual: return 147;
+        case spv::OpFOrdEqual: return 148;
+        case spv::OpFUnordEqual: return 149;
+        case spv::OpFOrdNotEqual: return 150;
+        case spv::OpFUnordNotEqual: return 151;
+        case spv::OpFOrdLessThan: return 152;
+        case spv::OpFUnordLessThan: return 153;
+        case spv::OpFOrdGreaterThan: return 154;
+        case spv::OpFUnordGreaterThan: return 155;
+        case spv::OpFOrdLessThanEqual: return 156;
+        case spv::OpFUnordLessThanEqual: return 157;
+        case spv::OpFOrdGreaterThanEqual: return 158;
+        case spv::OpFUnordGreaterThanEqual: return 159;
+        case spv::OpShiftRightLogical: return 160;
+        case spv::OpShiftRightArithmetic: return 161;
+        case spv::OpShiftLeftLogical: return 162;
+        case spv::OpBitwiseOr: return 163;
+        case spv::OpBitwiseXor: return 164;
+        case spv::OpBitwiseAnd: return 165;
+        case spv::OpNot: return 166;
+        case spv::OpBitFieldInsert: return 167;
+        case spv::OpBitFieldSExtract: return 168;
+        case spv::OpBitFieldUExtract: return 169;
+        case spv::OpBitReverse: return 170;
+        case spv::OpBitCount: return 171;
+        case spv::OpDPdx: return 172;
+        case spv::OpDPdy: return 173;
+        case spv::OpFwidth: return 174;
+        case spv::OpDPdxFine: return 175;
+        case spv::OpDPdyFine: return 176;
+        case spv::OpFwidthFine: return 177;
+        case spv::OpDPdxCoarse: return 178;
+        case spv::OpDPdyCoarse: return 179;
+        case spv::OpFwidthCoarse: return 180;
+        case spv::OpEmitVertex: return 181;
+        case spv::OpEndPrimitive: return 182;
+        case spv::OpEmitStreamVertex: return 183;
+        case spv::OpEndStreamPrimitive: return 184;
+        case spv::OpControlBarrier: return 185;
+        case spv::OpMemoryBarrier: return 186;
+        case spv::OpAtomicLoad: return 187;
+        case spv::OpAtomicStore: return 188;
+        case spv::OpAtomicExchange: return 189;
+        case spv::OpAtomicCompareExchange: return 190;
+        case spv::OpAtomicIIncrement: return 191;
+        case spv::OpAtomicIDecrement: return 192;
+        case spv::OpAtomicIAdd: return 193;
+        case spv::OpAtomicISub: return 194;
+        case spv::OpAtomicSMin: return 195;
+        case spv::OpAtomicUMin: return 196;
+        case spv::OpAtomicSMax: return 197;
+        case spv::OpAtomicUMax: return 198;
+        case spv::OpAtomicAnd: return 199;
+        case spv::OpAtomicOr: return 200;
+        case spv::OpAtomicXor: return 201;
+        case spv::OpPhi: return 202;
+        case spv::OpLoopMerge: return 203;
+        case spv::OpSelectionMerge: return 204;
+        case spv::OpLabel: return 205;
+        case spv::OpBranch: return 206;
+        case spv::OpBranchConditional: return 207;
+        case spv::OpSwitch: return 208;
+        case spv::OpKill: return 209;
+        case spv::OpReturn: return 210;
+        case spv::OpReturnValue: return 211;
+        case spv::OpUnreachable: return 212;
+        case spv::OpGroupAll: return 213;
+        case spv::OpGroupAny: return 214;
+        case spv::OpGroupBroadcast: return 215;
+        case spv::OpGroupIAdd: return 216;
+        case spv::OpGroupFAdd: return 217;
+        case spv::OpGroupFMin: return 218;
+        case spv::OpGroupUMin: return 219;
+        case spv::OpGroupSMin: return 220;
+        case spv::OpGroupFMax: return 221;
+        case spv::OpGroupUMax: return 222;
+        case spv::OpGroupSMax: return 223;
+        case spv::OpImageSparseSampleImplicitLod: return 224;
+        case spv::OpImageSparseSampleExplicitLod: return 225;
+        case spv::OpImageSparseSampleDrefImplicitLod: return 226;
+        case spv::OpImageSparseSampleDrefExplicitLod: return 227;
+        case spv::OpImageSparseSampleProjImplicitLod: return 228;
+        case spv::OpImageSparseSampleProjExplicitLod: return 229;
+        case spv::OpImageSparseSampleProjDrefImplicitLod: return 230;
+        case spv::OpImageSparseSampleProjDrefExplicitLod: return 231;
+        case spv::OpImageSparseFetch: return 232;
+        case spv::OpImageSparseGather: return 233;
+        case spv::OpImageSparseDrefGather: return 234;
+        case spv::OpImageSparseTexelsResident: return 235;
+        case spv::OpNoLine: return 236;
+        case spv::OpImageSparseRead: return 237;
+        case spv::OpSizeOf: return 238;
+        case spv::OpTypePipeStorage: return 239;
+        case spv::OpConstantPipeStorage: return 240;
+        case spv::OpCreatePipeFromPipeStorage: return 241;
+        case spv::OpGetKernelLocalSizeForSubgroupCount: return 242;
+        case spv::OpGetKernelMaxNumSubgroups: return 243;
+        case spv::OpModuleProcessed: return 244;
+        case spv::OpExecutionModeId: return 245;
+        case spv::OpDecorateId: return 246;
+        case spv::OpGroupNonUniformElect: return 247;
+        case spv::OpGroupNonUniformAll: return 248;
+        case spv::OpGroupNonUniformAny: return 249;
+        case spv::OpGroupNonUniformAllEqual: return 250;
+        case spv::OpGroupNonUniformBroadcast: return 251;
+        case spv::OpGroupNonUniformBroadcastFirst: return 252;
+        case spv::OpGroupNonUniformBallot: return 253;
+        case spv::OpGroupNonUniformInverseBallot: return 254;
+        case spv::OpGroupNonUniformBallotBitExtract: return 255;
+        case spv::OpGroupNonUniformBallotBitCount: return 256;
+        case spv::OpGroupNonUniformBallotFindLSB: return 257;
+        case spv::OpGroupNonUniformBallotFindMSB: return 258;
+        case spv::OpGroupNonUniformShuffle: return 259;
+        case spv::OpGroupNonUniformShuffleXor: return 260;
+        case spv::OpGroupNonUniformShuffleUp: return 261;
+        case spv::OpGroupNonUniformShuffleDown: return 262;
+        case spv::OpGroupNonUniformIAdd: return 263;
+        case spv::OpGroupNonUniformFAdd: return 264;
+        case spv::OpGroupNonUniformIMul: return 265;
+        case spv::OpGroupNonUniformFMul: return 266;
+        case spv::OpGroupNonUniformSMin: return 267;
+        case spv::OpGroupNonUniformUMin: return 268;
+        case spv::OpGroupNonUniformFMin: return 269;
+        case spv::OpGroupNonUniformSMax: return 270;
+        case spv::OpGroupNonUniformUMax: return 271;
+        case spv::OpGroupNonUniformFMax: return 272;
+        case spv::OpGroupNonUniformBitwiseAnd: return 273;
+        case spv::OpGroupNonUniformBitwiseOr: return 274;
+        case spv::OpGroupNonUniformBitwiseXor: return 275;
+        case spv::OpGroupNonUniformLogicalAnd: return 276;
+        case spv::OpGroupNonUniformLogicalOr: return 277;
+        case spv::OpGroupNonUniformLogicalXor: return 278;
+        case spv::OpGroupNonUniformQuadBroadcast: return 279;
+        case spv::OpGroupNonUniformQuadSwap: return 280;
+        case spv::OpCopyLogical: return 281;
+        case spv::OpPtrEqual: return 282;
+        case spv::OpPtrNotEqual: return 283;
+        case spv::OpPtrDiff: return 284;
+        case spv::OpTerminateInvocation: return 285;
+        case spv::OpSubgroupBallotKHR: return 286;
+        case spv::OpSubgroupFirstInvocationKHR: return 287;
+        case spv::OpSubgroupAllKHR: return 288;
+        case spv::OpSubgroupAnyKHR: return 289;
+        case spv::OpSubgroupAllEqualKHR: return 290;
+        case spv::OpSubgroupReadInvocationKHR: return 291;
+        case spv::OpTraceRayKHR: return 292;
+        case spv::OpExecuteCallableKHR: return 293;
+        case spv::OpConvertUToAccelerationStructureKHR: return 294;
+        case spv::OpIgnoreIntersectionKHR: return 295;
+        case spv::OpTerminateRayKHR: return 296;
+        case spv::OpSDotKHR: return 297;
+        case spv::OpUDotKHR: return 298;
+        case spv::OpSUDotKHR: return 299;
+        case spv::OpSDotAccSatKHR: return 300;
+        case spv::OpUDotAccSatKHR: return 301;
+        case spv::OpSUDotAccSatKHR: return 302;
+        case spv::OpTypeRayQueryKHR: return 303;
+        case spv::OpRayQueryInitializeKHR: return 304;
+        case spv::OpRayQueryTerminateKHR: return 305;
+        case spv::OpRayQueryGenerateIntersectionKHR: return 306;
+        case spv::OpRayQueryConfirmIntersectionKHR: return 307;
+        case spv::OpRayQueryProceedKHR: return 308;
+        case spv::OpRayQueryGetIntersectionTypeKHR: return 309;
+        case spv::OpGroupIAddNonUniformAMD: return 310;
+        case spv::OpGroupFAddNonUniformAMD: return 311;
+        case spv::OpGroupFMinNonUniformAMD: return 312;
+        case spv::OpGroupUMinNonUniformAMD: return 313;
+        case spv::OpGroupSMinNonUniformAMD: return 314;
+        case spv::OpGroupFMaxNonUniformAMD: return 315;
+        case spv::OpGroupUMaxNonUniformAMD: return 316;
+        case spv::OpGroupSMaxNonUniformAMD: return 317;
+        case spv::OpFragmentMaskFetchAMD: return 318;
+        case spv::OpFragmentFetchAMD: return 319;
+        case spv::OpReadClockKHR: return 320;
+        case spv::OpImageSampleFootprintNV: return 321;
+        case spv::OpGroupNonUniformPartitionNV: return 322;
+        case spv::OpWritePackedPrimitiveIndices4x8NV: return 323;
+        case spv::OpReportIntersectionKHR: return 324;
+        case spv::OpIgnoreIntersectionNV: return 325;
+        case spv::OpTerminateRayNV: return 326;
+        case spv::OpTraceNV: return 327;
+        case spv::OpTraceMotionNV: return 328;
+        case spv::OpTraceRayMotionNV: return 329;
+        case spv::OpTypeAccelerationStructureKHR: return 330;
+        case spv::OpExecuteCallableNV: return 331;
+        case spv::OpTypeCooperativeMatrixNV: return 332;
+        case spv::OpCooperativeMatrixLoadNV: return 333;
+        case spv::OpCooperativeMatrixStoreNV: return 334;
+        case spv::OpCooperativeMatrixMulAddNV: return 335;
+        case spv::OpCooperativeMatrixLengthNV: return 336;
+        case spv::OpBeginInvocationInterlockEXT: return 337;
+        case spv::OpEndInvocationInterlockEXT: return 338;
+        case spv::OpDemoteToHelperInvocationEXT: return 339;
+        case spv::OpIsHelperInvocationEXT: return 340;
+        case spv::OpConvertUToImageNV: return 341;
+        case spv::OpConvertUToSamplerNV: return 342;
+        case spv::OpConvertImageToUNV: return 343;
+        case spv::OpConvertSamplerToUNV: return 344;
+        case spv::OpConvertUToSampledImageNV: return 345;
+        case spv::OpConvertSampledImageToUNV: return 346;
+        case spv::OpSamplerImageAddressingModeNV: return 347;
+        case spv::OpSubgroupShuffleINTEL: return 348;
+        case spv::OpSubgroupShuffleDownINTEL: return 349;
+        case spv::OpSubgroupShuffleUpINTEL: return 350;
+        case spv::OpSubgroupShuffleXorINTEL: return 351;
+        case spv::OpSubgroupBlockReadINTEL: return 352;
+        case spv::OpSubgroupBlockWriteINTEL: return 353;
+        case spv::OpSubgroupImageBlockReadINTEL: return 354;
+        case spv::OpSubgroupImageBlockWriteINTEL: return 355;
+        case spv::OpSubgroupImageMediaBlockReadINTEL: return 356;
+        case spv::OpSubgroupImageMediaBlockWriteINTEL: return 357;
+        case spv::OpUCountLeadingZerosINTEL: return 358;
+        case spv::OpUCountTrailingZerosINTEL: return 359;
+        case spv::OpAbsISubINTEL: return 360;
+        case spv::OpAbsUSubINTEL: return 361;
+        case spv::OpIAddSatINTEL: return 362;
+        case spv::OpUAddSatINTEL: return 363;
+        case spv::OpIAverageINTEL: return 364;
+        case spv::OpUAverageINTEL: return 365;
+        case spv::OpIAverageRoundedINTEL: return 366;
+        case spv::OpUAverageRoundedINTEL: return 367;
+        case spv::OpISubSatINTEL: return 368;
+        case spv::OpUSubSatINTEL: return 369;
+        case spv::OpIMul32x16INTEL: return 370;
+        case spv::OpUMul32x16INTEL: return 371;
+        case spv::OpConstantFunctionPointerINTEL: return 372;
+        case spv::OpFunctionPointerCallINTEL: return 373;
+        case spv::OpAsmTargetINTEL: return 374;
+        case spv::OpAsmINTEL: return 375;
+        case spv::OpAsmCallINTEL: return 376;
+        case spv::OpAtomicFMinEXT: return 377;
+        case spv::OpAtomicFMaxEXT: return 378;
+        case spv::OpAssumeTrueKHR: return 379;
+        case spv::OpExpectKHR: return 380;
+        case spv::OpDecorateStringGOOGLE: return 381;
+        case spv::OpMemberDecorateStringGOOGLE: return 382;
+        case spv::OpVariableLengthArrayINTEL: return 383;
+        case spv::OpSaveMemoryINTEL: return 384;
+        case spv::OpRestoreMemoryINTEL: return 385;
+        case spv::OpLoopControlINTEL: return 386;
+        case spv::OpAliasDomainDeclINTEL: return 387;
+        case spv::OpAliasScopeDeclINTEL: return 388;
+        case spv::OpAliasScopeListDeclINTEL: return 389;
+        case spv::OpPtrCastToCrossWorkgroupINTEL: return 390;
+        case spv::OpCrossWorkgroupCastToPtrINTEL: return 391;
+        case spv::OpReadPipeBlockingINTEL: return 392;
+        case spv::OpWritePipeBlockingINTEL: return 393;
+        case spv::OpFPGARegINTEL: return 394;
+        case spv::OpRayQueryGetRayTMinKHR: return 395;
+        case spv::OpRayQueryGetRayFlagsKHR: return 396;
+        case spv::OpRayQueryGetIntersectionTKHR: return 397;
+        case spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR: return 398;
+        case spv::OpRayQueryGetIntersectionInstanceIdKHR: return 399;
+        case spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR: return 400;
+        case spv::OpRayQueryGetIntersectionGeometryIndexKHR: return 401;
+        case spv::OpRayQueryGetIntersectionPrimitiveIndexKHR: return 402;
+        case spv::OpRayQueryGetIntersectionBarycentricsKHR: return 403;
+        case spv::OpRayQueryGetIntersectionFrontFaceKHR: return 404;
+        case spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR: return 405;
+        case spv::OpRayQueryGetIntersectionObjectRayDirectionKHR: return 406;
+        case spv::OpRayQueryGetIntersectionObjectRayOriginKHR: return 407;
+        case spv::OpRayQueryGetWorldRayDirectionKHR: return 408;
+        case spv::OpRayQueryGetWorldRayOriginKHR: return 409;
+        case spv::OpRayQueryGetIntersectionObjectToWorldKHR: return 410;
+        case spv::OpRayQueryGetIntersectionWorldToObjectKHR: return 411;
+        case spv::OpAtomicFAddEXT: return 412;
+        case spv::OpTypeBufferSurfaceINTEL: return 413;
+        case spv::OpTypeStructContinuedINTEL: return 414;
+        case spv::OpConstantCompositeContinuedINTEL: return 415;
+        case spv::OpSpecConstantCompositeContinuedINTEL: return 416;
+        case spv::OpControlBarrierArriveINTEL: return 417;
+        case spv::OpControlBarrierWaitINTEL: return 418;
+        case spv::OpGroupIMulKHR: return 419;
+        case spv::OpGroupFMulKHR: return 420;
+        case spv::OpGroupBitwiseAndKHR: return 421;
+        case spv::OpGroupBitwiseOrKHR: return 422;
+        case spv::OpGroupBitwiseXorKHR: return 423;
+        case spv::OpGroupLogicalAndKHR: return 424;
+        case spv::OpGroupLogicalOrKHR: return 425;
+        case spv::OpGroupLogicalXorKHR: return 426;
+        default: return 0;
+    }
+}
 // clang-format on
 
 // Any non supported operation will be covered with VUID 01090
@@ -602,21 +1037,11 @@ bool ImageSampleOperation(uint32_t opcode) {
 
 
 bool OpcodeHasType(uint32_t opcode) {
-    bool has_type = false;
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        has_type = format_info->second.has_type;
-    }
-    return has_type;
+    return kInstructionTable[InstructionTableIndex(opcode)].has_type;
 }
 
 bool OpcodeHasResult(uint32_t opcode) {
-    bool has_result = false;
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        has_result = format_info->second.has_result;
-    }
-    return has_result;
+    return kInstructionTable[InstructionTableIndex(opcode)].has_result;
 }
 
 // Helper to get the word position of the result operand.
@@ -633,32 +1058,17 @@ uint32_t OpcodeResultWord(uint32_t opcode) {
 
 // Return operand position of Memory Scope <ID> or zero if there is none
 uint32_t OpcodeMemoryScopePosition(uint32_t opcode) {
-    uint32_t position = 0;
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        position = format_info->second.memory_scope_position;
-    }
-    return position;
+    return kInstructionTable[InstructionTableIndex(opcode)].memory_scope_position;
 }
 
 // Return operand position of Execution Scope <ID> or zero if there is none
 uint32_t OpcodeExecutionScopePosition(uint32_t opcode) {
-    uint32_t position = 0;
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        position = format_info->second.execution_scope_position;
-    }
-    return position;
+    return kInstructionTable[InstructionTableIndex(opcode)].execution_scope_position;
 }
 
 // Return operand position of Image Operands <ID> or zero if there is none
 uint32_t OpcodeImageOperandsPosition(uint32_t opcode) {
-    uint32_t position = 0;
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        position = format_info->second.image_operands_position;
-    }
-    return position;
+    return kInstructionTable[InstructionTableIndex(opcode)].image_operands_position;
 }
 
 // Return number of optional parameter from ImageOperands
@@ -694,10 +1104,5 @@ uint32_t ImageOperandsParamCount(uint32_t image_operand) {
 
 
 const char* string_SpvOpcode(uint32_t opcode) {
-    auto format_info = kInstructionTable.find(opcode);
-    if (format_info != kInstructionTable.end()) {
-        return format_info->second.name;
-    } else {
-        return "Unhandled Opcode";
-    }
+    return kInstructionTable[InstructionTableIndex(opcode)].name;
 };
@@ -25,78 +25,30 @@
  *
  ****************************************************************************/
 
-#include <string>
-#include <functional>
+#include <cstring>
 #include <spirv/unified1/spirv.hpp>
 #include "vk_extension_helper.h"
 #include "shader_module.h"
 #include "device_state.h"
 #include "core_validation.h"
 
+// Tests if the feature of the given struct in the aggregate feature struct is enabled
+template <typename FeatureStruct, FeatureStruct DeviceFeatures::*feature_struct, VkBool32 FeatureStruct::*feature>
+static VkBool32 IsFeatureEnabled(const DeviceFeatures &features) {
+    return (features.*feature_struct).*feature;
+}
+
 struct FeaturePointer {
-    // Callable object to test if this feature is enabled in the given aggregate feature struct
-    const std::function<VkBool32(const DeviceFeatures &)> IsEnabled;
+    // Function to test if this feature is enabled in the given aggregate feature struct
+    VkBool32 (*IsEnabled)(const DeviceFeatures &);
 
     // Test if feature pointer is populated
-    explicit operator bool() const { return static_cast<bool>(IsEnabled); }
-
-    // Default and nullptr constructor to create an empty FeaturePointer
-    FeaturePointer() : IsEnabled(nullptr) {}
-    FeaturePointer(std::nullptr_t ptr) : IsEnabled(nullptr) {}
+    constexpr explicit operator bool() const { return IsEnabled != nullptr; }
 
-    // Constructors to populate FeaturePointer based on given pointer to member
-    FeaturePointer(VkBool32 VkPhysicalDeviceFeatures::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.core.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceVulkan11Features::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.core11.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceVulkan12Features::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.core12.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceVulkan13Features::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.core13.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceTransformFeedbackFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.transform_feedback_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceCooperativeMatrixFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.cooperative_matrix_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.compute_shader_derivatives_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.fragment_shader_barycentric_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderImageFootprintFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_image_footprint_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.fragment_shader_interlock_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.demote_to_helper_invocation_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceRayQueryFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.ray_query_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceRayTracingPipelineFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.ray_tracing_pipeline_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceAccelerationStructureFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.ray_tracing_acceleration_structure_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceFragmentDensityMapFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.fragment_density_map_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.buffer_device_address_ext_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceFragmentShadingRateFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.fragment_shading_rate_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_integer_functions2_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_sm_builtins_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShadingRateImageFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shading_rate_image_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_atomic_float_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_image_atomic_int64_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.workgroup_memory_explicit_layout_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_atomic_float2_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.ray_tracing_motion_blur_features.*ptr; }) {}
-    FeaturePointer(VkBool32 VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::*ptr)
-        : IsEnabled([=](const DeviceFeatures &features) { return features.shader_integer_dot_product_features.*ptr; }) {}
+    // nullptr constructor to create an empty FeaturePointer
+    constexpr FeaturePointer(std::nullptr_t) : IsEnabled(nullptr) {}
+    // Constructor from an IsFeatureEnabled instantiation, so that the tables are constant initialized
+    constexpr FeaturePointer(VkBool32 (*is_enabled)(const DeviceFeatures &)) : IsEnabled(is_enabled) {}
 };
 
 // Each instance of the struct will only have a singel field non-null
@@ -107,258 +59,511 @@ struct RequiredSpirvInfo {
     const char* property; // For human readability and make some capabilities unique
 };
 
+// Range of the requirements of a capability or extension in its table
+struct RequiredSpirvRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+// Requirements of all capabilities, those of each capability next to each other
+//
 // clang-format off
-static const std::unordered_multimap<uint32_t, RequiredSpirvInfo> spirvCapabilities = {
-    {spv::CapabilityAtomicFloat16AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat16AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat16AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat16AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat16MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat16AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat16MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat16AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderBufferFloat32AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderSharedFloat32AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderImageFloat32AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat32AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat32AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat32MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderImageFloat32AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat64AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderBufferFloat64AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat64AddEXT, {0, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderSharedFloat64AtomicAdd, nullptr, ""}},
-    {spv::CapabilityAtomicFloat64MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat64AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityAtomicFloat64MinMaxEXT, {0, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat64AtomicMinMax, nullptr, ""}},
-    {spv::CapabilityClipDistance, {0, &VkPhysicalDeviceFeatures::shaderClipDistance, nullptr, ""}},
-    {spv::CapabilityComputeDerivativeGroupLinearNV, {0, &VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::computeDerivativeGroupLinear, nullptr, ""}},
-    {spv::CapabilityComputeDerivativeGroupQuadsNV, {0, &VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::computeDerivativeGroupQuads, nullptr, ""}},
-    {spv::CapabilityCooperativeMatrixNV, {0, &VkPhysicalDeviceCooperativeMatrixFeaturesNV::cooperativeMatrix, nullptr, ""}},
-    {spv::CapabilityCullDistance, {0, &VkPhysicalDeviceFeatures::shaderCullDistance, nullptr, ""}},
-    {spv::CapabilityDemoteToHelperInvocationEXT, {0, &VkPhysicalDeviceVulkan13Features::shaderDemoteToHelperInvocation, nullptr, ""}},
-    {spv::CapabilityDemoteToHelperInvocationEXT, {0, &VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::shaderDemoteToHelperInvocation, nullptr, ""}},
-    {spv::CapabilityDenormFlushToZero, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat16 & VK_TRUE) != 0"}},
-    {spv::CapabilityDenormFlushToZero, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat32 & VK_TRUE) != 0"}},
-    {spv::CapabilityDenormFlushToZero, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat64 & VK_TRUE) != 0"}},
-    {spv::CapabilityDenormPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat16 & VK_TRUE) != 0"}},
-    {spv::CapabilityDenormPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat32 & VK_TRUE) != 0"}},
-    {spv::CapabilityDenormPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat64 & VK_TRUE) != 0"}},
-    {spv::CapabilityDerivativeControl, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityDeviceGroup, {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {spv::CapabilityDeviceGroup, {0, nullptr, &DeviceExtensions::vk_khr_device_group, ""}},
-    {spv::CapabilityDotProductInput4x8BitKHR, {0, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductInput4x8BitKHR, {0, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductInput4x8BitPackedKHR, {0, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductInput4x8BitPackedKHR, {0, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductInputAllKHR, {0, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductInputAllKHR, {0, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductKHR, {0, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDotProductKHR, {0, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct, nullptr, ""}},
-    {spv::CapabilityDrawParameters, {0, &VkPhysicalDeviceVulkan11Features::shaderDrawParameters, nullptr, ""}},
-    {spv::CapabilityDrawParameters, {0, nullptr, &DeviceExtensions::vk_khr_shader_draw_parameters, ""}},
-    {spv::CapabilityFloat16, {0, &VkPhysicalDeviceVulkan12Features::shaderFloat16, nullptr, ""}},
-    {spv::CapabilityFloat16, {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_half_float, ""}},
-    {spv::CapabilityFloat64, {0, &VkPhysicalDeviceFeatures::shaderFloat64, nullptr, ""}},
-    {spv::CapabilityFragmentBarycentricNV, {0, &VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::fragmentShaderBarycentric, nullptr, ""}},
-    {spv::CapabilityFragmentDensityEXT, {0, &VkPhysicalDeviceFragmentDensityMapFeaturesEXT::fragmentDensityMap, nullptr, ""}},
-    {spv::CapabilityFragmentMaskAMD, {0, nullptr, &DeviceExtensions::vk_amd_shader_fragment_mask, ""}},
-    {spv::CapabilityFragmentShaderPixelInterlockEXT, {0, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderPixelInterlock, nullptr, ""}},
-    {spv::CapabilityFragmentShaderSampleInterlockEXT, {0, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderSampleInterlock, nullptr, ""}},
-    {spv::CapabilityFragmentShaderShadingRateInterlockEXT, {0, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderShadingRateInterlock, nullptr, ""}},
-    {spv::CapabilityFragmentShaderShadingRateInterlockEXT, {0, &VkPhysicalDeviceShadingRateImageFeaturesNV::shadingRateImage, nullptr, ""}},
-    {spv::CapabilityFragmentShadingRateKHR, {0, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::pipelineFragmentShadingRate, nullptr, ""}},
-    {spv::CapabilityFragmentShadingRateKHR, {0, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::primitiveFragmentShadingRate, nullptr, ""}},
-    {spv::CapabilityFragmentShadingRateKHR, {0, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::attachmentFragmentShadingRate, nullptr, ""}},
-    {spv::CapabilityGeometry, {0, &VkPhysicalDeviceFeatures::geometryShader, nullptr, ""}},
-    {spv::CapabilityGeometryPointSize, {0, &VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize, nullptr, ""}},
-    {spv::CapabilityGeometryShaderPassthroughNV, {0, nullptr, &DeviceExtensions::vk_nv_geometry_shader_passthrough, ""}},
-    {spv::CapabilityGeometryStreams, {0, &VkPhysicalDeviceTransformFeedbackFeaturesEXT::geometryStreams, nullptr, ""}},
-    {spv::CapabilityGroupNonUniform, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformArithmetic, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformBallot, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformClustered, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformPartitionedNV, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV) != 0"}},
-    {spv::CapabilityGroupNonUniformQuad, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformShuffle, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformShuffleRelative, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT) != 0"}},
-    {spv::CapabilityGroupNonUniformVote, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT) != 0"}},
-    {spv::CapabilityImage1D, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityImageBuffer, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityImageCubeArray, {0, &VkPhysicalDeviceFeatures::imageCubeArray, nullptr, ""}},
-    {spv::CapabilityImageFootprintNV, {0, &VkPhysicalDeviceShaderImageFootprintFeaturesNV::imageFootprint, nullptr, ""}},
-    {spv::CapabilityImageGatherBiasLodAMD, {0, nullptr, &DeviceExtensions::vk_amd_texture_gather_bias_lod, ""}},
-    {spv::CapabilityImageGatherExtended, {0, &VkPhysicalDeviceFeatures::shaderImageGatherExtended, nullptr, ""}},
-    {spv::CapabilityImageMSArray, {0, &VkPhysicalDeviceFeatures::shaderStorageImageMultisample, nullptr, ""}},
-    {spv::CapabilityImageQuery, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityImageReadWriteLodAMD, {0, nullptr, &DeviceExtensions::vk_amd_shader_image_load_store_lod, ""}},
-    {spv::CapabilityInputAttachment, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityInputAttachmentArrayDynamicIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderInputAttachmentArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityInputAttachmentArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderInputAttachmentArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityInt16, {0, &VkPhysicalDeviceFeatures::shaderInt16, nullptr, ""}},
-    {spv::CapabilityInt64, {0, &VkPhysicalDeviceFeatures::shaderInt64, nullptr, ""}},
-    {spv::CapabilityInt64Atomics, {0, &VkPhysicalDeviceVulkan12Features::shaderBufferInt64Atomics, nullptr, ""}},
-    {spv::CapabilityInt64Atomics, {0, &VkPhysicalDeviceVulkan12Features::shaderSharedInt64Atomics, nullptr, ""}},
-    {spv::CapabilityInt64Atomics, {0, &VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::shaderImageInt64Atomics, nullptr, ""}},
-    {spv::CapabilityInt64ImageEXT, {0, &VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::shaderImageInt64Atomics, nullptr, ""}},
-    {spv::CapabilityInt8, {0, &VkPhysicalDeviceVulkan12Features::shaderInt8, nullptr, ""}},
-    {spv::CapabilityIntegerFunctions2INTEL, {0, &VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::shaderIntegerFunctions2, nullptr, ""}},
-    {spv::CapabilityInterpolationFunction, {0, &VkPhysicalDeviceFeatures::sampleRateShading, nullptr, ""}},
-    {spv::CapabilityMatrix, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityMeshShadingNV, {0, nullptr, &DeviceExtensions::vk_nv_mesh_shader, ""}},
-    {spv::CapabilityMinLod, {0, &VkPhysicalDeviceFeatures::shaderResourceMinLod, nullptr, ""}},
-    {spv::CapabilityMultiView, {0, &VkPhysicalDeviceVulkan11Features::multiview, nullptr, ""}},
-    {spv::CapabilityMultiViewport, {0, &VkPhysicalDeviceFeatures::multiViewport, nullptr, ""}},
-    {spv::CapabilityPerViewAttributesNV, {0, nullptr, &DeviceExtensions::vk_nvx_multiview_per_view_attributes, ""}},
-    {spv::CapabilityPhysicalStorageBufferAddresses, {0, &VkPhysicalDeviceVulkan12Features::bufferDeviceAddress, nullptr, ""}},
-    {spv::CapabilityPhysicalStorageBufferAddresses, {0, &VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::bufferDeviceAddress, nullptr, ""}},
-    {spv::CapabilityRayQueryKHR, {0, &VkPhysicalDeviceRayQueryFeaturesKHR::rayQuery, nullptr, ""}},
-    {spv::CapabilityRayTracingKHR, {0, &VkPhysicalDeviceRayTracingPipelineFeaturesKHR::rayTracingPipeline, nullptr, ""}},
-    {spv::CapabilityRayTracingMotionBlurNV, {0, &VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::rayTracingMotionBlur, nullptr, ""}},
-    {spv::CapabilityRayTracingNV, {0, nullptr, &DeviceExtensions::vk_nv_ray_tracing, ""}},
-    {spv::CapabilityRayTraversalPrimitiveCullingKHR, {0, &VkPhysicalDeviceRayTracingPipelineFeaturesKHR::rayTraversalPrimitiveCulling, nullptr, ""}},
-    {spv::CapabilityRoundingModeRTE, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat16 & VK_TRUE) != 0"}},
-    {spv::CapabilityRoundingModeRTE, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat32 & VK_TRUE) != 0"}},
-    {spv::CapabilityRoundingModeRTE, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat64 & VK_TRUE) != 0"}},
-    {spv::CapabilityRoundingModeRTZ, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat16 & VK_TRUE) != 0"}},
-    {spv::CapabilityRoundingModeRTZ, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat32 & VK_TRUE) != 0"}},
-    {spv::CapabilityRoundingModeRTZ, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat64 & VK_TRUE) != 0"}},
-    {spv::CapabilityRuntimeDescriptorArray, {0, &VkPhysicalDeviceVulkan12Features::runtimeDescriptorArray, nullptr, ""}},
-    {spv::CapabilitySampleMaskOverrideCoverageNV, {0, nullptr, &DeviceExtensions::vk_nv_sample_mask_override_coverage, ""}},
-    {spv::CapabilitySampleMaskPostDepthCoverage, {0, nullptr, &DeviceExtensions::vk_ext_post_depth_coverage, ""}},
-    {spv::CapabilitySampleRateShading, {0, &VkPhysicalDeviceFeatures::sampleRateShading, nullptr, ""}},
-    {spv::CapabilitySampled1D, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilitySampledBuffer, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilitySampledCubeArray, {0, &VkPhysicalDeviceFeatures::imageCubeArray, nullptr, ""}},
-    {spv::CapabilitySampledImageArrayDynamicIndexing, {0, &VkPhysicalDeviceFeatures::shaderSampledImageArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilitySampledImageArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderSampledImageArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityShader, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityShaderClockKHR, {0, nullptr, &DeviceExtensions::vk_khr_shader_clock, ""}},
-    {spv::CapabilityShaderLayer, {0, &VkPhysicalDeviceVulkan12Features::shaderOutputLayer, nullptr, ""}},
-    {spv::CapabilityShaderNonUniform, {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {spv::CapabilityShaderNonUniform, {0, nullptr, &DeviceExtensions::vk_ext_descriptor_indexing, ""}},
-    {spv::CapabilityShaderSMBuiltinsNV, {0, &VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::shaderSMBuiltins, nullptr, ""}},
-    {spv::CapabilityShaderViewportIndex, {0, &VkPhysicalDeviceVulkan12Features::shaderOutputViewportIndex, nullptr, ""}},
-    {spv::CapabilityShaderViewportIndexLayerEXT, {0, nullptr, &DeviceExtensions::vk_ext_shader_viewport_index_layer, ""}},
-    {spv::CapabilityShaderViewportIndexLayerNV, {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}},
-    {spv::CapabilityShaderViewportMaskNV, {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}},
-    {spv::CapabilityShadingRateNV, {0, &VkPhysicalDeviceShadingRateImageFeaturesNV::shadingRateImage, nullptr, ""}},
-    {spv::CapabilitySignedZeroInfNanPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat16 & VK_TRUE) != 0"}},
-    {spv::CapabilitySignedZeroInfNanPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat32 & VK_TRUE) != 0"}},
-    {spv::CapabilitySignedZeroInfNanPreserve, {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat64 & VK_TRUE) != 0"}},
-    {spv::CapabilitySparseResidency, {0, &VkPhysicalDeviceFeatures::shaderResourceResidency, nullptr, ""}},
-    {spv::CapabilityStencilExportEXT, {0, nullptr, &DeviceExtensions::vk_ext_shader_stencil_export, ""}},
-    {spv::CapabilityStorageBuffer16BitAccess, {0, &VkPhysicalDeviceVulkan11Features::storageBuffer16BitAccess, nullptr, ""}},
-    {spv::CapabilityStorageBuffer8BitAccess, {0, &VkPhysicalDeviceVulkan12Features::storageBuffer8BitAccess, nullptr, ""}},
-    {spv::CapabilityStorageBufferArrayDynamicIndexing, {0, &VkPhysicalDeviceFeatures::shaderStorageBufferArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityStorageBufferArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderStorageBufferArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityStorageImageArrayDynamicIndexing, {0, &VkPhysicalDeviceFeatures::shaderStorageImageArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityStorageImageArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderStorageImageArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityStorageImageExtendedFormats, {VK_API_VERSION_1_0, nullptr, nullptr, ""}},
-    {spv::CapabilityStorageImageMultisample, {0, &VkPhysicalDeviceFeatures::shaderStorageImageMultisample, nullptr, ""}},
-    {spv::CapabilityStorageImageReadWithoutFormat, {0, &VkPhysicalDeviceFeatures::shaderStorageImageReadWithoutFormat, nullptr, ""}},
-    {spv::CapabilityStorageImageReadWithoutFormat, {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {spv::CapabilityStorageImageReadWithoutFormat, {0, nullptr, &DeviceExtensions::vk_khr_format_feature_flags2, ""}},
-    {spv::CapabilityStorageImageWriteWithoutFormat, {0, &VkPhysicalDeviceFeatures::shaderStorageImageWriteWithoutFormat, nullptr, ""}},
-    {spv::CapabilityStorageImageWriteWithoutFormat, {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {spv::CapabilityStorageImageWriteWithoutFormat, {0, nullptr, &DeviceExtensions::vk_khr_format_feature_flags2, ""}},
-    {spv::CapabilityStorageInputOutput16, {0, &VkPhysicalDeviceVulkan11Features::storageInputOutput16, nullptr, ""}},
-    {spv::CapabilityStoragePushConstant16, {0, &VkPhysicalDeviceVulkan11Features::storagePushConstant16, nullptr, ""}},
-    {spv::CapabilityStoragePushConstant8, {0, &VkPhysicalDeviceVulkan12Features::storagePushConstant8, nullptr, ""}},
-    {spv::CapabilityStorageTexelBufferArrayDynamicIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderStorageTexelBufferArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityStorageTexelBufferArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderStorageTexelBufferArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilitySubgroupBallotKHR, {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_ballot, ""}},
-    {spv::CapabilitySubgroupVoteKHR, {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_vote, ""}},
-    {spv::CapabilityTessellation, {0, &VkPhysicalDeviceFeatures::tessellationShader, nullptr, ""}},
-    {spv::CapabilityTessellationPointSize, {0, &VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize, nullptr, ""}},
-    {spv::CapabilityTransformFeedback, {0, &VkPhysicalDeviceTransformFeedbackFeaturesEXT::transformFeedback, nullptr, ""}},
-    {spv::CapabilityUniformAndStorageBuffer16BitAccess, {0, &VkPhysicalDeviceVulkan11Features::uniformAndStorageBuffer16BitAccess, nullptr, ""}},
-    {spv::CapabilityUniformAndStorageBuffer8BitAccess, {0, &VkPhysicalDeviceVulkan12Features::uniformAndStorageBuffer8BitAccess, nullptr, ""}},
-    {spv::CapabilityUniformBufferArrayDynamicIndexing, {0, &VkPhysicalDeviceFeatures::shaderUniformBufferArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityUniformBufferArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderUniformBufferArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityUniformTexelBufferArrayDynamicIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderUniformTexelBufferArrayDynamicIndexing, nullptr, ""}},
-    {spv::CapabilityUniformTexelBufferArrayNonUniformIndexing, {0, &VkPhysicalDeviceVulkan12Features::shaderUniformTexelBufferArrayNonUniformIndexing, nullptr, ""}},
-    {spv::CapabilityVariablePointers, {0, &VkPhysicalDeviceVulkan11Features::variablePointers, nullptr, ""}},
-    {spv::CapabilityVariablePointersStorageBuffer, {0, &VkPhysicalDeviceVulkan11Features::variablePointersStorageBuffer, nullptr, ""}},
-    {spv::CapabilityVulkanMemoryModel, {0, &VkPhysicalDeviceVulkan12Features::vulkanMemoryModel, nullptr, ""}},
-    {spv::CapabilityVulkanMemoryModelDeviceScope, {0, &VkPhysicalDeviceVulkan12Features::vulkanMemoryModelDeviceScope, nullptr, ""}},
-    {spv::CapabilityWorkgroupMemoryExplicitLayout16BitAccessKHR, {0, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout16BitAccess, nullptr, ""}},
-    {spv::CapabilityWorkgroupMemoryExplicitLayout8BitAccessKHR, {0, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout8BitAccess, nullptr, ""}},
-    {spv::CapabilityWorkgroupMemoryExplicitLayoutKHR, {0, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout, nullptr, ""}},
+static constexpr RequiredSpirvInfo kCapabilityRequirements[] = {
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat16AtomicAdd>, nullptr, ""}, // AtomicFloat16AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat16AtomicAdd>, nullptr, ""}, // AtomicFloat16AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat16AtomicMinMax>, nullptr, ""}, // AtomicFloat16MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat16AtomicMinMax>, nullptr, ""}, // AtomicFloat16MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, &DeviceFeatures::shader_atomic_float_features, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderBufferFloat32AtomicAdd>, nullptr, ""}, // AtomicFloat32AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, &DeviceFeatures::shader_atomic_float_features, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderSharedFloat32AtomicAdd>, nullptr, ""}, // AtomicFloat32AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, &DeviceFeatures::shader_atomic_float_features, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderImageFloat32AtomicAdd>, nullptr, ""}, // AtomicFloat32AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat32AtomicMinMax>, nullptr, ""}, // AtomicFloat32MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat32AtomicMinMax>, nullptr, ""}, // AtomicFloat32MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderImageFloat32AtomicMinMax>, nullptr, ""}, // AtomicFloat32MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, &DeviceFeatures::shader_atomic_float_features, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderBufferFloat64AtomicAdd>, nullptr, ""}, // AtomicFloat64AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT, &DeviceFeatures::shader_atomic_float_features, &VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::shaderSharedFloat64AtomicAdd>, nullptr, ""}, // AtomicFloat64AddEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderBufferFloat64AtomicMinMax>, nullptr, ""}, // AtomicFloat64MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT, &DeviceFeatures::shader_atomic_float2_features, &VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::shaderSharedFloat64AtomicMinMax>, nullptr, ""}, // AtomicFloat64MinMaxEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderClipDistance>, nullptr, ""}, // ClipDistance
+    {0, &IsFeatureEnabled<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV, &DeviceFeatures::compute_shader_derivatives_features, &VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::computeDerivativeGroupLinear>, nullptr, ""}, // ComputeDerivativeGroupLinearNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV, &DeviceFeatures::compute_shader_derivatives_features, &VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::computeDerivativeGroupQuads>, nullptr, ""}, // ComputeDerivativeGroupQuadsNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceCooperativeMatrixFeaturesNV, &DeviceFeatures::cooperative_matrix_features, &VkPhysicalDeviceCooperativeMatrixFeaturesNV::cooperativeMatrix>, nullptr, ""}, // CooperativeMatrixNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderCullDistance>, nullptr, ""}, // CullDistance
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan13Features, &DeviceFeatures::core13, &VkPhysicalDeviceVulkan13Features::shaderDemoteToHelperInvocation>, nullptr, ""}, // DemoteToHelperInvocationEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT, &DeviceFeatures::demote_to_helper_invocation_features, &VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::shaderDemoteToHelperInvocation>, nullptr, ""}, // DemoteToHelperInvocationEXT
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat16 & VK_TRUE) != 0"}, // DenormFlushToZero
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat32 & VK_TRUE) != 0"}, // DenormFlushToZero
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormFlushToZeroFloat64 & VK_TRUE) != 0"}, // DenormFlushToZero
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat16 & VK_TRUE) != 0"}, // DenormPreserve
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat32 & VK_TRUE) != 0"}, // DenormPreserve
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderDenormPreserveFloat64 & VK_TRUE) != 0"}, // DenormPreserve
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // DerivativeControl
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // DeviceGroup
+    {0, nullptr, &DeviceExtensions::vk_khr_device_group, ""}, // DeviceGroup
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan13Features, &DeviceFeatures::core13, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInput4x8BitKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR, &DeviceFeatures::shader_integer_dot_product_features, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInput4x8BitKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan13Features, &DeviceFeatures::core13, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInput4x8BitPackedKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR, &DeviceFeatures::shader_integer_dot_product_features, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInput4x8BitPackedKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan13Features, &DeviceFeatures::core13, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInputAllKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR, &DeviceFeatures::shader_integer_dot_product_features, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct>, nullptr, ""}, // DotProductInputAllKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan13Features, &DeviceFeatures::core13, &VkPhysicalDeviceVulkan13Features::shaderIntegerDotProduct>, nullptr, ""}, // DotProductKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR, &DeviceFeatures::shader_integer_dot_product_features, &VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR::shaderIntegerDotProduct>, nullptr, ""}, // DotProductKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::shaderDrawParameters>, nullptr, ""}, // DrawParameters
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_draw_parameters, ""}, // DrawParameters
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderFloat16>, nullptr, ""}, // Float16
+    {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_half_float, ""}, // Float16
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderFloat64>, nullptr, ""}, // Float64
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV, &DeviceFeatures::fragment_shader_barycentric_features, &VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::fragmentShaderBarycentric>, nullptr, ""}, // FragmentBarycentricNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentDensityMapFeaturesEXT, &DeviceFeatures::fragment_density_map_features, &VkPhysicalDeviceFragmentDensityMapFeaturesEXT::fragmentDensityMap>, nullptr, ""}, // FragmentDensityEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShadingRateImageFeaturesNV, &DeviceFeatures::shading_rate_image_features, &VkPhysicalDeviceShadingRateImageFeaturesNV::shadingRateImage>, nullptr, ""}, // ShadingRateNV
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_fragment_mask, ""}, // FragmentMaskAMD
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT, &DeviceFeatures::fragment_shader_interlock_features, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderPixelInterlock>, nullptr, ""}, // FragmentShaderPixelInterlockEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT, &DeviceFeatures::fragment_shader_interlock_features, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderSampleInterlock>, nullptr, ""}, // FragmentShaderSampleInterlockEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT, &DeviceFeatures::fragment_shader_interlock_features, &VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::fragmentShaderShadingRateInterlock>, nullptr, ""}, // FragmentShaderShadingRateInterlockEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShadingRateImageFeaturesNV, &DeviceFeatures::shading_rate_image_features, &VkPhysicalDeviceShadingRateImageFeaturesNV::shadingRateImage>, nullptr, ""}, // FragmentShaderShadingRateInterlockEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShadingRateFeaturesKHR, &DeviceFeatures::fragment_shading_rate_features, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::pipelineFragmentShadingRate>, nullptr, ""}, // FragmentShadingRateKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShadingRateFeaturesKHR, &DeviceFeatures::fragment_shading_rate_features, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::primitiveFragmentShadingRate>, nullptr, ""}, // FragmentShadingRateKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFragmentShadingRateFeaturesKHR, &DeviceFeatures::fragment_shading_rate_features, &VkPhysicalDeviceFragmentShadingRateFeaturesKHR::attachmentFragmentShadingRate>, nullptr, ""}, // FragmentShadingRateKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::geometryShader>, nullptr, ""}, // Geometry
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize>, nullptr, ""}, // GeometryPointSize
+    {0, nullptr, &DeviceExtensions::vk_nv_geometry_shader_passthrough, ""}, // GeometryShaderPassthroughNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceTransformFeedbackFeaturesEXT, &DeviceFeatures::transform_feedback_features, &VkPhysicalDeviceTransformFeedbackFeaturesEXT::geometryStreams>, nullptr, ""}, // GeometryStreams
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT) != 0"}, // GroupNonUniform
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT) != 0"}, // GroupNonUniformArithmetic
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT) != 0"}, // GroupNonUniformBallot
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT) != 0"}, // GroupNonUniformClustered
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV) != 0"}, // GroupNonUniformPartitionedNV
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT) != 0"}, // GroupNonUniformQuad
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT) != 0"}, // GroupNonUniformShuffle
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT) != 0"}, // GroupNonUniformShuffleRelative
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan11Properties::subgroupSupportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT) != 0"}, // GroupNonUniformVote
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // Image1D
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // ImageBuffer
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::imageCubeArray>, nullptr, ""}, // ImageCubeArray
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderImageFootprintFeaturesNV, &DeviceFeatures::shader_image_footprint_features, &VkPhysicalDeviceShaderImageFootprintFeaturesNV::imageFootprint>, nullptr, ""}, // ImageFootprintNV
+    {0, nullptr, &DeviceExtensions::vk_amd_texture_gather_bias_lod, ""}, // ImageGatherBiasLodAMD
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderImageGatherExtended>, nullptr, ""}, // ImageGatherExtended
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageImageMultisample>, nullptr, ""}, // ImageMSArray
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // ImageQuery
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_image_load_store_lod, ""}, // ImageReadWriteLodAMD
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // InputAttachment
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderInputAttachmentArrayDynamicIndexing>, nullptr, ""}, // InputAttachmentArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderInputAttachmentArrayNonUniformIndexing>, nullptr, ""}, // InputAttachmentArrayNonUniformIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderInt16>, nullptr, ""}, // Int16
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderInt64>, nullptr, ""}, // Int64
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderBufferInt64Atomics>, nullptr, ""}, // Int64Atomics
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderSharedInt64Atomics>, nullptr, ""}, // Int64Atomics
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT, &DeviceFeatures::shader_image_atomic_int64_features, &VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::shaderImageInt64Atomics>, nullptr, ""}, // Int64Atomics
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT, &DeviceFeatures::shader_image_atomic_int64_features, &VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::shaderImageInt64Atomics>, nullptr, ""}, // Int64ImageEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderInt8>, nullptr, ""}, // Int8
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL, &DeviceFeatures::shader_integer_functions2_features, &VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::shaderIntegerFunctions2>, nullptr, ""}, // IntegerFunctions2INTEL
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::sampleRateShading>, nullptr, ""}, // InterpolationFunction
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // Matrix
+    {0, nullptr, &DeviceExtensions::vk_nv_mesh_shader, ""}, // MeshShadingNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderResourceMinLod>, nullptr, ""}, // MinLod
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::multiview>, nullptr, ""}, // MultiView
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::multiViewport>, nullptr, ""}, // MultiViewport
+    {0, nullptr, &DeviceExtensions::vk_nvx_multiview_per_view_attributes, ""}, // PerViewAttributesNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::bufferDeviceAddress>, nullptr, ""}, // PhysicalStorageBufferAddresses
+    {0, &IsFeatureEnabled<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT, &DeviceFeatures::buffer_device_address_ext_features, &VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::bufferDeviceAddress>, nullptr, ""}, // PhysicalStorageBufferAddresses
+    {0, &IsFeatureEnabled<VkPhysicalDeviceRayQueryFeaturesKHR, &DeviceFeatures::ray_query_features, &VkPhysicalDeviceRayQueryFeaturesKHR::rayQuery>, nullptr, ""}, // RayQueryKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceRayTracingPipelineFeaturesKHR, &DeviceFeatures::ray_tracing_pipeline_features, &VkPhysicalDeviceRayTracingPipelineFeaturesKHR::rayTracingPipeline>, nullptr, ""}, // RayTracingKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV, &DeviceFeatures::ray_tracing_motion_blur_features, &VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::rayTracingMotionBlur>, nullptr, ""}, // RayTracingMotionBlurNV
+    {0, nullptr, &DeviceExtensions::vk_nv_ray_tracing, ""}, // RayTracingNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceRayTracingPipelineFeaturesKHR, &DeviceFeatures::ray_tracing_pipeline_features, &VkPhysicalDeviceRayTracingPipelineFeaturesKHR::rayTraversalPrimitiveCulling>, nullptr, ""}, // RayTraversalPrimitiveCullingKHR
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat16 & VK_TRUE) != 0"}, // RoundingModeRTE
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat32 & VK_TRUE) != 0"}, // RoundingModeRTE
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTEFloat64 & VK_TRUE) != 0"}, // RoundingModeRTE
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat16 & VK_TRUE) != 0"}, // RoundingModeRTZ
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat32 & VK_TRUE) != 0"}, // RoundingModeRTZ
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderRoundingModeRTZFloat64 & VK_TRUE) != 0"}, // RoundingModeRTZ
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::runtimeDescriptorArray>, nullptr, ""}, // RuntimeDescriptorArray
+    {0, nullptr, &DeviceExtensions::vk_nv_sample_mask_override_coverage, ""}, // SampleMaskOverrideCoverageNV
+    {0, nullptr, &DeviceExtensions::vk_ext_post_depth_coverage, ""}, // SampleMaskPostDepthCoverage
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::sampleRateShading>, nullptr, ""}, // SampleRateShading
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // Sampled1D
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // SampledBuffer
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::imageCubeArray>, nullptr, ""}, // SampledCubeArray
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderSampledImageArrayDynamicIndexing>, nullptr, ""}, // SampledImageArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderSampledImageArrayNonUniformIndexing>, nullptr, ""}, // SampledImageArrayNonUniformIndexing
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // Shader
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_clock, ""}, // ShaderClockKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderOutputLayer>, nullptr, ""}, // ShaderLayer
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // ShaderNonUniform
+    {0, nullptr, &DeviceExtensions::vk_ext_descriptor_indexing, ""}, // ShaderNonUniform
+    {0, &IsFeatureEnabled<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV, &DeviceFeatures::shader_sm_builtins_features, &VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::shaderSMBuiltins>, nullptr, ""}, // ShaderSMBuiltinsNV
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderOutputViewportIndex>, nullptr, ""}, // ShaderViewportIndex
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_viewport_index_layer, ""}, // ShaderViewportIndexLayerEXT
+    {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}, // ShaderViewportIndexLayerNV
+    {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}, // ShaderViewportMaskNV
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat16 & VK_TRUE) != 0"}, // SignedZeroInfNanPreserve
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat32 & VK_TRUE) != 0"}, // SignedZeroInfNanPreserve
+    {0, nullptr, nullptr, "(VkPhysicalDeviceVulkan12Properties::shaderSignedZeroInfNanPreserveFloat64 & VK_TRUE) != 0"}, // SignedZeroInfNanPreserve
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderResourceResidency>, nullptr, ""}, // SparseResidency
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_stencil_export, ""}, // StencilExportEXT
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::storageBuffer16BitAccess>, nullptr, ""}, // StorageBuffer16BitAccess
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::storageBuffer8BitAccess>, nullptr, ""}, // StorageBuffer8BitAccess
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageBufferArrayDynamicIndexing>, nullptr, ""}, // StorageBufferArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderStorageBufferArrayNonUniformIndexing>, nullptr, ""}, // StorageBufferArrayNonUniformIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageImageArrayDynamicIndexing>, nullptr, ""}, // StorageImageArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderStorageImageArrayNonUniformIndexing>, nullptr, ""}, // StorageImageArrayNonUniformIndexing
+    {VK_API_VERSION_1_0, nullptr, nullptr, ""}, // StorageImageExtendedFormats
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageImageMultisample>, nullptr, ""}, // StorageImageMultisample
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageImageReadWithoutFormat>, nullptr, ""}, // StorageImageReadWithoutFormat
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // StorageImageReadWithoutFormat
+    {0, nullptr, &DeviceExtensions::vk_khr_format_feature_flags2, ""}, // StorageImageReadWithoutFormat
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderStorageImageWriteWithoutFormat>, nullptr, ""}, // StorageImageWriteWithoutFormat
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // StorageImageWriteWithoutFormat
+    {0, nullptr, &DeviceExtensions::vk_khr_format_feature_flags2, ""}, // StorageImageWriteWithoutFormat
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::storageInputOutput16>, nullptr, ""}, // StorageInputOutput16
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::storagePushConstant16>, nullptr, ""}, // StoragePushConstant16
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::storagePushConstant8>, nullptr, ""}, // StoragePushConstant8
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderStorageTexelBufferArrayDynamicIndexing>, nullptr, ""}, // StorageTexelBufferArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderStorageTexelBufferArrayNonUniformIndexing>, nullptr, ""}, // StorageTexelBufferArrayNonUniformIndexing
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_ballot, ""}, // SubgroupBallotKHR
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_vote, ""}, // SubgroupVoteKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::tessellationShader>, nullptr, ""}, // Tessellation
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize>, nullptr, ""}, // TessellationPointSize
+    {0, &IsFeatureEnabled<VkPhysicalDeviceTransformFeedbackFeaturesEXT, &DeviceFeatures::transform_feedback_features, &VkPhysicalDeviceTransformFeedbackFeaturesEXT::transformFeedback>, nullptr, ""}, // TransformFeedback
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::uniformAndStorageBuffer16BitAccess>, nullptr, ""}, // UniformAndStorageBuffer16BitAccess
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::uniformAndStorageBuffer8BitAccess>, nullptr, ""}, // UniformAndStorageBuffer8BitAccess
+    {0, &IsFeatureEnabled<VkPhysicalDeviceFeatures, &DeviceFeatures::core, &VkPhysicalDeviceFeatures::shaderUniformBufferArrayDynamicIndexing>, nullptr, ""}, // UniformBufferArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderUniformBufferArrayNonUniformIndexing>, nullptr, ""}, // UniformBufferArrayNonUniformIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderUniformTexelBufferArrayDynamicIndexing>, nullptr, ""}, // UniformTexelBufferArrayDynamicIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::shaderUniformTexelBufferArrayNonUniformIndexing>, nullptr, ""}, // UniformTexelBufferArrayNonUniformIndexing
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::variablePointers>, nullptr, ""}, // VariablePointers
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan11Features, &DeviceFeatures::core11, &VkPhysicalDeviceVulkan11Features::variablePointersStorageBuffer>, nullptr, ""}, // VariablePointersStorageBuffer
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::vulkanMemoryModel>, nullptr, ""}, // VulkanMemoryModel
+    {0, &IsFeatureEnabled<VkPhysicalDeviceVulkan12Features, &DeviceFeatures::core12, &VkPhysicalDeviceVulkan12Features::vulkanMemoryModelDeviceScope>, nullptr, ""}, // VulkanMemoryModelDeviceScope
+    {0, &IsFeatureEnabled<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR, &DeviceFeatures::workgroup_memory_explicit_layout_features, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout16BitAccess>, nullptr, ""}, // WorkgroupMemoryExplicitLayout16BitAccessKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR, &DeviceFeatures::workgroup_memory_explicit_layout_features, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout8BitAccess>, nullptr, ""}, // WorkgroupMemoryExplicitLayout8BitAccessKHR
+    {0, &IsFeatureEnabled<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR, &DeviceFeatures::workgroup_memory_explicit_layout_features, &VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::workgroupMemoryExplicitLayout>, nullptr, ""}, // WorkgroupMemoryExplicitLayoutKHR
 };
+
+// The requirements in kCapabilityRequirements of the capability, none if it is not supported by Vulkan
+static RequiredSpirvRange GetCapabilityRequirements(uint32_t capability) {
+    switch (capability) {
+        case spv::CapabilityAtomicFloat16AddEXT: return {0, 2};
+        case spv::CapabilityAtomicFloat16MinMaxEXT: return {2, 2};
+        case spv::CapabilityAtomicFloat32AddEXT: return {4, 3};
+        case spv::CapabilityAtomicFloat32MinMaxEXT: return {7, 3};
+        case spv::CapabilityAtomicFloat64AddEXT: return {10, 2};
+        case spv::CapabilityAtomicFloat64MinMaxEXT: return {12, 2};
+        case spv::CapabilityClipDistance: return {14, 1};
+        case spv::CapabilityComputeDerivativeGroupLinearNV: return {15, 1};
+        case spv::CapabilityComputeDerivativeGroupQuadsNV: return {16, 1};
+        case spv::CapabilityCooperativeMatrixNV: return {17, 1};
+        case spv::CapabilityCullDistance: return {18, 1};
+        case spv::CapabilityDemoteToHelperInvocationEXT: return {19, 2};
+        case spv::CapabilityDenormFlushToZero: return {21, 3};
+        case spv::CapabilityDenormPreserve: return {24, 3};
+        case spv::CapabilityDerivativeControl: return {27, 1};
+        case spv::CapabilityDeviceGroup: return {28, 2};
+        case spv::CapabilityDotProductInput4x8BitKHR: return {30, 2};
+        case spv::CapabilityDotProductInput4x8BitPackedKHR: return {32, 2};
+        case spv::CapabilityDotProductInputAllKHR: return {34, 2};
+        case spv::CapabilityDotProductKHR: return {36, 2};
+        case spv::CapabilityDrawParameters: return {38, 2};
+        case spv::CapabilityFloat16: return {40, 2};
+        case spv::CapabilityFloat64: return {42, 1};
+        case spv::CapabilityFragmentBarycentricNV: return {43, 1};
+        case spv::CapabilityFragmentDensityEXT: return {44, 2};
+        case spv::CapabilityFragmentMaskAMD: return {46, 1};
+        case spv::CapabilityFragmentShaderPixelInterlockEXT: return {47, 1};
+        case spv::CapabilityFragmentShaderSampleInterlockEXT: return {48, 1};
+        case spv::CapabilityFragmentShaderShadingRateInterlockEXT: return {49, 2};
+        case spv::CapabilityFragmentShadingRateKHR: return {51, 3};
+        case spv::CapabilityGeometry: return {54, 1};
+        case spv::CapabilityGeometryPointSize: return {55, 1};
+        case spv::CapabilityGeometryShaderPassthroughNV: return {56, 1};
+        case spv::CapabilityGeometryStreams: return {57, 1};
+        case spv::CapabilityGroupNonUniform: return {58, 1};
+        case spv::CapabilityGroupNonUniformArithmetic: return {59, 1};
+        case spv::CapabilityGroupNonUniformBallot: return {60, 1};
+        case spv::CapabilityGroupNonUniformClustered: return {61, 1};
+        case spv::CapabilityGroupNonUniformPartitionedNV: return {62, 1};
+        case spv::CapabilityGroupNonUniformQuad: return {63, 1};
+        case spv::CapabilityGroupNonUniformShuffle: return {64, 1};
+        case spv::CapabilityGroupNonUniformShuffleRelative: return {65, 1};
+        case spv::CapabilityGroupNonUniformVote: return {66, 1};
+        case spv::CapabilityImage1D: return {67, 1};
+        case spv::CapabilityImageBuffer: return {68, 1};
+        case spv::CapabilityImageCubeArray: return {69, 1};
+        case spv::CapabilityImageFootprintNV: return {70, 1};
+        case spv::CapabilityImageGatherBiasLodAMD: return {71, 1};
+        case spv::CapabilityImageGatherExtended: return {72, 1};
+        case spv::CapabilityImageMSArray: return {73, 1};
+        case spv::CapabilityImageQuery: return {74, 1};
+        case spv::CapabilityImageReadWriteLodAMD: return {75, 1};
+        case spv::CapabilityInputAttachment: return {76, 1};
+        case spv::CapabilityInputAttachmentArrayDynamicIndexing: return {77, 1};
+        case spv::CapabilityInputAttachmentArrayNonUniformIndexing: return {78, 1};
+        case spv::CapabilityInt16: return {79, 1};
+        case spv::CapabilityInt64: return {80, 1};
+        case spv::CapabilityInt64Atomics: return {81, 3};
+        case spv::CapabilityInt64ImageEXT: return {84, 1};
+        case spv::CapabilityInt8: return {85, 1};
+        case spv::CapabilityIntegerFunctions2INTEL: return {86, 1};
+        case spv::CapabilityInterpolationFunction: return {87, 1};
+        case spv::CapabilityMatrix: return {88, 1};
+        case spv::CapabilityMeshShadingNV: return {89, 1};
+        case spv::CapabilityMinLod: return {90, 1};
+        case spv::CapabilityMultiView: return {91, 1};
+        case spv::CapabilityMultiViewport: return {92, 1};
+        case spv::CapabilityPerViewAttributesNV: return {93, 1};
+        case spv::CapabilityPhysicalStorageBufferAddresses: return {94, 2};
+        case spv::CapabilityRayQueryKHR: return {96, 1};
+        case spv::CapabilityRayTracingKHR: return {97, 1};
+        case spv::CapabilityRayTracingMotionBlurNV: return {98, 1};
+        case spv::CapabilityRayTracingNV: return {99, 1};
+        case spv::CapabilityRayTraversalPrimitiveCullingKHR: return {100, 1};
+        case spv::CapabilityRoundingModeRTE: return {101, 3};
+        case spv::CapabilityRoundingModeRTZ: return {104, 3};
+        case spv::CapabilityRuntimeDescriptorArray: return {107, 1};
+        case spv::CapabilitySampleMaskOverrideCoverageNV: return {108, 1};
+        case spv::CapabilitySampleMaskPostDepthCoverage: return {109, 1};
+        case spv::CapabilitySampleRateShading: return {110, 1};
+        case spv::CapabilitySampled1D: return {111, 1};
+        case spv::CapabilitySampledBuffer: return {112, 1};
+        case spv::CapabilitySampledCubeArray: return {113, 1};
+        case spv::CapabilitySampledImageArrayDynamicIndexing: return {114, 1};
+        case spv::CapabilitySampledImageArrayNonUniformIndexing: return {115, 1};
+        case spv::CapabilityShader: return {116, 1};
+        case spv::CapabilityShaderClockKHR: return {117, 1};
+        case spv::CapabilityShaderLayer: return {118, 1};
+        case spv::CapabilityShaderNonUniform: return {119, 2};
+        case spv::CapabilityShaderSMBuiltinsNV: return {121, 1};
+        case spv::CapabilityShaderViewportIndex: return {122, 1};
+        case spv::CapabilityShaderViewportIndexLayerEXT: return {123, 2};
+        case spv::CapabilityShaderViewportMaskNV: return {125, 1};
+        case spv::CapabilitySignedZeroInfNanPreserve: return {126, 3};
+        case spv::CapabilitySparseResidency: return {129, 1};
+        case spv::CapabilityStencilExportEXT: return {130, 1};
+        case spv::CapabilityStorageBuffer16BitAccess: return {131, 1};
+        case spv::CapabilityStorageBuffer8BitAccess: return {132, 1};
+        case spv::CapabilityStorageBufferArrayDynamicIndexing: return {133, 1};
+        case spv::CapabilityStorageBufferArrayNonUniformIndexing: return {134, 1};
+        case spv::CapabilityStorageImageArrayDynamicIndexing: return {135, 1};
+        case spv::CapabilityStorageImageArrayNonUniformIndexing: return {136, 1};
+        case spv::CapabilityStorageImageExtendedFormats: return {137, 1};
+        case spv::CapabilityStorageImageMultisample: return {138, 1};
+        case spv::CapabilityStorageImageReadWithoutFormat: return {139, 3};
+        case spv::CapabilityStorageImageWriteWithoutFormat: return {142, 3};
+        case spv::CapabilityStorageInputOutput16: return {145, 1};
+        case spv::CapabilityStoragePushConstant16: return {146, 1};
+        case spv::CapabilityStoragePushConstant8: return {147, 1};
+        case spv::CapabilityStorageTexelBufferArrayDynamicIndexing: return {148, 1};
+        case spv::CapabilityStorageTexelBufferArrayNonUniformIndexing: return {149, 1};
+        case spv::CapabilitySubgroupBallotKHR: return {150, 1};
+        case spv::CapabilitySubgroupVoteKHR: return {151, 1};
+        case spv::CapabilityTessellation: return {152, 1};
+        case spv::CapabilityTessellationPointSize: return {153, 1};
+        case spv::CapabilityTransformFeedback: return {154, 1};
+        case spv::CapabilityUniformAndStorageBuffer16BitAccess: return {155, 1};
+        case spv::CapabilityUniformAndStorageBuffer8BitAccess: return {156, 1};
+        case spv::CapabilityUniformBufferArrayDynamicIndexing: return {157, 1};
+        case spv::CapabilityUniformBufferArrayNonUniformIndexing: return {158, 1};
+        case spv::CapabilityUniformTexelBufferArrayDynamicIndexing: return {159, 1};
+        case spv::CapabilityUniformTexelBufferArrayNonUniformIndexing: return {160, 1};
+        case spv::CapabilityVariablePointers: return {161, 1};
+        case spv::CapabilityVariablePointersStorageBuffer: return {162, 1};
+        case spv::CapabilityVulkanMemoryModel: return {163, 1};
+        case spv::CapabilityVulkanMemoryModelDeviceScope: return {164, 1};
+        case spv::CapabilityWorkgroupMemoryExplicitLayout16BitAccessKHR: return {165, 1};
+        case spv::CapabilityWorkgroupMemoryExplicitLayout8BitAccessKHR: return {166, 1};
+        case spv::CapabilityWorkgroupMemoryExplicitLayoutKHR: return {167, 1};
+        default: return {0, 0};
+    }
+}
 // clang-format on
 
+// Requirements of all extensions, those of each extension next to each other
+//
 // clang-format off
-static const std::unordered_multimap<std::string, RequiredSpirvInfo> spirvExtensions = {
-    {"SPV_AMD_gcn_shader", {0, nullptr, &DeviceExtensions::vk_amd_gcn_shader, ""}},
-    {"SPV_AMD_gpu_shader_half_float", {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_half_float, ""}},
-    {"SPV_AMD_gpu_shader_int16", {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_int16, ""}},
-    {"SPV_AMD_shader_ballot", {0, nullptr, &DeviceExtensions::vk_amd_shader_ballot, ""}},
-    {"SPV_AMD_shader_explicit_vertex_parameter", {0, nullptr, &DeviceExtensions::vk_amd_shader_explicit_vertex_parameter, ""}},
-    {"SPV_AMD_shader_fragment_mask", {0, nullptr, &DeviceExtensions::vk_amd_shader_fragment_mask, ""}},
-    {"SPV_AMD_shader_image_load_store_lod", {0, nullptr, &DeviceExtensions::vk_amd_shader_image_load_store_lod, ""}},
-    {"SPV_AMD_shader_trinary_minmax", {0, nullptr, &DeviceExtensions::vk_amd_shader_trinary_minmax, ""}},
-    {"SPV_AMD_texture_gather_bias_lod", {0, nullptr, &DeviceExtensions::vk_amd_texture_gather_bias_lod, ""}},
-    {"SPV_EXT_demote_to_helper_invocation", {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {"SPV_EXT_demote_to_helper_invocation", {0, nullptr, &DeviceExtensions::vk_ext_shader_demote_to_helper_invocation, ""}},
-    {"SPV_EXT_descriptor_indexing", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_EXT_descriptor_indexing", {0, nullptr, &DeviceExtensions::vk_ext_descriptor_indexing, ""}},
-    {"SPV_EXT_fragment_invocation_density", {0, nullptr, &DeviceExtensions::vk_ext_fragment_density_map, ""}},
-    {"SPV_EXT_fragment_shader_interlock", {0, nullptr, &DeviceExtensions::vk_ext_fragment_shader_interlock, ""}},
-    {"SPV_EXT_physical_storage_buffer", {0, nullptr, &DeviceExtensions::vk_ext_buffer_device_address, ""}},
-    {"SPV_EXT_shader_atomic_float16_add", {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float2, ""}},
-    {"SPV_EXT_shader_atomic_float_add", {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float, ""}},
-    {"SPV_EXT_shader_atomic_float_min_max", {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float2, ""}},
-    {"SPV_EXT_shader_image_int64", {0, nullptr, &DeviceExtensions::vk_ext_shader_image_atomic_int64, ""}},
-    {"SPV_EXT_shader_stencil_export", {0, nullptr, &DeviceExtensions::vk_ext_shader_stencil_export, ""}},
-    {"SPV_EXT_shader_viewport_index_layer", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_EXT_shader_viewport_index_layer", {0, nullptr, &DeviceExtensions::vk_ext_shader_viewport_index_layer, ""}},
-    {"SPV_GOOGLE_decorate_string", {0, nullptr, &DeviceExtensions::vk_google_decorate_string, ""}},
-    {"SPV_GOOGLE_hlsl_functionality1", {0, nullptr, &DeviceExtensions::vk_google_hlsl_functionality1, ""}},
-    {"SPV_GOOGLE_user_type", {0, nullptr, &DeviceExtensions::vk_google_user_type, ""}},
-    {"SPV_INTEL_shader_integer_functions", {0, nullptr, &DeviceExtensions::vk_intel_shader_integer_functions2, ""}},
-    {"SPV_KHR_16bit_storage", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_16bit_storage", {0, nullptr, &DeviceExtensions::vk_khr_16bit_storage, ""}},
-    {"SPV_KHR_8bit_storage", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_KHR_8bit_storage", {0, nullptr, &DeviceExtensions::vk_khr_8bit_storage, ""}},
-    {"SPV_KHR_device_group", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_device_group", {0, nullptr, &DeviceExtensions::vk_khr_device_group, ""}},
-    {"SPV_KHR_float_controls", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_KHR_float_controls", {0, nullptr, &DeviceExtensions::vk_khr_shader_float_controls, ""}},
-    {"SPV_KHR_fragment_shading_rate", {0, nullptr, &DeviceExtensions::vk_khr_fragment_shading_rate, ""}},
-    {"SPV_KHR_integer_dot_product", {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {"SPV_KHR_integer_dot_product", {0, nullptr, &DeviceExtensions::vk_khr_shader_integer_dot_product, ""}},
-    {"SPV_KHR_multiview", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_multiview", {0, nullptr, &DeviceExtensions::vk_khr_multiview, ""}},
-    {"SPV_KHR_non_semantic_info", {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {"SPV_KHR_non_semantic_info", {0, nullptr, &DeviceExtensions::vk_khr_shader_non_semantic_info, ""}},
-    {"SPV_KHR_physical_storage_buffer", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_KHR_physical_storage_buffer", {0, nullptr, &DeviceExtensions::vk_khr_buffer_device_address, ""}},
-    {"SPV_KHR_post_depth_coverage", {0, nullptr, &DeviceExtensions::vk_ext_post_depth_coverage, ""}},
-    {"SPV_KHR_ray_query", {0, nullptr, &DeviceExtensions::vk_khr_ray_query, ""}},
-    {"SPV_KHR_ray_tracing", {0, nullptr, &DeviceExtensions::vk_khr_ray_tracing_pipeline, ""}},
-    {"SPV_KHR_shader_ballot", {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_ballot, ""}},
-    {"SPV_KHR_shader_clock", {0, nullptr, &DeviceExtensions::vk_khr_shader_clock, ""}},
-    {"SPV_KHR_shader_draw_parameters", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_shader_draw_parameters", {0, nullptr, &DeviceExtensions::vk_khr_shader_draw_parameters, ""}},
-    {"SPV_KHR_storage_buffer_storage_class", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_storage_buffer_storage_class", {0, nullptr, &DeviceExtensions::vk_khr_storage_buffer_storage_class, ""}},
-    {"SPV_KHR_subgroup_uniform_control_flow", {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {"SPV_KHR_subgroup_uniform_control_flow", {0, nullptr, &DeviceExtensions::vk_khr_shader_subgroup_uniform_control_flow, ""}},
-    {"SPV_KHR_subgroup_vote", {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_vote, ""}},
-    {"SPV_KHR_terminate_invocation", {VK_API_VERSION_1_3, nullptr, nullptr, ""}},
-    {"SPV_KHR_terminate_invocation", {0, nullptr, &DeviceExtensions::vk_khr_shader_terminate_invocation, ""}},
-    {"SPV_KHR_variable_pointers", {VK_API_VERSION_1_1, nullptr, nullptr, ""}},
-    {"SPV_KHR_variable_pointers", {0, nullptr, &DeviceExtensions::vk_khr_variable_pointers, ""}},
-    {"SPV_KHR_vulkan_memory_model", {VK_API_VERSION_1_2, nullptr, nullptr, ""}},
-    {"SPV_KHR_vulkan_memory_model", {0, nullptr, &DeviceExtensions::vk_khr_vulkan_memory_model, ""}},
-    {"SPV_KHR_workgroup_memory_explicit_layout", {0, nullptr, &DeviceExtensions::vk_khr_workgroup_memory_explicit_layout, ""}},
-    {"SPV_NVX_multiview_per_view_attributes", {0, nullptr, &DeviceExtensions::vk_nvx_multiview_per_view_attributes, ""}},
-    {"SPV_NV_compute_shader_derivatives", {0, nullptr, &DeviceExtensions::vk_nv_compute_shader_derivatives, ""}},
-    {"SPV_NV_cooperative_matrix", {0, nullptr, &DeviceExtensions::vk_nv_cooperative_matrix, ""}},
-    {"SPV_NV_fragment_shader_barycentric", {0, nullptr, &DeviceExtensions::vk_nv_fragment_shader_barycentric, ""}},
-    {"SPV_NV_geometry_shader_passthrough", {0, nullptr, &DeviceExtensions::vk_nv_geometry_shader_passthrough, ""}},
-    {"SPV_NV_mesh_shader", {0, nullptr, &DeviceExtensions::vk_nv_mesh_shader, ""}},
-    {"SPV_NV_ray_tracing", {0, nullptr, &DeviceExtensions::vk_nv_ray_tracing, ""}},
-    {"SPV_NV_sample_mask_override_coverage", {0, nullptr, &DeviceExtensions::vk_nv_sample_mask_override_coverage, ""}},
-    {"SPV_NV_shader_image_footprint", {0, nullptr, &DeviceExtensions::vk_nv_shader_image_footprint, ""}},
-    {"SPV_NV_shader_sm_builtins", {0, nullptr, &DeviceExtensions::vk_nv_shader_sm_builtins, ""}},
-    {"SPV_NV_shader_subgroup_partitioned", {0, nullptr, &DeviceExtensions::vk_nv_shader_subgroup_partitioned, ""}},
-    {"SPV_NV_shading_rate", {0, nullptr, &DeviceExtensions::vk_nv_shading_rate_image, ""}},
-    {"SPV_NV_viewport_array2", {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}},
+static constexpr RequiredSpirvInfo kExtensionRequirements[] = {
+    {0, nullptr, &DeviceExtensions::vk_amd_gcn_shader, ""}, // SPV_AMD_gcn_shader
+    {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_half_float, ""}, // SPV_AMD_gpu_shader_half_float
+    {0, nullptr, &DeviceExtensions::vk_amd_gpu_shader_int16, ""}, // SPV_AMD_gpu_shader_int16
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_ballot, ""}, // SPV_AMD_shader_ballot
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_explicit_vertex_parameter, ""}, // SPV_AMD_shader_explicit_vertex_parameter
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_fragment_mask, ""}, // SPV_AMD_shader_fragment_mask
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_image_load_store_lod, ""}, // SPV_AMD_shader_image_load_store_lod
+    {0, nullptr, &DeviceExtensions::vk_amd_shader_trinary_minmax, ""}, // SPV_AMD_shader_trinary_minmax
+    {0, nullptr, &DeviceExtensions::vk_amd_texture_gather_bias_lod, ""}, // SPV_AMD_texture_gather_bias_lod
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // SPV_EXT_demote_to_helper_invocation
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_demote_to_helper_invocation, ""}, // SPV_EXT_demote_to_helper_invocation
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_EXT_descriptor_indexing
+    {0, nullptr, &DeviceExtensions::vk_ext_descriptor_indexing, ""}, // SPV_EXT_descriptor_indexing
+    {0, nullptr, &DeviceExtensions::vk_ext_fragment_density_map, ""}, // SPV_EXT_fragment_invocation_density
+    {0, nullptr, &DeviceExtensions::vk_ext_fragment_shader_interlock, ""}, // SPV_EXT_fragment_shader_interlock
+    {0, nullptr, &DeviceExtensions::vk_ext_buffer_device_address, ""}, // SPV_EXT_physical_storage_buffer
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float2, ""}, // SPV_EXT_shader_atomic_float16_add
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float, ""}, // SPV_EXT_shader_atomic_float_add
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_atomic_float2, ""}, // SPV_EXT_shader_atomic_float_min_max
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_image_atomic_int64, ""}, // SPV_EXT_shader_image_int64
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_stencil_export, ""}, // SPV_EXT_shader_stencil_export
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_EXT_shader_viewport_index_layer
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_viewport_index_layer, ""}, // SPV_EXT_shader_viewport_index_layer
+    {0, nullptr, &DeviceExtensions::vk_google_decorate_string, ""}, // SPV_GOOGLE_decorate_string
+    {0, nullptr, &DeviceExtensions::vk_google_hlsl_functionality1, ""}, // SPV_GOOGLE_hlsl_functionality1
+    {0, nullptr, &DeviceExtensions::vk_google_user_type, ""}, // SPV_GOOGLE_user_type
+    {0, nullptr, &DeviceExtensions::vk_intel_shader_integer_functions2, ""}, // SPV_INTEL_shader_integer_functions
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_16bit_storage
+    {0, nullptr, &DeviceExtensions::vk_khr_16bit_storage, ""}, // SPV_KHR_16bit_storage
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_KHR_8bit_storage
+    {0, nullptr, &DeviceExtensions::vk_khr_8bit_storage, ""}, // SPV_KHR_8bit_storage
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_device_group
+    {0, nullptr, &DeviceExtensions::vk_khr_device_group, ""}, // SPV_KHR_device_group
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_KHR_float_controls
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_float_controls, ""}, // SPV_KHR_float_controls
+    {0, nullptr, &DeviceExtensions::vk_khr_fragment_shading_rate, ""}, // SPV_KHR_fragment_shading_rate
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // SPV_KHR_integer_dot_product
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_integer_dot_product, ""}, // SPV_KHR_integer_dot_product
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_multiview
+    {0, nullptr, &DeviceExtensions::vk_khr_multiview, ""}, // SPV_KHR_multiview
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // SPV_KHR_non_semantic_info
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_non_semantic_info, ""}, // SPV_KHR_non_semantic_info
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_KHR_physical_storage_buffer
+    {0, nullptr, &DeviceExtensions::vk_khr_buffer_device_address, ""}, // SPV_KHR_physical_storage_buffer
+    {0, nullptr, &DeviceExtensions::vk_ext_post_depth_coverage, ""}, // SPV_KHR_post_depth_coverage
+    {0, nullptr, &DeviceExtensions::vk_khr_ray_query, ""}, // SPV_KHR_ray_query
+    {0, nullptr, &DeviceExtensions::vk_khr_ray_tracing_pipeline, ""}, // SPV_KHR_ray_tracing
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_ballot, ""}, // SPV_KHR_shader_ballot
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_clock, ""}, // SPV_KHR_shader_clock
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_shader_draw_parameters
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_draw_parameters, ""}, // SPV_KHR_shader_draw_parameters
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_storage_buffer_storage_class
+    {0, nullptr, &DeviceExtensions::vk_khr_storage_buffer_storage_class, ""}, // SPV_KHR_storage_buffer_storage_class
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // SPV_KHR_subgroup_uniform_control_flow
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_subgroup_uniform_control_flow, ""}, // SPV_KHR_subgroup_uniform_control_flow
+    {0, nullptr, &DeviceExtensions::vk_ext_shader_subgroup_vote, ""}, // SPV_KHR_subgroup_vote
+    {VK_API_VERSION_1_3, nullptr, nullptr, ""}, // SPV_KHR_terminate_invocation
+    {0, nullptr, &DeviceExtensions::vk_khr_shader_terminate_invocation, ""}, // SPV_KHR_terminate_invocation
+    {VK_API_VERSION_1_1, nullptr, nullptr, ""}, // SPV_KHR_variable_pointers
+    {0, nullptr, &DeviceExtensions::vk_khr_variable_pointers, ""}, // SPV_KHR_variable_pointers
+    {VK_API_VERSION_1_2, nullptr, nullptr, ""}, // SPV_KHR_vulkan_memory_model
+    {0, nullptr, &DeviceExtensions::vk_khr_vulkan_memory_model, ""}, // SPV_KHR_vulkan_memory_model
+    {0, nullptr, &DeviceExtensions::vk_khr_workgroup_memory_explicit_layout, ""}, // SPV_KHR_workgroup_memory_explicit_layout
+    {0, nullptr, &DeviceExtensions::vk_nvx_multiview_per_view_attributes, ""}, // SPV_NVX_multiview_per_view_attributes
+    {0, nullptr, &DeviceExtensions::vk_nv_compute_shader_derivatives, ""}, // SPV_NV_compute_shader_derivatives
+    {0, nullptr, &DeviceExtensions::vk_nv_cooperative_matrix, ""}, // SPV_NV_cooperative_matrix
+    {0, nullptr, &DeviceExtensions::vk_nv_fragment_shader_barycentric, ""}, // SPV_NV_fragment_shader_barycentric
+    {0, nullptr, &DeviceExtensions::vk_nv_geometry_shader_passthrough, ""}, // SPV_NV_geometry_shader_passthrough
+    {0, nullptr, &DeviceExtensions::vk_nv_mesh_shader, ""}, // SPV_NV_mesh_shader
+    {0, nullptr, &DeviceExtensions::vk_nv_ray_tracing, ""}, // SPV_NV_ray_tracing
+    {0, nullptr, &DeviceExtensions::vk_nv_sample_mask_override_coverage, ""}, // SPV_NV_sample_mask_override_coverage
+    {0, nullptr, &DeviceExtensions::vk_nv_shader_image_footprint, ""}, // SPV_NV_shader_image_footprint
+    {0, nullptr, &DeviceExtensions::vk_nv_shader_sm_builtins, ""}, // SPV_NV_shader_sm_builtins
+    {0, nullptr, &DeviceExtensions::vk_nv_shader_subgroup_partitioned, ""}, // SPV_NV_shader_subgroup_partitioned
+    {0, nullptr, &DeviceExtensions::vk_nv_shading_rate_image, ""}, // SPV_NV_shading_rate
+    {0, nullptr, &DeviceExtensions::vk_nv_viewport_array2, ""}, // SPV_NV_viewport_array2
 };
+
+// A perfect hash of the extension names, the slot of each in kExtensionSlots
+static uint32_t SpirvExtensionSlot(const char *name) {
+    uint32_t hash = 2166139253u;
+    for (; *name != '\0'; ++name) {
+        hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+    }
+    return hash >> 24;
+}
+
+struct SpirvExtensionInfo {
+    const char *name;
+    RequiredSpirvRange requirements;
+};
+
+// Each extension, after an empty entry for the slots without one
+static constexpr SpirvExtensionInfo kExtensionInfos[] = {
+    {nullptr, {0, 0}},
+    {"SPV_AMD_gcn_shader", {0, 1}},
+    {"SPV_AMD_gpu_shader_half_float", {1, 1}},
+    {"SPV_AMD_gpu_shader_int16", {2, 1}},
+    {"SPV_AMD_shader_ballot", {3, 1}},
+    {"SPV_AMD_shader_explicit_vertex_parameter", {4, 1}},
+    {"SPV_AMD_shader_fragment_mask", {5, 1}},
+    {"SPV_AMD_shader_image_load_store_lod", {6, 1}},
+    {"SPV_AMD_shader_trinary_minmax", {7, 1}},
+    {"SPV_AMD_texture_gather_bias_lod", {8, 1}},
+    {"SPV_EXT_demote_to_helper_invocation", {9, 2}},
+    {"SPV_EXT_descriptor_indexing", {11, 2}},
+    {"SPV_EXT_fragment_invocation_density", {13, 1}},
+    {"SPV_EXT_fragment_shader_interlock", {14, 1}},
+    {"SPV_EXT_physical_storage_buffer", {15, 1}},
+    {"SPV_EXT_shader_atomic_float16_add", {16, 1}},
+    {"SPV_EXT_shader_atomic_float_add", {17, 1}},
+    {"SPV_EXT_shader_atomic_float_min_max", {18, 1}},
+    {"SPV_EXT_shader_image_int64", {19, 1}},
+    {"SPV_EXT_shader_stencil_export", {20, 1}},
+    {"SPV_EXT_shader_viewport_index_layer", {21, 2}},
+    {"SPV_GOOGLE_decorate_string", {23, 1}},
+    {"SPV_GOOGLE_hlsl_functionality1", {24, 1}},
+    {"SPV_GOOGLE_user_type", {25, 1}},
+    {"SPV_INTEL_shader_integer_functions", {26, 1}},
+    {"SPV_KHR_16bit_storage", {27, 2}},
+    {"SPV_KHR_8bit_storage", {29, 2}},
+    {"SPV_KHR_device_group", {31, 2}},
+    {"SPV_KHR_float_controls", {33, 2}},
+    {"SPV_KHR_fragment_shading_rate", {35, 1}},
+    {"SPV_KHR_integer_dot_product", {36, 2}},
+    {"SPV_KHR_multiview", {38, 2}},
+    {"SPV_KHR_non_semantic_info", {40, 2}},
+    {"SPV_KHR_physical_storage_buffer", {42, 2}},
+    {"SPV_KHR_post_depth_coverage", {44, 1}},
+    {"SPV_KHR_ray_query", {45, 1}},
+    {"SPV_KHR_ray_tracing", {46, 1}},
+    {"SPV_KHR_shader_ballot", {47, 1}},
+    {"SPV_KHR_shader_clock", {48, 1}},
+    {"SPV_KHR_shader_draw_parameters", {49, 2}},
+    {"SPV_KHR_storage_buffer_storage_class", {51, 2}},
+    {"SPV_KHR_subgroup_uniform_control_flow", {53, 2}},
+    {"SPV_KHR_subgroup_vote", {55, 1}},
+    {"SPV_KHR_terminate_invocation", {56, 2}},
+    {"SPV_KHR_variable_pointers", {58, 2}},
+    {"SPV_KHR_vulkan_memory_model", {60, 2}},
+    {"SPV_KHR_workgroup_memory_explicit_layout", {62, 1}},
+    {"SPV_NVX_multiview_per_view_attributes", {63, 1}},
+    {"SPV_NV_compute_shader_derivatives", {64, 1}},
+    {"SPV_NV_cooperative_matrix", {65, 1}},
+    {"SPV_NV_fragment_shader_barycentric", {66, 1}},
+    {"SPV_NV_geometry_shader_passthrough", {67, 1}},
+    {"SPV_NV_mesh_shader", {68, 1}},
+    {"SPV_NV_ray_tracing", {69, 1}},
+    {"SPV_NV_sample_mask_override_coverage", {70, 1}},
+    {"SPV_NV_shader_image_footprint", {71, 1}},
+    {"SPV_NV_shader_sm_builtins", {72, 1}},
+    {"SPV_NV_shader_subgroup_partitioned", {73, 1}},
+    {"SPV_NV_shading_rate", {74, 1}},
+    {"SPV_NV_viewport_array2", {75, 1}},
+};
+
+// The index in kExtensionInfos of the extension in each slot of the hash
+static constexpr uint8_t kExtensionSlots[256] = {
+    0, 34, 0, 0, 0, 0, 32, 0, 47, 0, 58, 0, 0, 23, 0, 0,
+    0, 26, 0, 57, 33, 0, 0, 0, 42, 0, 31, 0, 0, 0, 0, 13,
+    39, 0, 0, 0, 0, 37, 36, 0, 0, 0, 0, 0, 0, 24, 30, 0,
+    0, 0, 0, 29, 0, 0, 0, 51, 0, 0, 0, 0, 52, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 14, 0, 0, 0, 0, 0, 0, 0, 4, 11,
+    0, 54, 35, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 28, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0,
+    0, 0, 0, 0, 38, 0, 0, 3, 0, 53, 40, 0, 46, 27, 0, 0,
+    0, 10, 22, 0, 0, 41, 0, 19, 0, 0, 15, 2, 0, 59, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 50,
+    0, 0, 21, 0, 0, 0, 0, 0, 17, 48, 0, 0, 12, 44, 25, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+    55, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// The requirements in kExtensionRequirements of the extension, none if it is not supported by Vulkan
+static RequiredSpirvRange GetExtensionRequirements(const char *name) {
+    const SpirvExtensionInfo &info = kExtensionInfos[kExtensionSlots[SpirvExtensionSlot(name)]];
+    if ((info.name != nullptr) && (strcmp(info.name, name) == 0)) {
+        return info.requirements;
+    }
+    return {0, 0};
+}
 // clang-format on
 
 static inline const char* string_SpvCapability(uint32_t input_value) {
@@ -631,7 +836,8 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
 
     if (insn.opcode() == spv::OpCapability) {
         // All capabilities are generated so if it is not in the list it is not supported by Vulkan
-        if (spirvCapabilities.count(insn.word(1)) == 0) {
+        const RequiredSpirvRange caps = GetCapabilityRequirements(insn.word(1));
+        if (caps.count == 0) {
             skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-01090",
                 "vkCreateShaderModule(): A SPIR-V Capability (%s) was declared that is not supported by Vulkan.", string_SpvCapability(insn.word(1)));
             return skip; // no known capability to validate
@@ -640,24 +846,24 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
         // Each capability has one or more requirements to check
         // Only one item has to be satisfied and an error only occurs
         // when all are not satisfied
-        auto caps = spirvCapabilities.equal_range(insn.word(1));
         bool has_support = false;
-        for (auto it = caps.first; (it != caps.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
+        for (uint32_t i = caps.first; (i < caps.first + caps.count) && (has_support == false); ++i) {
+            const RequiredSpirvInfo &requirement = kCapabilityRequirements[i];
+            if (requirement.version) {
+                if (api_version >= requirement.version) {
                     has_support = true;
                 }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
+            } else if (requirement.feature) {
+                if (requirement.feature.IsEnabled(enabled_features)) {
                     has_support = true;
                 }
-            } else if (it->second.extension) {
+            } else if (requirement.extension) {
                 // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
-                // If the new Api Level gives support, it will be caught in the "it->second.version" check instead.
-                if (IsExtEnabledByCreateinfo(device_extensions.*(it->second.extension))) {
+                // If the new Api Level gives support, it will be caught in the "requirement.version" check instead.
+                if (IsExtEnabledByCreateinfo(device_extensions.*(requirement.extension))) {
                     has_support = true;
                 }
-            } else if (it->second.property) {
+            } else if (requirement.property) {
                 // support is or'ed as only one has to be supported (if applicable)
                 switch (insn.word(1)) {
                     case spv::CapabilityDenormFlushToZero:
@@ -733,42 +939,42 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
             }
         }
     } else if (insn.opcode() == spv::OpExtension) {
-        static const std::string spv_prefix = "SPV_";
-        std::string extension_name = (char const *)&insn.word(1);
+        const char *extension_name = reinterpret_cast<const char *>(&insn.word(1));
+        const RequiredSpirvRange ext = GetExtensionRequirements(extension_name);
 
-        if (0 == extension_name.compare(0, spv_prefix.size(), spv_prefix)) {
-            if (spirvExtensions.count(extension_name) == 0) {
+        if (strncmp(extension_name, "SPV_", 4) == 0) {
+            if (ext.count == 0) {
                 skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-04146",
-                    "vkCreateShaderModule(): A SPIR-V Extension (%s) was declared that is not supported by Vulkan.", extension_name.c_str());
+                    "vkCreateShaderModule(): A SPIR-V Extension (%s) was declared that is not supported by Vulkan.", extension_name);
                 return skip; // no known extension to validate
             }
         } else {
             skip |= LogError(device, kVUID_Core_Shader_InvalidExtension,
                 "vkCreateShaderModule(): The SPIR-V code uses the '%s' extension which is not a SPIR-V extension. Please use a SPIR-V"
                 " extension (https://github.com/KhronosGroup/SPIRV-Registry) for OpExtension instructions. Non-SPIR-V extensions can be"
-                " recorded in SPIR-V using the OpSourceExtension instruction.", extension_name.c_str());
+                " recorded in SPIR-V using the OpSourceExtension instruction.", extension_name);
             return skip; // no known extension to validate
         }
 
         // Each SPIR-V Extension has one or more requirements to check
         // Only one item has to be satisfied and an error only occurs
         // when all are not satisfied
-        auto ext = spirvExtensions.equal_range(extension_name);
         bool has_support = false;
-        for (auto it = ext.first; (it != ext.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
+        for (uint32_t i = ext.first; (i < ext.first + ext.count) && (has_support == false); ++i) {
+            const RequiredSpirvInfo &requirement = kExtensionRequirements[i];
+            if (requirement.version) {
+                if (api_version >= requirement.version) {
                     has_support = true;
                 }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
+            } else if (requirement.feature) {
+                if (requirement.feature.IsEnabled(enabled_features)) {
                     has_support = true;
                 }
-            } else if (it->second.extension) {
-                if (IsExtEnabled(device_extensions.*(it->second.extension))) {
+            } else if (requirement.extension) {
+                if (IsExtEnabled(device_extensions.*(requirement.extension))) {
                     has_support = true;
                 }
-            } else if (it->second.property) {
+            } else if (requirement.property) {
                 // support is or'ed as only one has to be supported (if applicable)
                 switch (insn.word(1)) {
                     default:
@@ -779,7 +985,7 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
 
         if (has_support == false) {
             skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-04147",
-                "vkCreateShaderModule(): The SPIR-V Extension (%s) was declared, but none of the requirements were met to use it.", extension_name.c_str());
+                "vkCreateShaderModule(): The SPIR-V Extension (%s) was declared, but none of the requirements were met to use it.", extension_name);
         }
     } //spv::OpExtension
     return skip;
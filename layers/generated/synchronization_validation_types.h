@@ -33,12 +33,11 @@
 #pragma once
 
 #include <array>
-#include <bitset>
 #include <map>
 #include <stdint.h>
 #include <vulkan/vulkan.h>
 #include "vk_layer_data.h"
-using SyncStageAccessFlags = std::bitset<128>;
+#include "sync_stage_access_flags.h"
 
 // clang-format off
 
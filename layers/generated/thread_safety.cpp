@@ -49,8 +49,9 @@ void ThreadSafety::PostCallRecordAllocateCommandBuffers(VkDevice device, const V
     if(pCommandBuffers) {
         auto lock = WriteLockGuard(thread_safety_lock);
         auto &pool_command_buffers = pool_command_buffers_map[pAllocateInfo->commandPool];
+        ObjectUseData *pool_use_data = CommandPoolCounter().FindObject(pAllocateInfo->commandPool);
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            command_pool_map.insert_or_assign(pCommandBuffers[index], pAllocateInfo->commandPool);
+            command_pool_map.insert_or_assign(pCommandBuffers[index], CommandBufferPool{pAllocateInfo->commandPool, pool_use_data});
             CreateObject(pCommandBuffers[index]);
             pool_command_buffers.insert(pCommandBuffers[index]);
         }
@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -76,11 +77,20 @@ public:
         int64_t count;
     };
 
-    ObjectUseData() : thread(0), writer_reader_count(0) {
+    ObjectUseData() : thread(0), owner_thread(0), writer_reader_count(0), owner_uses(0), shared(false) {
         // silence -Wunused-private-field warning
         padding[0] = 0;
     }
 
+    // Prepare for reuse by a new object
+    void Reset() {
+        thread.store(0, std::memory_order_relaxed);
+        owner_thread.store(0, std::memory_order_relaxed);
+        writer_reader_count.store(0, std::memory_order_relaxed);
+        owner_uses.store(0, std::memory_order_relaxed);
+        shared.store(false, std::memory_order_relaxed);
+    }
+
     WriteReadCount AddWriter() {
         int64_t prev = writer_reader_count.fetch_add(1ULL << 32);
         return WriteReadCount(prev);
@@ -109,16 +119,33 @@ public:
     }
 
     std::atomic<loader_platform_thread_id> thread;
+    // For the owned uses of counter::StartOwnedWrite(), the first thread to make one
+    std::atomic<loader_platform_thread_id> owner_thread;
 
 private:
     // need to update write and read counts atomically. Writer in high
     // 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count;
 
+public:
+    // Owned uses in progress that skipped writer_reader_count, only changed by owner_thread
+    std::atomic<int32_t> owner_uses;
+    // Set once a thread other than owner_thread uses the object, after which all its uses are counted
+    std::atomic<bool> shared;
+
+private:
     // Put each lock on its own cache line to avoid false cache line sharing.
-    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>))) & 63];
+    char padding[(-int(2 * sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>) +
+                       sizeof(std::atomic<int32_t>) + sizeof(std::atomic<bool>))) &
+                 63];
 };
 
+// The ObjectUseData of the objects of one handle type. Finding an object takes no lock and makes no atomic read-modify-write,
+// so a thread-safety check of an object costs the one atomic on its use count. The ObjectUseData are only freed with the
+// table, so a find racing with the destruction of its object, itself a threading error, never touches freed memory. A stale
+// find can give the ObjectUseData of the object created next, which at worst misattributes the report of that error.
+typedef vl_concurrent_handle_map<ObjectUseData> ObjectUseTable;
+
 
 template <typename T>
 class counter {
@@ -127,34 +154,82 @@ public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseTable object_table;
+
+    // With khronos_validation.thread_safety_sampling set to N, only the objects whose handles hash into one N-th of the hash
+    // values are tracked, so each use of another object costs a multiply. The sample is the same at every use of an object.
+    // Command pools and command buffers, whose external synchronization is the most error prone, are always tracked.
+    bool Tracked(T object) const {
+        const uint32_t sampling = object_data ? object_data->thread_safety_sampling : 0;
+        if (sampling <= 1 || object_type == kVulkanObjectTypeCommandBuffer || object_type == kVulkanObjectTypeCommandPool) {
+            return true;
+        }
+        return ((((uint64_t)(object)) * 0x9E3779B97F4A7C15ULL) >> 32) % sampling == 0;
+    }
+
+    // The ObjectUseData of the objects with an entry in the handle registry are found there first
+    HandleRegistry *Registry() const {
+        return object_data ? object_data->handle_registry.get() : nullptr;
+    }
 
     void CreateObject(T object) {
-        object_table.insert(object, std::make_shared<ObjectUseData>());
+        if (!Tracked(object)) {
+            return;
+        }
+        // Objects created again, like queues, keep their ObjectUseData
+        ObjectUseData *created = nullptr;
+        object_table.insert((uint64_t)(object), [&created](ObjectUseData &use_data) {
+            use_data.Reset();
+            created = &use_data;
+        });
+        HandleRegistry *registry = Registry();
+        if (created && registry) {
+            registry->Set((uint64_t)(object), kHandleRecordThreadSafety, created);
+        }
     }
 
     void DestroyObject(T object) {
-        if (object) {
-            object_table.erase(object);
+        if (object && Tracked(object)) {
+            HandleRegistry *registry = Registry();
+            if (registry) {
+                registry->Clear((uint64_t)(object), kHandleRecordThreadSafety);
+            }
+            object_table.erase((uint64_t)(object));
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object) {
-        assert(object_table.contains(object));
-        auto iter = std::move(object_table.find(object));
-        if (iter != object_table.end()) {
-            return std::move(iter->second);
-        } else {
+    // Any use from a thread other than the owner of the object's owned writes ends them, see StartOwnedWrite()
+    void CheckOwner(T object, ObjectUseData *use_data, loader_platform_thread_id tid, const char *api_name) {
+        const loader_platform_thread_id owner = use_data->owner_thread.load(std::memory_order_relaxed);
+        if (owner == 0 || owner == tid) {
+            return;
+        }
+        use_data->shared.store(true, std::memory_order_relaxed);
+        if (use_data->owner_uses.load(std::memory_order_relaxed) > 0) {
+            object_data->LogError(object, kVUID_Threading_MultipleThreads,
+                "THREADING ERROR : %s(): object of type %s is simultaneously used in "
+                "thread 0x%" PRIx64 " and thread 0x%" PRIx64, api_name,
+                typeName, (uint64_t)owner, (uint64_t)tid);
+        }
+    }
+
+    ObjectUseData *FindObject(T object) {
+        HandleRegistry *registry = Registry();
+        ObjectUseData *use_data = registry ? registry->Find<ObjectUseData>((uint64_t)(object), kHandleRecordThreadSafety) : nullptr;
+        if (!use_data) {
+            use_data = object_table.find((uint64_t)(object));
+        }
+        if (!use_data) {
             object_data->LogError(object, kVUID_Threading_Info,
                     "Couldn't find %s Object 0x%" PRIxLEAST64
                     ". This should not happen and may indicate a bug in the application.",
                     object_string[object_type], (uint64_t)(object));
-            return nullptr;
         }
+        return use_data;
     }
 
     void StartWrite(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !Tracked(object)) {
             return;
         }
         bool skip = false;
@@ -164,6 +239,7 @@ public:
         if (!use_data) {
             return;
         }
+        CheckOwner(object, use_data, tid, api_name);
         const ObjectUseData::WriteReadCount prevCount = use_data->AddWriter();
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
@@ -216,7 +292,7 @@ public:
     }
 
     void FinishWrite(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !Tracked(object)) {
             return;
         }
         // Object is no longer in use
@@ -228,7 +304,7 @@ public:
     }
 
     void StartRead(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !Tracked(object)) {
             return;
         }
         bool skip = false;
@@ -238,6 +314,7 @@ public:
         if (!use_data) {
             return;
         }
+        CheckOwner(object, use_data, tid, api_name);
         const ObjectUseData::WriteReadCount prevCount = use_data->AddReader();
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
@@ -259,7 +336,7 @@ public:
         }
     }
     void FinishRead(T object, const char *api_name) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !Tracked(object)) {
             return;
         }
 
@@ -269,6 +346,34 @@ public:
         }
         use_data->RemoveReader();
     }
+
+    // A write by the thread that has made every owned write of the object so far only bumps owner_uses, which no other thread
+    // changes. The first use from another thread, owned or not, marks the object shared, and its uses are counted from then on.
+    // A collision in the instant the object becomes shared may be missed, any later one is reported. use_data must be the
+    // object's, as cached at its creation.
+    void StartOwnedWrite(T object, ObjectUseData *use_data, const char *api_name) {
+        const loader_platform_thread_id tid = loader_platform_get_thread_id();
+        loader_platform_thread_id owner = use_data->owner_thread.load(std::memory_order_relaxed);
+        if (owner == 0 && use_data->owner_thread.compare_exchange_strong(owner, tid)) {
+            owner = tid;
+        }
+        if (owner == tid && !use_data->shared.load(std::memory_order_relaxed) &&
+            use_data->GetCount().GetReadCount() == 0 && use_data->GetCount().GetWriteCount() == 0) {
+            use_data->owner_uses.store(use_data->owner_uses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        StartWrite(object, api_name);
+    }
+
+    void FinishOwnedWrite(T object, ObjectUseData *use_data, const char *api_name) {
+        const int32_t owner_uses = use_data->owner_uses.load(std::memory_order_relaxed);
+        if (owner_uses > 0 && use_data->owner_thread.load(std::memory_order_relaxed) == loader_platform_get_thread_id()) {
+            use_data->owner_uses.store(owner_uses - 1, std::memory_order_relaxed);
+            return;
+        }
+        FinishWrite(object, api_name);
+    }
+
     counter(const char *name = "", VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr) {
             typeName = name;
         object_type = type;
@@ -288,7 +393,17 @@ public:
     ReadLockGuard ReadLock() override;
     WriteLockGuard WriteLock() override;
 
-    vl_concurrent_unordered_map<VkCommandBuffer, VkCommandPool, 6> command_pool_map;
+    // The pool of each command buffer, and the pool's ObjectUseData for its owned writes by the commands recorded in the buffer
+    struct CommandBufferPool {
+        VkCommandPool pool;
+        ObjectUseData *pool_use_data;
+    };
+    vl_concurrent_unordered_map<VkCommandBuffer, CommandBufferPool, 6> command_pool_map;
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+    counter<VkCommandPool> &CommandPoolCounter() { return c_VkCommandPool; }
+#else
+    counter<VkCommandPool> &CommandPoolCounter() { return c_uint64_t; }
+#endif
     layer_data::unordered_map<VkCommandPool, layer_data::unordered_set<VkCommandBuffer>> pool_command_buffers_map;
     layer_data::unordered_map<VkDevice, layer_data::unordered_set<VkQueue>> device_queues_map;
 
@@ -544,13 +659,18 @@ WRAPPER_PARENT_INSTANCE(uint64_t)
         c_VkCommandBuffer.DestroyObject(object);
     }
 
-    // VkCommandBuffer needs check for implicit use of command pool
+    // VkCommandBuffer needs check for implicit use of command pool. A pool used from one thread only, as with a pool per thread,
+    // is checked with owned writes.
     void StartWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
-                StartWriteObject(pool, api_name);
+                const CommandBufferPool &pool = iter->second;
+                if (pool.pool_use_data) {
+                    CommandPoolCounter().StartOwnedWrite(pool.pool, pool.pool_use_data, api_name);
+                } else {
+                    StartWriteObject(pool.pool, api_name);
+                }
             }
         }
         c_VkCommandBuffer.StartWrite(object, api_name);
@@ -560,15 +680,19 @@ WRAPPER_PARENT_INSTANCE(uint64_t)
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
-                FinishWriteObject(pool, api_name);
+                const CommandBufferPool &pool = iter->second;
+                if (pool.pool_use_data) {
+                    CommandPoolCounter().FinishOwnedWrite(pool.pool, pool.pool_use_data, api_name);
+                } else {
+                    FinishWriteObject(pool.pool, api_name);
+                }
             }
         }
     }
     void StartReadObject(VkCommandBuffer object, const char *api_name) {
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
-            VkCommandPool pool = iter->second;
+            VkCommandPool pool = iter->second.pool;
             // We set up a read guard against the "Contents" counter to catch conflict vs. vkResetCommandPool and vkDestroyCommandPool
             // while *not* establishing a read guard against the command pool counter itself to avoid false positive for
             // non-externally sync'd command buffers
@@ -580,7 +704,7 @@ WRAPPER_PARENT_INSTANCE(uint64_t)
         c_VkCommandBuffer.FinishRead(object, api_name);
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
-            VkCommandPool pool = iter->second;
+            VkCommandPool pool = iter->second.pool;
             c_VkCommandPoolContents.FinishRead(pool, api_name);
         }
     }
@@ -39,6 +39,8 @@
 
 template <VkStructureType id> struct LvlSTypeMap {};
 template <typename T> struct LvlTypeMap {};
+// Specialized with a compact index for each type that can extend another through pNext
+template <typename T> struct LvlPNextIndexMap {};
 
 // Map type VkBufferMemoryBarrier to id VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER
 template <> struct LvlTypeMap<VkBufferMemoryBarrier> {
@@ -220,6 +222,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO> {
     typedef VkShaderModuleCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkShaderModuleCreateInfo> {
+    static const uint32_t kIndex = 0;
+};
+
 // Map type VkPipelineCacheCreateInfo to id VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO
 template <> struct LvlTypeMap<VkPipelineCacheCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
@@ -472,6 +478,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPER
     typedef VkPhysicalDeviceSubgroupProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSubgroupProperties> {
+    static const uint32_t kIndex = 1;
+};
+
 // Map type VkBindBufferMemoryInfo to id VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO
 template <> struct LvlTypeMap<VkBindBufferMemoryInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO;
@@ -499,6 +509,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_F
     typedef VkPhysicalDevice16BitStorageFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevice16BitStorageFeatures> {
+    static const uint32_t kIndex = 2;
+};
+
 // Map type VkMemoryDedicatedRequirements to id VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS
 template <> struct LvlTypeMap<VkMemoryDedicatedRequirements> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
@@ -508,6 +522,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS>
     typedef VkMemoryDedicatedRequirements Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryDedicatedRequirements> {
+    static const uint32_t kIndex = 3;
+};
+
 // Map type VkMemoryDedicatedAllocateInfo to id VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO
 template <> struct LvlTypeMap<VkMemoryDedicatedAllocateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
@@ -517,6 +535,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO>
     typedef VkMemoryDedicatedAllocateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryDedicatedAllocateInfo> {
+    static const uint32_t kIndex = 4;
+};
+
 // Map type VkMemoryAllocateFlagsInfo to id VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO
 template <> struct LvlTypeMap<VkMemoryAllocateFlagsInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
@@ -526,6 +548,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO> {
     typedef VkMemoryAllocateFlagsInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryAllocateFlagsInfo> {
+    static const uint32_t kIndex = 5;
+};
+
 // Map type VkDeviceGroupRenderPassBeginInfo to id VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO
 template <> struct LvlTypeMap<VkDeviceGroupRenderPassBeginInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO;
@@ -535,6 +561,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_
     typedef VkDeviceGroupRenderPassBeginInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupRenderPassBeginInfo> {
+    static const uint32_t kIndex = 6;
+};
+
 // Map type VkDeviceGroupCommandBufferBeginInfo to id VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO
 template <> struct LvlTypeMap<VkDeviceGroupCommandBufferBeginInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO;
@@ -544,6 +574,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEG
     typedef VkDeviceGroupCommandBufferBeginInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupCommandBufferBeginInfo> {
+    static const uint32_t kIndex = 7;
+};
+
 // Map type VkDeviceGroupSubmitInfo to id VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO
 template <> struct LvlTypeMap<VkDeviceGroupSubmitInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO;
@@ -553,6 +587,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO> {
     typedef VkDeviceGroupSubmitInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupSubmitInfo> {
+    static const uint32_t kIndex = 8;
+};
+
 // Map type VkDeviceGroupBindSparseInfo to id VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO
 template <> struct LvlTypeMap<VkDeviceGroupBindSparseInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO;
@@ -562,6 +600,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO>
     typedef VkDeviceGroupBindSparseInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupBindSparseInfo> {
+    static const uint32_t kIndex = 9;
+};
+
 // Map type VkBindBufferMemoryDeviceGroupInfo to id VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO
 template <> struct LvlTypeMap<VkBindBufferMemoryDeviceGroupInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO;
@@ -571,6 +613,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP
     typedef VkBindBufferMemoryDeviceGroupInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBindBufferMemoryDeviceGroupInfo> {
+    static const uint32_t kIndex = 10;
+};
+
 // Map type VkBindImageMemoryDeviceGroupInfo to id VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO
 template <> struct LvlTypeMap<VkBindImageMemoryDeviceGroupInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO;
@@ -580,6 +626,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_
     typedef VkBindImageMemoryDeviceGroupInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBindImageMemoryDeviceGroupInfo> {
+    static const uint32_t kIndex = 11;
+};
+
 // Map type VkPhysicalDeviceGroupProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceGroupProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
@@ -598,6 +648,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO
     typedef VkDeviceGroupDeviceCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupDeviceCreateInfo> {
+    static const uint32_t kIndex = 12;
+};
+
 // Map type VkBufferMemoryRequirementsInfo2 to id VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2
 template <> struct LvlTypeMap<VkBufferMemoryRequirementsInfo2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
@@ -652,6 +706,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2> {
     typedef VkPhysicalDeviceFeatures2 Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFeatures2> {
+    static const uint32_t kIndex = 13;
+};
+
 // Map type VkPhysicalDeviceProperties2 to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2
 template <> struct LvlTypeMap<VkPhysicalDeviceProperties2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
@@ -733,6 +791,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_
     typedef VkPhysicalDevicePointClippingProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePointClippingProperties> {
+    static const uint32_t kIndex = 14;
+};
+
 // Map type VkRenderPassInputAttachmentAspectCreateInfo to id VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO
 template <> struct LvlTypeMap<VkRenderPassInputAttachmentAspectCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO;
@@ -742,6 +804,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_AS
     typedef VkRenderPassInputAttachmentAspectCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassInputAttachmentAspectCreateInfo> {
+    static const uint32_t kIndex = 15;
+};
+
 // Map type VkImageViewUsageCreateInfo to id VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO
 template <> struct LvlTypeMap<VkImageViewUsageCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO;
@@ -751,6 +817,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO> {
     typedef VkImageViewUsageCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageViewUsageCreateInfo> {
+    static const uint32_t kIndex = 16;
+};
+
 // Map type VkPipelineTessellationDomainOriginStateCreateInfo to id VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO
 template <> struct LvlTypeMap<VkPipelineTessellationDomainOriginStateCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO;
@@ -760,6 +830,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_OR
     typedef VkPipelineTessellationDomainOriginStateCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineTessellationDomainOriginStateCreateInfo> {
+    static const uint32_t kIndex = 17;
+};
+
 // Map type VkRenderPassMultiviewCreateInfo to id VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO
 template <> struct LvlTypeMap<VkRenderPassMultiviewCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO;
@@ -769,6 +843,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_IN
     typedef VkRenderPassMultiviewCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassMultiviewCreateInfo> {
+    static const uint32_t kIndex = 18;
+};
+
 // Map type VkPhysicalDeviceMultiviewFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceMultiviewFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
@@ -778,6 +856,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATU
     typedef VkPhysicalDeviceMultiviewFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMultiviewFeatures> {
+    static const uint32_t kIndex = 19;
+};
+
 // Map type VkPhysicalDeviceMultiviewProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceMultiviewProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES;
@@ -787,6 +869,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPE
     typedef VkPhysicalDeviceMultiviewProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMultiviewProperties> {
+    static const uint32_t kIndex = 20;
+};
+
 // Map type VkPhysicalDeviceVariablePointersFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceVariablePointersFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES;
@@ -796,6 +882,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTE
     typedef VkPhysicalDeviceVariablePointersFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVariablePointersFeatures> {
+    static const uint32_t kIndex = 21;
+};
+
 // Map type VkPhysicalDeviceProtectedMemoryFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceProtectedMemoryFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES;
@@ -805,6 +895,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMOR
     typedef VkPhysicalDeviceProtectedMemoryFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceProtectedMemoryFeatures> {
+    static const uint32_t kIndex = 22;
+};
+
 // Map type VkPhysicalDeviceProtectedMemoryProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceProtectedMemoryProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES;
@@ -814,6 +908,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMOR
     typedef VkPhysicalDeviceProtectedMemoryProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceProtectedMemoryProperties> {
+    static const uint32_t kIndex = 23;
+};
+
 // Map type VkDeviceQueueInfo2 to id VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2
 template <> struct LvlTypeMap<VkDeviceQueueInfo2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2;
@@ -832,6 +930,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO> {
     typedef VkProtectedSubmitInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkProtectedSubmitInfo> {
+    static const uint32_t kIndex = 24;
+};
+
 // Map type VkSamplerYcbcrConversionCreateInfo to id VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO
 template <> struct LvlTypeMap<VkSamplerYcbcrConversionCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
@@ -850,6 +952,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO>
     typedef VkSamplerYcbcrConversionInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSamplerYcbcrConversionInfo> {
+    static const uint32_t kIndex = 25;
+};
+
 // Map type VkBindImagePlaneMemoryInfo to id VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO
 template <> struct LvlTypeMap<VkBindImagePlaneMemoryInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO;
@@ -859,6 +965,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO> {
     typedef VkBindImagePlaneMemoryInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBindImagePlaneMemoryInfo> {
+    static const uint32_t kIndex = 26;
+};
+
 // Map type VkImagePlaneMemoryRequirementsInfo to id VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO
 template <> struct LvlTypeMap<VkImagePlaneMemoryRequirementsInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO;
@@ -868,6 +978,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS
     typedef VkImagePlaneMemoryRequirementsInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImagePlaneMemoryRequirementsInfo> {
+    static const uint32_t kIndex = 27;
+};
+
 // Map type VkPhysicalDeviceSamplerYcbcrConversionFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceSamplerYcbcrConversionFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
@@ -877,6 +991,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_C
     typedef VkPhysicalDeviceSamplerYcbcrConversionFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSamplerYcbcrConversionFeatures> {
+    static const uint32_t kIndex = 28;
+};
+
 // Map type VkSamplerYcbcrConversionImageFormatProperties to id VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES
 template <> struct LvlTypeMap<VkSamplerYcbcrConversionImageFormatProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES;
@@ -886,6 +1004,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_
     typedef VkSamplerYcbcrConversionImageFormatProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSamplerYcbcrConversionImageFormatProperties> {
+    static const uint32_t kIndex = 29;
+};
+
 // Map type VkDescriptorUpdateTemplateCreateInfo to id VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO
 template <> struct LvlTypeMap<VkDescriptorUpdateTemplateCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
@@ -904,6 +1026,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_
     typedef VkPhysicalDeviceExternalImageFormatInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExternalImageFormatInfo> {
+    static const uint32_t kIndex = 30;
+};
+
 // Map type VkExternalImageFormatProperties to id VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES
 template <> struct LvlTypeMap<VkExternalImageFormatProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES;
@@ -913,6 +1039,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIE
     typedef VkExternalImageFormatProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExternalImageFormatProperties> {
+    static const uint32_t kIndex = 31;
+};
+
 // Map type VkPhysicalDeviceExternalBufferInfo to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO
 template <> struct LvlTypeMap<VkPhysicalDeviceExternalBufferInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO;
@@ -940,6 +1070,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES>
     typedef VkPhysicalDeviceIDProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceIDProperties> {
+    static const uint32_t kIndex = 32;
+};
+
 // Map type VkExternalMemoryImageCreateInfo to id VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO
 template <> struct LvlTypeMap<VkExternalMemoryImageCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
@@ -949,6 +1083,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_IN
     typedef VkExternalMemoryImageCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExternalMemoryImageCreateInfo> {
+    static const uint32_t kIndex = 33;
+};
+
 // Map type VkExternalMemoryBufferCreateInfo to id VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO
 template <> struct LvlTypeMap<VkExternalMemoryBufferCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
@@ -958,6 +1096,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_I
     typedef VkExternalMemoryBufferCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExternalMemoryBufferCreateInfo> {
+    static const uint32_t kIndex = 34;
+};
+
 // Map type VkExportMemoryAllocateInfo to id VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO
 template <> struct LvlTypeMap<VkExportMemoryAllocateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
@@ -967,6 +1109,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO> {
     typedef VkExportMemoryAllocateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportMemoryAllocateInfo> {
+    static const uint32_t kIndex = 35;
+};
+
 // Map type VkPhysicalDeviceExternalFenceInfo to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO
 template <> struct LvlTypeMap<VkPhysicalDeviceExternalFenceInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO;
@@ -994,6 +1140,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO> {
     typedef VkExportFenceCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportFenceCreateInfo> {
+    static const uint32_t kIndex = 36;
+};
+
 // Map type VkExportSemaphoreCreateInfo to id VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO
 template <> struct LvlTypeMap<VkExportSemaphoreCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
@@ -1003,6 +1153,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO> {
     typedef VkExportSemaphoreCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportSemaphoreCreateInfo> {
+    static const uint32_t kIndex = 37;
+};
+
 // Map type VkPhysicalDeviceExternalSemaphoreInfo to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO
 template <> struct LvlTypeMap<VkPhysicalDeviceExternalSemaphoreInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO;
@@ -1030,6 +1184,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_P
     typedef VkPhysicalDeviceMaintenance3Properties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMaintenance3Properties> {
+    static const uint32_t kIndex = 38;
+};
+
 // Map type VkDescriptorSetLayoutSupport to id VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT
 template <> struct LvlTypeMap<VkDescriptorSetLayoutSupport> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT;
@@ -1048,6 +1206,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PAR
     typedef VkPhysicalDeviceShaderDrawParametersFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderDrawParametersFeatures> {
+    static const uint32_t kIndex = 39;
+};
+
 // Map type VkPhysicalDeviceVulkan11Features to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkan11Features> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
@@ -1057,6 +1219,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEAT
     typedef VkPhysicalDeviceVulkan11Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan11Features> {
+    static const uint32_t kIndex = 40;
+};
+
 // Map type VkPhysicalDeviceVulkan11Properties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkan11Properties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES;
@@ -1066,6 +1232,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROP
     typedef VkPhysicalDeviceVulkan11Properties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan11Properties> {
+    static const uint32_t kIndex = 41;
+};
+
 // Map type VkPhysicalDeviceVulkan12Features to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkan12Features> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
@@ -1075,6 +1245,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEAT
     typedef VkPhysicalDeviceVulkan12Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan12Features> {
+    static const uint32_t kIndex = 42;
+};
+
 // Map type VkPhysicalDeviceVulkan12Properties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkan12Properties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
@@ -1084,6 +1258,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROP
     typedef VkPhysicalDeviceVulkan12Properties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan12Properties> {
+    static const uint32_t kIndex = 43;
+};
+
 // Map type VkImageFormatListCreateInfo to id VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO
 template <> struct LvlTypeMap<VkImageFormatListCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO;
@@ -1093,6 +1271,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO>
     typedef VkImageFormatListCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageFormatListCreateInfo> {
+    static const uint32_t kIndex = 44;
+};
+
 // Map type VkAttachmentDescription2 to id VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2
 template <> struct LvlTypeMap<VkAttachmentDescription2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
@@ -1165,6 +1347,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FE
     typedef VkPhysicalDevice8BitStorageFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevice8BitStorageFeatures> {
+    static const uint32_t kIndex = 45;
+};
+
 // Map type VkPhysicalDeviceDriverProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceDriverProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES;
@@ -1174,6 +1360,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTI
     typedef VkPhysicalDeviceDriverProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDriverProperties> {
+    static const uint32_t kIndex = 46;
+};
+
 // Map type VkPhysicalDeviceShaderAtomicInt64Features to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderAtomicInt64Features> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES;
@@ -1183,6 +1373,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_I
     typedef VkPhysicalDeviceShaderAtomicInt64Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicInt64Features> {
+    static const uint32_t kIndex = 47;
+};
+
 // Map type VkPhysicalDeviceShaderFloat16Int8Features to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderFloat16Int8Features> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES;
@@ -1192,6 +1386,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_
     typedef VkPhysicalDeviceShaderFloat16Int8Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderFloat16Int8Features> {
+    static const uint32_t kIndex = 48;
+};
+
 // Map type VkPhysicalDeviceFloatControlsProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceFloatControlsProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES;
@@ -1201,6 +1399,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_
     typedef VkPhysicalDeviceFloatControlsProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFloatControlsProperties> {
+    static const uint32_t kIndex = 49;
+};
+
 // Map type VkDescriptorSetLayoutBindingFlagsCreateInfo to id VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO
 template <> struct LvlTypeMap<VkDescriptorSetLayoutBindingFlagsCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
@@ -1210,6 +1412,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_F
     typedef VkDescriptorSetLayoutBindingFlagsCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDescriptorSetLayoutBindingFlagsCreateInfo> {
+    static const uint32_t kIndex = 50;
+};
+
 // Map type VkPhysicalDeviceDescriptorIndexingFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceDescriptorIndexingFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
@@ -1219,6 +1425,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDE
     typedef VkPhysicalDeviceDescriptorIndexingFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDescriptorIndexingFeatures> {
+    static const uint32_t kIndex = 51;
+};
+
 // Map type VkPhysicalDeviceDescriptorIndexingProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceDescriptorIndexingProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
@@ -1228,6 +1438,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDE
     typedef VkPhysicalDeviceDescriptorIndexingProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDescriptorIndexingProperties> {
+    static const uint32_t kIndex = 52;
+};
+
 // Map type VkDescriptorSetVariableDescriptorCountAllocateInfo to id VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO
 template <> struct LvlTypeMap<VkDescriptorSetVariableDescriptorCountAllocateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
@@ -1237,6 +1451,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIP
     typedef VkDescriptorSetVariableDescriptorCountAllocateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDescriptorSetVariableDescriptorCountAllocateInfo> {
+    static const uint32_t kIndex = 53;
+};
+
 // Map type VkDescriptorSetVariableDescriptorCountLayoutSupport to id VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT
 template <> struct LvlTypeMap<VkDescriptorSetVariableDescriptorCountLayoutSupport> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT;
@@ -1246,6 +1464,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIP
     typedef VkDescriptorSetVariableDescriptorCountLayoutSupport Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDescriptorSetVariableDescriptorCountLayoutSupport> {
+    static const uint32_t kIndex = 54;
+};
+
 // Map type VkSubpassDescriptionDepthStencilResolve to id VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE
 template <> struct LvlTypeMap<VkSubpassDescriptionDepthStencilResolve> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE;
@@ -1255,6 +1477,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENC
     typedef VkSubpassDescriptionDepthStencilResolve Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSubpassDescriptionDepthStencilResolve> {
+    static const uint32_t kIndex = 55;
+};
+
 // Map type VkPhysicalDeviceDepthStencilResolveProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceDepthStencilResolveProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES;
@@ -1264,6 +1490,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_R
     typedef VkPhysicalDeviceDepthStencilResolveProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDepthStencilResolveProperties> {
+    static const uint32_t kIndex = 56;
+};
+
 // Map type VkPhysicalDeviceScalarBlockLayoutFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceScalarBlockLayoutFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES;
@@ -1273,6 +1503,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LA
     typedef VkPhysicalDeviceScalarBlockLayoutFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceScalarBlockLayoutFeatures> {
+    static const uint32_t kIndex = 57;
+};
+
 // Map type VkImageStencilUsageCreateInfo to id VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO
 template <> struct LvlTypeMap<VkImageStencilUsageCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO;
@@ -1282,6 +1516,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO
     typedef VkImageStencilUsageCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageStencilUsageCreateInfo> {
+    static const uint32_t kIndex = 58;
+};
+
 // Map type VkSamplerReductionModeCreateInfo to id VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO
 template <> struct LvlTypeMap<VkSamplerReductionModeCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO;
@@ -1291,6 +1529,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_I
     typedef VkSamplerReductionModeCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSamplerReductionModeCreateInfo> {
+    static const uint32_t kIndex = 59;
+};
+
 // Map type VkPhysicalDeviceSamplerFilterMinmaxProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceSamplerFilterMinmaxProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES;
@@ -1300,6 +1542,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_
     typedef VkPhysicalDeviceSamplerFilterMinmaxProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSamplerFilterMinmaxProperties> {
+    static const uint32_t kIndex = 60;
+};
+
 // Map type VkPhysicalDeviceVulkanMemoryModelFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkanMemoryModelFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES;
@@ -1309,6 +1555,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_M
     typedef VkPhysicalDeviceVulkanMemoryModelFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkanMemoryModelFeatures> {
+    static const uint32_t kIndex = 61;
+};
+
 // Map type VkPhysicalDeviceImagelessFramebufferFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceImagelessFramebufferFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES;
@@ -1318,6 +1568,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAME
     typedef VkPhysicalDeviceImagelessFramebufferFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImagelessFramebufferFeatures> {
+    static const uint32_t kIndex = 62;
+};
+
 // Map type VkFramebufferAttachmentImageInfo to id VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO
 template <> struct LvlTypeMap<VkFramebufferAttachmentImageInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO;
@@ -1336,6 +1590,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_
     typedef VkFramebufferAttachmentsCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkFramebufferAttachmentsCreateInfo> {
+    static const uint32_t kIndex = 63;
+};
+
 // Map type VkRenderPassAttachmentBeginInfo to id VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO
 template <> struct LvlTypeMap<VkRenderPassAttachmentBeginInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO;
@@ -1345,6 +1603,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_IN
     typedef VkRenderPassAttachmentBeginInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassAttachmentBeginInfo> {
+    static const uint32_t kIndex = 64;
+};
+
 // Map type VkPhysicalDeviceUniformBufferStandardLayoutFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceUniformBufferStandardLayoutFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES;
@@ -1354,6 +1616,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_
     typedef VkPhysicalDeviceUniformBufferStandardLayoutFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceUniformBufferStandardLayoutFeatures> {
+    static const uint32_t kIndex = 65;
+};
+
 // Map type VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES;
@@ -1363,6 +1629,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP
     typedef VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures> {
+    static const uint32_t kIndex = 66;
+};
+
 // Map type VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES;
@@ -1372,6 +1642,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_
     typedef VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures> {
+    static const uint32_t kIndex = 67;
+};
+
 // Map type VkAttachmentReferenceStencilLayout to id VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT
 template <> struct LvlTypeMap<VkAttachmentReferenceStencilLayout> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT;
@@ -1381,6 +1655,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LA
     typedef VkAttachmentReferenceStencilLayout Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAttachmentReferenceStencilLayout> {
+    static const uint32_t kIndex = 68;
+};
+
 // Map type VkAttachmentDescriptionStencilLayout to id VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT
 template <> struct LvlTypeMap<VkAttachmentDescriptionStencilLayout> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT;
@@ -1390,6 +1668,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_
     typedef VkAttachmentDescriptionStencilLayout Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAttachmentDescriptionStencilLayout> {
+    static const uint32_t kIndex = 69;
+};
+
 // Map type VkPhysicalDeviceHostQueryResetFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceHostQueryResetFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES;
@@ -1399,6 +1681,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESE
     typedef VkPhysicalDeviceHostQueryResetFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceHostQueryResetFeatures> {
+    static const uint32_t kIndex = 70;
+};
+
 // Map type VkPhysicalDeviceTimelineSemaphoreFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceTimelineSemaphoreFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
@@ -1408,6 +1694,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPH
     typedef VkPhysicalDeviceTimelineSemaphoreFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTimelineSemaphoreFeatures> {
+    static const uint32_t kIndex = 71;
+};
+
 // Map type VkPhysicalDeviceTimelineSemaphoreProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceTimelineSemaphoreProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES;
@@ -1417,6 +1707,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPH
     typedef VkPhysicalDeviceTimelineSemaphoreProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTimelineSemaphoreProperties> {
+    static const uint32_t kIndex = 72;
+};
+
 // Map type VkSemaphoreTypeCreateInfo to id VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO
 template <> struct LvlTypeMap<VkSemaphoreTypeCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
@@ -1426,6 +1720,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO> {
     typedef VkSemaphoreTypeCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSemaphoreTypeCreateInfo> {
+    static const uint32_t kIndex = 73;
+};
+
 // Map type VkTimelineSemaphoreSubmitInfo to id VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO
 template <> struct LvlTypeMap<VkTimelineSemaphoreSubmitInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
@@ -1435,6 +1733,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO>
     typedef VkTimelineSemaphoreSubmitInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkTimelineSemaphoreSubmitInfo> {
+    static const uint32_t kIndex = 74;
+};
+
 // Map type VkSemaphoreWaitInfo to id VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO
 template <> struct LvlTypeMap<VkSemaphoreWaitInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
@@ -1462,6 +1764,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_A
     typedef VkPhysicalDeviceBufferDeviceAddressFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceBufferDeviceAddressFeatures> {
+    static const uint32_t kIndex = 75;
+};
+
 // Map type VkBufferDeviceAddressInfo to id VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO
 template <> struct LvlTypeMap<VkBufferDeviceAddressInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
@@ -1480,6 +1786,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_C
     typedef VkBufferOpaqueCaptureAddressCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBufferOpaqueCaptureAddressCreateInfo> {
+    static const uint32_t kIndex = 76;
+};
+
 // Map type VkMemoryOpaqueCaptureAddressAllocateInfo to id VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO
 template <> struct LvlTypeMap<VkMemoryOpaqueCaptureAddressAllocateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO;
@@ -1489,6 +1799,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_A
     typedef VkMemoryOpaqueCaptureAddressAllocateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryOpaqueCaptureAddressAllocateInfo> {
+    static const uint32_t kIndex = 77;
+};
+
 // Map type VkDeviceMemoryOpaqueCaptureAddressInfo to id VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO
 template <> struct LvlTypeMap<VkDeviceMemoryOpaqueCaptureAddressInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO;
@@ -1507,6 +1821,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEAT
     typedef VkPhysicalDeviceVulkan13Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan13Features> {
+    static const uint32_t kIndex = 78;
+};
+
 // Map type VkPhysicalDeviceVulkan13Properties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceVulkan13Properties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES;
@@ -1516,6 +1834,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROP
     typedef VkPhysicalDeviceVulkan13Properties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVulkan13Properties> {
+    static const uint32_t kIndex = 79;
+};
+
 // Map type VkPipelineCreationFeedbackCreateInfo to id VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO
 template <> struct LvlTypeMap<VkPipelineCreationFeedbackCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
@@ -1525,6 +1847,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREA
     typedef VkPipelineCreationFeedbackCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineCreationFeedbackCreateInfo> {
+    static const uint32_t kIndex = 80;
+};
+
 // Map type VkPhysicalDeviceShaderTerminateInvocationFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderTerminateInvocationFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES;
@@ -1534,6 +1860,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINAT
     typedef VkPhysicalDeviceShaderTerminateInvocationFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderTerminateInvocationFeatures> {
+    static const uint32_t kIndex = 81;
+};
+
 // Map type VkPhysicalDeviceToolProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceToolProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES;
@@ -1552,6 +1882,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_T
     typedef VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures> {
+    static const uint32_t kIndex = 82;
+};
+
 // Map type VkPhysicalDevicePrivateDataFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDevicePrivateDataFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES;
@@ -1561,6 +1895,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FE
     typedef VkPhysicalDevicePrivateDataFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePrivateDataFeatures> {
+    static const uint32_t kIndex = 83;
+};
+
 // Map type VkDevicePrivateDataCreateInfo to id VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO
 template <> struct LvlTypeMap<VkDevicePrivateDataCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO;
@@ -1570,6 +1908,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO
     typedef VkDevicePrivateDataCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDevicePrivateDataCreateInfo> {
+    static const uint32_t kIndex = 84;
+};
+
 // Map type VkPrivateDataSlotCreateInfo to id VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO
 template <> struct LvlTypeMap<VkPrivateDataSlotCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO;
@@ -1588,6 +1930,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATI
     typedef VkPhysicalDevicePipelineCreationCacheControlFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePipelineCreationCacheControlFeatures> {
+    static const uint32_t kIndex = 85;
+};
+
 // Map type VkMemoryBarrier2 to id VK_STRUCTURE_TYPE_MEMORY_BARRIER_2
 template <> struct LvlTypeMap<VkMemoryBarrier2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
@@ -1597,6 +1943,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_BARRIER_2> {
     typedef VkMemoryBarrier2 Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryBarrier2> {
+    static const uint32_t kIndex = 86;
+};
+
 // Map type VkBufferMemoryBarrier2 to id VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2
 template <> struct LvlTypeMap<VkBufferMemoryBarrier2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
@@ -1660,6 +2010,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION
     typedef VkPhysicalDeviceSynchronization2Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSynchronization2Features> {
+    static const uint32_t kIndex = 87;
+};
+
 // Map type VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES;
@@ -1669,6 +2023,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE
     typedef VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures> {
+    static const uint32_t kIndex = 88;
+};
+
 // Map type VkPhysicalDeviceImageRobustnessFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceImageRobustnessFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES;
@@ -1678,6 +2036,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNES
     typedef VkPhysicalDeviceImageRobustnessFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImageRobustnessFeatures> {
+    static const uint32_t kIndex = 89;
+};
+
 // Map type VkBufferCopy2 to id VK_STRUCTURE_TYPE_BUFFER_COPY_2
 template <> struct LvlTypeMap<VkBufferCopy2> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BUFFER_COPY_2;
@@ -1786,6 +2148,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_C
     typedef VkPhysicalDeviceSubgroupSizeControlFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSubgroupSizeControlFeatures> {
+    static const uint32_t kIndex = 90;
+};
+
 // Map type VkPhysicalDeviceSubgroupSizeControlProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceSubgroupSizeControlProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES;
@@ -1795,6 +2161,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_C
     typedef VkPhysicalDeviceSubgroupSizeControlProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSubgroupSizeControlProperties> {
+    static const uint32_t kIndex = 91;
+};
+
 // Map type VkPipelineShaderStageRequiredSubgroupSizeCreateInfo to id VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO
 template <> struct LvlTypeMap<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO;
@@ -1804,6 +2174,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_
     typedef VkPipelineShaderStageRequiredSubgroupSizeCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo> {
+    static const uint32_t kIndex = 92;
+};
+
 // Map type VkPhysicalDeviceInlineUniformBlockFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceInlineUniformBlockFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES;
@@ -1813,6 +2187,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_
     typedef VkPhysicalDeviceInlineUniformBlockFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceInlineUniformBlockFeatures> {
+    static const uint32_t kIndex = 93;
+};
+
 // Map type VkPhysicalDeviceInlineUniformBlockProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceInlineUniformBlockProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES;
@@ -1822,6 +2200,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_
     typedef VkPhysicalDeviceInlineUniformBlockProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceInlineUniformBlockProperties> {
+    static const uint32_t kIndex = 94;
+};
+
 // Map type VkWriteDescriptorSetInlineUniformBlock to id VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK
 template <> struct LvlTypeMap<VkWriteDescriptorSetInlineUniformBlock> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK;
@@ -1831,6 +2213,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNI
     typedef VkWriteDescriptorSetInlineUniformBlock Type;
 };
 
+template <> struct LvlPNextIndexMap<VkWriteDescriptorSetInlineUniformBlock> {
+    static const uint32_t kIndex = 95;
+};
+
 // Map type VkDescriptorPoolInlineUniformBlockCreateInfo to id VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO
 template <> struct LvlTypeMap<VkDescriptorPoolInlineUniformBlockCreateInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO;
@@ -1840,6 +2226,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_
     typedef VkDescriptorPoolInlineUniformBlockCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDescriptorPoolInlineUniformBlockCreateInfo> {
+    static const uint32_t kIndex = 96;
+};
+
 // Map type VkPhysicalDeviceTextureCompressionASTCHDRFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceTextureCompressionASTCHDRFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES;
@@ -1849,6 +2239,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRES
     typedef VkPhysicalDeviceTextureCompressionASTCHDRFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTextureCompressionASTCHDRFeatures> {
+    static const uint32_t kIndex = 97;
+};
+
 // Map type VkRenderingAttachmentInfo to id VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO
 template <> struct LvlTypeMap<VkRenderingAttachmentInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
@@ -1876,6 +2270,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO>
     typedef VkPipelineRenderingCreateInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRenderingCreateInfo> {
+    static const uint32_t kIndex = 98;
+};
+
 // Map type VkPhysicalDeviceDynamicRenderingFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceDynamicRenderingFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES;
@@ -1885,6 +2283,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERI
     typedef VkPhysicalDeviceDynamicRenderingFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDynamicRenderingFeatures> {
+    static const uint32_t kIndex = 99;
+};
+
 // Map type VkCommandBufferInheritanceRenderingInfo to id VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO
 template <> struct LvlTypeMap<VkCommandBufferInheritanceRenderingInfo> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
@@ -1894,6 +2296,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_REND
     typedef VkCommandBufferInheritanceRenderingInfo Type;
 };
 
+template <> struct LvlPNextIndexMap<VkCommandBufferInheritanceRenderingInfo> {
+    static const uint32_t kIndex = 100;
+};
+
 // Map type VkPhysicalDeviceShaderIntegerDotProductFeatures to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderIntegerDotProductFeatures> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES;
@@ -1903,6 +2309,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_
     typedef VkPhysicalDeviceShaderIntegerDotProductFeatures Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerDotProductFeatures> {
+    static const uint32_t kIndex = 101;
+};
+
 // Map type VkPhysicalDeviceShaderIntegerDotProductProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderIntegerDotProductProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES;
@@ -1912,6 +2322,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_
     typedef VkPhysicalDeviceShaderIntegerDotProductProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerDotProductProperties> {
+    static const uint32_t kIndex = 102;
+};
+
 // Map type VkPhysicalDeviceTexelBufferAlignmentProperties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceTexelBufferAlignmentProperties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES;
@@ -1921,6 +2335,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_AL
     typedef VkPhysicalDeviceTexelBufferAlignmentProperties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTexelBufferAlignmentProperties> {
+    static const uint32_t kIndex = 103;
+};
+
 // Map type VkFormatProperties3 to id VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3
 template <> struct LvlTypeMap<VkFormatProperties3> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
@@ -1930,6 +2348,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3> {
     typedef VkFormatProperties3 Type;
 };
 
+template <> struct LvlPNextIndexMap<VkFormatProperties3> {
+    static const uint32_t kIndex = 104;
+};
+
 // Map type VkPhysicalDeviceMaintenance4Features to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES
 template <> struct LvlTypeMap<VkPhysicalDeviceMaintenance4Features> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES;
@@ -1939,6 +2361,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_F
     typedef VkPhysicalDeviceMaintenance4Features Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMaintenance4Features> {
+    static const uint32_t kIndex = 105;
+};
+
 // Map type VkPhysicalDeviceMaintenance4Properties to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES
 template <> struct LvlTypeMap<VkPhysicalDeviceMaintenance4Properties> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES;
@@ -1948,6 +2374,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_P
     typedef VkPhysicalDeviceMaintenance4Properties Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMaintenance4Properties> {
+    static const uint32_t kIndex = 106;
+};
+
 // Map type VkDeviceBufferMemoryRequirements to id VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS
 template <> struct LvlTypeMap<VkDeviceBufferMemoryRequirements> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS;
@@ -1993,6 +2423,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR
     typedef VkImageSwapchainCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageSwapchainCreateInfoKHR> {
+    static const uint32_t kIndex = 107;
+};
+
 // Map type VkBindImageMemorySwapchainInfoKHR to id VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR
 template <> struct LvlTypeMap<VkBindImageMemorySwapchainInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR;
@@ -2002,6 +2436,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INF
     typedef VkBindImageMemorySwapchainInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBindImageMemorySwapchainInfoKHR> {
+    static const uint32_t kIndex = 108;
+};
+
 // Map type VkAcquireNextImageInfoKHR to id VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR
 template <> struct LvlTypeMap<VkAcquireNextImageInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR;
@@ -2029,6 +2467,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR>
     typedef VkDeviceGroupPresentInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupPresentInfoKHR> {
+    static const uint32_t kIndex = 109;
+};
+
 // Map type VkDeviceGroupSwapchainCreateInfoKHR to id VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR
 template <> struct LvlTypeMap<VkDeviceGroupSwapchainCreateInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR;
@@ -2038,6 +2480,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_I
     typedef VkDeviceGroupSwapchainCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceGroupSwapchainCreateInfoKHR> {
+    static const uint32_t kIndex = 110;
+};
+
 // Map type VkDisplayModeCreateInfoKHR to id VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR
 template <> struct LvlTypeMap<VkDisplayModeCreateInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR;
@@ -2065,6 +2511,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR> {
     typedef VkDisplayPresentInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDisplayPresentInfoKHR> {
+    static const uint32_t kIndex = 111;
+};
+
 #ifdef VK_USE_PLATFORM_XLIB_KHR
 // Map type VkXlibSurfaceCreateInfoKHR to id VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR
 template <> struct LvlTypeMap<VkXlibSurfaceCreateInfoKHR> {
@@ -2130,6 +2580,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATU
     typedef VkQueueFamilyQueryResultStatusProperties2KHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueueFamilyQueryResultStatusProperties2KHR> {
+    static const uint32_t kIndex = 112;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoQueueFamilyProperties2KHR to id VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2_KHR
@@ -2141,6 +2595,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2
     typedef VkVideoQueueFamilyProperties2KHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoQueueFamilyProperties2KHR> {
+    static const uint32_t kIndex = 113;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoProfileKHR to id VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR
@@ -2152,6 +2610,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR> {
     typedef VkVideoProfileKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoProfileKHR> {
+    static const uint32_t kIndex = 114;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoProfilesKHR to id VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR
@@ -2163,6 +2625,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR> {
     typedef VkVideoProfilesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoProfilesKHR> {
+    static const uint32_t kIndex = 115;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoCapabilitiesKHR to id VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR
@@ -2317,6 +2783,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR>
     typedef VkVideoDecodeCapabilitiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeCapabilitiesKHR> {
+    static const uint32_t kIndex = 116;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeInfoKHR to id VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR
@@ -2338,6 +2808,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE
     typedef VkRenderingFragmentShadingRateAttachmentInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderingFragmentShadingRateAttachmentInfoKHR> {
+    static const uint32_t kIndex = 117;
+};
+
 // Map type VkRenderingFragmentDensityMapAttachmentInfoEXT to id VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT
 template <> struct LvlTypeMap<VkRenderingFragmentDensityMapAttachmentInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT;
@@ -2347,6 +2821,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_
     typedef VkRenderingFragmentDensityMapAttachmentInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderingFragmentDensityMapAttachmentInfoEXT> {
+    static const uint32_t kIndex = 118;
+};
+
 // Map type VkAttachmentSampleCountInfoAMD to id VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD
 template <> struct LvlTypeMap<VkAttachmentSampleCountInfoAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD;
@@ -2356,6 +2834,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AM
     typedef VkAttachmentSampleCountInfoAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAttachmentSampleCountInfoAMD> {
+    static const uint32_t kIndex = 119;
+};
+
 // Map type VkMultiviewPerViewAttributesInfoNVX to id VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX
 template <> struct LvlTypeMap<VkMultiviewPerViewAttributesInfoNVX> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX;
@@ -2365,6 +2847,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_I
     typedef VkMultiviewPerViewAttributesInfoNVX Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMultiviewPerViewAttributesInfoNVX> {
+    static const uint32_t kIndex = 120;
+};
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkImportMemoryWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR
 template <> struct LvlTypeMap<VkImportMemoryWin32HandleInfoKHR> {
@@ -2375,6 +2861,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO
     typedef VkImportMemoryWin32HandleInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryWin32HandleInfoKHR> {
+    static const uint32_t kIndex = 121;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkExportMemoryWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR
@@ -2386,6 +2876,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO
     typedef VkExportMemoryWin32HandleInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportMemoryWin32HandleInfoKHR> {
+    static const uint32_t kIndex = 122;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkMemoryWin32HandlePropertiesKHR to id VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR
@@ -2418,6 +2912,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR> {
     typedef VkImportMemoryFdInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryFdInfoKHR> {
+    static const uint32_t kIndex = 123;
+};
+
 // Map type VkMemoryFdPropertiesKHR to id VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkMemoryFdPropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
@@ -2446,6 +2944,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEA
     typedef VkWin32KeyedMutexAcquireReleaseInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkWin32KeyedMutexAcquireReleaseInfoKHR> {
+    static const uint32_t kIndex = 124;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkImportSemaphoreWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR
@@ -2468,6 +2970,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_I
     typedef VkExportSemaphoreWin32HandleInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportSemaphoreWin32HandleInfoKHR> {
+    static const uint32_t kIndex = 125;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkD3D12FenceSubmitInfoKHR to id VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR
@@ -2479,6 +2985,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR> {
     typedef VkD3D12FenceSubmitInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkD3D12FenceSubmitInfoKHR> {
+    static const uint32_t kIndex = 126;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkSemaphoreGetWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR
@@ -2518,6 +3028,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR
     typedef VkPhysicalDevicePushDescriptorPropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePushDescriptorPropertiesKHR> {
+    static const uint32_t kIndex = 127;
+};
+
 // Map type VkPresentRegionsKHR to id VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR
 template <> struct LvlTypeMap<VkPresentRegionsKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR;
@@ -2527,6 +3041,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR> {
     typedef VkPresentRegionsKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPresentRegionsKHR> {
+    static const uint32_t kIndex = 128;
+};
+
 // Map type VkSharedPresentSurfaceCapabilitiesKHR to id VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR
 template <> struct LvlTypeMap<VkSharedPresentSurfaceCapabilitiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR;
@@ -2536,6 +3054,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILI
     typedef VkSharedPresentSurfaceCapabilitiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSharedPresentSurfaceCapabilitiesKHR> {
+    static const uint32_t kIndex = 129;
+};
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkImportFenceWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR
 template <> struct LvlTypeMap<VkImportFenceWin32HandleInfoKHR> {
@@ -2557,6 +3079,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_
     typedef VkExportFenceWin32HandleInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportFenceWin32HandleInfoKHR> {
+    static const uint32_t kIndex = 130;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkFenceGetWin32HandleInfoKHR to id VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR
@@ -2596,6 +3122,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUE
     typedef VkPhysicalDevicePerformanceQueryFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePerformanceQueryFeaturesKHR> {
+    static const uint32_t kIndex = 131;
+};
+
 // Map type VkPhysicalDevicePerformanceQueryPropertiesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkPhysicalDevicePerformanceQueryPropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR;
@@ -2605,6 +3135,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUE
     typedef VkPhysicalDevicePerformanceQueryPropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePerformanceQueryPropertiesKHR> {
+    static const uint32_t kIndex = 132;
+};
+
 // Map type VkPerformanceCounterKHR to id VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR
 template <> struct LvlTypeMap<VkPerformanceCounterKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR;
@@ -2632,6 +3166,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_I
     typedef VkQueryPoolPerformanceCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueryPoolPerformanceCreateInfoKHR> {
+    static const uint32_t kIndex = 133;
+};
+
 // Map type VkAcquireProfilingLockInfoKHR to id VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR
 template <> struct LvlTypeMap<VkAcquireProfilingLockInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR;
@@ -2650,6 +3188,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_K
     typedef VkPerformanceQuerySubmitInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPerformanceQuerySubmitInfoKHR> {
+    static const uint32_t kIndex = 134;
+};
+
 // Map type VkPhysicalDeviceSurfaceInfo2KHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceSurfaceInfo2KHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR;
@@ -2732,6 +3274,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUB
     typedef VkPhysicalDevicePortabilitySubsetFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePortabilitySubsetFeaturesKHR> {
+    static const uint32_t kIndex = 135;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkPhysicalDevicePortabilitySubsetPropertiesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR
@@ -2743,6 +3289,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUB
     typedef VkPhysicalDevicePortabilitySubsetPropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePortabilitySubsetPropertiesKHR> {
+    static const uint32_t kIndex = 136;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 // Map type VkPhysicalDeviceShaderClockFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderClockFeaturesKHR> {
@@ -2753,6 +3303,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FE
     typedef VkPhysicalDeviceShaderClockFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderClockFeaturesKHR> {
+    static const uint32_t kIndex = 137;
+};
+
 // Map type VkDeviceQueueGlobalPriorityCreateInfoKHR to id VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR
 template <> struct LvlTypeMap<VkDeviceQueueGlobalPriorityCreateInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR;
@@ -2762,6 +3316,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CR
     typedef VkDeviceQueueGlobalPriorityCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceQueueGlobalPriorityCreateInfoKHR> {
+    static const uint32_t kIndex = 138;
+};
+
 // Map type VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR;
@@ -2771,6 +3329,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY
     typedef VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR> {
+    static const uint32_t kIndex = 139;
+};
+
 // Map type VkQueueFamilyGlobalPriorityPropertiesKHR to id VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkQueueFamilyGlobalPriorityPropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR;
@@ -2780,6 +3342,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PR
     typedef VkQueueFamilyGlobalPriorityPropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueueFamilyGlobalPriorityPropertiesKHR> {
+    static const uint32_t kIndex = 140;
+};
+
 // Map type VkFragmentShadingRateAttachmentInfoKHR to id VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR
 template <> struct LvlTypeMap<VkFragmentShadingRateAttachmentInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR;
@@ -2789,6 +3355,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMEN
     typedef VkFragmentShadingRateAttachmentInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkFragmentShadingRateAttachmentInfoKHR> {
+    static const uint32_t kIndex = 141;
+};
+
 // Map type VkPipelineFragmentShadingRateStateCreateInfoKHR to id VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR
 template <> struct LvlTypeMap<VkPipelineFragmentShadingRateStateCreateInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR;
@@ -2798,6 +3368,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_
     typedef VkPipelineFragmentShadingRateStateCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineFragmentShadingRateStateCreateInfoKHR> {
+    static const uint32_t kIndex = 142;
+};
+
 // Map type VkPhysicalDeviceFragmentShadingRateFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShadingRateFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
@@ -2807,6 +3381,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADIN
     typedef VkPhysicalDeviceFragmentShadingRateFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateFeaturesKHR> {
+    static const uint32_t kIndex = 143;
+};
+
 // Map type VkPhysicalDeviceFragmentShadingRatePropertiesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShadingRatePropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR;
@@ -2816,6 +3394,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADIN
     typedef VkPhysicalDeviceFragmentShadingRatePropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRatePropertiesKHR> {
+    static const uint32_t kIndex = 144;
+};
+
 // Map type VkPhysicalDeviceFragmentShadingRateKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShadingRateKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR;
@@ -2834,6 +3416,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_
     typedef VkSurfaceProtectedCapabilitiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSurfaceProtectedCapabilitiesKHR> {
+    static const uint32_t kIndex = 145;
+};
+
 // Map type VkPhysicalDevicePresentWaitFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDevicePresentWaitFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
@@ -2843,6 +3429,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FE
     typedef VkPhysicalDevicePresentWaitFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePresentWaitFeaturesKHR> {
+    static const uint32_t kIndex = 146;
+};
+
 // Map type VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR;
@@ -2852,6 +3442,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUT
     typedef VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR> {
+    static const uint32_t kIndex = 147;
+};
+
 // Map type VkPipelineInfoKHR to id VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR
 template <> struct LvlTypeMap<VkPipelineInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR;
@@ -2906,6 +3500,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KH
     typedef VkPipelineLibraryCreateInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineLibraryCreateInfoKHR> {
+    static const uint32_t kIndex = 148;
+};
+
 // Map type VkPresentIdKHR to id VK_STRUCTURE_TYPE_PRESENT_ID_KHR
 template <> struct LvlTypeMap<VkPresentIdKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
@@ -2915,6 +3513,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PRESENT_ID_KHR> {
     typedef VkPresentIdKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPresentIdKHR> {
+    static const uint32_t kIndex = 149;
+};
+
 // Map type VkPhysicalDevicePresentIdFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDevicePresentIdFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
@@ -2924,6 +3526,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEAT
     typedef VkPhysicalDevicePresentIdFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePresentIdFeaturesKHR> {
+    static const uint32_t kIndex = 150;
+};
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeInfoKHR to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR
 template <> struct LvlTypeMap<VkVideoEncodeInfoKHR> {
@@ -2945,6 +3551,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR>
     typedef VkVideoEncodeCapabilitiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeCapabilitiesKHR> {
+    static const uint32_t kIndex = 151;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeRateControlLayerInfoKHR to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR
@@ -2956,6 +3566,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER
     typedef VkVideoEncodeRateControlLayerInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeRateControlLayerInfoKHR> {
+    static const uint32_t kIndex = 152;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeRateControlInfoKHR to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR
@@ -2967,6 +3581,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_
     typedef VkVideoEncodeRateControlInfoKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeRateControlInfoKHR> {
+    static const uint32_t kIndex = 153;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 // Map type VkQueueFamilyCheckpointProperties2NV to id VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV
 template <> struct LvlTypeMap<VkQueueFamilyCheckpointProperties2NV> {
@@ -2977,6 +3595,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERT
     typedef VkQueueFamilyCheckpointProperties2NV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueueFamilyCheckpointProperties2NV> {
+    static const uint32_t kIndex = 154;
+};
+
 // Map type VkCheckpointData2NV to id VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV
 template <> struct LvlTypeMap<VkCheckpointData2NV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV;
@@ -2995,6 +3617,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP
     typedef VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR> {
+    static const uint32_t kIndex = 155;
+};
+
 // Map type VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR;
@@ -3004,6 +3630,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMOR
     typedef VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR> {
+    static const uint32_t kIndex = 156;
+};
+
 // Map type VkDebugReportCallbackCreateInfoEXT to id VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkDebugReportCallbackCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
@@ -3013,6 +3643,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_IN
     typedef VkDebugReportCallbackCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDebugReportCallbackCreateInfoEXT> {
+    static const uint32_t kIndex = 157;
+};
+
 // Map type VkPipelineRasterizationStateRasterizationOrderAMD to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD
 template <> struct LvlTypeMap<VkPipelineRasterizationStateRasterizationOrderAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD;
@@ -3022,6 +3656,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RA
     typedef VkPipelineRasterizationStateRasterizationOrderAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationStateRasterizationOrderAMD> {
+    static const uint32_t kIndex = 158;
+};
+
 // Map type VkDebugMarkerObjectNameInfoEXT to id VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT
 template <> struct LvlTypeMap<VkDebugMarkerObjectNameInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT;
@@ -3058,6 +3696,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREA
     typedef VkDedicatedAllocationImageCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDedicatedAllocationImageCreateInfoNV> {
+    static const uint32_t kIndex = 159;
+};
+
 // Map type VkDedicatedAllocationBufferCreateInfoNV to id VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkDedicatedAllocationBufferCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV;
@@ -3067,6 +3709,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CRE
     typedef VkDedicatedAllocationBufferCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDedicatedAllocationBufferCreateInfoNV> {
+    static const uint32_t kIndex = 160;
+};
+
 // Map type VkDedicatedAllocationMemoryAllocateInfoNV to id VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV
 template <> struct LvlTypeMap<VkDedicatedAllocationMemoryAllocateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV;
@@ -3076,6 +3722,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALL
     typedef VkDedicatedAllocationMemoryAllocateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDedicatedAllocationMemoryAllocateInfoNV> {
+    static const uint32_t kIndex = 161;
+};
+
 // Map type VkPhysicalDeviceTransformFeedbackFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceTransformFeedbackFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT;
@@ -3085,6 +3735,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDB
     typedef VkPhysicalDeviceTransformFeedbackFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTransformFeedbackFeaturesEXT> {
+    static const uint32_t kIndex = 162;
+};
+
 // Map type VkPhysicalDeviceTransformFeedbackPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceTransformFeedbackPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
@@ -3094,6 +3748,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDB
     typedef VkPhysicalDeviceTransformFeedbackPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTransformFeedbackPropertiesEXT> {
+    static const uint32_t kIndex = 163;
+};
+
 // Map type VkPipelineRasterizationStateStreamCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineRasterizationStateStreamCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT;
@@ -3103,6 +3761,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_ST
     typedef VkPipelineRasterizationStateStreamCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationStateStreamCreateInfoEXT> {
+    static const uint32_t kIndex = 164;
+};
+
 // Map type VkCuModuleCreateInfoNVX to id VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX
 template <> struct LvlTypeMap<VkCuModuleCreateInfoNVX> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_CU_MODULE_CREATE_INFO_NVX;
@@ -3158,6 +3820,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_
     typedef VkVideoEncodeH264CapabilitiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264CapabilitiesEXT> {
+    static const uint32_t kIndex = 165;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264SessionParametersAddInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT
@@ -3169,6 +3835,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAM
     typedef VkVideoEncodeH264SessionParametersAddInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264SessionParametersAddInfoEXT> {
+    static const uint32_t kIndex = 166;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264SessionParametersCreateInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT
@@ -3180,6 +3850,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAM
     typedef VkVideoEncodeH264SessionParametersCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264SessionParametersCreateInfoEXT> {
+    static const uint32_t kIndex = 167;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264DpbSlotInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT
@@ -3224,6 +3898,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INF
     typedef VkVideoEncodeH264VclFrameInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264VclFrameInfoEXT> {
+    static const uint32_t kIndex = 168;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264EmitPictureParametersEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_EXT
@@ -3235,6 +3913,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_
     typedef VkVideoEncodeH264EmitPictureParametersEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264EmitPictureParametersEXT> {
+    static const uint32_t kIndex = 169;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264ProfileEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT
@@ -3246,6 +3928,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT>
     typedef VkVideoEncodeH264ProfileEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264ProfileEXT> {
+    static const uint32_t kIndex = 170;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264RateControlInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT
@@ -3257,6 +3943,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_
     typedef VkVideoEncodeH264RateControlInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264RateControlInfoEXT> {
+    static const uint32_t kIndex = 171;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH264RateControlLayerInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT
@@ -3268,6 +3958,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_
     typedef VkVideoEncodeH264RateControlLayerInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH264RateControlLayerInfoEXT> {
+    static const uint32_t kIndex = 172;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265CapabilitiesEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT
@@ -3279,6 +3973,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_
     typedef VkVideoEncodeH265CapabilitiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265CapabilitiesEXT> {
+    static const uint32_t kIndex = 173;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265SessionParametersAddInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT
@@ -3290,6 +3988,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAM
     typedef VkVideoEncodeH265SessionParametersAddInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265SessionParametersAddInfoEXT> {
+    static const uint32_t kIndex = 174;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265SessionParametersCreateInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT
@@ -3301,6 +4003,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAM
     typedef VkVideoEncodeH265SessionParametersCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265SessionParametersCreateInfoEXT> {
+    static const uint32_t kIndex = 175;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265DpbSlotInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT
@@ -3345,6 +4051,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INF
     typedef VkVideoEncodeH265VclFrameInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265VclFrameInfoEXT> {
+    static const uint32_t kIndex = 176;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265EmitPictureParametersEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_EXT
@@ -3356,6 +4066,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_
     typedef VkVideoEncodeH265EmitPictureParametersEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265EmitPictureParametersEXT> {
+    static const uint32_t kIndex = 177;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265ProfileEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT
@@ -3367,6 +4081,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT>
     typedef VkVideoEncodeH265ProfileEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265ProfileEXT> {
+    static const uint32_t kIndex = 178;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265RateControlInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT
@@ -3378,6 +4096,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_
     typedef VkVideoEncodeH265RateControlInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265RateControlInfoEXT> {
+    static const uint32_t kIndex = 179;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoEncodeH265RateControlLayerInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT
@@ -3389,6 +4111,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_
     typedef VkVideoEncodeH265RateControlLayerInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoEncodeH265RateControlLayerInfoEXT> {
+    static const uint32_t kIndex = 180;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264ProfileEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT
@@ -3400,6 +4126,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT>
     typedef VkVideoDecodeH264ProfileEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264ProfileEXT> {
+    static const uint32_t kIndex = 181;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264CapabilitiesEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT
@@ -3411,6 +4141,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_
     typedef VkVideoDecodeH264CapabilitiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264CapabilitiesEXT> {
+    static const uint32_t kIndex = 182;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264SessionParametersAddInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT
@@ -3422,6 +4156,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAM
     typedef VkVideoDecodeH264SessionParametersAddInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264SessionParametersAddInfoEXT> {
+    static const uint32_t kIndex = 183;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264SessionParametersCreateInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT
@@ -3433,6 +4171,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAM
     typedef VkVideoDecodeH264SessionParametersCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264SessionParametersCreateInfoEXT> {
+    static const uint32_t kIndex = 184;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264PictureInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT
@@ -3444,6 +4186,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_
     typedef VkVideoDecodeH264PictureInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264PictureInfoEXT> {
+    static const uint32_t kIndex = 185;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264MvcEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT
@@ -3455,6 +4201,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT> {
     typedef VkVideoDecodeH264MvcEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264MvcEXT> {
+    static const uint32_t kIndex = 186;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH264DpbSlotInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT
@@ -3466,6 +4216,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO
     typedef VkVideoDecodeH264DpbSlotInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH264DpbSlotInfoEXT> {
+    static const uint32_t kIndex = 187;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 // Map type VkTextureLODGatherFormatPropertiesAMD to id VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD
 template <> struct LvlTypeMap<VkTextureLODGatherFormatPropertiesAMD> {
@@ -3476,6 +4230,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPE
     typedef VkTextureLODGatherFormatPropertiesAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkTextureLODGatherFormatPropertiesAMD> {
+    static const uint32_t kIndex = 188;
+};
+
 #ifdef VK_USE_PLATFORM_GGP
 // Map type VkStreamDescriptorSurfaceCreateInfoGGP to id VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP
 template <> struct LvlTypeMap<VkStreamDescriptorSurfaceCreateInfoGGP> {
@@ -3496,6 +4254,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_
     typedef VkPhysicalDeviceCornerSampledImageFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCornerSampledImageFeaturesNV> {
+    static const uint32_t kIndex = 189;
+};
+
 // Map type VkExternalMemoryImageCreateInfoNV to id VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkExternalMemoryImageCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV;
@@ -3505,6 +4267,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_IN
     typedef VkExternalMemoryImageCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExternalMemoryImageCreateInfoNV> {
+    static const uint32_t kIndex = 190;
+};
+
 // Map type VkExportMemoryAllocateInfoNV to id VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV
 template <> struct LvlTypeMap<VkExportMemoryAllocateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV;
@@ -3514,6 +4280,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV>
     typedef VkExportMemoryAllocateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportMemoryAllocateInfoNV> {
+    static const uint32_t kIndex = 191;
+};
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkImportMemoryWin32HandleInfoNV to id VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV
 template <> struct LvlTypeMap<VkImportMemoryWin32HandleInfoNV> {
@@ -3524,6 +4294,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO
     typedef VkImportMemoryWin32HandleInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryWin32HandleInfoNV> {
+    static const uint32_t kIndex = 192;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkExportMemoryWin32HandleInfoNV to id VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV
@@ -3535,6 +4309,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO
     typedef VkExportMemoryWin32HandleInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExportMemoryWin32HandleInfoNV> {
+    static const uint32_t kIndex = 193;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkWin32KeyedMutexAcquireReleaseInfoNV to id VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV
@@ -3546,6 +4324,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEA
     typedef VkWin32KeyedMutexAcquireReleaseInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkWin32KeyedMutexAcquireReleaseInfoNV> {
+    static const uint32_t kIndex = 194;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 // Map type VkValidationFlagsEXT to id VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT
 template <> struct LvlTypeMap<VkValidationFlagsEXT> {
@@ -3556,6 +4338,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT> {
     typedef VkValidationFlagsEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkValidationFlagsEXT> {
+    static const uint32_t kIndex = 195;
+};
+
 #ifdef VK_USE_PLATFORM_VI_NN
 // Map type VkViSurfaceCreateInfoNN to id VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN
 template <> struct LvlTypeMap<VkViSurfaceCreateInfoNN> {
@@ -3576,6 +4362,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT
     typedef VkImageViewASTCDecodeModeEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageViewASTCDecodeModeEXT> {
+    static const uint32_t kIndex = 196;
+};
+
 // Map type VkPhysicalDeviceASTCDecodeFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceASTCDecodeFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT;
@@ -3585,6 +4375,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEA
     typedef VkPhysicalDeviceASTCDecodeFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceASTCDecodeFeaturesEXT> {
+    static const uint32_t kIndex = 197;
+};
+
 // Map type VkConditionalRenderingBeginInfoEXT to id VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT
 template <> struct LvlTypeMap<VkConditionalRenderingBeginInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
@@ -3603,6 +4397,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_REN
     typedef VkPhysicalDeviceConditionalRenderingFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceConditionalRenderingFeaturesEXT> {
+    static const uint32_t kIndex = 198;
+};
+
 // Map type VkCommandBufferInheritanceConditionalRenderingInfoEXT to id VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT
 template <> struct LvlTypeMap<VkCommandBufferInheritanceConditionalRenderingInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT;
@@ -3612,6 +4410,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_COND
     typedef VkCommandBufferInheritanceConditionalRenderingInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkCommandBufferInheritanceConditionalRenderingInfoEXT> {
+    static const uint32_t kIndex = 199;
+};
+
 // Map type VkPipelineViewportWScalingStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineViewportWScalingStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV;
@@ -3621,6 +4423,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STA
     typedef VkPipelineViewportWScalingStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportWScalingStateCreateInfoNV> {
+    static const uint32_t kIndex = 200;
+};
+
 // Map type VkSurfaceCapabilities2EXT to id VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT
 template <> struct LvlTypeMap<VkSurfaceCapabilities2EXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT;
@@ -3666,6 +4472,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_E
     typedef VkSwapchainCounterCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSwapchainCounterCreateInfoEXT> {
+    static const uint32_t kIndex = 201;
+};
+
 // Map type VkPresentTimesInfoGOOGLE to id VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE
 template <> struct LvlTypeMap<VkPresentTimesInfoGOOGLE> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
@@ -3675,6 +4485,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE> {
     typedef VkPresentTimesInfoGOOGLE Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPresentTimesInfoGOOGLE> {
+    static const uint32_t kIndex = 202;
+};
+
 // Map type VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX
 template <> struct LvlTypeMap<VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX;
@@ -3684,6 +4498,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_V
     typedef VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX> {
+    static const uint32_t kIndex = 203;
+};
+
 // Map type VkPipelineViewportSwizzleStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineViewportSwizzleStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV;
@@ -3693,6 +4511,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE
     typedef VkPipelineViewportSwizzleStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportSwizzleStateCreateInfoNV> {
+    static const uint32_t kIndex = 204;
+};
+
 // Map type VkPhysicalDeviceDiscardRectanglePropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceDiscardRectanglePropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT;
@@ -3702,6 +4524,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANG
     typedef VkPhysicalDeviceDiscardRectanglePropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDiscardRectanglePropertiesEXT> {
+    static const uint32_t kIndex = 205;
+};
+
 // Map type VkPipelineDiscardRectangleStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineDiscardRectangleStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT;
@@ -3711,6 +4537,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STAT
     typedef VkPipelineDiscardRectangleStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineDiscardRectangleStateCreateInfoEXT> {
+    static const uint32_t kIndex = 206;
+};
+
 // Map type VkPhysicalDeviceConservativeRasterizationPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceConservativeRasterizationPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT;
@@ -3720,6 +4550,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RA
     typedef VkPhysicalDeviceConservativeRasterizationPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceConservativeRasterizationPropertiesEXT> {
+    static const uint32_t kIndex = 207;
+};
+
 // Map type VkPipelineRasterizationConservativeStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineRasterizationConservativeStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT;
@@ -3729,6 +4563,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVA
     typedef VkPipelineRasterizationConservativeStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationConservativeStateCreateInfoEXT> {
+    static const uint32_t kIndex = 208;
+};
+
 // Map type VkPhysicalDeviceDepthClipEnableFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceDepthClipEnableFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT;
@@ -3738,6 +4576,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENAB
     typedef VkPhysicalDeviceDepthClipEnableFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDepthClipEnableFeaturesEXT> {
+    static const uint32_t kIndex = 209;
+};
+
 // Map type VkPipelineRasterizationDepthClipStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineRasterizationDepthClipStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT;
@@ -3747,6 +4589,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CL
     typedef VkPipelineRasterizationDepthClipStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationDepthClipStateCreateInfoEXT> {
+    static const uint32_t kIndex = 210;
+};
+
 // Map type VkHdrMetadataEXT to id VK_STRUCTURE_TYPE_HDR_METADATA_EXT
 template <> struct LvlTypeMap<VkHdrMetadataEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_HDR_METADATA_EXT;
@@ -3796,6 +4642,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EX
     typedef VkDebugUtilsObjectNameInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDebugUtilsObjectNameInfoEXT> {
+    static const uint32_t kIndex = 211;
+};
+
 // Map type VkDebugUtilsMessengerCallbackDataEXT to id VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT
 template <> struct LvlTypeMap<VkDebugUtilsMessengerCallbackDataEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
@@ -3814,6 +4664,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_IN
     typedef VkDebugUtilsMessengerCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDebugUtilsMessengerCreateInfoEXT> {
+    static const uint32_t kIndex = 212;
+};
+
 // Map type VkDebugUtilsObjectTagInfoEXT to id VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT
 template <> struct LvlTypeMap<VkDebugUtilsObjectTagInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT;
@@ -3833,6 +4687,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_A
     typedef VkAndroidHardwareBufferUsageANDROID Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAndroidHardwareBufferUsageANDROID> {
+    static const uint32_t kIndex = 213;
+};
+
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 // Map type VkAndroidHardwareBufferPropertiesANDROID to id VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID
@@ -3855,6 +4713,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_
     typedef VkAndroidHardwareBufferFormatPropertiesANDROID Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAndroidHardwareBufferFormatPropertiesANDROID> {
+    static const uint32_t kIndex = 214;
+};
+
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 // Map type VkImportAndroidHardwareBufferInfoANDROID to id VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID
@@ -3866,6 +4728,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_
     typedef VkImportAndroidHardwareBufferInfoANDROID Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportAndroidHardwareBufferInfoANDROID> {
+    static const uint32_t kIndex = 215;
+};
+
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 // Map type VkMemoryGetAndroidHardwareBufferInfoANDROID to id VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID
@@ -3888,6 +4754,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID> {
     typedef VkExternalFormatANDROID Type;
 };
 
+template <> struct LvlPNextIndexMap<VkExternalFormatANDROID> {
+    static const uint32_t kIndex = 216;
+};
+
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 // Map type VkAndroidHardwareBufferFormatProperties2ANDROID to id VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID
@@ -3899,6 +4769,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_
     typedef VkAndroidHardwareBufferFormatProperties2ANDROID Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAndroidHardwareBufferFormatProperties2ANDROID> {
+    static const uint32_t kIndex = 217;
+};
+
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 // Map type VkSampleLocationsInfoEXT to id VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT
 template <> struct LvlTypeMap<VkSampleLocationsInfoEXT> {
@@ -3909,6 +4783,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT> {
     typedef VkSampleLocationsInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSampleLocationsInfoEXT> {
+    static const uint32_t kIndex = 218;
+};
+
 // Map type VkRenderPassSampleLocationsBeginInfoEXT to id VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT
 template <> struct LvlTypeMap<VkRenderPassSampleLocationsBeginInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT;
@@ -3918,6 +4796,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BE
     typedef VkRenderPassSampleLocationsBeginInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassSampleLocationsBeginInfoEXT> {
+    static const uint32_t kIndex = 219;
+};
+
 // Map type VkPipelineSampleLocationsStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineSampleLocationsStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT;
@@ -3927,6 +4809,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE
     typedef VkPipelineSampleLocationsStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineSampleLocationsStateCreateInfoEXT> {
+    static const uint32_t kIndex = 220;
+};
+
 // Map type VkPhysicalDeviceSampleLocationsPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceSampleLocationsPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT;
@@ -3936,6 +4822,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATION
     typedef VkPhysicalDeviceSampleLocationsPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSampleLocationsPropertiesEXT> {
+    static const uint32_t kIndex = 221;
+};
+
 // Map type VkMultisamplePropertiesEXT to id VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkMultisamplePropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT;
@@ -3954,6 +4844,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION
     typedef VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT> {
+    static const uint32_t kIndex = 222;
+};
+
 // Map type VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT;
@@ -3963,6 +4857,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION
     typedef VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT> {
+    static const uint32_t kIndex = 223;
+};
+
 // Map type VkPipelineColorBlendAdvancedStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineColorBlendAdvancedStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT;
@@ -3972,6 +4870,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_S
     typedef VkPipelineColorBlendAdvancedStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineColorBlendAdvancedStateCreateInfoEXT> {
+    static const uint32_t kIndex = 224;
+};
+
 // Map type VkPipelineCoverageToColorStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineCoverageToColorStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV;
@@ -3981,6 +4883,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STAT
     typedef VkPipelineCoverageToColorStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineCoverageToColorStateCreateInfoNV> {
+    static const uint32_t kIndex = 225;
+};
+
 // Map type VkPipelineCoverageModulationStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineCoverageModulationStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV;
@@ -3990,6 +4896,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_ST
     typedef VkPipelineCoverageModulationStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineCoverageModulationStateCreateInfoNV> {
+    static const uint32_t kIndex = 226;
+};
+
 // Map type VkPhysicalDeviceShaderSMBuiltinsPropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV;
@@ -3999,6 +4909,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILT
     typedef VkPhysicalDeviceShaderSMBuiltinsPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV> {
+    static const uint32_t kIndex = 227;
+};
+
 // Map type VkPhysicalDeviceShaderSMBuiltinsFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV;
@@ -4008,6 +4922,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILT
     typedef VkPhysicalDeviceShaderSMBuiltinsFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV> {
+    static const uint32_t kIndex = 228;
+};
+
 // Map type VkDrmFormatModifierPropertiesListEXT to id VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT
 template <> struct LvlTypeMap<VkDrmFormatModifierPropertiesListEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT;
@@ -4017,6 +4935,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_
     typedef VkDrmFormatModifierPropertiesListEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDrmFormatModifierPropertiesListEXT> {
+    static const uint32_t kIndex = 229;
+};
+
 // Map type VkPhysicalDeviceImageDrmFormatModifierInfoEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceImageDrmFormatModifierInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT;
@@ -4026,6 +4948,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMA
     typedef VkPhysicalDeviceImageDrmFormatModifierInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImageDrmFormatModifierInfoEXT> {
+    static const uint32_t kIndex = 230;
+};
+
 // Map type VkImageDrmFormatModifierListCreateInfoEXT to id VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkImageDrmFormatModifierListCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT;
@@ -4035,6 +4961,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_
     typedef VkImageDrmFormatModifierListCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageDrmFormatModifierListCreateInfoEXT> {
+    static const uint32_t kIndex = 231;
+};
+
 // Map type VkImageDrmFormatModifierExplicitCreateInfoEXT to id VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkImageDrmFormatModifierExplicitCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT;
@@ -4044,6 +4974,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLI
     typedef VkImageDrmFormatModifierExplicitCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageDrmFormatModifierExplicitCreateInfoEXT> {
+    static const uint32_t kIndex = 232;
+};
+
 // Map type VkImageDrmFormatModifierPropertiesEXT to id VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkImageDrmFormatModifierPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT;
@@ -4062,6 +4996,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_
     typedef VkDrmFormatModifierPropertiesList2EXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDrmFormatModifierPropertiesList2EXT> {
+    static const uint32_t kIndex = 233;
+};
+
 // Map type VkValidationCacheCreateInfoEXT to id VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkValidationCacheCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
@@ -4080,6 +5018,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_
     typedef VkShaderModuleValidationCacheCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkShaderModuleValidationCacheCreateInfoEXT> {
+    static const uint32_t kIndex = 234;
+};
+
 // Map type VkPipelineViewportShadingRateImageStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineViewportShadingRateImageStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV;
@@ -4089,6 +5031,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_
     typedef VkPipelineViewportShadingRateImageStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportShadingRateImageStateCreateInfoNV> {
+    static const uint32_t kIndex = 235;
+};
+
 // Map type VkPhysicalDeviceShadingRateImageFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceShadingRateImageFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV;
@@ -4098,6 +5044,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IM
     typedef VkPhysicalDeviceShadingRateImageFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShadingRateImageFeaturesNV> {
+    static const uint32_t kIndex = 236;
+};
+
 // Map type VkPhysicalDeviceShadingRateImagePropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceShadingRateImagePropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV;
@@ -4107,6 +5057,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IM
     typedef VkPhysicalDeviceShadingRateImagePropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShadingRateImagePropertiesNV> {
+    static const uint32_t kIndex = 237;
+};
+
 // Map type VkPipelineViewportCoarseSampleOrderStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV;
@@ -4116,6 +5070,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE
     typedef VkPipelineViewportCoarseSampleOrderStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV> {
+    static const uint32_t kIndex = 238;
+};
+
 // Map type VkRayTracingShaderGroupCreateInfoNV to id VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkRayTracingShaderGroupCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV;
@@ -4197,6 +5155,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATI
     typedef VkWriteDescriptorSetAccelerationStructureNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkWriteDescriptorSetAccelerationStructureNV> {
+    static const uint32_t kIndex = 239;
+};
+
 // Map type VkAccelerationStructureMemoryRequirementsInfoNV to id VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV
 template <> struct LvlTypeMap<VkAccelerationStructureMemoryRequirementsInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV;
@@ -4215,6 +5177,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PRO
     typedef VkPhysicalDeviceRayTracingPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRayTracingPropertiesNV> {
+    static const uint32_t kIndex = 240;
+};
+
 // Map type VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV;
@@ -4224,6 +5190,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_
     typedef VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV> {
+    static const uint32_t kIndex = 241;
+};
+
 // Map type VkPipelineRepresentativeFragmentTestStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineRepresentativeFragmentTestStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV;
@@ -4233,6 +5203,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMEN
     typedef VkPipelineRepresentativeFragmentTestStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRepresentativeFragmentTestStateCreateInfoNV> {
+    static const uint32_t kIndex = 242;
+};
+
 // Map type VkPhysicalDeviceImageViewImageFormatInfoEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceImageViewImageFormatInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT;
@@ -4242,6 +5216,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAG
     typedef VkPhysicalDeviceImageViewImageFormatInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImageViewImageFormatInfoEXT> {
+    static const uint32_t kIndex = 243;
+};
+
 // Map type VkFilterCubicImageViewImageFormatPropertiesEXT to id VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkFilterCubicImageViewImageFormatPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT;
@@ -4251,6 +5229,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_F
     typedef VkFilterCubicImageViewImageFormatPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkFilterCubicImageViewImageFormatPropertiesEXT> {
+    static const uint32_t kIndex = 244;
+};
+
 // Map type VkImportMemoryHostPointerInfoEXT to id VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT
 template <> struct LvlTypeMap<VkImportMemoryHostPointerInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
@@ -4260,6 +5242,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO
     typedef VkImportMemoryHostPointerInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryHostPointerInfoEXT> {
+    static const uint32_t kIndex = 245;
+};
+
 // Map type VkMemoryHostPointerPropertiesEXT to id VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkMemoryHostPointerPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
@@ -4278,6 +5264,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY
     typedef VkPhysicalDeviceExternalMemoryHostPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExternalMemoryHostPropertiesEXT> {
+    static const uint32_t kIndex = 246;
+};
+
 // Map type VkPipelineCompilerControlCreateInfoAMD to id VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD
 template <> struct LvlTypeMap<VkPipelineCompilerControlCreateInfoAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD;
@@ -4287,6 +5277,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREAT
     typedef VkPipelineCompilerControlCreateInfoAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineCompilerControlCreateInfoAMD> {
+    static const uint32_t kIndex = 247;
+};
+
 // Map type VkCalibratedTimestampInfoEXT to id VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT
 template <> struct LvlTypeMap<VkCalibratedTimestampInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
@@ -4305,6 +5299,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PRO
     typedef VkPhysicalDeviceShaderCorePropertiesAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderCorePropertiesAMD> {
+    static const uint32_t kIndex = 248;
+};
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265ProfileEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT
 template <> struct LvlTypeMap<VkVideoDecodeH265ProfileEXT> {
@@ -4315,6 +5313,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT>
     typedef VkVideoDecodeH265ProfileEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265ProfileEXT> {
+    static const uint32_t kIndex = 249;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265CapabilitiesEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT
@@ -4326,6 +5328,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_
     typedef VkVideoDecodeH265CapabilitiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265CapabilitiesEXT> {
+    static const uint32_t kIndex = 250;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265SessionParametersAddInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT
@@ -4337,6 +5343,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAM
     typedef VkVideoDecodeH265SessionParametersAddInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265SessionParametersAddInfoEXT> {
+    static const uint32_t kIndex = 251;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265SessionParametersCreateInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT
@@ -4348,6 +5358,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAM
     typedef VkVideoDecodeH265SessionParametersCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265SessionParametersCreateInfoEXT> {
+    static const uint32_t kIndex = 252;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265PictureInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT
@@ -4359,6 +5373,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_
     typedef VkVideoDecodeH265PictureInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265PictureInfoEXT> {
+    static const uint32_t kIndex = 253;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 // Map type VkVideoDecodeH265DpbSlotInfoEXT to id VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT
@@ -4370,6 +5388,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO
     typedef VkVideoDecodeH265DpbSlotInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkVideoDecodeH265DpbSlotInfoEXT> {
+    static const uint32_t kIndex = 254;
+};
+
 #endif // VK_ENABLE_BETA_EXTENSIONS
 // Map type VkDeviceMemoryOverallocationCreateInfoAMD to id VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD
 template <> struct LvlTypeMap<VkDeviceMemoryOverallocationCreateInfoAMD> {
@@ -4380,6 +5402,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CR
     typedef VkDeviceMemoryOverallocationCreateInfoAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceMemoryOverallocationCreateInfoAMD> {
+    static const uint32_t kIndex = 255;
+};
+
 // Map type VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT;
@@ -4389,6 +5415,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUT
     typedef VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT> {
+    static const uint32_t kIndex = 256;
+};
+
 // Map type VkPipelineVertexInputDivisorStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineVertexInputDivisorStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT;
@@ -4398,6 +5428,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_S
     typedef VkPipelineVertexInputDivisorStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineVertexInputDivisorStateCreateInfoEXT> {
+    static const uint32_t kIndex = 257;
+};
+
 // Map type VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT;
@@ -4407,6 +5441,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUT
     typedef VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT> {
+    static const uint32_t kIndex = 258;
+};
+
 #ifdef VK_USE_PLATFORM_GGP
 // Map type VkPresentFrameTokenGGP to id VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP
 template <> struct LvlTypeMap<VkPresentFrameTokenGGP> {
@@ -4417,6 +5455,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP> {
     typedef VkPresentFrameTokenGGP Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPresentFrameTokenGGP> {
+    static const uint32_t kIndex = 259;
+};
+
 #endif // VK_USE_PLATFORM_GGP
 // Map type VkPhysicalDeviceComputeShaderDerivativesFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV> {
@@ -4427,6 +5469,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_
     typedef VkPhysicalDeviceComputeShaderDerivativesFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV> {
+    static const uint32_t kIndex = 260;
+};
+
 // Map type VkPhysicalDeviceMeshShaderFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceMeshShaderFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV;
@@ -4436,6 +5482,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEA
     typedef VkPhysicalDeviceMeshShaderFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMeshShaderFeaturesNV> {
+    static const uint32_t kIndex = 261;
+};
+
 // Map type VkPhysicalDeviceMeshShaderPropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceMeshShaderPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV;
@@ -4445,6 +5495,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PRO
     typedef VkPhysicalDeviceMeshShaderPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMeshShaderPropertiesNV> {
+    static const uint32_t kIndex = 262;
+};
+
 // Map type VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV;
@@ -4454,6 +5508,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER
     typedef VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV> {
+    static const uint32_t kIndex = 263;
+};
+
 // Map type VkPhysicalDeviceShaderImageFootprintFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderImageFootprintFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV;
@@ -4463,6 +5521,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FO
     typedef VkPhysicalDeviceShaderImageFootprintFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderImageFootprintFeaturesNV> {
+    static const uint32_t kIndex = 264;
+};
+
 // Map type VkPipelineViewportExclusiveScissorStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineViewportExclusiveScissorStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV;
@@ -4472,6 +5534,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCI
     typedef VkPipelineViewportExclusiveScissorStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportExclusiveScissorStateCreateInfoNV> {
+    static const uint32_t kIndex = 265;
+};
+
 // Map type VkPhysicalDeviceExclusiveScissorFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceExclusiveScissorFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV;
@@ -4481,6 +5547,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISS
     typedef VkPhysicalDeviceExclusiveScissorFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExclusiveScissorFeaturesNV> {
+    static const uint32_t kIndex = 266;
+};
+
 // Map type VkQueueFamilyCheckpointPropertiesNV to id VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV
 template <> struct LvlTypeMap<VkQueueFamilyCheckpointPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV;
@@ -4490,6 +5560,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERT
     typedef VkQueueFamilyCheckpointPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueueFamilyCheckpointPropertiesNV> {
+    static const uint32_t kIndex = 267;
+};
+
 // Map type VkCheckpointDataNV to id VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV
 template <> struct LvlTypeMap<VkCheckpointDataNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV;
@@ -4508,6 +5582,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_
     typedef VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL> {
+    static const uint32_t kIndex = 268;
+};
+
 // Map type VkInitializePerformanceApiInfoINTEL to id VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL
 template <> struct LvlTypeMap<VkInitializePerformanceApiInfoINTEL> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL;
@@ -4526,6 +5604,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CR
     typedef VkQueryPoolPerformanceQueryCreateInfoINTEL Type;
 };
 
+template <> struct LvlPNextIndexMap<VkQueryPoolPerformanceQueryCreateInfoINTEL> {
+    static const uint32_t kIndex = 269;
+};
+
 // Map type VkPerformanceMarkerInfoINTEL to id VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL
 template <> struct LvlTypeMap<VkPerformanceMarkerInfoINTEL> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL;
@@ -4571,6 +5653,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PR
     typedef VkPhysicalDevicePCIBusInfoPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePCIBusInfoPropertiesEXT> {
+    static const uint32_t kIndex = 270;
+};
+
 // Map type VkDisplayNativeHdrSurfaceCapabilitiesAMD to id VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD
 template <> struct LvlTypeMap<VkDisplayNativeHdrSurfaceCapabilitiesAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD;
@@ -4580,6 +5666,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPA
     typedef VkDisplayNativeHdrSurfaceCapabilitiesAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDisplayNativeHdrSurfaceCapabilitiesAMD> {
+    static const uint32_t kIndex = 271;
+};
+
 // Map type VkSwapchainDisplayNativeHdrCreateInfoAMD to id VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD
 template <> struct LvlTypeMap<VkSwapchainDisplayNativeHdrCreateInfoAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD;
@@ -4589,6 +5679,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CR
     typedef VkSwapchainDisplayNativeHdrCreateInfoAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSwapchainDisplayNativeHdrCreateInfoAMD> {
+    static const uint32_t kIndex = 272;
+};
+
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkImagePipeSurfaceCreateInfoFUCHSIA to id VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA
 template <> struct LvlTypeMap<VkImagePipeSurfaceCreateInfoFUCHSIA> {
@@ -4620,6 +5714,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMapFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapFeaturesEXT> {
+    static const uint32_t kIndex = 273;
+};
+
 // Map type VkPhysicalDeviceFragmentDensityMapPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentDensityMapPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT;
@@ -4629,6 +5727,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMapPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapPropertiesEXT> {
+    static const uint32_t kIndex = 274;
+};
+
 // Map type VkRenderPassFragmentDensityMapCreateInfoEXT to id VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkRenderPassFragmentDensityMapCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT;
@@ -4638,6 +5740,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MA
     typedef VkRenderPassFragmentDensityMapCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassFragmentDensityMapCreateInfoEXT> {
+    static const uint32_t kIndex = 275;
+};
+
 // Map type VkPhysicalDeviceShaderCoreProperties2AMD to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderCoreProperties2AMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD;
@@ -4647,6 +5753,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PRO
     typedef VkPhysicalDeviceShaderCoreProperties2AMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderCoreProperties2AMD> {
+    static const uint32_t kIndex = 276;
+};
+
 // Map type VkPhysicalDeviceCoherentMemoryFeaturesAMD to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD
 template <> struct LvlTypeMap<VkPhysicalDeviceCoherentMemoryFeaturesAMD> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD;
@@ -4656,6 +5766,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY
     typedef VkPhysicalDeviceCoherentMemoryFeaturesAMD Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCoherentMemoryFeaturesAMD> {
+    static const uint32_t kIndex = 277;
+};
+
 // Map type VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT;
@@ -4665,6 +5779,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_AT
     typedef VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT> {
+    static const uint32_t kIndex = 278;
+};
+
 // Map type VkPhysicalDeviceMemoryBudgetPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceMemoryBudgetPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
@@ -4674,6 +5792,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_P
     typedef VkPhysicalDeviceMemoryBudgetPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMemoryBudgetPropertiesEXT> {
+    static const uint32_t kIndex = 279;
+};
+
 // Map type VkPhysicalDeviceMemoryPriorityFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceMemoryPriorityFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT;
@@ -4683,6 +5805,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY
     typedef VkPhysicalDeviceMemoryPriorityFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMemoryPriorityFeaturesEXT> {
+    static const uint32_t kIndex = 280;
+};
+
 // Map type VkMemoryPriorityAllocateInfoEXT to id VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT
 template <> struct LvlTypeMap<VkMemoryPriorityAllocateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT;
@@ -4692,6 +5818,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_E
     typedef VkMemoryPriorityAllocateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMemoryPriorityAllocateInfoEXT> {
+    static const uint32_t kIndex = 281;
+};
+
 // Map type VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV;
@@ -4701,6 +5831,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOC
     typedef VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV> {
+    static const uint32_t kIndex = 282;
+};
+
 // Map type VkPhysicalDeviceBufferDeviceAddressFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT;
@@ -4710,6 +5844,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_A
     typedef VkPhysicalDeviceBufferDeviceAddressFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT> {
+    static const uint32_t kIndex = 283;
+};
+
 // Map type VkBufferDeviceAddressCreateInfoEXT to id VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkBufferDeviceAddressCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT;
@@ -4719,6 +5857,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_IN
     typedef VkBufferDeviceAddressCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBufferDeviceAddressCreateInfoEXT> {
+    static const uint32_t kIndex = 284;
+};
+
 // Map type VkValidationFeaturesEXT to id VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT
 template <> struct LvlTypeMap<VkValidationFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
@@ -4728,6 +5870,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT> {
     typedef VkValidationFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkValidationFeaturesEXT> {
+    static const uint32_t kIndex = 285;
+};
+
 // Map type VkCooperativeMatrixPropertiesNV to id VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV
 template <> struct LvlTypeMap<VkCooperativeMatrixPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV;
@@ -4746,6 +5892,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MAT
     typedef VkPhysicalDeviceCooperativeMatrixFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCooperativeMatrixFeaturesNV> {
+    static const uint32_t kIndex = 286;
+};
+
 // Map type VkPhysicalDeviceCooperativeMatrixPropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceCooperativeMatrixPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV;
@@ -4755,6 +5905,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MAT
     typedef VkPhysicalDeviceCooperativeMatrixPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCooperativeMatrixPropertiesNV> {
+    static const uint32_t kIndex = 287;
+};
+
 // Map type VkPhysicalDeviceCoverageReductionModeFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceCoverageReductionModeFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV;
@@ -4764,6 +5918,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCT
     typedef VkPhysicalDeviceCoverageReductionModeFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCoverageReductionModeFeaturesNV> {
+    static const uint32_t kIndex = 288;
+};
+
 // Map type VkPipelineCoverageReductionStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineCoverageReductionStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV;
@@ -4773,6 +5931,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STA
     typedef VkPipelineCoverageReductionStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineCoverageReductionStateCreateInfoNV> {
+    static const uint32_t kIndex = 289;
+};
+
 // Map type VkFramebufferMixedSamplesCombinationNV to id VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV
 template <> struct LvlTypeMap<VkFramebufferMixedSamplesCombinationNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV;
@@ -4791,6 +5953,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER
     typedef VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT> {
+    static const uint32_t kIndex = 290;
+};
+
 // Map type VkPhysicalDeviceYcbcrImageArraysFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT;
@@ -4800,6 +5966,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARR
     typedef VkPhysicalDeviceYcbcrImageArraysFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT> {
+    static const uint32_t kIndex = 291;
+};
+
 // Map type VkPhysicalDeviceProvokingVertexFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceProvokingVertexFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT;
@@ -4809,6 +5979,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTE
     typedef VkPhysicalDeviceProvokingVertexFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceProvokingVertexFeaturesEXT> {
+    static const uint32_t kIndex = 292;
+};
+
 // Map type VkPhysicalDeviceProvokingVertexPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceProvokingVertexPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT;
@@ -4818,6 +5992,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTE
     typedef VkPhysicalDeviceProvokingVertexPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceProvokingVertexPropertiesEXT> {
+    static const uint32_t kIndex = 293;
+};
+
 // Map type VkPipelineRasterizationProvokingVertexStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
@@ -4827,6 +6005,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKIN
     typedef VkPipelineRasterizationProvokingVertexStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT> {
+    static const uint32_t kIndex = 294;
+};
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkSurfaceFullScreenExclusiveInfoEXT to id VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT
 template <> struct LvlTypeMap<VkSurfaceFullScreenExclusiveInfoEXT> {
@@ -4837,6 +6019,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_I
     typedef VkSurfaceFullScreenExclusiveInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSurfaceFullScreenExclusiveInfoEXT> {
+    static const uint32_t kIndex = 295;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkSurfaceCapabilitiesFullScreenExclusiveEXT to id VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT
@@ -4848,6 +6034,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREE
     typedef VkSurfaceCapabilitiesFullScreenExclusiveEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSurfaceCapabilitiesFullScreenExclusiveEXT> {
+    static const uint32_t kIndex = 296;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 // Map type VkSurfaceFullScreenExclusiveWin32InfoEXT to id VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT
@@ -4859,6 +6049,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_W
     typedef VkSurfaceFullScreenExclusiveWin32InfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSurfaceFullScreenExclusiveWin32InfoEXT> {
+    static const uint32_t kIndex = 297;
+};
+
 #endif // VK_USE_PLATFORM_WIN32_KHR
 // Map type VkHeadlessSurfaceCreateInfoEXT to id VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkHeadlessSurfaceCreateInfoEXT> {
@@ -4878,6 +6072,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZAT
     typedef VkPhysicalDeviceLineRasterizationFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceLineRasterizationFeaturesEXT> {
+    static const uint32_t kIndex = 298;
+};
+
 // Map type VkPhysicalDeviceLineRasterizationPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceLineRasterizationPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT;
@@ -4887,6 +6085,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZAT
     typedef VkPhysicalDeviceLineRasterizationPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceLineRasterizationPropertiesEXT> {
+    static const uint32_t kIndex = 299;
+};
+
 // Map type VkPipelineRasterizationLineStateCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineRasterizationLineStateCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT;
@@ -4896,6 +6098,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STA
     typedef VkPipelineRasterizationLineStateCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineRasterizationLineStateCreateInfoEXT> {
+    static const uint32_t kIndex = 300;
+};
+
 // Map type VkPhysicalDeviceShaderAtomicFloatFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT;
@@ -4905,6 +6111,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_F
     typedef VkPhysicalDeviceShaderAtomicFloatFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT> {
+    static const uint32_t kIndex = 301;
+};
+
 // Map type VkPhysicalDeviceIndexTypeUint8FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceIndexTypeUint8FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT;
@@ -4914,6 +6124,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT
     typedef VkPhysicalDeviceIndexTypeUint8FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceIndexTypeUint8FeaturesEXT> {
+    static const uint32_t kIndex = 302;
+};
+
 // Map type VkPhysicalDeviceExtendedDynamicStateFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
@@ -4923,6 +6137,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMI
     typedef VkPhysicalDeviceExtendedDynamicStateFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT> {
+    static const uint32_t kIndex = 303;
+};
+
 // Map type VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT;
@@ -4932,6 +6150,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_F
     typedef VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT> {
+    static const uint32_t kIndex = 304;
+};
+
 // Map type VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV;
@@ -4941,6 +6163,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATE
     typedef VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV> {
+    static const uint32_t kIndex = 305;
+};
+
 // Map type VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV;
@@ -4950,6 +6176,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATE
     typedef VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV> {
+    static const uint32_t kIndex = 306;
+};
+
 // Map type VkGraphicsShaderGroupCreateInfoNV to id VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkGraphicsShaderGroupCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV;
@@ -4968,6 +6198,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS
     typedef VkGraphicsPipelineShaderGroupsCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkGraphicsPipelineShaderGroupsCreateInfoNV> {
+    static const uint32_t kIndex = 307;
+};
+
 // Map type VkIndirectCommandsLayoutTokenNV to id VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV
 template <> struct LvlTypeMap<VkIndirectCommandsLayoutTokenNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV;
@@ -5013,6 +6247,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWP
     typedef VkPhysicalDeviceInheritedViewportScissorFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceInheritedViewportScissorFeaturesNV> {
+    static const uint32_t kIndex = 308;
+};
+
 // Map type VkCommandBufferInheritanceViewportScissorInfoNV to id VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV
 template <> struct LvlTypeMap<VkCommandBufferInheritanceViewportScissorInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV;
@@ -5022,6 +6260,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEW
     typedef VkCommandBufferInheritanceViewportScissorInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkCommandBufferInheritanceViewportScissorInfoNV> {
+    static const uint32_t kIndex = 309;
+};
+
 // Map type VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT;
@@ -5031,6 +6273,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_AL
     typedef VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT> {
+    static const uint32_t kIndex = 310;
+};
+
 // Map type VkRenderPassTransformBeginInfoQCOM to id VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM
 template <> struct LvlTypeMap<VkRenderPassTransformBeginInfoQCOM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM;
@@ -5040,6 +6286,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INF
     typedef VkRenderPassTransformBeginInfoQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkRenderPassTransformBeginInfoQCOM> {
+    static const uint32_t kIndex = 311;
+};
+
 // Map type VkCommandBufferInheritanceRenderPassTransformInfoQCOM to id VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM
 template <> struct LvlTypeMap<VkCommandBufferInheritanceRenderPassTransformInfoQCOM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM;
@@ -5049,6 +6299,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_REND
     typedef VkCommandBufferInheritanceRenderPassTransformInfoQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkCommandBufferInheritanceRenderPassTransformInfoQCOM> {
+    static const uint32_t kIndex = 312;
+};
+
 // Map type VkPhysicalDeviceDeviceMemoryReportFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT;
@@ -5058,6 +6312,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_R
     typedef VkPhysicalDeviceDeviceMemoryReportFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT> {
+    static const uint32_t kIndex = 313;
+};
+
 // Map type VkDeviceMemoryReportCallbackDataEXT to id VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT
 template <> struct LvlTypeMap<VkDeviceMemoryReportCallbackDataEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT;
@@ -5076,6 +6334,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CRE
     typedef VkDeviceDeviceMemoryReportCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceDeviceMemoryReportCreateInfoEXT> {
+    static const uint32_t kIndex = 314;
+};
+
 // Map type VkPhysicalDeviceRobustness2FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceRobustness2FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT;
@@ -5085,6 +6347,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FE
     typedef VkPhysicalDeviceRobustness2FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRobustness2FeaturesEXT> {
+    static const uint32_t kIndex = 315;
+};
+
 // Map type VkPhysicalDeviceRobustness2PropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceRobustness2PropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT;
@@ -5094,6 +6360,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PR
     typedef VkPhysicalDeviceRobustness2PropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRobustness2PropertiesEXT> {
+    static const uint32_t kIndex = 316;
+};
+
 // Map type VkSamplerCustomBorderColorCreateInfoEXT to id VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkSamplerCustomBorderColorCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT;
@@ -5103,6 +6373,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CRE
     typedef VkSamplerCustomBorderColorCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSamplerCustomBorderColorCreateInfoEXT> {
+    static const uint32_t kIndex = 317;
+};
+
 // Map type VkPhysicalDeviceCustomBorderColorPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceCustomBorderColorPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT;
@@ -5112,6 +6386,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_C
     typedef VkPhysicalDeviceCustomBorderColorPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCustomBorderColorPropertiesEXT> {
+    static const uint32_t kIndex = 318;
+};
+
 // Map type VkPhysicalDeviceCustomBorderColorFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceCustomBorderColorFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT;
@@ -5121,6 +6399,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_C
     typedef VkPhysicalDeviceCustomBorderColorFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceCustomBorderColorFeaturesEXT> {
+    static const uint32_t kIndex = 319;
+};
+
 // Map type VkPhysicalDeviceDiagnosticsConfigFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceDiagnosticsConfigFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV;
@@ -5130,6 +6412,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CON
     typedef VkPhysicalDeviceDiagnosticsConfigFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDiagnosticsConfigFeaturesNV> {
+    static const uint32_t kIndex = 320;
+};
+
 // Map type VkDeviceDiagnosticsConfigCreateInfoNV to id VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkDeviceDiagnosticsConfigCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV;
@@ -5139,6 +6425,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREAT
     typedef VkDeviceDiagnosticsConfigCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkDeviceDiagnosticsConfigCreateInfoNV> {
+    static const uint32_t kIndex = 321;
+};
+
 // Map type VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
@@ -5148,6 +6438,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELI
     typedef VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT> {
+    static const uint32_t kIndex = 322;
+};
+
 // Map type VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
@@ -5157,6 +6451,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELI
     typedef VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT> {
+    static const uint32_t kIndex = 323;
+};
+
 // Map type VkGraphicsPipelineLibraryCreateInfoEXT to id VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkGraphicsPipelineLibraryCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
@@ -5166,6 +6464,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREAT
     typedef VkGraphicsPipelineLibraryCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkGraphicsPipelineLibraryCreateInfoEXT> {
+    static const uint32_t kIndex = 324;
+};
+
 // Map type VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV;
@@ -5175,6 +6477,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADIN
     typedef VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV> {
+    static const uint32_t kIndex = 325;
+};
+
 // Map type VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV;
@@ -5184,6 +6490,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADIN
     typedef VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV> {
+    static const uint32_t kIndex = 326;
+};
+
 // Map type VkPipelineFragmentShadingRateEnumStateCreateInfoNV to id VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV
 template <> struct LvlTypeMap<VkPipelineFragmentShadingRateEnumStateCreateInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV;
@@ -5193,6 +6503,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_
     typedef VkPipelineFragmentShadingRateEnumStateCreateInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineFragmentShadingRateEnumStateCreateInfoNV> {
+    static const uint32_t kIndex = 327;
+};
+
 // Map type VkAccelerationStructureGeometryMotionTrianglesDataNV to id VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV
 template <> struct LvlTypeMap<VkAccelerationStructureGeometryMotionTrianglesDataNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV;
@@ -5202,6 +6516,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY
     typedef VkAccelerationStructureGeometryMotionTrianglesDataNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAccelerationStructureGeometryMotionTrianglesDataNV> {
+    static const uint32_t kIndex = 328;
+};
+
 // Map type VkAccelerationStructureMotionInfoNV to id VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV
 template <> struct LvlTypeMap<VkAccelerationStructureMotionInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV;
@@ -5211,6 +6529,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_I
     typedef VkAccelerationStructureMotionInfoNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkAccelerationStructureMotionInfoNV> {
+    static const uint32_t kIndex = 329;
+};
+
 // Map type VkPhysicalDeviceRayTracingMotionBlurFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV;
@@ -5220,6 +6542,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOT
     typedef VkPhysicalDeviceRayTracingMotionBlurFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV> {
+    static const uint32_t kIndex = 330;
+};
+
 // Map type VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT;
@@ -5229,6 +6555,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_4
     typedef VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT> {
+    static const uint32_t kIndex = 331;
+};
+
 // Map type VkPhysicalDeviceFragmentDensityMap2FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT;
@@ -5238,6 +6568,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMap2FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT> {
+    static const uint32_t kIndex = 332;
+};
+
 // Map type VkPhysicalDeviceFragmentDensityMap2PropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT;
@@ -5247,6 +6581,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMap2PropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT> {
+    static const uint32_t kIndex = 333;
+};
+
 // Map type VkCopyCommandTransformInfoQCOM to id VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM
 template <> struct LvlTypeMap<VkCopyCommandTransformInfoQCOM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM;
@@ -5256,6 +6594,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCO
     typedef VkCopyCommandTransformInfoQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkCopyCommandTransformInfoQCOM> {
+    static const uint32_t kIndex = 334;
+};
+
 // Map type VkPhysicalDevice4444FormatsFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDevice4444FormatsFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT;
@@ -5265,6 +6607,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FE
     typedef VkPhysicalDevice4444FormatsFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevice4444FormatsFeaturesEXT> {
+    static const uint32_t kIndex = 335;
+};
+
 // Map type VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesARM to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_ARM
 template <> struct LvlTypeMap<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesARM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_ARM;
@@ -5274,6 +6620,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_O
     typedef VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesARM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesARM> {
+    static const uint32_t kIndex = 336;
+};
+
 // Map type VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT;
@@ -5283,6 +6633,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMAT
     typedef VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT> {
+    static const uint32_t kIndex = 337;
+};
+
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
 // Map type VkDirectFBSurfaceCreateInfoEXT to id VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkDirectFBSurfaceCreateInfoEXT> {
@@ -5303,6 +6657,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIP
     typedef VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE> {
+    static const uint32_t kIndex = 338;
+};
+
 // Map type VkMutableDescriptorTypeCreateInfoVALVE to id VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE
 template <> struct LvlTypeMap<VkMutableDescriptorTypeCreateInfoVALVE> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE;
@@ -5312,6 +6670,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_
     typedef VkMutableDescriptorTypeCreateInfoVALVE Type;
 };
 
+template <> struct LvlPNextIndexMap<VkMutableDescriptorTypeCreateInfoVALVE> {
+    static const uint32_t kIndex = 339;
+};
+
 // Map type VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT;
@@ -5321,6 +6683,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DY
     typedef VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT> {
+    static const uint32_t kIndex = 340;
+};
+
 // Map type VkVertexInputBindingDescription2EXT to id VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT
 template <> struct LvlTypeMap<VkVertexInputBindingDescription2EXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT;
@@ -5348,6 +6714,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_
     typedef VkPhysicalDeviceDrmPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDrmPropertiesEXT> {
+    static const uint32_t kIndex = 341;
+};
+
 // Map type VkPhysicalDeviceDepthClipControlFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceDepthClipControlFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT;
@@ -5357,6 +6727,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONT
     typedef VkPhysicalDeviceDepthClipControlFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDepthClipControlFeaturesEXT> {
+    static const uint32_t kIndex = 342;
+};
+
 // Map type VkPipelineViewportDepthClipControlCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineViewportDepthClipControlCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT;
@@ -5366,6 +6740,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CO
     typedef VkPipelineViewportDepthClipControlCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineViewportDepthClipControlCreateInfoEXT> {
+    static const uint32_t kIndex = 343;
+};
+
 // Map type VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT;
@@ -5375,6 +6753,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOL
     typedef VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT> {
+    static const uint32_t kIndex = 344;
+};
+
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkImportMemoryZirconHandleInfoFUCHSIA to id VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA
 template <> struct LvlTypeMap<VkImportMemoryZirconHandleInfoFUCHSIA> {
@@ -5385,6 +6767,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INF
     typedef VkImportMemoryZirconHandleInfoFUCHSIA Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryZirconHandleInfoFUCHSIA> {
+    static const uint32_t kIndex = 345;
+};
+
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkMemoryZirconHandlePropertiesFUCHSIA to id VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA
@@ -5451,6 +6837,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION
     typedef VkImportMemoryBufferCollectionFUCHSIA Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImportMemoryBufferCollectionFUCHSIA> {
+    static const uint32_t kIndex = 346;
+};
+
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkBufferCollectionImageCreateInfoFUCHSIA to id VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA
@@ -5462,6 +6852,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_
     typedef VkBufferCollectionImageCreateInfoFUCHSIA Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBufferCollectionImageCreateInfoFUCHSIA> {
+    static const uint32_t kIndex = 347;
+};
+
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkBufferCollectionConstraintsInfoFUCHSIA to id VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA
@@ -5495,6 +6889,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE
     typedef VkBufferCollectionBufferCreateInfoFUCHSIA Type;
 };
 
+template <> struct LvlPNextIndexMap<VkBufferCollectionBufferCreateInfoFUCHSIA> {
+    static const uint32_t kIndex = 348;
+};
+
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
 // Map type VkSysmemColorSpaceFUCHSIA to id VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA
@@ -5549,6 +6947,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE
     typedef VkSubpassShadingPipelineCreateInfoHUAWEI Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSubpassShadingPipelineCreateInfoHUAWEI> {
+    static const uint32_t kIndex = 349;
+};
+
 // Map type VkPhysicalDeviceSubpassShadingFeaturesHUAWEI to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI
 template <> struct LvlTypeMap<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI;
@@ -5558,6 +6960,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING
     typedef VkPhysicalDeviceSubpassShadingFeaturesHUAWEI Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI> {
+    static const uint32_t kIndex = 350;
+};
+
 // Map type VkPhysicalDeviceSubpassShadingPropertiesHUAWEI to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI
 template <> struct LvlTypeMap<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI;
@@ -5567,6 +6973,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING
     typedef VkPhysicalDeviceSubpassShadingPropertiesHUAWEI Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI> {
+    static const uint32_t kIndex = 351;
+};
+
 // Map type VkPhysicalDeviceInvocationMaskFeaturesHUAWEI to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI
 template <> struct LvlTypeMap<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI;
@@ -5576,6 +6986,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK
     typedef VkPhysicalDeviceInvocationMaskFeaturesHUAWEI Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI> {
+    static const uint32_t kIndex = 352;
+};
+
 // Map type VkMemoryGetRemoteAddressInfoNV to id VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV
 template <> struct LvlTypeMap<VkMemoryGetRemoteAddressInfoNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV;
@@ -5594,6 +7008,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY
     typedef VkPhysicalDeviceExternalMemoryRDMAFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV> {
+    static const uint32_t kIndex = 353;
+};
+
 // Map type VkPhysicalDeviceExtendedDynamicState2FeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
@@ -5603,6 +7021,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMI
     typedef VkPhysicalDeviceExtendedDynamicState2FeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT> {
+    static const uint32_t kIndex = 354;
+};
+
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
 // Map type VkScreenSurfaceCreateInfoQNX to id VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX
 template <> struct LvlTypeMap<VkScreenSurfaceCreateInfoQNX> {
@@ -5623,6 +7045,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENA
     typedef VkPhysicalDeviceColorWriteEnableFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceColorWriteEnableFeaturesEXT> {
+    static const uint32_t kIndex = 355;
+};
+
 // Map type VkPipelineColorWriteCreateInfoEXT to id VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkPipelineColorWriteCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT;
@@ -5632,6 +7058,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INF
     typedef VkPipelineColorWriteCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPipelineColorWriteCreateInfoEXT> {
+    static const uint32_t kIndex = 356;
+};
+
 // Map type VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT;
@@ -5641,6 +7071,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENE
     typedef VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT> {
+    static const uint32_t kIndex = 357;
+};
+
 // Map type VkPhysicalDeviceImageViewMinLodFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceImageViewMinLodFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT;
@@ -5650,6 +7084,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_
     typedef VkPhysicalDeviceImageViewMinLodFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImageViewMinLodFeaturesEXT> {
+    static const uint32_t kIndex = 358;
+};
+
 // Map type VkImageViewMinLodCreateInfoEXT to id VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkImageViewMinLodCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT;
@@ -5659,6 +7097,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_
     typedef VkImageViewMinLodCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkImageViewMinLodCreateInfoEXT> {
+    static const uint32_t kIndex = 359;
+};
+
 // Map type VkPhysicalDeviceMultiDrawFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceMultiDrawFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT;
@@ -5668,6 +7110,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEAT
     typedef VkPhysicalDeviceMultiDrawFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMultiDrawFeaturesEXT> {
+    static const uint32_t kIndex = 360;
+};
+
 // Map type VkPhysicalDeviceMultiDrawPropertiesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceMultiDrawPropertiesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
@@ -5677,6 +7123,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROP
     typedef VkPhysicalDeviceMultiDrawPropertiesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceMultiDrawPropertiesEXT> {
+    static const uint32_t kIndex = 361;
+};
+
 // Map type VkPhysicalDeviceImage2DViewOf3DFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT;
@@ -5686,6 +7136,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_O
     typedef VkPhysicalDeviceImage2DViewOf3DFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT> {
+    static const uint32_t kIndex = 362;
+};
+
 // Map type VkPhysicalDeviceBorderColorSwizzleFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT;
@@ -5695,6 +7149,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SW
     typedef VkPhysicalDeviceBorderColorSwizzleFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT> {
+    static const uint32_t kIndex = 363;
+};
+
 // Map type VkSamplerBorderColorComponentMappingCreateInfoEXT to id VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT
 template <> struct LvlTypeMap<VkSamplerBorderColorComponentMappingCreateInfoEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT;
@@ -5704,6 +7162,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_
     typedef VkSamplerBorderColorComponentMappingCreateInfoEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSamplerBorderColorComponentMappingCreateInfoEXT> {
+    static const uint32_t kIndex = 364;
+};
+
 // Map type VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT
 template <> struct LvlTypeMap<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT;
@@ -5713,6 +7175,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE
     typedef VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT> {
+    static const uint32_t kIndex = 365;
+};
+
 // Map type VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE
 template <> struct LvlTypeMap<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE;
@@ -5722,6 +7188,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_
     typedef VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE> {
+    static const uint32_t kIndex = 366;
+};
+
 // Map type VkDescriptorSetBindingReferenceVALVE to id VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE
 template <> struct LvlTypeMap<VkDescriptorSetBindingReferenceVALVE> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE;
@@ -5749,6 +7219,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM> {
+    static const uint32_t kIndex = 367;
+};
+
 // Map type VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM
 template <> struct LvlTypeMap<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM;
@@ -5758,6 +7232,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSIT
     typedef VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM> {
+    static const uint32_t kIndex = 368;
+};
+
 // Map type VkSubpassFragmentDensityMapOffsetEndInfoQCOM to id VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM
 template <> struct LvlTypeMap<VkSubpassFragmentDensityMapOffsetEndInfoQCOM> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM;
@@ -5767,6 +7245,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OF
     typedef VkSubpassFragmentDensityMapOffsetEndInfoQCOM Type;
 };
 
+template <> struct LvlPNextIndexMap<VkSubpassFragmentDensityMapOffsetEndInfoQCOM> {
+    static const uint32_t kIndex = 369;
+};
+
 // Map type VkPhysicalDeviceLinearColorAttachmentFeaturesNV to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV
 template <> struct LvlTypeMap<VkPhysicalDeviceLinearColorAttachmentFeaturesNV> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV;
@@ -5776,6 +7258,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_AT
     typedef VkPhysicalDeviceLinearColorAttachmentFeaturesNV Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceLinearColorAttachmentFeaturesNV> {
+    static const uint32_t kIndex = 370;
+};
+
 // Map type VkAccelerationStructureGeometryTrianglesDataKHR to id VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR
 template <> struct LvlTypeMap<VkAccelerationStructureGeometryTrianglesDataKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR;
@@ -5839,6 +7325,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATI
     typedef VkWriteDescriptorSetAccelerationStructureKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkWriteDescriptorSetAccelerationStructureKHR> {
+    static const uint32_t kIndex = 371;
+};
+
 // Map type VkPhysicalDeviceAccelerationStructureFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceAccelerationStructureFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR;
@@ -5848,6 +7338,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_ST
     typedef VkPhysicalDeviceAccelerationStructureFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceAccelerationStructureFeaturesKHR> {
+    static const uint32_t kIndex = 372;
+};
+
 // Map type VkPhysicalDeviceAccelerationStructurePropertiesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceAccelerationStructurePropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR;
@@ -5857,6 +7351,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_ST
     typedef VkPhysicalDeviceAccelerationStructurePropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceAccelerationStructurePropertiesKHR> {
+    static const uint32_t kIndex = 373;
+};
+
 // Map type VkAccelerationStructureDeviceAddressInfoKHR to id VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR
 template <> struct LvlTypeMap<VkAccelerationStructureDeviceAddressInfoKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
@@ -5947,6 +7445,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIP
     typedef VkPhysicalDeviceRayTracingPipelineFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRayTracingPipelineFeaturesKHR> {
+    static const uint32_t kIndex = 374;
+};
+
 // Map type VkPhysicalDeviceRayTracingPipelinePropertiesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceRayTracingPipelinePropertiesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR;
@@ -5956,6 +7458,10 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIP
     typedef VkPhysicalDeviceRayTracingPipelinePropertiesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRayTracingPipelinePropertiesKHR> {
+    static const uint32_t kIndex = 375;
+};
+
 // Map type VkPhysicalDeviceRayQueryFeaturesKHR to id VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR
 template <> struct LvlTypeMap<VkPhysicalDeviceRayQueryFeaturesKHR> {
     static const VkStructureType kSType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR;
@@ -5965,6 +7471,784 @@ template <> struct LvlSTypeMap<VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATU
     typedef VkPhysicalDeviceRayQueryFeaturesKHR Type;
 };
 
+template <> struct LvlPNextIndexMap<VkPhysicalDeviceRayQueryFeaturesKHR> {
+    static const uint32_t kIndex = 376;
+};
+
+static const uint32_t kLvlPNextIndexCount = 377;
+
+// Index of a pNext struct by its sType, kLvlPNextIndexCount for sTypes that do not extend another struct
+static inline uint32_t LvlPNextIndexOf(VkStructureType sType) {
+    switch (sType) {
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
+            return LvlPNextIndexMap<VkShaderModuleCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSubgroupProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDevice16BitStorageFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+            return LvlPNextIndexMap<VkMemoryDedicatedRequirements>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            return LvlPNextIndexMap<VkMemoryDedicatedAllocateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            return LvlPNextIndexMap<VkMemoryAllocateFlagsInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+            return LvlPNextIndexMap<VkDeviceGroupRenderPassBeginInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+            return LvlPNextIndexMap<VkDeviceGroupCommandBufferBeginInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+            return LvlPNextIndexMap<VkDeviceGroupSubmitInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+            return LvlPNextIndexMap<VkDeviceGroupBindSparseInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+            return LvlPNextIndexMap<VkBindBufferMemoryDeviceGroupInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+            return LvlPNextIndexMap<VkBindImageMemoryDeviceGroupInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+            return LvlPNextIndexMap<VkDeviceGroupDeviceCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+            return LvlPNextIndexMap<VkPhysicalDeviceFeatures2>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDevicePointClippingProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+            return LvlPNextIndexMap<VkRenderPassInputAttachmentAspectCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            return LvlPNextIndexMap<VkImageViewUsageCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            return LvlPNextIndexMap<VkPipelineTessellationDomainOriginStateCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+            return LvlPNextIndexMap<VkRenderPassMultiviewCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceMultiviewFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceMultiviewProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVariablePointersFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceProtectedMemoryFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceProtectedMemoryProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+            return LvlPNextIndexMap<VkProtectedSubmitInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            return LvlPNextIndexMap<VkSamplerYcbcrConversionInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+            return LvlPNextIndexMap<VkBindImagePlaneMemoryInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+            return LvlPNextIndexMap<VkImagePlaneMemoryRequirementsInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSamplerYcbcrConversionFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+            return LvlPNextIndexMap<VkSamplerYcbcrConversionImageFormatProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+            return LvlPNextIndexMap<VkPhysicalDeviceExternalImageFormatInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+            return LvlPNextIndexMap<VkExternalImageFormatProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceIDProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            return LvlPNextIndexMap<VkExternalMemoryImageCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            return LvlPNextIndexMap<VkExternalMemoryBufferCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            return LvlPNextIndexMap<VkExportMemoryAllocateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+            return LvlPNextIndexMap<VkExportFenceCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+            return LvlPNextIndexMap<VkExportSemaphoreCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceMaintenance3Properties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderDrawParametersFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan11Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan11Properties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan12Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan12Properties>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+            return LvlPNextIndexMap<VkImageFormatListCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDevice8BitStorageFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceDriverProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicInt64Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderFloat16Int8Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceFloatControlsProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO:
+            return LvlPNextIndexMap<VkDescriptorSetLayoutBindingFlagsCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceDescriptorIndexingFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceDescriptorIndexingProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO:
+            return LvlPNextIndexMap<VkDescriptorSetVariableDescriptorCountAllocateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT:
+            return LvlPNextIndexMap<VkDescriptorSetVariableDescriptorCountLayoutSupport>::kIndex;
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE:
+            return LvlPNextIndexMap<VkSubpassDescriptionDepthStencilResolve>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceDepthStencilResolveProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceScalarBlockLayoutFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+            return LvlPNextIndexMap<VkImageStencilUsageCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+            return LvlPNextIndexMap<VkSamplerReductionModeCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSamplerFilterMinmaxProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkanMemoryModelFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceImagelessFramebufferFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO:
+            return LvlPNextIndexMap<VkFramebufferAttachmentsCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+            return LvlPNextIndexMap<VkRenderPassAttachmentBeginInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT:
+            return LvlPNextIndexMap<VkAttachmentReferenceStencilLayout>::kIndex;
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT:
+            return LvlPNextIndexMap<VkAttachmentDescriptionStencilLayout>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceHostQueryResetFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceTimelineSemaphoreFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceTimelineSemaphoreProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO:
+            return LvlPNextIndexMap<VkSemaphoreTypeCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+            return LvlPNextIndexMap<VkTimelineSemaphoreSubmitInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceBufferDeviceAddressFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+            return LvlPNextIndexMap<VkBufferOpaqueCaptureAddressCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
+            return LvlPNextIndexMap<VkMemoryOpaqueCaptureAddressAllocateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan13Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceVulkan13Properties>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO:
+            return LvlPNextIndexMap<VkPipelineCreationFeedbackCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderTerminateInvocationFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDevicePrivateDataFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO:
+            return LvlPNextIndexMap<VkDevicePrivateDataCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDevicePipelineCreationCacheControlFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2:
+            return LvlPNextIndexMap<VkMemoryBarrier2>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSynchronization2Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceImageRobustnessFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSubgroupSizeControlFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceSubgroupSizeControlProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+            return LvlPNextIndexMap<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceInlineUniformBlockFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceInlineUniformBlockProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK:
+            return LvlPNextIndexMap<VkWriteDescriptorSetInlineUniformBlock>::kIndex;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO:
+            return LvlPNextIndexMap<VkDescriptorPoolInlineUniformBlockCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            return LvlPNextIndexMap<VkPipelineRenderingCreateInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceDynamicRenderingFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO:
+            return LvlPNextIndexMap<VkCommandBufferInheritanceRenderingInfo>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerDotProductFeatures>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerDotProductProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceTexelBufferAlignmentProperties>::kIndex;
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3:
+            return LvlPNextIndexMap<VkFormatProperties3>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES:
+            return LvlPNextIndexMap<VkPhysicalDeviceMaintenance4Features>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES:
+            return LvlPNextIndexMap<VkPhysicalDeviceMaintenance4Properties>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkImageSwapchainCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            return LvlPNextIndexMap<VkBindImageMemorySwapchainInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+            return LvlPNextIndexMap<VkDeviceGroupPresentInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkDeviceGroupSwapchainCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+            return LvlPNextIndexMap<VkDisplayPresentInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+            return LvlPNextIndexMap<VkRenderingFragmentShadingRateAttachmentInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT:
+            return LvlPNextIndexMap<VkRenderingFragmentDensityMapAttachmentInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD:
+            return LvlPNextIndexMap<VkAttachmentSampleCountInfoAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX:
+            return LvlPNextIndexMap<VkMultiviewPerViewAttributesInfoNVX>::kIndex;
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+            return LvlPNextIndexMap<VkImportMemoryFdInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePushDescriptorPropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+            return LvlPNextIndexMap<VkPresentRegionsKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+            return LvlPNextIndexMap<VkSharedPresentSurfaceCapabilitiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePerformanceQueryFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePerformanceQueryPropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkQueryPoolPerformanceCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR:
+            return LvlPNextIndexMap<VkPerformanceQuerySubmitInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderClockFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkDeviceQueueGlobalPriorityCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkQueueFamilyGlobalPriorityPropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+            return LvlPNextIndexMap<VkFragmentShadingRateAttachmentInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkPipelineFragmentShadingRateStateCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRatePropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR:
+            return LvlPNextIndexMap<VkSurfaceProtectedCapabilitiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePresentWaitFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+            return LvlPNextIndexMap<VkPipelineLibraryCreateInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PRESENT_ID_KHR:
+            return LvlPNextIndexMap<VkPresentIdKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePresentIdFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV:
+            return LvlPNextIndexMap<VkQueueFamilyCheckpointProperties2NV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkDebugReportCallbackCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+            return LvlPNextIndexMap<VkPipelineRasterizationStateRasterizationOrderAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkDedicatedAllocationImageCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkDedicatedAllocationBufferCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+            return LvlPNextIndexMap<VkDedicatedAllocationMemoryAllocateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceTransformFeedbackFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceTransformFeedbackPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineRasterizationStateStreamCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+            return LvlPNextIndexMap<VkTextureLODGatherFormatPropertiesAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceCornerSampledImageFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkExternalMemoryImageCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+            return LvlPNextIndexMap<VkExportMemoryAllocateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+            return LvlPNextIndexMap<VkValidationFlagsEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
+            return LvlPNextIndexMap<VkImageViewASTCDecodeModeEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceASTCDecodeFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceConditionalRenderingFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+            return LvlPNextIndexMap<VkCommandBufferInheritanceConditionalRenderingInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineViewportWScalingStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkSwapchainCounterCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+            return LvlPNextIndexMap<VkPresentTimesInfoGOOGLE>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+            return LvlPNextIndexMap<VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineViewportSwizzleStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceDiscardRectanglePropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineDiscardRectangleStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceConservativeRasterizationPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineRasterizationConservativeStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceDepthClipEnableFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineRasterizationDepthClipStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT:
+            return LvlPNextIndexMap<VkDebugUtilsObjectNameInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkDebugUtilsMessengerCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+            return LvlPNextIndexMap<VkSampleLocationsInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+            return LvlPNextIndexMap<VkRenderPassSampleLocationsBeginInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineSampleLocationsStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceSampleLocationsPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineColorBlendAdvancedStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineCoverageToColorStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineCoverageModulationStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT:
+            return LvlPNextIndexMap<VkDrmFormatModifierPropertiesListEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceImageDrmFormatModifierInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkImageDrmFormatModifierListCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkImageDrmFormatModifierExplicitCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT:
+            return LvlPNextIndexMap<VkDrmFormatModifierPropertiesList2EXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkShaderModuleValidationCacheCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineViewportShadingRateImageStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceShadingRateImageFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceShadingRateImagePropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
+            return LvlPNextIndexMap<VkWriteDescriptorSetAccelerationStructureNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceRayTracingPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineRepresentativeFragmentTestStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceImageViewImageFormatInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkFilterCubicImageViewImageFormatPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT:
+            return LvlPNextIndexMap<VkImportMemoryHostPointerInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceExternalMemoryHostPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD:
+            return LvlPNextIndexMap<VkPipelineCompilerControlCreateInfoAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderCorePropertiesAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD:
+            return LvlPNextIndexMap<VkDeviceMemoryOverallocationCreateInfoAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineVertexInputDivisorStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceMeshShaderFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceMeshShaderPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderImageFootprintFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineViewportExclusiveScissorStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceExclusiveScissorFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkQueueFamilyCheckpointPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>::kIndex;
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL:
+            return LvlPNextIndexMap<VkQueryPoolPerformanceQueryCreateInfoINTEL>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDevicePCIBusInfoPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD:
+            return LvlPNextIndexMap<VkDisplayNativeHdrSurfaceCapabilitiesAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD:
+            return LvlPNextIndexMap<VkSwapchainDisplayNativeHdrCreateInfoAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkRenderPassFragmentDensityMapCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderCoreProperties2AMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD:
+            return LvlPNextIndexMap<VkPhysicalDeviceCoherentMemoryFeaturesAMD>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceMemoryBudgetPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceMemoryPriorityFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT:
+            return LvlPNextIndexMap<VkMemoryPriorityAllocateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkBufferDeviceAddressCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT:
+            return LvlPNextIndexMap<VkValidationFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceCooperativeMatrixFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceCooperativeMatrixPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceCoverageReductionModeFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineCoverageReductionStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceProvokingVertexFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceProvokingVertexPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceLineRasterizationFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceLineRasterizationPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineRasterizationLineStateCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceIndexTypeUint8FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkGraphicsPipelineShaderGroupsCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV:
+            return LvlPNextIndexMap<VkCommandBufferInheritanceViewportScissorInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM:
+            return LvlPNextIndexMap<VkRenderPassTransformBeginInfoQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM:
+            return LvlPNextIndexMap<VkCommandBufferInheritanceRenderPassTransformInfoQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkDeviceDeviceMemoryReportCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceRobustness2FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceRobustness2PropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkSamplerCustomBorderColorCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceCustomBorderColorPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceCustomBorderColorFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceDiagnosticsConfigFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkDeviceDiagnosticsConfigCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkGraphicsPipelineLibraryCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV:
+            return LvlPNextIndexMap<VkPipelineFragmentShadingRateEnumStateCreateInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV:
+            return LvlPNextIndexMap<VkAccelerationStructureGeometryMotionTrianglesDataNV>::kIndex;
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV:
+            return LvlPNextIndexMap<VkAccelerationStructureMotionInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM:
+            return LvlPNextIndexMap<VkCopyCommandTransformInfoQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDevice4444FormatsFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_ARM:
+            return LvlPNextIndexMap<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesARM>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE:
+            return LvlPNextIndexMap<VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE>::kIndex;
+        case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE:
+            return LvlPNextIndexMap<VkMutableDescriptorTypeCreateInfoVALVE>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceDrmPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceDepthClipControlFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineViewportDepthClipControlCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI:
+            return LvlPNextIndexMap<VkSubpassShadingPipelineCreateInfoHUAWEI>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI:
+            return LvlPNextIndexMap<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI:
+            return LvlPNextIndexMap<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI:
+            return LvlPNextIndexMap<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceColorWriteEnableFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkPipelineColorWriteCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceImageViewMinLodFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkImageViewMinLodCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceMultiDrawFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceMultiDrawPropertiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkSamplerBorderColorComponentMappingCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT:
+            return LvlPNextIndexMap<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE:
+            return LvlPNextIndexMap<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_QCOM:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM:
+            return LvlPNextIndexMap<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM:
+            return LvlPNextIndexMap<VkSubpassFragmentDensityMapOffsetEndInfoQCOM>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV:
+            return LvlPNextIndexMap<VkPhysicalDeviceLinearColorAttachmentFeaturesNV>::kIndex;
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
+            return LvlPNextIndexMap<VkWriteDescriptorSetAccelerationStructureKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceAccelerationStructureFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceAccelerationStructurePropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceRayTracingPipelinePropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDeviceRayQueryFeaturesKHR>::kIndex;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_2_KHR:
+            return LvlPNextIndexMap<VkQueueFamilyQueryResultStatusProperties2KHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_QUEUE_FAMILY_PROPERTIES_2_KHR:
+            return LvlPNextIndexMap<VkVideoQueueFamilyProperties2KHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_KHR:
+            return LvlPNextIndexMap<VkVideoProfileKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILES_KHR:
+            return LvlPNextIndexMap<VkVideoProfilesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR:
+            return LvlPNextIndexMap<VkVideoDecodeCapabilitiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePortabilitySubsetFeaturesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR:
+            return LvlPNextIndexMap<VkPhysicalDevicePortabilitySubsetPropertiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR:
+            return LvlPNextIndexMap<VkVideoEncodeCapabilitiesKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR:
+            return LvlPNextIndexMap<VkVideoEncodeRateControlLayerInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR:
+            return LvlPNextIndexMap<VkVideoEncodeRateControlInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264CapabilitiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264SessionParametersAddInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264SessionParametersCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264VclFrameInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264EmitPictureParametersEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264ProfileEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264RateControlInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH264RateControlLayerInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265CapabilitiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265SessionParametersAddInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265SessionParametersCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265VclFrameInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265EmitPictureParametersEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265ProfileEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265RateControlInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoEncodeH265RateControlLayerInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264ProfileEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264CapabilitiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264SessionParametersAddInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264SessionParametersCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264PictureInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_MVC_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264MvcEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH264DpbSlotInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265ProfileEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265CapabilitiesEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265SessionParametersAddInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265SessionParametersCreateInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265PictureInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT:
+            return LvlPNextIndexMap<VkVideoDecodeH265DpbSlotInfoEXT>::kIndex;
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+            return LvlPNextIndexMap<VkAndroidHardwareBufferUsageANDROID>::kIndex;
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+            return LvlPNextIndexMap<VkAndroidHardwareBufferFormatPropertiesANDROID>::kIndex;
+        case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID:
+            return LvlPNextIndexMap<VkImportAndroidHardwareBufferInfoANDROID>::kIndex;
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            return LvlPNextIndexMap<VkExternalFormatANDROID>::kIndex;
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID:
+            return LvlPNextIndexMap<VkAndroidHardwareBufferFormatProperties2ANDROID>::kIndex;
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA:
+            return LvlPNextIndexMap<VkImportMemoryZirconHandleInfoFUCHSIA>::kIndex;
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA:
+            return LvlPNextIndexMap<VkImportMemoryBufferCollectionFUCHSIA>::kIndex;
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA:
+            return LvlPNextIndexMap<VkBufferCollectionImageCreateInfoFUCHSIA>::kIndex;
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA:
+            return LvlPNextIndexMap<VkBufferCollectionBufferCreateInfoFUCHSIA>::kIndex;
+#endif // VK_USE_PLATFORM_FUCHSIA
+#ifdef VK_USE_PLATFORM_GGP
+        case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP:
+            return LvlPNextIndexMap<VkPresentFrameTokenGGP>::kIndex;
+#endif // VK_USE_PLATFORM_GGP
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+            return LvlPNextIndexMap<VkImportMemoryWin32HandleInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+            return LvlPNextIndexMap<VkExportMemoryWin32HandleInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            return LvlPNextIndexMap<VkWin32KeyedMutexAcquireReleaseInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR:
+            return LvlPNextIndexMap<VkExportSemaphoreWin32HandleInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+            return LvlPNextIndexMap<VkD3D12FenceSubmitInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR:
+            return LvlPNextIndexMap<VkExportFenceWin32HandleInfoKHR>::kIndex;
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+            return LvlPNextIndexMap<VkImportMemoryWin32HandleInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+            return LvlPNextIndexMap<VkExportMemoryWin32HandleInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+            return LvlPNextIndexMap<VkWin32KeyedMutexAcquireReleaseInfoNV>::kIndex;
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT:
+            return LvlPNextIndexMap<VkSurfaceFullScreenExclusiveInfoEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT:
+            return LvlPNextIndexMap<VkSurfaceCapabilitiesFullScreenExclusiveEXT>::kIndex;
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT:
+            return LvlPNextIndexMap<VkSurfaceFullScreenExclusiveWin32InfoEXT>::kIndex;
+#endif // VK_USE_PLATFORM_WIN32_KHR
+        default:
+            return kLvlPNextIndexCount;
+    }
+}
+
 // Find an entry of the given type in the const pNext chain
 template <typename T> const T *LvlFindInChain(const void *next) {
     const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
@@ -6058,3 +8342,24 @@ template <typename T> T lvl_init_struct() {
     return out;
 }
 
+
+// The structs of a const pNext chain, decoded with one walk of the chain so that looking up each of them does not
+// walk it again. Find returns the first struct of the type in the chain, as LvlFindInChain does.
+class LvlPNextIndex {
+  public:
+    explicit LvlPNextIndex(const void *next) : structs_() {
+        for (auto current = reinterpret_cast<const VkBaseOutStructure *>(next); current; current = current->pNext) {
+            const uint32_t index = LvlPNextIndexOf(current->sType);
+            if ((index < kLvlPNextIndexCount) && !structs_[index]) {
+                structs_[index] = current;
+            }
+        }
+    }
+
+    template <typename T> const T *Find() const {
+        return reinterpret_cast<const T *>(structs_[LvlPNextIndexMap<T>::kIndex]);
+    }
+
+  private:
+    const void *structs_[kLvlPNextIndexCount];
+};
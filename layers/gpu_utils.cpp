@@ -27,7 +27,11 @@
 #include "spirv-tools/instrument.hpp"
 #include <spirv/unified1/spirv.hpp>
 #include <algorithm>
+#include <fstream>
+#include <iterator>
 #include <regex>
+#include <generated/spirv_tools_commit_id.h>
+#include "xxhash.h"
 
 #define VMA_IMPLEMENTATION
 // This define indicates that we will supply Vulkan function pointers at initialization
@@ -148,6 +152,206 @@ void UtilDescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool,
     return;
 }
 
+bool UtilPendingReadback::Contains(const CMD_BUFFER_STATE *cb_state) const {
+    for (const auto &primary : command_buffers) {
+        if (primary.get() == cb_state || primary->linkedCommandBuffers.count(const_cast<CMD_BUFFER_STATE *>(cb_state))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UtilAddReadbackCounters(const UtilAsyncReadbackState &async_readback, const char *object_name,
+                             ValidationCounterList &counters) {
+    const std::string prefix = std::string(object_name) + ".";
+    AddValidationCounter(counters, (prefix + "readbacks").c_str(), async_readback.readbacks.Get());
+    AddValidationCounter(counters, (prefix + "readback_latency_us").c_str(), async_readback.readback_latency_us.Get());
+    AddValidationCounter(counters, (prefix + "readback_max_latency_us").c_str(), async_readback.readback_max_latency_us.Get());
+}
+
+uint64_t UtilShaderModuleHash(const std::vector<uint32_t> &words) {
+    return XXH64(words.data(), words.size() * sizeof(uint32_t), 0);
+}
+
+static std::vector<std::string> SplitSetting(const std::string &setting) {
+    std::vector<std::string> items;
+    std::istringstream stream(setting);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const auto begin = item.find_first_not_of(" \t");
+        if (begin == std::string::npos) continue;
+        items.emplace_back(item.substr(begin, item.find_last_not_of(" \t") + 1 - begin));
+    }
+    return items;
+}
+
+bool UtilInstrumentationFilter::Init(const std::string &hashes, const std::string &name_pattern, const std::string &stages) {
+    for (const auto &hash : SplitSetting(hashes)) {
+        hashes_.insert(std::strtoull(hash.c_str(), nullptr, 16));
+    }
+    const auto stage_names = SplitSetting(stages);
+    if (!stage_names.empty()) {
+        stages_ = 0;
+        for (const auto &stage_name : stage_names) {
+            for (uint32_t bit = 0; bit < 32; ++bit) {
+                const auto stage = static_cast<VkShaderStageFlagBits>(1u << bit);
+                if (stage_name == string_VkShaderStageFlagBits(stage)) stages_ |= stage;
+            }
+        }
+    }
+    if (name_pattern.empty()) return true;
+    try {
+        name_pattern_ = std::regex(name_pattern);
+        has_name_pattern_ = true;
+    } catch (const std::regex_error &) {
+        return false;
+    }
+    return true;
+}
+
+bool UtilInstrumentationFilter::MatchesModule(const SHADER_MODULE_STATE &module_state, const debug_report_data *report_data) const {
+    if (!hashes_.empty() && !hashes_.count(UtilShaderModuleHash(module_state.words))) return false;
+    if (has_name_pattern_) {
+        std::string name;
+        {
+            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+            name = report_data->DebugReportGetUtilsObjectName(HandleToUint64(module_state.vk_shader_module()));
+        }
+        if (!std::regex_search(name, name_pattern_)) return false;
+    }
+    return true;
+}
+
+UtilInstrumentedShaderCache::Key UtilInstrumentedShaderCache::MakeKey(const VkShaderModuleCreateInfo *pCreateInfo,
+                                                                     const std::vector<uint32_t> &options) {
+    // Seeded as ValidationCache::MakeShaderHash() is
+    static const uint64_t kCheckSeed = 0x9E3779B97F4A7C15ULL;
+    Key key;
+    key.hash = XXH64(pCreateInfo->pCode, pCreateInfo->codeSize, 0);
+    key.check = XXH64(pCreateInfo->pCode, pCreateInfo->codeSize, kCheckSeed);
+    key.options = XXH64(options.data(), options.size() * sizeof(uint32_t), 0);
+    key.code_size = static_cast<uint32_t>(pCreateInfo->codeSize);
+    return key;
+}
+
+// Calls op with each 32 bit OpConstant value word
+template <typename Words, typename Op>
+static void ForEachConstantWord(Words *words, size_t word_count, Op &&op) {
+    for (size_t i = 5; i < word_count;) {
+        const uint32_t instruction_words = words[i] >> 16;
+        if (instruction_words == 0 || i + instruction_words > word_count) return;
+        if ((words[i] & 0xFFFF) == spv::OpConstant && instruction_words == 4) op(words[i + 3]);
+        i += instruction_words;
+    }
+}
+
+bool UtilInstrumentedShaderCache::CanCache(const VkShaderModuleCreateInfo *pCreateInfo) {
+    bool found = false;
+    const uint32_t placeholder = kShaderIdPlaceholder;
+    ForEachConstantWord(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t),
+                        [&found, placeholder](const uint32_t &value) { found |= (value == placeholder); });
+    return !found;
+}
+
+void UtilInstrumentedShaderCache::SetShaderId(std::vector<uint32_t> &pgm, uint32_t shader_id) {
+    const uint32_t placeholder = kShaderIdPlaceholder;
+    ForEachConstantWord(pgm.data(), pgm.size(), [shader_id, placeholder](uint32_t &value) {
+        if (value == placeholder) value = shader_id;
+    });
+}
+
+// The file is made of uint32_t words: kMagic, kVersion, the length of the spirv-tools commit id followed by the id itself in
+// as many words as it takes, then the entry count and the entries. Each entry is its Key (the 64 bit values low word first),
+// the word count of the instrumented code and the code.
+static std::vector<uint32_t> CacheFileHeader(uint32_t magic, uint32_t version) {
+    const std::string commit_id = SPIRV_TOOLS_COMMIT_ID;
+    std::vector<uint32_t> header{magic, version, static_cast<uint32_t>(commit_id.size())};
+    header.resize(header.size() + (commit_id.size() + 3) / 4, 0);
+    memcpy(&header[3], commit_id.data(), commit_id.size());
+    return header;
+}
+
+void UtilInstrumentedShaderCache::Load(const std::string &path) {
+    std::lock_guard<std::mutex> guard(lock_);
+    path_ = path;
+    std::ifstream read_file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!read_file) return;
+    std::vector<char> bytes;
+    std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(bytes));
+    std::vector<uint32_t> data(bytes.size() / sizeof(uint32_t));
+    if (!data.empty()) memcpy(data.data(), bytes.data(), data.size() * sizeof(uint32_t));
+
+    const auto header = CacheFileHeader(kMagic, kVersion);
+    if (data.size() < header.size() + 1 || !std::equal(header.begin(), header.end(), data.begin())) return;
+    const uint32_t *in = data.data() + header.size();
+    const uint32_t *end = data.data() + data.size();
+    const uint32_t entry_count = *in++;
+    const size_t kKeyWords = 7;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        if (static_cast<size_t>(end - in) < kKeyWords + 1) return;
+        Key key;
+        key.hash = static_cast<uint64_t>(in[0]) | (static_cast<uint64_t>(in[1]) << 32);
+        key.check = static_cast<uint64_t>(in[2]) | (static_cast<uint64_t>(in[3]) << 32);
+        key.options = static_cast<uint64_t>(in[4]) | (static_cast<uint64_t>(in[5]) << 32);
+        key.code_size = in[6];
+        const uint32_t word_count = in[7];
+        in += kKeyWords + 1;
+        if (static_cast<size_t>(end - in) < word_count) return;
+        entries_[key] = Entry{std::vector<uint32_t>(in, in + word_count), false};
+        in += word_count;
+    }
+}
+
+bool UtilInstrumentedShaderCache::Save() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (path_.empty() || !modified_) return true;
+    std::vector<uint32_t> data = CacheFileHeader(kMagic, kVersion);
+    const size_t count_index = data.size();
+    data.push_back(0);
+    auto write_entry = [&data](const Key &key, const Entry &entry) {
+        const uint32_t key_words[] = {static_cast<uint32_t>(key.hash),    static_cast<uint32_t>(key.hash >> 32),
+                                      static_cast<uint32_t>(key.check),   static_cast<uint32_t>(key.check >> 32),
+                                      static_cast<uint32_t>(key.options), static_cast<uint32_t>(key.options >> 32),
+                                      key.code_size,                      static_cast<uint32_t>(entry.pgm.size())};
+        data.insert(data.end(), std::begin(key_words), std::end(key_words));
+        data.insert(data.end(), entry.pgm.begin(), entry.pgm.end());
+        data[count_index]++;
+    };
+    for (const auto &entry : entries_) {
+        if (entry.second.used) write_entry(entry.first, entry.second);
+    }
+    for (const auto &entry : entries_) {
+        if (entry.second.used) continue;
+        if ((data.size() + entry.second.pgm.size()) * sizeof(uint32_t) > kMaxFileBytes) continue;
+        write_entry(entry.first, entry.second);
+    }
+    FILE *write_file = fopen(path_.c_str(), "wb");
+    if (!write_file) return false;
+    const bool written = fwrite(data.data(), sizeof(uint32_t), data.size(), write_file) == data.size();
+    fclose(write_file);
+    modified_ = false;
+    return written;
+}
+
+bool UtilInstrumentedShaderCache::Find(const Key &key, std::vector<uint32_t> &pgm) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    if (!it->second.used) {
+        it->second.used = true;
+        // Keeps the entry ahead of the ones this run didn't use when the file is written
+        modified_ = true;
+    }
+    pgm = it->second.pgm;
+    return true;
+}
+
+void UtilInstrumentedShaderCache::Insert(const Key &key, const std::vector<uint32_t> &pgm) {
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_[key] = Entry{pgm, true};
+    modified_ = true;
+}
+
 // Trampolines to make VMA call Dispatch for Vulkan calls
 static VKAPI_ATTR void VKAPI_CALL gpuVkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                                    VkPhysicalDeviceProperties *pProperties) {
@@ -357,8 +561,8 @@ std::string LookupDebugUtilsName(const debug_report_data *report_data, const uin
 // Generate message from the common portion of the debug report record.
 void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCommandBuffer commandBuffer,
                                const uint32_t *debug_record, const VkShaderModule shader_module_handle,
-                               const VkPipeline pipeline_handle, const VkPipelineBindPoint pipeline_bind_point,
-                               const uint32_t operation_index, std::string &msg) {
+                               const UtilShaderSourceIndex *source_index, const VkPipeline pipeline_handle,
+                               const VkPipelineBindPoint pipeline_bind_point, const uint32_t operation_index, std::string &msg) {
     using namespace spvtools;
     std::ostringstream strm;
     if (shader_module_handle == VK_NULL_HANDLE) {
@@ -382,36 +586,15 @@ void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCom
              << "Pipeline " << LookupDebugUtilsName(report_data, HandleToUint64(pipeline_handle)) << "("
              << HandleToUint64(pipeline_handle) << "). "
              << "Shader Module " << LookupDebugUtilsName(report_data, HandleToUint64(shader_module_handle)) << "("
-             << HandleToUint64(shader_module_handle) << "). ";
+             << HandleToUint64(shader_module_handle) << ")";
+        if (source_index) strm << " hash " << source_index->Hash();
+        strm << ". ";
     }
     strm << std::dec << std::noshowbase;
     strm << "Shader Instruction Index = " << debug_record[kInstCommonOutInstructionIdx] << ". ";
     msg = strm.str();
 }
 
-// Read the contents of the SPIR-V OpSource instruction and any following continuation instructions.
-// Split the single string into a vector of strings, one for each line, for easier processing.
-void ReadOpSource(const SHADER_MODULE_STATE &module_state, const uint32_t reported_file_id,
-                  std::vector<std::string> &opsource_lines) {
-    for (auto insn : module_state) {
-        if ((insn.opcode() == spv::OpSource) && (insn.len() >= 5) && (insn.word(3) == reported_file_id)) {
-            std::istringstream in_stream;
-            std::string cur_line;
-            in_stream.str((char *)&insn.word(4));
-            while (std::getline(in_stream, cur_line)) {
-                opsource_lines.push_back(cur_line);
-            }
-            while ((++insn).opcode() == spv::OpSourceContinued) {
-                in_stream.str((char *)&insn.word(1));
-                while (std::getline(in_stream, cur_line)) {
-                    opsource_lines.push_back(cur_line);
-                }
-            }
-            break;
-        }
-    }
-}
-
 // The task here is to search the OpSource content to find the #line directive with the
 // line number that is closest to, but still prior to the reported error line number and
 // still within the reported filename.
@@ -487,32 +670,92 @@ bool GetLineAndFilename(const std::string string, uint32_t *linenumber, std::str
 }
 #endif  // GCC_VERSION
 
+uint64_t UtilShaderSourceIndex::Hash() const {
+    std::call_once(built_, &UtilShaderSourceIndex::Build, this);
+    return hash_;
+}
+
+const UtilShaderSourceIndex::Location *UtilShaderSourceIndex::FindLocation(uint32_t instruction_index) const {
+    std::call_once(built_, &UtilShaderSourceIndex::Build, this);
+    auto it = std::upper_bound(locations_.begin(), locations_.end(), instruction_index,
+                               [](uint32_t index, const Location &location) { return index < location.instruction_index; });
+    return (it == locations_.begin()) ? nullptr : &*(it - 1);
+}
+
+const std::string *UtilShaderSourceIndex::FindString(uint32_t id) const {
+    std::call_once(built_, &UtilShaderSourceIndex::Build, this);
+    auto it = strings_.find(id);
+    return (it == strings_.end()) ? nullptr : &it->second;
+}
+
+const UtilShaderSourceIndex::Source *UtilShaderSourceIndex::FindSource(uint32_t file_id) const {
+    std::call_once(built_, &UtilShaderSourceIndex::Build, this);
+    auto it = sources_.find(file_id);
+    return (it == sources_.end()) ? nullptr : &it->second;
+}
+
+// Split the text of OpSource instructions and their OpSourceContinued continuations into lines, for each file, and find the
+// #line directives in them.
+void UtilShaderSourceIndex::Build() const {
+    const auto &words = *pgm_;
+    hash_ = UtilShaderModuleHash(words);
+    if (words.size() < 5) return;
+    Source *source = nullptr;
+    uint32_t instruction_index = 0;
+    for (size_t offset = 5; offset < words.size(); ++instruction_index) {
+        const uint32_t length = words[offset] >> 16;
+        const uint32_t opcode = words[offset] & 0xFFFF;
+        if (length == 0 || offset + length > words.size()) break;
+        const uint32_t *insn = &words[offset];
+        const char *text = nullptr;
+        if (opcode == spv::OpLine && length >= 4) {
+            locations_.push_back({instruction_index, insn[1], insn[2], insn[3]});
+        } else if (opcode == spv::OpString && length >= 3) {
+            strings_.emplace(insn[1], reinterpret_cast<const char *>(&insn[2]));
+        } else if (opcode == spv::OpSource && length >= 5) {
+            source = &sources_[insn[3]];
+            text = reinterpret_cast<const char *>(&insn[4]);
+        } else if (opcode == spv::OpSourceContinued && source && length >= 2) {
+            text = reinterpret_cast<const char *>(&insn[1]);
+        } else if (opcode != spv::OpSourceContinued) {
+            source = nullptr;
+        }
+        if (text) {
+            std::istringstream in_stream(text);
+            std::string cur_line;
+            while (std::getline(in_stream, cur_line)) {
+                source->lines.push_back(cur_line);
+            }
+        }
+        offset += length;
+    }
+    for (auto &entry : sources_) {
+        auto &lines = entry.second.lines;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            LineDirective directive = {i, 0, std::string()};
+            if (GetLineAndFilename(lines[i], &directive.line, directive.filename)) {
+                entry.second.line_directives.emplace_back(std::move(directive));
+            }
+        }
+    }
+}
+
 // Extract the filename, line number, and column number from the correct OpLine and build a message string from it.
-// Scan the source (from OpSource) to find the line of source at the reported line number and place it in another message string.
-void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t *debug_record, bool from_printf,
+// Find the line of source (from OpSource) at the reported line number and place it in another message string.
+void UtilGenerateSourceMessages(const UtilShaderSourceIndex *source_index, const uint32_t *debug_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg) {
-    using namespace spvtools;
     std::ostringstream filename_stream;
     std::ostringstream source_stream;
-    SHADER_MODULE_STATE shader(pgm);
     // Find the OpLine just before the failing instruction indicated by the debug info.
-    // SPIR-V can only be iterated in the forward direction due to its opcode/length encoding.
-    uint32_t instruction_index = 0;
     uint32_t reported_file_id = 0;
     uint32_t reported_line_number = 0;
     uint32_t reported_column_number = 0;
-    if (shader.words.size() > 0) {
-        for (const auto &insn : shader) {
-            if (insn.opcode() == spv::OpLine) {
-                reported_file_id = insn.word(1);
-                reported_line_number = insn.word(2);
-                reported_column_number = insn.word(3);
-            }
-            if (instruction_index == debug_record[kInstCommonOutInstructionIdx]) {
-                break;
-            }
-            instruction_index++;
-        }
+    const UtilShaderSourceIndex::Location *location =
+        source_index ? source_index->FindLocation(debug_record[kInstCommonOutInstructionIdx]) : nullptr;
+    if (location) {
+        reported_file_id = location->file_id;
+        reported_line_number = location->line;
+        reported_column_number = location->column;
     }
     // Create message with file information obtained from the OpString pointed to by the discovered OpLine.
     std::string reported_filename;
@@ -520,30 +763,25 @@ void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t
         filename_stream
             << "Unable to find SPIR-V OpLine for source information.  Build shader with debug info to get source information.";
     } else {
-        bool found_opstring = false;
         std::string prefix;
         if (from_printf) {
             prefix = "Debug shader printf message generated ";
         } else {
             prefix = "Shader validation error occurred ";
         }
-        for (const auto &insn : shader) {
-            if ((insn.opcode() == spv::OpString) && (insn.len() >= 3) && (insn.word(1) == reported_file_id)) {
-                found_opstring = true;
-                reported_filename = (char *)&insn.word(2);
-                if (reported_filename.empty()) {
-                    filename_stream << prefix << "at line " << reported_line_number;
-                } else {
-                    filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
-                }
-                if (reported_column_number > 0) {
-                    filename_stream << ", column " << reported_column_number;
-                }
-                filename_stream << ".";
-                break;
+        const std::string *opstring = source_index->FindString(reported_file_id);
+        if (opstring) {
+            reported_filename = *opstring;
+            if (reported_filename.empty()) {
+                filename_stream << prefix << "at line " << reported_line_number;
+            } else {
+                filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
             }
-        }
-        if (!found_opstring) {
+            if (reported_column_number > 0) {
+                filename_stream << ", column " << reported_column_number;
+            }
+            filename_stream << ".";
+        } else {
             filename_stream << "Unable to find SPIR-V OpString for file id " << reported_file_id << " from OpLine instruction."
                             << std::endl;
             filename_stream << "File ID = " << reported_file_id << ", Line Number = " << reported_line_number
@@ -554,32 +792,21 @@ void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t
 
     // Create message to display source code line containing error.
     if ((reported_file_id != 0)) {
-        // Read the source code and split it up into separate lines.
-        std::vector<std::string> opsource_lines;
-        ReadOpSource(shader, reported_file_id, opsource_lines);
         // Find the line in the OpSource content that corresponds to the reported error file and line.
-        if (!opsource_lines.empty()) {
+        const UtilShaderSourceIndex::Source *source = source_index->FindSource(reported_file_id);
+        if (source && !source->lines.empty()) {
             uint32_t saved_line_number = 0;
-            std::string current_filename = reported_filename;  // current "preprocessor" filename state.
-            std::vector<std::string>::size_type saved_opsource_offset = 0;
+            size_t saved_opsource_offset = 0;
             bool found_best_line = false;
-            for (auto it = opsource_lines.begin(); it != opsource_lines.end(); ++it) {
-                uint32_t parsed_line_number;
-                std::string parsed_filename;
-                bool found_line = GetLineAndFilename(*it, &parsed_line_number, parsed_filename);
-                if (!found_line) continue;
-
-                bool found_filename = parsed_filename.size() > 0;
-                if (found_filename) {
-                    current_filename = parsed_filename;
-                }
-                if ((!found_filename) || (current_filename == reported_filename)) {
+            for (const auto &directive : source->line_directives) {
+                // A directive without a filename is in the current file
+                if (directive.filename.empty() || (directive.filename == reported_filename)) {
                     // Update the candidate best line directive, if the current one is prior and closer to the reported line
-                    if (reported_line_number >= parsed_line_number) {
+                    if (reported_line_number >= directive.line) {
                         if (!found_best_line ||
-                            (reported_line_number - parsed_line_number <= reported_line_number - saved_line_number)) {
-                            saved_line_number = parsed_line_number;
-                            saved_opsource_offset = std::distance(opsource_lines.begin(), it);
+                            (reported_line_number - directive.line <= reported_line_number - saved_line_number)) {
+                            saved_line_number = directive.line;
+                            saved_opsource_offset = directive.source_line_index;
                             found_best_line = true;
                         }
                     }
@@ -587,13 +814,12 @@ void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t
             }
             if (found_best_line) {
                 assert(reported_line_number >= saved_line_number);
-                std::vector<std::string>::size_type opsource_index =
-                    (reported_line_number - saved_line_number) + 1 + saved_opsource_offset;
-                if (opsource_index < opsource_lines.size()) {
-                    source_stream << "\n" << reported_line_number << ": " << opsource_lines[opsource_index].c_str();
+                const size_t opsource_index = (reported_line_number - saved_line_number) + 1 + saved_opsource_offset;
+                if (opsource_index < source->lines.size()) {
+                    source_stream << "\n" << reported_line_number << ": " << source->lines[opsource_index].c_str();
                 } else {
                     source_stream << "Internal error: calculated source line of " << opsource_index << " for source size of "
-                                  << opsource_lines.size() << " lines.";
+                                  << source->lines.size() << " lines.";
                 }
             } else {
                 source_stream << "Unable to find suitable #line directive in SPIR-V OpSource.";
@@ -17,7 +17,12 @@
  * Author: Tony Barbour <tony@lunarg.com>
  */
 #pragma once
+#include <deque>
+#include <mutex>
+#include <regex>
 #include "chassis.h"
+#include "layer_trace.h"
+#include "low_memory_profile.h"
 #include "shader_validation.h"
 #include "cmd_buffer_state.h"
 class QUEUE_STATE;
@@ -46,6 +51,178 @@ struct UtilQueueBarrierCommandInfo {
     VkCommandPool barrier_command_pool = VK_NULL_HANDLE;
     VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
 };
+// Asynchronous readback of the instrumentation output: instead of waiting for the queue to go idle after each submission, the
+// barrier making the output available to the host signals a fence, and the output is read once the fence is found signaled
+// at a later submit, wait or present. Output that hasn't been read yet is read before its command buffer is reset or
+// submitted again, waiting for the fence if need be.
+struct UtilPendingReadback {
+    VkQueue queue;
+    VkFence fence;
+    // The primary command buffers submitted, their secondaries are read through linkedCommandBuffers
+    std::vector<std::shared_ptr<CMD_BUFFER_STATE>> command_buffers;
+    // From LayerTraceNow(), when the readback was queued
+    int64_t queued_ns = 0;
+    bool Contains(const CMD_BUFFER_STATE *cb_state) const;
+};
+struct UtilAsyncReadbackState {
+    bool enabled = false;
+    std::mutex lock;
+    std::deque<UtilPendingReadback> pending;
+    std::vector<VkFence> free_fences;
+    // From queueing to reading the output, counted with khronos_validation.validation_counters
+    ValidationCounter readbacks;
+    ValidationCounter readback_latency_us;
+    ValidationCounter readback_max_latency_us;
+};
+// Appends the readback counters of the validation object named object_name
+void UtilAddReadbackCounters(const UtilAsyncReadbackState &async_readback, const char *object_name,
+                             ValidationCounterList &counters);
+// Wait for and read the output of the pending readbacks of cb_state, or of all of them if cb_state is null
+template <typename ObjectType>
+void UtilWaitForReadbacks(ObjectType *object_ptr, const CMD_BUFFER_STATE *cb_state = nullptr);
+
+// Instrumented SPIR-V kept on disk across runs, so that warm runs skip instrumenting the modules they have seen before.
+//
+// Modules are found by a hash of their code and of the options the instrumentation depends on, and the whole file is ignored
+// if it was written with another spirv-tools commit. Entries are instrumented with kShaderIdPlaceholder as the shader id,
+// which SetShaderId() replaces by the id of the module being created.
+class UtilInstrumentedShaderCache {
+  public:
+    struct Key {
+        uint64_t hash;
+        uint64_t check;
+        uint64_t options;
+        uint32_t code_size;
+
+        bool operator==(const Key &other) const {
+            return hash == other.hash && check == other.check && options == other.options && code_size == other.code_size;
+        }
+        struct Hasher {
+            size_t operator()(const Key &key) const { return static_cast<size_t>(key.hash ^ key.options); }
+        };
+    };
+    static const uint32_t kShaderIdPlaceholder = 0x5AFEC0DE;
+
+    static Key MakeKey(const VkShaderModuleCreateInfo *pCreateInfo, const std::vector<uint32_t> &options);
+    // False if the module has a 32 bit constant of the placeholder's value, since its shader id couldn't be told apart
+    static bool CanCache(const VkShaderModuleCreateInfo *pCreateInfo);
+    static void SetShaderId(std::vector<uint32_t> &pgm, uint32_t shader_id);
+
+    bool Enabled() const { return !path_.empty(); }
+    void Load(const std::string &path);
+    // Writes the cache back if anything was added, returns false if the file couldn't be written
+    bool Save();
+    const std::string &Path() const { return path_; }
+
+    bool Find(const Key &key, std::vector<uint32_t> &pgm);
+    void Insert(const Key &key, const std::vector<uint32_t> &pgm);
+
+  private:
+    struct Entry {
+        std::vector<uint32_t> pgm;
+        bool used;
+    };
+    static const uint32_t kMagic = 0x43495656;  // "VVIC"
+    static const uint32_t kVersion = 1;
+    // Entries used by this run are written first, the others only while the file stays below this size
+    static const size_t kMaxFileBytes = 256 * 1024 * 1024;
+
+    std::mutex lock_;
+    std::string path_;
+    layer_data::unordered_map<Key, Entry, Key::Hasher> entries_;
+    bool modified_ = false;
+};
+// Shader modules are instrumented when a pipeline first uses them rather than when the application creates them, as many are
+// never used in a pipeline. The driver gets the application's code for the application's module, and pipelines get a module
+// created from the instrumented code, which lives until the application's module is destroyed.
+struct UtilInstrumentedModules {
+    std::mutex lock;
+    // VK_NULL_HANDLE for modules that couldn't be instrumented
+    layer_data::unordered_map<VkShaderModule, VkShaderModule> modules;
+};
+// Which shaders get instrumented. A shader must pass every filter that is set: its module's hash is listed, the debug utils
+// name of its module matches the pattern, and its stage is selected. Module filters are applied the first time a pipeline uses
+// the module, so names must be given before that.
+class UtilInstrumentationFilter {
+  public:
+    // Sets the filters from the layer settings, hashes is a comma separated list of hexadecimal module hashes (see
+    // UtilShaderModuleHash()) and stages a comma separated list of VkShaderStageFlagBits names. Returns false, instrumenting
+    // everything, if the name pattern is not a valid regular expression.
+    bool Init(const std::string &hashes, const std::string &name_pattern, const std::string &stages);
+    bool MatchesModule(const SHADER_MODULE_STATE &module_state, const debug_report_data *report_data) const;
+    bool MatchesStage(VkShaderStageFlagBits stage) const { return (stages_ & stage) != 0; }
+
+  private:
+    layer_data::unordered_set<uint64_t> hashes_;
+    bool has_name_pattern_ = false;
+    std::regex name_pattern_;
+    VkShaderStageFlags stages_ = VK_SHADER_STAGE_ALL;
+};
+// The hash identifying a shader module in GPU-AV messages and to UtilInstrumentationFilter
+uint64_t UtilShaderModuleHash(const std::vector<uint32_t> &words);
+
+// What GPU-AV and debug printf messages look up in the SPIR-V of the shader they come from: the OpLine in effect at an
+// instruction, OpStrings and the OpSource text with its #line directives. The SPIR-V is indexed the first time a message needs
+// it, once per shader module, so that each message is a few table lookups instead of scans of the module.
+class UtilShaderSourceIndex {
+  public:
+    struct Location {
+        uint32_t instruction_index;
+        uint32_t file_id;
+        uint32_t line;
+        uint32_t column;
+    };
+    struct LineDirective {
+        size_t source_line_index;
+        uint32_t line;
+        // Empty if the directive doesn't name a file
+        std::string filename;
+    };
+    struct Source {
+        std::vector<std::string> lines;
+        std::vector<LineDirective> line_directives;
+    };
+
+    explicit UtilShaderSourceIndex(std::shared_ptr<const std::vector<uint32_t>> pgm) : pgm_(std::move(pgm)) {}
+
+    uint64_t Hash() const;
+    // The last OpLine at or before the instruction, null if there is none
+    const Location *FindLocation(uint32_t instruction_index) const;
+    const std::string *FindString(uint32_t id) const;
+    const Source *FindSource(uint32_t file_id) const;
+
+  private:
+    void Build() const;
+
+    std::shared_ptr<const std::vector<uint32_t>> pgm_;
+    mutable std::once_flag built_;
+    mutable uint64_t hash_ = 0;
+    // In instruction order
+    mutable std::vector<Location> locations_;
+    mutable layer_data::unordered_map<uint32_t, std::string> strings_;
+    mutable layer_data::unordered_map<uint32_t, Source> sources_;
+};
+// The source index of the shader a message comes from. Without one kept in the tracker, as with the low memory profile, it is
+// built for the message and dropped after it.
+template <typename ShaderTracker>
+std::shared_ptr<const UtilShaderSourceIndex> UtilMessageSourceIndex(const ShaderTracker &shader_tracker) {
+    if (shader_tracker.source_index || !shader_tracker.pgm) return shader_tracker.source_index;
+    AddLowMemorySaving(kLowMemorySavingSourceIndexes, 1);
+    return std::make_shared<const UtilShaderSourceIndex>(shader_tracker.pgm);
+}
+// The options shared by GPU-AV and debug printf instrumentation, users append their own
+template <typename ObjectType>
+std::vector<uint32_t> UtilInstrumentationOptions(ObjectType *object_ptr, spv_target_env target_env) {
+    // Everything AdjustValidatorOptions() looks at
+    return std::vector<uint32_t>{static_cast<uint32_t>(target_env),
+                                 object_ptr->desc_set_bind_index,
+                                 IsExtEnabled(object_ptr->device_extensions.vk_khr_relaxed_block_layout) ? 1u : 0u,
+                                 object_ptr->enabled_features.core12.uniformBufferStandardLayout,
+                                 object_ptr->enabled_features.core12.scalarBlockLayout,
+                                 object_ptr->enabled_features.workgroup_memory_explicit_layout_features
+                                     .workgroupMemoryExplicitLayoutScalarBlockLayout,
+                                 object_ptr->enabled_features.core13.maintenance4};
+}
 VkResult UtilInitializeVma(VkPhysicalDevice physical_device, VkDevice device, VmaAllocator *pAllocator);
 void UtilPreCallRecordCreateDevice(VkPhysicalDevice gpu, safe_VkDeviceCreateInfo *modified_create_info,
                                    VkPhysicalDeviceFeatures supported_features, VkPhysicalDeviceFeatures desired_features);
@@ -106,6 +283,15 @@ void UtilPostCallRecordCreateDevice(const VkDeviceCreateInfo *pCreateInfo, std::
 }
 template <typename ObjectType>
 void UtilPreCallRecordDestroyDevice(ObjectType *object_ptr) {
+    UtilWaitForReadbacks(object_ptr);
+    for (const auto &entry : object_ptr->instrumented_modules.modules) {
+        if (entry.second != VK_NULL_HANDLE) DispatchDestroyShaderModule(object_ptr->device, entry.second, nullptr);
+    }
+    object_ptr->instrumented_modules.modules.clear();
+    for (VkFence fence : object_ptr->async_readback.free_fences) {
+        DispatchDestroyFence(object_ptr->device, fence, nullptr);
+    }
+    object_ptr->async_readback.free_fences.clear();
     for (auto &queue_barrier_command_info_kv : object_ptr->queue_barrier_command_infos) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_kv.second;
 
@@ -127,6 +313,66 @@ void UtilPreCallRecordDestroyDevice(ObjectType *object_ptr) {
     }
 }
 
+template <typename ObjectType>
+void UtilPreCallRecordDestroyShaderModule(VkShaderModule shader_module, ObjectType *object_ptr) {
+    VkShaderModule instrumented = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> guard(object_ptr->instrumented_modules.lock);
+        auto it = object_ptr->instrumented_modules.modules.find(shader_module);
+        if (it == object_ptr->instrumented_modules.modules.end()) return;
+        instrumented = it->second;
+        object_ptr->instrumented_modules.modules.erase(it);
+    }
+    if (instrumented != VK_NULL_HANDLE) DispatchDestroyShaderModule(object_ptr->device, instrumented, nullptr);
+}
+
+// Instrument the modules that haven't been yet, in parallel when the pipelines of a call are (see RunPipelineBatch())
+template <typename ObjectType>
+void UtilInstrumentShaderModules(const std::vector<std::shared_ptr<const SHADER_MODULE_STATE>> &module_states,
+                                 ObjectType *object_ptr) {
+    std::vector<std::shared_ptr<const SHADER_MODULE_STATE>> pending;
+    {
+        std::lock_guard<std::mutex> guard(object_ptr->instrumented_modules.lock);
+        for (const auto &module_state : module_states) {
+            if (!object_ptr->instrumented_modules.modules.count(module_state->vk_shader_module())) {
+                pending.push_back(module_state);
+            }
+        }
+    }
+    if (pending.empty()) return;
+
+    std::vector<VkShaderModule> instrumented(pending.size(), VK_NULL_HANDLE);
+    object_ptr->RunPipelineBatch(static_cast<uint32_t>(pending.size()), [&](uint32_t index) -> bool {
+        const auto &module_state = pending[index];
+        if (!module_state->has_valid_spirv) return false;
+        // Filtered out modules are recorded as not instrumented
+        if (!object_ptr->instrumentation_filter.MatchesModule(*module_state, object_ptr->report_data)) return false;
+        auto create_info = LvlInitStruct<VkShaderModuleCreateInfo>();
+        create_info.pCode = module_state->words.data();
+        create_info.codeSize = module_state->words.size() * sizeof(uint32_t);
+        std::vector<uint32_t> instrumented_pgm;
+        if (!object_ptr->InstrumentShader(&create_info, instrumented_pgm, module_state->gpu_validation_shader_id)) return false;
+        create_info.pCode = instrumented_pgm.data();
+        create_info.codeSize = instrumented_pgm.size() * sizeof(uint32_t);
+        if (DispatchCreateShaderModule(object_ptr->device, &create_info, nullptr, &instrumented[index]) != VK_SUCCESS) {
+            instrumented[index] = VK_NULL_HANDLE;
+            object_ptr->ReportSetupProblem(object_ptr->device,
+                                           "Unable to create instrumented shader module.  "
+                                           "Proceeding with non-instrumented shader.");
+        }
+        return false;
+    });
+
+    std::lock_guard<std::mutex> guard(object_ptr->instrumented_modules.lock);
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const auto inserted = object_ptr->instrumented_modules.modules.emplace(pending[i]->vk_shader_module(), instrumented[i]);
+        // Another thread's pipelines instrumented the same module meanwhile
+        if (!inserted.second && instrumented[i] != VK_NULL_HANDLE) {
+            DispatchDestroyShaderModule(object_ptr->device, instrumented[i], nullptr);
+        }
+    }
+}
+
 template <typename ObjectType>
 void UtilPreCallRecordCreatePipelineLayout(create_pipeline_layout_api_state *cpl_state, ObjectType *object_ptr,
                                            const VkPipelineLayoutCreateInfo *pCreateInfo) {
@@ -154,6 +400,9 @@ struct CreatePipelineTraits<VkGraphicsPipelineCreateInfo> {
         return pipeline_state->GetUnifiedCreateInfo().graphics;
     }
     static uint32_t GetStageCount(const VkGraphicsPipelineCreateInfo &createInfo) { return createInfo.stageCount; }
+    static VkShaderStageFlagBits GetShaderStage(const VkGraphicsPipelineCreateInfo &createInfo, uint32_t stage) {
+        return createInfo.pStages[stage].stage;
+    }
     static VkShaderModule GetShaderModule(const VkGraphicsPipelineCreateInfo &createInfo, uint32_t stage) {
         return createInfo.pStages[stage].module;
     }
@@ -169,6 +418,9 @@ struct CreatePipelineTraits<VkComputePipelineCreateInfo> {
         return pipeline_state->GetUnifiedCreateInfo().compute;
     }
     static uint32_t GetStageCount(const VkComputePipelineCreateInfo &createInfo) { return 1; }
+    static VkShaderStageFlagBits GetShaderStage(const VkComputePipelineCreateInfo &createInfo, uint32_t stage) {
+        return createInfo.stage.stage;
+    }
     static VkShaderModule GetShaderModule(const VkComputePipelineCreateInfo &createInfo, uint32_t stage) {
         return createInfo.stage.module;
     }
@@ -185,6 +437,9 @@ struct CreatePipelineTraits<VkRayTracingPipelineCreateInfoNV> {
         return pipeline_state->GetUnifiedCreateInfo().raytracing;
     }
     static uint32_t GetStageCount(const VkRayTracingPipelineCreateInfoNV &createInfo) { return createInfo.stageCount; }
+    static VkShaderStageFlagBits GetShaderStage(const VkRayTracingPipelineCreateInfoNV &createInfo, uint32_t stage) {
+        return createInfo.pStages[stage].stage;
+    }
     static VkShaderModule GetShaderModule(const VkRayTracingPipelineCreateInfoNV &createInfo, uint32_t stage) {
         return createInfo.pStages[stage].module;
     }
@@ -200,6 +455,9 @@ struct CreatePipelineTraits<VkRayTracingPipelineCreateInfoKHR> {
         return pipeline_state->GetUnifiedCreateInfo().raytracing;
     }
     static uint32_t GetStageCount(const VkRayTracingPipelineCreateInfoKHR &createInfo) { return createInfo.stageCount; }
+    static VkShaderStageFlagBits GetShaderStage(const VkRayTracingPipelineCreateInfoKHR &createInfo, uint32_t stage) {
+        return createInfo.pStages[stage].stage;
+    }
     static VkShaderModule GetShaderModule(const VkRayTracingPipelineCreateInfoKHR &createInfo, uint32_t stage) {
         return createInfo.pStages[stage].module;
     }
@@ -211,62 +469,76 @@ struct CreatePipelineTraits<VkRayTracingPipelineCreateInfoKHR> {
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
+// New create infos are only made once a shader is replaced. Otherwise new_pipeline_create_infos stays empty and
+// *down_chain_create_infos is left pointing at the application's create infos.
 template <typename CreateInfo, typename SafeCreateInfo, typename ObjectType>
 void UtilPreCallRecordPipelineCreations(uint32_t count, const CreateInfo *pCreateInfos, const VkAllocationCallbacks *pAllocator,
                                         VkPipeline *pPipelines, std::vector<std::shared_ptr<PIPELINE_STATE>> &pipe_state,
                                         std::vector<SafeCreateInfo> *new_pipeline_create_infos,
-                                        const VkPipelineBindPoint bind_point, ObjectType *object_ptr) {
+                                        const CreateInfo **down_chain_create_infos, const VkPipelineBindPoint bind_point,
+                                        ObjectType *object_ptr) {
     using Accessor = CreatePipelineTraits<CreateInfo>;
     if (bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS && bind_point != VK_PIPELINE_BIND_POINT_COMPUTE &&
         bind_point != VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
         return;
     }
 
-    // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
-    // descriptor set index.
+    // Walk through all the pipelines and flag each pipeline that contains a shader that uses the debug descriptor set index.
+    std::vector<bool> instrument(count, false);
+    std::vector<std::shared_ptr<const SHADER_MODULE_STATE>> module_states;
+    layer_data::unordered_set<VkShaderModule> seen_modules;
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
         uint32_t stageCount = Accessor::GetStageCount(pCreateInfos[pipeline]);
-        new_pipeline_create_infos->push_back(Accessor::GetPipelineCI(pipe_state[pipeline].get()));
         const auto &pipe = pipe_state[pipeline];
 
+        bool keep_uninstrumented = false;
         if (!pipe->IsGraphicsLibrary()) {
-            bool replace_shaders = false;
             if (pipe->active_slots.find(object_ptr->desc_set_bind_index) != pipe->active_slots.end()) {
-                replace_shaders = true;
+                keep_uninstrumented = true;
             }
             // If the app requests all available sets, the pipeline layout was not modified at pipeline layout creation and the
-            // already instrumented shaders need to be replaced with uninstrumented shaders
+            // shaders are left uninstrumented
             const auto pipeline_layout = pipe->PipelineLayoutState();
             if (pipeline_layout->set_layouts.size() >= object_ptr->adjusted_max_desc_sets) {
-                replace_shaders = true;
+                keep_uninstrumented = true;
             }
+        }
+        if (keep_uninstrumented) continue;
+
+        instrument[pipeline] = true;
+        for (uint32_t stage = 0; stage < stageCount; ++stage) {
+            if (!object_ptr->instrumentation_filter.MatchesStage(Accessor::GetShaderStage(pCreateInfos[pipeline], stage))) continue;
+            const VkShaderModule shader_module = Accessor::GetShaderModule(pCreateInfos[pipeline], stage);
+            if (shader_module == VK_NULL_HANDLE || !seen_modules.insert(shader_module).second) continue;
+            auto module_state = object_ptr->template Get<SHADER_MODULE_STATE>(shader_module);
+            if (module_state) module_states.emplace_back(std::move(module_state));
+        }
+    }
+    UtilInstrumentShaderModules(module_states, object_ptr);
 
-            if (replace_shaders) {
-                for (uint32_t stage = 0; stage < stageCount; ++stage) {
-                    const auto module_state =
-                        object_ptr->template Get<SHADER_MODULE_STATE>(Accessor::GetShaderModule(pCreateInfos[pipeline], stage));
-
-                    VkShaderModule shader_module;
-                    auto create_info = LvlInitStruct<VkShaderModuleCreateInfo>();
-                    create_info.pCode = module_state->words.data();
-                    create_info.codeSize = module_state->words.size() * sizeof(uint32_t);
-                    VkResult result = DispatchCreateShaderModule(object_ptr->device, &create_info, pAllocator, &shader_module);
-                    if (result == VK_SUCCESS) {
-                        Accessor::SetShaderModule(&(*new_pipeline_create_infos)[pipeline], shader_module, stage);
-                    } else {
-                        object_ptr->ReportSetupProblem(object_ptr->device,
-                                                       "Unable to replace instrumented shader with non-instrumented one.  "
-                                                       "Device could become unstable.");
+    std::lock_guard<std::mutex> guard(object_ptr->instrumented_modules.lock);
+    const auto &instrumented_modules = object_ptr->instrumented_modules.modules;
+    for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
+        if (!instrument[pipeline]) continue;
+        const uint32_t stageCount = Accessor::GetStageCount(pCreateInfos[pipeline]);
+        for (uint32_t stage = 0; stage < stageCount; ++stage) {
+            if (!object_ptr->instrumentation_filter.MatchesStage(Accessor::GetShaderStage(pCreateInfos[pipeline], stage))) continue;
+            auto it = instrumented_modules.find(Accessor::GetShaderModule(pCreateInfos[pipeline], stage));
+            if (it != instrumented_modules.end() && it->second != VK_NULL_HANDLE) {
+                if (new_pipeline_create_infos->empty()) {
+                    new_pipeline_create_infos->reserve(count);
+                    for (uint32_t i = 0; i < count; ++i) {
+                        new_pipeline_create_infos->push_back(Accessor::GetPipelineCI(pipe_state[i].get()));
                     }
+                    *down_chain_create_infos = reinterpret_cast<const CreateInfo *>(new_pipeline_create_infos->data());
                 }
+                Accessor::SetShaderModule(&(*new_pipeline_create_infos)[pipeline], it->second, stage);
             }
         }
     }
 }
 // For every pipeline:
 // - For every shader in a pipeline:
-//   - If the shader had to be replaced in PreCallRecord (because the pipeline is using the debug desc set index):
-//     - Destroy it since it has been bound into the pipeline by now.  This is our only chance to delete it.
 //   - Track the shader in the shader_map
 //   - Save the shader binary if it contains debug code
 template <typename CreateInfo, typename ObjectType>
@@ -286,11 +558,6 @@ void UtilPostCallRecordPipelineCreations(const uint32_t count, const CreateInfo
         assert(stageCount > 0);
 
         for (uint32_t stage = 0; stage < stageCount; ++stage) {
-            if (pipeline_state->active_slots.find(object_ptr->desc_set_bind_index) != pipeline_state->active_slots.end()) {
-                DispatchDestroyShaderModule(object_ptr->device, Accessor::GetShaderModule(pCreateInfos[pipeline], stage),
-                                            pAllocator);
-            }
-
             std::shared_ptr<const SHADER_MODULE_STATE> module_state;
             if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 module_state = object_ptr->template Get<SHADER_MODULE_STATE>(
@@ -306,16 +573,15 @@ void UtilPostCallRecordPipelineCreations(const uint32_t count, const CreateInfo
                 assert(false);
             }
 
-            std::vector<unsigned int> code;
+            std::shared_ptr<const std::vector<uint32_t>> code;
             // Save the shader binary
             // The core_validation ShaderModule tracker saves the binary too, but discards it when the ShaderModule
             // is destroyed.  Applications may destroy ShaderModules after they are placed in a pipeline and before
-            // the pipeline is used, so we have to keep another copy.
-            if (module_state && module_state->has_valid_spirv) code = module_state->words;
+            // the pipeline is used, so we have to keep a reference to it.
+            if (module_state && module_state->has_valid_spirv) code = module_state->spirv;
 
             object_ptr->shader_map[module_state->gpu_validation_shader_id].pipeline = pipeline_state->pipeline();
-            // Be careful to use the originally bound (instrumented) shader here, even if PreCallRecord had to back it
-            // out with a non-instrumented shader.  The non-instrumented shader (found in pCreateInfo) was destroyed above.
+            // The application's module, not the instrumented one PreCallRecord put in its place
             VkShaderModule shader_module = VK_NULL_HANDLE;
             if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 shader_module = pipeline_state->GetUnifiedCreateInfo().graphics.pStages[stage].module;
@@ -327,13 +593,23 @@ void UtilPostCallRecordPipelineCreations(const uint32_t count, const CreateInfo
             } else {
                 assert(false);
             }
-            object_ptr->shader_map[module_state->gpu_validation_shader_id].shader_module = shader_module;
-            object_ptr->shader_map[module_state->gpu_validation_shader_id].pgm = std::move(code);
+            auto &shader_tracker = object_ptr->shader_map[module_state->gpu_validation_shader_id];
+            shader_tracker.shader_module = shader_module;
+            // Pipelines sharing a module share its index too, the low memory profile keeps none
+            if (LowMemoryProfile()) {
+                shader_tracker.source_index = nullptr;
+            } else if (!shader_tracker.source_index || shader_tracker.pgm != code) {
+                shader_tracker.source_index = code ? std::make_shared<const UtilShaderSourceIndex>(code) : nullptr;
+            }
+            shader_tracker.pgm = std::move(code);
         }
     }
 }
 template <typename CreateInfos, typename SafeCreateInfos>
-void UtilCopyCreatePipelineFeedbackData(const uint32_t count, CreateInfos *pCreateInfos, SafeCreateInfos *pSafeCreateInfos) {
+void UtilCopyCreatePipelineFeedbackData(const uint32_t count, CreateInfos *pCreateInfos,
+                                        const std::vector<SafeCreateInfos> &pSafeCreateInfos) {
+    // Without copies the driver wrote the feedback to the application's create infos
+    if (pSafeCreateInfos.empty()) return;
     for (uint32_t i = 0; i < count; i++) {
         auto src_feedback_struct = LvlFindInChain<VkPipelineCreationFeedbackCreateInfoEXT>(pSafeCreateInfos[i].pNext);
         if (!src_feedback_struct) return;
@@ -348,14 +624,19 @@ void UtilCopyCreatePipelineFeedbackData(const uint32_t count, CreateInfos *pCrea
 
 template <typename ObjectType>
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
-void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node, ObjectType *object_ptr) {
+void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node, ObjectType *object_ptr,
+                                      const std::vector<uint32_t> *written_blocks = nullptr) {
+    TraceScope trace("InstrumentationReadback", "ProcessInstrumentationBuffer");
     if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) {
-        auto gpu_buffer_list = object_ptr->GetBufferInfo(cb_node);
+        auto &gpu_buffer_list = object_ptr->GetBufferInfo(cb_node);
         uint32_t draw_index = 0;
         uint32_t compute_index = 0;
         uint32_t ray_trace_index = 0;
+        // When the GPU has listed the blocks written to, in order, only those are mapped and read
+        size_t next_written = 0;
 
-        for (auto &buffer_info : gpu_buffer_list) {
+        for (size_t block = 0; block < gpu_buffer_list.size(); ++block) {
+            auto &buffer_info = gpu_buffer_list[block];
             char *pData;
 
             uint32_t operation_index = 0;
@@ -369,10 +650,16 @@ void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node,
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
-            if (result == VK_SUCCESS) {
-                object_ptr->AnalyzeAndGenerateMessages(cb_node->commandBuffer(), queue, buffer_info,
-                                                       operation_index, (uint32_t *)pData);
+            bool read = true;
+            if (written_blocks) {
+                read = next_written < written_blocks->size() && (*written_blocks)[next_written] == block;
+                if (read) ++next_written;
+            }
+
+            if (read &&
+                vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData) == VK_SUCCESS) {
+                object_ptr->AnalyzeAndGenerateMessages(cb_node->commandBuffer(), queue, buffer_info, operation_index,
+                                                       (uint32_t *)(pData + buffer_info.output_mem_block.offset));
                 vmaUnmapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation);
             }
 
@@ -389,9 +676,9 @@ void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node,
     }
 }
 template <typename ObjectType>
-// Submit a memory barrier on graphics queues.
+// Submit a memory barrier on graphics queues, signaling fence once it has executed.
 // Lazy-create and record the needed command buffer.
-void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
+VkResult UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr, VkFence fence = VK_NULL_HANDLE) {
     auto queue_barrier_command_info_it = object_ptr->queue_barrier_command_infos.emplace(queue, UtilQueueBarrierCommandInfo{});
     if (queue_barrier_command_info_it.second) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_it.first->second;
@@ -412,7 +699,7 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
         if (result != VK_SUCCESS) {
             object_ptr->ReportSetupProblem(object_ptr->device, "Unable to create command pool for barrier CB.");
             queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
-            return;
+            return result;
         }
 
         auto buffer_alloc_info = LvlInitStruct<VkCommandBufferAllocateInfo>();
@@ -426,14 +713,16 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
             DispatchDestroyCommandPool(object_ptr->device, queue_barrier_command_info.barrier_command_pool, nullptr);
             queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
             queue_barrier_command_info.barrier_command_buffer = VK_NULL_HANDLE;
-            return;
+            return result;
         }
 
         // Hook up command buffer dispatch
         object_ptr->vkSetDeviceLoaderData(object_ptr->device, queue_barrier_command_info.barrier_command_buffer);
 
         // Record a global memory barrier to force availability of device memory operations to the host domain.
+        // With asynchronous readback it can be submitted again before an earlier submission has completed.
         auto command_buffer_begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+        command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         result = DispatchBeginCommandBuffer(queue_barrier_command_info.barrier_command_buffer, &command_buffer_begin_info);
         if (result == VK_SUCCESS) {
             auto memory_barrier = LvlInitStruct<VkMemoryBarrier>();
@@ -451,13 +740,104 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
         auto submit_info = LvlInitStruct<VkSubmitInfo>();
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &queue_barrier_command_info.barrier_command_buffer;
-        DispatchQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+        return DispatchQueueSubmit(queue, 1, &submit_info, fence);
+    }
+    return VK_ERROR_INITIALIZATION_FAILED;
+}
+
+// Read the output of a readback whose fence has signaled, and keep the fence for reuse. Called with the readback lock held.
+template <typename ObjectType>
+void UtilFinishReadback(UtilPendingReadback &readback, ObjectType *object_ptr) {
+    for (const auto &cb_state : readback.command_buffers) {
+        object_ptr->ProcessCommandBuffer(readback.queue, cb_state.get());
+    }
+    const uint64_t latency_us = static_cast<uint64_t>(std::max<int64_t>(LayerTraceNow() - readback.queued_ns, 0)) / 1000;
+    object_ptr->async_readback.readbacks.Add();
+    object_ptr->async_readback.readback_latency_us.Add(latency_us);
+    object_ptr->async_readback.readback_max_latency_us.Max(latency_us);
+    if (DispatchResetFences(object_ptr->device, 1, &readback.fence) == VK_SUCCESS) {
+        object_ptr->async_readback.free_fences.push_back(readback.fence);
+    } else {
+        DispatchDestroyFence(object_ptr->device, readback.fence, nullptr);
+    }
+}
+
+// Read the output of every pending readback whose fence has signaled
+template <typename ObjectType>
+void UtilProcessCompletedReadbacks(ObjectType *object_ptr) {
+    auto &async_readback = object_ptr->async_readback;
+    if (!async_readback.enabled) return;
+    std::lock_guard<std::mutex> guard(async_readback.lock);
+    for (auto it = async_readback.pending.begin(); it != async_readback.pending.end();) {
+        if (DispatchGetFenceStatus(object_ptr->device, it->fence) == VK_SUCCESS) {
+            UtilFinishReadback(*it, object_ptr);
+            it = async_readback.pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+template <typename ObjectType>
+void UtilWaitForReadbacks(ObjectType *object_ptr, const CMD_BUFFER_STATE *cb_state) {
+    auto &async_readback = object_ptr->async_readback;
+    if (!async_readback.enabled) return;
+    std::lock_guard<std::mutex> guard(async_readback.lock);
+    for (auto it = async_readback.pending.begin(); it != async_readback.pending.end();) {
+        if (!cb_state || it->Contains(cb_state)) {
+            // If the wait fails the device is lost, and the output will never be written
+            if (DispatchWaitForFences(object_ptr->device, 1, &it->fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS) {
+                UtilFinishReadback(*it, object_ptr);
+            } else {
+                DispatchDestroyFence(object_ptr->device, it->fence, nullptr);
+            }
+            it = async_readback.pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Make the output of the command buffers just submitted to queue available to the host, and read it once it is. Reads it
+// right away, as the synchronous path does, if the readback can't be queued.
+template <typename ObjectType>
+void UtilQueueReadback(VkQueue queue, std::vector<std::shared_ptr<CMD_BUFFER_STATE>> &&command_buffers, ObjectType *object_ptr) {
+    auto &async_readback = object_ptr->async_readback;
+    std::unique_lock<std::mutex> guard(async_readback.lock);
+    VkFence fence = VK_NULL_HANDLE;
+    if (!async_readback.free_fences.empty()) {
+        fence = async_readback.free_fences.back();
+        async_readback.free_fences.pop_back();
+    } else {
+        auto fence_ci = LvlInitStruct<VkFenceCreateInfo>();
+        if (DispatchCreateFence(object_ptr->device, &fence_ci, nullptr, &fence) != VK_SUCCESS) {
+            fence = VK_NULL_HANDLE;
+        }
+    }
+    if (fence != VK_NULL_HANDLE && UtilSubmitBarrier(queue, object_ptr, fence) == VK_SUCCESS) {
+        UtilPendingReadback readback;
+        readback.queue = queue;
+        readback.fence = fence;
+        readback.command_buffers = std::move(command_buffers);
+        readback.queued_ns = LayerTraceNow();
+        async_readback.pending.emplace_back(std::move(readback));
+        return;
+    }
+    if (fence != VK_NULL_HANDLE) {
+        DispatchDestroyFence(object_ptr->device, fence, nullptr);
+    }
+    guard.unlock();
+    object_ptr->ReportSetupProblem(object_ptr->device, "Unable to queue asynchronous readback, waiting for the queue instead.");
+    UtilSubmitBarrier(queue, object_ptr);
+    DispatchQueueWaitIdle(queue);
+    for (const auto &cb_state : command_buffers) {
+        object_ptr->ProcessCommandBuffer(queue, cb_state.get());
     }
 }
 void UtilGenerateStageMessage(const uint32_t *debug_record, std::string &msg);
 void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCommandBuffer commandBuffer,
                                const uint32_t *debug_record, const VkShaderModule shader_module_handle,
-                               const VkPipeline pipeline_handle, const VkPipelineBindPoint pipeline_bind_point,
-                               const uint32_t operation_index, std::string &msg);
-void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t *debug_record, bool from_printf,
+                               const UtilShaderSourceIndex *source_index, const VkPipeline pipeline_handle,
+                               const VkPipelineBindPoint pipeline_bind_point, const uint32_t operation_index, std::string &msg);
+void UtilGenerateSourceMessages(const UtilShaderSourceIndex *source_index, const uint32_t *debug_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg);
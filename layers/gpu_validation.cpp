@@ -18,8 +18,11 @@
  * Author: Tony Barbour <tony@lunarg.com>
  */
 
+#include <cinttypes>
 #include <climits>
 #include <cmath>
+#include <fstream>
+#include <iterator>
 #include "gpu_validation.h"
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
@@ -30,6 +33,7 @@
 #include "buffer_state.h"
 #include "cmd_buffer_state.h"
 #include "render_pass_state.h"
+#include "low_memory_profile.h"
 
 static const VkShaderStageFlags kShaderStageAllRayTracing =
     VK_SHADER_STAGE_ANY_HIT_BIT_NV | VK_SHADER_STAGE_CALLABLE_BIT_NV | VK_SHADER_STAGE_CLOSEST_HIT_BIT_NV |
@@ -184,6 +188,75 @@ static const uint32_t kComputeShaderSpirv[] = {
     0x000200f8, 0x0000000d, 0x0004003d, 0x00000006, 0x0000006b, 0x00000008, 0x00050080, 0x00000006, 0x0000006c, 0x0000006b,
     0x00000024, 0x0003003e, 0x00000008, 0x0000006c, 0x000200f9, 0x0000000a, 0x000200f8, 0x0000000c, 0x000100fd, 0x00010038};
 
+// This is the GLSL source for the compute shader recorded at the end of each instrumented primary command buffer. It gathers
+// the indices of the output blocks the command buffer's shaders wrote to, so that a submission without errors is checked by
+// reading a single counter.
+//
+// #version 450
+// layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+// layout(set=0, binding=0, std430) buffer OutputBlocks {
+//     uint words[];
+// };
+// layout(set=0, binding=1, std430) buffer ErrorSummary {
+//     uint error_count;
+//     uint block_indices[];
+// };
+// layout(push_constant) uniform BlockRange {
+//     uint stride_words;
+//     uint block_count;
+//     uint first_block_index;
+// };
+// void main() {
+//     uint block = gl_GlobalInvocationID.x;
+//     if (block < block_count) {
+//         if (words[block * stride_words] != 0) {
+//             uint slot = atomicAdd(error_count, 1);
+//             if (slot < block_indices.length()) {
+//                 block_indices[slot] = first_block_index + block;
+//             }
+//         }
+//     }
+// }
+//
+// The spirv below is this shader without debug names, regenerate it with glslangValidator as for the shader above.
+static const uint32_t kErrorSummaryGroupSize = 64;
+// Beyond this many blocks written to, a command buffer's blocks are all read
+static const uint32_t kMaxErrorSummaryIndices = 16384;
+static const uint32_t kErrorSummaryShaderSpirv[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000036, 0x00000000, 0x00020011, 0x00000001, 0x0003000e, 0x00000000, 0x00000001,
+    0x0006000f, 0x00000005, 0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00060010, 0x00000001, 0x00000011, 0x00000040,
+    0x00000001, 0x00000001, 0x00040047, 0x00000002, 0x0000000b, 0x0000001c, 0x00040047, 0x00000003, 0x00000006, 0x00000004,
+    0x00050048, 0x00000004, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000004, 0x00000003, 0x00040047, 0x00000005,
+    0x00000022, 0x00000000, 0x00040047, 0x00000005, 0x00000021, 0x00000000, 0x00050048, 0x00000006, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x00000006, 0x00000001, 0x00000023, 0x00000004, 0x00030047, 0x00000006, 0x00000003, 0x00040047,
+    0x00000007, 0x00000022, 0x00000000, 0x00040047, 0x00000007, 0x00000021, 0x00000001, 0x00050048, 0x00000008, 0x00000000,
+    0x00000023, 0x00000000, 0x00050048, 0x00000008, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000008, 0x00000002,
+    0x00000023, 0x00000008, 0x00030047, 0x00000008, 0x00000002, 0x00020013, 0x00000009, 0x00030021, 0x0000000a, 0x00000009,
+    0x00040015, 0x0000000b, 0x00000020, 0x00000000, 0x00040015, 0x0000000c, 0x00000020, 0x00000001, 0x00020014, 0x0000000d,
+    0x00040017, 0x0000000e, 0x0000000b, 0x00000003, 0x00040020, 0x0000000f, 0x00000001, 0x0000000e, 0x0004003b, 0x0000000f,
+    0x00000002, 0x00000001, 0x0003001d, 0x00000003, 0x0000000b, 0x0003001e, 0x00000004, 0x00000003, 0x00040020, 0x00000010,
+    0x00000002, 0x00000004, 0x0004003b, 0x00000010, 0x00000005, 0x00000002, 0x0004001e, 0x00000006, 0x0000000b, 0x00000003,
+    0x00040020, 0x00000011, 0x00000002, 0x00000006, 0x0004003b, 0x00000011, 0x00000007, 0x00000002, 0x0005001e, 0x00000008,
+    0x0000000b, 0x0000000b, 0x0000000b, 0x00040020, 0x00000012, 0x00000009, 0x00000008, 0x0004003b, 0x00000012, 0x00000013,
+    0x00000009, 0x00040020, 0x00000014, 0x00000009, 0x0000000b, 0x00040020, 0x00000015, 0x00000002, 0x0000000b, 0x00040020,
+    0x00000016, 0x00000001, 0x0000000b, 0x0004002b, 0x0000000c, 0x00000017, 0x00000000, 0x0004002b, 0x0000000c, 0x00000018,
+    0x00000001, 0x0004002b, 0x0000000c, 0x00000019, 0x00000002, 0x0004002b, 0x0000000b, 0x0000001a, 0x00000000, 0x0004002b,
+    0x0000000b, 0x0000001b, 0x00000001, 0x00050036, 0x00000009, 0x00000001, 0x00000000, 0x0000000a, 0x000200f8, 0x0000001c,
+    0x00050041, 0x00000016, 0x0000001d, 0x00000002, 0x0000001a, 0x0004003d, 0x0000000b, 0x0000001e, 0x0000001d, 0x00050041,
+    0x00000014, 0x0000001f, 0x00000013, 0x00000018, 0x0004003d, 0x0000000b, 0x00000020, 0x0000001f, 0x000500b0, 0x0000000d,
+    0x00000021, 0x0000001e, 0x00000020, 0x000300f7, 0x00000022, 0x00000000, 0x000400fa, 0x00000021, 0x00000023, 0x00000022,
+    0x000200f8, 0x00000023, 0x00050041, 0x00000014, 0x00000024, 0x00000013, 0x00000017, 0x0004003d, 0x0000000b, 0x00000025,
+    0x00000024, 0x00050084, 0x0000000b, 0x00000026, 0x0000001e, 0x00000025, 0x00060041, 0x00000015, 0x00000027, 0x00000005,
+    0x00000017, 0x00000026, 0x0004003d, 0x0000000b, 0x00000028, 0x00000027, 0x000500ab, 0x0000000d, 0x00000029, 0x00000028,
+    0x0000001a, 0x000300f7, 0x0000002a, 0x00000000, 0x000400fa, 0x00000029, 0x0000002b, 0x0000002a, 0x000200f8, 0x0000002b,
+    0x00050041, 0x00000015, 0x0000002c, 0x00000007, 0x00000017, 0x000700ea, 0x0000000b, 0x0000002d, 0x0000002c, 0x0000001b,
+    0x0000001a, 0x0000001b, 0x00050044, 0x0000000b, 0x0000002e, 0x00000007, 0x00000001, 0x000500b0, 0x0000000d, 0x0000002f,
+    0x0000002d, 0x0000002e, 0x000300f7, 0x00000030, 0x00000000, 0x000400fa, 0x0000002f, 0x00000031, 0x00000030, 0x000200f8,
+    0x00000031, 0x00050041, 0x00000014, 0x00000032, 0x00000013, 0x00000019, 0x0004003d, 0x0000000b, 0x00000033, 0x00000032,
+    0x00050080, 0x0000000b, 0x00000034, 0x00000033, 0x0000001e, 0x00060041, 0x00000015, 0x00000035, 0x00000007, 0x00000018,
+    0x0000002d, 0x0003003e, 0x00000035, 0x00000034, 0x000200f9, 0x00000030, 0x000200f8, 0x00000030, 0x000200f9, 0x0000002a,
+    0x000200f8, 0x0000002a, 0x000200f9, 0x00000022, 0x000200f8, 0x00000022, 0x000100fd, 0x00010038};
+
 // Convenience function for reporting problems with setting up GPU Validation.
 template <typename T>
 void GpuAssisted::ReportSetupProblem(T object, const char *const specific_message) const {
@@ -250,10 +323,46 @@ void GpuAssisted::PreCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
                                   features);
     ValidationStateTracker::PreCallRecordCreateDevice(gpu, create_info, pAllocator, pDevice, modified_create_info);
 }
+
+// Memory for chunks the host reads (output) or writes (input) without flushing. Input goes to device local memory the host can
+// write to directly when the device has a resizable BAR, which saves the GPU reading it across the bus. A 256 MiB or smaller
+// BAR heap is left to the application. Output goes to cached memory, since the host reads it.
+static bool FindChunkMemoryType(VmaAllocator allocator, bool input, uint32_t *memory_type_index) {
+    const VkMemoryPropertyFlags required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    if (input) {
+        const VkPhysicalDeviceMemoryProperties *memory_props = nullptr;
+        vmaGetMemoryProperties(allocator, &memory_props);
+        const VkDeviceSize min_bar_heap_size = 256 * 1024 * 1024;
+        for (uint32_t i = 0; i < memory_props->memoryTypeCount; ++i) {
+            const auto &memory_type = memory_props->memoryTypes[i];
+            const VkMemoryPropertyFlags flags = required | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            if ((memory_type.propertyFlags & flags) == flags &&
+                memory_props->memoryHeaps[memory_type.heapIndex].size > min_bar_heap_size) {
+                *memory_type_index = i;
+                return true;
+            }
+        }
+    }
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = GpuAssistedChunkPool::kChunkSize;
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = required;
+    alloc_info.preferredFlags = input ? 0 : VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    return vmaFindMemoryTypeIndexForBufferInfo(allocator, &buffer_info, &alloc_info, memory_type_index) == VK_SUCCESS;
+}
+
 // Perform initializations that can be done at Create Device time.
+void GpuAssisted::GetValidationCounters(ValidationCounterList &counters) const {
+    ValidationStateTracker::GetValidationCounters(counters);
+    UtilAddReadbackCounters(async_readback, "GpuAssisted", counters);
+}
+
 void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     ValidationStateTracker::CreateDevice(pCreateInfo);
+    housekeeping_.Register("ProcessCompletedReadbacks", [this]() { UtilProcessCompletedReadbacks(this); });
+    housekeeping_.Register("PruneDescriptorInputs", [this]() { PruneDescriptorInputs(); });
 
     if (enabled_features.core.robustBufferAccess || enabled_features.robustness2_features.robustBufferAccess2) {
         buffer_oob_enabled = false;
@@ -270,6 +379,28 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     transform(draw_indirect_string.begin(), draw_indirect_string.end(), draw_indirect_string.begin(), ::tolower);
     validate_draw_indirect = !draw_indirect_string.empty() ? !draw_indirect_string.compare("true") : true;
 
+    std::string batch_draw_indirect_string = getLayerOption("khronos_validation.gpuav_batch_draw_indirect_validation");
+    transform(batch_draw_indirect_string.begin(), batch_draw_indirect_string.end(), batch_draw_indirect_string.begin(), ::tolower);
+    batch_draw_indirect_validation = !batch_draw_indirect_string.empty() ? !batch_draw_indirect_string.compare("true") : false;
+
+    std::string async_readback_string = getLayerOption("khronos_validation.gpuav_async_readback");
+    transform(async_readback_string.begin(), async_readback_string.end(), async_readback_string.begin(), ::tolower);
+    async_readback.enabled = !async_readback_string.empty() ? !async_readback_string.compare("true") : false;
+
+    std::string shader_cache_string = getLayerOption("khronos_validation.gpuav_shader_cache");
+    transform(shader_cache_string.begin(), shader_cache_string.end(), shader_cache_string.begin(), ::tolower);
+    const bool use_shader_cache = !shader_cache_string.empty() ? !shader_cache_string.compare("true") : true;
+
+    if (!instrumentation_filter.Init(getLayerOption("khronos_validation.gpuav_shader_hashes"),
+                                     getLayerOption("khronos_validation.gpuav_shader_name_pattern"),
+                                     getLayerOption("khronos_validation.gpuav_shader_stages"))) {
+        ReportSetupProblem(device, "gpuav_shader_name_pattern is not a valid regular expression.  Shader names are not filtered.");
+    }
+    const std::string sample_rate_string = getLayerOption("khronos_validation.gpuav_sample_rate");
+    if (!sample_rate_string.empty()) {
+        sample_rate = std::max(1u, static_cast<uint32_t>(std::strtoul(sample_rate_string.c_str(), nullptr, 10)));
+    }
+
     if (phys_dev_props.apiVersion < VK_API_VERSION_1_1) {
         ReportSetupProblem(device, "GPU-Assisted validation requires Vulkan 1.1 or later.  GPU-Assisted Validation disabled.");
         aborted = true;
@@ -308,12 +439,37 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         bindings.push_back(binding);
     }
     UtilPostCallRecordCreateDevice(pCreateInfo, bindings, this, phys_dev_props);
+    if (aborted) return;
+    const VkDeviceSize alignment = phys_dev_props.limits.minStorageBufferOffsetAlignment;
+    // Shared by all devices, leaked on purpose like the state counters
+    static StateMemoryCounter *output_chunk_counter = new StateMemoryCounter("GpuAssistedOutputChunks");
+    static StateMemoryCounter *input_chunk_counter = new StateMemoryCounter("GpuAssistedInputChunks");
+    uint32_t output_memory_type = 0;
+    uint32_t input_memory_type = 0;
+    if (!FindChunkMemoryType(vmaAllocator, false, &output_memory_type) ||
+        !FindChunkMemoryType(vmaAllocator, true, &input_memory_type) ||
+        !output_chunk_pool.Init(vmaAllocator, output_memory_type, alignment, output_chunk_counter) ||
+        !input_chunk_pool.Init(vmaAllocator, input_memory_type, alignment, input_chunk_counter)) {
+        ReportSetupProblem(device, "Unable to create memory pools.  Aborting GPU-AV");
+        aborted = true;
+        return;
+    }
+    if (use_shader_cache) {
+        shader_cache.Load(GetLayerCacheFilePath("gpuav_shader_cache"));
+        CreateInstrumentedPipelineCache();
+    }
     CreateAccelerationStructureBuildValidationState();
+    CreateErrorSummaryState();
 }
 
 // Clean up device-related resources
 void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     DestroyAccelerationStructureBuildValidationState();
+    DestroyErrorSummaryState();
+    for (const auto &entry : pipeline_variants) {
+        DispatchDestroyPipeline(device, entry.second->original, nullptr);
+    }
+    pipeline_variants.clear();
     UtilPreCallRecordDestroyDevice(this);
     ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator);
     if (pre_draw_validation_state.globals_created) {
@@ -325,8 +481,22 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
             DispatchDestroyPipeline(device, it->second, nullptr);
         }
         pre_draw_validation_state.renderpass_to_pipeline.clear();
+        if (pre_draw_validation_state.compute_pipeline != VK_NULL_HANDLE) {
+            DispatchDestroyPipeline(device, pre_draw_validation_state.compute_pipeline, nullptr);
+            DispatchDestroyPipelineLayout(device, pre_draw_validation_state.compute_pipeline_layout, nullptr);
+        }
         pre_draw_validation_state.globals_created = false;
     }
+    if (!shader_cache.Save()) {
+        LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open instrumented shader cache at %s for writing",
+                shader_cache.Path().c_str());
+    }
+    SaveInstrumentedPipelineCache();
+    // The command buffers destroyed by the state tracker have given their chunks back by now
+    bda_table = nullptr;
+    descriptor_inputs.clear();
+    output_chunk_pool.Destroy();
+    input_chunk_pool.Destroy();
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
     if (vmaAllocator) {
         vmaDestroyAllocator(vmaAllocator);
@@ -334,6 +504,109 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
     desc_set_manager.reset();
 }
 
+bool GpuAssistedChunkPool::Init(VmaAllocator allocator, uint32_t memory_type_index, VkDeviceSize alignment,
+                                StateMemoryCounter *counter) {
+    allocator_ = allocator;
+    memory_type_index_ = memory_type_index;
+    counter_ = counter;
+    // Blocks hold 32 and 64 bit words
+    alignment_ = std::max(alignment, static_cast<VkDeviceSize>(8));
+    VmaPoolCreateInfo pool_info = {};
+    pool_info.memoryTypeIndex = memory_type_index;
+    pool_info.blockSize = kChunkSize * kChunksPerBlock;
+    return vmaCreatePool(allocator_, &pool_info, &vma_pool_) == VK_SUCCESS;
+}
+
+bool GpuAssistedChunkPool::Acquire(VkDeviceSize size, Chunk *chunk) {
+    if (size <= kChunkSize) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!free_chunks_.empty()) {
+            *chunk = free_chunks_.back();
+            free_chunks_.pop_back();
+            return true;
+        }
+    }
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = std::max(size, kChunkSize);
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    // Larger chunks don't fit the pool's blocks, they get memory of the same type of their own
+    if (size <= kChunkSize) {
+        alloc_info.pool = vma_pool_;
+    } else {
+        alloc_info.memoryTypeBits = 1u << memory_type_index_;
+    }
+    VmaAllocationInfo allocation_info = {};
+    VkResult result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &chunk->buffer, &chunk->allocation, &allocation_info);
+    if (result != VK_SUCCESS) return false;
+    if (!allocation_info.pMappedData) {
+        vmaDestroyBuffer(allocator_, chunk->buffer, chunk->allocation);
+        return false;
+    }
+    chunk->mapped = static_cast<uint8_t *>(allocation_info.pMappedData);
+    chunk->size = buffer_info.size;
+    if (counter_) counter_->Add(static_cast<size_t>(chunk->size));
+    return true;
+}
+
+void GpuAssistedChunkPool::Free(const Chunk &chunk) {
+    vmaDestroyBuffer(allocator_, chunk.buffer, chunk.allocation);
+    if (counter_) counter_->Remove(static_cast<size_t>(chunk.size));
+}
+
+void GpuAssistedChunkPool::Release(std::vector<Chunk> &chunks) {
+    std::lock_guard<std::mutex> guard(lock_);
+    // The low memory profile bounds what the pool keeps instead of holding on to its high-water mark
+    const size_t max_free_chunks = LowMemoryProfile() ? kLowMemoryMaxFreeGpuChunks : std::numeric_limits<size_t>::max();
+    for (const auto &chunk : chunks) {
+        if (chunk.size == kChunkSize && free_chunks_.size() < max_free_chunks) {
+            free_chunks_.push_back(chunk);
+        } else {
+            if (chunk.size == kChunkSize) AddLowMemorySaving(kLowMemorySavingGpuChunks, kChunkSize);
+            Free(chunk);
+        }
+    }
+    chunks.clear();
+}
+
+void GpuAssistedChunkPool::Destroy() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto &chunk : free_chunks_) {
+        Free(chunk);
+    }
+    free_chunks_.clear();
+    if (vma_pool_ != VK_NULL_HANDLE) {
+        vmaDestroyPool(allocator_, vma_pool_);
+        vma_pool_ = VK_NULL_HANDLE;
+    }
+}
+
+bool GpuAssistedBlockAllocator::Allocate(VkDeviceSize size, GpuAssistedDeviceMemoryBlock *block, void **mapped) {
+    const VkDeviceSize alignment = pool_->Alignment();
+    VkDeviceSize offset = (used_ + alignment - 1) / alignment * alignment;
+    if (chunks_.empty() || (offset + size > chunks_.back().size)) {
+        GpuAssistedChunkPool::Chunk chunk;
+        if (!pool_->Acquire(size, &chunk)) return false;
+        chunks_.push_back(chunk);
+        offset = 0;
+    }
+    const auto &chunk = chunks_.back();
+    used_ = offset + size;
+    block->buffer = chunk.buffer;
+    block->allocation = chunk.allocation;
+    block->offset = offset;
+    *mapped = chunk.mapped + offset;
+    return true;
+}
+
+void GpuAssistedBlockAllocator::Reset() {
+    // Command buffers destroyed after the device have nothing left to give back
+    if (chunks_.empty()) return;
+    pool_->Release(chunks_);
+    used_ = 0;
+}
+
 void GpuAssisted::CreateAccelerationStructureBuildValidationState() {
     if (aborted) {
         return;
@@ -668,6 +941,161 @@ void GpuAssisted::DestroyAccelerationStructureBuildValidationState() {
     }
 }
 
+void GpuAssisted::CreateErrorSummaryState() {
+    if (aborted) {
+        return;
+    }
+    auto push_constant_range = VkPushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0, 3 * sizeof(uint32_t)};
+    auto pipeline_layout_ci = LvlInitStruct<VkPipelineLayoutCreateInfo>();
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &debug_desc_layout;
+    pipeline_layout_ci.pushConstantRangeCount = 1;
+    pipeline_layout_ci.pPushConstantRanges = &push_constant_range;
+    VkResult result = DispatchCreatePipelineLayout(device, &pipeline_layout_ci, nullptr, &error_summary_state.pipeline_layout);
+
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    if (result == VK_SUCCESS) {
+        auto shader_module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+        shader_module_ci.codeSize = sizeof(kErrorSummaryShaderSpirv);
+        shader_module_ci.pCode = kErrorSummaryShaderSpirv;
+        result = DispatchCreateShaderModule(device, &shader_module_ci, nullptr, &shader_module);
+    }
+
+    if (result == VK_SUCCESS) {
+        auto pipeline_ci = LvlInitStruct<VkComputePipelineCreateInfo>();
+        pipeline_ci.stage = LvlInitStruct<VkPipelineShaderStageCreateInfo>();
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = shader_module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = error_summary_state.pipeline_layout;
+        result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &error_summary_state.pipeline);
+    }
+
+    if (shader_module != VK_NULL_HANDLE) {
+        DispatchDestroyShaderModule(device, shader_module, nullptr);
+    }
+
+    // Without the compaction every output block is read after each submission, as before
+    if (result == VK_SUCCESS) {
+        error_summary_state.initialized = true;
+    } else {
+        ReportSetupProblem(device, "Failed to create the compute pipeline compacting GPU-Assisted Validation output.");
+    }
+}
+
+void GpuAssisted::DestroyErrorSummaryState() {
+    if (error_summary_state.pipeline != VK_NULL_HANDLE) {
+        DispatchDestroyPipeline(device, error_summary_state.pipeline, nullptr);
+    }
+    if (error_summary_state.pipeline_layout != VK_NULL_HANDLE) {
+        DispatchDestroyPipelineLayout(device, error_summary_state.pipeline_layout, nullptr);
+    }
+    error_summary_state = GpuAssistedErrorSummaryState();
+}
+
+// Append the compaction of the command buffer's output blocks, which counts the blocks written to and lists their indices.
+// Blocks are bump allocated, so each run of blocks following one another in a chunk is compacted by one dispatch.
+void GpuAssisted::RecordErrorSummary(gpuav_state::CommandBuffer *cb_node) {
+    const auto &buffer_list = cb_node->gpuav_buffer_list;
+    if (!error_summary_state.initialized || buffer_list.empty() || cb_node->createInfo.level != VK_COMMAND_BUFFER_LEVEL_PRIMARY ||
+        !(cb_node->GetQueueFlags() & VK_QUEUE_COMPUTE_BIT)) {
+        return;
+    }
+    const uint32_t max_indices = kMaxErrorSummaryIndices;
+    const uint32_t capacity = std::min(static_cast<uint32_t>(buffer_list.size()), max_indices);
+    const VkDeviceSize summary_size = sizeof(uint32_t) * (1 + capacity);
+    GpuAssistedDeviceMemoryBlock summary_block = {};
+    uint32_t *summary = nullptr;
+    if (!cb_node->output_blocks.Allocate(summary_size, &summary_block, reinterpret_cast<void **>(&summary))) {
+        return;
+    }
+    summary[0] = 0;
+
+    const VkCommandBuffer command_buffer = cb_node->commandBuffer();
+    auto barrier = LvlInitStruct<VkMemoryBarrier>();
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    DispatchCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+    DispatchCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, error_summary_state.pipeline);
+
+    const VkDeviceSize alignment = output_chunk_pool.Alignment();
+    const VkDeviceSize stride = (output_buffer_size + alignment - 1) / alignment * alignment;
+    const uint32_t block_count = static_cast<uint32_t>(buffer_list.size());
+    for (uint32_t first = 0; first < block_count;) {
+        const auto &first_block = buffer_list[first].output_mem_block;
+        uint32_t count = 1;
+        while (first + count < block_count && buffer_list[first + count].output_mem_block.buffer == first_block.buffer &&
+               buffer_list[first + count].output_mem_block.offset == first_block.offset + count * stride) {
+            ++count;
+        }
+
+        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+        VkDescriptorSet desc_set = VK_NULL_HANDLE;
+        if (desc_set_manager->GetDescriptorSet(&desc_pool, debug_desc_layout, &desc_set) != VK_SUCCESS) {
+            // The dispatches recorded so far are harmless, but the summary is incomplete and goes unused
+            return;
+        }
+        cb_node->error_summary_desc_sets.emplace_back(desc_pool, desc_set);
+
+        VkDescriptorBufferInfo buffer_infos[2] = {};
+        buffer_infos[0].buffer = first_block.buffer;
+        buffer_infos[0].offset = first_block.offset;
+        buffer_infos[0].range = (count - 1) * stride + output_buffer_size;
+        buffer_infos[1].buffer = summary_block.buffer;
+        buffer_infos[1].offset = summary_block.offset;
+        buffer_infos[1].range = summary_size;
+        VkWriteDescriptorSet desc_writes[2] = {};
+        for (uint32_t binding = 0; binding < 2; ++binding) {
+            desc_writes[binding] = LvlInitStruct<VkWriteDescriptorSet>();
+            desc_writes[binding].dstSet = desc_set;
+            desc_writes[binding].dstBinding = binding;
+            desc_writes[binding].descriptorCount = 1;
+            desc_writes[binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            desc_writes[binding].pBufferInfo = &buffer_infos[binding];
+        }
+        DispatchUpdateDescriptorSets(device, 2, desc_writes, 0, nullptr);
+        DispatchCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, error_summary_state.pipeline_layout, 0, 1,
+                                      &desc_set, 0, nullptr);
+        const uint32_t push_constants[3] = {static_cast<uint32_t>(stride / sizeof(uint32_t)), count, first};
+        DispatchCmdPushConstants(command_buffer, error_summary_state.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                 sizeof(push_constants), push_constants);
+        DispatchCmdDispatch(command_buffer, (count + kErrorSummaryGroupSize - 1) / kErrorSummaryGroupSize, 1, 1);
+        first += count;
+    }
+
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    DispatchCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0,
+                               nullptr, 0, nullptr);
+    cb_node->error_summary = summary;
+    cb_node->error_summary_capacity = capacity;
+}
+
+// Returns false if the command buffer has no usable summary, and every output block has to be read. Otherwise written_blocks
+// is set to the indices of the blocks holding errors, in order.
+bool GpuAssisted::ReadErrorSummary(gpuav_state::CommandBuffer *cb_node, std::vector<uint32_t> *written_blocks) {
+    uint32_t *summary = cb_node->error_summary;
+    if (!summary) return false;
+    const uint32_t error_count = summary[0];
+    if (error_count == 0) return true;
+    // Reset for the next submission of the command buffer, the blocks themselves are cleared as they are read
+    summary[0] = 0;
+    if (error_count > cb_node->error_summary_capacity) return false;
+    written_blocks->assign(summary + 1, summary + 1 + error_count);
+    // A command buffer submitted again before it was read lists its blocks more than once
+    std::sort(written_blocks->begin(), written_blocks->end());
+    written_blocks->erase(std::unique(written_blocks->begin(), written_blocks->end()), written_blocks->end());
+    return true;
+}
+
+void GpuAssisted::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    ValidationStateTracker::PreCallRecordEndCommandBuffer(commandBuffer);
+    if (aborted) return;
+    auto cb_node = Get<gpuav_state::CommandBuffer>(commandBuffer);
+    if (cb_node) RecordErrorSummary(cb_node.get());
+}
+
 struct GPUAV_RESTORABLE_PIPELINE_STATE {
     VkPipelineBindPoint pipeline_bind_point = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     VkPipeline pipeline = VK_NULL_HANDLE;
@@ -695,7 +1123,9 @@ struct GPUAV_RESTORABLE_PIPELINE_STATE {
                     if (bound_descriptor_set->IsPushDescriptor()) {
                         push_descriptor_set_index = static_cast<uint32_t>(i);
                     }
-                    dynamic_offsets.push_back(last_bound.per_set[i].dynamicOffsets);
+                    const uint32_t *set_dynamic_offsets = last_bound.DynamicOffsets(last_bound.per_set[i]);
+                    dynamic_offsets.emplace_back(set_dynamic_offsets,
+                                                 set_dynamic_offsets + last_bound.per_set[i].dynamic_offset_count);
                 }
             }
 
@@ -903,6 +1333,7 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
 
     // Restore the previous compute pipeline state.
     restorable_state.Restore(commandBuffer);
+    cb_state->bound_original_variant[BindPoint_Compute] = false;
 
     cb_state->as_validation_buffers.emplace_back(std::move(as_validation_buffer_info));
 }
@@ -982,14 +1413,8 @@ void GpuAssisted::PostCallRecordCreatePipelineLayout(VkDevice device, const VkPi
 }
 
 // Free the device memory and descriptor set(s) associated with a command buffer.
+// The memory blocks are suballocated from the command buffer's chunks, which are given back as a whole
 void GpuAssisted::DestroyBuffer(GpuAssistedBufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
-    if (buffer_info.di_input_mem_block.buffer) {
-        vmaDestroyBuffer(vmaAllocator, buffer_info.di_input_mem_block.buffer, buffer_info.di_input_mem_block.allocation);
-    }
-    if (buffer_info.bda_input_mem_block.buffer) {
-        vmaDestroyBuffer(vmaAllocator, buffer_info.bda_input_mem_block.buffer, buffer_info.bda_input_mem_block.allocation);
-    }
     if (buffer_info.desc_set != VK_NULL_HANDLE) {
         desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
     }
@@ -1092,17 +1517,77 @@ void GpuAssisted::PostCallRecordGetPhysicalDeviceProperties2(VkPhysicalDevice ph
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pPhysicalDeviceProperties2);
 }
 
+// The file of the cache is named after the instrumentation options and the driver's pipeline cache UUID, so that runs with
+// other settings or on another device keep their own
+void GpuAssisted::CreateInstrumentedPipelineCache() {
+    auto key = InstrumentationOptions();
+    const uint8_t *uuid = phys_dev_props.pipelineCacheUUID;
+    for (uint32_t i = 0; i < VK_UUID_SIZE; i += 4) {
+        key.push_back(uuid[i] | (uuid[i + 1] << 8) | (uuid[i + 2] << 16) | (static_cast<uint32_t>(uuid[i + 3]) << 24));
+    }
+    char base_name[64];
+    snprintf(base_name, sizeof(base_name), "gpuav_pipeline_cache_%016" PRIx64, UtilShaderModuleHash(key));
+    instrumented_pipeline_cache_path = GetLayerCacheFilePath(base_name);
+
+    std::vector<char> cache_data;
+    std::ifstream read_file(instrumented_pipeline_cache_path.c_str(), std::ios::in | std::ios::binary);
+    if (read_file) {
+        std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(cache_data));
+        read_file.close();
+    }
+    auto create_info = LvlInitStruct<VkPipelineCacheCreateInfo>();
+    create_info.initialDataSize = cache_data.size();
+    create_info.pInitialData = cache_data.data();
+    if (DispatchCreatePipelineCache(device, &create_info, nullptr, &instrumented_pipeline_cache) != VK_SUCCESS) {
+        // Without a cache the instrumented pipelines are created with the application's
+        instrumented_pipeline_cache = VK_NULL_HANDLE;
+    }
+}
+
+void GpuAssisted::SaveInstrumentedPipelineCache() {
+    if (instrumented_pipeline_cache == VK_NULL_HANDLE) return;
+    size_t cache_size = 0;
+    std::vector<char> cache_data;
+    VkResult result = DispatchGetPipelineCacheData(device, instrumented_pipeline_cache, &cache_size, nullptr);
+    if (result == VK_SUCCESS && cache_size > 0) {
+        cache_data.resize(cache_size);
+        result = DispatchGetPipelineCacheData(device, instrumented_pipeline_cache, &cache_size, cache_data.data());
+    }
+    DispatchDestroyPipelineCache(device, instrumented_pipeline_cache, nullptr);
+    instrumented_pipeline_cache = VK_NULL_HANDLE;
+    if (result != VK_SUCCESS || cache_size == 0) return;
+    FILE *write_file = fopen(instrumented_pipeline_cache_path.c_str(), "wb");
+    if (!write_file) {
+        LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open instrumented pipeline cache at %s for writing",
+                instrumented_pipeline_cache_path.c_str());
+        return;
+    }
+    fwrite(cache_data.data(), sizeof(char), cache_size, write_file);
+    fclose(write_file);
+}
+
+template <typename CreateInfo, typename ApiState>
+void GpuAssisted::SetupInstrumentedPipelineCreation(uint32_t count, const CreateInfo *pCreateInfos, ApiState *api_state) const {
+    api_state->pipeline_cache = instrumented_pipeline_cache;
+    if (count < kMinParallelPipelineCreates || !CanRunPipelineBatch()) return;
+    // Pipelines deriving from another of the call, or whose failure stops the call, need the call to stay whole
+    for (uint32_t i = 0; i < count; ++i) {
+        if (pCreateInfos[i].flags & VK_PIPELINE_CREATE_EARLY_RETURN_ON_FAILURE_BIT_EXT) return;
+        if ((pCreateInfos[i].flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) && pCreateInfos[i].basePipelineIndex >= 0) return;
+    }
+    api_state->parallel_create = this;
+}
+
 void GpuAssisted::PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                        const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                        void *cgpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkGraphicsPipelineCreateInfo> new_pipeline_create_infos;
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, cgpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_GRAPHICS, this);
-    cgpl_state->gpu_create_infos = new_pipeline_create_infos;
-    cgpl_state->pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(cgpl_state->gpu_create_infos.data());
+                                       &cgpl_state->gpu_create_infos, &cgpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_GRAPHICS, this);
+    SetupInstrumentedPipelineCreation(count, pCreateInfos, cgpl_state);
     ValidationStateTracker::PreCallRecordCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines,
                                                                  cgpl_state_data);
 }
@@ -1112,12 +1597,11 @@ void GpuAssisted::PreCallRecordCreateComputePipelines(VkDevice device, VkPipelin
                                                       const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                       void *ccpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkComputePipelineCreateInfo> new_pipeline_create_infos;
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, ccpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_COMPUTE, this);
-    ccpl_state->gpu_create_infos = new_pipeline_create_infos;
-    ccpl_state->pCreateInfos = reinterpret_cast<VkComputePipelineCreateInfo *>(ccpl_state->gpu_create_infos.data());
+                                       &ccpl_state->gpu_create_infos, &ccpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_COMPUTE, this);
+    SetupInstrumentedPipelineCreation(count, pCreateInfos, ccpl_state);
     ValidationStateTracker::PreCallRecordCreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines,
                                                                 ccpl_state_data);
 }
@@ -1127,12 +1611,10 @@ void GpuAssisted::PreCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkPi
                                                            const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                            void *crtpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkRayTracingPipelineCreateInfoCommon> new_pipeline_create_infos;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, crtpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
-    crtpl_state->gpu_create_infos = new_pipeline_create_infos;
-    crtpl_state->pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoNV *>(crtpl_state->gpu_create_infos.data());
+                                       &crtpl_state->gpu_create_infos, &crtpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
     ValidationStateTracker::PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                      pPipelines, crtpl_state_data);
 }
@@ -1143,16 +1625,54 @@ void GpuAssisted::PreCallRecordCreateRayTracingPipelinesKHR(VkDevice device, VkD
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             void *crtpl_state_data) {
     if (aborted) return;
-    std::vector<safe_VkRayTracingPipelineCreateInfoCommon> new_pipeline_create_infos;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_khr_api_state *>(crtpl_state_data);
     UtilPreCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, crtpl_state->pipe_state,
-                                       &new_pipeline_create_infos, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this);
-    crtpl_state->gpu_create_infos = new_pipeline_create_infos;
-    crtpl_state->pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoKHR *>(crtpl_state->gpu_create_infos.data());
+                                       &crtpl_state->gpu_create_infos, &crtpl_state->pCreateInfos,
+                                       VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, this);
     ValidationStateTracker::PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, count, pCreateInfos,
                                                                       pAllocator, pPipelines, crtpl_state_data);
 }
 
+static VkResult DispatchCreatePipeline(VkDevice device, VkPipelineCache pipeline_cache,
+                                       const VkGraphicsPipelineCreateInfo &create_info, VkPipeline *pipeline) {
+    return DispatchCreateGraphicsPipelines(device, pipeline_cache, 1, &create_info, nullptr, pipeline);
+}
+
+static VkResult DispatchCreatePipeline(VkDevice device, VkPipelineCache pipeline_cache,
+                                       const VkComputePipelineCreateInfo &create_info, VkPipeline *pipeline) {
+    return DispatchCreateComputePipelines(device, pipeline_cache, 1, &create_info, nullptr, pipeline);
+}
+
+// With sampling on, create the original variant of each pipeline that got an instrumented shader, from the application's
+// create info. Pipelines are created one at a time, so derivatives lose their base.
+template <typename CreateInfo, typename SafeCreateInfo>
+void GpuAssisted::CreatePipelineVariants(VkPipelineCache pipelineCache, uint32_t count, const CreateInfo *pCreateInfos,
+                                         const std::vector<SafeCreateInfo> &gpu_create_infos, const VkPipeline *pPipelines) {
+    using Accessor = CreatePipelineTraits<CreateInfo>;
+    // No copies means no instrumented shader
+    if (sample_rate <= 1 || gpu_create_infos.empty()) return;
+    for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
+        if (pPipelines[pipeline] == VK_NULL_HANDLE) continue;
+        bool instrumented = false;
+        for (uint32_t stage = 0; stage < Accessor::GetStageCount(pCreateInfos[pipeline]); ++stage) {
+            instrumented |= Accessor::GetShaderModule(pCreateInfos[pipeline], stage) !=
+                            Accessor::GetShaderModule(*gpu_create_infos[pipeline].ptr(), stage);
+        }
+        if (!instrumented) continue;
+        CreateInfo create_info = pCreateInfos[pipeline];
+        create_info.flags &= ~VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        create_info.basePipelineHandle = VK_NULL_HANDLE;
+        create_info.basePipelineIndex = -1;
+        auto variant = std::make_shared<GpuAssistedPipelineVariant>();
+        if (DispatchCreatePipeline(device, pipelineCache, create_info, &variant->original) != VK_SUCCESS) {
+            // Without its variant the pipeline just runs instrumented every time
+            continue;
+        }
+        std::lock_guard<std::mutex> guard(pipeline_variants_lock);
+        pipeline_variants[pPipelines[pipeline]] = std::move(variant);
+    }
+}
+
 void GpuAssisted::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                         const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -1161,7 +1681,9 @@ void GpuAssisted::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                   pPipelines, result, cgpl_state_data);
     if (aborted) return;
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, cgpl_state->gpu_create_infos.data());
+    // Before the feedback is copied, creating the variants writes to the application's feedback structures
+    CreatePipelineVariants(pipelineCache, count, pCreateInfos, cgpl_state->gpu_create_infos, pPipelines);
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, cgpl_state->gpu_create_infos);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_GRAPHICS, this);
 }
 
@@ -1173,7 +1695,8 @@ void GpuAssisted::PostCallRecordCreateComputePipelines(VkDevice device, VkPipeli
                                                                  result, ccpl_state_data);
     if (aborted) return;
     create_compute_pipeline_api_state *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, ccpl_state->gpu_create_infos.data());
+    CreatePipelineVariants(pipelineCache, count, pCreateInfos, ccpl_state->gpu_create_infos, pPipelines);
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, ccpl_state->gpu_create_infos);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_COMPUTE, this);
 }
 
@@ -1185,7 +1708,7 @@ void GpuAssisted::PostCallRecordCreateRayTracingPipelinesNV(VkDevice device, VkP
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                       pPipelines, result, crtpl_state_data);
     if (aborted) return;
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->gpu_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->gpu_create_infos);
     UtilPostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, this);
 }
 
@@ -1198,7 +1721,7 @@ void GpuAssisted::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice device, Vk
     ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
         device, deferredOperation, pipelineCache, count, pCreateInfos, pAllocator, pPipelines, result, crtpl_state_data);
     if (aborted) return;
-    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->gpu_create_infos.data());
+    UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, crtpl_state->gpu_create_infos);
 
     bool is_operation_deferred = (deferredOperation != VK_NULL_HANDLE && result == VK_OPERATION_DEFERRED_KHR);
     if (is_operation_deferred) {
@@ -1235,9 +1758,46 @@ void GpuAssisted::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipel
             ++it;
         }
     }
+    {
+        std::lock_guard<std::mutex> guard(pipeline_variants_lock);
+        auto it = pipeline_variants.find(pipeline);
+        if (it != pipeline_variants.end()) {
+            DispatchDestroyPipeline(device, it->second->original, nullptr);
+            pipeline_variants.erase(it);
+        }
+    }
     ValidationStateTracker::PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
 }
 
+// Binding a pipeline puts the instrumented variant in place again
+void GpuAssisted::PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                               VkPipeline pipeline) {
+    ValidationStateTracker::PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+    auto cb_node = Get<gpuav_state::CommandBuffer>(commandBuffer);
+    if (cb_node) cb_node->bound_original_variant[ConvertToLvlBindPoint(pipelineBindPoint)] = false;
+}
+
+// Bind the variant of the current pipeline this draw or dispatch should run with. Returns false if it is left out of the
+// sample, and so needs no validation.
+bool GpuAssisted::SelectPipelineVariant(gpuav_state::CommandBuffer *cb_node, VkPipelineBindPoint bind_point,
+                                        const PIPELINE_STATE &pipeline_state) {
+    if (sample_rate <= 1) return true;
+    std::shared_ptr<GpuAssistedPipelineVariant> variant;
+    {
+        std::lock_guard<std::mutex> guard(pipeline_variants_lock);
+        auto it = pipeline_variants.find(pipeline_state.pipeline());
+        if (it == pipeline_variants.end()) return true;
+        variant = it->second;
+    }
+    const bool sampled = (variant->draw_count.fetch_add(1, std::memory_order_relaxed) % sample_rate) == 0;
+    auto &bound_original = cb_node->bound_original_variant[ConvertToLvlBindPoint(bind_point)];
+    if (bound_original == sampled) {
+        DispatchCmdBindPipeline(cb_node->commandBuffer(), bind_point, sampled ? pipeline_state.pipeline() : variant->original);
+        bound_original = !sampled;
+    }
+    return sampled;
+}
+
 void GpuAssisted::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
                                                  const VkAllocationCallbacks *pAllocator) {
     auto pipeline = pre_draw_validation_state.renderpass_to_pipeline.find(renderPass);
@@ -1249,8 +1809,20 @@ void GpuAssisted::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass r
 }
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+// Called for the pipelines' modules the first time they are used, from any thread (see UtilInstrumentShaderModules()).
+std::vector<uint32_t> GpuAssisted::InstrumentationOptions() const {
+    const spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    const bool buffer_device_address = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                        IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                       shaderInt64 && enabled_features.core12.bufferDeviceAddress;
+    auto options = UtilInstrumentationOptions(this, target_env);
+    options.insert(options.end(), {descriptor_indexing, buffer_oob_enabled, buffer_device_address});
+    return options;
+}
+
 bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo, std::vector<uint32_t> &new_pgm,
-                                   uint32_t *unique_shader_id) {
+                                   uint32_t unique_shader_id) {
+    TraceScope trace("GpuAssisted", "InstrumentShader");
     if (aborted) return false;
     if (pCreateInfo->pCode[0] != spv::MagicNumber) return false;
 
@@ -1268,6 +1840,25 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
 
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    const bool buffer_device_address = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                        IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                       shaderInt64 && enabled_features.core12.bufferDeviceAddress;
+
+    // Modules instrumented by an earlier run are taken from the cache, stamped with this module's id
+    const bool use_cache = shader_cache.Enabled() && UtilInstrumentedShaderCache::CanCache(pCreateInfo);
+    UtilInstrumentedShaderCache::Key cache_key = {};
+    if (use_cache) {
+        cache_key = UtilInstrumentedShaderCache::MakeKey(pCreateInfo, InstrumentationOptions());
+        if (shader_cache.Find(cache_key, new_pgm)) {
+            UtilInstrumentedShaderCache::SetShaderId(new_pgm, unique_shader_id);
+            return true;
+        }
+    }
+    const uint32_t placeholder_id = UtilInstrumentedShaderCache::kShaderIdPlaceholder;
+    const uint32_t shader_id = use_cache ? placeholder_id : unique_shader_id;
+
     // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
     new_pgm.clear();
@@ -1277,8 +1868,6 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     spvtools::ValidatorOptions val_options;
     AdjustValidatorOptions(device_extensions, enabled_features, val_options);
     spvtools::OptimizerOptions opt_options;
@@ -1286,35 +1875,39 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     opt_options.set_validator_options(val_options);
     Optimizer optimizer(target_env);
     optimizer.SetMessageConsumer(gpu_console_message_consumer);
-    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing,
-                                                       descriptor_indexing, buffer_oob_enabled, buffer_oob_enabled));
+    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, shader_id, descriptor_indexing, descriptor_indexing,
+                                                       buffer_oob_enabled, buffer_oob_enabled));
     // Call CreateAggressiveDCEPass with preserve_interface == true
     optimizer.RegisterPass(CreateAggressiveDCEPass(true));
-    if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
-         IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
-        shaderInt64 && enabled_features.core12.bufferDeviceAddress) {
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+    if (buffer_device_address) {
+        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, shader_id));
     }
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
     }
-    *unique_shader_id = unique_shader_module_id++;
+    if (pass && use_cache) {
+        shader_cache.Insert(cache_key, new_pgm);
+        UtilInstrumentedShaderCache::SetShaderId(new_pgm, unique_shader_id);
+    }
     return pass;
 }
-// Create the instrumented shader data to provide to the driver.
+// Give the module the shader ID its instrumented code will report errors with. The driver gets the application's code, the
+// module is instrumented when a pipeline first uses it.
 void GpuAssisted::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                   void *csm_state_data) {
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
-    bool pass = InstrumentShader(pCreateInfo, csm_state->instrumented_pgm, &csm_state->unique_shader_id);
-    if (pass) {
-        csm_state->instrumented_create_info.pCode = csm_state->instrumented_pgm.data();
-        csm_state->instrumented_create_info.codeSize = csm_state->instrumented_pgm.size() * sizeof(uint32_t);
-    }
+    csm_state->unique_shader_id = unique_shader_module_id++;
     ValidationStateTracker::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, csm_state_data);
 }
 
+void GpuAssisted::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                   const VkAllocationCallbacks *pAllocator) {
+    UtilPreCallRecordDestroyShaderModule(shaderModule, this);
+    ValidationStateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
+}
+
 static const int kInstErrorPreDrawValidate = spvtools::kInstErrorMax + 1;
 static const int kPreDrawValidateSubError = spvtools::kInstValidationOutError + 1;
 // Generate the part of the message describing the violation.
@@ -1448,7 +2041,7 @@ void GpuAssisted::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     std::string vuid_msg;
     VkShaderModule shader_module_handle = VK_NULL_HANDLE;
     VkPipeline pipeline_handle = VK_NULL_HANDLE;
-    std::vector<uint32_t> pgm;
+    std::shared_ptr<const UtilShaderSourceIndex> source_index;
     // The first record starts at this offset after the total_words.
     const uint32_t *debug_record = &debug_output_buffer[kDebugOutputDataOffset];
     // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
@@ -1457,14 +2050,14 @@ void GpuAssisted::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     if (it != shader_map.end()) {
         shader_module_handle = it->second.shader_module;
         pipeline_handle = it->second.pipeline;
-        pgm = it->second.pgm;
+        source_index = UtilMessageSourceIndex(it->second);
     }
     bool gen_full_message = GenerateValidationMessage(debug_record, validation_message, vuid_msg, buffer_info, this);
     if (gen_full_message) {
         UtilGenerateStageMessage(debug_record, stage_message);
-        UtilGenerateCommonMessage(report_data, command_buffer, debug_record, shader_module_handle, pipeline_handle,
-            buffer_info.pipeline_bind_point, operation_index, common_message);
-        UtilGenerateSourceMessages(pgm, debug_record, false, filename_message, source_message);
+        UtilGenerateCommonMessage(report_data, command_buffer, debug_record, shader_module_handle, source_index.get(),
+                                  pipeline_handle, buffer_info.pipeline_bind_point, operation_index, common_message);
+        UtilGenerateSourceMessages(source_index.get(), debug_record, false, filename_message, source_message);
         LogError(queue, vuid_msg.c_str(), "%s %s %s %s%s", validation_message.c_str(), common_message.c_str(), stage_message.c_str(),
             filename_message.c_str(), source_message.c_str());
     }
@@ -1511,12 +2104,16 @@ void GpuAssisted::SetDescriptorInitialized(uint32_t *pData, uint32_t index, cons
 
 // For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
 void GpuAssisted::UpdateInstrumentationBuffer(gpuav_state::CommandBuffer *cb_node) {
+    for (auto &descriptor_input : cb_node->descriptor_inputs) {
+        descriptor_input->Refresh(this);
+    }
     uint32_t *data;
     for (auto &buffer_info : cb_node->gpuav_buffer_list) {
         if (buffer_info.di_input_mem_block.update_at_submit.size() > 0) {
             VkResult result =
                 vmaMapMemory(vmaAllocator, buffer_info.di_input_mem_block.allocation, reinterpret_cast<void **>(&data));
             if (result == VK_SUCCESS) {
+                data += buffer_info.di_input_mem_block.offset / sizeof(uint32_t);
                 for (const auto &update : buffer_info.di_input_mem_block.update_at_submit) {
                     if (update.second->updated) {
                         SetDescriptorInitialized(data, update.first, update.second);
@@ -1530,6 +2127,11 @@ void GpuAssisted::UpdateInstrumentationBuffer(gpuav_state::CommandBuffer *cb_nod
 
 void GpuAssisted::PreRecordCommandBuffer(VkCommandBuffer command_buffer) {
     auto cb_node = Get<gpuav_state::CommandBuffer>(command_buffer);
+    // Output of an earlier submission still to be read would be overwritten
+    UtilWaitForReadbacks(this, cb_node.get());
+    for (const auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
+        UtilWaitForReadbacks(this, secondary_cmd_buffer);
+    }
     UpdateInstrumentationBuffer(cb_node.get());
     for (auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
         UpdateInstrumentationBuffer(static_cast<gpuav_state::CommandBuffer *>(secondary_cmd_buffer));
@@ -1582,14 +2184,18 @@ bool GpuAssisted::CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) {
     return buffers_present;
 }
 
-void GpuAssisted::ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer) {
-    auto cb_node = Get<gpuav_state::CommandBuffer>(command_buffer);
-
-    UtilProcessInstrumentationBuffer(queue, cb_node.get(), this);
-    ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node.get());
+void GpuAssisted::ProcessCommandBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
+    auto *gpuav_cb_node = static_cast<gpuav_state::CommandBuffer *>(cb_node);
+    std::vector<uint32_t> written_blocks;
+    if (!ReadErrorSummary(gpuav_cb_node, &written_blocks)) {
+        UtilProcessInstrumentationBuffer(queue, gpuav_cb_node, this);
+    } else if (!written_blocks.empty()) {
+        UtilProcessInstrumentationBuffer(queue, gpuav_cb_node, this, &written_blocks);
+    }
+    ProcessAccelerationStructureBuildValidationBuffer(queue, gpuav_cb_node);
     for (auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
         UtilProcessInstrumentationBuffer(queue, secondary_cmd_buffer, this);
-        ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node.get());
+        ProcessAccelerationStructureBuildValidationBuffer(queue, gpuav_cb_node);
     }
 }
 
@@ -1601,6 +2207,7 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessCompletedReadbacks(this);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -1611,6 +2218,18 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
+    if (async_readback.enabled) {
+        std::vector<std::shared_ptr<CMD_BUFFER_STATE>> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+                command_buffers.emplace_back(Get<CMD_BUFFER_STATE>(submit->pCommandBuffers[i]));
+            }
+        }
+        UtilQueueReadback(queue, std::move(command_buffers), this);
+        return;
+    }
+
     UtilSubmitBarrier(queue, this);
 
     DispatchQueueWaitIdle(queue);
@@ -1618,7 +2237,7 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBuffers[i]);
+            ProcessCommandBuffer(queue, Get<CMD_BUFFER_STATE>(submit->pCommandBuffers[i]).get());
         }
     }
 }
@@ -1626,6 +2245,7 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
 void GpuAssisted::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
                                                 VkFence fence, VkResult result) {
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessCompletedReadbacks(this);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -1636,6 +2256,18 @@ void GpuAssisted::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     }
     if (!buffers_present) return;
 
+    if (async_readback.enabled) {
+        std::vector<std::shared_ptr<CMD_BUFFER_STATE>> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+                command_buffers.emplace_back(Get<CMD_BUFFER_STATE>(submit->pCommandBufferInfos[i].commandBuffer));
+            }
+        }
+        UtilQueueReadback(queue, std::move(command_buffers), this);
+        return;
+    }
+
     UtilSubmitBarrier(queue, this);
 
     DispatchQueueWaitIdle(queue);
@@ -1643,7 +2275,7 @@ void GpuAssisted::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBufferInfos[i].commandBuffer);
+            ProcessCommandBuffer(queue, Get<CMD_BUFFER_STATE>(submit->pCommandBufferInfos[i].commandBuffer).get());
         }
     }
 }
@@ -1660,6 +2292,27 @@ void GpuAssisted::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount
     RecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
 }
 
+void GpuAssisted::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
+void GpuAssisted::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
+void GpuAssisted::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                        uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
+void GpuAssisted::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessCompletedReadbacks(this);
+}
+
 void GpuAssisted::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                        uint32_t firstVertex, uint32_t firstInstance) {
     ValidationStateTracker::PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
@@ -1882,6 +2535,33 @@ void GpuAssisted::PostCallRecordCmdTraceRaysIndirectKHR(VkCommandBuffer commandB
 // python ./scripts/generate_spirv.py --outfilename ./layers/generated/gpu_pre_draw_shader.h ./layers/gpu_pre_draw_shader.vert
 // ./External/glslang/build/install/bin/glslangValidator.exe
 #include "gpu_pre_draw_shader.h"
+// The pre-draw validation shader as a compute shader. The vertex shader does all its work in the invocation with gl_VertexIndex
+// 0, so it runs unchanged as a compute shader of a single invocation once gl_VertexIndex reads gl_LocalInvocationIndex instead.
+static std::vector<uint32_t> PreDrawComputeShaderSpirv() {
+    const uint32_t *words = gpu_pre_draw_shader_vert;
+    const size_t word_count = sizeof(gpu_pre_draw_shader_vert) / sizeof(uint32_t);
+    std::vector<uint32_t> spirv(words, words + 5);
+    spirv.reserve(word_count + 6);
+    for (size_t offset = 5; offset < word_count;) {
+        const uint32_t length = words[offset] >> 16;
+        const uint32_t opcode = words[offset] & 0xFFFF;
+        if (length == 0 || offset + length > word_count) break;
+        const size_t start = spirv.size();
+        spirv.insert(spirv.end(), words + offset, words + offset + length);
+        if (opcode == spv::OpEntryPoint && spirv[start + 1] == spv::ExecutionModelVertex) {
+            spirv[start + 1] = spv::ExecutionModelGLCompute;
+            const uint32_t entry_point = spirv[start + 2];
+            const uint32_t local_size[] = {(6u << 16) | spv::OpExecutionMode, entry_point, spv::ExecutionModeLocalSize, 1, 1, 1};
+            spirv.insert(spirv.end(), std::begin(local_size), std::end(local_size));
+        } else if (opcode == spv::OpDecorate && length == 4 && spirv[start + 2] == spv::DecorationBuiltIn &&
+                   spirv[start + 3] == spv::BuiltInVertexIndex) {
+            spirv[start + 3] = spv::BuiltInLocalInvocationIndex;
+        }
+        offset += length;
+    }
+    return spirv;
+}
+
 void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBlock output_block,
                                                      GpuAssistedPreDrawResources &resources, const LAST_BOUND_STATE &state,
                                                      VkPipeline *pPipeline, const GpuAssistedCmdDrawIndirectState *cdi_state) {
@@ -1899,7 +2579,8 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
         }
 
         std::vector<VkDescriptorSetLayoutBinding> bindings;
-        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, NULL};
+        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_COMPUTE_BIT, NULL};
         // 0 - output buffer, 1 - count buffer
         bindings.push_back(binding);
         binding.binding = 1;
@@ -1936,12 +2617,45 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
             return;
         }
 
+        if (batch_draw_indirect_validation) {
+            push_constant_ranges[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+            result = DispatchCreatePipelineLayout(device, pipelineLayoutCreateInfo, NULL,
+                                                  &pre_draw_validation_state.compute_pipeline_layout);
+            const auto compute_spirv = PreDrawComputeShaderSpirv();
+            VkShaderModule compute_module = VK_NULL_HANDLE;
+            if (result == VK_SUCCESS) {
+                shader_module_ci.codeSize = compute_spirv.size() * sizeof(uint32_t);
+                shader_module_ci.pCode = compute_spirv.data();
+                result = DispatchCreateShaderModule(device, &shader_module_ci, nullptr, &compute_module);
+            }
+            if (result == VK_SUCCESS) {
+                auto pipeline_ci = LvlInitStruct<VkComputePipelineCreateInfo>();
+                pipeline_ci.stage = LvlInitStruct<VkPipelineShaderStageCreateInfo>();
+                pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+                pipeline_ci.stage.module = compute_module;
+                pipeline_ci.stage.pName = "main";
+                pipeline_ci.layout = pre_draw_validation_state.compute_pipeline_layout;
+                result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr,
+                                                        &pre_draw_validation_state.compute_pipeline);
+            }
+            if (compute_module != VK_NULL_HANDLE) {
+                DispatchDestroyShaderModule(device, compute_module, nullptr);
+            }
+            if (result != VK_SUCCESS) {
+                ReportSetupProblem(device, "Unable to create compute pipeline.  Aborting GPU-AV");
+                aborted = true;
+                return;
+            }
+        }
+
         pre_draw_validation_state.globals_created = true;
     }
 
     VkPipeline pipeline = VK_NULL_HANDLE;
     VkRenderPass render_pass = state.pipeline_state->RenderPassState()->renderPass();
-    if (render_pass != VK_NULL_HANDLE) {
+    if (!pPipeline) {
+        // Batched, validated by the compute pipeline
+    } else if (render_pass != VK_NULL_HANDLE) {
         auto pipeentry = pre_draw_validation_state.renderpass_to_pipeline.find(render_pass);
         if (pipeentry != pre_draw_validation_state.renderpass_to_pipeline.end()) {
             pipeline = pipeentry->second;
@@ -1950,7 +2664,7 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
         // Dynamic Rendering
         pipeline = pre_draw_validation_state.dyn_rendering_pipeline;
     }
-    if (pipeline == VK_NULL_HANDLE) {
+    if (pPipeline && pipeline == VK_NULL_HANDLE) {
         auto pipeline_stage_ci = LvlInitStruct<VkPipelineShaderStageCreateInfo>();
         pipeline_stage_ci.stage = VK_SHADER_STAGE_VERTEX_BIT;
         pipeline_stage_ci.module = pre_draw_validation_state.validation_shader_module;
@@ -1986,7 +2700,7 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
             pre_draw_validation_state.renderpass_to_pipeline[render_pass] = new_pipeline;
         else
             pre_draw_validation_state.dyn_rendering_pipeline = new_pipeline;
-    } else {
+    } else if (pPipeline) {
         *pPipeline = pipeline;
     }
 
@@ -2001,8 +2715,8 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
     VkDescriptorBufferInfo buffer_infos[3] = {};
     // Error output buffer
     buffer_infos[0].buffer = output_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].offset = output_block.offset;
+    buffer_infos[0].range = output_buffer_size;
     if (cdi_state->count_buffer) {
         // Count buffer
         buffer_infos[1].buffer = cdi_state->count_buffer;
@@ -2025,6 +2739,209 @@ void GpuAssisted::AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBloc
     DispatchUpdateDescriptorSets(device, 2, desc_writes, 0, NULL);
 }
 
+// Validate the indirect draws of the render pass that just ended, with one compute pipeline bind for all of them instead of a
+// graphics pipeline bind and a restore of the application's state per draw.
+void GpuAssisted::RecordPendingPreDrawValidations(VkCommandBuffer commandBuffer) {
+    if (aborted) return;
+    auto cb_node = Get<gpuav_state::CommandBuffer>(commandBuffer);
+    if (!cb_node || cb_node->pending_pre_draw_validations.empty()) return;
+
+    GPUAV_RESTORABLE_PIPELINE_STATE restorable_state;
+    restorable_state.Create(cb_node.get(), VK_PIPELINE_BIND_POINT_COMPUTE);
+
+    // The draws read the indirect and count buffers with the application's synchronization, and wrote to the output blocks
+    auto barrier = LvlInitStruct<VkMemoryBarrier>();
+    barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    DispatchCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+    DispatchCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pre_draw_validation_state.compute_pipeline);
+    for (const auto &pending : cb_node->pending_pre_draw_validations) {
+        DispatchCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                      pre_draw_validation_state.compute_pipeline_layout, 0, 1, &pending.desc_set, 0, nullptr);
+        DispatchCmdPushConstants(commandBuffer, pre_draw_validation_state.compute_pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                 sizeof(pending.push_constants), pending.push_constants);
+        DispatchCmdDispatch(commandBuffer, 1, 1, 1);
+    }
+    cb_node->pending_pre_draw_validations.clear();
+
+    restorable_state.Restore(commandBuffer);
+    cb_node->bound_original_variant[BindPoint_Compute] = false;
+}
+
+void GpuAssisted::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    ValidationStateTracker::PostCallRecordCmdEndRenderPass(commandBuffer);
+    RecordPendingPreDrawValidations(commandBuffer);
+}
+
+void GpuAssisted::PostCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo) {
+    ValidationStateTracker::PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+    RecordPendingPreDrawValidations(commandBuffer);
+}
+
+void GpuAssisted::PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo) {
+    ValidationStateTracker::PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+    RecordPendingPreDrawValidations(commandBuffer);
+}
+
+void GpuAssisted::PostCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
+    ValidationStateTracker::PostCallRecordCmdEndRenderingKHR(commandBuffer);
+    RecordPendingPreDrawValidations(commandBuffer);
+}
+
+void GpuAssisted::PostCallRecordCmdEndRendering(VkCommandBuffer commandBuffer) {
+    ValidationStateTracker::PostCallRecordCmdEndRendering(commandBuffer);
+    RecordPendingPreDrawValidations(commandBuffer);
+}
+
+std::shared_ptr<const GpuAssistedBdaTable> GpuAssisted::GetBdaTable() {
+    std::lock_guard<std::mutex> guard(bda_table_lock);
+    if (bda_table && bda_table->Generation() == BufferAddressGeneration()) {
+        return bda_table;
+    }
+    bda_table = nullptr;
+    uint64_t generation = 0;
+    auto address_ranges = GetBufferAddressRanges(&generation);
+    if (address_ranges.empty()) {
+        return nullptr;
+    }
+
+    // Example BDA input buffer assuming 2 buffers using BDA:
+    // Word 0 | Index of start of buffer sizes (in this case 5)
+    // Word 1 | 0x0000000000000000
+    // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
+    // Word 3 | Device Address of second buffer
+    // Word 4 | 0xffffffffffffffff
+    // Word 5 | 0 (size of pretend buffer at word 1)
+    // Word 6 | Size in bytes of first buffer
+    // Word 7 | Size in bytes of second buffer
+    // Word 8 | 0 (size of pretend buffer in word 4)
+
+    uint32_t num_buffers = static_cast<uint32_t>(address_ranges.size());
+    uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
+    const VkDeviceSize input_size = words_needed * 8;  // 64 bit words
+    GpuAssistedChunkPool::Chunk chunk;
+    if (!input_chunk_pool.Acquire(input_size, &chunk)) {
+        ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
+        aborted = true;
+        return nullptr;
+    }
+    uint64_t *bda_data = reinterpret_cast<uint64_t *>(chunk.mapped);
+    uint32_t address_index = 1;
+    uint32_t size_index = 3 + num_buffers;
+    memset(bda_data, 0, static_cast<size_t>(input_size));
+    bda_data[0] = size_index;       // Start of buffer sizes
+    bda_data[address_index++] = 0;  // NULL address
+    bda_data[size_index++] = 0;
+
+    for (const auto &range : address_ranges) {
+        bda_data[address_index++] = range.begin;
+        bda_data[size_index++] = range.end - range.begin;
+    }
+    bda_data[address_index] = UINTPTR_MAX;
+    bda_data[size_index] = 0;
+
+    bda_table = std::make_shared<GpuAssistedBdaTable>(&input_chunk_pool, chunk, input_size, generation);
+    return bda_table;
+}
+
+bool GpuAssistedDescriptorInput::Matches(const LAST_BOUND_STATE::PerSets &per_set) const {
+    if (per_set.size() != sets_.size()) return false;
+    for (size_t i = 0; i < per_set.size(); ++i) {
+        // Sets freed and allocated again at the same address are new sets
+        if (sets_[i].set.lock() != per_set[i].bound_descriptor_set) return false;
+    }
+    return true;
+}
+
+bool GpuAssistedDescriptorInput::Expired() const {
+    for (const auto &set_span : sets_) {
+        if (!set_span.bound) continue;
+        const auto set = set_span.set.lock();
+        if (!set || set->Destroyed()) return true;
+    }
+    return false;
+}
+
+void GpuAssistedDescriptorInput::Refresh(GpuAssisted *gpuav) {
+    std::lock_guard<std::mutex> guard(lock_);
+    uint32_t *data = Data();
+    for (auto &set_span : sets_) {
+        const auto set = set_span.set.lock();
+        if (!set) continue;
+        const uint64_t change_count = set->GetChangeCount();
+        if (change_count == set_span.change_count) continue;
+        for (const auto &binding : set_span.bindings) {
+            const auto index_range = set->GetGlobalIndexRangeFromBinding(binding.binding, true);
+            for (uint32_t i = set->NextChangedDescriptor(index_range.start, index_range.end, set_span.change_count);
+                 i < index_range.end; i = set->NextChangedDescriptor(i + 1, index_range.end, set_span.change_count)) {
+                const auto *descriptor = set->GetDescriptorFromGlobalIndex(i);
+                const uint32_t written_index = binding.written_start + (i - index_range.start);
+                if (descriptor->updated) {
+                    gpuav->SetDescriptorInitialized(data, written_index, descriptor);
+                } else {
+                    data[written_index] = 0;
+                }
+            }
+        }
+        set_span.change_count = change_count;
+    }
+}
+
+static bool HasPushDescriptorSet(const LAST_BOUND_STATE::PerSets &per_set) {
+    for (const auto &s : per_set) {
+        if (s.bound_descriptor_set && s.bound_descriptor_set->IsPushDescriptor()) return true;
+    }
+    return false;
+}
+
+static std::vector<const cvdescriptorset::DescriptorSet *> DescriptorInputKey(const LAST_BOUND_STATE::PerSets &per_set) {
+    std::vector<const cvdescriptorset::DescriptorSet *> key;
+    key.reserve(per_set.size());
+    for (const auto &s : per_set) {
+        key.emplace_back(s.bound_descriptor_set.get());
+    }
+    return key;
+}
+
+// The cached descriptor indexing input of the sets bound, refreshed, or null if there is none yet
+std::shared_ptr<GpuAssistedDescriptorInput> GpuAssisted::FindDescriptorInput(const LAST_BOUND_STATE::PerSets &per_set) {
+    const auto key = DescriptorInputKey(per_set);
+    std::shared_ptr<GpuAssistedDescriptorInput> input;
+    {
+        std::lock_guard<std::mutex> guard(descriptor_inputs_lock);
+        auto it = descriptor_inputs.find(key);
+        if (it == descriptor_inputs.end()) return nullptr;
+        if (!it->second->Matches(per_set)) {
+            descriptor_inputs.erase(it);
+            return nullptr;
+        }
+        input = it->second;
+    }
+    input->Refresh(this);
+    return input;
+}
+
+void GpuAssisted::AddDescriptorInput(const LAST_BOUND_STATE::PerSets &per_set,
+                                     const std::shared_ptr<GpuAssistedDescriptorInput> &input) {
+    auto key = DescriptorInputKey(per_set);
+    std::lock_guard<std::mutex> guard(descriptor_inputs_lock);
+    // The inputs of sets still bound stay alive with the command buffers binding them
+    if (descriptor_inputs.size() >= kMaxDescriptorInputs) descriptor_inputs.clear();
+    descriptor_inputs[std::move(key)] = input;
+}
+
+void GpuAssisted::PruneDescriptorInputs() {
+    std::lock_guard<std::mutex> guard(descriptor_inputs_lock);
+    for (auto it = descriptor_inputs.begin(); it != descriptor_inputs.end();) {
+        if (it->second->Expired()) {
+            it = descriptor_inputs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point,
                                               CMD_TYPE cmd_type, const GpuAssistedCmdDrawIndirectState *cdi_state) {
     if (bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS && bind_point != VK_PIPELINE_BIND_POINT_COMPUTE &&
@@ -2051,6 +2968,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         aborted = true;
         return;
     }
+    if (!SelectPipelineVariant(cb_node.get(), bind_point, *pipeline_state)) return;
 
     std::vector<VkDescriptorSet> desc_sets;
     VkDescriptorPool desc_pool = VK_NULL_HANDLE;
@@ -2067,25 +2985,15 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
     // Allocate memory for the output block that the gpu will use to return any error information
     GpuAssistedDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    uint32_t *data_ptr;
+    if (!cb_node->output_blocks.Allocate(output_buffer_size, &output_block, reinterpret_cast<void **>(&data_ptr))) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
         aborted = true;
         return;
     }
 
     // Clear the output block to zeros so that only error information from the gpu will be present
-    uint32_t *data_ptr;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data_ptr));
-    if (result == VK_SUCCESS) {
-        memset(data_ptr, 0, output_buffer_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
+    memset(data_ptr, 0, output_buffer_size);
 
     GpuAssistedDeviceMemoryBlock di_input_block = {}, bda_input_block = {};
     VkDescriptorBufferInfo di_input_desc_buffer_info = {};
@@ -2106,14 +3014,18 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
         assert(bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS);
         assert(cdi_state != NULL);
-        VkPipeline validation_pipeline;
-        AllocatePreDrawValidationResources(output_block, pre_draw_resources, state, &validation_pipeline, cdi_state);
+        // Batched validation runs after the render pass has ended, which a suspended render pass instance does not do in this
+        // command buffer
+        const auto *render_pass_state = cb_node->activeRenderPass.get();
+        const bool batched = batch_draw_indirect_validation && cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY &&
+                             (cb_node->GetQueueFlags() & VK_QUEUE_COMPUTE_BIT) && render_pass_state &&
+                             !(render_pass_state->use_dynamic_rendering &&
+                               (render_pass_state->dynamic_rendering_begin_rendering_info.flags & VK_RENDERING_SUSPENDING_BIT));
+        VkPipeline validation_pipeline = VK_NULL_HANDLE;
+        AllocatePreDrawValidationResources(output_block, pre_draw_resources, state, batched ? nullptr : &validation_pipeline,
+                                           cdi_state);
         if (aborted) return;
 
-        // Save current graphics pipeline state
-        GPUAV_RESTORABLE_PIPELINE_STATE restorable_state;
-        restorable_state.Create(cb_node.get(), VK_PIPELINE_BIND_POINT_GRAPHICS);
-
         // Save parameters for error message
         pre_draw_resources.buffer = cdi_state->buffer;
         pre_draw_resources.offset = cdi_state->offset;
@@ -2166,17 +3078,27 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
             pushConstants[3] = (cdi_state->stride / sizeof(uint32_t));
         }
 
-        // Insert diagnostic draw
-        DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
-        DispatchCmdPushConstants(cmd_buffer, pre_draw_validation_state.validation_pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
-                                 sizeof(pushConstants), pushConstants);
-        DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                      pre_draw_validation_state.validation_pipeline_layout, 0, 1, &pre_draw_resources.desc_set, 0,
-                                      nullptr);
-        DispatchCmdDraw(cmd_buffer, 3, 1, 0, 0);
-
-        // Restore the previous graphics pipeline state.
-        restorable_state.Restore(cmd_buffer);
+        if (batched) {
+            GpuAssistedPendingPreDrawValidation pending = {pre_draw_resources.desc_set, {}};
+            std::copy(std::begin(pushConstants), std::end(pushConstants), pending.push_constants);
+            cb_node->pending_pre_draw_validations.emplace_back(pending);
+        } else {
+            // Save current graphics pipeline state
+            GPUAV_RESTORABLE_PIPELINE_STATE restorable_state;
+            restorable_state.Create(cb_node.get(), VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+            // Insert diagnostic draw
+            DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
+            DispatchCmdPushConstants(cmd_buffer, pre_draw_validation_state.validation_pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT,
+                                     0, sizeof(pushConstants), pushConstants);
+            DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                          pre_draw_validation_state.validation_pipeline_layout, 0, 1, &pre_draw_resources.desc_set,
+                                          0, nullptr);
+            DispatchCmdDraw(cmd_buffer, 3, 1, 0, 0);
+
+            // Restore the previous graphics pipeline state.
+            restorable_state.Restore(cmd_buffer);
+        }
     }
 
     bool has_buffers = false;
@@ -2228,24 +3150,46 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
             } else {
                 words_needed = 1 + number_of_sets + binding_count + descriptor_count;
             }
-            alloc_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-            buffer_info.size = words_needed * 4;
-            result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &di_input_block.buffer, &di_input_block.allocation,
-                                     nullptr);
-            if (result != VK_SUCCESS) {
+            const VkDeviceSize input_size = words_needed * 4;
+            // Commands binding the same sets share their input, except for push descriptor sets which are written below for
+            // each command, with the update after bind descriptors not yet written checked again at submit time
+            const bool shared_input = !HasPushDescriptorSet(state.per_set);
+            std::shared_ptr<GpuAssistedDescriptorInput> descriptor_input;
+            if (shared_input) {
+                descriptor_input = FindDescriptorInput(state.per_set);
+            }
+            if (descriptor_input) {
+                // Already refreshed, nothing to write
+                data_ptr = nullptr;
+            } else if (shared_input) {
+                GpuAssistedChunkPool::Chunk chunk;
+                if (!input_chunk_pool.Acquire(input_size, &chunk)) {
+                    ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
+                    aborted = true;
+                    return;
+                }
+                descriptor_input = std::make_shared<GpuAssistedDescriptorInput>(&input_chunk_pool, chunk, input_size);
+                data_ptr = descriptor_input->Data();
+            } else if (!cb_node->input_blocks.Allocate(input_size, &di_input_block, reinterpret_cast<void **>(&data_ptr))) {
                 ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
                 aborted = true;
                 return;
             }
+            // Where the input written below records the bindings it refreshes, if it is shared
+            std::vector<GpuAssistedDescriptorInput::SetSpan> *set_spans =
+                (descriptor_input && data_ptr) ? &descriptor_input->Sets() : nullptr;
 
             // Populate input buffer first with the sizes of every descriptor in every set, then with whether
             // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
             // outline of the input buffer format
-            result = vmaMapMemory(vmaAllocator, di_input_block.allocation, reinterpret_cast<void **>(&data_ptr));
-            memset(data_ptr, 0, static_cast<size_t>(buffer_info.size));
+            if (data_ptr) {
+                memset(data_ptr, 0, static_cast<size_t>(input_size));
+            }
 
             // Descriptor indexing needs the number of descriptors at each binding.
-            if (descriptor_indexing) {
+            if (!data_ptr) {
+                // The shared input found is up to date
+            } else if (descriptor_indexing) {
                 // Pointer to a sets array that points into the sizes array
                 uint32_t *sets_to_sizes = data_ptr + 1;
                 // Pointer to the sizes array that contains the array size of the descriptor at each binding
@@ -2262,6 +3206,11 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
                 for (const auto &s : state.per_set) {
                     auto desc = s.bound_descriptor_set;
+                    if (set_spans) {
+                        GpuAssistedDescriptorInput::SetSpan set_span = {desc, desc != nullptr,
+                                                                        desc ? desc->GetChangeCount() : 0, {}};
+                        set_spans->push_back(std::move(set_span));
+                    }
                     if (desc && (desc->GetBindingCount() > 0)) {
                         auto layout = desc->GetLayout();
                         auto bindings = layout->GetSortedBindingSet();
@@ -2290,13 +3239,16 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                                 continue;
                             }
 
+                            if (set_spans) {
+                                set_spans->back().bindings.push_back({binding, written_index});
+                            }
                             auto index_range = desc->GetGlobalIndexRangeFromBinding(binding, true);
                             // For each array element in the binding, update the written array with whether it has been written
                             for (uint32_t i = index_range.start; i < index_range.end; ++i) {
                                 auto *descriptor = desc->GetDescriptorFromGlobalIndex(i);
                                 if (descriptor->updated) {
                                     SetDescriptorInitialized(data_ptr, written_index, descriptor);
-                                } else if (desc->IsUpdateAfterBind(binding)) {
+                                } else if (!set_spans && desc->IsUpdateAfterBind(binding)) {
                                     // If it hasn't been written now and it's update after bind, put it in a list to check at
                                     // QueueSubmit
                                     di_input_block.update_at_submit[written_index] = descriptor;
@@ -2328,6 +3280,11 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
                 for (const auto &s : state.per_set) {
                     auto desc = s.bound_descriptor_set;
+                    if (set_spans) {
+                        GpuAssistedDescriptorInput::SetSpan set_span = {desc, desc != nullptr,
+                                                                        desc ? desc->GetChangeCount() : 0, {}};
+                        set_spans->push_back(std::move(set_span));
+                    }
                     if (desc && (desc->GetBindingCount() > 0)) {
                         auto layout = desc->GetLayout();
                         auto bindings = layout->GetSortedBindingSet();
@@ -2343,6 +3300,9 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                                 continue;
                             }
 
+                            if (set_spans) {
+                                set_spans->back().bindings.push_back({binding, written_index});
+                            }
                             auto index_range = desc->GetGlobalIndexRangeFromBinding(binding, true);
 
                             // For each array element in the binding, update the written array with whether it has been written
@@ -2350,7 +3310,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                                 auto *descriptor = desc->GetDescriptorFromGlobalIndex(i);
                                 if (descriptor->updated) {
                                     SetDescriptorInitialized(data_ptr, written_index, descriptor);
-                                } else if (desc->IsUpdateAfterBind(binding)) {
+                                } else if (!set_spans && desc->IsUpdateAfterBind(binding)) {
                                     // If it hasn't been written now and it's update after bind, put it in a list to check at
                                     // QueueSubmit
                                     di_input_block.update_at_submit[written_index] = descriptor;
@@ -2366,11 +3326,21 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
                     }
                 }
             }
-            vmaUnmapMemory(vmaAllocator, di_input_block.allocation);
-
-            di_input_desc_buffer_info.range = (words_needed * 4);
-            di_input_desc_buffer_info.buffer = di_input_block.buffer;
-            di_input_desc_buffer_info.offset = 0;
+            if (descriptor_input) {
+                if (set_spans) {
+                    AddDescriptorInput(state.per_set, descriptor_input);
+                }
+                di_input_desc_buffer_info.range = descriptor_input->Size();
+                di_input_desc_buffer_info.buffer = descriptor_input->Buffer();
+                di_input_desc_buffer_info.offset = 0;
+                if (cb_node->descriptor_inputs.empty() || cb_node->descriptor_inputs.back() != descriptor_input) {
+                    cb_node->descriptor_inputs.push_back(descriptor_input);
+                }
+            } else {
+                di_input_desc_buffer_info.range = (words_needed * 4);
+                di_input_desc_buffer_info.buffer = di_input_block.buffer;
+                di_input_desc_buffer_info.offset = di_input_block.offset;
+            }
 
             desc_writes[1] = LvlInitStruct<VkWriteDescriptorSet>();
             desc_writes[1].dstBinding = 1;
@@ -2386,50 +3356,17 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
     if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
          IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
         shaderInt64 && enabled_features.core12.bufferDeviceAddress) {
-        auto address_ranges = GetBufferAddressRanges();
-        if (address_ranges.size() > 0) {
-            // Example BDA input buffer assuming 2 buffers using BDA:
-            // Word 0 | Index of start of buffer sizes (in this case 5)
-            // Word 1 | 0x0000000000000000
-            // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
-            // Word 3 | Device Address of second buffer
-            // Word 4 | 0xffffffffffffffff
-            // Word 5 | 0 (size of pretend buffer at word 1)
-            // Word 6 | Size in bytes of first buffer
-            // Word 7 | Size in bytes of second buffer
-            // Word 8 | 0 (size of pretend buffer in word 4)
-
-            uint32_t num_buffers = static_cast<uint32_t>(address_ranges.size());
-            uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
-            alloc_info.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-            buffer_info.size = words_needed * 8;  // 64 bit words
-            result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &bda_input_block.buffer, &bda_input_block.allocation,
-                                     nullptr);
-            if (result != VK_SUCCESS) {
-                ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
-                aborted = true;
-                return;
-            }
-            uint64_t *bda_data;
-            result = vmaMapMemory(vmaAllocator, bda_input_block.allocation, reinterpret_cast<void **>(&bda_data));
-            uint32_t address_index = 1;
-            uint32_t size_index = 3 + num_buffers;
-            memset(bda_data, 0, static_cast<size_t>(buffer_info.size));
-            bda_data[0] = size_index;       // Start of buffer sizes
-            bda_data[address_index++] = 0;  // NULL address
-            bda_data[size_index++] = 0;
-
-            for (const auto &range : address_ranges) {
-                bda_data[address_index++] = range.begin;
-                bda_data[size_index++] = range.end - range.begin;
-            }
-            bda_data[address_index] = UINTPTR_MAX;
-            bda_data[size_index] = 0;
-            vmaUnmapMemory(vmaAllocator, bda_input_block.allocation);
-
-            bda_input_desc_buffer_info.range = (words_needed * 8);
-            bda_input_desc_buffer_info.buffer = bda_input_block.buffer;
+        auto bda_table = GetBdaTable();
+        if (aborted) {
+            return;
+        }
+        if (bda_table) {
+            bda_input_desc_buffer_info.range = bda_table->Size();
+            bda_input_desc_buffer_info.buffer = bda_table->Buffer();
             bda_input_desc_buffer_info.offset = 0;
+            if (cb_node->bda_tables.empty() || cb_node->bda_tables.back() != bda_table) {
+                cb_node->bda_tables.emplace_back(std::move(bda_table));
+            }
 
             desc_writes[desc_count] = LvlInitStruct<VkWriteDescriptorSet>();
             desc_writes[desc_count].dstBinding = 2;
@@ -2443,7 +3380,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes[0] = LvlInitStruct<VkWriteDescriptorSet>();
     desc_writes[0].descriptorCount = 1;
@@ -2470,12 +3407,7 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         ReportSetupProblem(device, "Unable to find pipeline state");
         aborted = true;
     }
-    if (aborted) {
-        vmaDestroyBuffer(vmaAllocator, di_input_block.buffer, di_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, bda_input_block.buffer, bda_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
-        return;
-    }
+    // On abort the blocks go back to the pool with the rest of the command buffer's chunks when it is reset
 }
 
 std::shared_ptr<CMD_BUFFER_STATE> GpuAssisted::CreateCmdBufferState(VkCommandBuffer cb,
@@ -2486,11 +3418,13 @@ std::shared_ptr<CMD_BUFFER_STATE> GpuAssisted::CreateCmdBufferState(VkCommandBuf
 
 gpuav_state::CommandBuffer::CommandBuffer(GpuAssisted *ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo *pCreateInfo,
                                           const COMMAND_POOL_STATE *pool)
-    : CMD_BUFFER_STATE(ga, cb, pCreateInfo, pool) {}
+    : CMD_BUFFER_STATE(ga, cb, pCreateInfo, pool), output_blocks(&ga->output_chunk_pool), input_blocks(&ga->input_chunk_pool) {}
 
 void gpuav_state::CommandBuffer::Reset() {
-    CMD_BUFFER_STATE::Reset();
     auto gpuav = static_cast<GpuAssisted *>(dev_data);
+    // Read any output not read yet before the buffers holding it go away
+    UtilWaitForReadbacks(gpuav, this);
+    CMD_BUFFER_STATE::Reset();
     // Free the device memory and descriptor set(s) associated with a command buffer.
     if (gpuav->aborted) {
         return;
@@ -2504,4 +3438,16 @@ void gpuav_state::CommandBuffer::Reset() {
         gpuav->DestroyBuffer(as_validation_buffer_info);
     }
     as_validation_buffers.clear();
+    for (const auto &desc_set : error_summary_desc_sets) {
+        gpuav->desc_set_manager->PutBackDescriptorSet(desc_set.first, desc_set.second);
+    }
+    error_summary_desc_sets.clear();
+    pending_pre_draw_validations.clear();
+    error_summary = nullptr;
+    error_summary_capacity = 0;
+    output_blocks.Reset();
+    input_blocks.Reset();
+    bda_tables.clear();
+    descriptor_inputs.clear();
+    bound_original_variant.fill(false);
 }
@@ -29,9 +29,143 @@ class GpuAssisted;
 struct GpuAssistedDeviceMemoryBlock {
     VkBuffer buffer;
     VmaAllocation allocation;
+    // Blocks are suballocated, this is where the block starts in buffer
+    VkDeviceSize offset;
     layer_data::unordered_map<uint32_t, const cvdescriptorset::Descriptor*> update_at_submit;
 };
 
+// Persistently mapped buffers that the output and input blocks of instrumented commands are suballocated from. Command
+// buffers take chunks from the pool as they record and give them back when reset, so once the pool has warmed up recording an
+// instrumented command allocates no memory at all.
+//
+// Chunks are allocated from a VMA pool of their own, kChunksPerBlock to a VkDeviceMemory block, so that the chunks of each
+// class of buffer sit together in memory of the type that suits it instead of being spread among the other allocations.
+class GpuAssistedChunkPool {
+  public:
+    struct Chunk {
+        VkBuffer buffer;
+        VmaAllocation allocation;
+        uint8_t* mapped;
+        VkDeviceSize size;
+    };
+    static const VkDeviceSize kChunkSize = 256 * 1024;
+    static const VkDeviceSize kChunksPerBlock = 16;
+
+    // Chunks come from memory of memory_type_index, which must be host visible and coherent. counter tracks the memory held.
+    bool Init(VmaAllocator allocator, uint32_t memory_type_index, VkDeviceSize alignment, StateMemoryCounter* counter);
+    // A chunk of at least size bytes. Chunks needed to be larger than kChunkSize are freed instead of pooled on release.
+    bool Acquire(VkDeviceSize size, Chunk* chunk);
+    void Release(std::vector<Chunk>& chunks);
+    void Destroy();
+    VkDeviceSize Alignment() const { return alignment_; }
+
+  private:
+    void Free(const Chunk& chunk);
+
+    VmaAllocator allocator_ = VK_NULL_HANDLE;
+    VmaPool vma_pool_ = VK_NULL_HANDLE;
+    uint32_t memory_type_index_ = 0;
+    StateMemoryCounter* counter_ = nullptr;
+    VkDeviceSize alignment_ = 4;
+    std::mutex lock_;
+    std::vector<Chunk> free_chunks_;
+};
+
+// Bump allocation of blocks from the chunks held by a command buffer. Recording is externally synchronized, so only taking a
+// chunk from the pool locks.
+class GpuAssistedBlockAllocator {
+  public:
+    explicit GpuAssistedBlockAllocator(GpuAssistedChunkPool* pool) : pool_(pool) {}
+    // Sets block to size bytes of a chunk and mapped to their host address, false if no memory could be had
+    bool Allocate(VkDeviceSize size, GpuAssistedDeviceMemoryBlock* block, void** mapped);
+    void Reset();
+
+  private:
+    GpuAssistedChunkPool* pool_;
+    std::vector<GpuAssistedChunkPool::Chunk> chunks_;
+    // Bytes used in the last chunk
+    VkDeviceSize used_ = 0;
+};
+
+// The buffer device address input of the instrumented shaders, the addresses and sizes of all the buffers with a device
+// address. It is built when an instrumented command is recorded after the buffer address map changed and is read by every
+// instrumented command recorded until the next change; the command buffers that bind it keep it until they are reset.
+class GpuAssistedBdaTable {
+  public:
+    GpuAssistedBdaTable(GpuAssistedChunkPool* pool, const GpuAssistedChunkPool::Chunk& chunk, VkDeviceSize size,
+                        uint64_t generation)
+        : pool_(pool), chunk_(chunk), size_(size), generation_(generation) {}
+    ~GpuAssistedBdaTable() {
+        std::vector<GpuAssistedChunkPool::Chunk> chunks(1, chunk_);
+        pool_->Release(chunks);
+    }
+    GpuAssistedBdaTable(const GpuAssistedBdaTable&) = delete;
+    GpuAssistedBdaTable& operator=(const GpuAssistedBdaTable&) = delete;
+
+    VkBuffer Buffer() const { return chunk_.buffer; }
+    VkDeviceSize Size() const { return size_; }
+    // The ValidationStateTracker::BufferAddressGeneration() of the addresses in the table
+    uint64_t Generation() const { return generation_; }
+
+  private:
+    GpuAssistedChunkPool* pool_;
+    GpuAssistedChunkPool::Chunk chunk_;
+    VkDeviceSize size_;
+    uint64_t generation_;
+};
+
+// The descriptor indexing input of the instrumented shaders for one combination of bound descriptor sets, see
+// gpu_validation.md for its layout. Bindless sets can hold hundreds of thousands of descriptors, so instead of writing an input
+// for every instrumented command, GPU-AV keeps the input of each combination of sets it has seen, and the commands binding the
+// same sets bind the same buffer. The written state of the descriptors of each set is brought up to date from the descriptors
+// changed since (see DescriptorSet::NextChangedDescriptor()) when a command binding the input is recorded and when its
+// command buffer is submitted, which covers update after bind descriptors.
+class GpuAssistedDescriptorInput {
+  public:
+    // Where the written state of a binding's descriptors starts in the input
+    struct BindingSpan {
+        uint32_t binding;
+        uint32_t written_start;
+    };
+    struct SetSpan {
+        std::weak_ptr<cvdescriptorset::DescriptorSet> set;
+        // False for the sets not bound
+        bool bound;
+        // The change count of the set the written state reflects
+        uint64_t change_count;
+        std::vector<BindingSpan> bindings;
+    };
+
+    GpuAssistedDescriptorInput(GpuAssistedChunkPool* pool, const GpuAssistedChunkPool::Chunk& chunk, VkDeviceSize size)
+        : pool_(pool), chunk_(chunk), size_(size) {}
+    ~GpuAssistedDescriptorInput() {
+        std::vector<GpuAssistedChunkPool::Chunk> chunks(1, chunk_);
+        pool_->Release(chunks);
+    }
+    GpuAssistedDescriptorInput(const GpuAssistedDescriptorInput&) = delete;
+    GpuAssistedDescriptorInput& operator=(const GpuAssistedDescriptorInput&) = delete;
+
+    VkBuffer Buffer() const { return chunk_.buffer; }
+    VkDeviceSize Size() const { return size_; }
+    uint32_t* Data() const { return reinterpret_cast<uint32_t*>(chunk_.mapped); }
+    // Filled in while the input is written, in the order of the bound sets
+    std::vector<SetSpan>& Sets() { return sets_; }
+
+    // Whether the sets bound are the ones the input was written for
+    bool Matches(const LAST_BOUND_STATE::PerSets& per_set) const;
+    // Whether one of its sets was freed, in which case no command can bind the input anymore
+    bool Expired() const;
+    // Rewrites the written state of the descriptors changed since the last refresh
+    void Refresh(GpuAssisted* gpuav);
+
+  private:
+    GpuAssistedChunkPool* pool_;
+    GpuAssistedChunkPool::Chunk chunk_;
+    VkDeviceSize size_;
+    std::mutex lock_;
+    std::vector<SetSpan> sets_;
+};
+
 struct GpuAssistedPreDrawResources {
     VkDescriptorPool desc_pool;
     VkDescriptorSet desc_set;
@@ -67,7 +201,9 @@ struct GpuAssistedBufferInfo {
 struct GpuAssistedShaderTracker {
     VkPipeline pipeline;
     VkShaderModule shader_module;
-    std::vector<uint32_t> pgm;
+    // Shared with the SHADER_MODULE_STATE, see GetSharedSpirv()
+    std::shared_ptr<const std::vector<uint32_t>> pgm;
+    std::shared_ptr<const UtilShaderSourceIndex> source_index;
 };
 
 struct GpuVuid {
@@ -112,6 +248,23 @@ struct GpuAssistedPreDrawValidationState {
     VkPipelineLayout validation_pipeline_layout = VK_NULL_HANDLE;
     VkPipeline dyn_rendering_pipeline = VK_NULL_HANDLE;
     layer_data::unordered_map <VkRenderPass, VkPipeline> renderpass_to_pipeline;
+    // The same shader run as a compute shader, validating the indirect draws of a render pass once it has ended
+    VkPipelineLayout compute_pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline compute_pipeline = VK_NULL_HANDLE;
+};
+
+// An indirect draw whose pre-draw validation waits for the end of its render pass
+struct GpuAssistedPendingPreDrawValidation {
+    VkDescriptorSet desc_set;
+    uint32_t push_constants[4];
+};
+
+// The compaction of the output blocks written by a primary command buffer's instrumented commands, see
+// GpuAssisted::RecordErrorSummary()
+struct GpuAssistedErrorSummaryState {
+    bool initialized = false;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
 };
 
 struct GpuAssistedCmdDrawIndirectState {
@@ -128,6 +281,21 @@ class CommandBuffer : public CMD_BUFFER_STATE {
   public:
     std::vector<GpuAssistedBufferInfo> gpuav_buffer_list;
     std::vector<GpuAssistedAccelerationStructureBuildValidationBufferInfo> as_validation_buffers;
+    GpuAssistedBlockAllocator output_blocks;
+    GpuAssistedBlockAllocator input_blocks;
+    // The BDA tables bound by the instrumented commands recorded
+    std::vector<std::shared_ptr<const GpuAssistedBdaTable>> bda_tables;
+    // The shared descriptor indexing inputs bound by them, refreshed at submit time
+    std::vector<std::shared_ptr<GpuAssistedDescriptorInput>> descriptor_inputs;
+    // Set while the original variant of the pipeline bound at a bind point is bound in its place, see
+    // GpuAssisted::SelectPipelineVariant()
+    std::array<bool, BindPoint_Count> bound_original_variant{};
+    // The error count followed by the indices in gpuav_buffer_list of the output blocks written to, null if the command buffer
+    // records no compaction
+    uint32_t* error_summary = nullptr;
+    uint32_t error_summary_capacity = 0;
+    std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> error_summary_desc_sets;
+    std::vector<GpuAssistedPendingPreDrawValidation> pending_pre_draw_validations;
 
     CommandBuffer(GpuAssisted* ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
                   const COMMAND_POOL_STATE* pool);
@@ -138,9 +306,19 @@ class CommandBuffer : public CMD_BUFFER_STATE {
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, gpuav_state::CommandBuffer, CMD_BUFFER_STATE);
 
+// The uninstrumented twin of an instrumented graphics or compute pipeline, bound instead of it for the draws and dispatches
+// left out by the gpuav_sample_rate setting
+struct GpuAssistedPipelineVariant {
+    VkPipeline original = VK_NULL_HANDLE;
+    std::atomic<uint32_t> draw_count{0};
+};
+
 class GpuAssisted : public ValidationStateTracker {
   public:
-    GpuAssisted() { container_type = LayerObjectTypeGpuAssisted; }
+    GpuAssisted() {
+        container_type = LayerObjectTypeGpuAssisted;
+        retain_push_descriptor_writes = true;
+    }
 
     template <typename T>
     void ReportSetupProblem(T object, const char* const specific_message) const;
@@ -148,6 +326,7 @@ class GpuAssisted : public ValidationStateTracker {
     void PreCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
                                    const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, void* modified_create_info) override;
     void CreateDevice(const VkDeviceCreateInfo* pCreateInfo) override;
+    void GetValidationCounters(ValidationCounterList& counters) const override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
     void PostCallRecordBindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount,
                                                          const VkBindAccelerationStructureMemoryInfoNV* pBindInfos,
@@ -171,6 +350,17 @@ class GpuAssisted : public ValidationStateTracker {
                                    VkBuffer* pBuffer, void* cb_state_data) override;
     void CreateAccelerationStructureBuildValidationState();
     void DestroyAccelerationStructureBuildValidationState();
+    void CreateErrorSummaryState();
+    void DestroyErrorSummaryState();
+    void RecordErrorSummary(gpuav_state::CommandBuffer* cb_node);
+    bool ReadErrorSummary(gpuav_state::CommandBuffer* cb_node, std::vector<uint32_t>* written_blocks);
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) override;
+    void RecordPendingPreDrawValidations(VkCommandBuffer commandBuffer);
+    void PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) override;
+    void PostCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) override;
+    void PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) override;
+    void PostCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer) override;
+    void PostCallRecordCmdEndRendering(VkCommandBuffer commandBuffer) override;
     void PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo,
                                                       VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update,
                                                       VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
@@ -211,11 +401,27 @@ class GpuAssisted : public ValidationStateTracker {
                                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                     VkResult result, void* crtpl_state_data) override;
     void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) override;
+    template <typename CreateInfo, typename SafeCreateInfo>
+    void CreatePipelineVariants(VkPipelineCache pipelineCache, uint32_t count, const CreateInfo* pCreateInfos,
+                                const std::vector<SafeCreateInfo>& gpu_create_infos, const VkPipeline* pPipelines);
+    bool SelectPipelineVariant(gpuav_state::CommandBuffer* cb_node, VkPipelineBindPoint bind_point,
+                               const PIPELINE_STATE& pipeline_state);
+    void PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                      VkPipeline pipeline) override;
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) override;
-    bool InstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<uint32_t>& new_pgm, uint32_t* unique_shader_id);
+    // Everything the instrumentation of a module depends on besides its code
+    std::vector<uint32_t> InstrumentationOptions() const;
+    bool InstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<uint32_t>& new_pgm, uint32_t unique_shader_id);
+    void CreateInstrumentedPipelineCache();
+    void SaveInstrumentedPipelineCache();
+    // Has the pipelines of the call created down the chain with the layer's pipeline cache, and in parallel if they are many
+    template <typename CreateInfo, typename ApiState>
+    void SetupInstrumentedPipelineCreation(uint32_t count, const CreateInfo* pCreateInfos, ApiState* api_state) const;
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          void* csm_state_data) override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                          const VkAllocationCallbacks* pAllocator) override;
     void AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, GpuAssistedBufferInfo &buffer_info,
         uint32_t operation_index, uint32_t* const debug_output_buffer);
 
@@ -233,6 +439,12 @@ class GpuAssisted : public ValidationStateTracker {
                                        VkResult result) override;
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
                                     VkResult result) override;
+    void ProcessCommandBuffer(VkQueue queue, CMD_BUFFER_STATE* cb_node);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
                               uint32_t firstInstance) override;
     void PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
@@ -312,6 +524,13 @@ class GpuAssisted : public ValidationStateTracker {
                                                const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable,
                                                const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
                                                VkDeviceAddress indirectDeviceAddress) override;
+    // The BDA table of the current buffer addresses, built anew only if they changed since the last call. Null if no buffer
+    // has a device address or the table could not be allocated, and sets aborted in the latter case.
+    std::shared_ptr<const GpuAssistedBdaTable> GetBdaTable();
+    std::shared_ptr<GpuAssistedDescriptorInput> FindDescriptorInput(const LAST_BOUND_STATE::PerSets& per_set);
+    void AddDescriptorInput(const LAST_BOUND_STATE::PerSets& per_set,
+                            const std::shared_ptr<GpuAssistedDescriptorInput>& input);
+    void PruneDescriptorInputs();
     void AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point, CMD_TYPE cmd, const GpuAssistedCmdDrawIndirectState *cdic_state = nullptr);
     void AllocatePreDrawValidationResources(GpuAssistedDeviceMemoryBlock output_block, GpuAssistedPreDrawResources& resources,
                                             const LAST_BOUND_STATE& state, VkPipeline *pPipeline, const GpuAssistedCmdDrawIndirectState *cdic_state);
@@ -348,7 +567,6 @@ class GpuAssisted : public ValidationStateTracker {
   private:
     void PreRecordCommandBuffer(VkCommandBuffer command_buffer);
     bool CommandBufferNeedsProcessing(VkCommandBuffer command_buffer);
-    void ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
     VkPhysicalDeviceFeatures supported_features;
     VkBool32 shaderInt64;
@@ -356,8 +574,10 @@ class GpuAssisted : public ValidationStateTracker {
     uint32_t output_buffer_size;
     bool buffer_oob_enabled;
     bool validate_draw_indirect;
+    bool batch_draw_indirect_validation;
     GpuAssistedAccelerationStructureBuildValidationState acceleration_structure_validation_state;
     GpuAssistedPreDrawValidationState pre_draw_validation_state;
+    GpuAssistedErrorSummaryState error_summary_state;
 
   public:
     bool aborted = false;
@@ -370,5 +590,30 @@ class GpuAssisted : public ValidationStateTracker {
     layer_data::unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     VmaAllocator vmaAllocator = {};
+    // Read back by the host, and written by it
+    GpuAssistedChunkPool output_chunk_pool;
+    GpuAssistedChunkPool input_chunk_pool;
+    // The BDA table of the current buffer addresses, see GetBdaTable()
+    std::shared_ptr<const GpuAssistedBdaTable> bda_table;
+    std::mutex bda_table_lock;
+    // The descriptor indexing inputs of the combinations of descriptor sets bound by instrumented commands, see
+    // FindDescriptorInput(). Push descriptor sets change with every push and are never part of one.
+    static const size_t kMaxDescriptorInputs = 64;
+    std::map<std::vector<const cvdescriptorset::DescriptorSet*>, std::shared_ptr<GpuAssistedDescriptorInput>> descriptor_inputs;
+    std::mutex descriptor_inputs_lock;
     std::map<VkQueue, UtilQueueBarrierCommandInfo> queue_barrier_command_infos;
+    UtilAsyncReadbackState async_readback;
+    UtilInstrumentedShaderCache shader_cache;
+    // The pipelines with instrumented shaders, kept on disk along with the instrumented shader cache in a file for each set of
+    // instrumentation options, since the driver can't reuse the pipelines of the application's cache for them
+    VkPipelineCache instrumented_pipeline_cache = VK_NULL_HANDLE;
+    std::string instrumented_pipeline_cache_path;
+    // Calls creating at least this many pipelines create them in parallel when parallel_pipeline_validation is set
+    static const uint32_t kMinParallelPipelineCreates = 8;
+    UtilInstrumentedModules instrumented_modules;
+    UtilInstrumentationFilter instrumentation_filter;
+    // Only every sample_rate-th draw or dispatch of an instrumented graphics or compute pipeline runs instrumented
+    uint32_t sample_rate = 1;
+    std::mutex pipeline_variants_lock;
+    layer_data::unordered_map<VkPipeline, std::shared_ptr<GpuAssistedPipelineVariant>> pipeline_variants;
 };
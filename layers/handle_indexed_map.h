@@ -0,0 +1,281 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cast_utils.h"
+#include "vk_layer_utils.h"
+
+// Slots for the state objects of wrapped handles, indexed by the LockFreeHandleSlab slot each handle names.
+//
+// The ids handed out by LockFreeHandleSlab hold a slot index (plus one) in the low 32 bits and the slot generation in the high
+// 32 bits. A slab slot stands for one object at a time, whatever its type, so the vl_handle_indexed_maps of a state tracker
+// share one table of slots rather than each paging the whole id range, and each slot records the map its element belongs to.
+// A lookup is a page load and a compare against the full id and the map, with no hashing. Comparing the full id is the stale
+// handle check: an id whose object was destroyed carries an older generation than whatever now occupies the recycled slot.
+// Slots are guarded by a fixed set of locks picked by slot index.
+class HandleIndexedSlots {
+  public:
+    struct Slot {
+        uint64_t id = 0;
+        const void *map = nullptr;
+        std::shared_ptr<void> value;
+    };
+
+    HandleIndexedSlots() : pages_(new std::atomic<Slot *>[kMaxPages]) {
+        for (uint32_t p = 0; p < kMaxPages; ++p) {
+            pages_[p].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~HandleIndexedSlots() {
+        for (uint32_t p = 0; p < kMaxPages; ++p) {
+            delete[] pages_[p].load(std::memory_order_relaxed);
+        }
+    }
+    HandleIndexedSlots(const HandleIndexedSlots &) = delete;
+    HandleIndexedSlots &operator=(const HandleIndexedSlots &) = delete;
+
+    // Slab ids always have a non-zero low half, anything else is kept in the maps' hash maps
+    static bool SlotIndex(uint64_t id, uint32_t &index) {
+        const uint32_t encoded_index = static_cast<uint32_t>(id);
+        if (encoded_index == 0 || ((encoded_index - 1) >> kPageBits) >= kMaxPages) return false;
+        index = encoded_index - 1;
+        return true;
+    }
+
+    ReadWriteLock &SlotLock(uint32_t index) const { return locks_[index & (kLockCount - 1)].lock; }
+
+    const Slot *FindSlot(uint32_t index) const {
+        const Slot *page = pages_[index >> kPageBits].load(std::memory_order_acquire);
+        return page ? &page[index & (kPageSize - 1)] : nullptr;
+    }
+
+    Slot &AllocateSlot(uint32_t index) {
+        std::atomic<Slot *> &page_ptr = pages_[index >> kPageBits];
+        Slot *page = page_ptr.load(std::memory_order_acquire);
+        if (!page) {
+            std::lock_guard<std::mutex> guard(page_lock_);
+            page = page_ptr.load(std::memory_order_relaxed);
+            if (!page) {
+                page = new Slot[kPageSize];
+                page_ptr.store(page, std::memory_order_release);
+            }
+        }
+        return page[index & (kPageSize - 1)];
+    }
+
+    // Calls f for every slot of map, holding the slot's lock. Visits the slots of a page one lock at a time rather than
+    // locking once per slot.
+    template <typename Fn>
+    void ForEachSlot(const void *map, Fn f) const {
+        for (uint32_t p = 0; p < kMaxPages; ++p) {
+            Slot *page = pages_[p].load(std::memory_order_acquire);
+            if (!page) continue;
+            for (uint32_t l = 0; l < kLockCount; ++l) {
+                WriteLockGuard lock(locks_[l].lock);
+                for (uint32_t s = l; s < kPageSize; s += kLockCount) {
+                    if (page[s].id != 0 && page[s].map == map) f(page[s]);
+                }
+            }
+        }
+    }
+
+  private:
+    // Matches the id layout and capacity of LockFreeHandleSlab
+    static const uint32_t kPageBits = 12;
+    static const uint32_t kPageSize = 1u << kPageBits;
+    static const uint32_t kMaxPages = 1u << 14;
+    static const uint32_t kLockCount = 64;
+
+    struct SlotLockType {
+        ReadWriteLock lock;
+        // Keep adjacent slots, which are usually used together, from sharing lock cache lines
+        char padding[64];
+    };
+
+    std::unique_ptr<std::atomic<Slot *>[]> pages_;
+    std::mutex page_lock_;
+    mutable SlotLockType locks_[kLockCount];
+};
+
+// Concurrent map from wrapped handles to state objects which can index its storage directly by the handle.
+//
+// Once SetHandleIndexed() gives it the state tracker's HandleIndexedSlots, the map stores each element in the slot its handle
+// names. Handles that cannot be slab ids, and every handle while handle indexing is off, go to a regular
+// vl_concurrent_unordered_map, so the interface and behavior match it either way. T must be a std::shared_ptr.
+template <typename Key, typename T>
+class vl_handle_indexed_map {
+  public:
+    using HashMap = vl_concurrent_unordered_map<Key, T>;
+    using FindResult = typename HashMap::FindResult;
+    using Stats = typename HashMap::Stats;
+    using Slot = HandleIndexedSlots::Slot;
+
+    vl_handle_indexed_map() = default;
+    vl_handle_indexed_map(const vl_handle_indexed_map &) = delete;
+    vl_handle_indexed_map &operator=(const vl_handle_indexed_map &) = delete;
+
+    // Handle indexing can only be switched while the map is empty, and must only be enabled when every handle stored in it
+    // is a LockFreeHandleSlab id. Passing nullptr switches it off.
+    bool SetHandleIndexed(HandleIndexedSlots *slots) {
+        if (slots == slots_) return true;
+        if (!empty()) return false;
+        slots_ = slots;
+        return true;
+    }
+    bool IsHandleIndexed() const { return slots_ != nullptr; }
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        uint64_t id;
+        uint32_t index;
+        if (!SlotIndex(key, id, index)) {
+            hash_map_.insert_or_assign(key, std::forward<Args>(args)...);
+            return;
+        }
+        Slot &slot = slots_->AllocateSlot(index);
+        WriteLockGuard lock(slots_->SlotLock(index));
+        if (!Owns(slot)) {
+            // The slab only recycles a slot once the state of its previous object is erased
+            assert(slot.id == 0);
+            slot.map = this;
+            ++count_;
+        }
+        slot.id = id;
+        slot.value = T(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        uint64_t id;
+        uint32_t index;
+        if (!SlotIndex(key, id, index)) {
+            return hash_map_.insert(key, std::forward<Args>(args)...);
+        }
+        Slot &slot = slots_->AllocateSlot(index);
+        WriteLockGuard lock(slots_->SlotLock(index));
+        if (slot.id == id && slot.map == this) return false;
+        if (!Owns(slot)) {
+            assert(slot.id == 0);
+            slot.map = this;
+            ++count_;
+        }
+        slot.id = id;
+        slot.value = T(std::forward<Args>(args)...);
+        return true;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) { return pop(key) != end() ? 1 : 0; }
+
+    bool contains(const Key &key) const {
+        uint64_t id;
+        uint32_t index;
+        if (!SlotIndex(key, id, index)) return hash_map_.contains(key);
+        const Slot *slot = slots_->FindSlot(index);
+        if (!slot) return false;
+        ReadLockGuard lock(slots_->SlotLock(index));
+        return slot->id == id && slot->map == this;
+    }
+
+    FindResult end() const { return hash_map_.end(); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(const Key &key) const {
+        uint64_t id;
+        uint32_t index;
+        if (!SlotIndex(key, id, index)) return hash_map_.find(key);
+        const Slot *slot = slots_->FindSlot(index);
+        if (!slot) return end();
+        ReadLockGuard lock(slots_->SlotLock(index));
+        return (slot->id == id && slot->map == this) ? FindResult(true, Value(*slot)) : end();
+    }
+
+    FindResult pop(const Key &key) {
+        uint64_t id;
+        uint32_t index;
+        if (!SlotIndex(key, id, index)) return hash_map_.pop(key);
+        Slot *slot = const_cast<Slot *>(slots_->FindSlot(index));
+        if (!slot) return end();
+        WriteLockGuard lock(slots_->SlotLock(index));
+        if (slot->id != id || slot->map != this) return end();
+        FindResult ret(true, Value(*slot));
+        Release(*slot);
+        return ret;
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret = hash_map_.snapshot(f);
+        if (slots_) {
+            slots_->ForEachSlot(this, [&ret, &f](const Slot &slot) {
+                T value = Value(slot);
+                if (!f || f(value)) {
+                    ret.emplace_back(CastFromUint64<Key>(slot.id), std::move(value));
+                }
+            });
+        }
+        return ret;
+    }
+
+    void clear() {
+        hash_map_.clear();
+        if (slots_) {
+            slots_->ForEachSlot(this, [this](Slot &slot) { Release(slot); });
+        }
+    }
+
+    size_t size() const { return hash_map_.size() + count_.load(std::memory_order_acquire); }
+
+    bool empty() const { return count_.load(std::memory_order_acquire) == 0 && hash_map_.empty(); }
+
+    // Statistics of the hash map fallback, with the size including elements stored by handle index
+    Stats stats() const {
+        Stats result = hash_map_.stats();
+        result.size += count_.load(std::memory_order_acquire);
+        return result;
+    }
+
+  private:
+    bool SlotIndex(const Key &key, uint64_t &id, uint32_t &index) const {
+        if (!slots_) return false;
+        id = CastToUint64(key);
+        return HandleIndexedSlots::SlotIndex(id, index);
+    }
+
+    bool Owns(const Slot &slot) const { return slot.id != 0 && slot.map == this; }
+
+    static T Value(const Slot &slot) { return std::static_pointer_cast<typename T::element_type>(slot.value); }
+
+    // Called with the slot's lock held
+    void Release(Slot &slot) {
+        slot.value.reset();
+        slot.id = 0;
+        slot.map = nullptr;
+        --count_;
+    }
+
+    HandleIndexedSlots *slots_ = nullptr;
+    std::atomic<size_t> count_{0};
+    HashMap hash_map_;
+};
@@ -0,0 +1,149 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "unique_id_mapping.h"
+
+// The validation objects that keep a record of each handle in the handle registry
+enum HandleRecordClient {
+    kHandleRecordObjectLifetimes,  // ObjTrackState of ObjectLifetimes::object_map
+    kHandleRecordThreadSafety,     // ObjectUseData of the ThreadSafety counters
+    kHandleRecordClientCount
+};
+
+// Registry of the records the validation objects of one instance or device keep for each of its wrapped handles.
+//
+// With the lock-free handle slab, the low half of every wrapped id names a LockFreeHandleSlab slot. The registry has one entry
+// per slot holding the id and a record pointer per client, so a client finds its record of a handle with a page load and a
+// compare against the full id, lock-free, instead of probing its own table. As in vl_handle_indexed_map, comparing the full id
+// is the stale handle check. The state tracker's maps are indexed by the same slots, see EnableHandleIndexedMaps().
+//
+// The clients' tables still own the records and stay the fallback: a client sets its pointer once it has inserted a record and
+// clears it before erasing the record. The registry only exists when handles are wrapped by the slab.
+class HandleRegistry {
+  public:
+    explicit HandleRegistry(const UniqueIdMapping &unique_ids)
+        : unique_ids_(unique_ids), pages_(new std::atomic<Entry *>[kMaxPages]) {
+        for (uint32_t p = 0; p < kMaxPages; ++p) {
+            pages_[p].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~HandleRegistry() {
+        for (uint32_t p = 0; p < kMaxPages; ++p) {
+            delete[] pages_[p].load(std::memory_order_relaxed);
+        }
+    }
+    HandleRegistry(const HandleRegistry &) = delete;
+    HandleRegistry &operator=(const HandleRegistry &) = delete;
+
+    // Does nothing for handles that are not ids of live slab slots, such as dispatchable handles
+    void Set(uint64_t id, HandleRecordClient client, void *record) {
+        uint32_t index;
+        if (!SlotIndex(id, index) || unique_ids_.find(id) == unique_ids_.end()) return;
+        Entry &entry = AllocateEntry(index);
+        std::lock_guard<std::mutex> guard(EntryLock(index));
+        if (entry.id.load(std::memory_order_relaxed) != id) {
+            // The records of the object that had the slot before are gone with it. Readers of its id must see the entry change
+            // before any of the new records.
+            entry.id.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (auto &entry_record : entry.records) {
+                entry_record.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        entry.records[client].store(record, std::memory_order_release);
+        entry.id.store(id, std::memory_order_release);
+    }
+
+    void Clear(uint64_t id, HandleRecordClient client) {
+        uint32_t index;
+        if (!SlotIndex(id, index)) return;
+        Entry *entry = const_cast<Entry *>(FindEntry(index));
+        if (!entry) return;
+        std::lock_guard<std::mutex> guard(EntryLock(index));
+        if (entry->id.load(std::memory_order_relaxed) == id) {
+            entry->records[client].store(nullptr, std::memory_order_release);
+        }
+    }
+
+    // The record set for id, or nullptr if there is none and the client should look in its table
+    template <typename T>
+    T *Find(uint64_t id, HandleRecordClient client) const {
+        uint32_t index;
+        if (!SlotIndex(id, index)) return nullptr;
+        const Entry *entry = FindEntry(index);
+        if (!entry || entry->id.load(std::memory_order_acquire) != id) return nullptr;
+        void *record = entry->records[client].load(std::memory_order_acquire);
+        // The entry may have been taken over by the next object of the slot meanwhile
+        if (entry->id.load(std::memory_order_relaxed) != id) return nullptr;
+        return static_cast<T *>(record);
+    }
+
+  private:
+    // Matches the id layout and capacity of LockFreeHandleSlab
+    static const uint32_t kPageBits = 12;
+    static const uint32_t kPageSize = 1u << kPageBits;
+    static const uint32_t kMaxPages = 1u << 14;
+    static const uint32_t kLockCount = 64;
+
+    struct Entry {
+        Entry() {
+            for (auto &record : records) {
+                record.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        std::atomic<uint64_t> id{0};
+        std::atomic<void *> records[kHandleRecordClientCount];
+    };
+
+    static bool SlotIndex(uint64_t id, uint32_t &index) {
+        const uint32_t encoded_index = static_cast<uint32_t>(id);
+        if (encoded_index == 0 || ((encoded_index - 1) >> kPageBits) >= kMaxPages) return false;
+        index = encoded_index - 1;
+        return true;
+    }
+
+    std::mutex &EntryLock(uint32_t index) const { return locks_[index & (kLockCount - 1)]; }
+
+    const Entry *FindEntry(uint32_t index) const {
+        const Entry *page = pages_[index >> kPageBits].load(std::memory_order_acquire);
+        return page ? &page[index & (kPageSize - 1)] : nullptr;
+    }
+
+    Entry &AllocateEntry(uint32_t index) {
+        std::atomic<Entry *> &page_ptr = pages_[index >> kPageBits];
+        Entry *page = page_ptr.load(std::memory_order_acquire);
+        if (!page) {
+            std::lock_guard<std::mutex> guard(page_lock_);
+            page = page_ptr.load(std::memory_order_relaxed);
+            if (!page) {
+                page = new Entry[kPageSize];
+                page_ptr.store(page, std::memory_order_release);
+            }
+        }
+        return page[index & (kPageSize - 1)];
+    }
+
+    const UniqueIdMapping &unique_ids_;
+    std::unique_ptr<std::atomic<Entry *>[]> pages_;
+    std::mutex page_lock_;
+    mutable std::mutex locks_[kLockCount];
+};
@@ -0,0 +1,371 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hook_timing.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "vk_layer_config.h"
+#include "vk_layer_data.h"
+
+std::atomic<bool> hook_timing_enabled{false};
+
+namespace {
+
+// Bucket i counts the hooks that took from 2^i up to 2^(i+1) ns, the last bucket everything longer
+const uint32_t kHistogramBuckets = 32;
+const char *const kHookPhases[] = {"PreCallValidate", "PreCallRecord", "PostCallRecord"};
+const uint32_t kHookPhaseCount = 3;
+
+struct HookStats {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    std::array<uint64_t, kHistogramBuckets> histogram{};
+
+    void Add(uint64_t ns) {
+        ++count;
+        total_ns += ns;
+        max_ns = std::max(max_ns, ns);
+        uint32_t bucket = 0;
+        while ((ns >>= 1) != 0 && bucket < kHistogramBuckets - 1) ++bucket;
+        ++histogram[bucket];
+    }
+
+    void Merge(const HookStats &other) {
+        count += other.count;
+        total_ns += other.total_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+        for (uint32_t i = 0; i < kHistogramBuckets; ++i) histogram[i] += other.histogram[i];
+    }
+};
+
+struct HookKey {
+    const char *hook;
+    LayerObjectTypeId object_type;
+
+    bool operator==(const HookKey &rhs) const { return hook == rhs.hook && object_type == rhs.object_type; }
+};
+
+struct HookKeyHash {
+    size_t operator()(const HookKey &key) const {
+        return std::hash<const void *>()(key.hook) ^ (static_cast<size_t>(key.object_type) * 0x9E3779B97F4A7C15ULL);
+    }
+};
+
+// Written by its thread only, the lock is there for the writes of the timing
+struct ThreadHookTimes {
+    uint32_t thread_index = 0;
+    std::mutex lock;
+    layer_data::unordered_map<HookKey, HookStats, HookKeyHash> stats;
+    layer_data::unordered_map<const char *, HookStats> checks;
+};
+
+// Leaked on purpose, threads may record hooks during static destruction
+struct HookTimingState {
+    std::mutex lock;
+    std::vector<std::unique_ptr<ThreadHookTimes>> threads;
+    std::string filename;
+    uint32_t present_interval = 0;
+    std::chrono::steady_clock::time_point start;
+    std::atomic<uint64_t> presents{0};
+    // Writers of the file one at a time, the file holds the latest timing
+    std::mutex write_lock;
+};
+
+HookTimingState &GetState() {
+    static auto *state = new HookTimingState;
+    return *state;
+}
+
+ThreadHookTimes &GetThreadTimes() {
+    thread_local ThreadHookTimes *times = nullptr;
+    if (!times) {
+        auto &state = GetState();
+        std::lock_guard<std::mutex> guard(state.lock);
+        state.threads.emplace_back(new ThreadHookTimes);
+        times = state.threads.back().get();
+        times->thread_index = static_cast<uint32_t>(state.threads.size());
+    }
+    return *times;
+}
+
+const char *ObjectName(LayerObjectTypeId object_type) {
+    switch (object_type) {
+        case LayerObjectTypeInstance:
+            return "Instance";
+        case LayerObjectTypeDevice:
+            return "Device";
+        case LayerObjectTypeThreading:
+            return "ThreadSafety";
+        case LayerObjectTypeParameterValidation:
+            return "StatelessValidation";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectLifetimes";
+        case LayerObjectTypeCoreValidation:
+            return "CoreChecks";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "GpuAssisted";
+        case LayerObjectTypeDebugPrintf:
+            return "DebugPrintf";
+        case LayerObjectTypeSyncValidation:
+            return "SyncValidator";
+        default:
+            return "Unknown";
+    }
+}
+
+// The timing of one hook of one validation object, over all threads and by thread
+struct PhaseTiming {
+    HookStats all;
+    std::map<uint32_t, HookStats> threads;
+};
+
+// Entry point -> validation object -> hook phase
+typedef std::map<std::string, std::map<LayerObjectTypeId, std::array<PhaseTiming, kHookPhaseCount>>> TimingTree;
+// By check name
+typedef std::map<std::string, PhaseTiming> CheckTiming;
+
+// Hook names say the entry point without its "vk" prefix after the phase, e.g. "PreCallValidateQueueSubmit"
+bool SplitHook(const char *hook, uint32_t *phase, std::string *entry_point) {
+    for (uint32_t i = 0; i < kHookPhaseCount; ++i) {
+        const size_t prefix_size = strlen(kHookPhases[i]);
+        if (strncmp(hook, kHookPhases[i], prefix_size) == 0) {
+            *phase = i;
+            *entry_point = std::string("vk") + (hook + prefix_size);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CollectTiming(TimingTree &tree, CheckTiming &checks) {
+    auto &state = GetState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    for (const auto &thread : state.threads) {
+        std::lock_guard<std::mutex> thread_guard(thread->lock);
+        for (const auto &entry : thread->stats) {
+            uint32_t phase = 0;
+            std::string entry_point;
+            if (!SplitHook(entry.first.hook, &phase, &entry_point)) continue;
+            auto &timing = tree[entry_point][entry.first.object_type][phase];
+            timing.all.Merge(entry.second);
+            timing.threads[thread->thread_index].Merge(entry.second);
+        }
+        for (const auto &entry : thread->checks) {
+            auto &timing = checks[entry.first];
+            timing.all.Merge(entry.second);
+            timing.threads[thread->thread_index].Merge(entry.second);
+        }
+    }
+}
+
+uint64_t TotalNs(const std::array<PhaseTiming, kHookPhaseCount> &phases) {
+    uint64_t total_ns = 0;
+    for (const auto &phase : phases) total_ns += phase.all.total_ns;
+    return total_ns;
+}
+
+void WriteJsonStats(FILE *file, const HookStats &stats) {
+    fprintf(file, "\"count\": %" PRIu64 ", \"total_ns\": %" PRIu64 ", \"max_ns\": %" PRIu64 ", \"histogram\": [", stats.count,
+            stats.total_ns, stats.max_ns);
+    for (uint32_t i = 0; i < kHistogramBuckets; ++i) fprintf(file, "%s%" PRIu64, i ? ", " : "", stats.histogram[i]);
+    fprintf(file, "]");
+}
+
+void WriteJsonThreads(FILE *file, const PhaseTiming &timing, const char *indent) {
+    fprintf(file, ", \"threads\": [");
+    bool first = true;
+    for (const auto &thread : timing.threads) {
+        fprintf(file, "%s\n%s{\"thread\": %u, ", first ? "" : ",", indent, thread.first);
+        first = false;
+        WriteJsonStats(file, thread.second);
+        fprintf(file, "}");
+    }
+    fprintf(file, "]");
+}
+
+void WriteJson(FILE *file, const TimingTree &tree, const CheckTiming &checks, int64_t elapsed_ns) {
+    // The totals by validation object come first, they say where to look
+    std::map<LayerObjectTypeId, HookStats> objects;
+    std::vector<std::pair<uint64_t, const TimingTree::value_type *>> entry_points;
+    for (const auto &entry_point : tree) {
+        uint64_t total_ns = 0;
+        for (const auto &object : entry_point.second) {
+            for (const auto &phase : object.second) objects[object.first].Merge(phase.all);
+            total_ns += TotalNs(object.second);
+        }
+        entry_points.emplace_back(total_ns, &entry_point);
+    }
+    std::stable_sort(entry_points.begin(), entry_points.end(),
+                     [](const std::pair<uint64_t, const TimingTree::value_type *> &lhs,
+                        const std::pair<uint64_t, const TimingTree::value_type *> &rhs) { return lhs.first > rhs.first; });
+
+    fprintf(file, "{\n  \"elapsed_ns\": %" PRId64 ",\n  \"histogram_buckets\": \"bucket i counts hooks of 2^i to 2^(i+1) ns\",\n",
+            elapsed_ns);
+    fprintf(file, "  \"objects\": [");
+    bool first = true;
+    for (const auto &object : objects) {
+        fprintf(file, "%s\n    {\"object\": \"%s\", \"count\": %" PRIu64 ", \"total_ns\": %" PRIu64 "}", first ? "" : ",",
+                ObjectName(object.first), object.second.count, object.second.total_ns);
+        first = false;
+    }
+    // Then the checks timed within the hooks, costliest first
+    std::vector<const CheckTiming::value_type *> sorted_checks;
+    for (const auto &check : checks) sorted_checks.push_back(&check);
+    std::stable_sort(sorted_checks.begin(), sorted_checks.end(),
+                     [](const CheckTiming::value_type *lhs, const CheckTiming::value_type *rhs) {
+                         return lhs->second.all.total_ns > rhs->second.all.total_ns;
+                     });
+    fprintf(file, "\n  ],\n  \"checks\": [");
+    first = true;
+    for (const auto *check : sorted_checks) {
+        fprintf(file, "%s\n    {\"check\": \"%s\", ", first ? "" : ",", check->first.c_str());
+        first = false;
+        WriteJsonStats(file, check->second.all);
+        WriteJsonThreads(file, check->second, "      ");
+        fprintf(file, "}");
+    }
+    fprintf(file, "\n  ],\n  \"entry_points\": [");
+    first = true;
+    for (const auto &entry_point : entry_points) {
+        fprintf(file, "%s\n    {\"entry_point\": \"%s\", \"total_ns\": %" PRIu64 ", \"objects\": [", first ? "" : ",",
+                entry_point.second->first.c_str(), entry_point.first);
+        first = false;
+        bool first_object = true;
+        for (const auto &object : entry_point.second->second) {
+            fprintf(file, "%s\n      {\"object\": \"%s\", \"total_ns\": %" PRIu64 ", \"hooks\": [", first_object ? "" : ",",
+                    ObjectName(object.first), TotalNs(object.second));
+            first_object = false;
+            bool first_phase = true;
+            for (uint32_t phase = 0; phase < kHookPhaseCount; ++phase) {
+                const auto &timing = object.second[phase];
+                if (timing.all.count == 0) continue;
+                fprintf(file, "%s\n        {\"hook\": \"%s\", ", first_phase ? "" : ",", kHookPhases[phase]);
+                first_phase = false;
+                WriteJsonStats(file, timing.all);
+                WriteJsonThreads(file, timing, "          ");
+                fprintf(file, "}");
+            }
+            fprintf(file, "]}");
+        }
+        fprintf(file, "]}");
+    }
+    fprintf(file, "\n  ]\n}\n");
+}
+
+void WriteCsvRow(FILE *file, const char *entry_point, const char *object, const char *hook, uint32_t thread,
+                 const HookStats &stats) {
+    fprintf(file, "%s,%s,%s,%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64, entry_point, object, hook, thread, stats.count, stats.total_ns,
+            stats.max_ns);
+    for (uint32_t i = 0; i < kHistogramBuckets; ++i) fprintf(file, ",%" PRIu64, stats.histogram[i]);
+    fprintf(file, "\n");
+}
+
+// One row per entry point, validation object, hook and thread, then one per check and thread with the check's name as the entry
+// point and "Check" as the hook
+void WriteCsv(FILE *file, const TimingTree &tree, const CheckTiming &checks) {
+    fprintf(file, "entry_point,object,hook,thread,count,total_ns,max_ns");
+    for (uint32_t i = 0; i < kHistogramBuckets; ++i) fprintf(file, ",bucket_%u", i);
+    fprintf(file, "\n");
+    for (const auto &entry_point : tree) {
+        for (const auto &object : entry_point.second) {
+            for (uint32_t phase = 0; phase < kHookPhaseCount; ++phase) {
+                for (const auto &thread : object.second[phase].threads) {
+                    WriteCsvRow(file, entry_point.first.c_str(), ObjectName(object.first), kHookPhases[phase], thread.first,
+                                thread.second);
+                }
+            }
+        }
+    }
+    for (const auto &check : checks) {
+        for (const auto &thread : check.second.threads) {
+            WriteCsvRow(file, check.first.c_str(), "CoreChecks", "Check", thread.first, thread.second);
+        }
+    }
+}
+
+}  // namespace
+
+void EnableHookTiming(uint32_t present_interval) {
+    auto &state = GetState();
+    {
+        std::lock_guard<std::mutex> guard(state.lock);
+        if (hook_timing_enabled.load()) return;
+        const char *filename = getLayerOption("khronos_validation.hook_timing_filename");
+        state.filename = (filename && *filename) ? filename : "vk_hook_timing.json";
+        state.present_interval = present_interval;
+        state.start = std::chrono::steady_clock::now();
+    }
+    hook_timing_enabled.store(true);
+}
+
+void RecordHookTime(const char *hook, LayerObjectTypeId object_type, int64_t start_ns, int64_t end_ns) {
+    if (layer_trace_enabled.load(std::memory_order_relaxed)) AddTraceEvent(ObjectName(object_type), hook, start_ns, end_ns);
+    if (!hook_timing_enabled.load(std::memory_order_relaxed)) return;
+    auto &times = GetThreadTimes();
+    std::lock_guard<std::mutex> guard(times.lock);
+    times.stats[HookKey{hook, object_type}].Add(static_cast<uint64_t>(std::max(end_ns - start_ns, int64_t(0))));
+}
+
+void RecordCheckTime(const char *check, int64_t start_ns, int64_t end_ns) {
+    if (layer_trace_enabled.load(std::memory_order_relaxed)) AddTraceEvent("Check", check, start_ns, end_ns);
+    if (!hook_timing_enabled.load(std::memory_order_relaxed)) return;
+    auto &times = GetThreadTimes();
+    std::lock_guard<std::mutex> guard(times.lock);
+    times.checks[check].Add(static_cast<uint64_t>(std::max(end_ns - start_ns, int64_t(0))));
+}
+
+void WriteHookTiming() {
+    if (!hook_timing_enabled.load()) return;
+    auto &state = GetState();
+    TimingTree tree;
+    CheckTiming checks;
+    CollectTiming(tree, checks);
+    const int64_t elapsed_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - state.start).count();
+
+    std::lock_guard<std::mutex> guard(state.write_lock);
+    FILE *file = fopen(state.filename.c_str(), "w");
+    if (!file) return;
+    const std::string &filename = state.filename;
+    const bool csv = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".csv") == 0;
+    if (csv) {
+        WriteCsv(file, tree, checks);
+    } else {
+        WriteJson(file, tree, checks, elapsed_ns);
+    }
+    fclose(file);
+}
+
+void HookTimingFramePresented() {
+    if (!hook_timing_enabled.load(std::memory_order_relaxed)) return;
+    auto &state = GetState();
+    const uint64_t presents = state.presents.fetch_add(1) + 1;
+    if (state.present_interval != 0 && presents % state.present_interval == 0) WriteHookTiming();
+}
@@ -0,0 +1,91 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "chassis.h"
+#include "layer_trace.h"
+
+// Time spent by each validation object in the PreCallValidate, PreCallRecord and PostCallRecord hooks of each entry point,
+// collected when khronos_validation.hook_timing is set.
+//
+// Every thread adds to histograms of its own, so timing a hook only takes the thread's uncontended lock. The histograms of all
+// threads are written to khronos_validation.hook_timing_filename, as JSON or, if the name ends in ".csv", as CSV, at each
+// vkDestroyDevice and every khronos_validation.hook_timing_interval presents. Each write holds everything since timing started.
+// The time of a hook includes the wait for the validation object's lock. With khronos_validation.layer_trace, each hook is also
+// added to the trace, with the validation object as its category.
+//
+// Within the hooks, the costlier CoreChecks helpers are timed by CheckTimer under the helper's name, written as the "checks" of
+// the same file and added to the trace with the "Check" category. The time of a check includes that of the checks it calls.
+
+extern std::atomic<bool> hook_timing_enabled;
+
+// Starts timing, once per process. A present_interval of 0 writes the timing at vkDestroyDevice only.
+void EnableHookTiming(uint32_t present_interval);
+// hook is a string literal, the name of the hook, e.g. "PreCallValidateQueueSubmit"
+void RecordHookTime(const char *hook, LayerObjectTypeId object_type, int64_t start_ns, int64_t end_ns);
+// check is a string literal, the name of the check
+void RecordCheckTime(const char *check, int64_t start_ns, int64_t end_ns);
+void WriteHookTiming();
+// Counts frames for khronos_validation.hook_timing_interval
+void HookTimingFramePresented();
+// Name of the validation object in timings, traces and counters
+const char *ObjectName(LayerObjectTypeId object_type);
+
+// Times one validation object's hook from its construction to the end of its scope
+class HookTimer {
+  public:
+    HookTimer(const char *hook, LayerObjectTypeId object_type)
+        : hook_((hook_timing_enabled.load(std::memory_order_relaxed) || layer_trace_enabled.load(std::memory_order_relaxed))
+                    ? hook
+                    : nullptr),
+          object_type_(object_type) {
+        if (hook_) start_ns_ = LayerTraceNow();
+    }
+    ~HookTimer() {
+        if (hook_) RecordHookTime(hook_, object_type_, start_ns_, LayerTraceNow());
+    }
+    HookTimer(const HookTimer &) = delete;
+    HookTimer &operator=(const HookTimer &) = delete;
+
+  private:
+    const char *hook_;
+    LayerObjectTypeId object_type_;
+    int64_t start_ns_ = 0;
+};
+
+// Times a check from its construction to the end of its scope
+class CheckTimer {
+  public:
+    explicit CheckTimer(const char *check)
+        : check_((hook_timing_enabled.load(std::memory_order_relaxed) || layer_trace_enabled.load(std::memory_order_relaxed))
+                     ? check
+                     : nullptr) {
+        if (check_) start_ns_ = LayerTraceNow();
+    }
+    ~CheckTimer() {
+        if (check_) RecordCheckTime(check_, start_ns_, LayerTraceNow());
+    }
+    CheckTimer(const CheckTimer &) = delete;
+    CheckTimer &operator=(const CheckTimer &) = delete;
+
+  private:
+    const char *check_;
+    int64_t start_ns_ = 0;
+};
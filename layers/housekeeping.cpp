@@ -0,0 +1,57 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "housekeeping.h"
+
+#include "layer_trace.h"
+
+void HousekeepingScheduler::SetLimits(uint32_t budget_us, uint32_t submit_interval) {
+    budget_us_ = budget_us ? budget_us : kDefaultBudgetUs;
+    submit_interval_ = submit_interval ? submit_interval : kDefaultSubmitInterval;
+}
+
+void HousekeepingScheduler::Register(const char *name, Task &&task) { tasks_.emplace_back(Entry{name, std::move(task)}); }
+
+void HousekeepingScheduler::Presented() {
+    presented_.store(true, std::memory_order_relaxed);
+    RunTasks();
+}
+
+void HousekeepingScheduler::Submitted() {
+    // Once the application presents, the presents alone mark the frames
+    if (presented_.load(std::memory_order_relaxed)) return;
+    if (submits_.fetch_add(1, std::memory_order_relaxed) + 1 < submit_interval_) return;
+    submits_.store(0, std::memory_order_relaxed);
+    RunTasks();
+}
+
+void HousekeepingScheduler::RunTasks() {
+    if (tasks_.empty()) return;
+    std::unique_lock<std::mutex> lock(run_lock_, std::try_to_lock);
+    if (!lock.owns_lock()) return;
+
+    TraceScope trace("Housekeeping", "Frame");
+    const int64_t deadline_ns = LayerTraceNow() + static_cast<int64_t>(budget_us_) * 1000;
+    for (size_t run = 0; run < tasks_.size(); ++run) {
+        const Entry &entry = tasks_[next_task_];
+        next_task_ = (next_task_ + 1) % tasks_.size();
+        {
+            TraceScope task_trace("Housekeeping", entry.name);
+            entry.task();
+        }
+        if (LayerTraceNow() >= deadline_ns) break;
+    }
+}
@@ -0,0 +1,64 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Runs the maintenance tasks of a validation object, such as pruning caches of destroyed state, once per frame rather than in
+// the calls that grow what they maintain.
+//
+// A frame ends at each vkQueuePresentKHR, or, for applications that never present, every submit_interval queue submissions.
+// Each frame boundary runs tasks in registration order until budget_us microseconds have passed, always at least one, and the
+// next boundary continues with the task after the last one run, so every task runs within a few frames however small the
+// budget. Boundaries reached while another thread is running tasks are skipped. Tasks take the locks of the state they
+// maintain themselves.
+class HousekeepingScheduler {
+  public:
+    using Task = std::function<void()>;
+
+    static const uint32_t kDefaultBudgetUs = 500;
+    static const uint32_t kDefaultSubmitInterval = 64;
+
+    // 0 uses the default of each
+    void SetLimits(uint32_t budget_us, uint32_t submit_interval);
+    // name is a string literal, for the layer trace. Must not be called once frame boundaries are reached.
+    void Register(const char *name, Task &&task);
+
+    void Presented();
+    void Submitted();
+
+  private:
+    struct Entry {
+        const char *name;
+        Task task;
+    };
+    void RunTasks();
+
+    uint32_t budget_us_ = kDefaultBudgetUs;
+    uint32_t submit_interval_ = kDefaultSubmitInterval;
+    std::vector<Entry> tasks_;
+
+    std::atomic<bool> presented_{false};
+    std::atomic<uint32_t> submits_{0};
+
+    std::mutex run_lock_;
+    size_t next_task_ = 0;
+};
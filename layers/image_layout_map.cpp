@@ -27,55 +27,81 @@
 namespace image_layout_map {
 // Storage for the static state
 const ImageSubresourceLayoutMap::ConstIterator ImageSubresourceLayoutMap::end_iterator = ImageSubresourceLayoutMap::ConstIterator();
+std::mutex LayoutIdTable::lock_;
+std::atomic<uint32_t> LayoutIdTable::id_count_{LayoutIdTable::kMaxCoreLayout + 2};
+std::atomic<VkImageLayout> LayoutIdTable::extension_layouts_[LayoutIdTable::kMaxLayoutIds];
+
+LayoutId LayoutIdTable::EncodeExtensionLayout(VkImageLayout layout) {
+    // Ids are only ever appended, so a lookup needs no lock
+    uint32_t id_count = id_count_.load(std::memory_order_acquire);
+    for (uint32_t id = kMaxCoreLayout + 2; id < id_count; ++id) {
+        if (extension_layouts_[id].load(std::memory_order_relaxed) == layout) return static_cast<LayoutId>(id);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    // Another thread may have added it while we waited
+    const uint32_t locked_count = id_count_.load(std::memory_order_relaxed);
+    for (uint32_t id = id_count; id < locked_count; ++id) {
+        if (extension_layouts_[id].load(std::memory_order_relaxed) == layout) return static_cast<LayoutId>(id);
+    }
+    // There are far fewer VkImageLayout values than ids
+    assert(locked_count < kMaxLayoutIds);
+    if (locked_count >= kMaxLayoutIds) return kInvalidLayoutId;
+    extension_layouts_[locked_count].store(layout, std::memory_order_release);
+    id_count_.store(locked_count + 1, std::memory_order_release);
+    return static_cast<LayoutId>(locked_count);
+}
 
 using InitialLayoutStates = ImageSubresourceLayoutMap::InitialLayoutStates;
 using LayoutEntry = ImageSubresourceLayoutMap::LayoutEntry;
 
+// Infill and update operations setting the layout of a subresource range, see sparse_container::infill_update_range
 template <typename LayoutsMap>
-static bool UpdateLayoutStateImpl(LayoutsMap& layouts, InitialLayoutStates& initial_layout_states, const IndexRange& range,
-                                  LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state) {
-    using CachedLowerBound = typename sparse_container::cached_lower_bound_impl<LayoutsMap>;
-    CachedLowerBound pos(layouts, range.begin);
-    if (!range.includes(pos->index)) {
-        return false;
-    }
-    bool updated_current = false;
-    while (range.includes(pos->index)) {
-        if (!pos->valid) {
-            // Fill in the leading space (or in the case of pos at end the trailing space
-            const auto start = pos->index;
-            auto it = pos->lower_bound;
-            const auto limit = (it != layouts.end()) ? std::min(it->first.begin, range.end) : range.end;
-            if (new_entry.state == nullptr) {
-                // Allocate on demand...  initial_layout_states_ holds ownership, while
-                // each subresource has a non-owning copy of the plain pointer.
-                initial_layout_states.emplace_back(cb_state, view_state);
-                new_entry.state = &initial_layout_states.back();
-            }
-            auto insert_result = layouts.insert(it, std::make_pair(IndexRange(start, limit), new_entry));
-            pos.invalidate(insert_result, start);
-            pos.seek(limit);
-            updated_current = true;
+class UpdateLayoutStateOps {
+  public:
+    using Iterator = typename LayoutsMap::iterator;
+
+    UpdateLayoutStateOps(InitialLayoutStates& initial_layout_states, LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state,
+                         const IMAGE_VIEW_STATE* view_state, bool& updated_current)
+        : initial_layout_states_(initial_layout_states),
+          new_entry_(new_entry),
+          cb_state_(cb_state),
+          view_state_(view_state),
+          updated_current_(updated_current) {}
+
+    Iterator Infill(LayoutsMap* layouts, const Iterator& pos, const IndexRange& range) const {
+        if (new_entry_.state_index == LayoutEntry::kNoState) {
+            // Allocate on demand...  initial_layout_states_ holds ownership, while each subresource refers to it by index, which
+            // unlike a pointer stays valid as initial_layout_states_ grows.
+            initial_layout_states_.emplace_back(cb_state_, view_state_);
+            new_entry_.state_index = initial_layout_states_.size();
         }
-        // Note that after the "fill" operation pos may have become valid so we check again
-        if (pos->valid) {
-            auto intersected_range = pos->lower_bound->first & range;
-            if (!intersected_range.empty() && pos->lower_bound->second.CurrentWillChange(new_entry.current_layout)) {
-                LayoutEntry orig_entry = pos->lower_bound->second; //intentional copy
-                assert(orig_entry.state != nullptr);
-                updated_current |= orig_entry.Update(new_entry);
-                auto overwrite_result = layouts.overwrite_range(pos->lower_bound, std::make_pair(intersected_range, orig_entry));
-                // If we didn't cover the whole range, we'll need to go around again
-                pos.invalidate(overwrite_result, intersected_range.begin);
-                pos.seek(intersected_range.end);
-            } else {
-                // Point just past the end of this section,  if it's within the given range, it will get filled next iteration
-                // ++pos could move us past the end of range (which would exit the loop) so we don't use it.
-                pos.seek(pos->lower_bound->first.end);
-            }
+        updated_current_ = true;
+        return layouts->insert(pos, std::make_pair(range, new_entry_));
+    }
+
+    Iterator operator()(LayoutsMap* layouts, const Iterator& pos) const {
+        auto& entry = pos->second;
+        if (entry.CurrentWillChange(new_entry_.current_id)) {
+            assert(entry.state_index != LayoutEntry::kNoState);
+            updated_current_ |= entry.Update(new_entry_);
         }
+        return pos;
     }
 
+  private:
+    InitialLayoutStates& initial_layout_states_;
+    LayoutEntry& new_entry_;
+    const CMD_BUFFER_STATE& cb_state_;
+    const IMAGE_VIEW_STATE* view_state_;
+    bool& updated_current_;
+};
+
+template <typename LayoutsMap>
+static bool UpdateLayoutStateImpl(LayoutsMap& layouts, InitialLayoutStates& initial_layout_states, const IndexRange& range,
+                                  LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state) {
+    bool updated_current = false;
+    UpdateLayoutStateOps<LayoutsMap> ops(initial_layout_states, new_entry, cb_state, view_state, updated_current);
+    sparse_container::infill_update_range(layouts, range, ops);
     return updated_current;
 }
 
@@ -103,12 +129,13 @@ ImageSubresourceLayoutMap::ConstIterator ImageSubresourceLayoutMap::Begin(bool a
 
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
-static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
-                                          const CMD_BUFFER_STATE& cb_state, VkImageLayout layout, VkImageLayout expected_layout) {
+static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states,
+                                          const IndexRangeBuffer& ranges, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
+                                          VkImageLayout expected_layout) {
     bool updated = false;
     LayoutEntry entry(expected_layout, layout);
-    for (; range_gen->non_empty(); ++range_gen) {
-        updated |= UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, nullptr);
+    for (const auto& range : ranges) {
+        updated |= UpdateLayoutStateImpl(layouts, initial_layout_states, range, entry, cb_state, nullptr);
     }
     return updated;
 }
@@ -121,13 +148,18 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
-    RangeGenerator range_gen(encoder_, range);
+    if (IsWholeImage(range)) {
+        LayoutEntry entry(expected_layout, layout);
+        return UpdateWholeImage(cb_state, entry);
+    }
+    IndexRangeBuffer ranges;
+    encoder_.GenerateRanges(range, ranges);
     if (layouts_.SmallMode()) {
-        return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
+        return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, ranges, cb_state, layout,
                                              expected_layout);
     } else {
         assert(!layouts_.Tristate());
-        return SetSubresourceRangeLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
+        return SetSubresourceRangeLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, ranges, cb_state, layout,
                                              expected_layout);
     }
 }
@@ -135,11 +167,11 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states,
-                                                 RangeGenerator& range_gen, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
-                                                 const IMAGE_VIEW_STATE* view_state) {
+                                                 const IndexRangeBuffer& ranges, const CMD_BUFFER_STATE& cb_state,
+                                                 VkImageLayout layout, const IMAGE_VIEW_STATE* view_state) {
     LayoutEntry entry(layout);
-    for (; range_gen->non_empty(); ++range_gen) {
-        UpdateLayoutStateImpl(layouts, initial_layout_states, *range_gen, entry, cb_state, view_state);
+    for (const auto& range : ranges) {
+        UpdateLayoutStateImpl(layouts, initial_layout_states, range, entry, cb_state, view_state);
     }
 }
 
@@ -148,29 +180,55 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
-    RangeGenerator range_gen(encoder_, range);
+    if (IsWholeImage(range)) {
+        LayoutEntry entry(layout);
+        UpdateWholeImage(cb_state, entry);
+        return;
+    }
+    IndexRangeBuffer ranges;
+    encoder_.GenerateRanges(range, ranges);
     if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, ranges, cb_state, layout, nullptr);
     } else {
         assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, ranges, cb_state, layout, nullptr);
     }
 }
 
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE& view_state) {
-    RangeGenerator range_gen(view_state.range_generator);
+    const IndexRangeBuffer& ranges = view_state.subresource_ranges;
     if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
-                                             &view_state);
+        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, ranges, cb_state, layout, &view_state);
     } else {
         assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
-                                             &view_state);
+        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, ranges, cb_state, layout, &view_state);
     }
 }
 
+bool ImageSubresourceLayoutMap::IsWholeImage(const VkImageSubresourceRange& range) const {
+    const auto& full_range = encoder_.FullRange();
+    return range.aspectMask == full_range.aspectMask && range.baseMipLevel == 0 && range.levelCount == full_range.levelCount &&
+           range.baseArrayLayer == 0 && range.layerCount == full_range.layerCount;
+}
+
+bool ImageSubresourceLayoutMap::UpdateWholeImage(const CMD_BUFFER_STATE& cb_state, LayoutEntry& entry) {
+    const IndexRange whole_image(0, encoder_.SubresourceCount());
+    if (layouts_.SmallMode()) {
+        return UpdateLayoutStateImpl(layouts_.GetSmallMap(), initial_layout_states_, whole_image, entry, cb_state, nullptr);
+    } else {
+        assert(!layouts_.Tristate());
+        return UpdateLayoutStateImpl(layouts_.GetBigMap(), initial_layout_states_, whole_image, entry, cb_state, nullptr);
+    }
+}
+
+const ImageSubresourceLayoutMap::LayoutEntry* ImageSubresourceLayoutMap::GetUniformLayout() const {
+    if (layouts_.size() != 1) return nullptr;
+    const auto it = layouts_.begin();
+    return (it->first.begin == 0 && it->first.end == encoder_.SubresourceCount()) ? &it->second : nullptr;
+}
+
 // Saves an encode to fetch both in the same call
 const ImageSubresourceLayoutMap::LayoutEntry* ImageSubresourceLayoutMap::GetSubresourceLayouts(
     const VkImageSubresource& subresource) const {
@@ -184,8 +242,8 @@ const ImageSubresourceLayoutMap::LayoutEntry* ImageSubresourceLayoutMap::GetSubr
 
 const InitialLayoutState* ImageSubresourceLayoutMap::GetSubresourceInitialLayoutState(const IndexType index) const {
     const auto found = layouts_.find(index);
-    if (found != layouts_.end()) {
-        return found->second.state;
+    if (found != layouts_.end() && found->second.state_index != LayoutEntry::kNoState) {
+        return &initial_layout_states_[found->second.state_index - 1];
     }
     return nullptr;
 }
@@ -206,14 +264,17 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     assert(CompatibilityKey() == other.CompatibilityKey());
     if (CompatibilityKey() != other.CompatibilityKey()) return false;
 
-    // NOTE -- we are copying plain state pointers from 'other' which owns them in a vector.  This works because
-    //         currently this function is only used to import from secondary command buffers, destruction of which
-    //         invalidate the referencing primary command buffer, meaning that the dangling pointer will either be
-    //         cleaned up in invalidation, on not referenced by validation code.
-    return sparse_container::splice(layouts_, other.layouts_, LayoutEntry::Updater());
+    // The entries refer to the initial layout states of 'other' by index, so take copies of them and rebase the indices of
+    // the imported entries past the states this map already holds.
+    LayoutEntry::Updater updater;
+    updater.state_offset = initial_layout_states_.size();
+    for (const auto& state : other.initial_layout_states_) {
+        initial_layout_states_.emplace_back(state);
+    }
+    return sparse_container::splice(layouts_, other.layouts_, updater);
 }
 
-// This is the same constant value range, subreource position advance logic as ForRange above, but suitable for use with
+// The constant value range and subresource position advance logic of AnyInRange, but suitable for use with
 // an Increment operator.
 void ImageSubresourceLayoutMap::ConstIterator::UpdateRangeAndValue() {
     bool not_found = true;
@@ -238,9 +299,9 @@ void ImageSubresourceLayoutMap::ConstIterator::UpdateRangeAndValue() {
             // The generated range can validly traverse past the end of stored data
             if (!iter_->first.empty()) {
                 const LayoutEntry& entry = iter_->second;
-                pos_.current_layout = entry.current_layout;
+                pos_.current_layout = entry.CurrentLayout();
                 if (pos_.current_layout == kInvalidLayout || always_get_initial_) {
-                    pos_.initial_layout = entry.initial_layout;
+                    pos_.initial_layout = entry.InitialLayout();
                 }
 
                 // The constant value bound marks the end of contiguous (w.r.t. range_gen_) indices with the same value, allowing
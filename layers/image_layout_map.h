@@ -22,8 +22,10 @@
 #ifndef IMAGE_LAYOUT_MAP_H_
 #define IMAGE_LAYOUT_MAP_H_
 
-#include <functional>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "range_vector.h"
@@ -41,12 +43,43 @@ class IMAGE_VIEW_STATE;
 namespace image_layout_map {
 const static VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
 
+// Layouts are stored in the subresource layout maps as one byte ids. Only a handful of layouts are ever in use, so rather than
+// a hash the core layouts have fixed ids and extension layouts are given the next free id when first seen. The ids are shared
+// by all devices, as the VkImageLayout values are, and never change once given out.
+using LayoutId = uint8_t;
+class LayoutIdTable {
+  public:
+    static const LayoutId kInvalidLayoutId = 0;
+
+    static inline LayoutId Encode(VkImageLayout layout) {
+        if (layout == kInvalidLayout) return kInvalidLayoutId;
+        if (static_cast<uint32_t>(layout) <= kMaxCoreLayout) return static_cast<LayoutId>(layout + 1);
+        return EncodeExtensionLayout(layout);
+    }
+    static inline VkImageLayout Decode(LayoutId id) {
+        if (id == kInvalidLayoutId) return kInvalidLayout;
+        if (id <= kMaxCoreLayout + 1) return static_cast<VkImageLayout>(id - 1);
+        return extension_layouts_[id].load(std::memory_order_acquire);
+    }
+
+  private:
+    static const uint32_t kMaxCoreLayout = VK_IMAGE_LAYOUT_PREINITIALIZED;
+    static const uint32_t kMaxLayoutIds = 256;
+
+    static LayoutId EncodeExtensionLayout(VkImageLayout layout);
+
+    static std::mutex lock_;
+    static std::atomic<uint32_t> id_count_;
+    static std::atomic<VkImageLayout> extension_layouts_[kMaxLayoutIds];
+};
+
 // Common types for this namespace
 using IndexType = subresource_adapter::IndexType;
 using IndexRange = sparse_container::range<IndexType>;
 using Encoder = subresource_adapter::RangeEncoder;
 using NoSplit = sparse_container::insert_range_no_split_bounds;
 using RangeGenerator = subresource_adapter::RangeGenerator;
+using IndexRangeBuffer = subresource_adapter::IndexRangeBuffer;
 using SubresourceGenerator = subresource_adapter::SubresourceGenerator;
 using WritePolicy = subresource_adapter::WritePolicy;
 
@@ -60,8 +93,6 @@ struct InitialLayoutState {
 
 class ImageSubresourceLayoutMap {
   public:
-    typedef std::function<bool(const VkImageSubresource&, VkImageLayout, VkImageLayout)> Callback;
-
     struct SubresourceLayout {
         VkImageSubresource subresource;
         VkImageLayout current_layout;
@@ -74,41 +105,53 @@ class ImageSubresourceLayoutMap {
         SubresourceLayout() = default;
     };
 
+    // Packed into 8 bytes, as there is one per constant layout range of every image a command buffer uses
     struct LayoutEntry {
-        VkImageLayout initial_layout;
-        VkImageLayout current_layout;
-        InitialLayoutState* state;
+        static const uint32_t kNoState = 0;
 
-        LayoutEntry(VkImageLayout initial_ = kInvalidLayout, VkImageLayout current_ = kInvalidLayout,
-                    InitialLayoutState* s = nullptr)
-            : initial_layout(initial_), current_layout(current_), state(s) {}
+        LayoutId initial_id;
+        LayoutId current_id;
+        // One more than the index of the entry's InitialLayoutState in the map's initial_layout_states_, or kNoState
+        uint32_t state_index;
+
+        LayoutEntry(VkImageLayout initial_ = kInvalidLayout, VkImageLayout current_ = kInvalidLayout, uint32_t state_ = kNoState)
+            : initial_id(LayoutIdTable::Encode(initial_)), current_id(LayoutIdTable::Encode(current_)), state_index(state_) {}
+
+        VkImageLayout InitialLayout() const { return LayoutIdTable::Decode(initial_id); }
+        VkImageLayout CurrentLayout() const { return LayoutIdTable::Decode(current_id); }
 
         bool operator!=(const LayoutEntry& rhs) const {
-            return initial_layout != rhs.initial_layout || current_layout != rhs.current_layout || state != rhs.state;
+            return initial_id != rhs.initial_id || current_id != rhs.current_id || state_index != rhs.state_index;
         }
-        bool CurrentWillChange(VkImageLayout new_layout) const {
-            return new_layout != kInvalidLayout && current_layout != new_layout;
+        bool operator==(const LayoutEntry& rhs) const { return !(*this != rhs); }
+        bool CurrentWillChange(LayoutId new_id) const {
+            return new_id != LayoutIdTable::kInvalidLayoutId && current_id != new_id;
         }
-        bool Update(const LayoutEntry& src) {
+        bool Update(const LayoutEntry& src, uint32_t state_offset = 0) {
             bool updated_current = false;
             // current_layout can be updated repeatedly.
-            if (CurrentWillChange(src.current_layout)) {
-                current_layout = src.current_layout;
+            if (CurrentWillChange(src.current_id)) {
+                current_id = src.current_id;
                 updated_current = true;
             }
             // initial_layout and state cannot be updated once they have a valid value.
-            if (initial_layout == kInvalidLayout) {
-                initial_layout = src.initial_layout;
+            if (initial_id == LayoutIdTable::kInvalidLayoutId) {
+                initial_id = src.initial_id;
             }
-            if (state == nullptr) {
-                state = src.state;
+            if (state_index == kNoState && src.state_index != kNoState) {
+                state_index = src.state_index + state_offset;
             }
             return updated_current;
         }
-        // updater for splice()
+        // updater for splice(), state_offset rebases the state indices of an entry taken from another map
         struct Updater {
-            bool update(LayoutEntry& dst, const LayoutEntry& src) const { return dst.Update(src); }
-            layer_data::optional<LayoutEntry> insert(const LayoutEntry& src) const { return layer_data::optional<LayoutEntry>(layer_data::in_place, src); }
+            uint32_t state_offset = 0;
+            bool update(LayoutEntry& dst, const LayoutEntry& src) const { return dst.Update(src, state_offset); }
+            layer_data::optional<LayoutEntry> insert(const LayoutEntry& src) const {
+                layer_data::optional<LayoutEntry> result(layer_data::in_place, src);
+                if (src.state_index != kNoState) result->state_index += state_offset;
+                return result;
+            }
         };
     };
     using RangeMap = subresource_adapter::BothRangeMap<LayoutEntry, 16>;
@@ -159,6 +202,32 @@ class ImageSubresourceLayoutMap {
         return End();
     }
 
+    // Calls visitor(IndexType index, const LayoutEntry& entry) for each range of constant layout state within subres_range,
+    // in index order, where index is the first subresource of subres_range in the range. Subresources without layout state
+    // are skipped, and an image in a single layout state is visited once. Stops at, and returns true for, the first visitor
+    // returning true.
+    template <typename Visitor>
+    bool AnyInRange(const VkImageSubresourceRange& subres_range, Visitor&& visitor) const {
+        if (!InRange(subres_range)) return false;
+        const LayoutEntry* uniform = GetUniformLayout();
+        if (uniform) {
+            const VkImageAspectFlags first_aspect = subres_range.aspectMask & (~subres_range.aspectMask + 1u);
+            const VkImageSubresource first = {first_aspect, subres_range.baseMipLevel, subres_range.baseArrayLayer};
+            return visitor(encoder_.Encode(first), *uniform);
+        }
+        IndexRangeBuffer ranges;
+        encoder_.GenerateRanges(subres_range, ranges);
+        if (layouts_.SmallMode()) {
+            return AnyInRangesImpl(layouts_.GetSmallMap(), ranges, visitor);
+        }
+        assert(!layouts_.Tristate());
+        return AnyInRangesImpl(layouts_.GetBigMap(), ranges, visitor);
+    }
+    VkImageSubresource Decode(IndexType index) const {
+        const auto subres = encoder_.Decode(index);
+        return encoder_.MakeVkSubresource(subres);
+    }
+
     // Begin is a find of the full range with the default skip/ always get parameters
     ConstIterator Begin(bool always_get_initial = true) const;
     inline ConstIterator begin() const { return Begin(); }  // STL style, for range based loops and familiarity
@@ -177,27 +246,39 @@ class ImageSubresourceLayoutMap {
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
     const LayoutMap& GetLayoutMap() const { return layouts_; }
+    // The layout state shared by every subresource of an image used as a whole, nullptr unless a single entry covers the image
+    const LayoutEntry* GetUniformLayout() const;
+    // Merge neighboring subresource ranges left with the same layout state
+    void Consolidate() { layouts_.consolidate(); }
     ImageSubresourceLayoutMap(const IMAGE_STATE& image_state);
     ~ImageSubresourceLayoutMap() {}
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
 
   protected:
-    // This looks a bit ponderous but kAspectCount is a compile time constant
-    VkImageSubresource Decode(IndexType index) const {
-        const auto subres = encoder_.Decode(index);
-        return encoder_.MakeVkSubresource(subres);
-    }
-
     inline uint32_t LevelLimit(uint32_t level) const { return std::min(encoder_.Limits().mipLevel, level); }
     inline uint32_t LayerLimit(uint32_t layer) const { return std::min(encoder_.Limits().arrayLayer, layer); }
 
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
+    bool IsWholeImage(const VkImageSubresourceRange& range) const;
+    // Updates all subresources as one index range, without generating the ranges of the subresource range
+    bool UpdateWholeImage(const CMD_BUFFER_STATE& cb_state, LayoutEntry& entry);
 
     // This map *also* needs "write once" semantics
     using InitialLayoutStateMap = subresource_adapter::BothRangeMap<InitialLayoutState*, 16>;
 
   private:
+    // Unwraps the BothRangeMap for AnyInRange
+    template <typename Map, typename Visitor>
+    static bool AnyInRangesImpl(const Map& layouts, const IndexRangeBuffer& ranges, Visitor& visitor) {
+        for (const auto& range : ranges) {
+            for (auto pos = layouts.lower_bound(range); pos != layouts.end() && pos->first.begin < range.end; ++pos) {
+                if (visitor(std::max(pos->first.begin, range.begin), pos->second)) return true;
+            }
+        }
+        return false;
+    }
+
     const IMAGE_STATE& image_state_;
     const Encoder& encoder_;
     LayoutMap layouts_;
@@ -116,18 +116,18 @@ VkImageSubresourceRange NormalizeSubresourceRange(const VkImageCreateInfo &image
 }
 
 static VkExternalMemoryHandleTypeFlags GetExternalHandleType(const VkImageCreateInfo *pCreateInfo) {
-    const auto *external_memory_info = LvlFindInChain<VkExternalMemoryImageCreateInfo>(pCreateInfo->pNext);
+    const auto *external_memory_info = CallFindInChain<VkExternalMemoryImageCreateInfo>(pCreateInfo->pNext);
     return external_memory_info ? external_memory_info->handleTypes : 0;
 }
 
 static VkSwapchainKHR GetSwapchain(const VkImageCreateInfo *pCreateInfo) {
-    const auto *swapchain_info = LvlFindInChain<VkImageSwapchainCreateInfoKHR>(pCreateInfo->pNext);
+    const auto *swapchain_info = CallFindInChain<VkImageSwapchainCreateInfoKHR>(pCreateInfo->pNext);
     return swapchain_info ? swapchain_info->swapchain : VK_NULL_HANDLE;
 }
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 static uint64_t GetExternalFormat(const VkImageCreateInfo *info) {
-    const VkExternalFormatANDROID *ext_format_android = LvlFindInChain<VkExternalFormatANDROID>(info->pNext);
+    const VkExternalFormatANDROID *ext_format_android = CallFindInChain<VkExternalFormatANDROID>(info->pNext);
     return ext_format_android ? ext_format_android->externalFormat : 0;
 }
 #else
@@ -201,8 +201,8 @@ IMAGE_STATE::IMAGE_STATE(const ValidationStateTracker *dev_data, VkImage img, co
                          VkFormatFeatureFlags2KHR ff)
     : BINDABLE(img, kVulkanObjectTypeImage, (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0, GetExternalHandleType(pCreateInfo)),
-      safe_create_info(pCreateInfo),
-      createInfo(*safe_create_info.ptr()),
+      safe_create_info(GetSharedCreateInfo(pCreateInfo)),
+      createInfo(*safe_create_info->ptr()),
       shared_presentable(false),
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo)),
@@ -225,8 +225,8 @@ IMAGE_STATE::IMAGE_STATE(const ValidationStateTracker *dev_data, VkImage img, co
                          VkSwapchainKHR swapchain, uint32_t swapchain_index, VkFormatFeatureFlags2KHR ff)
     : BINDABLE(img, kVulkanObjectTypeImage, (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0, GetExternalHandleType(pCreateInfo)),
-      safe_create_info(pCreateInfo),
-      createInfo(*safe_create_info.ptr()),
+      safe_create_info(GetSharedCreateInfo(pCreateInfo)),
+      createInfo(*safe_create_info->ptr()),
       shared_presentable(false),
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo)),
@@ -244,8 +244,9 @@ IMAGE_STATE::IMAGE_STATE(const ValidationStateTracker *dev_data, VkImage img, co
       subresource_encoder(full_range),
       fragment_encoder(nullptr),
       store_device_as_workaround(dev_data->device) {  // TODO REMOVE WHEN encoder can be const
-    fragment_encoder =
-        std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*this));
+    if (dev_data->use_image_fragment_encoder) {
+        fragment_encoder = dev_data->GetImageRangeEncoder(*this);
+    }
 }
 
 void IMAGE_STATE::Destroy() {
@@ -321,19 +322,14 @@ void IMAGE_STATE::SetInitialLayoutMap() {
     if ((createInfo.flags & VK_IMAGE_CREATE_ALIAS_BIT) != 0) {
         const auto *binding = Binding();
         assert(binding);
-        // Look for another aliasing image and point at its layout state.
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
-        for (auto &entry : binding->mem_state->ObjectBindings()) {
-            if (entry.first.type == kVulkanObjectTypeImage) {
-                auto base_node = entry.second.lock();
-                if (base_node) {
-                    auto other_image = static_cast<IMAGE_STATE *>(base_node.get());
-                    if (other_image != this && other_image->IsCompatibleAliasing(this)) {
-                        layout_range_map = other_image->layout_range_map;
-                        break;
-                    }
+        // Look for another aliasing image and point at its layout state. Compatible aliases are bound at the same offset,
+        // so only the objects bound over it are looked at, not every object sub-allocated from the memory.
+        for (auto &base_node : binding->mem_state->bound_ranges.Overlapping(binding->offset, 1)) {
+            if (base_node->Type() == kVulkanObjectTypeImage) {
+                auto other_image = static_cast<IMAGE_STATE *>(base_node.get());
+                if (other_image != this && other_image->IsCompatibleAliasing(this)) {
+                    layout_range_map = other_image->layout_range_map;
+                    break;
                 }
             }
         }
@@ -364,7 +360,7 @@ void IMAGE_STATE::SetInitialLayoutMap() {
         for (; range_gen->non_empty(); ++range_gen) {
             new_map->insert(new_map->end(), std::make_pair(*range_gen, createInfo.initialLayout));
         }
-        layout_range_map = std::move(new_map);
+        layout_range_map = std::make_shared<GlobalImageLayoutState>(std::move(new_map));
     }
 }
 
@@ -423,27 +419,50 @@ VkExtent3D IMAGE_STATE::GetSubresourceExtent(const VkImageSubresourceLayers &sub
 }
 
 static VkSamplerYcbcrConversion GetSamplerConversion(const VkImageViewCreateInfo *ci) {
-    auto *conversion_info = LvlFindInChain<VkSamplerYcbcrConversionInfo>(ci->pNext);
+    auto *conversion_info = CallFindInChain<VkSamplerYcbcrConversionInfo>(ci->pNext);
     return conversion_info ? conversion_info->conversion : VK_NULL_HANDLE;
 }
 
 static VkImageUsageFlags GetInheritedUsage(const VkImageViewCreateInfo *ci, const IMAGE_STATE &image_state) {
-    auto usage_create_info = LvlFindInChain<VkImageViewUsageCreateInfo>(ci->pNext);
+    auto usage_create_info = CallFindInChain<VkImageViewUsageCreateInfo>(ci->pNext);
     return (usage_create_info) ? usage_create_info->usage : image_state.createInfo.usage;
 }
 
 static float GetImageViewMinLod(const VkImageViewCreateInfo* ci) {
-    auto image_view_min_lod = LvlFindInChain<VkImageViewMinLodCreateInfoEXT>(ci->pNext);
+    auto image_view_min_lod = CallFindInChain<VkImageViewMinLodCreateInfoEXT>(ci->pNext);
     return (image_view_min_lod) ? image_view_min_lod->minLod : 0.0f;
 }
 
+static image_layout_map::IndexRangeBuffer GetSubresourceRanges(const IMAGE_STATE &image_state,
+                                                               const VkImageSubresourceRange &range) {
+    image_layout_map::IndexRangeBuffer ranges;
+    image_state.subresource_encoder.GenerateRanges(range, ranges);
+    return ranges;
+}
+
+static std::vector<subresource_adapter::IndexRange> GetFragmentRanges(const IMAGE_STATE &image_state,
+                                                                      const VkImageSubresourceRange &range) {
+    std::vector<subresource_adapter::IndexRange> ranges;
+    if (!image_state.fragment_encoder) return ranges;
+    subresource_adapter::ImageRangeGenerator range_gen(*image_state.fragment_encoder, range, 0);
+    for (; range_gen->non_empty(); ++range_gen) {
+        if (ranges.size() == IMAGE_VIEW_STATE::kMaxFragmentRanges) {
+            ranges.clear();
+            break;
+        }
+        ranges.emplace_back(*range_gen);
+    }
+    return ranges;
+}
+
 IMAGE_VIEW_STATE::IMAGE_VIEW_STATE(const std::shared_ptr<IMAGE_STATE> &im, VkImageView iv, const VkImageViewCreateInfo *ci,
                                    VkFormatFeatureFlags2KHR ff, const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props)
     : BASE_NODE(iv, kVulkanObjectTypeImageView),
       safe_create_info(ci),
       create_info(*safe_create_info.ptr()),
       normalized_subresource_range(::NormalizeSubresourceRange(im->createInfo, *ci)),
-      range_generator(im->subresource_encoder, normalized_subresource_range),
+      subresource_ranges(GetSubresourceRanges(*im, normalized_subresource_range)),
+      fragment_ranges(GetFragmentRanges(*im, normalized_subresource_range)),
       samples(im->createInfo.samples),
       // When the image has a external format the views format must be VK_FORMAT_UNDEFINED and it is required to use a sampler
       // Ycbcr conversion. Thus we can't extract any meaningful information from the format parameter. As a Sampler Ycbcr
@@ -495,7 +514,7 @@ static safe_VkImageCreateInfo GetImageCreateInfo(const VkSwapchainCreateInfoKHR
     // Pull out the format list only. This stack variable will get copied onto the heap
     // by the 'safe' constructor used to build the return value below.
     VkImageFormatListCreateInfo fmt_info;
-    auto chain_fmt_info = LvlFindInChain<VkImageFormatListCreateInfo>(pCreateInfo->pNext);
+    auto chain_fmt_info = CallFindInChain<VkImageFormatListCreateInfo>(pCreateInfo->pNext);
     if (chain_fmt_info) {
         fmt_info = *chain_fmt_info;
         fmt_info.pNext = nullptr;
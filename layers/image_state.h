@@ -28,7 +28,9 @@
 #pragma once
 
 #include "device_memory_state.h"
+#include "create_info_cache.h"
 #include "image_layout_map.h"
+#include "low_memory_profile.h"
 #include "vk_format_utils.h"
 #include "vk_layer_utils.h"
 
@@ -68,12 +70,84 @@ static inline VkImageSubresourceRange RangeFromLayers(const VkImageSubresourceLa
 
 class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkImageLayout, 16> {
   public:
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
-    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
-    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index), limit_(index) {}
+    GlobalImageLayoutRangeMap(const GlobalImageLayoutRangeMap &other)
+        : BothRangeMap<VkImageLayout, 16>(other.limit_), limit_(other.limit_), consolidated_size_(other.consolidated_size_) {
+        for (const auto &entry : other) {
+            insert(end(), entry);
+        }
+    }
+    GlobalImageLayoutRangeMap &operator=(const GlobalImageLayoutRangeMap &) = delete;
+
+    // The layout of an image entirely in one layout, nullptr unless a single range covers the image
+    const VkImageLayout *GetUniformLayout() const {
+        if (size() != 1) return nullptr;
+        const auto it = begin();
+        return (it->first.begin == 0 && it->first.end == limit_) ? &it->second : nullptr;
+    }
+
+    // Merges neighboring ranges with the same layout once the map has doubled in size since it was last consolidated, so the
+    // cost stays proportional to the updates. The low memory profile merges them at every update.
+    void ConsolidateIfGrown() {
+        const size_t min_consolidate_size = kMinConsolidateSize;
+        const size_t unmerged_size = size();
+        const bool grown = unmerged_size >= std::max(min_consolidate_size, 2 * consolidated_size_);
+        if (!grown && !(LowMemoryProfile() && unmerged_size > consolidated_size_)) return;
+        consolidate();
+        consolidated_size_ = size();
+        // Only the big map allocates its ranges
+        if (!grown && !SmallMode()) {
+            AddLowMemorySaving(kLowMemorySavingLayoutRanges,
+                               (unmerged_size - consolidated_size_) * (sizeof(value_type) + 2 * sizeof(void *)));
+        }
+    }
+
+  private:
+    static const size_t kMinConsolidateSize = 16;
+
+    const index_type limit_;
+    size_t consolidated_size_ = 0;
+};
+
+// The layouts of an image as left by the submitted command buffers, shared by all images aliasing the same memory
+//
+// Validation works on a snapshot, an immutable version of the map it can compare against without holding any lock, and
+// queue submissions record their layout changes into a new version which is then published atomically. The current version
+// is only copied when some reader still holds it, otherwise it is updated in place. Updates to one image are serialized.
+class GlobalImageLayoutState {
+  public:
+    explicit GlobalImageLayoutState(std::shared_ptr<GlobalImageLayoutRangeMap> &&initial_map)
+        : current_(std::move(initial_map)) {}
+
+    std::shared_ptr<const GlobalImageLayoutRangeMap> Snapshot() const {
+        std::lock_guard<std::mutex> guard(current_lock_);
+        return current_;
+    }
+
+    // Calls fn(GlobalImageLayoutRangeMap &) on the version to publish
+    template <typename Fn>
+    void Update(const Fn &fn) {
+        std::lock_guard<std::mutex> update_guard(update_lock_);
+        std::unique_lock<std::mutex> current_guard(current_lock_);
+        if (current_.use_count() == 1) {
+            // No reader holds the current version, and none can take it until the lock is released. The fence orders the
+            // accesses of the readers that released it before the update.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            fn(*current_);
+            return;
+        }
+        current_guard.unlock();
+        // Only updates replace current_, so it can be read without current_lock_ while update_lock_ is held
+        auto next = std::make_shared<GlobalImageLayoutRangeMap>(*current_);
+        fn(*next);
+        current_guard.lock();
+        current_ = std::move(next);
+    }
 
   private:
-    mutable ReadWriteLock lock_;
+    mutable std::mutex current_lock_;
+    std::mutex update_lock_;
+    std::shared_ptr<GlobalImageLayoutRangeMap> current_;
 };
 
 // State for VkImage objects.
@@ -96,7 +170,8 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
 //
 class IMAGE_STATE : public BINDABLE {
   public:
-    const safe_VkImageCreateInfo safe_create_info;
+    // Shared with other images created with an identical create info, see GetSharedCreateInfo()
+    const std::shared_ptr<const safe_VkImageCreateInfo> safe_create_info;
     const VkImageCreateInfo &createInfo;
     bool shared_presentable;  // True for a front-buffered swapchain image
     bool layout_locked;       // A front-buffered image that has been presented can never have layout transitioned
@@ -119,10 +194,10 @@ class IMAGE_STATE : public BINDABLE {
     bool sparse_metadata_bound;           // Track if sparse metadata aspect is bound to this image
 
     const image_layout_map::Encoder subresource_encoder;                             // Subresource resolution encoder
-    std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
+    std::shared_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
-    std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
+    std::shared_ptr<GlobalImageLayoutState> layout_range_map;
 
     IMAGE_STATE(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo,
                 VkFormatFeatureFlags2KHR features);
@@ -212,7 +287,13 @@ class IMAGE_VIEW_STATE : public BASE_NODE {
     const safe_VkImageViewCreateInfo safe_create_info;
     const VkImageViewCreateInfo &create_info;
     const VkImageSubresourceRange normalized_subresource_range;
-    const image_layout_map::RangeGenerator range_generator;
+    // The subresource ranges of normalized_subresource_range, for layout tracking
+    const image_layout_map::IndexRangeBuffer subresource_ranges;
+    // The address ranges of normalized_subresource_range in the image's fragment_encoder, relative to the image base address, for
+    // the descriptor accesses of synchronization validation. Empty when the image has no fragment_encoder or the view more than
+    // kMaxFragmentRanges ranges, in which case the ranges are generated at each access.
+    static constexpr size_t kMaxFragmentRanges = 64;
+    const std::vector<subresource_adapter::IndexRange> fragment_ranges;
     const VkSampleCountFlagBits samples;
     const unsigned descriptor_format_bits;
     const VkSamplerYcbcrConversion samplerConversion;  // Handle of the ycbcr sampler conversion the image was created with, if any
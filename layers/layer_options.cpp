@@ -37,6 +37,21 @@ void SetValidationDisable(CHECK_DISABLED &disable_data, const ValidationCheckDis
         case VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION:
             disable_data[image_layout_validation] = true;
             break;
+        case VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION:
+            disable_data[descriptor_content_validation] = true;
+            break;
+        case VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION:
+            disable_data[submit_image_layout_validation] = true;
+            break;
+        case VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION:
+            disable_data[dynamic_state_validation] = true;
+            break;
+        case VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION:
+            disable_data[vertex_buffer_validation] = true;
+            break;
+        case VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION:
+            disable_data[render_pass_compatibility_validation] = true;
+            break;
         default:
             assert(true);
     }
@@ -252,7 +267,8 @@ void CreateFilterMessageIdList(std::string raw_id_list, std::string delimiter, s
     }
 }
 
-void SetCustomStypeInfo(std::string raw_id_list, std::string delimiter) {
+void SetCustomStypeInfo(std::string raw_id_list, std::string delimiter,
+                        std::vector<std::pair<uint32_t, uint32_t>> &stype_info = custom_stype_info) {
     size_t pos = 0;
     std::string token;
     // List format is a list of integer pairs
@@ -264,20 +280,20 @@ void SetCustomStypeInfo(std::string raw_id_list, std::string delimiter) {
         if ((stype_id != 0) && (struct_size_in_bytes != 0)) {
             bool found = false;
             // Prevent duplicate entries
-            for (const auto &item : custom_stype_info) {
+            for (const auto &item : stype_info) {
                 if (item.first == stype_id) {
                     found = true;
                     break;
                 }
             }
-            if (!found) custom_stype_info.push_back(std::make_pair(stype_id, struct_size_in_bytes));
+            if (!found) stype_info.push_back(std::make_pair(stype_id, struct_size_in_bytes));
         }
     }
 }
 
-uint32_t SetMessageDuplicateLimit(std::string &config_message_limit, std::string &env_message_limit) {
+uint32_t SetMessageDuplicateLimit(const std::string &config_message_limit, const std::string &env_message_limit) {
     uint32_t limit = 0;
-    auto get_num = [](std::string &source_string) {
+    auto get_num = [](const std::string &source_string) {
         uint32_t limit = 0;
         int radix = ((source_string.find("0x") == 0) ? 16 : 10);
         limit = static_cast<uint32_t>(std::strtoul(source_string.c_str(), nullptr, radix));
@@ -305,7 +321,7 @@ const VkLayerSettingsEXT *FindSettingsInChain(const void *next) {
     return found;
 }
 
-static bool SetBool(std::string &config_string, std::string &env_string, bool default_val) {
+static bool SetBool(const std::string &config_string, const std::string &env_string, bool default_val) {
     bool result = default_val;
 
     std::string setting;
@@ -325,6 +341,142 @@ static bool SetBool(std::string &config_string, std::string &env_string, bool de
     return result;
 }
 
+// The settings read from the layer settings file and from the environment, in the order of kLayerSettingSources
+enum LayerSettingIndex {
+    kEnables,
+    kDisables,
+    kMessageIdFilter,
+    kCustomStypeList,
+    kDuplicateMessageLimit,
+    kFineGrainedLocking,
+    kLockFreeHandleWrapping,
+    kDeferredCommandValidation,
+    kAsyncValidation,
+    kCommandBufferFingerprinting,
+    kMemoryReportInterval,
+    kParallelPipelineValidation,
+    kAsyncShaderValidation,
+    kSpecializationCacheSize,
+    kParallelDescriptorUpdateValidation,
+    kParallelSyncResolve,
+    kParallelSyncHazardDetection,
+    kParallelSubmitValidation,
+    kSyncvalMaxMemoryMb,
+    kAsyncMessageDelivery,
+    kHookTiming,
+    kHookTimingInterval,
+    kLayerTrace,
+    kThreadSafetySampling,
+    kStatelessCreateInfoMemo,
+    kAsyncSubmissionRetirement,
+    kThreadPoolSize,
+    kThreadPoolAffinityMask,
+    kThreadPoolPriority,
+    kHousekeepingBudgetUs,
+    kHousekeepingSubmitInterval,
+    kValidationWindow,
+    kValidationWindowStartFrame,
+    kValidationWindowFrameCount,
+    kValidationCounters,
+    kValidationCountersInterval,
+    kLowMemoryProfile,
+    kLayerSettingCount
+};
+
+struct LayerSettingSource {
+    // Appended to the layer description to give the key in the layer settings file
+    const char *key_suffix;
+    const char *env_var;
+};
+
+static const std::array<LayerSettingSource, kLayerSettingCount> kLayerSettingSources = {{
+    {".enables", "VK_LAYER_ENABLES"},
+    {".disables", "VK_LAYER_DISABLES"},
+    {".message_id_filter", "VK_LAYER_MESSAGE_ID_FILTER"},
+    {".custom_stype_list", "VK_LAYER_CUSTOM_STYPE_LIST"},
+    {".duplicate_message_limit", "VK_LAYER_DUPLICATE_MESSAGE_LIMIT"},
+    {".fine_grained_locking", "VK_LAYER_FINE_GRAINED_LOCKING"},
+    {".lock_free_handle_wrapping", "VK_LAYER_LOCK_FREE_HANDLE_WRAPPING"},
+    {".deferred_command_validation", "VK_LAYER_DEFERRED_COMMAND_VALIDATION"},
+    {".async_validation", "VK_LAYER_ASYNC_VALIDATION"},
+    {".command_buffer_fingerprinting", "VK_LAYER_COMMAND_BUFFER_FINGERPRINTING"},
+    {".memory_report_interval", "VK_LAYER_MEMORY_REPORT_INTERVAL"},
+    {".parallel_pipeline_validation", "VK_LAYER_PARALLEL_PIPELINE_VALIDATION"},
+    {".async_shader_validation", "VK_LAYER_ASYNC_SHADER_VALIDATION"},
+    {".specialization_cache_size", "VK_LAYER_SPECIALIZATION_CACHE_SIZE"},
+    {".parallel_descriptor_update_validation", "VK_LAYER_PARALLEL_DESCRIPTOR_UPDATE_VALIDATION"},
+    {".parallel_sync_resolve", "VK_LAYER_PARALLEL_SYNC_RESOLVE"},
+    {".parallel_sync_hazard_detection", "VK_LAYER_PARALLEL_SYNC_HAZARD_DETECTION"},
+    {".parallel_submit_validation", "VK_LAYER_PARALLEL_SUBMIT_VALIDATION"},
+    {".syncval_max_memory_mb", "VK_LAYER_SYNCVAL_MAX_MEMORY_MB"},
+    {".async_message_delivery", "VK_LAYER_ASYNC_MESSAGE_DELIVERY"},
+    {".hook_timing", "VK_LAYER_HOOK_TIMING"},
+    {".hook_timing_interval", "VK_LAYER_HOOK_TIMING_INTERVAL"},
+    {".layer_trace", "VK_LAYER_LAYER_TRACE"},
+    {".thread_safety_sampling", "VK_LAYER_THREAD_SAFETY_SAMPLING"},
+    {".stateless_create_info_memo", "VK_LAYER_STATELESS_CREATE_INFO_MEMO"},
+    {".async_submission_retirement", "VK_LAYER_ASYNC_SUBMISSION_RETIREMENT"},
+    {".thread_pool_size", "VK_LAYER_THREAD_POOL_SIZE"},
+    {".thread_pool_affinity_mask", "VK_LAYER_THREAD_POOL_AFFINITY_MASK"},
+    {".thread_pool_priority", "VK_LAYER_THREAD_POOL_PRIORITY"},
+    {".housekeeping_budget_us", "VK_LAYER_HOUSEKEEPING_BUDGET_US"},
+    {".housekeeping_submit_interval", "VK_LAYER_HOUSEKEEPING_SUBMIT_INTERVAL"},
+    {".validation_window", "VK_LAYER_VALIDATION_WINDOW"},
+    {".validation_window_start_frame", "VK_LAYER_VALIDATION_WINDOW_START_FRAME"},
+    {".validation_window_frame_count", "VK_LAYER_VALIDATION_WINDOW_FRAME_COUNT"},
+    {".validation_counters", "VK_LAYER_VALIDATION_COUNTERS"},
+    {".validation_counters_interval", "VK_LAYER_VALIDATION_COUNTERS_INTERVAL"},
+    {".low_memory_profile", "VK_LAYER_LOW_MEMORY_PROFILE"},
+}};
+
+// The settings file and environment values of every setting, with the lists among them already parsed. The result of the
+// last ProcessConfigAndEnvSettings is kept, and reused by the next as long as none of the values changed, so that creating
+// many instances tokenizes and hashes the lists only once.
+struct ConfigAndEnvValues {
+    std::string layer_description;
+    std::array<std::string, kLayerSettingCount> config;
+    std::array<std::string, kLayerSettingCount> env;
+
+    CHECK_ENABLED enables{};
+    CHECK_DISABLED disables{};
+    std::vector<uint32_t> message_filter_list;
+    std::vector<std::pair<uint32_t, uint32_t>> custom_stypes;
+};
+
+static std::mutex config_and_env_cache_lock;
+static std::unique_ptr<ConfigAndEnvValues> config_and_env_cache;
+
+// Must be called with config_and_env_cache_lock held
+static const ConfigAndEnvValues &GetConfigAndEnvValues(const char *layer_description) {
+    std::unique_ptr<ConfigAndEnvValues> values(new ConfigAndEnvValues);
+    values->layer_description = layer_description;
+    for (size_t i = 0; i < kLayerSettingCount; ++i) {
+        values->config[i] = getLayerOption((values->layer_description + kLayerSettingSources[i].key_suffix).c_str());
+        values->env[i] = GetEnvironment(kLayerSettingSources[i].env_var);
+    }
+    const auto &cached = config_and_env_cache;
+    if (cached && cached->layer_description == values->layer_description && cached->config == values->config &&
+        cached->env == values->env) {
+        return *cached;
+    }
+
+#if defined(_WIN32)
+    std::string env_delimiter = ";";
+#else
+    std::string env_delimiter = ":";
+#endif
+    SetLocalEnableSetting(values->config[kEnables], ",", values->enables);
+    SetLocalEnableSetting(values->env[kEnables], env_delimiter, values->enables);
+    SetLocalDisableSetting(values->config[kDisables], ",", values->disables);
+    SetLocalDisableSetting(values->env[kDisables], env_delimiter, values->disables);
+    CreateFilterMessageIdList(values->config[kMessageIdFilter], ",", values->message_filter_list);
+    CreateFilterMessageIdList(values->env[kMessageIdFilter], env_delimiter, values->message_filter_list);
+    SetCustomStypeInfo(values->config[kCustomStypeList], ",", values->custom_stypes);
+    SetCustomStypeInfo(values->env[kCustomStypeList], env_delimiter, values->custom_stypes);
+    config_and_env_cache = std::move(values);
+    return *config_and_env_cache;
+}
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     const auto layer_settings_ext = FindSettingsInChain(settings_data->pnext_chain);
@@ -343,6 +495,66 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == "duplicate_message_limit") {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == "deferred_command_validation") {
+                *settings_data->deferred_command_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "async_validation") {
+                *settings_data->async_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "command_buffer_fingerprinting") {
+                *settings_data->command_buffer_fingerprinting = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "memory_report_interval") {
+                *settings_data->memory_report_interval = cur_setting.data.value32;
+            } else if (name == "parallel_pipeline_validation") {
+                *settings_data->parallel_pipeline_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "async_shader_validation") {
+                *settings_data->async_shader_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "specialization_cache_size") {
+                *settings_data->specialization_cache_size = cur_setting.data.value32;
+            } else if (name == "parallel_descriptor_update_validation") {
+                *settings_data->parallel_descriptor_update_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "parallel_sync_resolve") {
+                *settings_data->parallel_sync_resolve = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "parallel_sync_hazard_detection") {
+                *settings_data->parallel_sync_hazard_detection = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "parallel_submit_validation") {
+                *settings_data->parallel_submit_validation = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "syncval_max_memory_mb") {
+                *settings_data->syncval_max_memory_mb = cur_setting.data.value32;
+            } else if (name == "async_message_delivery") {
+                *settings_data->async_message_delivery = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "hook_timing") {
+                *settings_data->hook_timing = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "hook_timing_interval") {
+                *settings_data->hook_timing_interval = cur_setting.data.value32;
+            } else if (name == "layer_trace") {
+                *settings_data->layer_trace = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "thread_safety_sampling") {
+                *settings_data->thread_safety_sampling = cur_setting.data.value32;
+            } else if (name == "stateless_create_info_memo") {
+                *settings_data->stateless_create_info_memo = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "async_submission_retirement") {
+                *settings_data->async_submission_retirement = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "thread_pool_size") {
+                *settings_data->thread_pool_size = cur_setting.data.value32;
+            } else if (name == "thread_pool_affinity_mask") {
+                *settings_data->thread_pool_affinity_mask = cur_setting.data.value32;
+            } else if (name == "thread_pool_priority") {
+                *settings_data->thread_pool_priority = cur_setting.data.value32;
+            } else if (name == "housekeeping_budget_us") {
+                *settings_data->housekeeping_budget_us = cur_setting.data.value32;
+            } else if (name == "housekeeping_submit_interval") {
+                *settings_data->housekeeping_submit_interval = cur_setting.data.value32;
+            } else if (name == "validation_window") {
+                *settings_data->validation_window = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "validation_window_start_frame") {
+                *settings_data->validation_window_start_frame = cur_setting.data.value32;
+            } else if (name == "validation_window_frame_count") {
+                *settings_data->validation_window_frame_count = cur_setting.data.value32;
+            } else if (name == "validation_counters") {
+                *settings_data->validation_counters = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "validation_counters_interval") {
+                *settings_data->validation_counters_interval = cur_setting.data.value32;
+            } else if (name == "low_memory_profile") {
+                *settings_data->low_memory_profile = cur_setting.data.valueBool != VK_FALSE;
             } else if (name == "custom_stype_list") {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -374,51 +586,136 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         SetValidationFlags(settings_data->disables, validation_flags_ext);
     }
 
-    std::string enable_key(settings_data->layer_description);
-    std::string disable_key(settings_data->layer_description);
-    std::string stypes_key(settings_data->layer_description);
-    std::string filter_msg_key(settings_data->layer_description);
-    std::string message_limit(settings_data->layer_description);
-    std::string fine_grained_locking(settings_data->layer_description);
-    enable_key.append(".enables");
-    disable_key.append(".disables");
-    stypes_key.append(".custom_stype_list");
-    filter_msg_key.append(".message_id_filter");
-    message_limit.append(".duplicate_message_limit");
-    fine_grained_locking.append(".fine_grained_locking");
-    std::string list_of_config_enables = getLayerOption(enable_key.c_str());
-    std::string list_of_env_enables = GetLayerEnvVar("VK_LAYER_ENABLES");
-    std::string list_of_config_disables = getLayerOption(disable_key.c_str());
-    std::string list_of_env_disables = GetLayerEnvVar("VK_LAYER_DISABLES");
-    std::string list_of_config_filter_ids = getLayerOption(filter_msg_key.c_str());
-    std::string list_of_env_filter_ids = GetLayerEnvVar("VK_LAYER_MESSAGE_ID_FILTER");
-    std::string list_of_config_stypes = getLayerOption(stypes_key.c_str());
-    std::string list_of_env_stypes = GetLayerEnvVar("VK_LAYER_CUSTOM_STYPE_LIST");
-    std::string config_message_limit = getLayerOption(message_limit.c_str());
-    std::string env_message_limit = GetLayerEnvVar("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
-    std::string config_fine_grained_locking = getLayerOption(fine_grained_locking.c_str());
-    std::string env_fine_grained_locking = GetLayerEnvVar("VK_LAYER_FINE_GRAINED_LOCKING");
+    std::lock_guard<std::mutex> guard(config_and_env_cache_lock);
+    const ConfigAndEnvValues &values = GetConfigAndEnvValues(settings_data->layer_description);
 
-#if defined(_WIN32)
-    std::string env_delimiter = ";";
-#else
-    std::string env_delimiter = ":";
-#endif
     // Process layer enables and disable settings
-    SetLocalEnableSetting(list_of_config_enables, ",", settings_data->enables);
-    SetLocalEnableSetting(list_of_env_enables, env_delimiter, settings_data->enables);
-    SetLocalDisableSetting(list_of_config_disables, ",", settings_data->disables);
-    SetLocalDisableSetting(list_of_env_disables, env_delimiter, settings_data->disables);
+    for (size_t i = 0; i < values.enables.size(); ++i) {
+        if (values.enables[i]) settings_data->enables[i] = true;
+    }
+    for (size_t i = 0; i < values.disables.size(); ++i) {
+        if (values.disables[i]) settings_data->disables[i] = true;
+    }
     // Process message filter ID list
-    CreateFilterMessageIdList(list_of_config_filter_ids, ",", settings_data->message_filter_list);
-    CreateFilterMessageIdList(list_of_env_filter_ids, env_delimiter, settings_data->message_filter_list);
+    for (const uint32_t id : values.message_filter_list) {
+        auto &filter_list = settings_data->message_filter_list;
+        if (std::find(filter_list.begin(), filter_list.end(), id) == filter_list.end()) filter_list.push_back(id);
+    }
     // Process custom stype struct list
-    SetCustomStypeInfo(list_of_config_stypes, ",");
-    SetCustomStypeInfo(list_of_env_stypes, env_delimiter);
+    for (const auto &stype : values.custom_stypes) {
+        bool found = false;
+        // Prevent duplicate entries
+        for (const auto &item : custom_stype_info) {
+            if (item.first == stype.first) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) custom_stype_info.push_back(stype);
+    }
+
+    const auto &config = values.config;
+    const auto &env = values.env;
     // Process message limit
-    uint32_t config_limit_setting = SetMessageDuplicateLimit(config_message_limit, env_message_limit);
+    uint32_t config_limit_setting = SetMessageDuplicateLimit(config[kDuplicateMessageLimit], env[kDuplicateMessageLimit]);
     if (config_limit_setting != 0) {
         *settings_data->duplicate_message_limit = config_limit_setting;
     }
-    *settings_data->fine_grained_locking = SetBool(config_fine_grained_locking, env_fine_grained_locking, false);
+    *settings_data->fine_grained_locking = SetBool(config[kFineGrainedLocking], env[kFineGrainedLocking], false);
+    *settings_data->lock_free_handle_wrapping = SetBool(config[kLockFreeHandleWrapping], env[kLockFreeHandleWrapping], false);
+    *settings_data->deferred_command_validation =
+        SetBool(config[kDeferredCommandValidation], env[kDeferredCommandValidation], *settings_data->deferred_command_validation);
+    *settings_data->async_validation = SetBool(config[kAsyncValidation], env[kAsyncValidation], *settings_data->async_validation);
+    *settings_data->command_buffer_fingerprinting = SetBool(config[kCommandBufferFingerprinting], env[kCommandBufferFingerprinting],
+                                                            *settings_data->command_buffer_fingerprinting);
+    // Same parsing and precedence as the message limit
+    uint32_t config_memory_report_setting = SetMessageDuplicateLimit(config[kMemoryReportInterval], env[kMemoryReportInterval]);
+    if (config_memory_report_setting != 0) {
+        *settings_data->memory_report_interval = config_memory_report_setting;
+    }
+    *settings_data->parallel_pipeline_validation = SetBool(config[kParallelPipelineValidation], env[kParallelPipelineValidation],
+                                                           *settings_data->parallel_pipeline_validation);
+    *settings_data->async_shader_validation =
+        SetBool(config[kAsyncShaderValidation], env[kAsyncShaderValidation], *settings_data->async_shader_validation);
+    uint32_t config_specialization_cache_size_setting =
+        SetMessageDuplicateLimit(config[kSpecializationCacheSize], env[kSpecializationCacheSize]);
+    if (config_specialization_cache_size_setting != 0) {
+        *settings_data->specialization_cache_size = config_specialization_cache_size_setting;
+    }
+    *settings_data->parallel_descriptor_update_validation =
+        SetBool(config[kParallelDescriptorUpdateValidation], env[kParallelDescriptorUpdateValidation],
+                *settings_data->parallel_descriptor_update_validation);
+    *settings_data->parallel_sync_resolve =
+        SetBool(config[kParallelSyncResolve], env[kParallelSyncResolve], *settings_data->parallel_sync_resolve);
+    *settings_data->parallel_sync_hazard_detection =
+        SetBool(config[kParallelSyncHazardDetection], env[kParallelSyncHazardDetection],
+                *settings_data->parallel_sync_hazard_detection);
+    *settings_data->parallel_submit_validation = SetBool(config[kParallelSubmitValidation], env[kParallelSubmitValidation],
+                                                         *settings_data->parallel_submit_validation);
+    uint32_t config_syncval_max_memory_mb_setting =
+        SetMessageDuplicateLimit(config[kSyncvalMaxMemoryMb], env[kSyncvalMaxMemoryMb]);
+    if (config_syncval_max_memory_mb_setting != 0) {
+        *settings_data->syncval_max_memory_mb = config_syncval_max_memory_mb_setting;
+    }
+    *settings_data->async_message_delivery =
+        SetBool(config[kAsyncMessageDelivery], env[kAsyncMessageDelivery], *settings_data->async_message_delivery);
+    *settings_data->hook_timing = SetBool(config[kHookTiming], env[kHookTiming], *settings_data->hook_timing);
+    uint32_t config_hook_timing_interval_setting = SetMessageDuplicateLimit(config[kHookTimingInterval], env[kHookTimingInterval]);
+    if (config_hook_timing_interval_setting != 0) {
+        *settings_data->hook_timing_interval = config_hook_timing_interval_setting;
+    }
+    *settings_data->layer_trace = SetBool(config[kLayerTrace], env[kLayerTrace], *settings_data->layer_trace);
+    uint32_t config_thread_safety_sampling_setting =
+        SetMessageDuplicateLimit(config[kThreadSafetySampling], env[kThreadSafetySampling]);
+    if (config_thread_safety_sampling_setting != 0) {
+        *settings_data->thread_safety_sampling = config_thread_safety_sampling_setting;
+    }
+    *settings_data->stateless_create_info_memo =
+        SetBool(config[kStatelessCreateInfoMemo], env[kStatelessCreateInfoMemo], *settings_data->stateless_create_info_memo);
+    *settings_data->async_submission_retirement =
+        SetBool(config[kAsyncSubmissionRetirement], env[kAsyncSubmissionRetirement], *settings_data->async_submission_retirement);
+    uint32_t config_thread_pool_size_setting = SetMessageDuplicateLimit(config[kThreadPoolSize], env[kThreadPoolSize]);
+    if (config_thread_pool_size_setting != 0) {
+        *settings_data->thread_pool_size = config_thread_pool_size_setting;
+    }
+    uint32_t config_thread_pool_affinity_mask_setting =
+        SetMessageDuplicateLimit(config[kThreadPoolAffinityMask], env[kThreadPoolAffinityMask]);
+    if (config_thread_pool_affinity_mask_setting != 0) {
+        *settings_data->thread_pool_affinity_mask = config_thread_pool_affinity_mask_setting;
+    }
+    uint32_t config_thread_pool_priority_setting = SetMessageDuplicateLimit(config[kThreadPoolPriority], env[kThreadPoolPriority]);
+    if (config_thread_pool_priority_setting != 0) {
+        *settings_data->thread_pool_priority = config_thread_pool_priority_setting;
+    }
+    uint32_t config_housekeeping_budget_us_setting =
+        SetMessageDuplicateLimit(config[kHousekeepingBudgetUs], env[kHousekeepingBudgetUs]);
+    if (config_housekeeping_budget_us_setting != 0) {
+        *settings_data->housekeeping_budget_us = config_housekeeping_budget_us_setting;
+    }
+    uint32_t config_housekeeping_submit_interval_setting =
+        SetMessageDuplicateLimit(config[kHousekeepingSubmitInterval], env[kHousekeepingSubmitInterval]);
+    if (config_housekeeping_submit_interval_setting != 0) {
+        *settings_data->housekeeping_submit_interval = config_housekeeping_submit_interval_setting;
+    }
+    *settings_data->validation_window =
+        SetBool(config[kValidationWindow], env[kValidationWindow], *settings_data->validation_window);
+    uint32_t config_validation_window_start_frame_setting =
+        SetMessageDuplicateLimit(config[kValidationWindowStartFrame], env[kValidationWindowStartFrame]);
+    if (config_validation_window_start_frame_setting != 0) {
+        *settings_data->validation_window_start_frame = config_validation_window_start_frame_setting;
+    }
+    uint32_t config_validation_window_frame_count_setting =
+        SetMessageDuplicateLimit(config[kValidationWindowFrameCount], env[kValidationWindowFrameCount]);
+    if (config_validation_window_frame_count_setting != 0) {
+        *settings_data->validation_window_frame_count = config_validation_window_frame_count_setting;
+    }
+    *settings_data->validation_counters =
+        SetBool(config[kValidationCounters], env[kValidationCounters], *settings_data->validation_counters);
+    uint32_t config_validation_counters_interval_setting =
+        SetMessageDuplicateLimit(config[kValidationCountersInterval], env[kValidationCountersInterval]);
+    if (config_validation_counters_interval_setting != 0) {
+        *settings_data->validation_counters_interval = config_validation_counters_interval_setting;
+    }
+    *settings_data->low_memory_profile =
+        SetBool(config[kLowMemoryProfile], env[kLowMemoryProfile], *settings_data->low_memory_profile);
 }
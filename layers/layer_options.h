@@ -34,6 +34,37 @@ typedef struct {
     std::vector<uint32_t> &message_filter_list;
     int32_t *duplicate_message_limit;
     bool *fine_grained_locking;
+    bool *lock_free_handle_wrapping;
+    bool *deferred_command_validation;
+    bool *async_validation;
+    bool *command_buffer_fingerprinting;
+    uint32_t *memory_report_interval;
+    bool *parallel_pipeline_validation;
+    bool *async_shader_validation;
+    uint32_t *specialization_cache_size;
+    bool *parallel_descriptor_update_validation;
+    bool *parallel_sync_resolve;
+    bool *parallel_sync_hazard_detection;
+    bool *parallel_submit_validation;
+    uint32_t *syncval_max_memory_mb;
+    bool *async_message_delivery;
+    bool *hook_timing;
+    uint32_t *hook_timing_interval;
+    bool *layer_trace;
+    uint32_t *thread_safety_sampling;
+    bool *stateless_create_info_memo;
+    bool *async_submission_retirement;
+    uint32_t *thread_pool_size;
+    uint32_t *thread_pool_affinity_mask;
+    uint32_t *thread_pool_priority;
+    uint32_t *housekeeping_budget_us;
+    uint32_t *housekeeping_submit_interval;
+    bool *validation_window;
+    uint32_t *validation_window_start_frame;
+    uint32_t *validation_window_frame_count;
+    bool *validation_counters;
+    uint32_t *validation_counters_interval;
+    bool *low_memory_profile;
 } ConfigAndEnvSettings;
 
 static const layer_data::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -65,6 +96,12 @@ static const layer_data::unordered_map<std::string, ValidationCheckDisables> Val
     {"VALIDATION_CHECK_DISABLE_OBJECT_IN_USE", VALIDATION_CHECK_DISABLE_OBJECT_IN_USE},
     {"VALIDATION_CHECK_DISABLE_QUERY_VALIDATION", VALIDATION_CHECK_DISABLE_QUERY_VALIDATION},
     {"VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION", VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION", VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION", VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION},
+    {"VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION",
+     VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION},
 };
 
 static const layer_data::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
@@ -76,17 +113,22 @@ static const layer_data::unordered_map<std::string, ValidationCheckEnables> Vali
 
 // This should mirror the 'DisableFlags' enumerated type
 static const std::vector<std::string> DisableFlagNameHelper = {
-    "VALIDATION_CHECK_DISABLE_COMMAND_BUFFER_STATE",               // command_buffer_state,
-    "VALIDATION_CHECK_DISABLE_OBJECT_IN_USE",                      // object_in_use,
-    "VALIDATION_CHECK_DISABLE_QUERY_VALIDATION",                   // query_validation,
-    "VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION",            // image_layout_validation,
-    "VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT",          // object_tracking,
-    "VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT",               // core_checks,
-    "VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT",             // thread_safety,
-    "VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT",            // stateless_checks,
-    "VK_VALIDATION_FEATURE_DISABLE_UNIQUE_HANDLES_EXT",            // handle_wrapping,
-    "VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT",                   // shader_validation,
-    "VK_VALIDATION_FEATURE_DISABLE_SHADER_VALIDATION_CACHING_EXT"  // shader_validation_caching
+    "VALIDATION_CHECK_DISABLE_COMMAND_BUFFER_STATE",                 // command_buffer_state,
+    "VALIDATION_CHECK_DISABLE_OBJECT_IN_USE",                        // object_in_use,
+    "VALIDATION_CHECK_DISABLE_QUERY_VALIDATION",                     // query_validation,
+    "VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION",              // image_layout_validation,
+    "VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT",            // object_tracking,
+    "VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT",                 // core_checks,
+    "VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT",               // thread_safety,
+    "VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT",              // stateless_checks,
+    "VK_VALIDATION_FEATURE_DISABLE_UNIQUE_HANDLES_EXT",              // handle_wrapping,
+    "VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT",                     // shader_validation,
+    "VK_VALIDATION_FEATURE_DISABLE_SHADER_VALIDATION_CACHING_EXT",   // shader_validation_caching,
+    "VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION",        // descriptor_content_validation,
+    "VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION",       // submit_image_layout_validation,
+    "VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION",             // dynamic_state_validation,
+    "VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION",             // vertex_buffer_validation,
+    "VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION"  // render_pass_compatibility_validation
 };
 
 // This should mirror the 'EnableFlags' enumerated type
@@ -0,0 +1,162 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "layer_trace.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "vk_layer_config.h"
+
+std::atomic<bool> layer_trace_enabled{false};
+
+namespace {
+
+// Fields are relaxed atomics so that the trace can be written while the owning thread keeps adding events
+struct TraceSlot {
+    std::atomic<const char *> category{nullptr};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<int64_t> start_ns{0};
+    std::atomic<int64_t> end_ns{0};
+};
+
+struct TraceEvent {
+    const char *category;
+    const char *name;
+    int64_t start_ns;
+    int64_t end_ns;
+};
+
+// Written by its thread only. The writer announces each slot it is about to overwrite, in the manner of a seqlock, so that a
+// reader can drop the events that were overwritten while it read them.
+class TraceRing {
+  public:
+    explicit TraceRing(uint32_t thread_index) : thread_index_(thread_index), slots_(new TraceSlot[kLayerTraceRingSize]) {}
+
+    void Add(const char *category, const char *name, int64_t start_ns, int64_t end_ns) {
+        const uint64_t position = next_.load(std::memory_order_relaxed);
+        claimed_.store(position + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        TraceSlot &slot = slots_[position % kLayerTraceRingSize];
+        slot.category.store(category, std::memory_order_relaxed);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.start_ns.store(start_ns, std::memory_order_relaxed);
+        slot.end_ns.store(end_ns, std::memory_order_relaxed);
+        next_.store(position + 1, std::memory_order_release);
+    }
+
+    void ReadEvents(std::vector<TraceEvent> &events) const {
+        const uint64_t end = next_.load(std::memory_order_acquire);
+        const uint64_t begin = (end > kLayerTraceRingSize) ? end - kLayerTraceRingSize : 0;
+        std::vector<TraceEvent> read;
+        read.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t position = begin; position < end; ++position) {
+            const TraceSlot &slot = slots_[position % kLayerTraceRingSize];
+            read.push_back(TraceEvent{slot.category.load(std::memory_order_relaxed), slot.name.load(std::memory_order_relaxed),
+                                      slot.start_ns.load(std::memory_order_relaxed), slot.end_ns.load(std::memory_order_relaxed)});
+        }
+        // Keep only the events whose slots no write has claimed since
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t claimed = claimed_.load(std::memory_order_relaxed);
+        const uint64_t first_intact = (claimed > kLayerTraceRingSize) ? claimed - kLayerTraceRingSize : 0;
+        const size_t skipped = static_cast<size_t>((first_intact > begin) ? std::min(first_intact - begin, end - begin) : 0);
+        events.insert(events.end(), read.begin() + skipped, read.end());
+    }
+
+    uint32_t ThreadIndex() const { return thread_index_; }
+
+  private:
+    const uint32_t thread_index_;
+    std::unique_ptr<TraceSlot[]> slots_;
+    std::atomic<uint64_t> next_{0};
+    // Every slot up to this position may have been written
+    std::atomic<uint64_t> claimed_{0};
+};
+
+// Leaked on purpose, threads may add events during static destruction
+struct TraceState {
+    std::mutex lock;
+    std::vector<std::unique_ptr<TraceRing>> rings;
+    std::string filename;
+};
+
+TraceState &GetState() {
+    static auto *state = new TraceState;
+    return *state;
+}
+
+TraceRing &GetThreadRing() {
+    thread_local TraceRing *ring = nullptr;
+    if (!ring) {
+        auto &state = GetState();
+        std::lock_guard<std::mutex> guard(state.lock);
+        state.rings.emplace_back(new TraceRing(static_cast<uint32_t>(state.rings.size() + 1)));
+        ring = state.rings.back().get();
+    }
+    return *ring;
+}
+
+}  // namespace
+
+void EnableLayerTrace() {
+    auto &state = GetState();
+    {
+        std::lock_guard<std::mutex> guard(state.lock);
+        if (layer_trace_enabled.load()) return;
+        const char *filename = getLayerOption("khronos_validation.layer_trace_filename");
+        state.filename = (filename && *filename) ? filename : "vk_layer_trace.json";
+    }
+    layer_trace_enabled.store(true);
+}
+
+void AddTraceEvent(const char *category, const char *name, int64_t start_ns, int64_t end_ns) {
+    GetThreadRing().Add(category, name, start_ns, end_ns);
+}
+
+void WriteLayerTrace() {
+    if (!layer_trace_enabled.load()) return;
+    auto &state = GetState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    FILE *file = fopen(state.filename.c_str(), "w");
+    if (!file) return;
+
+    // Complete ("X") events, ts and dur in microseconds
+    fprintf(file, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (const auto &ring : state.rings) {
+        fprintf(file,
+                "%s\n{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 0, \"tid\": %u, \"args\": {\"name\": \"VVL thread %u\"}}",
+                first ? "" : ",", ring->ThreadIndex(), ring->ThreadIndex());
+        first = false;
+        events.clear();
+        ring->ReadEvents(events);
+        for (const auto &event : events) {
+            fprintf(file,
+                    ",\n{\"ph\": \"X\", \"cat\": \"%s\", \"name\": \"%s\", \"pid\": 0, \"tid\": %u, \"ts\": %" PRId64 ".%03" PRId64
+                    ", \"dur\": %" PRId64 ".%03" PRId64 "}",
+                    event.category, event.name, ring->ThreadIndex(), event.start_ns / 1000, event.start_ns % 1000,
+                    (event.end_ns - event.start_ns) / 1000, (event.end_ns - event.start_ns) % 1000);
+        }
+    }
+    fprintf(file, "\n]}\n");
+    fclose(file);
+}
@@ -0,0 +1,62 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Timeline of the layer's own work, collected when khronos_validation.layer_trace is set: the validation objects' hooks (see
+// HookTimer), the checks of submitted command buffers, worker pool jobs, GPU-AV and debug printf readback, shader
+// instrumentation and spirv-val runs.
+//
+// Each thread keeps its latest kLayerTraceRingSize events in a ring of its own, written without locks. At each
+// vkDestroyDevice the rings are written to khronos_validation.layer_trace_filename in the Chrome trace event format, which
+// chrome://tracing and the Perfetto UI open. Timestamps are steady_clock time, CLOCK_MONOTONIC on Linux and QPC on Windows, so
+// that the events line up with an application's own trace from the same clock.
+
+const uint32_t kLayerTraceRingSize = 1 << 16;
+
+extern std::atomic<bool> layer_trace_enabled;
+
+void EnableLayerTrace();
+// category and name must be string literals, or otherwise live until the trace is written
+void AddTraceEvent(const char *category, const char *name, int64_t start_ns, int64_t end_ns);
+void WriteLayerTrace();
+
+static inline int64_t LayerTraceNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Adds an event spanning its own scope
+class TraceScope {
+  public:
+    TraceScope(const char *category, const char *name)
+        : category_(category), name_(layer_trace_enabled.load(std::memory_order_relaxed) ? name : nullptr) {
+        if (name_) start_ns_ = LayerTraceNow();
+    }
+    ~TraceScope() {
+        if (name_) AddTraceEvent(category_, name_, start_ns_, LayerTraceNow());
+    }
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+  private:
+    const char *category_;
+    const char *name_;
+    int64_t start_ns_ = 0;
+};
@@ -0,0 +1,49 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "low_memory_profile.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+std::atomic<bool> low_memory_profile_enabled{false};
+
+namespace {
+
+std::atomic<uint64_t> savings[kLowMemorySavingCount];
+
+}  // namespace
+
+void EnableLowMemoryProfile() { low_memory_profile_enabled.store(true); }
+
+void AddLowMemorySaving(LowMemorySaving saving, uint64_t amount) {
+    savings[saving].fetch_add(amount, std::memory_order_relaxed);
+}
+
+std::string FormatLowMemoryProfileReport() {
+    const uint64_t chunk_bytes = savings[kLowMemorySavingGpuChunks].load(std::memory_order_relaxed);
+    const uint64_t range_bytes = savings[kLowMemorySavingLayoutRanges].load(std::memory_order_relaxed);
+    const uint64_t source_indexes = savings[kLowMemorySavingSourceIndexes].load(std::memory_order_relaxed);
+    char text[512];
+    snprintf(text, sizeof(text),
+             "Low memory profile: sync-val access state coarsened past %" PRIu32
+             " MiB unless syncval_max_memory_mb is set, at most %zu free chunks per GPU-AV pool, image layout maps merged at "
+             "each update, shader source indexes dropped after each message.\n"
+             "Saved so far: %" PRIu64 " KiB of GPU-AV chunks freed instead of pooled, %" PRIu64
+             " KiB of image layout ranges merged early, %" PRIu64 " shader source indexes not kept",
+             kLowMemorySyncvalMaxMemoryMb, kLowMemoryMaxFreeGpuChunks, chunk_bytes / 1024, range_bytes / 1024, source_indexes);
+    return text;
+}
@@ -0,0 +1,53 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// The compact configuration set up with khronos_validation.low_memory_profile, for devices where the memory the layer holds
+// matters more than how fast it validates, such as Android devices running core validation and sync-val together.
+//
+// With the profile, each subsystem that keeps a larger representation for speed switches to its compact one:
+// - synchronization validation coarsens the ranges of its access state past kLowMemorySyncvalMaxMemoryMb, unless
+//   syncval_max_memory_mb sets another budget, and the stateless create info memo is off,
+// - the GPU-AV chunk pools keep at most kLowMemoryMaxFreeGpuChunks free chunks each and free the others,
+// - the global image layout maps merge neighboring ranges at every update instead of once they have doubled,
+// - GPU-AV and debug printf index the SPIR-V of a shader for each message instead of keeping the index with the shader.
+// Create infos and SPIR-V are interned whatever the profile. The profile is that of the process, and what it saved is logged
+// with each state memory report and when a device is created.
+
+static const uint32_t kLowMemorySyncvalMaxMemoryMb = 64;
+static const size_t kLowMemoryMaxFreeGpuChunks = 4;
+
+enum LowMemorySaving {
+    kLowMemorySavingGpuChunks,      // Bytes of chunks freed instead of pooled
+    kLowMemorySavingLayoutRanges,   // Bytes of layout map ranges merged early
+    kLowMemorySavingSourceIndexes,  // Shader source indexes dropped after their message
+    kLowMemorySavingCount
+};
+
+extern std::atomic<bool> low_memory_profile_enabled;
+
+// Once per process
+void EnableLowMemoryProfile();
+void AddLowMemorySaving(LowMemorySaving saving, uint64_t amount);
+std::string FormatLowMemoryProfileReport();
+
+static inline bool LowMemoryProfile() { return low_memory_profile_enabled.load(std::memory_order_relaxed); }
@@ -46,16 +46,52 @@ enum ObjectStatusFlagBits {
     OBJSTATUS_CUSTOM_ALLOCATOR = 0x00000002,          // Allocated with custom allocator
 };
 
-// Object and state information structure
+// Object and state information structure, set once when the object is created
 struct ObjTrackState {
-    uint64_t handle;                                               // Object handle (new)
-    VulkanObjectType object_type;                                  // Object type identifier
-    ObjectStatusFlags status;                                      // Object state
-    uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<layer_data::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    uint64_t handle;               // Object handle (new)
+    VulkanObjectType object_type;  // Object type identifier
+    ObjectStatusFlags status;      // Object state
+    uint64_t parent_object;        // Parent object
 };
 
-typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
+// ValidateObject() looks up every handle parameter of every call, without taking a lock
+typedef vl_concurrent_handle_map<ObjTrackState> object_map_type;
+
+// The children of a descriptor or command pool. Freeing children only counts them, so that resetting or destroying the pool
+// erases all of its children in one pass over this list. The handles of freed children are dropped once they make up half
+// of the list.
+struct PoolChildren {
+    std::vector<uint64_t> handles;
+    size_t freed = 0;
+};
+
+typedef layer_data::unordered_map<uint64_t, PoolChildren> pool_children_map_type;
+
+// The latest handles a call's ValidateObject() found in this device's maps. The arrays of a call often repeat handles, the
+// same sampler or buffer in every descriptor write, and each is looked up once while it stays among the latest.
+class ValidObjectCache {
+  public:
+    bool Contains(uint64_t handle, VulkanObjectType object_type) const {
+        const uint32_t count = (added < kSize) ? added : kSize;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (entries[i].handle == handle && entries[i].object_type == object_type) return true;
+        }
+        return false;
+    }
+    void Add(uint64_t handle, VulkanObjectType object_type) {
+        entries[added % kSize] = {handle, object_type};
+        ++added;
+    }
+
+  private:
+    static const uint32_t kSize = 8;
+    struct Entry {
+        uint64_t handle;
+        VulkanObjectType object_type;
+    };
+    Entry entries[kSize];
+    uint32_t added = 0;
+};
 
 class ObjectLifetimes : public ValidationObject {
   public:
@@ -75,6 +111,9 @@ class ObjectLifetimes : public ValidationObject {
     object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
     object_map_type swapchainImageMap;
+    // The descriptor sets and command buffers allocated from each pool, guarded by object_lifetime_mutex
+    pool_children_map_type descriptor_pool_children;
+    pool_children_map_type command_pool_children;
 
     void *device_createinfo_pnext;
     bool null_descriptor_enabled;
@@ -90,9 +129,17 @@ class ObjectLifetimes : public ValidationObject {
     }
 
     template <typename T1>
-    void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, std::shared_ptr<ObjTrackState> pNode) {
+    void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const ObjTrackState &node) {
         uint64_t object_handle = HandleToUint64(object);
-        bool inserted = map.insert(object_handle, pNode);
+        ObjTrackState *inserted_record = nullptr;
+        bool inserted = map.insert(object_handle, [&node, &inserted_record](ObjTrackState &record) {
+            record = node;
+            inserted_record = &record;
+        });
+        // Swapchain images are only looked up in their own map
+        if (inserted && handle_registry && (&map == &object_map[object_type])) {
+            handle_registry->Set(object_handle, kHandleRecordObjectLifetimes, inserted_record);
+        }
         if (!inserted) {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
@@ -111,6 +158,8 @@ class ObjectLifetimes : public ValidationObject {
     bool ReportLeakedInstanceObjects(VkInstance instance, VulkanObjectType object_type, const std::string &error_code) const;
 
     void DestroyUndestroyedObjects(VulkanObjectType object_type);
+    void FreePoolChildren(pool_children_map_type &pool_children, uint64_t pool, VulkanObjectType child_type, size_t freed_count);
+    void DestroyPoolChildren(pool_children_map_type &pool_children, uint64_t pool, VulkanObjectType child_type);
 
     void CreateQueue(VkQueue vkObj);
     void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level);
@@ -124,7 +173,7 @@ class ObjectLifetimes : public ValidationObject {
     bool ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer) const;
     bool ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) const;
     bool ValidateSamplerObjects(const VkDescriptorSetLayoutCreateInfo *pCreateInfo) const;
-    bool ValidateDescriptorWrite(VkWriteDescriptorSet const *desc, bool isPush) const;
+    bool ValidateDescriptorWrite(VkWriteDescriptorSet const *desc, bool isPush, ValidObjectCache &valid_objects) const;
     bool ValidateAnonymousObject(uint64_t object, VkObjectType core_object_type, bool null_allowed, const char *invalid_handle_code,
                                  const char *wrong_device_code) const;
     bool ValidateAccelerationStructures(const char *dst_handle_vuid, uint32_t count,
@@ -139,23 +188,30 @@ class ObjectLifetimes : public ValidationObject {
         return nullptr;
     };
 
+    // The record of an object of this device or instance, from the handle registry if the object has an entry there
+    const ObjTrackState *FindObject(uint64_t object_handle, VulkanObjectType object_type) const {
+        if (handle_registry) {
+            const ObjTrackState *node = handle_registry->Find<ObjTrackState>(object_handle, kHandleRecordObjectLifetimes);
+            if (node && node->handle == object_handle && node->object_type == object_type) return node;
+        }
+        return object_map[object_type].find(object_handle);
+    }
+
     bool CheckObjectValidity(uint64_t object_handle, VulkanObjectType object_type, bool null_allowed,
                              const char *invalid_handle_code, const char *wrong_device_code) const {
         // Look for object in object map
-        if (!object_map[object_type].contains(object_handle)) {
+        if (!FindObject(object_handle, object_type)) {
             // If object is an image, also look for it in the swapchain image map
-            if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
+            if ((object_type != kVulkanObjectTypeImage) || !swapchainImageMap.contains(object_handle)) {
                 // Object not found, look for it in other device object maps
-                for (const auto &other_device_data : layer_data_map) {
+                for (const auto &other_device_data : layer_data_map.entries()) {
                     for (auto *layer_object_data : other_device_data.second->object_dispatch) {
                         if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
                             auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
                             if (object_lifetime_data && (object_lifetime_data != this)) {
-                                if (object_lifetime_data->object_map[object_type].find(object_handle) !=
-                                        object_lifetime_data->object_map[object_type].end() ||
+                                if (object_lifetime_data->object_map[object_type].contains(object_handle) ||
                                     (object_type == kVulkanObjectTypeImage &&
-                                     object_lifetime_data->swapchainImageMap.find(object_handle) !=
-                                         object_lifetime_data->swapchainImageMap.end())) {
+                                     object_lifetime_data->swapchainImageMap.contains(object_handle))) {
                                     // Object found on other device, report an error if object has a device parent error code
                                     if ((wrong_device_code != kVUIDUndefined) && (object_type != kVulkanObjectTypeSurfaceKHR)) {
                                         return LogError(instance, wrong_device_code,
@@ -194,31 +250,43 @@ class ObjectLifetimes : public ValidationObject {
         return CheckObjectValidity(HandleToUint64(object), object_type, null_allowed, invalid_handle_code, wrong_device_code);
     }
 
+    // For the handles in arrays, which skip the lookup of a handle found earlier in the same call
+    template <typename T1>
+    bool ValidateObject(T1 object, VulkanObjectType object_type, bool null_allowed, const char *invalid_handle_code,
+                        const char *wrong_device_code, ValidObjectCache &valid_objects) const {
+        const uint64_t object_handle = HandleToUint64(object);
+        if (valid_objects.Contains(object_handle, object_type)) {
+            return false;
+        }
+        // Errors and the special cases are left to ValidateObject()
+        if ((object_type != kVulkanObjectTypeDevice) && FindObject(object_handle, object_type)) {
+            valid_objects.Add(object_handle, object_type);
+            return false;
+        }
+        return ValidateObject(object, object_type, null_allowed, invalid_handle_code, wrong_device_code);
+    }
+
     template <typename T1>
     void CreateObject(T1 object, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator) {
         uint64_t object_handle = HandleToUint64(object);
         bool custom_allocator = (pAllocator != nullptr);
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
-            pNewObjNode->object_type = object_type;
-            pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
-            pNewObjNode->handle = object_handle;
+            ObjTrackState new_obj_node = {};
+            new_obj_node.object_type = object_type;
+            new_obj_node.status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
+            new_obj_node.handle = object_handle;
 
-            InsertObject(object_map[object_type], object, object_type, pNewObjNode);
+            InsertObject(object_map[object_type], object, object_type, new_obj_node);
             num_objects[object_type]++;
             num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new layer_data::unordered_set<uint64_t>);
-            }
         }
     }
 
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type) {
         assert(object != HandleToUint64(VK_NULL_HANDLE));
 
-        auto item = object_map[object_type].pop(object);
-        if (item == object_map[object_type].end()) {
+        if (handle_registry) handle_registry->Clear(object, kHandleRecordObjectLifetimes);
+        if (!object_map[object_type].erase(object)) {
             // We've already checked that the object exists. If we couldn't find and atomically remove it
             // from the map, there must have been a race condition in the app. Report an error and move on.
             (void)LogError(device, kVUID_ObjectTracker_Info,
@@ -231,16 +299,16 @@ class ObjectLifetimes : public ValidationObject {
         assert(num_total_objects > 0);
 
         num_total_objects--;
-        assert(num_objects[item->second->object_type] > 0);
+        assert(num_objects[object_type] > 0);
 
-        num_objects[item->second->object_type]--;
+        num_objects[object_type]--;
     }
 
     template <typename T1>
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type) {
         auto object = HandleToUint64(object_handle);
         if (object != HandleToUint64(VK_NULL_HANDLE)) {
-            if (object_map[object_type].contains(object)) {
+            if (FindObject(object, object_type)) {
                 DestroyObjectSilently(object, object_type);
             }
         }
@@ -255,9 +323,9 @@ class ObjectLifetimes : public ValidationObject {
 
         if ((expected_custom_allocator_code != kVUIDUndefined || expected_default_allocator_code != kVUIDUndefined) &&
             object != HandleToUint64(VK_NULL_HANDLE)) {
-            auto item = object_map[object_type].find(object);
-            if (item != object_map[object_type].end()) {
-                auto allocated_with_custom = (item->second->status & OBJSTATUS_CUSTOM_ALLOCATOR) ? true : false;
+            const ObjTrackState *node = FindObject(object, object_type);
+            if (node) {
+                auto allocated_with_custom = (node->status & OBJSTATUS_CUSTOM_ALLOCATOR) ? true : false;
                 if (allocated_with_custom && !custom_allocator && expected_custom_allocator_code != kVUIDUndefined) {
                     // This check only verifies that custom allocation callbacks were provided to both Create and Destroy calls,
                     // it cannot verify that these allocation callbacks are compatible with each other.
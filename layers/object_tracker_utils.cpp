@@ -57,6 +57,46 @@ void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
     }
 }
 
+void ObjectLifetimes::FreePoolChildren(pool_children_map_type &pool_children, uint64_t pool, VulkanObjectType child_type,
+                                       size_t freed_count) {
+    auto itr = pool_children.find(pool);
+    if (itr == pool_children.end()) return;
+    auto &children = itr->second;
+    children.freed += freed_count;
+    if (children.freed * 2 < children.handles.size()) return;
+
+    // A handle freed and allocated again from this pool is listed twice
+    std::sort(children.handles.begin(), children.handles.end());
+    children.handles.erase(std::unique(children.handles.begin(), children.handles.end()), children.handles.end());
+    const auto &child_map = object_map[child_type];
+    children.handles.erase(std::remove_if(children.handles.begin(), children.handles.end(),
+                                          [&child_map, pool](uint64_t handle) {
+                                              const ObjTrackState *node = child_map.find(handle);
+                                              return !node || node->parent_object != pool;
+                                          }),
+                           children.handles.end());
+    children.freed = 0;
+}
+
+void ObjectLifetimes::DestroyPoolChildren(pool_children_map_type &pool_children, uint64_t pool, VulkanObjectType child_type) {
+    auto itr = pool_children.find(pool);
+    if (itr == pool_children.end()) return;
+    // Freed handles may have been allocated again from another pool
+    HandleRegistry *registry = handle_registry.get();
+    const size_t destroyed =
+        object_map[child_type].erase(itr->second.handles, [pool, registry](const ObjTrackState &node) {
+            if (node.parent_object != pool) return false;
+            if (registry) registry->Clear(node.handle, kHandleRecordObjectLifetimes);
+            return true;
+        });
+    pool_children.erase(itr);
+
+    assert(num_total_objects >= destroyed);
+    num_total_objects -= destroyed;
+    assert(num_objects[child_type] >= destroyed);
+    num_objects[child_type] -= destroyed;
+}
+
 // Look for this device object in any of the instance child devices lists.
 // NOTE: This is of dubious value. In most circumstances Vulkan will die a flaming death if a dispatchable object is invalid.
 // However, if this layer is loaded first and GetProcAddress is used to make API calls, it will detect bad DOs.
@@ -85,27 +125,26 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core
 
 void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                             VkCommandBufferLevel level) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeCommandBuffer;
-    new_obj_node->handle = HandleToUint64(command_buffer);
-    new_obj_node->parent_object = HandleToUint64(command_pool);
+    ObjTrackState new_obj_node = {};
+    new_obj_node.object_type = kVulkanObjectTypeCommandBuffer;
+    new_obj_node.handle = HandleToUint64(command_buffer);
+    new_obj_node.parent_object = HandleToUint64(command_pool);
     if (level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
-        new_obj_node->status = OBJSTATUS_COMMAND_BUFFER_SECONDARY;
+        new_obj_node.status = OBJSTATUS_COMMAND_BUFFER_SECONDARY;
     } else {
-        new_obj_node->status = OBJSTATUS_NONE;
+        new_obj_node.status = OBJSTATUS_NONE;
     }
     InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, new_obj_node);
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+    command_pool_children[HandleToUint64(command_pool)].handles.push_back(HandleToUint64(command_buffer));
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer) const {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(command_buffer);
-    auto iter = object_map[kVulkanObjectTypeCommandBuffer].find(object_handle);
-    if (iter != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-        auto node = iter->second;
-
+    const ObjTrackState *node = FindObject(object_handle, kVulkanObjectTypeCommandBuffer);
+    if (node) {
         if (node->parent_object != HandleToUint64(command_pool)) {
             // We know that the parent *must* be a command pool
             const auto parent_pool = CastFromUint64<VkCommandPool>(node->parent_object);
@@ -125,29 +164,28 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
 }
 
 void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeDescriptorSet;
-    new_obj_node->status = OBJSTATUS_NONE;
-    new_obj_node->handle = HandleToUint64(descriptor_set);
-    new_obj_node->parent_object = HandleToUint64(descriptor_pool);
+    ObjTrackState new_obj_node = {};
+    new_obj_node.object_type = kVulkanObjectTypeDescriptorSet;
+    new_obj_node.status = OBJSTATUS_NONE;
+    new_obj_node.handle = HandleToUint64(descriptor_set);
+    new_obj_node.parent_object = HandleToUint64(descriptor_pool);
     InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, new_obj_node);
     num_objects[kVulkanObjectTypeDescriptorSet]++;
     num_total_objects++;
 
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+    if (object_map[kVulkanObjectTypeDescriptorPool].contains(HandleToUint64(descriptor_pool))) {
+        descriptor_pool_children[HandleToUint64(descriptor_pool)].handles.push_back(HandleToUint64(descriptor_set));
     }
 }
 
 bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) const {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(descriptor_set);
-    auto ds_item = object_map[kVulkanObjectTypeDescriptorSet].find(object_handle);
-    if (ds_item != object_map[kVulkanObjectTypeDescriptorSet].end()) {
-        if (ds_item->second->parent_object != HandleToUint64(descriptor_pool)) {
+    const ObjTrackState *ds_node = FindObject(object_handle, kVulkanObjectTypeDescriptorSet);
+    if (ds_node) {
+        if (ds_node->parent_object != HandleToUint64(descriptor_pool)) {
             // We know that the parent *must* be a descriptor pool
-            const auto parent_pool = CastFromUint64<VkDescriptorPool>(ds_item->second->parent_object);
+            const auto parent_pool = CastFromUint64<VkDescriptorPool>(ds_node->parent_object);
             LogObjectList objlist(descriptor_set);
             objlist.add(parent_pool);
             objlist.add(descriptor_pool);
@@ -164,19 +202,21 @@ bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, Vk
     return skip;
 }
 
-bool ObjectLifetimes::ValidateDescriptorWrite(VkWriteDescriptorSet const *desc, bool isPush) const {
+bool ObjectLifetimes::ValidateDescriptorWrite(VkWriteDescriptorSet const *desc, bool isPush,
+                                              ValidObjectCache &valid_objects) const {
     bool skip = false;
 
     if (!isPush && desc->dstSet) {
         skip |= ValidateObject(desc->dstSet, kVulkanObjectTypeDescriptorSet, false, "VUID-VkWriteDescriptorSet-dstSet-00320",
-                               "VUID-VkWriteDescriptorSet-commonparent");
+                               "VUID-VkWriteDescriptorSet-commonparent", valid_objects);
     }
 
     if ((desc->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER) ||
         (desc->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER)) {
         for (uint32_t idx2 = 0; idx2 < desc->descriptorCount; ++idx2) {
             skip |= ValidateObject(desc->pTexelBufferView[idx2], kVulkanObjectTypeBufferView, true,
-                                   "VUID-VkWriteDescriptorSet-descriptorType-02994", "VUID-VkWriteDescriptorSet-commonparent");
+                                   "VUID-VkWriteDescriptorSet-descriptorType-02994", "VUID-VkWriteDescriptorSet-commonparent",
+                                   valid_objects);
             if (!null_descriptor_enabled && desc->pTexelBufferView[idx2] == VK_NULL_HANDLE) {
                 skip |= LogError(desc->dstSet, "VUID-VkWriteDescriptorSet-descriptorType-02995",
                                  "VkWriteDescriptorSet: texel buffer view must not be VK_NULL_HANDLE.");
@@ -189,7 +229,8 @@ bool ObjectLifetimes::ValidateDescriptorWrite(VkWriteDescriptorSet const *desc,
         (desc->descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)) {
         for (uint32_t idx3 = 0; idx3 < desc->descriptorCount; ++idx3) {
             skip |= ValidateObject(desc->pImageInfo[idx3].imageView, kVulkanObjectTypeImageView, true,
-                                   "VUID-VkWriteDescriptorSet-descriptorType-02996", "VUID-VkDescriptorImageInfo-commonparent");
+                                   "VUID-VkWriteDescriptorSet-descriptorType-02996", "VUID-VkDescriptorImageInfo-commonparent",
+                                   valid_objects);
             if (!null_descriptor_enabled && desc->pImageInfo[idx3].imageView == VK_NULL_HANDLE) {
                 skip |= LogError(desc->dstSet, "VUID-VkWriteDescriptorSet-descriptorType-02997",
                                  "VkWriteDescriptorSet: image view must not be VK_NULL_HANDLE.");
@@ -203,7 +244,7 @@ bool ObjectLifetimes::ValidateDescriptorWrite(VkWriteDescriptorSet const *desc,
         (desc->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)) {
         for (uint32_t idx4 = 0; idx4 < desc->descriptorCount; ++idx4) {
             skip |= ValidateObject(desc->pBufferInfo[idx4].buffer, kVulkanObjectTypeBuffer, true,
-                                   "VUID-VkDescriptorBufferInfo-buffer-parameter", kVUIDUndefined);
+                                   "VUID-VkDescriptorBufferInfo-buffer-parameter", kVUIDUndefined, valid_objects);
             if (!null_descriptor_enabled && desc->pBufferInfo[idx4].buffer == VK_NULL_HANDLE) {
                 skip |= LogError(desc->dstSet, "VUID-VkDescriptorBufferInfo-buffer-02998",
                                  "VkWriteDescriptorSet: buffer must not be VK_NULL_HANDLE.");
@@ -216,7 +257,7 @@ bool ObjectLifetimes::ValidateDescriptorWrite(VkWriteDescriptorSet const *desc,
         for (uint32_t idx5 = 0; idx5 < desc->descriptorCount; ++idx5) {
             skip |= ValidateObject(acc_info->pAccelerationStructures[idx5], kVulkanObjectTypeAccelerationStructureKHR, true,
                                    "VUID-VkWriteDescriptorSetAccelerationStructureKHR-pAccelerationStructures-parameter",
-                                   kVUIDUndefined);
+                                   kVUIDUndefined, valid_objects);
         }
     }
 
@@ -232,36 +273,34 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetKHR(VkCommandBuffer com
     skip |= ValidateObject(layout, kVulkanObjectTypePipelineLayout, false, "VUID-vkCmdPushDescriptorSetKHR-layout-parameter",
                            "VUID-vkCmdPushDescriptorSetKHR-commonparent");
     if (pDescriptorWrites) {
+        ValidObjectCache valid_objects;
         for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
-            skip |= ValidateDescriptorWrite(&pDescriptorWrites[index0], true);
+            skip |= ValidateDescriptorWrite(&pDescriptorWrites[index0], true, valid_objects);
         }
     }
     return skip;
 }
 
 void ObjectLifetimes::CreateQueue(VkQueue vkObj) {
-    std::shared_ptr<ObjTrackState> p_obj_node = NULL;
-    auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
-    if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
-        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, p_obj_node);
+    // Queues retrieved again keep their ObjTrackState, which holds the same values
+    if (!object_map[kVulkanObjectTypeQueue].contains(HandleToUint64(vkObj))) {
+        ObjTrackState obj_node = {};
+        obj_node.object_type = kVulkanObjectTypeQueue;
+        obj_node.status = OBJSTATUS_NONE;
+        obj_node.handle = HandleToUint64(vkObj);
+        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, obj_node);
         num_objects[kVulkanObjectTypeQueue]++;
         num_total_objects++;
-    } else {
-        p_obj_node = queue_item->second;
     }
-    p_obj_node->object_type = kVulkanObjectTypeQueue;
-    p_obj_node->status = OBJSTATUS_NONE;
-    p_obj_node->handle = HandleToUint64(vkObj);
 }
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain) {
     if (!swapchainImageMap.contains(HandleToUint64(swapchain_image))) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
-        new_obj_node->object_type = kVulkanObjectTypeImage;
-        new_obj_node->status = OBJSTATUS_NONE;
-        new_obj_node->handle = HandleToUint64(swapchain_image);
-        new_obj_node->parent_object = HandleToUint64(swapchain);
+        ObjTrackState new_obj_node = {};
+        new_obj_node.object_type = kVulkanObjectTypeImage;
+        new_obj_node.status = OBJSTATUS_NONE;
+        new_obj_node.handle = HandleToUint64(swapchain_image);
+        new_obj_node.parent_object = HandleToUint64(swapchain);
         InsertObject(swapchainImageMap, swapchain_image, kVulkanObjectTypeImage, new_obj_node);
     }
 }
@@ -425,21 +464,24 @@ bool ObjectLifetimes::PreCallValidateUpdateDescriptorSets(VkDevice device, uint3
                                                           const VkCopyDescriptorSet *pDescriptorCopies) const {
     bool skip = false;
     skip |= ValidateObject(device, kVulkanObjectTypeDevice, false, "VUID-vkUpdateDescriptorSets-device-parameter", kVUIDUndefined);
+    ValidObjectCache valid_objects;
     if (pDescriptorCopies) {
         for (uint32_t idx0 = 0; idx0 < descriptorCopyCount; ++idx0) {
             if (pDescriptorCopies[idx0].dstSet) {
                 skip |= ValidateObject(pDescriptorCopies[idx0].dstSet, kVulkanObjectTypeDescriptorSet, false,
-                                       "VUID-VkCopyDescriptorSet-dstSet-parameter", "VUID-VkCopyDescriptorSet-commonparent");
+                                       "VUID-VkCopyDescriptorSet-dstSet-parameter", "VUID-VkCopyDescriptorSet-commonparent",
+                                       valid_objects);
             }
             if (pDescriptorCopies[idx0].srcSet) {
                 skip |= ValidateObject(pDescriptorCopies[idx0].srcSet, kVulkanObjectTypeDescriptorSet, false,
-                                       "VUID-VkCopyDescriptorSet-srcSet-parameter", "VUID-VkCopyDescriptorSet-commonparent");
+                                       "VUID-VkCopyDescriptorSet-srcSet-parameter", "VUID-VkCopyDescriptorSet-commonparent",
+                                       valid_objects);
             }
         }
     }
     if (pDescriptorWrites) {
         for (uint32_t idx1 = 0; idx1 < descriptorWriteCount; ++idx1) {
-            skip |= ValidateDescriptorWrite(&pDescriptorWrites[idx1], false);
+            skip |= ValidateDescriptorWrite(&pDescriptorWrites[idx1], false, valid_objects);
         }
     }
     return skip;
@@ -448,21 +490,10 @@ bool ObjectLifetimes::PreCallValidateUpdateDescriptorSets(VkDevice device, uint3
 bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                          VkDescriptorPoolResetFlags flags) const {
     bool skip = false;
-    auto lock = ReadSharedLock();
-
     skip |= ValidateObject(device, kVulkanObjectTypeDevice, false, "VUID-vkResetDescriptorPool-device-parameter", kVUIDUndefined);
     skip |=
         ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, false,
                        "VUID-vkResetDescriptorPool-descriptorPool-parameter", "VUID-vkResetDescriptorPool-descriptorPool-parent");
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
-    }
     return skip;
 }
 
@@ -471,14 +502,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     auto lock = WriteSharedLock();
     // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Remove this pool's descriptor sets from
     // our descriptorSet map.
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
-    }
+    DestroyPoolChildren(descriptor_pool_children, HandleToUint64(descriptorPool), kVulkanObjectTypeDescriptorSet);
 }
 
 bool ObjectLifetimes::PreCallValidateBeginCommandBuffer(VkCommandBuffer command_buffer,
@@ -487,9 +511,8 @@ bool ObjectLifetimes::PreCallValidateBeginCommandBuffer(VkCommandBuffer command_
     skip |= ValidateObject(command_buffer, kVulkanObjectTypeCommandBuffer, false,
                            "VUID-vkBeginCommandBuffer-commandBuffer-parameter", kVUIDUndefined);
     if (begin_info) {
-        auto iter = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(command_buffer));
-        if (iter != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-            auto node = iter->second;
+        const ObjTrackState *node = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(command_buffer));
+        if (node) {
             if ((begin_info->pInheritanceInfo) && (node->status & OBJSTATUS_COMMAND_BUFFER_SECONDARY) &&
                 (begin_info->flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
                 skip |=
@@ -647,6 +670,7 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, VkResult result) {
     if (result != VK_SUCCESS) return;
+    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
         AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level);
     }
@@ -696,9 +720,13 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers) {
+    auto lock = WriteSharedLock();
+    size_t freed_count = 0;
     for (uint32_t i = 0; i < commandBufferCount; i++) {
+        if (pCommandBuffers[i] != VK_NULL_HANDLE) ++freed_count;
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
     }
+    FreePoolChildren(command_pool_children, HandleToUint64(commandPool), kVulkanObjectTypeCommandBuffer, freed_count);
 }
 
 bool ObjectLifetimes::PreCallValidateDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
@@ -712,7 +740,7 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
 
     auto snapshot = swapchainImageMap.snapshot(
-        [swapchain](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
+        [swapchain](const ObjTrackState &node) { return node.parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
         swapchainImageMap.erase(itr.first);
     }
@@ -737,36 +765,21 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets) {
     auto lock = WriteSharedLock();
-    std::shared_ptr<ObjTrackState> pool_node = nullptr;
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        pool_node = itr->second;
-    }
+    size_t freed_count = 0;
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
+        if (pDescriptorSets[i] != VK_NULL_HANDLE) ++freed_count;
         RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
-        if (pool_node) {
-            pool_node->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
-        }
     }
+    FreePoolChildren(descriptor_pool_children, HandleToUint64(descriptorPool), kVulkanObjectTypeDescriptorSet, freed_count);
 }
 
 bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                            const VkAllocationCallbacks *pAllocator) const {
-    auto lock = ReadSharedLock();
     bool skip = false;
     skip |= ValidateObject(device, kVulkanObjectTypeDevice, false, "VUID-vkDestroyDescriptorPool-device-parameter", kVUIDUndefined);
     skip |= ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, true,
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parameter",
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parent");
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
-    }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00304",
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00305");
@@ -775,14 +788,7 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
 void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                          const VkAllocationCallbacks *pAllocator) {
     auto lock = WriteSharedLock();
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
-    }
+    DestroyPoolChildren(descriptor_pool_children, HandleToUint64(descriptorPool), kVulkanObjectTypeDescriptorSet);
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
 
@@ -792,15 +798,6 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(device, kVulkanObjectTypeDevice, false, "VUID-vkDestroyCommandPool-device-parameter", kVUIDUndefined);
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent");
-
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first));
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined);
-    }
     skip |= ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator,
                                   "VUID-vkDestroyCommandPool-commandPool-00042", "VUID-vkDestroyCommandPool-commandPool-00043");
     return skip;
@@ -808,12 +805,9 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+    auto lock = WriteSharedLock();
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
-    }
+    DestroyPoolChildren(command_pool_children, HandleToUint64(commandPool), kVulkanObjectTypeCommandBuffer);
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
 
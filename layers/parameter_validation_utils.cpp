@@ -37,6 +37,16 @@ inline bool in_inclusive_range(const T &value, const T &min, const T &max) {
 ReadLockGuard StatelessValidation::ReadLock() { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 WriteLockGuard StatelessValidation::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
 
+void StatelessValidation::GetValidationCounters(ValidationCounterList &counters) const {
+    AddValidationCounter(counters, "StatelessValidation.buffer_create_info_memo_hits", buffer_create_info_memo.hits.Get());
+    AddValidationCounter(counters, "StatelessValidation.buffer_create_info_memo_misses", buffer_create_info_memo.misses.Get());
+    AddValidationCounter(counters, "StatelessValidation.image_view_create_info_memo_hits", image_view_create_info_memo.hits.Get());
+    AddValidationCounter(counters, "StatelessValidation.image_view_create_info_memo_misses",
+                         image_view_create_info_memo.misses.Get());
+    AddValidationCounter(counters, "StatelessValidation.sampler_create_info_memo_hits", sampler_create_info_memo.hits.Get());
+    AddValidationCounter(counters, "StatelessValidation.sampler_create_info_memo_misses", sampler_create_info_memo.misses.Get());
+}
+
 static layer_data::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
 static ReadWriteLock secondary_cb_map_mutex;
 static ReadLockGuard CBReadLock() { return ReadLockGuard(secondary_cb_map_mutex); }
@@ -127,6 +127,46 @@ static PushConstantRangesId GetPushConstantRangesFromLayouts(const layer_data::s
     return ret;
 }
 
+// Ranges past max_size are invalid, and clamped so that a bad range can't size the table
+static std::vector<VkShaderStageFlags> GetPushConstantByteStages(const PushConstantRangesId &push_constant_ranges,
+                                                                 uint32_t max_size) {
+    std::vector<VkShaderStageFlags> byte_stages;
+    if (!push_constant_ranges) {
+        return byte_stages;
+    }
+    for (const auto &range : *push_constant_ranges) {
+        const uint32_t begin = std::min(range.offset, max_size);
+        const uint32_t end = std::min(range.offset + std::min(range.size, max_size), max_size);
+        if (byte_stages.size() < end) {
+            byte_stages.resize(end, 0);
+        }
+        for (uint32_t byte = begin; byte < end; ++byte) {
+            byte_stages[byte] |= range.stageFlags;
+        }
+    }
+    return byte_stages;
+}
+
+static std::vector<VkShaderStageFlags> GetPushConstantByteStagesFromLayouts(
+    const layer_data::span<const PIPELINE_LAYOUT_STATE *const> &layouts, const PushConstantRangesId &push_constant_ranges) {
+    for (const auto *layout : layouts) {
+        if (layout && layout->push_constant_ranges == push_constant_ranges) {
+            return layout->push_constant_byte_stages;
+        }
+    }
+    return {};
+}
+
+static VkShaderStageFlags GetPushConstantStages(const PushConstantRangesId &push_constant_ranges) {
+    VkShaderStageFlags stages = 0;
+    if (push_constant_ranges) {
+        for (const auto &range : *push_constant_ranges) {
+            stages |= range.stageFlags;
+        }
+    }
+    return stages;
+}
+
 static PIPELINE_LAYOUT_STATE::SetLayoutVector GetSetLayouts(ValidationStateTracker *dev_data,
                                                             const VkPipelineLayoutCreateInfo *pCreateInfo) {
     PIPELINE_LAYOUT_STATE::SetLayoutVector set_layouts(pCreateInfo->setLayoutCount);
@@ -206,6 +246,9 @@ PIPELINE_LAYOUT_STATE::PIPELINE_LAYOUT_STATE(ValidationStateTracker *dev_data, V
     : BASE_NODE(l, kVulkanObjectTypePipelineLayout),
       set_layouts(GetSetLayouts(dev_data, pCreateInfo)),
       push_constant_ranges(GetCanonicalId(pCreateInfo)),
+      push_constant_byte_stages(
+          GetPushConstantByteStages(push_constant_ranges, dev_data->phys_dev_props.limits.maxPushConstantsSize)),
+      push_constant_stages(GetPushConstantStages(push_constant_ranges)),
       compat_for_set(GetCompatForSet(set_layouts, push_constant_ranges)),
       create_flags(pCreateInfo->flags) {}
 
@@ -213,5 +256,7 @@ PIPELINE_LAYOUT_STATE::PIPELINE_LAYOUT_STATE(const layer_data::span<const PIPELI
     : BASE_NODE(static_cast<VkPipelineLayout>(VK_NULL_HANDLE), kVulkanObjectTypePipelineLayout),
       set_layouts(GetSetLayouts(layouts)),
       push_constant_ranges(GetPushConstantRangesFromLayouts(layouts)),  // TODO is this correct?
+      push_constant_byte_stages(GetPushConstantByteStagesFromLayouts(layouts, push_constant_ranges)),
+      push_constant_stages(GetPushConstantStages(push_constant_ranges)),
       compat_for_set(GetCompatForSet(set_layouts, push_constant_ranges)),
       create_flags(GetCreateFlags(layouts)) {}
@@ -81,6 +81,10 @@ class PIPELINE_LAYOUT_STATE : public BASE_NODE {
     const SetLayoutVector set_layouts;
     // canonical form IDs for the "compatible for set" contents
     const PushConstantRangesId push_constant_ranges;
+    // By byte of push constant data, the stages of the push constant ranges that contain it. Empty past the last range.
+    const std::vector<VkShaderStageFlags> push_constant_byte_stages;
+    // The stages of all push constant ranges
+    const VkShaderStageFlags push_constant_stages;
     // table of "compatible for set N" cannonical forms for trivial accept validation
     const std::vector<PipelineLayoutCompatId> compat_for_set;
     VkPipelineLayoutCreateFlags create_flags;
@@ -31,45 +31,19 @@
 #include "state_tracker.h"
 #include "shader_module.h"
 
-static bool HasWriteableDescriptor(const std::vector<PipelineStageState::DescriptorUse> &descriptor_uses) {
-    return std::any_of(descriptor_uses.begin(), descriptor_uses.end(),
-                       [](const PipelineStageState::DescriptorUse &use) { return use.second.is_writable; });
-}
-
-static bool HasAtomicDescriptor(const std::vector<PipelineStageState::DescriptorUse> &descriptor_uses) {
-    return std::any_of(descriptor_uses.begin(), descriptor_uses.end(),
-                       [](const PipelineStageState::DescriptorUse &use) { return use.second.is_atomic_operation; });
-}
-
-static bool WrotePrimitiveShadingRate(VkShaderStageFlagBits stage_flag, spirv_inst_iter entrypoint,
-                                      const SHADER_MODULE_STATE *module_state) {
-    bool primitiverate_written = false;
-    if (stage_flag == VK_SHADER_STAGE_VERTEX_BIT || stage_flag == VK_SHADER_STAGE_GEOMETRY_BIT ||
-        stage_flag == VK_SHADER_STAGE_MESH_BIT_NV) {
-        for (const auto &set : module_state->GetBuiltinDecorationList()) {
-            auto insn = module_state->at(set.offset);
-            if (set.builtin == spv::BuiltInPrimitiveShadingRateKHR) {
-                primitiverate_written = module_state->IsBuiltInWritten(insn, entrypoint);
-            }
-            if (primitiverate_written) {
-                break;
-            }
-        }
-    }
-    return primitiverate_written;
-}
-
 PipelineStageState::PipelineStageState(const safe_VkPipelineShaderStageCreateInfo *stage,
                                        std::shared_ptr<const SHADER_MODULE_STATE> &module_state)
     : module_state(module_state),
       create_info(stage),
       stage_flag(stage->stage),
-      entrypoint(module_state->FindEntrypoint(stage->pName, stage->stage)),
-      accessible_ids(module_state->MarkAccessibleIds(entrypoint)),
-      descriptor_uses(module_state->CollectInterfaceByDescriptorSlot(accessible_ids)),
-      has_writable_descriptor(HasWriteableDescriptor(descriptor_uses)),
-      has_atomic_descriptor(HasAtomicDescriptor(descriptor_uses)),
-      wrote_primitive_shading_rate(WrotePrimitiveShadingRate(stage_flag, entrypoint, module_state.get())) {}
+      entry_point_state(module_state->GetEntryPointState(stage->pName, stage->stage)),
+      entrypoint(entry_point_state->entrypoint),
+      accessible_ids(entry_point_state->accessible_ids),
+      descriptor_uses(entry_point_state->descriptor_uses),
+      has_writable_descriptor(entry_point_state->has_writable_descriptor),
+      has_atomic_descriptor(entry_point_state->has_atomic_descriptor),
+      wrote_primitive_shading_rate(entry_point_state->wrote_primitive_shading_rate),
+      push_constant_used_in_shader(entry_point_state->push_constant_used_in_shader) {}
 
 // static
 PIPELINE_STATE::StageStateVec PIPELINE_STATE::GetStageStates(const ValidationStateTracker &state_data,
@@ -107,30 +81,35 @@ PIPELINE_STATE::StageStateVec PIPELINE_STATE::GetStageStates(const ValidationSta
                     if (pipe_state.pre_raster_state && pipe_state.pre_raster_state->vertex_shader) {
                         stage_states.emplace_back(pipe_state.pre_raster_state->vertex_shader_ci,
                                                   pipe_state.pre_raster_state->vertex_shader);
+                        stage_states.back().from_library = true;
                     }
                     break;
                 case VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT:
                     if (pipe_state.pre_raster_state && pipe_state.pre_raster_state->tessc_shader) {
                         stage_states.emplace_back(pipe_state.pre_raster_state->tessc_shader_ci,
                                                   pipe_state.pre_raster_state->tessc_shader);
+                        stage_states.back().from_library = true;
                     }
                     break;
                 case VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT:
                     if (pipe_state.pre_raster_state && pipe_state.pre_raster_state->tesse_shader) {
                         stage_states.emplace_back(pipe_state.pre_raster_state->tesse_shader_ci,
                                                   pipe_state.pre_raster_state->tesse_shader);
+                        stage_states.back().from_library = true;
                     }
                     break;
                 case VK_SHADER_STAGE_GEOMETRY_BIT:
                     if (pipe_state.pre_raster_state && pipe_state.pre_raster_state->geometry_shader) {
                         stage_states.emplace_back(pipe_state.pre_raster_state->geometry_shader_ci,
                                                   pipe_state.pre_raster_state->geometry_shader);
+                        stage_states.back().from_library = true;
                     }
                     break;
                 case VK_SHADER_STAGE_FRAGMENT_BIT:
                     if (pipe_state.fragment_shader_state && pipe_state.fragment_shader_state->fragment_shader) {
                         stage_states.emplace_back(pipe_state.fragment_shader_state->fragment_shader_ci.get(),
                                                   pipe_state.fragment_shader_state->fragment_shader);
+                        stage_states.back().from_library = true;
                     }
                     break;
                 default:
@@ -181,6 +160,22 @@ PIPELINE_STATE::ActiveSlotMap PIPELINE_STATE::GetActiveSlots(const StageStateVec
     return active_slots;
 }
 
+// static
+std::vector<BindingReqFlagsVec> PIPELINE_STATE::GetActiveSlotFlags(const ActiveSlotMap &active_slots) {
+    std::vector<BindingReqFlagsVec> active_slot_flags;
+    for (const auto &set_binding_pair : active_slots) {
+        if (set_binding_pair.first >= active_slot_flags.size()) {
+            active_slot_flags.resize(set_binding_pair.first + 1);
+        }
+        auto &flags = active_slot_flags[set_binding_pair.first];
+        flags.reserve(set_binding_pair.second.size());
+        for (const auto &binding_req_pair : set_binding_pair.second) {
+            flags.emplace_back(binding_req_pair.first, binding_req_pair.second.reqs);
+        }
+    }
+    return active_slot_flags;
+}
+
 static uint32_t GetMaxActiveSlot(const PIPELINE_STATE::ActiveSlotMap &active_slots) {
     uint32_t max_active_slot = 0;
     for (const auto &entry : active_slots) {
@@ -226,6 +221,62 @@ static VkPrimitiveTopology GetTopologyAtRasterizer(const PIPELINE_STATE::StageSt
     return result;
 }
 
+static CBStatusFlags GetDynamicStateStatus(const safe_VkPipelineDynamicStateCreateInfo *dynamic_state) {
+    CBStatusFlags result = CBSTATUS_NONE;
+    if (dynamic_state) {
+        for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; i++) {
+            result |= ConvertToCBStatusFlagBits(dynamic_state->pDynamicStates[i]);
+        }
+    }
+    return result;
+}
+
+// The states CoreChecks::ValidateDrawStateFlags requires to be set, static or dynamic, before drawing with the pipeline
+static CBStatusFlags GetRequiredDrawStatus(const PIPELINE_STATE &pipeline) {
+    CBStatusFlags result = CBSTATUS_NONE;
+    const bool line_topology = pipeline.topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_LIST ||
+                               pipeline.topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
+    const auto *raster_state = pipeline.RasterizationState();
+    if (line_topology) {
+        result |= CBSTATUS_LINE_WIDTH_SET;
+        const auto *line_state = LvlFindInChain<VkPipelineRasterizationLineStateCreateInfoEXT>(raster_state);
+        if (line_state && line_state->stippledLineEnable) {
+            result |= CBSTATUS_LINE_STIPPLE_SET;
+        }
+    }
+    if (raster_state && (raster_state->depthBiasEnable == VK_TRUE)) {
+        result |= CBSTATUS_DEPTH_BIAS_SET;
+    }
+    if (pipeline.BlendConstantsEnabled()) {
+        result |= CBSTATUS_BLEND_CONSTANTS_SET;
+    }
+    const auto *ds_state = pipeline.DepthStencilState();
+    if (ds_state && (ds_state->depthBoundsTestEnable == VK_TRUE)) {
+        result |= CBSTATUS_DEPTH_BOUNDS_SET;
+    }
+    if (ds_state && (ds_state->stencilTestEnable == VK_TRUE)) {
+        result |= CBSTATUS_STENCIL_READ_MASK_SET | CBSTATUS_STENCIL_WRITE_MASK_SET | CBSTATUS_STENCIL_REFERENCE_SET;
+    }
+    return result;
+}
+
+bool PIPELINE_STATE::IsDynamic(VkDynamicState state) const {
+    if (GetPipelineType() != VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        return false;
+    }
+    const CBStatusFlags status = ConvertToCBStatusFlagBits(state);
+    if (status != CBSTATUS_NONE) {
+        return (dynamic_state_status & status) != 0;
+    }
+    const auto *dynamic_state = DynamicState();
+    if (dynamic_state) {
+        for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; i++) {
+            if (state == dynamic_state->pDynamicStates[i]) return true;
+        }
+    }
+    return false;
+}
+
 // static
 std::shared_ptr<VertexInputState> PIPELINE_STATE::CreateVertexInputState(const PIPELINE_STATE &p,
                                                                          const ValidationStateTracker &state,
@@ -360,8 +411,11 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
       fragmentShader_writable_output_location_list(GetFSOutputLocations(stage_state)),
       active_slots(GetActiveSlots(stage_state)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
+      active_slot_flags(GetActiveSlotFlags(active_slots)),
       active_shaders(GetActiveShaders(stage_state)),
-      topology_at_rasterizer(GetTopologyAtRasterizer(stage_state, create_info.graphics.pInputAssemblyState)) {
+      topology_at_rasterizer(GetTopologyAtRasterizer(stage_state, create_info.graphics.pInputAssemblyState)),
+      dynamic_state_status(GetDynamicStateStatus(DynamicState())),
+      required_draw_status(GetRequiredDrawStatus(*this)) {
     const auto link_info = LvlFindInChain<VkPipelineLibraryCreateInfoKHR>(PNext());
     if (link_info) {
         // accumulate dynamic state
@@ -427,6 +481,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
       create_info(pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
+      active_slot_flags(GetActiveSlotFlags(active_slots)),
       active_shaders(GetActiveShaders(stage_state)),
       topology_at_rasterizer{},
       merged_graphics_layout(layout) {
@@ -439,6 +494,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
       create_info(pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
+      active_slot_flags(GetActiveSlotFlags(active_slots)),
       active_shaders(GetActiveShaders(stage_state)),
       topology_at_rasterizer{},
       merged_graphics_layout(std::move(layout)) {
@@ -453,6 +509,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
       create_info(pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
+      active_slot_flags(GetActiveSlotFlags(active_slots)),
       active_shaders(GetActiveShaders(stage_state)),
       topology_at_rasterizer{},
       merged_graphics_layout(std::move(layout)) {
@@ -483,4 +540,20 @@ void LAST_BOUND_STATE::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    dynamic_offsets.clear();
+}
+
+void LAST_BOUND_STATE::SetDynamicOffsets(PER_SET &set, uint32_t count, const uint32_t *offsets) {
+    if (count > set.dynamic_offset_capacity) {
+        // The set's old entries stay unused until the next reset
+        const uint32_t index = dynamic_offsets.size();
+        if (index + count > dynamic_offsets.capacity()) {
+            dynamic_offsets.reserve(std::max(2 * dynamic_offsets.capacity(), index + count));
+        }
+        dynamic_offsets.resize(index + count);
+        set.dynamic_offset_index = index;
+        set.dynamic_offset_capacity = count;
+    }
+    std::copy(offsets, offsets + count, dynamic_offsets.begin() + set.dynamic_offset_index);
+    set.dynamic_offset_count = count;
 }
@@ -50,6 +50,55 @@ class RENDER_PASS_STATE;
 struct SHADER_MODULE_STATE;
 class PIPELINE_STATE;
 
+// CB Status -- used to track status of various bindings on cmd buffer objects, and the dynamic states of pipelines
+typedef uint64_t CBStatusFlags;
+enum CBStatusFlagBits : uint64_t {
+    // clang-format off
+    CBSTATUS_NONE                            = 0x00000000,   // No status is set
+    CBSTATUS_LINE_WIDTH_SET                  = 0x00000001,   // Line width has been set
+    CBSTATUS_DEPTH_BIAS_SET                  = 0x00000002,   // Depth bias has been set
+    CBSTATUS_BLEND_CONSTANTS_SET             = 0x00000004,   // Blend constants state has been set
+    CBSTATUS_DEPTH_BOUNDS_SET                = 0x00000008,   // Depth bounds state object has been set
+    CBSTATUS_STENCIL_READ_MASK_SET           = 0x00000010,   // Stencil read mask has been set
+    CBSTATUS_STENCIL_WRITE_MASK_SET          = 0x00000020,   // Stencil write mask has been set
+    CBSTATUS_STENCIL_REFERENCE_SET           = 0x00000040,   // Stencil reference has been set
+    CBSTATUS_VIEWPORT_SET                    = 0x00000080,
+    CBSTATUS_SCISSOR_SET                     = 0x00000100,
+    CBSTATUS_INDEX_BUFFER_BOUND              = 0x00000200,   // Index buffer has been set
+    CBSTATUS_EXCLUSIVE_SCISSOR_SET           = 0x00000400,
+    CBSTATUS_SHADING_RATE_PALETTE_SET        = 0x00000800,
+    CBSTATUS_LINE_STIPPLE_SET                = 0x00001000,
+    CBSTATUS_VIEWPORT_W_SCALING_SET          = 0x00002000,
+    CBSTATUS_CULL_MODE_SET                   = 0x00004000,
+    CBSTATUS_FRONT_FACE_SET                  = 0x00008000,
+    CBSTATUS_PRIMITIVE_TOPOLOGY_SET          = 0x00010000,
+    CBSTATUS_VIEWPORT_WITH_COUNT_SET         = 0x00020000,
+    CBSTATUS_SCISSOR_WITH_COUNT_SET          = 0x00040000,
+    CBSTATUS_VERTEX_INPUT_BINDING_STRIDE_SET = 0x00080000,
+    CBSTATUS_DEPTH_TEST_ENABLE_SET           = 0x00100000,
+    CBSTATUS_DEPTH_WRITE_ENABLE_SET          = 0x00200000,
+    CBSTATUS_DEPTH_COMPARE_OP_SET            = 0x00400000,
+    CBSTATUS_DEPTH_BOUNDS_TEST_ENABLE_SET    = 0x00800000,
+    CBSTATUS_STENCIL_TEST_ENABLE_SET         = 0x01000000,
+    CBSTATUS_STENCIL_OP_SET                  = 0x02000000,
+    CBSTATUS_DISCARD_RECTANGLE_SET           = 0x04000000,
+    CBSTATUS_SAMPLE_LOCATIONS_SET            = 0x08000000,
+    CBSTATUS_COARSE_SAMPLE_ORDER_SET         = 0x10000000,
+    CBSTATUS_PATCH_CONTROL_POINTS_SET        = 0x20000000,
+    CBSTATUS_RASTERIZER_DISCARD_ENABLE_SET   = 0x40000000,
+    CBSTATUS_DEPTH_BIAS_ENABLE_SET           = 0x80000000,
+    CBSTATUS_LOGIC_OP_SET                    = 0x100000000,
+    CBSTATUS_PRIMITIVE_RESTART_ENABLE_SET    = 0x200000000,
+    CBSTATUS_VERTEX_INPUT_SET                = 0x400000000,
+    CBSTATUS_COLOR_WRITE_ENABLE_SET          = 0x800000000,
+    CBSTATUS_ALL_STATE_SET                   = 0xFFFFFFDFF,   // All state set (intentionally exclude index buffer)
+    // clang-format on
+};
+
+VkDynamicState ConvertToDynamicState(CBStatusFlagBits flag);
+CBStatusFlagBits ConvertToCBStatusFlagBits(VkDynamicState state);
+std::string DynamicStateString(CBStatusFlags input_value);
+
 // Flags describing requirements imposed by the pipeline on a descriptor. These
 // can't be checked at pipeline creation time as they depend on the Image or
 // ImageView bound.
@@ -97,17 +146,40 @@ inline bool operator<(const DescriptorRequirement &a, const DescriptorRequiremen
 
 typedef std::map<uint32_t, DescriptorRequirement> BindingReqMap;
 
+// The (binding, reqs) pairs of a BindingReqMap in the same order, which is all that decides whether bindings validated for one
+// pipeline are still validated for another. Cheap to copy and compare, unlike the map itself.
+typedef std::vector<std::pair<uint32_t, DescriptorReqFlags>> BindingReqFlagsVec;
+
+// Orders BindingReqMap entries and BindingReqFlagsVec entries against each other, for std::includes and std::set_difference
+struct BindingReqLess {
+    bool operator()(const BindingReqMap::value_type &a, const BindingReqMap::value_type &b) const {
+        return (a.first < b.first) || (a.first == b.first && a.second.reqs < b.second.reqs);
+    }
+    bool operator()(const BindingReqFlagsVec::value_type &a, const BindingReqFlagsVec::value_type &b) const { return a < b; }
+    bool operator()(const BindingReqMap::value_type &a, const BindingReqFlagsVec::value_type &b) const {
+        return (a.first < b.first) || (a.first == b.first && a.second.reqs < b.second);
+    }
+    bool operator()(const BindingReqFlagsVec::value_type &a, const BindingReqMap::value_type &b) const {
+        return (a.first < b.first) || (a.first == b.first && a.second < b.second.reqs);
+    }
+};
+
 struct PipelineStageState {
     std::shared_ptr<const SHADER_MODULE_STATE> module_state;
     const safe_VkPipelineShaderStageCreateInfo *create_info;
     VkShaderStageFlagBits stage_flag;
+    // Shared with every other pipeline stage using the same module and entry point
+    std::shared_ptr<const SHADER_MODULE_STATE::EntryPointState> entry_point_state;
     spirv_inst_iter entrypoint;
-    layer_data::unordered_set<uint32_t> accessible_ids;
-    using DescriptorUse = std::pair<DescriptorSlot, interface_var>;
-    std::vector<DescriptorUse> descriptor_uses;
+    const layer_data::unordered_set<uint32_t> &accessible_ids;
+    using DescriptorUse = SHADER_MODULE_STATE::EntryPointState::DescriptorUse;
+    const std::vector<DescriptorUse> &descriptor_uses;
     bool has_writable_descriptor;
     bool has_atomic_descriptor;
     bool wrote_primitive_shading_rate;
+    const shader_struct_member &push_constant_used_in_shader;
+    // The stage comes from a linked graphics library, which validated it when the library was created
+    bool from_library = false;
 
     PipelineStageState(const safe_VkPipelineShaderStageCreateInfo *stage, std::shared_ptr<const SHADER_MODULE_STATE> &module_state);
 };
@@ -190,11 +262,18 @@ class PIPELINE_STATE : public BASE_NODE {
     // are updated at various times. Locking requirements are TBD.
     const ActiveSlotMap active_slots;
     const uint32_t max_active_slot = 0;  // the highest set number in active_slots for pipeline layout compatibility checks
+    // active_slots flattened, indexed by set number and sorted by binding. Sets the shaders do not use are empty.
+    const std::vector<BindingReqFlagsVec> active_slot_flags;
 
     // Flag of which shader stages are active for this pipeline
     const uint32_t active_shaders = 0;
     const VkPrimitiveTopology topology_at_rasterizer;
 
+    // CBSTATUS bits of the states the pipeline makes dynamic
+    const CBStatusFlags dynamic_state_status = CBSTATUS_NONE;
+    // CBSTATUS bits draws with the pipeline need to have set, not counting the index buffer of indexed draws
+    const CBStatusFlags required_draw_status = CBSTATUS_NONE;
+
     // Executable or legacy pipeline
     PIPELINE_STATE(const ValidationStateTracker *state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
                    std::shared_ptr<const RENDER_PASS_STATE> &&rpstate, std::shared_ptr<const PIPELINE_LAYOUT_STATE> &&layout);
@@ -389,6 +468,9 @@ class PIPELINE_STATE : public BASE_NODE {
 
     bool BlendConstantsEnabled() const { return fragment_output_state ? fragment_output_state->blend_constants_enabled : false; }
 
+    // States without a CBSTATUS bit are looked up in the dynamic state create info
+    bool IsDynamic(VkDynamicState state) const;
+
     bool SampleLocationEnabled() const { return fragment_output_state ? fragment_output_state->sample_location_enabled : false; }
 
     VkPipeline BasePipeline() const { return create_info.graphics.basePipelineHandle; }
@@ -424,6 +506,7 @@ class PIPELINE_STATE : public BASE_NODE {
     const void *PNext() const { return create_info.graphics.pNext; }
 
     static ActiveSlotMap GetActiveSlots(const StageStateVec &stage_states);
+    static std::vector<BindingReqFlagsVec> GetActiveSlotFlags(const ActiveSlotMap &active_slots);
     static StageStateVec GetStageStates(const ValidationStateTracker &state_data, const PIPELINE_STATE &pipe_state);
 
   protected:
@@ -505,18 +588,30 @@ struct LAST_BOUND_STATE {
     // Ordered bound set tracking where index is set# that given set is bound to
     struct PER_SET {
         std::shared_ptr<cvdescriptorset::DescriptorSet> bound_descriptor_set;
-        // one dynamic offset per dynamic descriptor bound to this CB
-        std::vector<uint32_t> dynamicOffsets;
+        // one dynamic offset per dynamic descriptor bound to this CB, kept in dynamic_offsets from dynamic_offset_index. The
+        // set reuses its dynamic_offset_capacity entries there each time it is bound.
+        uint32_t dynamic_offset_index{0};
+        uint32_t dynamic_offset_count{0};
+        uint32_t dynamic_offset_capacity{0};
         PipelineLayoutCompatId compat_id_for_set{0};
 
         // Cache most recently validated descriptor state for ValidateCmdBufDrawState/UpdateDrawState
         const cvdescriptorset::DescriptorSet *validated_set{nullptr};
         uint64_t validated_set_change_count{~0ULL};
         uint64_t validated_set_image_layout_change_count{~0ULL};
-        BindingReqMap validated_set_binding_req_map;
+        BindingReqFlagsVec validated_set_binding_reqs;
     };
 
-    std::vector<PER_SET> per_set;
+    // Binding sets doesn't allocate once the command buffer has bound as many sets and dynamic offsets as it will, the storage
+    // keeps its capacity through resets. Past the inline capacity, per_set grows once to maxBoundDescriptorSets.
+    static const uint32_t kInlineSets = 8;
+    static const uint32_t kInlineDynamicOffsets = 32;
+    using PerSets = small_vector<PER_SET, kInlineSets, uint32_t>;
+    PerSets per_set;
+    small_vector<uint32_t, kInlineDynamicOffsets, uint32_t> dynamic_offsets;
+
+    const uint32_t *DynamicOffsets(const PER_SET &set) const { return dynamic_offsets.begin() + set.dynamic_offset_index; }
+    void SetDynamicOffsets(PER_SET &set, uint32_t count, const uint32_t *offsets);
 
     void Reset();
 
@@ -525,8 +620,10 @@ struct LAST_BOUND_STATE {
     inline bool IsUsing() const { return pipeline_state ? true : false; }
 };
 
+// Compatibility ids are canonical, so equal definitions always share an id and comparing the ids is enough
 static inline bool CompatForSet(uint32_t set, const LAST_BOUND_STATE &a, const std::vector<PipelineLayoutCompatId> &b) {
-    bool result = (set < a.per_set.size()) && (set < b.size()) && (*(a.per_set[set].compat_id_for_set) == *b[set]);
+    bool result = (set < a.per_set.size()) && (set < b.size()) && a.per_set[set].compat_id_for_set &&
+                  (a.per_set[set].compat_id_for_set == b[set]);
     return result;
 }
 
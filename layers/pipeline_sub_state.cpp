@@ -51,9 +51,63 @@ VertexInputState::VertexInputState(const PIPELINE_STATE &p, const safe_VkGraphic
             }
             vertex_attribute_alignments.push_back(vtx_attrib_req_alignment);
         }
+        has_binding_plan = BuildBindingPlan();
     }
 }
 
+bool VertexInputState::BuildBindingPlan() {
+    const auto *divisor_state = LvlFindInChain<VkPipelineVertexInputDivisorStateCreateInfoEXT>(input_state->pNext);
+    for (const auto &desc : binding_descriptions) {
+        if (desc.binding >= 64) {
+            return false;
+        }
+        required_bindings |= 1ull << desc.binding;
+        required_binding_count = std::max(required_binding_count, desc.binding + 1);
+    }
+
+    for (size_t i = 0; i < vertex_attribute_descriptions.size(); ++i) {
+        const auto &attr = vertex_attribute_descriptions[i];
+        const auto binding_it = binding_to_index_map.find(attr.binding);
+        if (binding_it == binding_to_index_map.end()) {
+            return false;
+        }
+        const VkDeviceSize alignment = std::max(vertex_attribute_alignments[i], VkDeviceSize(1));
+        if (!IsPowerOfTwo(static_cast<unsigned>(alignment))) {
+            return false;
+        }
+
+        auto plan = std::find_if(binding_plans.begin(), binding_plans.end(),
+                                 [&attr](const VertexBindingPlan &entry) { return entry.binding == attr.binding; });
+        if (plan == binding_plans.end()) {
+            const auto &desc = binding_descriptions[binding_it->second];
+            uint32_t divisor = 1;
+            if (divisor_state) {
+                for (uint32_t d = 0; d < divisor_state->vertexBindingDivisorCount; ++d) {
+                    if (divisor_state->pVertexBindingDivisors[d].binding == attr.binding) {
+                        divisor = divisor_state->pVertexBindingDivisors[d].divisor;
+                    }
+                }
+            }
+            binding_plans.emplace_back(VertexBindingPlan{attr.binding, desc.stride, 0, 0, 0, desc.inputRate, divisor});
+            plan = binding_plans.end() - 1;
+        }
+        plan->max_extent = std::max(plan->max_extent, attr.offset + FormatElementSize(attr.format));
+
+        // The alignments are powers of two, so both conditions hold if they agree on the bits of the smaller alignment
+        const VkDeviceSize mask = alignment - 1;
+        const VkDeviceSize residue = (VkDeviceSize(0) - attr.offset) & mask;
+        const VkDeviceSize common_mask = std::min(mask, plan->alignment_mask);
+        if ((residue & common_mask) != (plan->alignment_residue & common_mask)) {
+            return false;
+        }
+        if (mask > plan->alignment_mask) {
+            plan->alignment_mask = mask;
+            plan->alignment_residue = residue;
+        }
+    }
+    return true;
+}
+
 PreRasterState::PreRasterState(const PIPELINE_STATE &p, const ValidationStateTracker &dev_data,
                                const safe_VkGraphicsPipelineCreateInfo &create_info, std::shared_ptr<const RENDER_PASS_STATE> rp)
     : parent(p), rp_state(rp), subpass(create_info.subpass) {
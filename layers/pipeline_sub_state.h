@@ -56,8 +56,31 @@ struct VertexInputState {
     using VertexAttrAlignmentVector = std::vector<VkDeviceSize>;
     VertexAttrAlignmentVector vertex_attribute_alignments;
 
+    // What the attributes of a binding need of its vertex buffer binding at draw time
+    struct VertexBindingPlan {
+        uint32_t binding;
+        uint32_t stride;      // of the binding description, unless the stride is dynamic
+        uint32_t max_extent;  // the largest attribute offset + format size
+        // The attribute addresses are aligned if (vertex buffer offset + stride) & alignment_mask == alignment_residue
+        VkDeviceSize alignment_mask;
+        VkDeviceSize alignment_residue;
+        VkVertexInputRate input_rate;
+        // Each attribute element is fetched by this many instances, 0 for all instances, see VK_EXT_vertex_attribute_divisor
+        uint32_t divisor;
+    };
+    // Draw-time vertex buffer checks only look at each description if the bindings don't meet the plan, and synchronization
+    // validation tracks the vertex buffer ranges draws fetch from with it. There is no plan if a description has a binding
+    // past 63, or if the attributes can't all be aligned, or are of an unknown binding.
+    bool has_binding_plan = false;
+    uint64_t required_bindings = 0;       // bit b for binding b of binding_descriptions
+    uint32_t required_binding_count = 0;  // one past the largest binding of binding_descriptions
+    std::vector<VertexBindingPlan> binding_plans;
+
     std::shared_ptr<VertexInputState> FromCreateInfo(const ValidationStateTracker &state,
                                                      const safe_VkGraphicsPipelineCreateInfo &create_info);
+
+  private:
+    bool BuildBindingPlan();
 };
 
 struct PreRasterState {
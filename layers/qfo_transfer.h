@@ -171,6 +171,7 @@ struct QFOTransferBarrierSets {
         acquire.clear();
         release.clear();
     }
+    bool Empty() const { return release.empty() && acquire.empty(); }
 };
 
 // The layer_data stores the map of pending release barriers
@@ -179,12 +180,45 @@ using GlobalQFOTransferBarrierMap =
     vl_concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierSet<TransferBarrier>>;
 
 // Submit queue uses the Scoreboard to track all release/acquire operations in a batch.
+//
+// A scoreboard is reused from batch to batch rather than rebuilt. Each entry is stamped with the epoch of the batch that wrote
+// it, Reset() starts the next batch by advancing the epoch, and entries of older epochs count as absent, so that a batch reuses
+// the table slots of the batches before it.
 template <typename TransferBarrier>
-using QFOTransferCBScoreboard =
-    layer_data::unordered_map<TransferBarrier, const CMD_BUFFER_STATE *, QFOTransferBarrierHash<TransferBarrier>>;
+class QFOTransferCBScoreboard {
+  public:
+    // Records cb_state as the command buffer of barrier, unless one is already recorded in this batch. Returns the command
+    // buffer recorded for barrier.
+    const CMD_BUFFER_STATE *Emplace(const TransferBarrier &barrier, const CMD_BUFFER_STATE *cb_state) {
+        Entry &entry = entries_[barrier];
+        if (entry.epoch != epoch_) {
+            entry.epoch = epoch_;
+            entry.cb_state = cb_state;
+        }
+        return entry.cb_state;
+    }
+    void Reset() {
+        ++epoch_;
+        // Stale entries are of barriers of earlier batches, whose resources may be gone by now; don't keep them without bound
+        if (entries_.size() > kMaxRetainedEntries) entries_.clear();
+    }
+
+  private:
+    static const size_t kMaxRetainedEntries = 1024;
+    struct Entry {
+        uint64_t epoch = 0;
+        const CMD_BUFFER_STATE *cb_state = nullptr;
+    };
+    layer_data::unordered_map<TransferBarrier, Entry, QFOTransferBarrierHash<TransferBarrier>> entries_;
+    uint64_t epoch_ = 1;
+};
 
 template <typename TransferBarrier>
 struct QFOTransferCBScoreboards {
     QFOTransferCBScoreboard<TransferBarrier> acquire;
     QFOTransferCBScoreboard<TransferBarrier> release;
+    void Reset() {
+        acquire.Reset();
+        release.Reset();
+    }
 };
@@ -27,8 +27,11 @@
 #pragma once
 #include "base_node.h"
 #include "hash_vk_types.h"
+#include "range_vector.h"
 #include "vk_layer_utils.h"
 
+#include <map>
+
 enum QueryState {
     QUERYSTATE_UNKNOWN,    // Initial state.
     QUERYSTATE_RESET,      // After resetting.
@@ -47,30 +50,28 @@ class QUERY_POOL_STATE : public BASE_NODE {
           has_perf_scope_render_pass(has_rb),
           n_performance_passes(n_perf_pass),
           perf_counter_index_count(index_count),
-          query_states_(pCreateInfo->queryCount) {
-        for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-            auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-            query_states_[i].reserve(perf_size);
-            for (uint32_t p = 0; p < perf_size; p++) {
-                query_states_[i].emplace_back(QUERYSTATE_UNKNOWN);
-            }
-        }
-    }
+          pass_count_(n_perf_pass > 0 ? n_perf_pass : 1),
+          query_states_(size_t(pCreateInfo->queryCount) * pass_count_, QUERYSTATE_UNKNOWN) {}
 
     VkQueryPool pool() const { return handle_.Cast<VkQueryPool>(); }
 
-    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
+    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) { SetQueryStates(query, 1, perf_pass, state); }
+    // Sets [first_query, first_query + query_count) under one lock, clamped to the pool
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
-        assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
-        query_states_[query][perf_pass] = state;
+        assert(perf_pass < pass_count_);
+        if (perf_pass >= pass_count_) return;
+        const uint32_t end = std::min(first_query + query_count, createInfo.queryCount);
+        for (uint32_t query = first_query; query < end; ++query) {
+            query_states_[size_t(query) * pass_count_ + perf_pass] = state;
+        }
     }
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
         // this method can get called with invalid arguments during validation
-        if (query < query_states_.size() &&
+        if (query < createInfo.queryCount &&
             ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-            return query_states_[query][perf_pass];
+            return query_states_[size_t(query) * pass_count_ + perf_pass];
         }
         return QUERYSTATE_UNKNOWN;
     }
@@ -86,7 +87,9 @@ class QUERY_POOL_STATE : public BASE_NODE {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    // One state per query and performance pass, the passes of a query next to each other
+    const uint32_t pass_count_;
+    std::vector<QueryState> query_states_;
     mutable ReadWriteLock lock_;
 };
 
@@ -129,7 +132,35 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.query == query2.query) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// The query states a command buffer leaves, as ranges of queries per pool and performance pass, so that resetting a large
+// pool is one entry rather than one per query.
+class QueryMap {
+  public:
+    using QueryRangeMap = sparse_container::range_map<uint32_t, QueryState>;
+    using PoolPass = std::pair<VkQueryPool, uint32_t>;
+
+    void Set(const QueryObject &query_obj, QueryState state) {
+        SetRange(query_obj.pool, query_obj.query, 1, query_obj.perf_pass, state);
+    }
+    void SetRange(VkQueryPool pool, uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
+        if (query_count == 0) return;
+        const QueryRangeMap::key_type range(first_query, first_query + query_count);
+        pools_[PoolPass(pool, perf_pass)].overwrite_range(std::make_pair(range, state));
+    }
+    // QUERYSTATE_UNKNOWN if the command buffer doesn't set the query
+    QueryState Get(VkQueryPool pool, uint32_t query, uint32_t perf_pass) const {
+        auto pool_it = pools_.find(PoolPass(pool, perf_pass));
+        if (pool_it == pools_.end()) return QUERYSTATE_UNKNOWN;
+        auto range_it = pool_it->second.find(query);
+        return (range_it != pool_it->second.end()) ? range_it->second : QUERYSTATE_UNKNOWN;
+    }
+
+    // The queries of each (pool, performance pass), as ranges of queries with the same state
+    const std::map<PoolPass, QueryRangeMap> &Pools() const { return pools_; }
+
+  private:
+    std::map<PoolPass, QueryRangeMap> pools_;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
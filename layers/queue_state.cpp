@@ -243,7 +243,9 @@ bool SEMAPHORE_STATE::EnqueueSignal(QUEUE_STATE *queue, uint64_t queue_seq, uint
     if (type == VK_SEMAPHORE_TYPE_BINARY) {
         payload = next_payload_++;
     }
-    operations_.emplace(SemOp{kSignal, queue, queue_seq, payload});
+    const SemOp op{kSignal, queue, queue_seq, payload};
+    InsertOp(operations_, op);
+    InsertOp(signals_, op);
     return false;
 }
 
@@ -259,19 +261,19 @@ void SEMAPHORE_STATE::EnqueueWait(QUEUE_STATE *queue, uint64_t queue_seq, uint64
     if (type == VK_SEMAPHORE_TYPE_BINARY) {
         payload = next_payload_++;
     }
-    operations_.emplace(SemOp{kWait, queue, queue_seq, payload});
+    InsertOp(operations_, SemOp{kWait, queue, queue_seq, payload});
 }
 
 void SEMAPHORE_STATE::EnqueueAcquire() {
     auto guard = WriteLock();
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
-    operations_.emplace(SemOp{kBinaryAcquire, nullptr, 0, next_payload_++});
+    InsertOp(operations_, SemOp{kBinaryAcquire, nullptr, 0, next_payload_++});
 }
 
 void SEMAPHORE_STATE::EnqueuePresent(QUEUE_STATE *queue) {
     auto guard = WriteLock();
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
-    operations_.emplace(SemOp{kBinaryPresent, queue, 0, next_payload_++});
+    InsertOp(operations_, SemOp{kBinaryPresent, queue, 0, next_payload_++});
 }
 
 layer_data::optional<SemOp> SEMAPHORE_STATE::LastOp(std::function<bool(const SemOp &)> filter) const {
@@ -287,6 +289,22 @@ layer_data::optional<SemOp> SEMAPHORE_STATE::LastOp(std::function<bool(const Sem
     return result;
 }
 
+layer_data::optional<SemOp> SEMAPHORE_STATE::LastSignal() const {
+    auto guard = ReadLock();
+    layer_data::optional<SemOp> result;
+    if (!signals_.empty()) result.emplace(signals_.back());
+    return result;
+}
+
+void SEMAPHORE_STATE::InsertOp(std::deque<SemOp> &ops, const SemOp &op) {
+    // Appending is the common case, the binary search is only for operations on earlier payloads
+    if (ops.empty() || ops.back().payload <= op.payload) {
+        ops.push_back(op);
+    } else {
+        ops.insert(std::upper_bound(ops.begin(), ops.end(), op), op);
+    }
+}
+
 bool SEMAPHORE_STATE::CanBeSignaled() const {
     if (type == VK_SEMAPHORE_TYPE_TIMELINE) {
         return true;
@@ -317,17 +335,22 @@ SEMAPHORE_STATE::RetireResult SEMAPHORE_STATE::Retire(QUEUE_STATE *queue, uint64
     auto guard = WriteLock();
     RetireResult result;
 
-    while (!operations_.empty() && operations_.begin()->payload <= payload) {
-        completed_ = *operations_.begin();
-        operations_.erase(operations_.begin());
+    // Everything up to payload retires at once
+    const SemOp bound{kNone, nullptr, 0, payload};
+    const auto retired_end = std::upper_bound(operations_.begin(), operations_.end(), bound);
+    if (retired_end == operations_.begin()) return result;
+    for (auto op = operations_.begin(); op != retired_end; ++op) {
         // Note: even though presentation is directed to a queue, there is no direct ordering between QP and subsequent work,
         // so QP (and its semaphore waits) /never/ participate in any completion proof. Likewise, Acquire is not associated
         // with a queue.
-        if (completed_.op_type != kBinaryAcquire && completed_.op_type != kBinaryPresent) {
-            auto &last_seq = result[completed_.queue];
-            last_seq = std::max(last_seq, completed_.seq);
+        if (op->op_type != kBinaryAcquire && op->op_type != kBinaryPresent) {
+            auto &last_seq = result[op->queue];
+            last_seq = std::max(last_seq, op->seq);
         }
     }
+    completed_ = *(retired_end - 1);
+    operations_.erase(operations_.begin(), retired_end);
+    signals_.erase(signals_.begin(), std::upper_bound(signals_.begin(), signals_.end(), bound));
     return result;
 }
 
@@ -359,3 +382,110 @@ void SEMAPHORE_STATE::Export(VkExternalSemaphoreHandleTypeFlagBits handle_type)
         scope_ = kSyncScopeExternalPermanent;
     }
 }
+
+SubmissionRetirementThread::SubmissionRetirementThread(VkDevice device, bool use_khr)
+    : device_(device), use_khr_(use_khr), thread_(&SubmissionRetirementThread::Run, this) {}
+
+SubmissionRetirementThread::~SubmissionRetirementThread() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stop_ = true;
+    }
+    submitted_.notify_one();
+    thread_.join();
+    for (auto &timeline : queues_) {
+        DispatchDestroySemaphore(device_, timeline.semaphore, nullptr);
+    }
+}
+
+void SubmissionRetirementThread::SignalSubmitted(const std::shared_ptr<QUEUE_STATE> &queue_state) {
+    const uint64_t seq = queue_state->LastSubmittedSeq();
+    QueueTimeline *timeline = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto &entry : queues_) {
+            if (entry.queue_state == queue_state) {
+                timeline = &entry;
+                break;
+            }
+        }
+        if (!timeline) {
+            auto type_info = LvlInitStruct<VkSemaphoreTypeCreateInfo>();
+            type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            auto create_info = LvlInitStruct<VkSemaphoreCreateInfo>(&type_info);
+            VkSemaphore semaphore = VK_NULL_HANDLE;
+            if (DispatchCreateSemaphore(device_, &create_info, nullptr, &semaphore) != VK_SUCCESS) return;
+            queues_.emplace_back(QueueTimeline{queue_state, semaphore, 0, 0});
+            timeline = &queues_.back();
+        }
+        // Only this thread signals the semaphore of the queue
+        if (seq <= timeline->signaled) return;
+    }
+
+    auto timeline_info = LvlInitStruct<VkTimelineSemaphoreSubmitInfo>();
+    timeline_info.signalSemaphoreValueCount = 1;
+    timeline_info.pSignalSemaphoreValues = &seq;
+    auto submit_info = LvlInitStruct<VkSubmitInfo>(&timeline_info);
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &timeline->semaphore;
+    // A signal operation's first synchronization scope holds every command earlier in submission order
+    if (DispatchQueueSubmit(queue_state->Queue(), 1, &submit_info, VK_NULL_HANDLE) != VK_SUCCESS) return;
+
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        timeline->signaled = seq;
+    }
+    submitted_.notify_one();
+}
+
+void SubmissionRetirementThread::Run() {
+    // Bounds the wait so that queues signaled meanwhile are waited on too
+    const uint64_t kWaitTimeoutNs = 10 * 1000 * 1000;
+    std::vector<QueueTimeline *> in_flight;
+    std::vector<VkSemaphore> semaphores;
+    std::vector<uint64_t> values;
+
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        in_flight.clear();
+        submitted_.wait(guard, [this, &in_flight]() {
+            for (auto &timeline : queues_) {
+                if (timeline.signaled > timeline.retired) in_flight.push_back(&timeline);
+            }
+            return stop_ || !in_flight.empty();
+        });
+        if (stop_) break;
+        semaphores.clear();
+        values.clear();
+        for (const auto *timeline : in_flight) {
+            semaphores.push_back(timeline->semaphore);
+            values.push_back(timeline->retired + 1);
+        }
+        guard.unlock();
+
+        auto wait_info = LvlInitStruct<VkSemaphoreWaitInfo>();
+        wait_info.flags = VK_SEMAPHORE_WAIT_ANY_BIT;
+        wait_info.semaphoreCount = static_cast<uint32_t>(semaphores.size());
+        wait_info.pSemaphores = semaphores.data();
+        wait_info.pValues = values.data();
+        const VkResult result = use_khr_ ? DispatchWaitSemaphoresKHR(device_, &wait_info, kWaitTimeoutNs)
+                                         : DispatchWaitSemaphores(device_, &wait_info, kWaitTimeoutNs);
+        if (result != VK_SUCCESS && result != VK_TIMEOUT) {
+            // The device is lost, and the submissions will be retired when the application waits
+            guard.lock();
+            break;
+        }
+
+        for (auto *timeline : in_flight) {
+            uint64_t value = 0;
+            const VkResult counter_result = use_khr_ ? DispatchGetSemaphoreCounterValueKHR(device_, timeline->semaphore, &value)
+                                                     : DispatchGetSemaphoreCounterValue(device_, timeline->semaphore, &value);
+            // Only this thread writes retired
+            if (counter_result == VK_SUCCESS && value > timeline->retired) {
+                timeline->queue_state->Retire(value);
+                timeline->retired = value;
+            }
+        }
+        guard.lock();
+    }
+}
@@ -26,8 +26,11 @@
  */
 #pragma once
 #include "base_node.h"
+#include <algorithm>
+#include <condition_variable>
 #include <deque>
-#include <set>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "vk_layer_utils.h"
 
@@ -162,6 +165,8 @@ class SEMAPHORE_STATE : public REFCOUNTED_NODE {
 
     // look for most recent / highest payload operation that matches
     layer_data::optional<SemOp> LastOp(std::function<bool(const SemOp &)> filter = nullptr) const;
+    // The pending signal with the highest payload, without looking at the waits queued behind it
+    layer_data::optional<SemOp> LastSignal() const;
 
     bool CanBeSignaled() const;
     bool CanBeWaited() const;
@@ -187,10 +192,15 @@ class SEMAPHORE_STATE : public REFCOUNTED_NODE {
 
     std::vector<std::shared_ptr<std::function<void()>>> waiting_functions_;
 
-    // Set of pending operations ordered by payload. This must be a multiset because
-    // timeline operations can be added in any order and multiple operations
-    // can use the same payload value.
-    std::multiset<SemOp> operations_;
+    // Inserts op into ops after the operations with the same payload
+    static void InsertOp(std::deque<SemOp> &ops, const SemOp &op);
+
+    // Pending operations sorted by payload, operations with the same payload in the order they were enqueued. Timeline
+    // operations can be added in any order, but are mostly appended, and retiring a payload removes a prefix, so both find
+    // their place with a binary search and move few elements.
+    std::deque<SemOp> operations_;
+    // The signals among operations_, so that the last signal is found without walking the waits on later payloads
+    std::deque<SemOp> signals_;
     mutable ReadWriteLock lock_;
 };
 
@@ -238,6 +248,12 @@ class QUEUE_STATE : public BASE_NODE {
 
     void Retire(uint64_t until_seq = UINT64_MAX);
 
+    // The seq of the last submission, retired or not
+    uint64_t LastSubmittedSeq() const {
+        auto guard = ReadLock();
+        return seq_ + submissions_.size();
+    }
+
     const uint32_t queueFamilyIndex;
     const VkDeviceQueueCreateFlags flags;
 
@@ -250,3 +266,36 @@ class QUEUE_STATE : public BASE_NODE {
     uint64_t seq_;
     mutable ReadWriteLock lock_;
 };
+
+// Retires the submissions of each queue from a thread of its own as the GPU completes them, for async_submission_retirement.
+// After each submit call the layer signals a timeline semaphore of the queue with the seq of the call's last submission, and the
+// thread waits on the semaphores of all queues with submissions in flight, retiring everything up to the value it finds when one
+// advances.
+class SubmissionRetirementThread {
+  public:
+    // use_khr selects the entry points of VK_KHR_timeline_semaphore, for devices before Vulkan 1.2
+    SubmissionRetirementThread(VkDevice device, bool use_khr);
+    ~SubmissionRetirementThread();
+
+    // Called at the end of a submit call, by the thread that externally synchronizes the queue
+    void SignalSubmitted(const std::shared_ptr<QUEUE_STATE> &queue_state);
+
+  private:
+    struct QueueTimeline {
+        std::shared_ptr<QUEUE_STATE> queue_state;
+        VkSemaphore semaphore;
+        uint64_t signaled;
+        uint64_t retired;
+    };
+
+    void Run();
+
+    const VkDevice device_;
+    const bool use_khr_;
+    std::mutex lock_;
+    std::condition_variable submitted_;
+    bool stop_ = false;
+    // Only added to, and a deque keeps references to its elements valid when others are added
+    std::deque<QueueTimeline> queues_;
+    std::thread thread_;
+};
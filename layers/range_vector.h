@@ -25,9 +25,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <map>
+#include <memory>
+#include <set>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "vk_layer_data.h"
 
@@ -168,6 +173,147 @@ struct split_op_keep_upper {
 
 enum class value_precedence { prefer_source, prefer_dest };
 
+// Node storage for the std::map behind a single range_map
+//
+// The splits and merges of range map updates allocate and free a node per range, and with the default allocator the nodes of
+// one map end up scattered over the heap. The pool carves nodes out of slabs that double in size as the map grows and puts
+// freed nodes on a free list, so a map's nodes stay packed together and are recycled without going back to the heap. Once
+// every node is freed the pool keeps only its newest, largest slab. It serves a single node size, set by the first
+// allocation, and is exactly as thread safe as the map it belongs to.
+class range_map_node_pool {
+  public:
+    range_map_node_pool() = default;
+    range_map_node_pool(const range_map_node_pool &) = delete;
+    range_map_node_pool &operator=(const range_map_node_pool &) = delete;
+    ~range_map_node_pool() {
+        while (slabs_) {
+            SlabHeader *prev = slabs_->prev;
+            ::operator delete(slabs_);
+            slabs_ = prev;
+        }
+    }
+
+    // Returns nullptr for any other size than the one the pool serves, which the caller must then get from the heap
+    void *allocate(size_t size) {
+        if (node_size_ == 0) {
+            node_size_ = size;
+            const size_t align = alignof(SlabHeader);
+            stride_ = ((std::max(size, sizeof(FreeNode)) + align - 1) / align) * align;
+        }
+        if (size != node_size_) return nullptr;
+        ++live_;
+        if (free_) {
+            FreeNode *node = free_;
+            free_ = node->next;
+            return node;
+        }
+        if (cursor_ == slab_end_) add_slab();
+        void *node = cursor_;
+        cursor_ += stride_;
+        return node;
+    }
+
+    // Returns false if the node did not come from the pool
+    bool deallocate(void *p, size_t size) {
+        if (size != node_size_) return false;
+        auto *node = static_cast<FreeNode *>(p);
+        node->next = free_;
+        free_ = node;
+        if (--live_ == 0) reset();
+        return true;
+    }
+
+  private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+    struct alignas(std::max_align_t) SlabHeader {
+        SlabHeader *prev;
+    };
+    static const size_t kMinSlabNodes = 16;
+    static const size_t kMaxSlabNodes = 1024;
+
+    void add_slab() {
+        const size_t slab_bytes = slab_nodes_ * stride_;
+        auto *slab = static_cast<SlabHeader *>(::operator new(sizeof(SlabHeader) + slab_bytes));
+        slab->prev = slabs_;
+        slabs_ = slab;
+        cursor_ = reinterpret_cast<char *>(slab + 1);
+        slab_end_ = cursor_ + slab_bytes;
+        const size_t max_slab_nodes = kMaxSlabNodes;
+        slab_nodes_ = std::min(slab_nodes_ * 2, max_slab_nodes);
+    }
+
+    // Everything is free, start over in the newest slab
+    void reset() {
+        SlabHeader *prev = slabs_->prev;
+        while (prev) {
+            SlabHeader *older = prev->prev;
+            ::operator delete(prev);
+            prev = older;
+        }
+        slabs_->prev = nullptr;
+        free_ = nullptr;
+        cursor_ = reinterpret_cast<char *>(slabs_ + 1);
+    }
+
+    size_t node_size_ = 0;
+    size_t stride_ = 0;
+    size_t live_ = 0;
+    size_t slab_nodes_ = kMinSlabNodes;
+    FreeNode *free_ = nullptr;
+    SlabHeader *slabs_ = nullptr;
+    char *cursor_ = nullptr;
+    char *slab_end_ = nullptr;
+};
+
+// Allocator placing the nodes of a node based ImplMap in a range_map_node_pool
+//
+// An allocator and its copies share one pool. Copy constructing a map gives the copy a pool of its own, while moving or
+// swapping maps moves the pool along with the nodes. Note that a moved from map still shares the pool it moved, so it must
+// either be used on the same thread as the map it moved to or not allocate at all.
+template <typename T>
+class pooled_map_allocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    pooled_map_allocator() : pool_(std::make_shared<range_map_node_pool>()) {}
+    template <typename U>
+    pooled_map_allocator(const pooled_map_allocator<U> &other) : pool_(other.pool_) {}
+
+    pooled_map_allocator select_on_container_copy_construction() const { return pooled_map_allocator(); }
+
+    T *allocate(size_t n) {
+        void *p = (n == 1 && alignof(T) <= alignof(std::max_align_t)) ? pool_->allocate(sizeof(T)) : nullptr;
+        return static_cast<T *>(p ? p : ::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, size_t n) {
+        if (n != 1 || alignof(T) > alignof(std::max_align_t) || !pool_->deallocate(p, sizeof(T))) {
+            ::operator delete(p);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const pooled_map_allocator<U> &other) const {
+        return pool_ == other.pool_;
+    }
+    template <typename U>
+    bool operator!=(const pooled_map_allocator<U> &other) const {
+        return pool_ != other.pool_;
+    }
+
+  private:
+    template <typename U>
+    friend class pooled_map_allocator;
+    std::shared_ptr<range_map_node_pool> pool_;
+};
+
+template <typename RangeKey, typename T>
+using pooled_map = std::map<RangeKey, T, std::less<RangeKey>, pooled_map_allocator<std::pair<const RangeKey, T>>>;
+
 // The range based sparse map implemented on the ImplMap
 template <typename Key, typename T, typename RangeKey = range<Key>, typename ImplMap = std::map<RangeKey, T>>
 class range_map {
@@ -668,6 +814,10 @@ class range_map {
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// A range_map keeping its ranges in pool allocated nodes, for the large, frequently split maps
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using pooled_range_map = range_map<Key, T, RangeKey, pooled_map<RangeKey, T>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -1822,6 +1972,209 @@ bool update_range_value(Map &map, const Range &range, MapValue &&value, value_pr
     return updated;
 }
 
+// Apply an update to every part of range in a single traversal, splitting the entries straddling its bounds and infilling gaps
+//
+// Action supplies the two operations (given the map by pointer, as iterators into it stay valid):
+//   Iterator Infill(Map *map, const Iterator &pos, const Range &gap) -- fill (part of) a gap just before pos, returning the
+//       first entry placed in the gap, or pos if the gap was left empty. Parts of the gap left empty are skipped.
+//   Iterator operator()(Map *map, const Iterator &pos) -- update an entry lying within range, returning the entry to continue
+//       the traversal after, normally pos, or end() to stop.
+template <typename Map, typename Action, typename Range = typename Map::key_type>
+void infill_update_range(Map &map, const Range &range, const Action &action) {
+    if (range.empty()) return;
+    auto pos = map.lower_bound(range);
+    if ((pos != map.end()) && (pos->first.begin < range.begin)) {
+        // Trim the leading entry, the upper half is the first within range
+        pos = map.split(pos, range.begin, split_op_keep_both());
+        ++pos;
+    }
+    auto current = range.begin;
+    while (current < range.end) {
+        if ((pos == map.end()) || (current < pos->first.begin)) {
+            const auto limit = (pos == map.end()) ? range.end : std::min(range.end, pos->first.begin);
+            pos = action.Infill(&map, pos, Range(current, limit));
+            current = ((pos != map.end()) && (pos->first.begin < limit)) ? pos->first.begin : limit;
+            continue;
+        }
+        if (pos->first.end > range.end) {
+            pos = map.split(pos, range.end, split_op_keep_both());
+        }
+        current = pos->first.end;
+        pos = action(&map, pos);
+        if (pos == map.end()) break;
+        ++pos;
+    }
+}
+
+// Merge each run of adjacent ranges with equal (operator==) values into a single range, returning the number of ranges removed
+//
+// Updates split ranges but never join them back, so after many partial updates a map can hold long runs of neighbors with the
+// same value. Consolidating leaves every index mapped to the value it had, in as few ranges as possible.
+template <typename Map>
+size_t consolidate(Map &map) {
+    using Range = typename Map::key_type;
+    using Value = typename Map::value_type;
+    size_t removed = 0;
+    auto it = map.begin();
+    while (it != map.end()) {
+        auto last = it;
+        auto next = it;
+        ++next;
+        while (next != map.end() && last->first.is_prior_to(next->first) && next->second == it->second) {
+            last = next;
+            ++next;
+            ++removed;
+        }
+        if (last != it) {
+            const Range merged(it->first.begin, last->first.end);
+            auto value = std::move(it->second);
+            while (it != next) {
+                it = map.erase(it);
+            }
+            it = map.insert(it, Value(merged, std::move(value)));
+        }
+        ++it;
+    }
+    return removed;
+}
+
+// Merge the ranges starting within each granularity aligned block into a single range, returning the number of ranges removed
+//
+// Unlike consolidate, this loses information: the merged range covers the gaps between the ranges it replaces, and its value
+// is built by merge(Mapped &into, const Mapped &from) from theirs. It bounds the size of a map to one range per block.
+template <typename Map, typename Merge>
+size_t coarsen(Map &map, typename Map::index_type granularity, const Merge &merge) {
+    using Range = typename Map::key_type;
+    using Value = typename Map::value_type;
+    size_t removed = 0;
+    auto it = map.begin();
+    while (it != map.end()) {
+        const auto block_end = (it->first.begin / granularity + 1) * granularity;
+        auto last = it;
+        auto next = it;
+        ++next;
+        while (next != map.end() && next->first.begin < block_end) {
+            last = next;
+            ++next;
+            ++removed;
+        }
+        if (last != it) {
+            const Range merged(it->first.begin, last->first.end);
+            auto value = std::move(it->second);
+            it = map.erase(it);
+            while (it != next) {
+                merge(value, it->second);
+                it = map.erase(it);
+            }
+            it = map.insert(it, Value(merged, std::move(value)));
+        }
+        ++it;
+    }
+    return removed;
+}
+
+// Split range into consecutive windows each holding at most max_window_entries entries of map, with no window boundary
+// falling inside an entry. The windows tile range, so disjoint parts of the map can be worked on independently.
+template <typename Map, typename Range = typename Map::key_type>
+std::vector<Range> partition_range(const Map &map, const Range &range, size_t max_window_entries) {
+    std::vector<Range> windows;
+    if (range.empty()) return windows;
+    assert(max_window_entries > 0);
+    auto window_begin = range.begin;
+    size_t window_entries = 0;
+    for (auto it = map.lower_bound(range); (it != map.end()) && range.includes(it->first.begin); ++it) {
+        if ((window_entries == max_window_entries) && (window_begin < it->first.begin)) {
+            windows.emplace_back(window_begin, it->first.begin);
+            window_begin = it->first.begin;
+            window_entries = 0;
+        }
+        ++window_entries;
+    }
+    windows.emplace_back(window_begin, range.end);
+    return windows;
+}
+
+// Move the entries of map within range into the empty map out, first splitting the entries straddling the bounds of range
+template <typename Map, typename Range = typename Map::key_type>
+void extract_range(Map &map, const Range &range, Map &out) {
+    assert(out.empty());
+    auto it = map.lower_bound(range);
+    if (it != map.end() && it->first.begin < range.begin) {
+        it = map.split(it, range.begin, split_op_keep_both());
+        ++it;
+    }
+    while (it != map.end() && range.includes(it->first.begin)) {
+        if (range.end < it->first.end) {
+            it = map.split(it, range.end, split_op_keep_both());
+        }
+        out.overwrite_range(out.end(), std::make_pair(it->first, std::move(it->second)));
+        it = map.erase(it);
+    }
+}
+
+// Move every entry of from into map, which must hold nothing overlapping them, such as the map a range was extracted from
+template <typename Map>
+void insert_extracted(Map &map, Map &from) {
+    if (from.empty()) return;
+    auto pos = map.lower_bound(from.begin()->first);
+    for (auto &entry : from) {
+        pos = map.overwrite_range(pos, std::make_pair(entry.first, std::move(entry.second)));
+        ++pos;
+    }
+    from.clear();
+}
+
+// Calls intersect(i, j) for each pair of a non-empty source range i and destination range j that overlap. Sweeping once over
+// the sorted ends of the ranges takes O((n + k) log n) for n ranges with k overlapping pairs, where comparing each pair takes
+// O(n^2).
+template <typename Range, typename Intersect>
+void for_each_intersecting_range(const std::vector<Range> &src_ranges, const std::vector<Range> &dst_ranges, Intersect intersect) {
+    struct RangeEnd {
+        typename Range::index_type position;
+        bool is_begin;
+        bool is_src;
+        uint32_t index;
+        // The ranges are half-open, so a range ending where another begins is closed first
+        bool operator<(const RangeEnd &rhs) const {
+            return (position < rhs.position) || ((position == rhs.position) && !is_begin && rhs.is_begin);
+        }
+    };
+    std::vector<RangeEnd> range_ends;
+    range_ends.reserve(2 * (src_ranges.size() + dst_ranges.size()));
+    for (uint32_t i = 0; i < src_ranges.size(); ++i) {
+        if (src_ranges[i].non_empty()) {
+            range_ends.push_back({src_ranges[i].begin, true, true, i});
+            range_ends.push_back({src_ranges[i].end, false, true, i});
+        }
+    }
+    for (uint32_t j = 0; j < dst_ranges.size(); ++j) {
+        if (dst_ranges[j].non_empty()) {
+            range_ends.push_back({dst_ranges[j].begin, true, false, j});
+            range_ends.push_back({dst_ranges[j].end, false, false, j});
+        }
+    }
+    std::sort(range_ends.begin(), range_ends.end());
+
+    std::set<uint32_t> open_src;
+    std::set<uint32_t> open_dst;
+    for (const auto &range_end : range_ends) {
+        auto &open = range_end.is_src ? open_src : open_dst;
+        if (!range_end.is_begin) {
+            open.erase(range_end.index);
+        } else if (range_end.is_src) {
+            for (const uint32_t j : open_dst) {
+                intersect(range_end.index, j);
+            }
+            open.insert(range_end.index);
+        } else {
+            for (const uint32_t i : open_src) {
+                intersect(i, range_end.index);
+            }
+            open.insert(range_end.index);
+        }
+    }
+}
+
 }  // namespace sparse_container
 
 #endif
@@ -17,6 +17,7 @@
 
 #include "shader_module.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -25,6 +26,7 @@
 #include "pipeline_state.h"
 #include "descriptor_sets.h"
 #include "spirv_grammar_helper.h"
+#include "xxhash.h"
 
 void decoration_set::merge(decoration_set const &other) {
     if (other.flags & location_bit) location = other.location;
@@ -318,11 +320,41 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology() con
     return {};
 }
 
+// Everything is collected in a single walk over the module
 SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE &module_state) {
+    const auto &words = module_state.words;
+    // The bound is only trusted as far as the module could plausibly use it, ids past that grow the arrays on demand
+    const uint32_t id_bound = (words.size() > 3) ? words[3] : 0;
+    const size_t initial_size = std::min(static_cast<size_t>(id_bound), words.size());
+    def_index.resize(initial_size, 0);
+    decoration_index.resize(initial_size, 0);
+    auto id_slot = [](std::vector<uint32_t> &array, uint32_t id) -> uint32_t & {
+        if (id >= array.size()) array.resize(static_cast<size_t>(id) + 1, 0);
+        return array[id];
+    };
+    auto decorations_of = [this, &id_slot](uint32_t id) -> decoration_set & {
+        uint32_t &index = id_slot(decoration_index, id);
+        if (index == 0) {
+            decorations.emplace_back();
+            index = static_cast<uint32_t>(decorations.size());
+        }
+        return decorations[index - 1];
+    };
+
+    function_set func_set = {};
+    EntryPoint *entry_point = nullptr;
+
     for (auto insn : module_state) {
+        // offset is not 0, it means it's updated and the offset is in a Function.
+        if (func_set.offset) {
+            func_set.op_lists.emplace(insn.opcode(), insn.offset());
+        } else if (entry_point) {
+            entry_point->decorate_list.emplace(insn.opcode(), insn.offset());
+        }
+
         const uint32_t result_word = OpcodeResultWord(insn.opcode());
         if (result_word != 0) {
-            def_index[insn.word(result_word)] = insn.offset();
+            id_slot(def_index, insn.word(result_word)) = insn.offset();
         }
 
         switch (insn.opcode()) {
@@ -338,7 +370,7 @@ SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE
                 // Decorations
             case spv::OpDecorate: {
                 auto target_id = insn.word(1);
-                decorations[target_id].add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
+                decorations_of(target_id).add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
                 decoration_inst.push_back(insn);
                 if (insn.word(2) == spv::DecorationBuiltIn) {
                     builtin_decoration_list.emplace_back(insn.offset(), static_cast<spv::BuiltIn>(insn.word(3)));
@@ -348,13 +380,9 @@ SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE
 
             } break;
             case spv::OpGroupDecorate: {
-                auto const &src = decorations[insn.word(1)];
-                for (auto i = 2u; i < insn.len(); i++) decorations[insn.word(i)].merge(src);
-                has_group_decoration = true;
-            } break;
-            case spv::OpDecorationGroup:
-            case spv::OpGroupMemberDecorate: {
-                has_group_decoration = true;
+                // A copy, adding the targets' sets may move the group's
+                const decoration_set src = decorations_of(insn.word(1));
+                for (auto i = 2u; i < insn.len(); i++) decorations_of(insn.word(i)).merge(src);
             } break;
             case spv::OpMemberDecorate: {
                 member_decoration_inst.push_back(insn);
@@ -369,6 +397,42 @@ SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE
                 execution_mode_inst[insn.word(1)].push_back(insn);
             } break;
 
+            case spv::OpCapability:
+                capability_inst.push_back(insn);
+                break;
+            case spv::OpVariable:
+                variable_inst.push_back(insn);
+                break;
+            case spv::OpEmitStreamVertex:
+            case spv::OpEndStreamPrimitive:
+                stream_inst.push_back(insn);
+                break;
+
+            // Functions
+            case spv::OpFunction:
+                func_set.id = insn.word(2);
+                func_set.offset = insn.offset();
+                func_set.op_lists.clear();
+                break;
+
+            // Entry points ... add to the entrypoint table
+            case spv::OpEntryPoint: {
+                // Entry points do not have an id (the id is the function id) and thus need their own table
+                auto entrypoint_name = reinterpret_cast<char const *>(&insn.word(3));
+                auto execution_model = insn.word(1);
+                auto entrypoint_stage = ExecutionModelToShaderStageFlagBits(execution_model);
+                auto it = entry_points.emplace(entrypoint_name,
+                                               EntryPoint{insn.offset(), static_cast<VkShaderStageFlagBits>(entrypoint_stage)});
+                entry_point = &(it->second);
+                break;
+            }
+            case spv::OpFunctionEnd: {
+                assert(entry_point != nullptr);
+                func_set.length = insn.offset() - func_set.offset;
+                entry_point->function_set_list.emplace_back(func_set);
+                break;
+            }
+
             default:
                 if (AtomicOperation(insn.opcode()) == true) {
                     // All atomics have a pointer referenced
@@ -400,80 +464,101 @@ SHADER_MODULE_STATE::SpirvStaticData::SpirvStaticData(const SHADER_MODULE_STATE
         }
     }
 
-    entry_points = SHADER_MODULE_STATE::ProcessEntryPoints(module_state);
     multiple_entry_points = entry_points.size() > 1;
 }
 
-// static
-std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> SHADER_MODULE_STATE::ProcessEntryPoints(
-    const SHADER_MODULE_STATE &module_state) {
-    std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> entry_points;
-    function_set func_set = {};
-    EntryPoint *entry_point = nullptr;
+namespace {
+// Interns SPIR-V by content, see GetSharedSpirv()
+class SpirvCache {
+  public:
+    using Spirv = std::shared_ptr<const std::vector<uint32_t>>;
+
+    // If storage is given, code points into it and a new entry takes it over instead of copying the code
+    Spirv Get(const uint32_t *code, size_t word_count, std::vector<uint32_t> *storage) {
+        const uint64_t hash = XXH64(code, word_count * sizeof(uint32_t), 0);
+        std::lock_guard<std::mutex> guard(lock_);
+        auto &bucket = entries_[hash];
+        for (const auto &entry : bucket) {
+            auto shared = entry.lock();
+            if (shared && shared->size() == word_count && std::equal(shared->begin(), shared->end(), code)) return shared;
+        }
+        // Not make_shared, so that an expired entry does not keep the code's storage alive until it is pruned
+        Spirv shared(storage ? new std::vector<uint32_t>(std::move(*storage)) : new std::vector<uint32_t>(code, code + word_count));
+        bucket.emplace_back(shared);
+        if (++entry_count_ >= prune_size_) Prune();
+        return shared;
+    }
 
-    for (auto insn : module_state) {
-        // offset is not 0, it means it's updated and the offset is in a Function.
-        if (func_set.offset) {
-            func_set.op_lists.emplace(insn.opcode(), insn.offset());
-        } else if (entry_point) {
-            entry_point->decorate_list.emplace(insn.opcode(), insn.offset());
+  private:
+    // Drop entries no module uses anymore, then wait for the cache to double before looking again
+    void Prune() {
+        entry_count_ = 0;
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            auto &bucket = it->second;
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [](const std::weak_ptr<const std::vector<uint32_t>> &entry) {
+                             return entry.expired();
+                         }),
+                         bucket.end());
+            if (bucket.empty()) {
+                it = entries_.erase(it);
+            } else {
+                entry_count_ += bucket.size();
+                ++it;
+            }
         }
+        const size_t min_prune_size = kMinPruneSize;
+        prune_size_ = std::max(min_prune_size, entry_count_ * 2);
+    }
 
-        switch (insn.opcode()) {
-            // Functions
-            case spv::OpFunction:
-                func_set.id = insn.word(2);
-                func_set.offset = insn.offset();
-                func_set.op_lists.clear();
-                break;
+    static const size_t kMinPruneSize = 256;
 
-            // Entry points ... add to the entrypoint table
-            case spv::OpEntryPoint: {
-                // Entry points do not have an id (the id is the function id) and thus need their own table
-                auto entrypoint_name = reinterpret_cast<char const *>(&insn.word(3));
-                auto execution_model = insn.word(1);
-                auto entrypoint_stage = ExecutionModelToShaderStageFlagBits(execution_model);
-                entry_points.emplace(entrypoint_name,
-                                     EntryPoint{insn.offset(), static_cast<VkShaderStageFlagBits>(entrypoint_stage)});
+    std::mutex lock_;
+    layer_data::unordered_map<uint64_t, std::vector<std::weak_ptr<const std::vector<uint32_t>>>> entries_;
+    size_t entry_count_ = 0;
+    size_t prune_size_ = kMinPruneSize;
+};
 
-                auto range = entry_points.equal_range(entrypoint_name);
-                for (auto it = range.first; it != range.second; ++it) {
-                    if (it->second.offset == insn.offset()) {
-                        entry_point = &(it->second);
-                        break;
-                    }
-                }
-                assert(entry_point != nullptr);
-                break;
-            }
-            case spv::OpFunctionEnd: {
-                assert(entry_point != nullptr);
-                func_set.length = insn.offset() - func_set.offset;
-                entry_point->function_set_list.emplace_back(func_set);
-                break;
-            }
+// Leaked on purpose, modules may be destroyed during static destruction
+SpirvCache &GetSpirvCache() {
+    static auto *cache = new SpirvCache;
+    return *cache;
+}
+
+bool HasGroupDecoration(const uint32_t *code, size_t word_count) {
+    // Skip the header, decorations come before the first function
+    for (size_t offset = 5; offset < word_count;) {
+        const uint32_t length = code[offset] >> 16;
+        const uint32_t opcode = code[offset] & 0x0ffffu;
+        if (opcode == spv::OpDecorationGroup || opcode == spv::OpGroupDecorate || opcode == spv::OpGroupMemberDecorate) {
+            return true;
         }
+        if (opcode == spv::OpFunction || length == 0) break;
+        offset += length;
     }
+    return false;
+}
+}  // namespace
 
-    SHADER_MODULE_STATE::SetPushConstantUsedInShader(module_state, entry_points);
-    return entry_points;
+std::shared_ptr<const std::vector<uint32_t>> GetSharedSpirv(const uint32_t *code, size_t word_count) {
+    static const uint32_t kNoCode = 0;
+    return GetSpirvCache().Get(code ? code : &kNoCode, code ? word_count : 0, nullptr);
 }
 
-void SHADER_MODULE_STATE::PreprocessShaderBinary(const spv_target_env env) {
-    if (static_data_.has_group_decoration) {
+std::shared_ptr<const std::vector<uint32_t>> SHADER_MODULE_STATE::PreprocessShaderBinary(const uint32_t *code, size_t word_count,
+                                                                                         const spv_target_env env) {
+    if (HasGroupDecoration(code, word_count)) {
         spvtools::Optimizer optimizer(env);
         optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
         std::vector<uint32_t> optimized_binary;
         // Run optimizer to flatten decorations only, set skip_validation so as to not re-run validator
-        auto result = optimizer.Run(words.data(), words.size(), &optimized_binary, spvtools::ValidatorOptions(), true);
+        auto result = optimizer.Run(code, word_count, &optimized_binary, spvtools::ValidatorOptions(), true);
 
         if (result) {
-            // NOTE: We need to update words with the result from the spirv-tools optimizer.
-            // **THIS ONLY HAPPENS ON INITIALIZATION**. words should remain const for the lifetime
-            // of the SHADER_MODULE_STATE instance.
-            *const_cast<std::vector<uint32_t> *>(&words) = std::move(optimized_binary);
+            // Done before the module is parsed, so that everything extracted from it refers to the code that is kept
+            return GetSpirvCache().Get(optimized_binary.data(), optimized_binary.size(), &optimized_binary);
         }
     }
+    return GetSharedSpirv(code, word_count);
 }
 
 char const *StorageClassName(uint32_t sc) {
@@ -631,6 +716,78 @@ spirv_inst_iter SHADER_MODULE_STATE::FindEntrypoint(char const *name, VkShaderSt
     return end();
 }
 
+static bool WrotePrimitiveShadingRate(VkShaderStageFlagBits stage_flag, spirv_inst_iter entrypoint,
+                                      const SHADER_MODULE_STATE &module_state) {
+    bool primitiverate_written = false;
+    if (stage_flag == VK_SHADER_STAGE_VERTEX_BIT || stage_flag == VK_SHADER_STAGE_GEOMETRY_BIT ||
+        stage_flag == VK_SHADER_STAGE_MESH_BIT_NV) {
+        for (const auto &set : module_state.GetBuiltinDecorationList()) {
+            auto insn = module_state.at(set.offset);
+            if (set.builtin == spv::BuiltInPrimitiveShadingRateKHR) {
+                primitiverate_written = module_state.IsBuiltInWritten(insn, entrypoint);
+            }
+            if (primitiverate_written) {
+                break;
+            }
+        }
+    }
+    return primitiverate_written;
+}
+
+SHADER_MODULE_STATE::EntryPointState::EntryPointState(const SHADER_MODULE_STATE &module_state, const char *name,
+                                                      VkShaderStageFlagBits stage)
+    : entrypoint(module_state.FindEntrypoint(name, stage)),
+      accessible_ids(module_state.MarkAccessibleIds(entrypoint)),
+      descriptor_uses(module_state.CollectInterfaceByDescriptorSlot(accessible_ids)),
+      has_writable_descriptor(std::any_of(descriptor_uses.begin(), descriptor_uses.end(),
+                                          [](const DescriptorUse &use) { return use.second.is_writable; })),
+      has_atomic_descriptor(std::any_of(descriptor_uses.begin(), descriptor_uses.end(),
+                                        [](const DescriptorUse &use) { return use.second.is_atomic_operation; })),
+      wrote_primitive_shading_rate(WrotePrimitiveShadingRate(stage, entrypoint, module_state)) {
+    const auto *entry_point = module_state.FindEntrypointStruct(name, stage);
+    if (entry_point) {
+        SetPushConstantUsedInShader(module_state, *entry_point, push_constant_used_in_shader);
+    }
+}
+
+std::shared_ptr<const SHADER_MODULE_STATE::EntryPointState> SHADER_MODULE_STATE::GetEntryPointState(
+    char const *name, VkShaderStageFlagBits stageBits) const {
+    std::lock_guard<std::mutex> guard(entry_point_state_lock_);
+    auto &entry_point_state = entry_point_states_[std::make_pair(std::string(name), stageBits)];
+    if (!entry_point_state) {
+        entry_point_state = std::make_shared<EntryPointState>(*this, name, stageBits);
+    }
+    return entry_point_state;
+}
+
+bool SHADER_MODULE_STATE::HasCompatibleInterface(const spirv_inst_iter &entrypoint, const SHADER_MODULE_STATE &consumer,
+                                                 const spirv_inst_iter &consumer_entrypoint) const {
+    if (!consumer.spirv) return false;
+    std::lock_guard<std::mutex> guard(compatible_interface_lock_);
+    for (const auto &entry : compatible_interfaces_) {
+        if (entry.entrypoint == entrypoint.offset() && entry.consumer_entrypoint == consumer_entrypoint.offset() &&
+            entry.consumer_code == consumer.spirv.get() && !entry.consumer_spirv.expired()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SHADER_MODULE_STATE::SetCompatibleInterface(const spirv_inst_iter &entrypoint, const SHADER_MODULE_STATE &consumer,
+                                                 const spirv_inst_iter &consumer_entrypoint) const {
+    if (!consumer.spirv) return;
+    const CompatibleInterface new_entry = {entrypoint.offset(), consumer_entrypoint.offset(), consumer.spirv.get(),
+                                           consumer.spirv};
+    std::lock_guard<std::mutex> guard(compatible_interface_lock_);
+    for (auto &entry : compatible_interfaces_) {
+        if (entry.consumer_spirv.expired()) {
+            entry = new_entry;
+            return;
+        }
+    }
+    compatible_interfaces_.emplace_back(new_entry);
+}
+
 // Because the following is legal, need the entry point
 //    OpEntryPoint GLCompute %main "name_a"
 //    OpEntryPoint GLCompute %main "name_b"
@@ -1013,29 +1170,26 @@ void SHADER_MODULE_STATE::SetUsedStructMember(const uint32_t variable_id, const
 }
 
 // static
-void SHADER_MODULE_STATE::SetPushConstantUsedInShader(
-    const SHADER_MODULE_STATE &module_state, std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> &entry_points) {
-    for (auto &entrypoint : entry_points) {
-        auto range = entrypoint.second.decorate_list.equal_range(spv::OpVariable);
-        for (auto it = range.first; it != range.second; ++it) {
-            const auto def_insn = module_state.at(it->second);
+void SHADER_MODULE_STATE::SetPushConstantUsedInShader(const SHADER_MODULE_STATE &module_state, const EntryPoint &entrypoint,
+                                                      shader_struct_member &push_constant_used_in_shader) {
+    auto range = entrypoint.decorate_list.equal_range(spv::OpVariable);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto def_insn = module_state.at(it->second);
 
-            if (def_insn.word(3) == spv::StorageClassPushConstant) {
-                spirv_inst_iter type = module_state.get_def(def_insn.word(1));
-                const auto range2 = entrypoint.second.decorate_list.equal_range(spv::OpMemberDecorate);
-                std::vector<uint32_t> offsets;
+        if (def_insn.word(3) == spv::StorageClassPushConstant) {
+            spirv_inst_iter type = module_state.get_def(def_insn.word(1));
+            const auto range2 = entrypoint.decorate_list.equal_range(spv::OpMemberDecorate);
+            std::vector<uint32_t> offsets;
 
-                for (auto it2 = range2.first; it2 != range2.second; ++it2) {
-                    auto member_decorate = module_state.at(it2->second);
-                    if (member_decorate.len() == 5 && member_decorate.word(3) == spv::DecorationOffset) {
-                        offsets.emplace_back(member_decorate.offset());
-                    }
+            for (auto it2 = range2.first; it2 != range2.second; ++it2) {
+                auto member_decorate = module_state.at(it2->second);
+                if (member_decorate.len() == 5 && member_decorate.word(3) == spv::DecorationOffset) {
+                    offsets.emplace_back(member_decorate.offset());
                 }
-                entrypoint.second.push_constant_used_in_shader.root = &entrypoint.second.push_constant_used_in_shader;
-                module_state.DefineStructMember(type, offsets, entrypoint.second.push_constant_used_in_shader);
-                module_state.SetUsedStructMember(def_insn.word(2), entrypoint.second.function_set_list,
-                                                 entrypoint.second.push_constant_used_in_shader);
             }
+            push_constant_used_in_shader.root = &push_constant_used_in_shader;
+            module_state.DefineStructMember(type, offsets, push_constant_used_in_shader);
+            module_state.SetUsedStructMember(def_insn.word(2), entrypoint.function_set_list, push_constant_used_in_shader);
         }
     }
 }
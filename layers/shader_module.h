@@ -22,6 +22,10 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -220,13 +224,16 @@ struct shader_struct_member {
 
 struct shader_module_used_operators;
 
+// Returns an immutable copy of the SPIR-V which is shared by every caller passing identical code, so that identical modules
+// and the GPU-AV and debug printf shader trackers hold a single copy between them. Copies are freed with their last user.
+std::shared_ptr<const std::vector<uint32_t>> GetSharedSpirv(const uint32_t *code, size_t word_count);
+
 struct SHADER_MODULE_STATE : public BASE_NODE {
     struct EntryPoint {
         uint32_t offset;  // into module to get OpEntryPoint instruction
         VkShaderStageFlagBits stage;
         std::unordered_multimap<uint32_t, uint32_t> decorate_list;  // key: spv::Op,  value: offset
         std::vector<function_set> function_set_list;
-        shader_struct_member push_constant_used_in_shader;
     };
 
     // Static/const data extracted from a SPIRV module.
@@ -234,15 +241,23 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         SpirvStaticData() = default;
         SpirvStaticData(const SHADER_MODULE_STATE &module_state);
 
-        // A mapping of <id> to the first word of its def. this is useful because walking type
-        // trees, constant expressions, etc requires jumping all over the instruction stream.
-        layer_data::unordered_map<uint32_t, uint32_t> def_index;
-        layer_data::unordered_map<uint32_t, decoration_set> decorations;
+        // A mapping of <id> to the first word of its def, 0 for ids without one. this is useful because walking type
+        // trees, constant expressions, etc requires jumping all over the instruction stream. SPIR-V ids are dense and below
+        // the bound in the module header, so the ids index the arrays directly.
+        std::vector<uint32_t> def_index;
+        // <id> to the decorations of the id, as one plus the index into decorations; 0 for ids without decorations
+        std::vector<uint32_t> decoration_index;
+        std::vector<decoration_set> decorations;
         // <Specialization constant ID -> target ID> mapping
         layer_data::unordered_map<uint32_t, uint32_t> spec_const_map;
         // Find all decoration instructions to prevent relooping module later - many checks need this info
         std::vector<spirv_inst_iter> decoration_inst;
         std::vector<spirv_inst_iter> member_decoration_inst;
+        // Instructions that checks look up by opcode, so that those checks do not have to walk the whole module
+        std::vector<spirv_inst_iter> capability_inst;
+        std::vector<spirv_inst_iter> variable_inst;
+        // OpEmitStreamVertex and OpEndStreamPrimitive
+        std::vector<spirv_inst_iter> stream_inst;
         // Execution are not tied to an entry point and are their own mapping tied to entry point function
         // [OpEntryPoint function <id> operand] : [Execution Mode Instruction list]
         layer_data::unordered_map<uint32_t, std::vector<spirv_inst_iter>> execution_mode_inst;
@@ -250,7 +265,6 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         std::vector<builtin_set> builtin_decoration_list;
         std::unordered_map<uint32_t, atomic_instruction> atomic_inst;
 
-        bool has_group_decoration = false;
         bool has_specialization_constants{false};
 
         // entry point is not unqiue to single value so need multimap
@@ -258,49 +272,90 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         bool multiple_entry_points{false};
     };
 
-    // The spirv image itself
+    // What a pipeline stage needs to know about the entry point it uses. This depends only on the module, the entry point
+    // name and the stage, so it is computed the first time a pipeline uses the entry point and then shared by every pipeline
+    // stage using the same shader. Entry points no pipeline uses are never analyzed.
+    struct EntryPointState {
+        using DescriptorUse = std::pair<DescriptorSlot, interface_var>;
+
+        spirv_inst_iter entrypoint;
+        layer_data::unordered_set<uint32_t> accessible_ids;
+        std::vector<DescriptorUse> descriptor_uses;
+        bool has_writable_descriptor;
+        bool has_atomic_descriptor;
+        bool wrote_primitive_shading_rate;
+        // Not copyable, the root of the members points back at it
+        shader_struct_member push_constant_used_in_shader;
+
+        EntryPointState(const SHADER_MODULE_STATE &module_state, const char *name, VkShaderStageFlagBits stage);
+        EntryPointState(const EntryPointState &) = delete;
+        EntryPointState &operator=(const EntryPointState &) = delete;
+    };
+
+    // The spirv image itself, see GetSharedSpirv()
     // NOTE: this _must_ be initialized first.
     // NOTE: this may end up being an _optimized_ version of what was passed in at initialization time.
-    const std::vector<uint32_t> words;
+    const std::shared_ptr<const std::vector<uint32_t>> spirv;
+    const std::vector<uint32_t> &words;
 
     const SpirvStaticData static_data_;
 
     const bool has_valid_spirv{false};
     const uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
 
-    SHADER_MODULE_STATE(const uint32_t *code, std::size_t count, spv_target_env env = SPV_ENV_VULKAN_1_0)
+    SHADER_MODULE_STATE(const uint32_t *code, std::size_t count)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words(code, code + (count / sizeof(uint32_t))) {
-        PreprocessShaderBinary(env);
-    }
+          spirv(GetSharedSpirv(code, count / sizeof(uint32_t))),
+          words(*spirv) {}
 
     template <typename SpirvContainer>
     SHADER_MODULE_STATE(const SpirvContainer &spirv)
         : SHADER_MODULE_STATE(spirv.data(), spirv.size() * sizeof(typename SpirvContainer::value_type)) {}
 
+    // Borrows already shared SPIR-V without copying it, a null spirv is an empty module
+    SHADER_MODULE_STATE(const std::shared_ptr<const std::vector<uint32_t>> &spirv)
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          spirv(spirv ? spirv : GetSharedSpirv(nullptr, 0)),
+          words(*this->spirv) {}
+
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, spv_target_env env, uint32_t unique_shader_id)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
+          spirv(PreprocessShaderBinary(create_info.pCode, create_info.codeSize / sizeof(uint32_t), env)),
+          words(*spirv),
           static_data_(*this),
           has_valid_spirv(true),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
 
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, spv_target_env env,
                         uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
-          words(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
+          spirv(PreprocessShaderBinary(create_info.pCode, create_info.codeSize / sizeof(uint32_t), env)),
+          words(*spirv),
           static_data_(*this),
           has_valid_spirv(true),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
 
-    SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
+    SHADER_MODULE_STATE()
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          spirv(GetSharedSpirv(nullptr, 0)),
+          words(*spirv) {}
+
+    size_t DynamicMemoryUsage() const override {
+        return VectorMemoryUsage(words) + VectorMemoryUsage(static_data_.def_index) +
+               VectorMemoryUsage(static_data_.decoration_index) + VectorMemoryUsage(static_data_.decorations) +
+               VectorMemoryUsage(static_data_.decoration_inst) + VectorMemoryUsage(static_data_.member_decoration_inst) +
+               VectorMemoryUsage(static_data_.capability_inst) + VectorMemoryUsage(static_data_.variable_inst) +
+               VectorMemoryUsage(static_data_.stream_inst);
+    }
 
     const std::vector<spirv_inst_iter> &GetDecorationInstructions() const { return static_data_.decoration_inst; }
 
+    const std::vector<spirv_inst_iter> &GetCapabilityInstructions() const { return static_data_.capability_inst; }
+
+    const std::vector<spirv_inst_iter> &GetVariableInstructions() const { return static_data_.variable_inst; }
+
+    const std::vector<spirv_inst_iter> &GetStreamInstructions() const { return static_data_.stream_inst; }
+
     const std::unordered_map<uint32_t, atomic_instruction> &GetAtomicInstructions() const { return static_data_.atomic_inst; }
 
     const layer_data::unordered_map<uint32_t, std::vector<spirv_inst_iter>> &GetExecutionModeInstructions() const {
@@ -321,8 +376,9 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     decoration_set get_decorations(uint32_t id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = static_data_.decorations.find(id);
-        if (it != static_data_.decorations.end()) return it->second;
+        if (id < static_data_.decoration_index.size() && static_data_.decoration_index[id] != 0) {
+            return static_data_.decorations[static_data_.decoration_index[id] - 1];
+        }
         return decoration_set();
     }
 
@@ -334,11 +390,10 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(uint32_t id) const {
-        auto it = static_data_.def_index.find(id);
-        if (it == static_data_.def_index.end()) {
+        if (id >= static_data_.def_index.size() || static_data_.def_index[id] == 0) {
             return end();
         }
-        return at(it->second);
+        return at(static_data_.def_index[id]);
     }
 
     // Used to get human readable strings for error messages
@@ -355,6 +410,14 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     const EntryPoint *FindEntrypointStruct(char const *name, VkShaderStageFlagBits stageBits) const;
     spirv_inst_iter FindEntrypoint(char const *name, VkShaderStageFlagBits stageBits) const;
+    std::shared_ptr<const EntryPointState> GetEntryPointState(char const *name, VkShaderStageFlagBits stageBits) const;
+
+    // Remembers the entry points of other modules whose inputs were found to match the outputs of one of this module's entry
+    // points, so that pipelines sharing a pair of stages only compare their interfaces once
+    bool HasCompatibleInterface(const spirv_inst_iter &entrypoint, const SHADER_MODULE_STATE &consumer,
+                                const spirv_inst_iter &consumer_entrypoint) const;
+    void SetCompatibleInterface(const spirv_inst_iter &entrypoint, const SHADER_MODULE_STATE &consumer,
+                                const spirv_inst_iter &consumer_entrypoint) const;
     bool FindLocalSize(const spirv_inst_iter &entrypoint, uint32_t &local_size_x, uint32_t &local_size_y,
                        uint32_t &local_size_z) const;
 
@@ -376,8 +439,8 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                              const shader_struct_member &data) const;
 
     // Push consants
-    static void SetPushConstantUsedInShader(const SHADER_MODULE_STATE &module_state,
-                                            std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> &entry_points);
+    static void SetPushConstantUsedInShader(const SHADER_MODULE_STATE &module_state, const EntryPoint &entrypoint,
+                                            shader_struct_member &push_constant_used_in_shader);
 
     uint32_t DescriptorTypeToReqs(uint32_t type_id) const;
 
@@ -407,10 +470,24 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
   private:
     // Functions used for initialization only
-    // Used to populate the shader module object
-    void PreprocessShaderBinary(spv_target_env env);
-
-    static std::unordered_multimap<std::string, EntryPoint> ProcessEntryPoints(const SHADER_MODULE_STATE &module_state);
+    // Flattens group decorations before the module is parsed, returns the code to use
+    static std::shared_ptr<const std::vector<uint32_t>> PreprocessShaderBinary(const uint32_t *code, size_t word_count,
+                                                                               spv_target_env env);
+
+    // Filled on first use by GetEntryPointState()
+    mutable std::mutex entry_point_state_lock_;
+    mutable std::map<std::pair<std::string, VkShaderStageFlagBits>, std::shared_ptr<const EntryPointState>> entry_point_states_;
+
+    // Consumers are identified by their shared SPIR-V, which identical modules have in common. It is held weakly, an expired
+    // entry never matches and is reused by the next insertion.
+    struct CompatibleInterface {
+        uint32_t entrypoint;
+        uint32_t consumer_entrypoint;
+        const std::vector<uint32_t> *consumer_code;
+        std::weak_ptr<const std::vector<uint32_t>> consumer_spirv;
+    };
+    mutable std::mutex compatible_interface_lock_;
+    mutable std::vector<CompatibleInterface> compatible_interfaces_;
 };
 
 // String helpers functions to give better error messages
@@ -36,6 +36,7 @@
 #include "vk_layer_utils.h"
 #include "chassis.h"
 #include "core_validation.h"
+#include "layer_trace.h"
 #include "spirv_grammar_helper.h"
 
 #include "xxhash.h"
@@ -380,9 +381,11 @@ PushConstantByteState CoreChecks::ValidatePushConstantSetUpdate(const std::vecto
     return PC_Byte_Updated;
 }
 
-bool CoreChecks::ValidatePushConstantUsage(const PIPELINE_STATE &pipeline, SHADER_MODULE_STATE const *module_state,
-                                           safe_VkPipelineShaderStageCreateInfo const *pStage, const std::string &vuid) const {
+bool CoreChecks::ValidatePushConstantUsage(const PIPELINE_STATE &pipeline, const PipelineStageState &stage_state,
+                                           const std::string &vuid) const {
     bool skip = false;
+    const auto *module_state = stage_state.module_state.get();
+    const auto *pStage = stage_state.create_info;
     // Temp workaround to prevent false positive errors
     // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/2450
     if (module_state->HasMultipleEntryPoints()) {
@@ -390,8 +393,8 @@ bool CoreChecks::ValidatePushConstantUsage(const PIPELINE_STATE &pipeline, SHADE
     }
 
     // Validate directly off the offsets. this isn't quite correct for arrays and matrices, but is a good first step.
-    const auto *entrypoint = module_state->FindEntrypointStruct(pStage->pName, pStage->stage);
-    if (!entrypoint || !entrypoint->push_constant_used_in_shader.IsUsed()) {
+    const auto &push_constant_used_in_shader = stage_state.push_constant_used_in_shader;
+    if (!push_constant_used_in_shader.IsUsed()) {
         return skip;
     }
     const auto &pipeline_layout = pipeline.PipelineLayoutState();
@@ -408,11 +411,10 @@ bool CoreChecks::ValidatePushConstantUsage(const PIPELINE_STATE &pipeline, SHADE
             }
             push_constant_bytes_set.resize(range.offset + range.size, PC_Byte_Updated);
             uint32_t issue_index = 0;
-            const auto ret =
-                ValidatePushConstantSetUpdate(push_constant_bytes_set, entrypoint->push_constant_used_in_shader, issue_index);
+            const auto ret = ValidatePushConstantSetUpdate(push_constant_bytes_set, push_constant_used_in_shader, issue_index);
 
             if (ret == PC_Byte_Not_Set) {
-                const auto loc_descr = entrypoint->push_constant_used_in_shader.GetLocationDesc(issue_index);
+                const auto loc_descr = push_constant_used_in_shader.GetLocationDesc(issue_index);
                 LogObjectList objlist(module_state->vk_shader_module());
                 objlist.add(pipeline_layout->layout());
                 skip |= LogError(objlist, vuid, "Push constant buffer:%s in %s is out of range in %s.", loc_descr.c_str(),
@@ -781,52 +783,41 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(SHADER_MODULE_STATE const
 
     auto entrypoint_variables = FindEntrypointInterfaces(entrypoint);
 
-    for (auto insn : *module_state) {
-        switch (insn.opcode()) {
-            // Find all Patch decorations
-            case spv::OpDecorate:
-                switch (insn.word(2)) {
-                    case spv::DecorationPatch: {
-                        patch_i_ds.insert(insn.word(1));
-                        break;
-                    }
-                    default:
-                        break;
-                }
-                break;
-            // Find all input and output variables
-            case spv::OpVariable: {
-                Variable var = {};
-                var.storageClass = insn.word(3);
-                if ((var.storageClass == spv::StorageClassInput || var.storageClass == spv::StorageClassOutput) &&
-                    // Only include variables in the entrypoint's interface
-                    find(entrypoint_variables.begin(), entrypoint_variables.end(), insn.word(2)) != entrypoint_variables.end()) {
-                    var.baseTypePtrID = insn.word(1);
-                    var.ID = insn.word(2);
-                    variables.push_back(var);
-                }
-                break;
+    // Find all Patch decorations
+    for (const auto &insn : module_state->GetDecorationInstructions()) {
+        if (insn.word(2) == spv::DecorationPatch) {
+            patch_i_ds.insert(insn.word(1));
+        }
+    }
+    // Find all input and output variables
+    for (const auto &insn : module_state->GetVariableInstructions()) {
+        Variable var = {};
+        var.storageClass = insn.word(3);
+        if ((var.storageClass == spv::StorageClassInput || var.storageClass == spv::StorageClassOutput) &&
+            // Only include variables in the entrypoint's interface
+            find(entrypoint_variables.begin(), entrypoint_variables.end(), insn.word(2)) != entrypoint_variables.end()) {
+            var.baseTypePtrID = insn.word(1);
+            var.ID = insn.word(2);
+            variables.push_back(var);
+        }
+    }
+    const auto &execution_mode_inst = module_state->GetExecutionModeInstructions();
+    const auto execution_modes = execution_mode_inst.find(entrypoint.word(2));
+    if (execution_modes != execution_mode_inst.end()) {
+        for (const auto &insn : execution_modes->second) {
+            switch (insn.word(2)) {
+                default:
+                    break;
+                case spv::ExecutionModeOutputVertices:
+                    num_vertices = insn.word(3);
+                    break;
+                case spv::ExecutionModeIsolines:
+                    is_iso_lines = true;
+                    break;
+                case spv::ExecutionModePointMode:
+                    is_point_mode = true;
+                    break;
             }
-            case spv::OpExecutionMode:
-            case spv::OpExecutionModeId:
-                if (insn.word(1) == entrypoint.word(2)) {
-                    switch (insn.word(2)) {
-                        default:
-                            break;
-                        case spv::ExecutionModeOutputVertices:
-                            num_vertices = insn.word(3);
-                            break;
-                        case spv::ExecutionModeIsolines:
-                            is_iso_lines = true;
-                            break;
-                        case spv::ExecutionModePointMode:
-                            is_point_mode = true;
-                            break;
-                    }
-                }
-                break;
-            default:
-                break;
         }
     }
 
@@ -1492,22 +1483,15 @@ bool CoreChecks::ValidateShaderResolveQCOM(SHADER_MODULE_STATE const *module_sta
     // If the pipeline's subpass description contains flag VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM,
     // then the fragment shader must not enable the SPIRV SampleRateShading capability.
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        for (auto insn : *module_state) {
-            switch (insn.opcode()) {
-                case spv::OpCapability:
-                    if (insn.word(1) == spv::CapabilitySampleRateShading) {
-                        const auto &rp_state = pipeline->RenderPassState();
-                        auto subpass_flags = (!rp_state) ? 0 : rp_state->createInfo.pSubpasses[pipeline->Subpass()].flags;
-                        if ((subpass_flags & VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM) != 0) {
-                            skip |=
-                                LogError(pipeline->pipeline(), "VUID-RuntimeSpirv-SampleRateShading-06378",
-                                         "Invalid Pipeline CreateInfo State: fragment shader enables SampleRateShading capability "
-                                         "and the subpass flags includes VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM.");
-                        }
-                    }
-                    break;
-                default:
-                    break;
+        for (const auto &insn : module_state->GetCapabilityInstructions()) {
+            if (insn.word(1) == spv::CapabilitySampleRateShading) {
+                const auto &rp_state = pipeline->RenderPassState();
+                auto subpass_flags = (!rp_state) ? 0 : rp_state->createInfo.pSubpasses[pipeline->Subpass()].flags;
+                if ((subpass_flags & VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM) != 0) {
+                    skip |= LogError(pipeline->pipeline(), "VUID-RuntimeSpirv-SampleRateShading-06378",
+                                     "Invalid Pipeline CreateInfo State: fragment shader enables SampleRateShading capability "
+                                     "and the subpass flags includes VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM.");
+                }
             }
         }
     }
@@ -2350,7 +2334,7 @@ bool CoreChecks::ValidateTransformFeedback(SHADER_MODULE_STATE const *module_sta
 
     layer_data::unordered_set<uint32_t> emitted_streams;
     bool output_points = false;
-    for (const auto &insn : *module_state) {
+    for (const auto &insn : module_state->GetStreamInstructions()) {
         const uint32_t opcode = insn.opcode();
         if (opcode == spv::OpEmitStreamVertex) {
             emitted_streams.emplace(static_cast<uint32_t>(module_state->GetConstantValueById(insn.word(1))));
@@ -2367,9 +2351,12 @@ bool CoreChecks::ValidateTransformFeedback(SHADER_MODULE_STATE const *module_sta
                     phys_dev_ext_props.transform_feedback_props.maxTransformFeedbackStreams);
             }
         }
-        if ((opcode == spv::OpExecutionMode || opcode == spv::OpExecutionModeId) &&
-            insn.word(2) == spv::ExecutionModeOutputPoints) {
-            output_points = true;
+    }
+    for (const auto &execution_modes : module_state->GetExecutionModeInstructions()) {
+        for (const auto &insn : execution_modes.second) {
+            if (insn.word(2) == spv::ExecutionModeOutputPoints) {
+                output_points = true;
+            }
         }
     }
 
@@ -2552,9 +2539,11 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
         // setup the call back if the optimizer fails
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage_state, this](
+        bool optimizer_logged = false;
+        spvtools::MessageConsumer consumer = [&skip, &optimizer_logged, &module_state, &stage_state, this](
                                                  spv_message_level_t level, const char *source, const spv_position_t &position,
                                                  const char *message) {
+            optimizer_logged = true;
             skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
                              "%s does not contain valid spirv for stage %s. %s",
                              report_data->FormatHandle(module_state->vk_shader_module()).c_str(),
@@ -2639,15 +2628,39 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
         // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
         optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
 
-        // Apply the specialization-constant values and revalidate the shader module is valid.
+        // A specialization that passed before only has its results looked up
+        auto *cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+        const uint64_t specialization_hash =
+            cache ? ValidationCache::MakeSpecializationHash(*module_state, *pStage->ptr(), spirv_environment) : 0;
+        ValidationCache::SpecializationResult cached_result;
         std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state->words.data(), module_state->words.size(), &specialized_spirv, options, false);
+        bool optimized = false;
+        if (cache && cache->FindSpecialization(specialization_hash, cached_result)) {
+            specialization_cache_hits.Add();
+            local_size_x = cached_result.local_size_x;
+            local_size_y = cached_result.local_size_y;
+            local_size_z = cached_result.local_size_z;
+        } else {
+            if (cache) specialization_cache_misses.Add();
+            // Apply the specialization-constant values and revalidate the shader module is valid.
+            optimized = optimizer.Run(module_state->words.data(), module_state->words.size(), &specialized_spirv, options, false);
+            if (!optimized) {
+                // Should never get here, but better then asserting
+                skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06719",
+                                 "%s module (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
+                                 report_data->FormatHandle(module_state->vk_shader_module()).c_str(),
+                                 string_VkShaderStageFlagBits(stage_state.stage_flag));
+            }
+        }
         if (optimized) {
             spv_context ctx = spvContextCreate(spirv_environment);
             spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
             spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+            spv_result_t spv_valid;
+            {
+                TraceScope trace("CoreChecks", "spirv-val");
+                spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+            }
             if (spv_valid != SPV_SUCCESS) {
                 skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06719",
                                  "After specialization was applied, %s does not contain valid spirv for stage %s.",
@@ -2711,14 +2724,13 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
                 local_size_z = constant_def_value.find(local_size_id_z)->second;
             }
 
+            if (cache && spv_valid == SPV_SUCCESS && !optimizer_logged) {
+                cache->InsertSpecialization(specialization_hash,
+                                            ValidationCache::SpecializationResult{local_size_x, local_size_y, local_size_z});
+            }
+
             spvDiagnosticDestroy(diag);
             spvContextDestroy(ctx);
-        } else {
-            // Should never get here, but better then asserting
-            skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06719",
-                             "%s module (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
-                             report_data->FormatHandle(module_state->vk_shader_module()).c_str(),
-                             string_VkShaderStageFlagBits(stage_state.stage_flag));
         }
     }
 
@@ -2816,7 +2828,7 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
     }
 
     // Validate Push Constants use
-    skip |= ValidatePushConstantUsage(*pipeline, module_state, pStage, vuid_layout_mismatch);
+    skip |= ValidatePushConstantUsage(*pipeline, stage_state, vuid_layout_mismatch);
 
     // Validate descriptor use
     for (auto use : stage_state.descriptor_uses) {
@@ -2889,6 +2901,12 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
                                                 spirv_inst_iter consumer_entrypoint,
                                                 shader_stage_attributes const *consumer_stage) const {
     bool skip = false;
+    // Interfaces only depend on the modules, so a pair of entry points that matched before matches again
+    if (producer->HasCompatibleInterface(producer_entrypoint, *consumer, consumer_entrypoint)) {
+        return skip;
+    }
+    // Any message, warnings included, keeps the pair out of the cache so that every pipeline using it reports it
+    bool compatible = true;
 
     auto outputs =
         producer->CollectInterfaceByLocation(producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
@@ -2916,6 +2934,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
         assert(b_at_end || b_component < b_length);
 
         if (b_at_end || ((!a_at_end) && (a_first < b_first))) {
+            compatible = false;
             skip |= LogPerformanceWarning(producer->vk_shader_module(), kVUID_Core_Shader_OutputNotConsumed,
                                           "%s writes to output location %" PRIu32 ".%" PRIu32 " which is not consumed by %s",
                                           producer_stage->name, a_first.first, a_first.second, consumer_stage->name);
@@ -2926,6 +2945,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
                 a_component++;
             }
         } else if (a_at_end || a_first > b_first) {
+            compatible = false;
             skip |= LogError(consumer->vk_shader_module(), kVUID_Core_Shader_InputNotProduced,
                              "%s consumes input location %" PRIu32 ".%" PRIu32 " which is not written by %s", consumer_stage->name,
                              b_first.first, b_first.second, producer_stage->name);
@@ -2941,6 +2961,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
             // - if is_block_member, then the extra array level of an arrayed interface is not
             //   expressed in the member type -- it's expressed in the block type.
             if (!TypesMatch(producer, consumer, a_it->second.type_id, b_it->second.type_id)) {
+                compatible = false;
                 skip |= LogError(producer->vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Type mismatch on location %" PRIu32 ".%" PRIu32 ": '%s' vs '%s'", a_first.first, a_first.second,
                                  producer->DescribeType(a_it->second.type_id).c_str(),
@@ -2950,12 +2971,14 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
                 continue;
             }
             if (a_it->second.is_patch != b_it->second.is_patch) {
+                compatible = false;
                 skip |= LogError(producer->vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Decoration mismatch on location %u.%u: is per-%s in %s stage but per-%s in %s stage",
                                  a_first.first, a_first.second, a_it->second.is_patch ? "patch" : "vertex", producer_stage->name,
                                  b_it->second.is_patch ? "patch" : "vertex", consumer_stage->name);
             }
             if (a_it->second.is_relaxed_precision != b_it->second.is_relaxed_precision) {
+                compatible = false;
                 skip |= LogError(producer->vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Decoration mismatch on location %" PRIu32 ".%" PRIu32 ": %s and %s stages differ in precision",
                                  a_first.first, a_first.second, producer_stage->name, consumer_stage->name);
@@ -2993,6 +3016,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
 
         if (!builtins_producer.empty() && !builtins_consumer.empty()) {
             if (builtins_producer.size() != builtins_consumer.size()) {
+                compatible = false;
                 skip |= LogError(producer->vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Number of elements inside builtin block differ between stages (%s %d vs %s %d).",
                                  producer_stage->name, static_cast<int>(builtins_producer.size()), consumer_stage->name,
@@ -3002,6 +3026,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
                 auto it_consumer = builtins_consumer.begin();
                 while (it_producer != builtins_producer.end() && it_consumer != builtins_consumer.end()) {
                     if (*it_producer != *it_consumer) {
+                        compatible = false;
                         skip |= LogError(producer->vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                          "Builtin variable inside block doesn't match between %s and %s.", producer_stage->name,
                                          consumer_stage->name);
@@ -3014,6 +3039,9 @@ bool CoreChecks::ValidateInterfaceBetweenStages(SHADER_MODULE_STATE const *produ
         }
     }
 
+    if (compatible) {
+        producer->SetCompatibleInterface(producer_entrypoint, *consumer, consumer_entrypoint);
+    }
     return skip;
 }
 
@@ -3040,9 +3068,13 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
     bool skip = false;
 
     if (pipeline->IsGraphicsLibrary()) {
-        // Only validate stages in an executable pipeline, not a graphics library
-        // TODO This currently makes executing executable pipeline more expensive than they need to be since we could be validating
-        // more per library.
+        // Validate each stage once, in the library that defines it, so that linking only has to do the checks between stages.
+        // The point size check is left to the executable pipeline, the topology may come from another library.
+        for (auto &stage : pipeline->stage_state) {
+            if (!stage.from_library) {
+                skip |= ValidatePipelineShaderStage(pipeline, stage, false);
+            }
+        }
         return skip;
     }
 
@@ -3050,7 +3082,15 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
 
     const PipelineStageState *vertex_stage = nullptr, *fragment_stage = nullptr;
     for (auto &stage : pipeline->stage_state) {
-        skip |= ValidatePipelineShaderStage(pipeline, stage, (pointlist_stage_mask == stage.stage_flag));
+        const bool check_point_size = (pointlist_stage_mask == stage.stage_flag);
+        if (!stage.from_library) {
+            skip |= ValidatePipelineShaderStage(pipeline, stage, check_point_size);
+        } else if (check_point_size) {
+            const auto *raster_state = pipeline->RasterizationState();
+            if (raster_state && !raster_state->rasterizerDiscardEnable) {
+                skip |= ValidatePointListShaderState(pipeline, stage.module_state.get(), stage.entrypoint, stage.stage_flag);
+            }
+        }
         if (stage.stage_flag == VK_SHADER_STAGE_VERTEX_BIT) {
             vertex_stage = &stage;
         }
@@ -3301,7 +3341,43 @@ bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, VkPipeline
     return skip;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
+ValidationCache::ShaderHash ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) {
+    // Any fixed seed other than the lookup hash's gives an independent check
+    static const uint64_t kCheckSeed = 0x9E3779B97F4A7C15ULL;
+    ShaderHash shader_hash;
+    shader_hash.hash = XXH64(smci->pCode, smci->codeSize, 0);
+    shader_hash.check = XXH64(smci->pCode, smci->codeSize, kCheckSeed);
+    shader_hash.code_size = static_cast<uint32_t>(smci->codeSize);
+    return shader_hash;
+}
+
+uint64_t ValidationCache::MakeSpecializationHash(const SHADER_MODULE_STATE &module_state,
+                                                 const VkPipelineShaderStageCreateInfo &stage, spv_target_env env) {
+    std::vector<uint8_t> key;
+    auto append = [&key](const void *data, size_t size) {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+        key.insert(key.end(), bytes, bytes + size);
+    };
+    const uint64_t module_hash = XXH64(module_state.words.data(), module_state.words.size() * sizeof(uint32_t), 0);
+    append(&module_hash, sizeof(module_hash));
+    append(&env, sizeof(env));
+    append(&stage.stage, sizeof(stage.stage));
+    append(stage.pName, strlen(stage.pName) + 1);
+    const auto *specialization_info = stage.pSpecializationInfo;
+    if (specialization_info && specialization_info->pMapEntries) {
+        const auto *specialization_data = reinterpret_cast<const uint8_t *>(specialization_info->pData);
+        for (uint32_t i = 0; i < specialization_info->mapEntryCount; ++i) {
+            const auto &map_entry = specialization_info->pMapEntries[i];
+            // Entries outside of the data are not applied, see ValidatePipelineShaderStage
+            if ((map_entry.offset + map_entry.size) > specialization_info->dataSize) continue;
+            append(&map_entry.constantID, sizeof(map_entry.constantID));
+            const uint32_t size = static_cast<uint32_t>(map_entry.size);
+            append(&size, sizeof(size));
+            append(specialization_data + map_entry.offset, map_entry.size);
+        }
+    }
+    return XXH64(key.data(), key.size(), 0);
+}
 
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = LvlFindInChain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
@@ -3314,7 +3390,6 @@ static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *p
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                    const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule) const {
     bool skip = false;
-    spv_result_t spv_valid = SPV_SUCCESS;
 
     if (disabled[shader_validation]) {
         return false;
@@ -3328,46 +3403,102 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          pCreateInfo->codeSize);
     } else {
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        ValidationCache::ShaderHash hash;
         // If app isn't using a shader validation cache, use the default one from CoreChecks
         if (!cache) cache = CastFromHandle<ValidationCache *>(core_validation_cache);
         if (cache) {
             hash = ValidationCache::MakeShaderHash(pCreateInfo);
-            if (cache->Contains(hash)) return false;
+            if (cache->Contains(hash)) {
+                shader_validation_cache_hits.Add();
+                return false;
+            }
+            shader_validation_cache_misses.Add();
         }
 
-        // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
-        // the default values will be used during validation.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-        spv_context ctx = spvContextCreate(spirv_environment);
-        spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
-        spv_diagnostic diag = nullptr;
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
-        spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-        if (spv_valid != SPV_SUCCESS) {
-            if (!have_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
-                if (spv_valid == SPV_WARNING) {
-                    skip |= LogWarning(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
-                                       diag && diag->error ? diag->error : "(no error text)");
-                } else {
-                    skip |= LogError(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
-                                     diag && diag->error ? diag->error : "(no error text)");
-                }
-            }
-        } else {
-            if (cache) {
-                cache->Insert(hash);
+        // Validated on the worker pool once the module has been created, see PostCallRecordCreateShaderModule
+        if (async_shader_validation && validation_worker_pool) return skip;
+
+        skip |= RunSpirvValidator(pCreateInfo->pCode, pCreateInfo->codeSize, cache, hash);
+    }
+
+    return skip;
+}
+
+bool CoreChecks::RunSpirvValidator(const uint32_t *code, size_t code_size, ValidationCache *cache,
+                                   const ValidationCache::ShaderHash &hash) const {
+    TraceScope trace("CoreChecks", "spirv-val");
+    bool skip = false;
+    auto have_glsl_shader = IsExtEnabled(device_extensions.vk_nv_glsl_shader);
+
+    // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
+    // the default values will be used during validation.
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    spv_context ctx = spvContextCreate(spirv_environment);
+    spv_const_binary_t binary{code, code_size / sizeof(uint32_t)};
+    spv_diagnostic diag = nullptr;
+    spvtools::ValidatorOptions options;
+    AdjustValidatorOptions(device_extensions, enabled_features, options);
+    spv_result_t spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+    if (spv_valid != SPV_SUCCESS) {
+        if (!have_glsl_shader || (code[0] == spv::MagicNumber)) {
+            if (spv_valid == SPV_WARNING) {
+                skip |= LogWarning(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
+                                   diag && diag->error ? diag->error : "(no error text)");
+            } else {
+                skip |= LogError(device, kVUID_Core_Shader_InconsistentSpirv, "SPIR-V module not valid: %s",
+                                 diag && diag->error ? diag->error : "(no error text)");
             }
         }
-
-        spvDiagnosticDestroy(diag);
-        spvContextDestroy(ctx);
+    } else {
+        if (cache) {
+            cache->Insert(hash);
+        }
     }
 
+    spvDiagnosticDestroy(diag);
+    spvContextDestroy(ctx);
     return skip;
 }
 
+void CoreChecks::PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                                  VkResult result, void *csm_state_data) {
+    StateTracker::PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, csm_state_data);
+    if (VK_SUCCESS != result || !async_shader_validation || !validation_worker_pool || disabled[shader_validation]) return;
+    // Invalid code sizes were already reported by PreCallValidateCreateShaderModule
+    if (pCreateInfo->codeSize % 4) return;
+
+    auto cache = GetValidationCacheInfo(pCreateInfo);
+    ValidationCache::ShaderHash hash;
+    if (!cache) cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    if (cache) {
+        hash = ValidationCache::MakeShaderHash(pCreateInfo);
+        if (cache->Contains(hash)) return;
+    }
+
+    // The application may free the code as soon as vkCreateShaderModule returns
+    auto code = std::make_shared<std::vector<uint32_t>>(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / 4);
+    const uint64_t sequence = validation_worker_pool->Enqueue(
+        [this, code, cache, hash]() { RunSpirvValidator(code->data(), code->size() * sizeof(uint32_t), cache, hash); });
+    pending_shader_module_validation.insert_or_assign(*pShaderModule, sequence);
+}
+
+void CoreChecks::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                  const VkAllocationCallbacks *pAllocator) {
+    pending_shader_module_validation.erase(shaderModule);
+    StateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
+}
+
+void CoreChecks::WaitForShaderModuleValidation(const VkPipelineShaderStageCreateInfo *stages, uint32_t stage_count) const {
+    if (pending_shader_module_validation.empty()) return;
+    for (uint32_t i = 0; i < stage_count; i++) {
+        auto pending = pending_shader_module_validation.find(stages[i].module);
+        if (pending != pending_shader_module_validation.end()) {
+            validation_worker_pool->WaitForDelivery(pending->second);
+        }
+    }
+}
+
 bool CoreChecks::ValidateComputeWorkGroupSizes(const SHADER_MODULE_STATE *module_state, const spirv_inst_iter &entrypoint,
                                                const PipelineStageState &stage_state, uint32_t local_size_x, uint32_t local_size_y,
                                                uint32_t local_size_z) const {
@@ -22,12 +22,15 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <algorithm>
 #include <cstdlib>
+#include <list>
 
 #include "vulkan/vulkan.h"
 #include <generated/spirv_tools_commit_id.h>
 #include "shader_module.h"
 #include "vk_layer_utils.h"
+#include "validation_cache_log.h"
 
 struct DeviceFeatures;
 struct DeviceExtensions;
@@ -41,12 +44,19 @@ struct shader_stage_attributes {
 
 class ValidationCache {
   public:
-    static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+    // A specialization_limit of 0 uses kDefaultSpecializationLimit
+    static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo, size_t specialization_limit = 0) {
         auto cache = new ValidationCache();
+        if (specialization_limit != 0) cache->specialization_limit_ = specialization_limit;
         cache->Load(pCreateInfo);
         return VkValidationCacheEXT(cache);
     }
 
+    // The data written after the header is
+    //   uint32_t count, then that many ShaderHash entries of kShaderHashEntryWords words each, for modules that passed
+    //   spirv-val: hash and check, low words first, then the code size
+    //   uint32_t count, then that many specialization entries of kSpecializationEntryWords words each: the 64 bit
+    //   MakeSpecializationHash() key, low word first, followed by the SpecializationResult. Most recently used first.
     void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
         auto size = headerSize;
@@ -56,21 +66,39 @@ class ValidationCache {
         if (data[0] != size) return;
         if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
         uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+        MakeCacheUuid(expected_uuid);
         if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
 
+        uint32_t const *end = data + pCreateInfo->initialDataSize / sizeof(uint32_t);
         data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
 
         auto guard = WriteLock();
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes_.insert(*data);
+        if (data == end) return;
+        const uint32_t hash_count = *data++;
+        if (hash_count > static_cast<size_t>(end - data) / kShaderHashEntryWords) return;
+        for (uint32_t i = 0; i < hash_count; i++, data += kShaderHashEntryWords) {
+            ShaderHash shader_hash;
+            shader_hash.hash = static_cast<uint64_t>(data[0]) | (static_cast<uint64_t>(data[1]) << 32);
+            shader_hash.check = static_cast<uint64_t>(data[2]) | (static_cast<uint64_t>(data[3]) << 32);
+            shader_hash.code_size = data[4];
+            good_shader_hashes_.insert(shader_hash);
+        }
+
+        if (data == end) return;
+        const uint32_t specialization_count = *data++;
+        if (specialization_count > static_cast<size_t>(end - data) / kSpecializationEntryWords) return;
+        for (uint32_t i = 0; i < specialization_count; i++, data += kSpecializationEntryWords) {
+            const uint64_t key = static_cast<uint64_t>(data[0]) | (static_cast<uint64_t>(data[1]) << 32);
+            AddLeastRecentSpecialization(key, SpecializationResult{data[2], data[3], data[4]});
         }
     }
 
     void Write(size_t *pDataSize, void *pData) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+        auto guard = ReadLock();
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
+            *pDataSize = headerSize + (2 + good_shader_hashes_.size() * kShaderHashEntryWords) * sizeof(uint32_t) +
+                         good_specializations_.size() * kSpecializationEntryWords * sizeof(uint32_t);
             return;
         }
 
@@ -80,23 +108,49 @@ class ValidationCache {
         }
 
         uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
 
         // Write the header
         *out++ = headerSize;
         *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
+        MakeCacheUuid(reinterpret_cast<uint8_t *>(out));
         out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
 
-        {
-            auto guard = ReadLock();
-            for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-                 it++, out++, actualSize += sizeof(uint32_t)) {
-                *out = *it;
-            }
+        // Write as many entries as fit, keeping the counts consistent with what was written
+        size_t available_words = (*pDataSize - headerSize) / sizeof(uint32_t);
+        if (available_words < 2) {
+            *pDataSize = headerSize;
+            return;
+        }
+        available_words -= 2;
+        const size_t hash_count = std::min(good_shader_hashes_.size(), available_words / kShaderHashEntryWords);
+        available_words -= hash_count * kShaderHashEntryWords;
+        size_t specialization_count = 0;
+        if (hash_count == good_shader_hashes_.size()) {
+            specialization_count = std::min(good_specializations_.size(), available_words / kSpecializationEntryWords);
+        }
+
+        *out++ = static_cast<uint32_t>(hash_count);
+        auto hash_it = good_shader_hashes_.begin();
+        for (size_t i = 0; i < hash_count; i++, ++hash_it) {
+            *out++ = static_cast<uint32_t>(hash_it->hash);
+            *out++ = static_cast<uint32_t>(hash_it->hash >> 32);
+            *out++ = static_cast<uint32_t>(hash_it->check);
+            *out++ = static_cast<uint32_t>(hash_it->check >> 32);
+            *out++ = hash_it->code_size;
+        }
+        *out++ = static_cast<uint32_t>(specialization_count);
+        // Most recently used first, so that a truncated cache keeps the entries most likely to be needed again
+        auto specialization_it = specialization_lru_.begin();
+        for (size_t i = 0; i < specialization_count; i++, ++specialization_it) {
+            *out++ = static_cast<uint32_t>(specialization_it->first);
+            *out++ = static_cast<uint32_t>(specialization_it->first >> 32);
+            *out++ = specialization_it->second.local_size_x;
+            *out++ = specialization_it->second.local_size_y;
+            *out++ = specialization_it->second.local_size_z;
         }
 
-        *pDataSize = actualSize;
+        *pDataSize = headerSize +
+                     (2 + hash_count * kShaderHashEntryWords + specialization_count * kSpecializationEntryWords) * sizeof(uint32_t);
     }
 
     void Merge(ValidationCache const *other) {
@@ -108,26 +162,146 @@ class ValidationCache {
         auto guard = WriteLock();
         good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
         for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+        for (const auto &entry : other->specialization_lru_) AddLeastRecentSpecialization(entry.first, entry.second);
     }
 
-    static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
+    // Identifies a module by two independently seeded 64 bit hashes of its code plus the code size. A module is only treated
+    // as validated when all three match, so a collision in the lookup hash alone can never skip validation of another module.
+    struct ShaderHash {
+        uint64_t hash = 0;
+        uint64_t check = 0;
+        uint32_t code_size = 0;
 
-    bool Contains(uint32_t hash) {
+        bool operator==(const ShaderHash &other) const {
+            return hash == other.hash && check == other.check && code_size == other.code_size;
+        }
+        struct Hasher {
+            size_t operator()(const ShaderHash &shader_hash) const { return static_cast<size_t>(shader_hash.hash); }
+        };
+    };
+
+    static ShaderHash MakeShaderHash(VkShaderModuleCreateInfo const *smci);
+
+    bool Contains(const ShaderHash &hash) {
         auto guard = ReadLock();
         return good_shader_hashes_.count(hash) != 0;
     }
 
-    void Insert(uint32_t hash) {
+    void Insert(const ShaderHash &hash) {
+        bool inserted;
+        {
+            auto guard = WriteLock();
+            inserted = good_shader_hashes_.insert(hash).second;
+        }
+        if (inserted && log_) log_->Append(MakeRecord(hash));
+    }
+
+    // What applying specialization constants to an entry point produced, for the checks that need the specialized module.
+    // Only specializations that passed spirv-val are stored, so that pipelines seen before can skip spirv-opt and spirv-val.
+    // At most specialization_limit_ of them are kept, dropping the least recently used ones.
+    struct SpecializationResult {
+        uint32_t local_size_x;
+        uint32_t local_size_y;
+        uint32_t local_size_z;
+    };
+
+    // Hash of everything the specialized module depends on: the module, the entry point, the constant values and the SPIR-V
+    // environment
+    static uint64_t MakeSpecializationHash(const SHADER_MODULE_STATE &module_state, const VkPipelineShaderStageCreateInfo &stage,
+                                           spv_target_env env);
+
+    bool FindSpecialization(uint64_t hash, SpecializationResult &result) {
+        // Finding an entry makes it the most recently used one
+        auto guard = WriteLock();
+        auto it = good_specializations_.find(hash);
+        if (it == good_specializations_.end()) return false;
+        specialization_lru_.splice(specialization_lru_.begin(), specialization_lru_, it->second);
+        result = it->second->second;
+        return true;
+    }
+
+    void InsertSpecialization(uint64_t hash, const SpecializationResult &result) {
+        bool inserted;
+        {
+            auto guard = WriteLock();
+            inserted = AddMostRecentSpecialization(hash, result);
+        }
+        if (inserted && log_) log_->Append(MakeRecord(hash, result));
+    }
+
+    // Entries found since the cache was created are appended to the log, see ValidationCacheLog
+    void SetLog(ValidationCacheLog *log) { log_ = log; }
+    // Adds the entries of a log, which are newer than what the cache was created with, without appending them to its log
+    void LoadRecords(const std::vector<ValidationCacheLog::Record> &records) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        for (const auto &record : records) {
+            const uint32_t *data = record.payload;
+            if (record.type == ValidationCacheLog::kShaderHashRecord) {
+                ShaderHash shader_hash;
+                shader_hash.hash = static_cast<uint64_t>(data[0]) | (static_cast<uint64_t>(data[1]) << 32);
+                shader_hash.check = static_cast<uint64_t>(data[2]) | (static_cast<uint64_t>(data[3]) << 32);
+                shader_hash.code_size = data[4];
+                good_shader_hashes_.insert(shader_hash);
+            } else if (record.type == ValidationCacheLog::kSpecializationRecord) {
+                const uint64_t key = static_cast<uint64_t>(data[0]) | (static_cast<uint64_t>(data[1]) << 32);
+                AddMostRecentSpecialization(key, SpecializationResult{data[2], data[3], data[4]});
+            }
+        }
+    }
+
+    static void MakeCacheUuid(uint8_t *uuid) {
+        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, uuid);
+        uuid[VK_UUID_SIZE - 1] = kCacheLayoutVersion;
     }
 
   private:
+    static const size_t kDefaultSpecializationLimit = 16384;
+    static const uint32_t kShaderHashEntryWords = 5;
+    static const uint32_t kSpecializationEntryWords = 5;
+    // Stored in the last byte of the UUID, so that caches written with a different layout are ignored
+    static const uint8_t kCacheLayoutVersion = 3;
+
     ValidationCache() {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
+    // Returns true if the entry is new. The write lock must be held.
+    bool AddMostRecentSpecialization(uint64_t hash, const SpecializationResult &result) {
+        auto it = good_specializations_.find(hash);
+        if (it != good_specializations_.end()) {
+            it->second->second = result;
+            specialization_lru_.splice(specialization_lru_.begin(), specialization_lru_, it->second);
+            return false;
+        }
+        specialization_lru_.emplace_front(hash, result);
+        good_specializations_.emplace(hash, specialization_lru_.begin());
+        if (specialization_lru_.size() > specialization_limit_) {
+            good_specializations_.erase(specialization_lru_.back().first);
+            specialization_lru_.pop_back();
+        }
+        return true;
+    }
+
+    static ValidationCacheLog::Record MakeRecord(const ShaderHash &hash) {
+        return ValidationCacheLog::Record{ValidationCacheLog::kShaderHashRecord,
+                                          {static_cast<uint32_t>(hash.hash), static_cast<uint32_t>(hash.hash >> 32),
+                                           static_cast<uint32_t>(hash.check), static_cast<uint32_t>(hash.check >> 32),
+                                           hash.code_size}};
+    }
+    static ValidationCacheLog::Record MakeRecord(uint64_t hash, const SpecializationResult &result) {
+        return ValidationCacheLog::Record{ValidationCacheLog::kSpecializationRecord,
+                                          {static_cast<uint32_t>(hash), static_cast<uint32_t>(hash >> 32), result.local_size_x,
+                                           result.local_size_y, result.local_size_z}};
+    }
+
+    // For entries loaded or merged from another cache, which are older than anything used here. The write lock must be held.
+    void AddLeastRecentSpecialization(uint64_t hash, const SpecializationResult &result) {
+        if (specialization_lru_.size() >= specialization_limit_ || good_specializations_.count(hash) != 0) return;
+        specialization_lru_.emplace_back(hash, result);
+        good_specializations_.emplace(hash, std::prev(specialization_lru_.end()));
+    }
+
+    static void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
         // if it's longer.
@@ -150,7 +324,13 @@ class ValidationCache {
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    layer_data::unordered_set<uint32_t> good_shader_hashes_;
+    layer_data::unordered_set<ShaderHash, ShaderHash::Hasher> good_shader_hashes_;
+    using SpecializationList = std::list<std::pair<uint64_t, SpecializationResult>>;
+    // Most recently used first
+    SpecializationList specialization_lru_;
+    layer_data::unordered_map<uint64_t, SpecializationList::iterator> good_specializations_;
+    size_t specialization_limit_ = kDefaultSpecializationLimit;
+    ValidationCacheLog *log_ = nullptr;
     mutable ReadWriteLock lock_;
 };
 
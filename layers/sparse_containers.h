@@ -20,6 +20,7 @@
  */
 #ifndef SPARSE_CONTAINERS_H_
 #define SPARSE_CONTAINERS_H_
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <vector>
@@ -185,9 +186,7 @@ class SparseVector {
         } else {
             // Note that "Dense Access" does away with the full_range_value_ logic, storing empty entries using kDefaultValue
             assert(dense_);
-            for (IndexType index = start; index < end; ++index) {
-                updated = SetDense(index, value);
-            }
+            updated = SetDenseRange(start, end, value);
         }
         return updated;
     }
@@ -299,6 +298,13 @@ class SparseVector {
         // in the non-delegated case we use normal accessors and skip default values.
         void SetCurrentValue() {
             the_end_ = true;
+            if (!vec_->IsSparse()) {
+                // Skip the run of default entries with a plain scan of the storage
+                const DenseType &ray = *vec_->dense_;
+                const auto found = std::find_if(ray.cbegin() + (index_ - vec_->range_min_), ray.cend(),
+                                                [](const ValueType &value) { return value != SparseVector::DefaultValue(); });
+                index_ = vec_->range_min_ + static_cast<IndexType>(found - ray.cbegin());
+            }
             while (index_ < vec_->range_max_) {
                 value_ = vec_->Get(index_);
                 if (value_ != SparseVector::DefaultValue()) {
@@ -369,6 +375,27 @@ class SparseVector {
         return updated;
     }
 
+    // Dense access mode range setter, equivalent to SetDense for each index but written as whole range scans and fills, which
+    // the compiler turns into vector code for the small value types these are used with
+    bool SetDenseRange(IndexType start, IndexType end, const ValueType &value) {
+        const auto begin = dense_->begin();
+        auto first = begin + (start - range_min_);
+        const auto last = begin + (end - range_min_);
+        if (kSetReplaces) {
+            // Nothing before the first differing value changes
+            first = std::find_if(first, last, [&value](const ValueType &current) { return current != value; });
+            if (first == last) return false;
+            std::fill(first, last, value);
+        } else {
+            // Only unset (kDefaultValue) values change
+            if (value == kDefaultValue) return false;
+            first = std::find(first, last, kDefaultValue);
+            if (first == last) return false;
+            std::replace(first, last, kDefaultValue, value);
+        }
+        return true;
+    }
+
     // Sparse access mode setter with update full range and update semantics implemented
     bool SetSparse(IndexType index, const ValueType &value) {
         if (!kSetReplaces && HasFullRange()) {
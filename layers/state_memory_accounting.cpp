@@ -0,0 +1,151 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "state_memory_accounting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include "low_memory_profile.h"
+
+namespace {
+struct CounterRegistry {
+    std::mutex lock;
+    std::vector<const StateMemoryCounter *> counters;
+};
+
+// Leaked on purpose, so that counters destroyed during static destruction never touch a destroyed registry
+CounterRegistry &GetCounterRegistry() {
+    static CounterRegistry *registry = new CounterRegistry;
+    return *registry;
+}
+
+std::atomic<int64_t> next_report_ns{0};
+}  // namespace
+
+StateMemoryCounter::StateMemoryCounter(const char *name) : name_(name) {
+    auto &registry = GetCounterRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.counters.push_back(this);
+}
+
+void StateMemoryCounter::UpdatePeak(std::atomic<uint64_t> &peak, uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void StateMemoryCounter::Add(size_t bytes) {
+    UpdatePeak(peak_count_, count_.fetch_add(1, std::memory_order_relaxed) + 1);
+    UpdatePeak(peak_bytes_, bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void StateMemoryCounter::Remove(size_t bytes) {
+    count_.fetch_sub(1, std::memory_order_relaxed);
+    bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void StateMemoryCounter::Resize(size_t old_bytes, size_t new_bytes) {
+    if (new_bytes > old_bytes) {
+        const uint64_t delta = new_bytes - old_bytes;
+        UpdatePeak(peak_bytes_, bytes_.fetch_add(delta, std::memory_order_relaxed) + delta);
+    } else {
+        bytes_.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+    }
+}
+
+StateMemoryCounter::Stats StateMemoryCounter::GetStats() const {
+    Stats stats;
+    stats.name = name_;
+    stats.count = count_.load(std::memory_order_relaxed);
+    stats.peak_count = peak_count_.load(std::memory_order_relaxed);
+    stats.bytes = bytes_.load(std::memory_order_relaxed);
+    stats.peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::vector<StateMemoryCounter::Stats> GetStateMemoryStats() {
+    std::vector<StateMemoryCounter::Stats> result;
+    auto &registry = GetCounterRegistry();
+    {
+        std::lock_guard<std::mutex> guard(registry.lock);
+        result.reserve(registry.counters.size());
+        for (const auto *counter : registry.counters) {
+            result.emplace_back(counter->GetStats());
+        }
+    }
+    // Largest users first
+    std::sort(result.begin(), result.end(), [](const StateMemoryCounter::Stats &a, const StateMemoryCounter::Stats &b) {
+        return a.bytes > b.bytes || (a.bytes == b.bytes && std::strcmp(a.name, b.name) < 0);
+    });
+    return result;
+}
+
+std::string FormatStateMemoryReport() {
+    const auto stats = GetStateMemoryStats();
+    uint64_t total_bytes = 0;
+    for (const auto &entry : stats) {
+        total_bytes += entry.bytes;
+    }
+    std::string report;
+    char line[256];
+    snprintf(line, sizeof(line), "Validation state memory: %" PRIu64 " KiB total\n", total_bytes / 1024);
+    report += line;
+    snprintf(line, sizeof(line), "%-40s %10s %10s %12s %12s\n", "state", "count", "peak", "KiB", "peak KiB");
+    report += line;
+    for (const auto &entry : stats) {
+        snprintf(line, sizeof(line), "%-40s %10" PRIu64 " %10" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n", entry.name, entry.count,
+                 entry.peak_count, entry.bytes / 1024, entry.peak_bytes / 1024);
+        report += line;
+    }
+    if (LowMemoryProfile()) report += FormatLowMemoryProfileReport();
+    return report;
+}
+
+bool StateMemoryReportDue(uint32_t interval_seconds) {
+    if (interval_seconds == 0) return false;
+    const int64_t now =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t next = next_report_ns.load(std::memory_order_relaxed);
+    if (now < next) return false;
+    const int64_t interval_ns = static_cast<int64_t>(interval_seconds) * 1000000000;
+    // Only the thread that moves the deadline forward reports
+    return next_report_ns.compare_exchange_strong(next, now + interval_ns, std::memory_order_relaxed);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vvlGetStateMemoryStats(uint32_t *pStatCount, VvlStateMemoryStats *pStats) {
+    if (!pStatCount) return VK_ERROR_INITIALIZATION_FAILED;
+    const auto stats = GetStateMemoryStats();
+    if (!pStats) {
+        *pStatCount = static_cast<uint32_t>(stats.size());
+        return VK_SUCCESS;
+    }
+    const uint32_t count = std::min(*pStatCount, static_cast<uint32_t>(stats.size()));
+    for (uint32_t i = 0; i < count; ++i) {
+        strncpy(pStats[i].name, stats[i].name, sizeof(pStats[i].name) - 1);
+        pStats[i].name[sizeof(pStats[i].name) - 1] = '\0';
+        pStats[i].count = stats[i].count;
+        pStats[i].peakCount = stats[i].peak_count;
+        pStats[i].bytes = stats[i].bytes;
+        pStats[i].peakBytes = stats[i].peak_bytes;
+    }
+    *pStatCount = count;
+    return (count < stats.size()) ? VK_INCOMPLETE : VK_SUCCESS;
+}
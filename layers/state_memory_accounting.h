@@ -0,0 +1,98 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include "vulkan/vk_layer.h"
+
+// Process wide accounting of the memory held by validation state, per kind of state.
+//
+// Every state type tracked by ValidationStateTracker gets a counter (see MapTraits::MemoryCounter()), and other large
+// structures such as the synchronization validation access maps register their own. Counts and bytes are estimates: an
+// object is charged its own size plus whatever it reports through DynamicMemoryUsage(), refreshed at points where the object
+// is known to have settled, such as vkEndCommandBuffer. High-water marks are tracked for both.
+class StateMemoryCounter {
+  public:
+    struct Stats {
+        const char *name;
+        uint64_t count;
+        uint64_t peak_count;
+        uint64_t bytes;
+        uint64_t peak_bytes;
+    };
+
+    // Counters must live for the whole process, since state objects destroyed during static destruction still update them.
+    // Create them once with new and never delete them.
+    explicit StateMemoryCounter(const char *name);
+    StateMemoryCounter(const StateMemoryCounter &) = delete;
+    StateMemoryCounter &operator=(const StateMemoryCounter &) = delete;
+
+    void Add(size_t bytes);
+    void Remove(size_t bytes);
+    // An already counted object changed size
+    void Resize(size_t old_bytes, size_t new_bytes);
+
+    Stats GetStats() const;
+
+  private:
+    static void UpdatePeak(std::atomic<uint64_t> &peak, uint64_t value);
+
+    const char *name_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> peak_count_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> peak_bytes_{0};
+};
+
+// Rough heap usage of standard containers, for DynamicMemoryUsage() implementations
+template <typename Vector>
+size_t VectorMemoryUsage(const Vector &vector) {
+    return vector.capacity() * sizeof(typename Vector::value_type);
+}
+// Node based and hashed containers, charging each element two pointers of bookkeeping
+template <typename Container>
+size_t NodeContainerMemoryUsage(const Container &container) {
+    return container.size() * (sizeof(typename Container::value_type) + 2 * sizeof(void *));
+}
+
+std::vector<StateMemoryCounter::Stats> GetStateMemoryStats();
+std::string FormatStateMemoryReport();
+
+// Returns true, at most once per interval_seconds across all threads, when a periodic report is due
+bool StateMemoryReportDue(uint32_t interval_seconds);
+
+// Entry point exported by the layer library for tools that want the numbers without parsing the report. Tools find it with
+// dlsym()/GetProcAddress() and call it like any count/array enumeration, it returns VK_INCOMPLETE if pStats is too small.
+extern "C" {
+typedef struct VvlStateMemoryStats {
+    char name[64];
+    uint64_t count;
+    uint64_t peakCount;
+    uint64_t bytes;
+    uint64_t peakBytes;
+} VvlStateMemoryStats;
+
+typedef VkResult(VKAPI_PTR *PFN_vvlGetStateMemoryStats)(uint32_t *pStatCount, VvlStateMemoryStats *pStats);
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vvlGetStateMemoryStats(uint32_t *pStatCount, VvlStateMemoryStats *pStats);
+}
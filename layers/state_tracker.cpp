@@ -29,6 +29,7 @@
 #include "vk_format_utils.h"
 #include "vk_layer_data.h"
 #include "vk_layer_utils.h"
+#include "hash_util.h"
 #include "vk_layer_logging.h"
 #include "vk_typemap_helper.h"
 
@@ -38,9 +39,46 @@
 #include "sync_utils.h"
 #include "cmd_buffer_state.h"
 #include "render_pass_state.h"
+#include "hook_timing.h"
 
 // NOTE:  Beware the lifespan of the rp_begin when holding  the return.  If the rp_begin isn't a "safe" copy, "IMAGELESS"
 //        attachments won't persist past the API entry point exit.
+namespace {
+struct CommandBufferCacheEntry {
+    uint64_t tracker_id = 0;
+    VkCommandBuffer handle = VK_NULL_HANDLE;
+    // Weak so that a cached state can be freed. It still holds on to the memory of the state until the entry is replaced.
+    std::weak_ptr<CMD_BUFFER_STATE> state;
+};
+// Each ValidationStateTracker uses its own slot, so the validation objects handling the same vkCmd*() call don't evict each other
+const uint32_t kCommandBufferCacheSlots = 8;
+thread_local CommandBufferCacheEntry command_buffer_cache[kCommandBufferCacheSlots];
+// Ids are unique across all trackers, so an entry can never match a tracker created later at the same address
+std::atomic<uint64_t> command_buffer_cache_id_source{0};
+std::atomic<uint32_t> command_buffer_cache_slot_source{0};
+}  // namespace
+
+uint64_t ValidationStateTracker::NextCommandBufferCacheId() { return ++command_buffer_cache_id_source; }
+
+uint32_t ValidationStateTracker::NextCommandBufferCacheSlot() {
+    return command_buffer_cache_slot_source++ % kCommandBufferCacheSlots;
+}
+
+std::shared_ptr<CMD_BUFFER_STATE> ValidationStateTracker::FindCommandBufferShared(VkCommandBuffer handle) const {
+    auto &entry = command_buffer_cache[command_buffer_cache_slot_];
+    if (entry.tracker_id == command_buffer_cache_id_ && entry.handle == handle) {
+        auto state = entry.state.lock();
+        if (state && !state->Destroyed()) return state;
+    }
+    auto state = FindShared<CMD_BUFFER_STATE>(handle, std::false_type());
+    if (state) {
+        entry.tracker_id = command_buffer_cache_id_;
+        entry.handle = handle;
+        entry.state = state;
+    }
+    return state;
+}
+
 static std::pair<uint32_t, const VkImageView *> GetFramebufferAttachments(const VkRenderPassBeginInfo &rp_begin,
                                                                           const FRAMEBUFFER_STATE &fb_state) {
     const VkImageView *attachments = fb_state.createInfo.pAttachments;
@@ -120,74 +158,22 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetExternalFormatFeaturesANDROI
 
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
-VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device, bool has_format_feature2, bool has_drm_modifiers,
+VkFormatFeatureFlags2KHR GetImageFormatFeatures(const FormatPropertiesCache &format_properties, bool has_format_feature2,
                                                 VkDevice device, VkImage image, VkFormat format, VkImageTiling tiling) {
-    VkFormatFeatureFlags2KHR format_features = 0;
-
     // Add feature support according to Image Format Features (vkspec.html#resources-image-format-features)
     // if format is AHB external format then the features are already set
-    if (has_format_feature2) {
-        auto fmt_drm_props = LvlInitStruct<VkDrmFormatModifierPropertiesList2EXT>();
-        auto fmt_props_3 = LvlInitStruct<VkFormatProperties3KHR>(has_drm_modifiers ? &fmt_drm_props : nullptr);
-        auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_props_3);
-
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+    if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
+        VkImageDrmFormatModifierPropertiesEXT drm_format_props = {VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT,
+                                                                  nullptr};
 
-        if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-            VkImageDrmFormatModifierPropertiesEXT drm_format_props = {
-                VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT,
-                nullptr,
-            };
+        // Find the image modifier
+        DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_props);
 
-            // Find the image modifier
-            DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_props);
-
-            std::vector<VkDrmFormatModifierProperties2EXT> drm_mod_props;
-            drm_mod_props.resize(fmt_drm_props.drmFormatModifierCount);
-            fmt_drm_props.pDrmFormatModifierProperties = &drm_mod_props[0];
-
-            // Second query to have all the modifiers filled
-            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-            // Look for the image modifier in the list
-            for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                if (fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_props.drmFormatModifier) {
-                    format_features = fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                    break;
-                }
-            }
-        } else {
-            format_features =
-                (tiling == VK_IMAGE_TILING_LINEAR) ? fmt_props_3.linearTilingFeatures : fmt_props_3.optimalTilingFeatures;
-        }
-    } else if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        VkImageDrmFormatModifierPropertiesEXT drm_format_properties = {VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT,
-                                                                       nullptr};
-        DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_properties);
-
-        VkFormatProperties2 format_properties_2 = {VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, nullptr};
-        VkDrmFormatModifierPropertiesListEXT drm_properties_list = {VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT,
-                                                                    nullptr};
-        format_properties_2.pNext = (void *)&drm_properties_list;
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
-        std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-        drm_properties.resize(drm_properties_list.drmFormatModifierCount);
-        drm_properties_list.pDrmFormatModifierProperties = &drm_properties[0];
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
-
-        for (uint32_t i = 0; i < drm_properties_list.drmFormatModifierCount; i++) {
-            if (drm_properties_list.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_properties.drmFormatModifier) {
-                format_features = drm_properties_list.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                break;
-            }
-        }
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        format_features =
-            (tiling == VK_IMAGE_TILING_LINEAR) ? format_properties.linearTilingFeatures : format_properties.optimalTilingFeatures;
+        // Look for the image modifier in the list
+        return format_properties.GetFormatProperties(format, has_format_feature2, true)
+            ->DrmModifierFeatures(drm_format_props.drmFormatModifier);
     }
-    return format_features;
+    return format_properties.GetFormatProperties(format, has_format_feature2, false)->TilingFeatures(tiling);
 }
 
 std::shared_ptr<IMAGE_STATE> ValidationStateTracker::CreateImageState(VkImage img, const VkImageCreateInfo *pCreateInfo,
@@ -209,8 +195,7 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
         format_features = GetExternalFormatFeaturesANDROID(pCreateInfo);
     }
     if (format_features == 0) {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
-                                                 IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device, *pImage,
+        format_features = GetImageFormatFeatures(GetFormatPropertiesCache(), has_format_feature2, device, *pImage,
                                                  pCreateInfo->format, pCreateInfo->tiling);
     }
     Add(CreateImageState(*pImage, pCreateInfo, format_features));
@@ -336,7 +321,9 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
             WriteLockGuard guard(buffer_address_lock_);
             // address is used for GPU-AV and ray tracing buffer validation
             buffer_state->deviceAddress = opaque_capture_address->opaqueCaptureAddress;
-            buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state});
+            if (buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state}).second) {
+                buffer_address_generation_.fetch_add(1, std::memory_order_release);
+            }
         }
     }
     Add(std::move(buffer_state));
@@ -349,17 +336,8 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 
     auto buffer_state = Get<BUFFER_STATE>(pCreateInfo->buffer);
 
-    VkFormatFeatureFlags2KHR buffer_features;
-    if (has_format_feature2) {
-        auto fmt_props_3 = LvlInitStruct<VkFormatProperties3KHR>();
-        auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_props_3);
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, pCreateInfo->format, &fmt_props_2);
-        buffer_features = fmt_props_3.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
-        buffer_features = format_properties.bufferFeatures;
-    }
+    const VkFormatFeatureFlags2KHR buffer_features =
+        GetFormatPropertiesCache().GetFormatProperties(pCreateInfo->format, has_format_feature2, false)->properties.bufferFeatures;
 
     Add(std::make_shared<BUFFER_VIEW_STATE>(buffer_state, *pView, pCreateInfo, buffer_features));
 }
@@ -375,9 +353,8 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
         // The ImageView uses same Image's format feature since they share same AHB
         format_features = image_state->format_features;
     } else {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
-                                                 IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
-                                                 image_state->image(), pCreateInfo->format, image_state->createInfo.tiling);
+        format_features = GetImageFormatFeatures(GetFormatPropertiesCache(), has_format_feature2, device, image_state->image(),
+                                                 pCreateInfo->format, image_state->createInfo.tiling);
     }
 
     // filter_cubic_props is used in CmdDraw validation. But it takes a lot of performance if it does in CmdDraw.
@@ -395,7 +372,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
 
         auto image_format_properties = LvlInitStruct<VkImageFormatProperties2>(&filter_cubic_props);
 
-        DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+        GetFormatPropertiesCache().GetImageFormatProperties2(&image_format_info, &image_format_properties);
     }
 
     Add(std::make_shared<IMAGE_VIEW_STATE>(image_state, *pView, pCreateInfo, format_features, filter_cubic_props));
@@ -433,9 +410,10 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
 
 void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
     auto buffer_state = Get<BUFFER_STATE>(buffer);
-    if (buffer_state) {
+    if (buffer_state && buffer_state->deviceAddress != 0) {
         WriteLockGuard guard(buffer_address_lock_);
         buffer_address_map_.erase_range(buffer_state->DeviceAddressRange());
+        buffer_address_generation_.fetch_add(1, std::memory_order_release);
     }
     Destroy<BUFFER_STATE>(buffer);
 }
@@ -514,49 +492,11 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
     VkFormatFeatureFlags2KHR format_features = 0;
 
     if (format != VK_FORMAT_UNDEFINED) {
-        if (has_format_feature2) {
-            auto fmt_drm_props = LvlInitStruct<VkDrmFormatModifierPropertiesList2EXT>();
-            auto fmt_props_3 = LvlInitStruct<VkFormatProperties3KHR>(
-                IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier) ? &fmt_drm_props : nullptr);
-            auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_props_3);
-
-            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-            format_features |= fmt_props_3.linearTilingFeatures;
-            format_features |= fmt_props_3.optimalTilingFeatures;
-
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                std::vector<VkDrmFormatModifierProperties2EXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
-        } else {
-            VkFormatProperties format_properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-            format_features |= format_properties.linearTilingFeatures;
-            format_features |= format_properties.optimalTilingFeatures;
-
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                auto fmt_drm_props = LvlInitStruct<VkDrmFormatModifierPropertiesListEXT>();
-                auto fmt_props_2 = LvlInitStruct<VkFormatProperties2>(&fmt_drm_props);
-
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
-        }
+        const auto format_properties = GetFormatPropertiesCache().GetFormatProperties(
+            format, has_format_feature2, IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier));
+        format_features |= format_properties->properties.linearTilingFeatures;
+        format_features |= format_properties->properties.optimalTilingFeatures;
+        format_features |= format_properties->AllDrmModifierFeatures();
     }
 
     return format_features;
@@ -579,10 +519,73 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
     device_state->CreateDevice(pCreateInfo);
 }
 
+void ValidationStateTracker::EnableHandleIndexedMaps() {
+    if (!wrap_handles || !unique_id_mapping.IsLockFree() || handle_indexed_slots_) return;
+    handle_indexed_slots_.reset(new HandleIndexedSlots());
+    HandleIndexedSlots *slots = handle_indexed_slots_.get();
+    sampler_map_.SetHandleIndexed(slots);
+    image_view_map_.SetHandleIndexed(slots);
+    buffer_view_map_.SetHandleIndexed(slots);
+    buffer_map_.SetHandleIndexed(slots);
+    pipeline_map_.SetHandleIndexed(slots);
+    descriptor_set_map_.SetHandleIndexed(slots);
+    pipeline_layout_map_.SetHandleIndexed(slots);
+}
+
+template <typename Map>
+static void AddMapLockCounters(ValidationCounterList &counters, const std::string &prefix, const char *map_name, const Map &map) {
+    const auto stats = map.stats();
+    AddValidationCounter(counters, (prefix + map_name + "_lock_contentions").c_str(), stats.contended_acquisitions);
+    AddValidationCounter(counters, (prefix + map_name + "_lock_wait_us").c_str(), stats.lock_wait_ns / 1000);
+}
+
+void ValidationStateTracker::GetValidationCounters(ValidationCounterList &counters) const {
+    // The maps count their contention whatever the setting, report it along with the other counters only
+    if (!validation_counters_enabled.load(std::memory_order_relaxed)) return;
+    const std::string prefix = std::string(ObjectName(container_type)) + ".";
+    AddMapLockCounters(counters, prefix, "command_buffer_map", command_buffer_map_);
+    AddMapLockCounters(counters, prefix, "command_pool_map", command_pool_map_);
+    AddMapLockCounters(counters, prefix, "pipeline_map", pipeline_map_);
+    AddMapLockCounters(counters, prefix, "pipeline_layout_map", pipeline_layout_map_);
+    AddMapLockCounters(counters, prefix, "descriptor_set_map", descriptor_set_map_);
+    AddMapLockCounters(counters, prefix, "buffer_map", buffer_map_);
+    AddMapLockCounters(counters, prefix, "image_map", image_map_);
+    AddMapLockCounters(counters, prefix, "image_view_map", image_view_map_);
+    AddMapLockCounters(counters, prefix, "render_pass_map", render_pass_map_);
+    AddMapLockCounters(counters, prefix, "frame_buffer_map", frame_buffer_map_);
+    AddMapLockCounters(counters, prefix, "query_pool_map", query_pool_map_);
+    AddMapLockCounters(counters, prefix, "event_map", event_map_);
+}
+
+void ValidationStateTracker::ReportMemoryUsageIfDue() const {
+    if (!StateMemoryReportDue(memory_report_interval)) return;
+    LogInfo(device, "UNASSIGNED-StateMemoryReport", "%s", FormatStateMemoryReport().c_str());
+}
+
 void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
+    EnableHandleIndexedMaps();
+    // Decoded once for the feature structs below
+    const LvlPNextIndex device_pnext(pCreateInfo->pNext);
+
+    if ((parallel_pipeline_validation || parallel_descriptor_update_validation || parallel_sync_resolve ||
+         parallel_sync_hazard_detection || parallel_submit_validation) &&
+        thread_pool) {
+        batch_pool_.reset(new ValidationBatchPool(thread_pool));
+    }
+
+    housekeeping_.SetLimits(housekeeping_budget_us, housekeeping_submit_interval);
+    housekeeping_.Register("PruneStateCaches", [this]() {
+        {
+            WriteLockGuard guard(inline_shader_module_lock_);
+            inline_shader_modules_.Prune();
+        }
+        WriteLockGuard guard(image_range_encoder_lock_);
+        image_range_encoders_.Prune();
+    });
+
     const VkPhysicalDeviceFeatures *enabled_features_found = pCreateInfo->pEnabledFeatures;
     if (nullptr == enabled_features_found) {
-        const auto *features2 = LvlFindInChain<VkPhysicalDeviceFeatures2>(pCreateInfo->pNext);
+        const auto *features2 = device_pnext.Find<VkPhysicalDeviceFeatures2>();
         if (features2) {
             enabled_features_found = &(features2->features);
         }
@@ -594,17 +597,17 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
         enabled_features.core = *enabled_features_found;
     }
 
-    const auto *vulkan_13_features = LvlFindInChain<VkPhysicalDeviceVulkan13Features>(pCreateInfo->pNext);
+    const auto *vulkan_13_features = device_pnext.Find<VkPhysicalDeviceVulkan13Features>();
     if (vulkan_13_features) {
         enabled_features.core13 = *vulkan_13_features;
     } else {
         enabled_features.core13 = {};
-        const auto *image_robustness_features = LvlFindInChain<VkPhysicalDeviceImageRobustnessFeatures>(pCreateInfo->pNext);
+        const auto *image_robustness_features = device_pnext.Find<VkPhysicalDeviceImageRobustnessFeatures>();
         if (image_robustness_features) {
             enabled_features.core13.robustImageAccess = image_robustness_features->robustImageAccess;
         }
 
-        const auto *inline_uniform_block_features = LvlFindInChain<VkPhysicalDeviceInlineUniformBlockFeatures>(pCreateInfo->pNext);
+        const auto *inline_uniform_block_features = device_pnext.Find<VkPhysicalDeviceInlineUniformBlockFeatures>();
         if (inline_uniform_block_features) {
             enabled_features.core13.inlineUniformBlock = inline_uniform_block_features->inlineUniformBlock;
             enabled_features.core13.descriptorBindingInlineUniformBlockUpdateAfterBind =
@@ -612,73 +615,69 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
         }
 
         const auto *pipeline_creation_cache_control_features =
-            LvlFindInChain<VkPhysicalDevicePipelineCreationCacheControlFeatures>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDevicePipelineCreationCacheControlFeatures>();
         if (pipeline_creation_cache_control_features) {
             enabled_features.core13.pipelineCreationCacheControl =
                 pipeline_creation_cache_control_features->pipelineCreationCacheControl;
         }
 
-        const auto *private_data_features = LvlFindInChain<VkPhysicalDevicePrivateDataFeatures>(pCreateInfo->pNext);
+        const auto *private_data_features = device_pnext.Find<VkPhysicalDevicePrivateDataFeatures>();
         if (private_data_features) {
             enabled_features.core13.privateData = private_data_features->privateData;
         }
 
         const auto *demote_to_helper_invocation_features =
-            LvlFindInChain<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>();
         if (demote_to_helper_invocation_features) {
             enabled_features.core13.shaderDemoteToHelperInvocation =
                 demote_to_helper_invocation_features->shaderDemoteToHelperInvocation;
         }
 
-        const auto *terminate_invocation_features =
-            LvlFindInChain<VkPhysicalDeviceShaderTerminateInvocationFeatures>(pCreateInfo->pNext);
+        const auto *terminate_invocation_features = device_pnext.Find<VkPhysicalDeviceShaderTerminateInvocationFeatures>();
         if (terminate_invocation_features) {
             enabled_features.core13.shaderTerminateInvocation = terminate_invocation_features->shaderTerminateInvocation;
         }
 
-        const auto *subgroup_size_control_features =
-            LvlFindInChain<VkPhysicalDeviceSubgroupSizeControlFeatures>(pCreateInfo->pNext);
+        const auto *subgroup_size_control_features = device_pnext.Find<VkPhysicalDeviceSubgroupSizeControlFeatures>();
         if (subgroup_size_control_features) {
             enabled_features.core13.subgroupSizeControl = subgroup_size_control_features->subgroupSizeControl;
             enabled_features.core13.computeFullSubgroups = subgroup_size_control_features->computeFullSubgroups;
         }
 
-        const auto *synchronization2_features = LvlFindInChain<VkPhysicalDeviceSynchronization2Features>(pCreateInfo->pNext);
+        const auto *synchronization2_features = device_pnext.Find<VkPhysicalDeviceSynchronization2Features>();
         if (synchronization2_features) {
             enabled_features.core13.synchronization2 = synchronization2_features->synchronization2;
         }
 
-        const auto *texture_compression_astchdr_features =
-            LvlFindInChain<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>(pCreateInfo->pNext);
+        const auto *texture_compression_astchdr_features = device_pnext.Find<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>();
         if (texture_compression_astchdr_features) {
             enabled_features.core13.textureCompressionASTC_HDR = texture_compression_astchdr_features->textureCompressionASTC_HDR;
         }
 
         const auto *initialize_workgroup_memory_features =
-            LvlFindInChain<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>();
         if (initialize_workgroup_memory_features) {
             enabled_features.core13.shaderZeroInitializeWorkgroupMemory =
                 initialize_workgroup_memory_features->shaderZeroInitializeWorkgroupMemory;
         }
 
-        const auto *dynamic_rendering_features = LvlFindInChain<VkPhysicalDeviceDynamicRenderingFeatures>(pCreateInfo->pNext);
+        const auto *dynamic_rendering_features = device_pnext.Find<VkPhysicalDeviceDynamicRenderingFeatures>();
         if (dynamic_rendering_features) {
             enabled_features.core13.dynamicRendering = dynamic_rendering_features->dynamicRendering;
         }
 
-        const auto *shader_integer_dot_product_features =
-            LvlFindInChain<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR>(pCreateInfo->pNext);
+        const auto *shader_integer_dot_product_features = device_pnext.Find<VkPhysicalDeviceShaderIntegerDotProductFeaturesKHR>();
         if (shader_integer_dot_product_features) {
             enabled_features.core13.shaderIntegerDotProduct = shader_integer_dot_product_features->shaderIntegerDotProduct;
         }
 
-        const auto *maintenance4_features = LvlFindInChain<VkPhysicalDeviceMaintenance4FeaturesKHR>(pCreateInfo->pNext);
+        const auto *maintenance4_features = device_pnext.Find<VkPhysicalDeviceMaintenance4FeaturesKHR>();
         if (maintenance4_features) {
             enabled_features.core13.maintenance4 = maintenance4_features->maintenance4;
         }
     }
 
-    const auto *vulkan_12_features = LvlFindInChain<VkPhysicalDeviceVulkan12Features>(pCreateInfo->pNext);
+    const auto *vulkan_12_features = device_pnext.Find<VkPhysicalDeviceVulkan12Features>();
     if (vulkan_12_features) {
         enabled_features.core12 = *vulkan_12_features;
     } else {
@@ -693,7 +692,7 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
 
         // These structs are only allowed in pNext chain if there is no VkPhysicalDeviceVulkan12Features
 
-        const auto *eight_bit_storage_features = LvlFindInChain<VkPhysicalDevice8BitStorageFeatures>(pCreateInfo->pNext);
+        const auto *eight_bit_storage_features = device_pnext.Find<VkPhysicalDevice8BitStorageFeatures>();
         if (eight_bit_storage_features) {
             enabled_features.core12.storageBuffer8BitAccess = eight_bit_storage_features->storageBuffer8BitAccess;
             enabled_features.core12.uniformAndStorageBuffer8BitAccess =
@@ -701,13 +700,13 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             enabled_features.core12.storagePushConstant8 = eight_bit_storage_features->storagePushConstant8;
         }
 
-        const auto *float16_int8_features = LvlFindInChain<VkPhysicalDeviceShaderFloat16Int8Features>(pCreateInfo->pNext);
+        const auto *float16_int8_features = device_pnext.Find<VkPhysicalDeviceShaderFloat16Int8Features>();
         if (float16_int8_features) {
             enabled_features.core12.shaderFloat16 = float16_int8_features->shaderFloat16;
             enabled_features.core12.shaderInt8 = float16_int8_features->shaderInt8;
         }
 
-        const auto *descriptor_indexing_features = LvlFindInChain<VkPhysicalDeviceDescriptorIndexingFeatures>(pCreateInfo->pNext);
+        const auto *descriptor_indexing_features = device_pnext.Find<VkPhysicalDeviceDescriptorIndexingFeatures>();
         if (descriptor_indexing_features) {
             enabled_features.core12.shaderInputAttachmentArrayDynamicIndexing =
                 descriptor_indexing_features->shaderInputAttachmentArrayDynamicIndexing;
@@ -749,61 +748,59 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             enabled_features.core12.runtimeDescriptorArray = descriptor_indexing_features->runtimeDescriptorArray;
         }
 
-        const auto *scalar_block_layout_features = LvlFindInChain<VkPhysicalDeviceScalarBlockLayoutFeatures>(pCreateInfo->pNext);
+        const auto *scalar_block_layout_features = device_pnext.Find<VkPhysicalDeviceScalarBlockLayoutFeatures>();
         if (scalar_block_layout_features) {
             enabled_features.core12.scalarBlockLayout = scalar_block_layout_features->scalarBlockLayout;
         }
 
-        const auto *imageless_framebuffer_features =
-            LvlFindInChain<VkPhysicalDeviceImagelessFramebufferFeatures>(pCreateInfo->pNext);
+        const auto *imageless_framebuffer_features = device_pnext.Find<VkPhysicalDeviceImagelessFramebufferFeatures>();
         if (imageless_framebuffer_features) {
             enabled_features.core12.imagelessFramebuffer = imageless_framebuffer_features->imagelessFramebuffer;
         }
 
         const auto *uniform_buffer_standard_layout_features =
-            LvlFindInChain<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>();
         if (uniform_buffer_standard_layout_features) {
             enabled_features.core12.uniformBufferStandardLayout =
                 uniform_buffer_standard_layout_features->uniformBufferStandardLayout;
         }
 
-        const auto *subgroup_extended_types_features =
-            LvlFindInChain<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>(pCreateInfo->pNext);
+        const auto *subgroup_extended_types_features = device_pnext.Find<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>();
         if (subgroup_extended_types_features) {
             enabled_features.core12.shaderSubgroupExtendedTypes = subgroup_extended_types_features->shaderSubgroupExtendedTypes;
         }
 
         const auto *separate_depth_stencil_layouts_features =
-            LvlFindInChain<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>();
         if (separate_depth_stencil_layouts_features) {
             enabled_features.core12.separateDepthStencilLayouts =
                 separate_depth_stencil_layouts_features->separateDepthStencilLayouts;
         }
 
-        const auto *host_query_reset_features = LvlFindInChain<VkPhysicalDeviceHostQueryResetFeatures>(pCreateInfo->pNext);
+        const auto *host_query_reset_features = device_pnext.Find<VkPhysicalDeviceHostQueryResetFeatures>();
         if (host_query_reset_features) {
             enabled_features.core12.hostQueryReset = host_query_reset_features->hostQueryReset;
         }
 
-        const auto *timeline_semaphore_features = LvlFindInChain<VkPhysicalDeviceTimelineSemaphoreFeatures>(pCreateInfo->pNext);
+        const auto *timeline_semaphore_features = device_pnext.Find<VkPhysicalDeviceTimelineSemaphoreFeatures>();
         if (timeline_semaphore_features) {
             enabled_features.core12.timelineSemaphore = timeline_semaphore_features->timelineSemaphore;
         }
 
-        const auto *buffer_device_address = LvlFindInChain<VkPhysicalDeviceBufferDeviceAddressFeatures>(pCreateInfo->pNext);
+        const auto *buffer_device_address = device_pnext.Find<VkPhysicalDeviceBufferDeviceAddressFeatures>();
         if (buffer_device_address) {
             enabled_features.core12.bufferDeviceAddress = buffer_device_address->bufferDeviceAddress;
             enabled_features.core12.bufferDeviceAddressCaptureReplay = buffer_device_address->bufferDeviceAddressCaptureReplay;
             enabled_features.core12.bufferDeviceAddressMultiDevice = buffer_device_address->bufferDeviceAddressMultiDevice;
         }
 
-        const auto *atomic_int64_features = LvlFindInChain<VkPhysicalDeviceShaderAtomicInt64Features>(pCreateInfo->pNext);
+        const auto *atomic_int64_features = device_pnext.Find<VkPhysicalDeviceShaderAtomicInt64Features>();
         if (atomic_int64_features) {
             enabled_features.core12.shaderBufferInt64Atomics = atomic_int64_features->shaderBufferInt64Atomics;
             enabled_features.core12.shaderSharedInt64Atomics = atomic_int64_features->shaderSharedInt64Atomics;
         }
 
-        const auto *memory_model_features = LvlFindInChain<VkPhysicalDeviceVulkanMemoryModelFeatures>(pCreateInfo->pNext);
+        const auto *memory_model_features = device_pnext.Find<VkPhysicalDeviceVulkanMemoryModelFeatures>();
         if (memory_model_features) {
             enabled_features.core12.vulkanMemoryModel = memory_model_features->vulkanMemoryModel;
             enabled_features.core12.vulkanMemoryModelDeviceScope = memory_model_features->vulkanMemoryModelDeviceScope;
@@ -812,13 +809,13 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
         }
     }
 
-    const auto *vulkan_11_features = LvlFindInChain<VkPhysicalDeviceVulkan11Features>(pCreateInfo->pNext);
+    const auto *vulkan_11_features = device_pnext.Find<VkPhysicalDeviceVulkan11Features>();
     if (vulkan_11_features) {
         enabled_features.core11 = *vulkan_11_features;
     } else {
         // These structs are only allowed in pNext chain if there is no vkPhysicalDeviceVulkan11Features
 
-        const auto *sixteen_bit_storage_features = LvlFindInChain<VkPhysicalDevice16BitStorageFeatures>(pCreateInfo->pNext);
+        const auto *sixteen_bit_storage_features = device_pnext.Find<VkPhysicalDevice16BitStorageFeatures>();
         if (sixteen_bit_storage_features) {
             enabled_features.core11.storageBuffer16BitAccess = sixteen_bit_storage_features->storageBuffer16BitAccess;
             enabled_features.core11.uniformAndStorageBuffer16BitAccess =
@@ -827,37 +824,36 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             enabled_features.core11.storageInputOutput16 = sixteen_bit_storage_features->storageInputOutput16;
         }
 
-        const auto *multiview_features = LvlFindInChain<VkPhysicalDeviceMultiviewFeatures>(pCreateInfo->pNext);
+        const auto *multiview_features = device_pnext.Find<VkPhysicalDeviceMultiviewFeatures>();
         if (multiview_features) {
             enabled_features.core11.multiview = multiview_features->multiview;
             enabled_features.core11.multiviewGeometryShader = multiview_features->multiviewGeometryShader;
             enabled_features.core11.multiviewTessellationShader = multiview_features->multiviewTessellationShader;
         }
 
-        const auto *variable_pointers_features = LvlFindInChain<VkPhysicalDeviceVariablePointersFeatures>(pCreateInfo->pNext);
+        const auto *variable_pointers_features = device_pnext.Find<VkPhysicalDeviceVariablePointersFeatures>();
         if (variable_pointers_features) {
             enabled_features.core11.variablePointersStorageBuffer = variable_pointers_features->variablePointersStorageBuffer;
             enabled_features.core11.variablePointers = variable_pointers_features->variablePointers;
         }
 
-        const auto *protected_memory_features = LvlFindInChain<VkPhysicalDeviceProtectedMemoryFeatures>(pCreateInfo->pNext);
+        const auto *protected_memory_features = device_pnext.Find<VkPhysicalDeviceProtectedMemoryFeatures>();
         if (protected_memory_features) {
             enabled_features.core11.protectedMemory = protected_memory_features->protectedMemory;
         }
 
-        const auto *ycbcr_conversion_features = LvlFindInChain<VkPhysicalDeviceSamplerYcbcrConversionFeatures>(pCreateInfo->pNext);
+        const auto *ycbcr_conversion_features = device_pnext.Find<VkPhysicalDeviceSamplerYcbcrConversionFeatures>();
         if (ycbcr_conversion_features) {
             enabled_features.core11.samplerYcbcrConversion = ycbcr_conversion_features->samplerYcbcrConversion;
         }
 
-        const auto *shader_draw_parameters_features =
-            LvlFindInChain<VkPhysicalDeviceShaderDrawParametersFeatures>(pCreateInfo->pNext);
+        const auto *shader_draw_parameters_features = device_pnext.Find<VkPhysicalDeviceShaderDrawParametersFeatures>();
         if (shader_draw_parameters_features) {
             enabled_features.core11.shaderDrawParameters = shader_draw_parameters_features->shaderDrawParameters;
         }
     }
 
-    const auto *device_group_ci = LvlFindInChain<VkDeviceGroupDeviceCreateInfo>(pCreateInfo->pNext);
+    const auto *device_group_ci = device_pnext.Find<VkDeviceGroupDeviceCreateInfo>();
     if (device_group_ci) {
         physical_device_count = device_group_ci->physicalDeviceCount;
         device_group_create_info = *device_group_ci;
@@ -867,218 +863,201 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
 
     // Features from other extensions passesd in create info
     {
-        const auto *exclusive_scissor_features = LvlFindInChain<VkPhysicalDeviceExclusiveScissorFeaturesNV>(pCreateInfo->pNext);
+        const auto *exclusive_scissor_features = device_pnext.Find<VkPhysicalDeviceExclusiveScissorFeaturesNV>();
         if (exclusive_scissor_features) {
             enabled_features.exclusive_scissor_features = *exclusive_scissor_features;
         }
 
-        const auto *shading_rate_image_features = LvlFindInChain<VkPhysicalDeviceShadingRateImageFeaturesNV>(pCreateInfo->pNext);
+        const auto *shading_rate_image_features = device_pnext.Find<VkPhysicalDeviceShadingRateImageFeaturesNV>();
         if (shading_rate_image_features) {
             enabled_features.shading_rate_image_features = *shading_rate_image_features;
         }
 
-        const auto *mesh_shader_features = LvlFindInChain<VkPhysicalDeviceMeshShaderFeaturesNV>(pCreateInfo->pNext);
+        const auto *mesh_shader_features = device_pnext.Find<VkPhysicalDeviceMeshShaderFeaturesNV>();
         if (mesh_shader_features) {
             enabled_features.mesh_shader_features = *mesh_shader_features;
         }
 
-        const auto *transform_feedback_features = LvlFindInChain<VkPhysicalDeviceTransformFeedbackFeaturesEXT>(pCreateInfo->pNext);
+        const auto *transform_feedback_features = device_pnext.Find<VkPhysicalDeviceTransformFeedbackFeaturesEXT>();
         if (transform_feedback_features) {
             enabled_features.transform_feedback_features = *transform_feedback_features;
         }
 
-        const auto *vtx_attrib_div_features = LvlFindInChain<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>(pCreateInfo->pNext);
+        const auto *vtx_attrib_div_features = device_pnext.Find<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>();
         if (vtx_attrib_div_features) {
             enabled_features.vtx_attrib_divisor_features = *vtx_attrib_div_features;
         }
 
-        const auto *buffer_device_address_ext_features =
-            LvlFindInChain<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>(pCreateInfo->pNext);
+        const auto *buffer_device_address_ext_features = device_pnext.Find<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>();
         if (buffer_device_address_ext_features) {
             enabled_features.buffer_device_address_ext_features = *buffer_device_address_ext_features;
         }
 
-        const auto *cooperative_matrix_features = LvlFindInChain<VkPhysicalDeviceCooperativeMatrixFeaturesNV>(pCreateInfo->pNext);
+        const auto *cooperative_matrix_features = device_pnext.Find<VkPhysicalDeviceCooperativeMatrixFeaturesNV>();
         if (cooperative_matrix_features) {
             enabled_features.cooperative_matrix_features = *cooperative_matrix_features;
         }
 
-        const auto *compute_shader_derivatives_features =
-            LvlFindInChain<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>(pCreateInfo->pNext);
+        const auto *compute_shader_derivatives_features = device_pnext.Find<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>();
         if (compute_shader_derivatives_features) {
             enabled_features.compute_shader_derivatives_features = *compute_shader_derivatives_features;
         }
 
-        const auto *fragment_shader_barycentric_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV>(pCreateInfo->pNext);
+        const auto *fragment_shader_barycentric_features = device_pnext.Find<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV>();
         if (fragment_shader_barycentric_features) {
             enabled_features.fragment_shader_barycentric_features = *fragment_shader_barycentric_features;
         }
 
-        const auto *shader_image_footprint_features =
-            LvlFindInChain<VkPhysicalDeviceShaderImageFootprintFeaturesNV>(pCreateInfo->pNext);
+        const auto *shader_image_footprint_features = device_pnext.Find<VkPhysicalDeviceShaderImageFootprintFeaturesNV>();
         if (shader_image_footprint_features) {
             enabled_features.shader_image_footprint_features = *shader_image_footprint_features;
         }
 
-        const auto *fragment_shader_interlock_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>(pCreateInfo->pNext);
+        const auto *fragment_shader_interlock_features = device_pnext.Find<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>();
         if (fragment_shader_interlock_features) {
             enabled_features.fragment_shader_interlock_features = *fragment_shader_interlock_features;
         }
 
-        const auto *texel_buffer_alignment_features =
-            LvlFindInChain<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>(pCreateInfo->pNext);
+        const auto *texel_buffer_alignment_features = device_pnext.Find<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>();
         if (texel_buffer_alignment_features) {
             enabled_features.texel_buffer_alignment_features = *texel_buffer_alignment_features;
         }
 
-        const auto *pipeline_exe_props_features =
-            LvlFindInChain<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>(pCreateInfo->pNext);
+        const auto *pipeline_exe_props_features = device_pnext.Find<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>();
         if (pipeline_exe_props_features) {
             enabled_features.pipeline_exe_props_features = *pipeline_exe_props_features;
         }
 
         const auto *dedicated_allocation_image_aliasing_features =
-            LvlFindInChain<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>();
         if (dedicated_allocation_image_aliasing_features) {
             enabled_features.dedicated_allocation_image_aliasing_features = *dedicated_allocation_image_aliasing_features;
         }
 
-        const auto *performance_query_features = LvlFindInChain<VkPhysicalDevicePerformanceQueryFeaturesKHR>(pCreateInfo->pNext);
+        const auto *performance_query_features = device_pnext.Find<VkPhysicalDevicePerformanceQueryFeaturesKHR>();
         if (performance_query_features) {
             enabled_features.performance_query_features = *performance_query_features;
         }
 
-        const auto *device_coherent_memory_features = LvlFindInChain<VkPhysicalDeviceCoherentMemoryFeaturesAMD>(pCreateInfo->pNext);
+        const auto *device_coherent_memory_features = device_pnext.Find<VkPhysicalDeviceCoherentMemoryFeaturesAMD>();
         if (device_coherent_memory_features) {
             enabled_features.device_coherent_memory_features = *device_coherent_memory_features;
         }
 
-        const auto *ycbcr_image_array_features = LvlFindInChain<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>(pCreateInfo->pNext);
+        const auto *ycbcr_image_array_features = device_pnext.Find<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>();
         if (ycbcr_image_array_features) {
             enabled_features.ycbcr_image_array_features = *ycbcr_image_array_features;
         }
 
-        const auto *ray_query_features = LvlFindInChain<VkPhysicalDeviceRayQueryFeaturesKHR>(pCreateInfo->pNext);
+        const auto *ray_query_features = device_pnext.Find<VkPhysicalDeviceRayQueryFeaturesKHR>();
         if (ray_query_features) {
             enabled_features.ray_query_features = *ray_query_features;
         }
 
-        const auto *ray_tracing_pipeline_features =
-            LvlFindInChain<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>(pCreateInfo->pNext);
+        const auto *ray_tracing_pipeline_features = device_pnext.Find<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>();
         if (ray_tracing_pipeline_features) {
             enabled_features.ray_tracing_pipeline_features = *ray_tracing_pipeline_features;
         }
 
         const auto *ray_tracing_acceleration_structure_features =
-            LvlFindInChain<VkPhysicalDeviceAccelerationStructureFeaturesKHR>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceAccelerationStructureFeaturesKHR>();
         if (ray_tracing_acceleration_structure_features) {
             enabled_features.ray_tracing_acceleration_structure_features = *ray_tracing_acceleration_structure_features;
         }
 
-        const auto *robustness2_features = LvlFindInChain<VkPhysicalDeviceRobustness2FeaturesEXT>(pCreateInfo->pNext);
+        const auto *robustness2_features = device_pnext.Find<VkPhysicalDeviceRobustness2FeaturesEXT>();
         if (robustness2_features) {
             enabled_features.robustness2_features = *robustness2_features;
         }
 
-        const auto *fragment_density_map_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>(pCreateInfo->pNext);
+        const auto *fragment_density_map_features = device_pnext.Find<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>();
         if (fragment_density_map_features) {
             enabled_features.fragment_density_map_features = *fragment_density_map_features;
         }
 
-        const auto *fragment_density_map_features2 =
-            LvlFindInChain<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>(pCreateInfo->pNext);
+        const auto *fragment_density_map_features2 = device_pnext.Find<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>();
         if (fragment_density_map_features2) {
             enabled_features.fragment_density_map2_features = *fragment_density_map_features2;
         }
 
         const auto *fragment_density_map_offset_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>();
         if (fragment_density_map_offset_features) {
             enabled_features.fragment_density_map_offset_features = *fragment_density_map_offset_features;
         }
 
-        const auto *astc_decode_features = LvlFindInChain<VkPhysicalDeviceASTCDecodeFeaturesEXT>(pCreateInfo->pNext);
+        const auto *astc_decode_features = device_pnext.Find<VkPhysicalDeviceASTCDecodeFeaturesEXT>();
         if (astc_decode_features) {
             enabled_features.astc_decode_features = *astc_decode_features;
         }
 
-        const auto *custom_border_color_features = LvlFindInChain<VkPhysicalDeviceCustomBorderColorFeaturesEXT>(pCreateInfo->pNext);
+        const auto *custom_border_color_features = device_pnext.Find<VkPhysicalDeviceCustomBorderColorFeaturesEXT>();
         if (custom_border_color_features) {
             enabled_features.custom_border_color_features = *custom_border_color_features;
         }
 
-        const auto *fragment_shading_rate_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>(pCreateInfo->pNext);
+        const auto *fragment_shading_rate_features = device_pnext.Find<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>();
         if (fragment_shading_rate_features) {
             enabled_features.fragment_shading_rate_features = *fragment_shading_rate_features;
         }
 
-        const auto *fragment_shading_rate_enums_features =
-            LvlFindInChain<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>(pCreateInfo->pNext);
+        const auto *fragment_shading_rate_enums_features = device_pnext.Find<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>();
         if (fragment_shading_rate_enums_features) {
             enabled_features.fragment_shading_rate_enums_features = *fragment_shading_rate_enums_features;
         }
 
-        const auto *extended_dynamic_state_features =
-            LvlFindInChain<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>(pCreateInfo->pNext);
+        const auto *extended_dynamic_state_features = device_pnext.Find<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>();
         if (extended_dynamic_state_features) {
             enabled_features.extended_dynamic_state_features = *extended_dynamic_state_features;
         }
 
-        const auto *extended_dynamic_state2_features =
-            LvlFindInChain<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>(pCreateInfo->pNext);
+        const auto *extended_dynamic_state2_features = device_pnext.Find<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>();
         if (extended_dynamic_state2_features) {
             enabled_features.extended_dynamic_state2_features = *extended_dynamic_state2_features;
         }
 
-        const auto *multiview_features = LvlFindInChain<VkPhysicalDeviceMultiviewFeatures>(pCreateInfo->pNext);
+        const auto *multiview_features = device_pnext.Find<VkPhysicalDeviceMultiviewFeatures>();
         if (multiview_features) {
             enabled_features.multiview_features = *multiview_features;
         }
 
-        const auto *portability_features = LvlFindInChain<VkPhysicalDevicePortabilitySubsetFeaturesKHR>(pCreateInfo->pNext);
+        const auto *portability_features = device_pnext.Find<VkPhysicalDevicePortabilitySubsetFeaturesKHR>();
         if (portability_features) {
             enabled_features.portability_subset_features = *portability_features;
         }
 
-        const auto *shader_integer_functions2_features =
-            LvlFindInChain<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>(pCreateInfo->pNext);
+        const auto *shader_integer_functions2_features = device_pnext.Find<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>();
         if (shader_integer_functions2_features) {
             enabled_features.shader_integer_functions2_features = *shader_integer_functions2_features;
         }
 
-        const auto *shader_sm_builtins_features = LvlFindInChain<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>(pCreateInfo->pNext);
+        const auto *shader_sm_builtins_features = device_pnext.Find<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>();
         if (shader_sm_builtins_features) {
             enabled_features.shader_sm_builtins_features = *shader_sm_builtins_features;
         }
 
-        const auto *shader_atomic_float_features = LvlFindInChain<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>(pCreateInfo->pNext);
+        const auto *shader_atomic_float_features = device_pnext.Find<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>();
         if (shader_atomic_float_features) {
             enabled_features.shader_atomic_float_features = *shader_atomic_float_features;
         }
 
-        const auto *shader_image_atomic_int64_features =
-            LvlFindInChain<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>(pCreateInfo->pNext);
+        const auto *shader_image_atomic_int64_features = device_pnext.Find<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>();
         if (shader_image_atomic_int64_features) {
             enabled_features.shader_image_atomic_int64_features = *shader_image_atomic_int64_features;
         }
 
-        const auto *shader_clock_features = LvlFindInChain<VkPhysicalDeviceShaderClockFeaturesKHR>(pCreateInfo->pNext);
+        const auto *shader_clock_features = device_pnext.Find<VkPhysicalDeviceShaderClockFeaturesKHR>();
         if (shader_clock_features) {
             enabled_features.shader_clock_features = *shader_clock_features;
         }
 
-        const auto *conditional_rendering_features =
-            LvlFindInChain<VkPhysicalDeviceConditionalRenderingFeaturesEXT>(pCreateInfo->pNext);
+        const auto *conditional_rendering_features = device_pnext.Find<VkPhysicalDeviceConditionalRenderingFeaturesEXT>();
         if (conditional_rendering_features) {
             enabled_features.conditional_rendering_features = *conditional_rendering_features;
         }
 
         const auto *workgroup_memory_explicit_layout_features =
-            LvlFindInChain<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>();
         if (workgroup_memory_explicit_layout_features) {
             enabled_features.workgroup_memory_explicit_layout_features = *workgroup_memory_explicit_layout_features;
         }
@@ -1088,74 +1067,69 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             enabled_features.provoking_vertex_features = *provoking_vertex_features;
         }
 
-        const auto *vertex_input_dynamic_state_features =
-            LvlFindInChain<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>(pCreateInfo->pNext);
+        const auto *vertex_input_dynamic_state_features = device_pnext.Find<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>();
         if (vertex_input_dynamic_state_features) {
             enabled_features.vertex_input_dynamic_state_features = *vertex_input_dynamic_state_features;
         }
 
-        const auto *inherited_viewport_scissor_features =
-            LvlFindInChain<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>(pCreateInfo->pNext);
+        const auto *inherited_viewport_scissor_features = device_pnext.Find<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>();
         if (inherited_viewport_scissor_features) {
             enabled_features.inherited_viewport_scissor_features = *inherited_viewport_scissor_features;
         }
 
-        const auto *multi_draw_features = LvlFindInChain<VkPhysicalDeviceMultiDrawFeaturesEXT>(pCreateInfo->pNext);
+        const auto *multi_draw_features = device_pnext.Find<VkPhysicalDeviceMultiDrawFeaturesEXT>();
         if (multi_draw_features) {
             enabled_features.multi_draw_features = *multi_draw_features;
         }
 
-        const auto *color_write_features = LvlFindInChain<VkPhysicalDeviceColorWriteEnableFeaturesEXT>(pCreateInfo->pNext);
+        const auto *color_write_features = device_pnext.Find<VkPhysicalDeviceColorWriteEnableFeaturesEXT>();
         if (color_write_features) {
             enabled_features.color_write_features = *color_write_features;
         }
 
-        const auto *shader_atomic_float2_features =
-            LvlFindInChain<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>(pCreateInfo->pNext);
+        const auto *shader_atomic_float2_features = device_pnext.Find<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>();
         if (shader_atomic_float2_features) {
             enabled_features.shader_atomic_float2_features = *shader_atomic_float2_features;
         }
 
-        const auto *present_id_features = LvlFindInChain<VkPhysicalDevicePresentIdFeaturesKHR>(pCreateInfo->pNext);
+        const auto *present_id_features = device_pnext.Find<VkPhysicalDevicePresentIdFeaturesKHR>();
         if (present_id_features) {
             enabled_features.present_id_features = *present_id_features;
         }
 
-        const auto *present_wait_features = LvlFindInChain<VkPhysicalDevicePresentWaitFeaturesKHR>(pCreateInfo->pNext);
+        const auto *present_wait_features = device_pnext.Find<VkPhysicalDevicePresentWaitFeaturesKHR>();
         if (present_wait_features) {
             enabled_features.present_wait_features = *present_wait_features;
         }
 
-        const auto *ray_tracing_motion_blur_features =
-            LvlFindInChain<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>(pCreateInfo->pNext);
+        const auto *ray_tracing_motion_blur_features = device_pnext.Find<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>();
         if (ray_tracing_motion_blur_features) {
             enabled_features.ray_tracing_motion_blur_features = *ray_tracing_motion_blur_features;
         }
 
         const auto *primitive_topology_list_restart_features =
-            LvlFindInChain<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>();
         if (primitive_topology_list_restart_features) {
             enabled_features.primitive_topology_list_restart_features = *primitive_topology_list_restart_features;
         }
 
         const auto *zero_initialize_work_group_memory_features =
-            LvlFindInChain<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR>(pCreateInfo->pNext);
+            device_pnext.Find<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesKHR>();
         if (zero_initialize_work_group_memory_features) {
             enabled_features.zero_initialize_work_group_memory_features = *zero_initialize_work_group_memory_features;
         }
 
-        const auto *rgba10x6_formats_features = LvlFindInChain<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>(pCreateInfo->pNext);
+        const auto *rgba10x6_formats_features = device_pnext.Find<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>();
         if (rgba10x6_formats_features) {
             enabled_features.rgba10x6_formats_features = *rgba10x6_formats_features;
         }
 
-        const auto *image_view_min_lod_features = LvlFindInChain<VkPhysicalDeviceImageViewMinLodFeaturesEXT>(pCreateInfo->pNext);
+        const auto *image_view_min_lod_features = device_pnext.Find<VkPhysicalDeviceImageViewMinLodFeaturesEXT>();
         if (image_view_min_lod_features) {
             enabled_features.image_view_min_lod_features = *image_view_min_lod_features;
         }
 
-        const auto *primitives_generated_query_features =
-            LvlFindInChain<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>(pCreateInfo->pNext);
+        const auto *primitives_generated_query_features = device_pnext.Find<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>();
         if (primitives_generated_query_features) {
             enabled_features.primitives_generated_query_features = *primitives_generated_query_features;
         }
@@ -1410,11 +1384,20 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             }
         }
     }
+
+    if (async_submission_retirement && enabled_features.core12.timelineSemaphore) {
+        submission_retirement_.reset(new SubmissionRetirementThread(device, api_version < VK_API_VERSION_1_2));
+    }
 }
 
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
+    // Before the queues it retires are released
+    submission_retirement_.reset();
+    // The states of this call are released with the maps below, not at the end of the call
+    ValidationCallContext *call_context = ValidationCallContext::Current();
+    if (call_context) call_context->ForgetStates();
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -1443,6 +1426,8 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
 
 void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                                        VkFence fence, VkResult result) {
+    ReportMemoryUsageIfDue();
+    housekeeping_.Submitted();
     if (result != VK_SUCCESS) return;
     auto queue_state = Get<QUEUE_STATE>(queue);
 
@@ -1496,10 +1481,15 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
     if (early_retire_seq) {
         queue_state->Retire(early_retire_seq);
     }
+    if (submission_retirement_) {
+        submission_retirement_->SignalSubmitted(queue_state);
+    }
 }
 
 void ValidationStateTracker::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
                                                 VkFence fence, VkResult result) {
+    ReportMemoryUsageIfDue();
+    housekeeping_.Submitted();
     if (result != VK_SUCCESS) return;
     auto queue_state = Get<QUEUE_STATE>(queue);
     uint64_t early_retire_seq = 0;
@@ -1535,6 +1525,9 @@ void ValidationStateTracker::RecordQueueSubmit2(VkQueue queue, uint32_t submitCo
     if (early_retire_seq) {
         queue_state->Retire(early_retire_seq);
     }
+    if (submission_retirement_) {
+        submission_retirement_->SignalSubmitted(queue_state);
+    }
 }
 
 void ValidationStateTracker::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -1605,8 +1598,9 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                 auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
                 auto buffer_state = Get<BUFFER_STATE>(bind_info.pBufferBinds[j].buffer);
                 auto mem_state = Get<DEVICE_MEMORY_STATE>(sparse_binding.memory);
-                if (buffer_state && mem_state) {
-                    buffer_state->SetSparseMemBinding(mem_state, sparse_binding.memoryOffset, sparse_binding.size);
+                if (buffer_state) {
+                    buffer_state->SetSparseMemBinding(mem_state, sparse_binding.resourceOffset, sparse_binding.memoryOffset,
+                                                      sparse_binding.size);
                 }
             }
         }
@@ -1615,8 +1609,9 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                 auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
                 auto image_state = Get<IMAGE_STATE>(bind_info.pImageOpaqueBinds[j].image);
                 auto mem_state = Get<DEVICE_MEMORY_STATE>(sparse_binding.memory);
-                if (image_state && mem_state) {
-                    image_state->SetSparseMemBinding(mem_state, sparse_binding.memoryOffset, sparse_binding.size);
+                if (image_state) {
+                    image_state->SetSparseMemBinding(mem_state, sparse_binding.resourceOffset, sparse_binding.memoryOffset,
+                                                     sparse_binding.size);
                 }
             }
         }
@@ -1628,7 +1623,7 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                 auto image_state = Get<IMAGE_STATE>(bind_info.pImageBinds[j].image);
                 auto mem_state = Get<DEVICE_MEMORY_STATE>(sparse_binding.memory);
                 if (image_state && mem_state) {
-                    image_state->SetSparseMemBinding(mem_state, sparse_binding.memoryOffset, size);
+                    image_state->SetSparseImageMemBinding(mem_state, sparse_binding.memoryOffset, size);
                 }
             }
         }
@@ -1649,6 +1644,9 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
     if (early_retire_seq) {
         queue_state->Retire(early_retire_seq);
     }
+    if (submission_retirement_) {
+        submission_retirement_->SignalSubmitted(queue_state);
+    }
 }
 
 void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
@@ -1808,7 +1806,7 @@ void ValidationStateTracker::UpdateBindBufferMemoryState(VkBuffer buffer, VkDevi
         // Track objects tied to memory
         auto mem_state = Get<DEVICE_MEMORY_STATE>(mem);
         if (mem_state) {
-            buffer_state->SetMemBinding(mem_state, memoryOffset);
+            buffer_state->SetMemBinding(mem_state, memoryOffset, buffer_state->requirements.size);
         }
     }
 }
@@ -2050,16 +2048,76 @@ std::shared_ptr<PIPELINE_STATE> ValidationStateTracker::CreateGraphicsPipelineSt
     return std::make_shared<PIPELINE_STATE>(this, pCreateInfo, std::move(render_pass), std::move(layout));
 }
 
+bool ValidationStateTracker::RunPipelineBatch(uint32_t count, const ValidationBatchPool::Task &task) const {
+    if (batch_pool_ && parallel_pipeline_validation) {
+        return batch_pool_->Run(report_data, count, task);
+    }
+    bool skip = false;
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= task(i);
+    }
+    return skip;
+}
+
+bool ValidationStateTracker::RunDescriptorUpdateBatch(uint32_t count, const ValidationBatchPool::Task &task) const {
+    if (batch_pool_ && parallel_descriptor_update_validation) {
+        return batch_pool_->Run(report_data, count, task);
+    }
+    bool skip = false;
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= task(i);
+    }
+    return skip;
+}
+
+bool ValidationStateTracker::RunSyncResolveBatch(uint32_t count, const ValidationBatchPool::Task &task) const {
+    if (CanRunSyncResolveBatch()) {
+        return batch_pool_->Run(report_data, count, task);
+    }
+    bool skip = false;
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= task(i);
+    }
+    return skip;
+}
+
+bool ValidationStateTracker::RunSyncHazardBatch(uint32_t count, const ValidationBatchPool::Task &task) const {
+    if (CanRunSyncHazardBatch()) {
+        return batch_pool_->Run(report_data, count, task);
+    }
+    bool skip = false;
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= task(i);
+    }
+    return skip;
+}
+
+void ValidationStateTracker::CollectSubmitBatch(uint32_t count, const ValidationBatchPool::Task &task,
+                                                std::vector<uint8_t> &results, ValidationBatchPool::Messages &messages) const {
+    if (CanRunSubmitBatch()) {
+        batch_pool_->Collect(count, task, results, messages);
+        return;
+    }
+    results.assign(count, 0);
+    messages.assign(count, std::vector<DeferredLogMessage>());
+    auto *saved_messages = deferred_log_messages;
+    for (uint32_t i = 0; i < count; i++) {
+        deferred_log_messages = &messages[i];
+        results[i] = task(i) ? 1 : 0;
+        deferred_log_messages = saved_messages;
+    }
+}
+
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                     const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                                     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                                     void *cgpl_state_data) const {
-    bool skip = false;
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
     cgpl_state->pCreateInfos = pCreateInfos;  // GPU validation can alter this, so we have to set a default value for the Chassis
-    cgpl_state->pipe_state.reserve(count);
-    for (uint32_t i = 0; i < count; i++) {
+    cgpl_state->pipe_state.resize(count);
+    return RunPipelineBatch(count, [this, pCreateInfos, cgpl_state](uint32_t i) {
+        bool skip = false;
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<PIPELINE_LAYOUT_STATE>(create_info.layout);
         std::shared_ptr<const RENDER_PASS_STATE> render_pass;
@@ -2076,10 +2134,9 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
                 skip = true;
             }
         }
-        cgpl_state->pipe_state.push_back(
-            CreateGraphicsPipelineState(&create_info, std::move(render_pass), std::move(layout_state)));
-    }
-    return skip;
+        cgpl_state->pipe_state[i] = CreateGraphicsPipelineState(&create_info, std::move(render_pass), std::move(layout_state));
+        return skip;
+    });
 }
 
 void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2108,13 +2165,13 @@ bool ValidationStateTracker::PreCallValidateCreateComputePipelines(VkDevice devi
                                                                    void *ccpl_state_data) const {
     auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
     ccpl_state->pCreateInfos = pCreateInfos;  // GPU validation can alter this, so we have to set a default value for the Chassis
-    ccpl_state->pipe_state.reserve(count);
-    for (uint32_t i = 0; i < count; i++) {
+    ccpl_state->pipe_state.resize(count);
+    return RunPipelineBatch(count, [this, pCreateInfos, ccpl_state](uint32_t i) {
         // Create and initialize internal tracking data structure
-        ccpl_state->pipe_state.push_back(
-            CreateComputePipelineState(&pCreateInfos[i], Get<PIPELINE_LAYOUT_STATE>(pCreateInfos[i].layout)));
-    }
-    return false;
+        ccpl_state->pipe_state[i] =
+            CreateComputePipelineState(&pCreateInfos[i], Get<PIPELINE_LAYOUT_STATE>(pCreateInfos[i].layout));
+        return false;
+    });
 }
 
 void ValidationStateTracker::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2348,18 +2405,6 @@ void ValidationStateTracker::PostCallRecordResetCommandBuffer(VkCommandBuffer co
     }
 }
 
-CBStatusFlags MakeStaticStateMask(VkPipelineDynamicStateCreateInfo const *ds) {
-    // initially assume everything is static state
-    CBStatusFlags flags = CBSTATUS_ALL_STATE_SET;
-
-    if (ds) {
-        for (uint32_t i = 0; i < ds->dynamicStateCount; i++) {
-            flags &= ~ConvertToCBStatusFlagBits(ds->pDynamicStates[i]);
-        }
-    }
-    return flags;
-}
-
 // Validation cache:
 // CV is the bottommost implementor of this extension. Don't pass calls down.
 
@@ -2374,9 +2419,8 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
         const auto *raster_state = pipe_state->RasterizationState();
         bool rasterization_enabled = raster_state && !raster_state->rasterizerDiscardEnable;
         const auto *viewport_state = pipe_state->ViewportState();
-        const auto *dynamic_state = pipe_state->DynamicState();
         cb_state->status &= ~cb_state->static_status;
-        cb_state->static_status = MakeStaticStateMask(dynamic_state ? dynamic_state->ptr() : nullptr);
+        cb_state->static_status = CBSTATUS_ALL_STATE_SET & ~pipe_state->dynamic_state_status;
         cb_state->status |= cb_state->static_status;
         cb_state->dynamic_status = CBSTATUS_ALL_STATE_SET & (~cb_state->static_status);
 
@@ -2509,50 +2553,39 @@ void ValidationStateTracker::RecordDeviceAccelerationStructureBuildInfo(CMD_BUFF
     if (src_as_state) {
         cb_state.AddChild(src_as_state);
     }
-    auto scratch_buffer = GetBufferByAddress(info.scratchData.deviceAddress);
-    if (scratch_buffer) {
-        cb_state.AddChild(scratch_buffer);
-    }
+    // The geometries of a build mostly share a few buffers, each is looked up and added once per run of addresses into it
+    BufferAddressLookup<BUFFER_STATE> buffer_lookup(*this);
+    const BUFFER_STATE *last_added_buffer = nullptr;
+    auto add_buffer = [&cb_state, &buffer_lookup, &last_added_buffer](VkDeviceAddress address) {
+        auto buffer_state = buffer_lookup.Get(address);
+        if (buffer_state && buffer_state.get() != last_added_buffer) {
+            last_added_buffer = buffer_state.get();
+            cb_state.AddChild(buffer_state);
+        }
+    };
+    add_buffer(info.scratchData.deviceAddress);
 
     for (uint32_t i = 0; i < info.geometryCount; i++) {
         // only one of pGeometries and ppGeometries can be non-null
         const auto &geom = info.pGeometries ? info.pGeometries[i] : *info.ppGeometries[i];
         switch (geom.geometryType) {
             case VK_GEOMETRY_TYPE_TRIANGLES_KHR: {
-                auto vertex_buffer = GetBufferByAddress(geom.geometry.triangles.vertexData.deviceAddress);
-                if (vertex_buffer) {
-                    cb_state.AddChild(vertex_buffer);
-                }
-                auto index_buffer = GetBufferByAddress(geom.geometry.triangles.indexData.deviceAddress);
-                if (index_buffer) {
-                    cb_state.AddChild(index_buffer);
-                }
-                auto transform_buffer = GetBufferByAddress(geom.geometry.triangles.transformData.deviceAddress);
-                if (transform_buffer) {
-                    cb_state.AddChild(transform_buffer);
-                }
+                add_buffer(geom.geometry.triangles.vertexData.deviceAddress);
+                add_buffer(geom.geometry.triangles.indexData.deviceAddress);
+                add_buffer(geom.geometry.triangles.transformData.deviceAddress);
                 const auto *motion_data = LvlFindInChain<VkAccelerationStructureGeometryMotionTrianglesDataNV>(info.pNext);
                 if (motion_data) {
-                    auto motion_buffer = GetBufferByAddress(motion_data->vertexData.deviceAddress);
-                    if (motion_buffer) {
-                        cb_state.AddChild(motion_buffer);
-                    }
+                    add_buffer(motion_data->vertexData.deviceAddress);
                 }
             } break;
             case VK_GEOMETRY_TYPE_AABBS_KHR: {
-                auto data_buffer = GetBufferByAddress(geom.geometry.aabbs.data.deviceAddress);
-                if (data_buffer) {
-                    cb_state.AddChild(data_buffer);
-                }
+                add_buffer(geom.geometry.aabbs.data.deviceAddress);
             } break;
             case VK_GEOMETRY_TYPE_INSTANCES_KHR: {
                 // NOTE: if arrayOfPointers is true, we don't track the pointers in the array. That would
                 // require that data buffer be mapped to the CPU so that we could walk through it. We can't
                 // easily ensure that's true.
-                auto data_buffer = GetBufferByAddress(geom.geometry.instances.data.deviceAddress);
-                if (data_buffer) {
-                    cb_state.AddChild(data_buffer);
-                }
+                add_buffer(geom.geometry.instances.data.deviceAddress);
             } break;
             default:
                 break;
@@ -2620,7 +2653,7 @@ void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryNV(
             // Track objects tied to memory
             auto mem_state = Get<DEVICE_MEMORY_STATE>(info.memory);
             if (mem_state) {
-                as_state->SetMemBinding(mem_state, info.memoryOffset);
+                as_state->SetMemBinding(mem_state, info.memoryOffset, as_state->memory_requirements.size);
             }
 
             // GPU validation of top level acceleration structure building needs acceleration structure handles.
@@ -2818,19 +2851,10 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants(VkCommandBuffer comm
         std::memcpy(push_constant_data.data() + offset, pValues, static_cast<std::size_t>(size));
         cb_state->push_constant_pipeline_layout_set = layout;
 
-        auto flags = stageFlags;
-        uint32_t bit_shift = 0;
-        while (flags) {
-            if (flags & 1) {
-                VkShaderStageFlagBits flag = static_cast<VkShaderStageFlagBits>(1 << bit_shift);
-                const auto it = cb_state->push_constant_data_update.find(flag);
-
-                if (it != cb_state->push_constant_data_update.end()) {
-                    std::memset(it->second.data() + offset, PC_Byte_Updated, static_cast<std::size_t>(size));
-                }
-            }
-            flags = flags >> 1;
-            ++bit_shift;
+        auto &push_constant_data_update = cb_state->push_constant_data_update;
+        const uint32_t end = std::min(offset + size, static_cast<uint32_t>(push_constant_data_update.size()));
+        for (uint32_t byte = offset; byte < end; ++byte) {
+            push_constant_data_update[byte] |= stageFlags;
         }
     }
 }
@@ -2872,6 +2896,7 @@ void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer c
             cb_state->AddChild(vertex_buffer_binding.buffer_state);
         }
     }
+    cb_state->current_vertex_buffer_binding_info.UpdateNullBindings();
 }
 
 void ValidationStateTracker::PostCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer,
@@ -3094,11 +3119,21 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
                                             std::move(views)));
 }
 
+std::shared_ptr<RENDER_PASS_STATE> ValidationStateTracker::CreateRenderPassState(VkRenderPass render_pass,
+                                                                             const VkRenderPassCreateInfo *pCreateInfo) {
+    return std::make_shared<RENDER_PASS_STATE>(render_pass, pCreateInfo);
+}
+
+std::shared_ptr<RENDER_PASS_STATE> ValidationStateTracker::CreateRenderPassState(VkRenderPass render_pass,
+                                                                             const VkRenderPassCreateInfo2 *pCreateInfo) {
+    return std::make_shared<RENDER_PASS_STATE>(render_pass, pCreateInfo);
+}
+
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             VkResult result) {
     if (VK_SUCCESS != result) return;
-    Add(std::make_shared<RENDER_PASS_STATE>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -3106,7 +3141,7 @@ void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device,
                                                                 VkResult result) {
     if (VK_SUCCESS != result) return;
 
-    Add(std::make_shared<RENDER_PASS_STATE>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -3114,7 +3149,7 @@ void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, co
                                                              VkResult result) {
     if (VK_SUCCESS != result) return;
 
-    Add(std::make_shared<RENDER_PASS_STATE>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
@@ -3262,15 +3297,16 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
     if (image_state) {
         // An Android sepcial image cannot get VkSubresourceLayout until the image binds a memory.
         // See: VUID-vkGetImageSubresourceLayout-image-01895
-        image_state->fragment_encoder =
-            std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*image_state));
+        if (use_image_fragment_encoder) {
+            image_state->fragment_encoder = GetImageRangeEncoder(*image_state);
+        }
         const auto swapchain_info = LvlFindInChain<VkBindImageMemorySwapchainInfoKHR>(bindInfo.pNext);
         if (swapchain_info) {
             auto swapchain = Get<SWAPCHAIN_NODE>(swapchain_info->swapchain);
             if (swapchain) {
                 SWAPCHAIN_IMAGE &swapchain_image = swapchain->images[swapchain_info->imageIndex];
 
-                if (!swapchain_image.fake_base_address) {
+                if (!swapchain_image.fake_base_address && image_state->fragment_encoder) {
                     auto size = image_state->fragment_encoder->TotalSize();
                     swapchain_image.fake_base_address = fake_memory.Alloc(size);
                 }
@@ -3281,7 +3317,7 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
             // Track bound memory range information
             auto mem_info = Get<DEVICE_MEMORY_STATE>(bindInfo.memory);
             if (mem_info) {
-                image_state->SetMemBinding(mem_info, bindInfo.memoryOffset);
+                image_state->SetMemBinding(mem_info, bindInfo.memoryOffset, image_state->requirements[0].size);
             }
         }
     }
@@ -3452,6 +3488,8 @@ void ValidationStateTracker::PostCallRecordCreateDisplayModeKHR(VkPhysicalDevice
 }
 
 void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
+    ReportMemoryUsageIfDue();
+    housekeeping_.Presented();
     auto queue_state = Get<QUEUE_STATE>(queue);
     // Semaphore waits occur before error generation, if the call reached the ICD. (Confirm?)
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
@@ -3869,7 +3907,11 @@ void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplateKHR(VkD
 
 void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
                                                                        VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) {
-    Add(std::make_shared<UPDATE_TEMPLATE_STATE>(*pDescriptorUpdateTemplate, pCreateInfo));
+    std::shared_ptr<const cvdescriptorset::DescriptorSetLayout> layout;
+    if (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        layout = Get<cvdescriptorset::DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    }
+    Add(std::make_shared<UPDATE_TEMPLATE_STATE>(*pDescriptorUpdateTemplate, pCreateInfo, layout.get()));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(VkDevice device,
@@ -4031,13 +4073,10 @@ void ValidationStateTracker::RecordResetQueryPool(VkDevice device, VkQueryPool q
 
     // Reset the state of existing entries.
     const uint32_t max_query_count = std::min(queryCount, query_pool_state->createInfo.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
+    query_pool_state->SetQueryStates(firstQuery, max_query_count, 0, QUERYSTATE_RESET);
+    if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
+        for (uint32_t pass_index = 1; pass_index < query_pool_state->n_performance_passes; pass_index++) {
+            query_pool_state->SetQueryStates(firstQuery, max_query_count, pass_index, QUERYSTATE_RESET);
         }
     }
 }
@@ -4279,12 +4318,134 @@ void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirectKHR(VkCommandBuff
     cb_state->hasTraceRaysCmd = true;
 }
 
+static uint64_t HashSpirv(const uint32_t *code, size_t word_count) {
+    // FNV-1a over the words
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < word_count; ++i) {
+        hash = (hash ^ code[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::shared_ptr<SHADER_MODULE_STATE> FindInlineShaderModule(const std::vector<std::weak_ptr<SHADER_MODULE_STATE>> &bucket,
+                                                                   const VkShaderModuleCreateInfo &create_info,
+                                                                   uint32_t unique_shader_id) {
+    const size_t word_count = create_info.codeSize / sizeof(uint32_t);
+    for (const auto &entry : bucket) {
+        auto module_state = entry.lock();
+        // Modules whose code was rewritten at creation (see PreprocessShaderBinary) never match, and are not shared
+        if (module_state && module_state->gpu_validation_shader_id == unique_shader_id &&
+            module_state->words.size() == word_count &&
+            std::equal(module_state->words.begin(), module_state->words.end(), create_info.pCode)) {
+            return module_state;
+        }
+    }
+    return nullptr;
+}
+
 std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleState(const VkShaderModuleCreateInfo &create_info,
                                                                                      uint32_t unique_shader_id) const {
     spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     bool is_spirv = (create_info.pCode[0] == spv::MagicNumber);
-    return is_spirv ? std::make_shared<SHADER_MODULE_STATE>(create_info, spirv_environment, unique_shader_id)
-                    : std::make_shared<SHADER_MODULE_STATE>();
+    if (!is_spirv) {
+        return std::make_shared<SHADER_MODULE_STATE>();
+    }
+
+    const uint64_t key = HashSpirv(create_info.pCode, create_info.codeSize / sizeof(uint32_t));
+    {
+        ReadLockGuard guard(inline_shader_module_lock_);
+        auto it = inline_shader_modules_.modules.find(key);
+        if (it != inline_shader_modules_.modules.end()) {
+            auto module_state = FindInlineShaderModule(it->second, create_info, unique_shader_id);
+            if (module_state) return module_state;
+        }
+    }
+
+    // Parse outside of the lock; if another thread won the race, its module is used instead. Not make_shared, so that an
+    // expired entry does not keep the module's storage alive until it is pruned.
+    std::shared_ptr<SHADER_MODULE_STATE> module_state(new SHADER_MODULE_STATE(create_info, spirv_environment, unique_shader_id));
+    WriteLockGuard guard(inline_shader_module_lock_);
+    auto &bucket = inline_shader_modules_.modules[key];
+    auto existing = FindInlineShaderModule(bucket, create_info, unique_shader_id);
+    if (existing) return existing;
+    bucket.emplace_back(module_state);
+
+    if (inline_shader_modules_.modules.size() >= inline_shader_modules_.prune_size) {
+        inline_shader_modules_.Prune();
+    }
+    return module_state;
+}
+
+void ValidationStateTracker::InlineShaderModuleCache::Prune() {
+    for (auto it = modules.begin(); it != modules.end();) {
+        auto &entries = it->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [](const std::weak_ptr<SHADER_MODULE_STATE> &entry) { return entry.expired(); }),
+                      entries.end());
+        if (entries.empty()) {
+            it = modules.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    prune_size = std::max(static_cast<size_t>(256), modules.size() * 2);
+}
+
+bool ValidationStateTracker::ImageRangeEncoderKey::operator==(const ImageRangeEncoderKey &other) const {
+    return (flags == other.flags) && (image_type == other.image_type) && (format == other.format) &&
+           (extent.width == other.extent.width) && (extent.height == other.extent.height) &&
+           (extent.depth == other.extent.depth) && (mip_levels == other.mip_levels) && (array_layers == other.array_layers) &&
+           (aspect_mask == other.aspect_mask);
+}
+
+size_t ValidationStateTracker::ImageRangeEncoderKey::Hash::operator()(const ImageRangeEncoderKey &key) const {
+    hash_util::HashCombiner hc;
+    hc << key.flags << key.image_type << key.format << key.extent.width << key.extent.height << key.extent.depth
+       << key.mip_levels << key.array_layers << key.aspect_mask;
+    return hc.Value();
+}
+
+std::shared_ptr<const subresource_adapter::ImageRangeEncoder> ValidationStateTracker::GetImageRangeEncoder(
+    const IMAGE_STATE &image) const {
+    using subresource_adapter::ImageRangeEncoder;
+    if (image.createInfo.tiling == VK_IMAGE_TILING_LINEAR) {
+        return std::make_shared<const ImageRangeEncoder>(image);
+    }
+    const auto &create_info = image.createInfo;
+    const ImageRangeEncoderKey key{create_info.flags,     create_info.imageType,   create_info.format,      create_info.extent,
+                                   create_info.mipLevels, create_info.arrayLayers, image.full_range.aspectMask};
+    {
+        ReadLockGuard guard(image_range_encoder_lock_);
+        auto it = image_range_encoders_.encoders.find(key);
+        if (it != image_range_encoders_.encoders.end()) {
+            auto encoder = it->second.lock();
+            if (encoder) return encoder;
+        }
+    }
+
+    // Build outside of the lock; if another thread won the race, its encoder is used instead
+    std::shared_ptr<const ImageRangeEncoder> encoder(new ImageRangeEncoder(image));
+    WriteLockGuard guard(image_range_encoder_lock_);
+    auto &entry = image_range_encoders_.encoders[key];
+    auto existing = entry.lock();
+    if (existing) return existing;
+    entry = encoder;
+
+    if (image_range_encoders_.encoders.size() >= image_range_encoders_.prune_size) {
+        image_range_encoders_.Prune();
+    }
+    return encoder;
+}
+
+void ValidationStateTracker::ImageRangeEncoderCache::Prune() {
+    for (auto it = encoders.begin(); it != encoders.end();) {
+        if (it->second.expired()) {
+            it = encoders.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    prune_size = std::max(static_cast<size_t>(256), encoders.size() * 2);
 }
 
 std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleState(const VkShaderModuleCreateInfo &create_info,
@@ -4319,13 +4480,13 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
             SWAPCHAIN_IMAGE &swapchain_image = swapchain_state->images[i];
             if (swapchain_image.image_state) continue;  // Already retrieved this.
 
-            auto format_features = GetImageFormatFeatures(
-                physical_device, has_format_feature2, IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
-                pSwapchainImages[i], swapchain_state->image_create_info.format, swapchain_state->image_create_info.tiling);
+            auto format_features =
+                GetImageFormatFeatures(GetFormatPropertiesCache(), has_format_feature2, device, pSwapchainImages[i],
+                                       swapchain_state->image_create_info.format, swapchain_state->image_create_info.tiling);
 
             auto image_state =
                 CreateImageState(pSwapchainImages[i], swapchain_state->image_create_info.ptr(), swapchain, i, format_features);
-            if (!swapchain_image.fake_base_address) {
+            if (!swapchain_image.fake_base_address && image_state->fragment_encoder) {
                 auto size = image_state->fragment_encoder->TotalSize();
                 swapchain_image.fake_base_address = fake_memory.Alloc(size);
             }
@@ -4506,6 +4667,7 @@ void ValidationStateTracker::RecordCmdBindVertexBuffers2(VkCommandBuffer command
             cb_state->AddChild(vertex_buffer_binding.buffer_state);
         }
     }
+    cb_state->current_vertex_buffer_binding_info.UpdateNullBindings();
 }
 
 void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
@@ -4691,7 +4853,9 @@ void ValidationStateTracker::RecordGetBufferDeviceAddress(const VkBufferDeviceAd
         WriteLockGuard guard(buffer_address_lock_);
         // address is used for GPU-AV and ray tracing buffer validation
         buffer_state->deviceAddress = address;
-        buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state});
+        if (buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state}).second) {
+            buffer_address_generation_.fetch_add(1, std::memory_order_release);
+        }
     }
 }
 
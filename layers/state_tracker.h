@@ -39,6 +39,10 @@
 #include "vk_layer_data.h"
 #include "android_ndk_types.h"
 #include "range_vector.h"
+#include "handle_indexed_map.h"
+#include "validation_worker_pool.h"
+#include "housekeeping.h"
+#include "call_context.h"
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -60,6 +64,9 @@ class QUEUE_STATE;
 class BUFFER_STATE;
 class BUFFER_VIEW_STATE;
 class IMAGE_STATE;
+namespace subresource_adapter {
+class ImageRangeEncoder;
+}
 class IMAGE_VIEW_STATE;
 class COMMAND_POOL_STATE;
 class DISPLAY_MODE_STATE;
@@ -86,13 +93,18 @@ struct create_shader_module_api_state {
     std::vector<uint32_t> instrumented_pgm;
 };
 
+class ValidationStateTracker;
+
 // This structure is used to save data across the CreateGraphicsPipelines down-chain API call
 struct create_graphics_pipeline_api_state {
     std::vector<safe_VkGraphicsPipelineCreateInfo> gpu_create_infos;
     std::vector<safe_VkGraphicsPipelineCreateInfo> printf_create_infos;
     std::vector<std::shared_ptr<PIPELINE_STATE>> pipe_state;
-    std::vector<std::vector<create_shader_module_api_state>> shader_states;
     const VkGraphicsPipelineCreateInfo* pCreateInfos;
+    // Set by GPU-AV: the cache of instrumented pipelines used down the chain in place of the application's, and the object
+    // creating the pipelines of a large call in parallel, see ValidationStateTracker::DispatchPipelineBatch()
+    VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+    const ValidationStateTracker* parallel_create = nullptr;
 };
 
 // This structure is used to save data across the CreateComputePipelines down-chain API call
@@ -101,6 +113,9 @@ struct create_compute_pipeline_api_state {
     std::vector<safe_VkComputePipelineCreateInfo> printf_create_infos;
     std::vector<std::shared_ptr<PIPELINE_STATE>> pipe_state;
     const VkComputePipelineCreateInfo* pCreateInfos;
+    // As for graphics pipelines
+    VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+    const ValidationStateTracker* parallel_create = nullptr;
 };
 
 // This structure is used to save data across the CreateRayTracingPipelinesNV down-chain API call.
@@ -130,19 +145,27 @@ struct create_buffer_api_state {
     VkBufferCreateInfo modified_create_info;
 };
 
-#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope) \
-    vl_concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member; \
+#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(map_template, handle_type, state_type, map_member, instance_scope) \
+    map_template<handle_type, std::shared_ptr<state_type>> map_member; \
     template <typename Dummy> \
     struct MapTraits<state_type, Dummy> { \
         static constexpr bool kInstanceScope = instance_scope; \
         using MapType = decltype(map_member); \
         static MapType ValidationStateTracker::*Map() { return &ValidationStateTracker::map_member; } \
+        static StateMemoryCounter &MemoryCounter() { \
+            static StateMemoryCounter *counter = new StateMemoryCounter(#state_type); \
+            return *counter; \
+        } \
     };
 
 #define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(vl_concurrent_unordered_map, handle_type, state_type, map_member, false)
 #define VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, true)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(vl_concurrent_unordered_map, handle_type, state_type, map_member, true)
+// Object types whose state is looked up on hot paths can opt in to being indexed directly by their wrapped handles, see
+// vl_handle_indexed_map and EnableHandleIndexedMaps()
+#define VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(handle_type, state_type, map_member) \
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(vl_handle_indexed_map, handle_type, state_type, map_member, false)
 
 namespace state_object {
 // Traits for State function resolution.  Specializations defined in the macros below.
@@ -321,21 +344,70 @@ class ValidationStateTracker : public ValidationObject {
         return (MapTraits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
     }
 
+    template <typename State>
+    using IsCommandBufferState = std::is_same<typename state_object::Traits<State>::BaseType, CMD_BUFFER_STATE>;
+
+    // The state found by each hook of the call being validated is kept in its ValidationCallContext for the hooks after it
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    std::shared_ptr<typename Traits::BaseType> FindShared(typename Traits::HandleType handle, std::false_type) const {
+        using BaseType = typename Traits::BaseType;
+        const auto& map = GetStateMap<State>();
+        ValidationCallContext* call_context = ValidationCallContext::Current();
+        if (call_context) {
+            auto memo = call_context->FindState(&map, CastToUint64(handle));
+            if (memo) return std::static_pointer_cast<BaseType>(std::move(memo));
+        }
+        const auto found_it = map.find(handle);
+        if (found_it == map.end()) {
+            return nullptr;
+        }
+        // NOTE: vl_concurrent_unordered_map::find() makes a copy of the value, so it is safe to move out.
+        // But this will break everything, when switching to a different map type.
+        std::shared_ptr<BaseType> state = std::move(found_it->second);
+        if (call_context) call_context->RememberState(&map, CastToUint64(handle), state);
+        return state;
+    }
+
+    static void ForgetCallContextState(const void* map, uint64_t handle) {
+        ValidationCallContext* call_context = ValidationCallContext::Current();
+        if (call_context) call_context->ForgetState(map, handle);
+    }
+
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    std::shared_ptr<CMD_BUFFER_STATE> FindShared(typename Traits::HandleType handle, std::true_type) const {
+        return FindCommandBufferShared(handle);
+    }
+
+    // Command buffer state is looked up by every validation object for every vkCmd*() call, so the last command buffer each
+    // thread used is cached per ValidationStateTracker. A cached state is only used until it is destroyed, which happens before
+    // its handle can be allocated again, so allocating or freeing other command buffers leaves the entries of the rest valid.
+    std::shared_ptr<CMD_BUFFER_STATE> FindCommandBufferShared(VkCommandBuffer handle) const;
+    static uint64_t NextCommandBufferCacheId();
+    static uint32_t NextCommandBufferCacheSlot();
+
+    const uint64_t command_buffer_cache_id_{NextCommandBufferCacheId()};
+    const uint32_t command_buffer_cache_slot_{NextCommandBufferCacheSlot()};
+
   public:
-    template <typename State, typename HandleType = typename state_object::Traits<State>::HandleType>
+    template <typename State, typename HandleType = typename state_object::Traits<State>::HandleType,
+              typename BaseType = typename state_object::Traits<State>::BaseType>
     void Add(std::shared_ptr<State>&& state_object) {
         auto& map = GetStateMap<State>();
         auto handle = state_object->Handle().template Cast<HandleType>();
         // Finish setting up the object node tree, which cannot be done from the state object contructors
         // due to use of shared_from_this()
         state_object->LinkChildNodes();
+        state_object->AccountMemory(MapTraits<BaseType>::MemoryCounter(), sizeof(State));
         map.insert_or_assign(handle, std::move(state_object));
+        ForgetCallContextState(&map, CastToUint64(handle));
     }
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
     void Destroy(typename Traits::HandleType handle) {
+        BASE_NODE::InvalidationBatch invalidation_batch;
         auto& map = GetStateMap<State>();
         auto iter = map.pop(handle);
+        ForgetCallContextState(&map, CastToUint64(handle));
         if (iter != map.end()) {
             iter->second->Destroy();
         }
@@ -367,24 +439,12 @@ class ValidationStateTracker : public ValidationObject {
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
     typename Traits::SharedType Get(typename Traits::HandleType handle) {
-        const auto& map = GetStateMap<State>();
-        const auto found_it = map.find(handle);
-        if (found_it == map.end()) {
-            return nullptr;
-        }
-        // NOTE: vl_concurrent_unordered_map::find() makes a copy of the value, so it is safe to move out.
-        // But this will break everything, when switching to a different map type.
-        return std::static_pointer_cast<State>(std::move(found_it->second));
+        return std::static_pointer_cast<State>(FindShared<State>(handle, IsCommandBufferState<State>()));
     };
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
     typename Traits::ConstSharedType Get(typename Traits::HandleType handle) const {
-        const auto& map = GetStateMap<State>();
-        const auto found_it = map.find(handle);
-        if (found_it == map.end()) {
-            return nullptr;
-        }
-        return std::static_pointer_cast<State>(std::move(found_it->second));
+        return std::static_pointer_cast<State>(FindShared<State>(handle, IsCommandBufferState<State>()));
     };
 
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
@@ -448,9 +508,37 @@ class ValidationStateTracker : public ValidationObject {
         return found_it->second;
     }
 
+    // Looks up the buffers of a run of device addresses, such as those of the geometries of an acceleration structure build.
+    // The buffer last found is checked before buffer_address_map_, so that addresses into the same buffer as the address before
+    // them take neither buffer_address_lock_ nor the map lookup.
+    template <typename BufferStateType>
+    class BufferAddressLookup {
+      public:
+        using Tracker = typename std::conditional<std::is_const<BufferStateType>::value, const ValidationStateTracker,
+                                                  ValidationStateTracker>::type;
+        explicit BufferAddressLookup(Tracker& tracker) : tracker_(tracker) {}
+
+        std::shared_ptr<BufferStateType> Get(VkDeviceAddress address) {
+            if (last_ && last_->DeviceAddressRange().includes(address)) {
+                return last_;
+            }
+            auto buffer_state = tracker_.GetBufferByAddress(address);
+            if (buffer_state) {
+                last_ = buffer_state;
+            }
+            return buffer_state;
+        }
+
+      private:
+        Tracker& tracker_;
+        std::shared_ptr<BufferStateType> last_;
+    };
+
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
-    std::vector<BufferAddressRange> GetBufferAddressRanges() const {
+    // generation, if not null, is set to the BufferAddressGeneration() of the ranges returned
+    std::vector<BufferAddressRange> GetBufferAddressRanges(uint64_t* generation = nullptr) const {
         ReadLockGuard guard(buffer_address_lock_);
+        if (generation) *generation = buffer_address_generation_.load(std::memory_order_relaxed);
         std::vector<BufferAddressRange> result;
         result.reserve(buffer_address_map_.size());
         for (const auto& entry : buffer_address_map_) {
@@ -458,6 +546,9 @@ class ValidationStateTracker : public ValidationObject {
         }
         return result;
     }
+    // Changes whenever a buffer is added to or removed from the buffer address map, so that tables built from
+    // GetBufferAddressRanges() can be reused until then
+    uint64_t BufferAddressGeneration() const { return buffer_address_generation_.load(std::memory_order_acquire); }
 
     using CommandBufferResetCallback = std::function<void(VkCommandBuffer)>;
     template <typename Fn>
@@ -601,6 +692,47 @@ class ValidationStateTracker : public ValidationObject {
     void PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
                                     const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, VkResult result) override;
     virtual void CreateDevice(const VkDeviceCreateInfo* pCreateInfo);
+    // The waits on the locks of the state maps looked up while recording, for the derived objects to add to theirs
+    void GetValidationCounters(ValidationCounterList& counters) const override;
+    // Switch the maps declared with VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS to handle indexing when handles are wrapped
+    // by the lock-free handle slab
+    void EnableHandleIndexedMaps();
+    // Log the state memory report when memory_report_interval is set and the interval has passed
+    void ReportMemoryUsageIfDue() const;
+    // Runs task(0) to task(count - 1) for the pipelines of one vkCreate*Pipelines call, in parallel when
+    // parallel_pipeline_validation is set
+    bool RunPipelineBatch(uint32_t count, const ValidationBatchPool::Task& task) const;
+    bool CanRunPipelineBatch() const { return batch_pool_ && parallel_pipeline_validation; }
+    // Creates the pipelines of one call down the chain with a call for each, run by RunPipelineBatch(). Returns the first error
+    // of a pipeline, or else its first result other than VK_SUCCESS.
+    template <typename CreateInfo, typename Dispatch>
+    VkResult DispatchPipelineBatch(uint32_t count, const CreateInfo* create_infos, VkPipeline* pipelines,
+                                   const Dispatch& dispatch) const {
+        std::vector<VkResult> results(count, VK_SUCCESS);
+        RunPipelineBatch(count, [&](uint32_t index) {
+            results[index] = dispatch(&create_infos[index], &pipelines[index]);
+            return false;
+        });
+        VkResult result = VK_SUCCESS;
+        for (const VkResult pipeline_result : results) {
+            if (pipeline_result < 0) return pipeline_result;
+            if (result == VK_SUCCESS) result = pipeline_result;
+        }
+        return result;
+    }
+    // Same for chunks of the descriptor writes of one update call, in parallel when parallel_descriptor_update_validation is set
+    bool RunDescriptorUpdateBatch(uint32_t count, const ValidationBatchPool::Task& task) const;
+    // Same for the windows of an access map merged by synchronization validation, in parallel when parallel_sync_resolve is set
+    bool RunSyncResolveBatch(uint32_t count, const ValidationBatchPool::Task& task) const;
+    bool CanRunSyncResolveBatch() const { return batch_pool_ && parallel_sync_resolve; }
+    // Same for the hazard checks of one command, in parallel when parallel_sync_hazard_detection is set
+    bool RunSyncHazardBatch(uint32_t count, const ValidationBatchPool::Task& task) const;
+    bool CanRunSyncHazardBatch() const { return batch_pool_ && parallel_sync_hazard_detection; }
+    // Runs task(0) to task(count - 1) for the command buffers of one queue submission, in parallel when
+    // parallel_submit_validation is set, handing back what each returned and logged, see ValidationBatchPool::Collect()
+    void CollectSubmitBatch(uint32_t count, const ValidationBatchPool::Task& task, std::vector<uint8_t>& results,
+                            ValidationBatchPool::Messages& messages) const;
+    bool CanRunSubmitBatch() const { return batch_pool_ && parallel_submit_validation; }
 
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
 
@@ -713,6 +845,10 @@ class ValidationStateTracker : public ValidationObject {
                                                const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines, VkResult result,
                                                void* cgpl_state) override;
 
+    virtual std::shared_ptr<RENDER_PASS_STATE> CreateRenderPassState(VkRenderPass render_pass,
+                                                                     const VkRenderPassCreateInfo* pCreateInfo);
+    virtual std::shared_ptr<RENDER_PASS_STATE> CreateRenderPassState(VkRenderPass render_pass,
+                                                                     const VkRenderPassCreateInfo2* pCreateInfo);
     virtual std::shared_ptr<IMAGE_STATE> CreateImageState(VkImage img, const VkImageCreateInfo* pCreateInfo,
                                                           VkFormatFeatureFlags2KHR features);
     virtual std::shared_ptr<IMAGE_STATE> CreateImageState(VkImage img, const VkImageCreateInfo* pCreateInfo,
@@ -1302,6 +1438,8 @@ class ValidationStateTracker : public ValidationObject {
 
     // Link to the device's physical-device data
     PHYSICAL_DEVICE_STATE* physical_device_state;
+    // Device-level objects only
+    const FormatPropertiesCache& GetFormatPropertiesCache() const { return physical_device_state->format_properties; }
 
     // Link for derived device objects back to their parent instance object
     ValidationStateTracker* instance_state;
@@ -1360,6 +1498,14 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<VkCooperativeMatrixPropertiesNV> cooperative_matrix_properties;
 
     bool performance_lock_acquired = false;
+    // Whether push descriptor sets keep a copy of the writes last pushed, see DescriptorSet::GetWrites
+    bool retain_push_descriptor_writes = false;
+    // Whether images get a fragment_encoder (and swapchain images a fake base address) when bound to memory
+    bool use_image_fragment_encoder = false;
+
+    // The fragment resolution encoder of the image. Images of the same shape share one, except for linear images, whose
+    // encoder holds the subresource layouts the driver reports for that image.
+    std::shared_ptr<const subresource_adapter::ImageRangeEncoder> GetImageRangeEncoder(const IMAGE_STATE &image) const;
 
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
@@ -1374,31 +1520,84 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<DeviceQueueInfo> device_queue_info_list;
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     sparse_container::range_map<VkDeviceAddress, std::shared_ptr<BUFFER_STATE>> buffer_address_map_;
+    // Advanced under buffer_address_lock_ with each change to buffer_address_map_
+    std::atomic<uint64_t> buffer_address_generation_{0};
     mutable ReadWriteLock buffer_address_lock_;
 
+    // Shader modules created from VkShaderModuleCreateInfo structures chained to pipeline stages have no handle, interned by
+    // SPIR-V content so that every pipeline (and pipeline library) using the same code shares one module and its analysis.
+    struct InlineShaderModuleCache {
+        layer_data::unordered_map<uint64_t, std::vector<std::weak_ptr<SHADER_MODULE_STATE>>> modules;
+        size_t prune_size = 256;
+        // Drops the expired entries, with inline_shader_module_lock_ held for writing
+        void Prune();
+    };
+    mutable InlineShaderModuleCache inline_shader_modules_;
+    mutable ReadWriteLock inline_shader_module_lock_;
+
+    // The create parameters a (non-linear) fragment resolution encoder depends on
+    struct ImageRangeEncoderKey {
+        VkImageCreateFlags flags;
+        VkImageType image_type;
+        VkFormat format;
+        VkExtent3D extent;
+        uint32_t mip_levels;
+        uint32_t array_layers;
+        VkImageAspectFlags aspect_mask;
+
+        bool operator==(const ImageRangeEncoderKey &other) const;
+        struct Hash {
+            size_t operator()(const ImageRangeEncoderKey &key) const;
+        };
+    };
+    struct ImageRangeEncoderCache {
+        layer_data::unordered_map<ImageRangeEncoderKey, std::weak_ptr<const subresource_adapter::ImageRangeEncoder>,
+                                  ImageRangeEncoderKey::Hash>
+            encoders;
+        size_t prune_size = 256;
+        // Drops the expired entries, with image_range_encoder_lock_ held for writing
+        void Prune();
+    };
+    mutable ImageRangeEncoderCache image_range_encoders_;
+    mutable ReadWriteLock image_range_encoder_lock_;
+
+    // Shared by every kind of batch that is enabled
+    std::unique_ptr<ValidationBatchPool> batch_pool_;
+
+  protected:
+    // Derived validation objects register their own maintenance tasks in CreateDevice
+    HousekeepingScheduler housekeeping_;
+
+  private:
+
+    // Set with khronos_validation.async_submission_retirement when the device enables timelineSemaphore
+    std::unique_ptr<SubmissionRetirementThread> submission_retirement_;
+
     vl_concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
 
   private:
+    // The slots shared by the handle indexed maps below, created by EnableHandleIndexedMaps()
+    std::unique_ptr<HandleIndexedSlots> handle_indexed_slots_;
     VALSTATETRACK_MAP_AND_TRAITS(VkQueue, QUEUE_STATE, queue_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE, acceleration_structure_nv_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, render_pass_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSetLayout, cvdescriptorset::DescriptorSetLayout, descriptor_set_layout_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, sampler_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkImageView, IMAGE_VIEW_STATE, image_view_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, sampler_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkImageView, IMAGE_VIEW_STATE, image_view_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkImage, IMAGE_STATE, image_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkBufferView, BUFFER_VIEW_STATE, buffer_view_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkBuffer, BUFFER_STATE, buffer_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkPipeline, PIPELINE_STATE, pipeline_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkBufferView, BUFFER_VIEW_STATE, buffer_view_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkBuffer, BUFFER_STATE, buffer_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkPipeline, PIPELINE_STATE, pipeline_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDeviceMemory, DEVICE_MEMORY_STATE, mem_obj_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkFramebuffer, FRAMEBUFFER_STATE, frame_buffer_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkShaderModule, SHADER_MODULE_STATE, shader_module_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorUpdateTemplate, UPDATE_TEMPLATE_STATE, desc_template_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkSwapchainKHR, SWAPCHAIN_NODE, swapchain_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorPool, DESCRIPTOR_POOL_STATE, descriptor_pool_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSet, cvdescriptorset::DescriptorSet, descriptor_set_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkDescriptorSet, cvdescriptorset::DescriptorSet, descriptor_set_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkCommandBuffer, CMD_BUFFER_STATE, command_buffer_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkCommandPool, COMMAND_POOL_STATE, command_pool_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkPipelineLayout, PIPELINE_LAYOUT_STATE, pipeline_layout_map_)
+    VALSTATETRACK_HANDLE_INDEXED_MAP_AND_TRAITS(VkPipelineLayout, PIPELINE_LAYOUT_STATE, pipeline_layout_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkFence, FENCE_STATE, fence_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkQueryPool, QUERY_POOL_STATE, query_pool_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkSemaphore, SEMAPHORE_STATE, semaphore_map_)
@@ -21,6 +21,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+#include "hash_util.h"
 #include "parameter_name.h"
 #include "vk_typemap_helper.h"
 #include "sync_utils.h"
@@ -47,6 +54,31 @@ static const char DECORATE_UNUSED *kVUID_PVError_ApiVersionViolation = "UNASSIGN
 
 extern const uint32_t GeneratedVulkanHeaderVersion;
 
+// The valid values of an enumeration, sorted once when the table is built. Core values are mostly 0..N-1 without gaps, so
+// those are checked with one comparison and only the extension values take a binary search.
+template <typename T>
+class ValidEnumValues {
+  public:
+    ValidEnumValues(std::initializer_list<T> values) : values_(values) {
+        std::sort(values_.begin(), values_.end());
+        values_.erase(std::unique(values_.begin(), values_.end()), values_.end());
+        while ((dense_end_ < values_.size()) && (static_cast<int64_t>(values_[dense_end_]) == static_cast<int64_t>(dense_end_))) {
+            ++dense_end_;
+        }
+    }
+
+    bool contains(T value) const {
+        const int64_t index = static_cast<int64_t>(value);
+        if ((index >= 0) && (index < static_cast<int64_t>(dense_end_))) return true;
+        return std::binary_search(values_.begin() + dense_end_, values_.end(), value);
+    }
+
+  private:
+    std::vector<T> values_;
+    // values_[0..dense_end_) are the values 0..dense_end_-1
+    size_t dense_end_ = 0;
+};
+
 // Some flags and enums are never used in and won't be generated by default
 // Add to 'noautovalidity_type_exceptions' in parameter_validation_generator.py if needed
 extern const VkQueryPipelineStatisticFlags AllVkQueryPipelineStatisticFlagBits;
@@ -60,18 +92,18 @@ extern const VkGeometryFlagsKHR AllVkGeometryFlagBitsKHR;
 extern const VkPipelineColorBlendStateCreateFlags AllVkPipelineColorBlendStateCreateFlagBits;
 extern const VkPipelineDepthStencilStateCreateFlags AllVkPipelineDepthStencilStateCreateFlagBits;
 
-extern const std::vector<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
-extern const std::vector<VkCompareOp> AllVkCompareOpEnums;
-extern const std::vector<VkStencilOp> AllVkStencilOpEnums;
-extern const std::vector<VkBlendFactor> AllVkBlendFactorEnums;
-extern const std::vector<VkBlendOp> AllVkBlendOpEnums;
-extern const std::vector<VkLogicOp> AllVkLogicOpEnums;
-extern const std::vector<VkBorderColor> AllVkBorderColorEnums;
-extern const std::vector<VkImageLayout> AllVkImageLayoutEnums;
-extern const std::vector<VkFormat> AllVkFormatEnums;
-extern const std::vector<VkVertexInputRate> AllVkVertexInputRateEnums;
-extern const std::vector<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
-extern const std::vector<VkIndexType> AllVkIndexTypeEnums;
+extern const ValidEnumValues<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
+extern const ValidEnumValues<VkCompareOp> AllVkCompareOpEnums;
+extern const ValidEnumValues<VkStencilOp> AllVkStencilOpEnums;
+extern const ValidEnumValues<VkBlendFactor> AllVkBlendFactorEnums;
+extern const ValidEnumValues<VkBlendOp> AllVkBlendOpEnums;
+extern const ValidEnumValues<VkLogicOp> AllVkLogicOpEnums;
+extern const ValidEnumValues<VkBorderColor> AllVkBorderColorEnums;
+extern const ValidEnumValues<VkImageLayout> AllVkImageLayoutEnums;
+extern const ValidEnumValues<VkFormat> AllVkFormatEnums;
+extern const ValidEnumValues<VkVertexInputRate> AllVkVertexInputRateEnums;
+extern const ValidEnumValues<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
+extern const ValidEnumValues<VkIndexType> AllVkIndexTypeEnums;
 
 extern std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
 
@@ -89,6 +121,106 @@ const uint32_t ExtEnumBaseValue = 1000000000;
 // The value of all VK_xxx_MAX_ENUM tokens
 const uint32_t MaxEnumValue = 0x7FFFFFFF;
 
+// The create infos a CreateInfoMemo holds, compared field by field so that padding bytes don't matter. pNext is not compared,
+// only create infos without a pNext chain are memoized.
+static inline bool MemoizableCreateInfo(const VkBufferCreateInfo &info) {
+    // The queue family indices would have to be copied
+    return info.sharingMode != VK_SHARING_MODE_CONCURRENT;
+}
+static inline bool MemoizableCreateInfo(const VkImageViewCreateInfo &) { return true; }
+static inline bool MemoizableCreateInfo(const VkSamplerCreateInfo &) { return true; }
+
+static inline size_t HashCreateInfo(const VkBufferCreateInfo &info) {
+    hash_util::HashCombiner hc;
+    return (hc << info.sType << info.flags << info.size << info.usage << info.sharingMode).Value();
+}
+static inline size_t HashCreateInfo(const VkImageViewCreateInfo &info) {
+    hash_util::HashCombiner hc;
+    hc << info.sType << info.flags << CastToUint64(info.image) << info.viewType << info.format;
+    hc << info.components.r << info.components.g << info.components.b << info.components.a;
+    const VkImageSubresourceRange &range = info.subresourceRange;
+    return (hc << range.aspectMask << range.baseMipLevel << range.levelCount << range.baseArrayLayer << range.layerCount).Value();
+}
+static inline size_t HashCreateInfo(const VkSamplerCreateInfo &info) {
+    hash_util::HashCombiner hc;
+    hc << info.sType << info.flags << info.magFilter << info.minFilter << info.mipmapMode << info.addressModeU;
+    hc << info.addressModeV << info.addressModeW << info.mipLodBias << info.anisotropyEnable << info.maxAnisotropy;
+    hc << info.compareEnable << info.compareOp << info.minLod << info.maxLod << info.borderColor;
+    return (hc << info.unnormalizedCoordinates).Value();
+}
+
+static inline bool EqualCreateInfo(const VkBufferCreateInfo &lhs, const VkBufferCreateInfo &rhs) {
+    return (lhs.sType == rhs.sType) && (lhs.flags == rhs.flags) && (lhs.size == rhs.size) && (lhs.usage == rhs.usage) &&
+           (lhs.sharingMode == rhs.sharingMode);
+}
+static inline bool EqualCreateInfo(const VkImageViewCreateInfo &lhs, const VkImageViewCreateInfo &rhs) {
+    const VkImageSubresourceRange &lhs_range = lhs.subresourceRange;
+    const VkImageSubresourceRange &rhs_range = rhs.subresourceRange;
+    return (lhs.sType == rhs.sType) && (lhs.flags == rhs.flags) && (lhs.image == rhs.image) && (lhs.viewType == rhs.viewType) &&
+           (lhs.format == rhs.format) && (lhs.components.r == rhs.components.r) && (lhs.components.g == rhs.components.g) &&
+           (lhs.components.b == rhs.components.b) && (lhs.components.a == rhs.components.a) &&
+           (lhs_range.aspectMask == rhs_range.aspectMask) && (lhs_range.baseMipLevel == rhs_range.baseMipLevel) &&
+           (lhs_range.levelCount == rhs_range.levelCount) && (lhs_range.baseArrayLayer == rhs_range.baseArrayLayer) &&
+           (lhs_range.layerCount == rhs_range.layerCount);
+}
+static inline bool EqualCreateInfo(const VkSamplerCreateInfo &lhs, const VkSamplerCreateInfo &rhs) {
+    return (lhs.sType == rhs.sType) && (lhs.flags == rhs.flags) && (lhs.magFilter == rhs.magFilter) &&
+           (lhs.minFilter == rhs.minFilter) && (lhs.mipmapMode == rhs.mipmapMode) && (lhs.addressModeU == rhs.addressModeU) &&
+           (lhs.addressModeV == rhs.addressModeV) && (lhs.addressModeW == rhs.addressModeW) &&
+           (lhs.mipLodBias == rhs.mipLodBias) && (lhs.anisotropyEnable == rhs.anisotropyEnable) &&
+           (lhs.maxAnisotropy == rhs.maxAnisotropy) && (lhs.compareEnable == rhs.compareEnable) &&
+           (lhs.compareOp == rhs.compareOp) && (lhs.minLod == rhs.minLod) && (lhs.maxLod == rhs.maxLod) &&
+           (lhs.borderColor == rhs.borderColor) && (lhs.unnormalizedCoordinates == rhs.unnormalizedCoordinates);
+}
+
+// The create infos that passed the stateless validation of a vkCreate* entry point, so that identical calls can skip it when
+// khronos_validation.stateless_create_info_memo is set. Only calls without a pNext chain or allocation callbacks are memoized,
+// their validation depends on nothing else but the device. Each slot holds the latest create info that hashed to it.
+template <typename CreateInfo>
+class CreateInfoMemo {
+  public:
+    bool Contains(const CreateInfo *create_info, const VkAllocationCallbacks *allocator, const void *created) const {
+        if (!Memoizable(create_info, allocator, created)) return false;
+        const size_t hash = HashCreateInfo(*create_info);
+        std::lock_guard<std::mutex> guard(lock_);
+        const Slot &slot = slots_[hash % kSlots];
+        const bool found = slot.used && (slot.hash == hash) && EqualCreateInfo(slot.create_info, *create_info);
+        (found ? hits : misses).Add();
+        return found;
+    }
+
+    // Called once create_info passed validation
+    void Add(const CreateInfo *create_info, const VkAllocationCallbacks *allocator, const void *created) const {
+        if (!Memoizable(create_info, allocator, created)) return;
+        const size_t hash = HashCreateInfo(*create_info);
+        std::lock_guard<std::mutex> guard(lock_);
+        Slot &slot = slots_[hash % kSlots];
+        slot.used = true;
+        slot.hash = hash;
+        slot.create_info = *create_info;
+    }
+
+    // Of the memoizable calls, counted with khronos_validation.validation_counters
+    ValidationCounter hits;
+    ValidationCounter misses;
+
+  private:
+    static const size_t kSlots = 64;
+
+    struct Slot {
+        bool used = false;
+        size_t hash = 0;
+        CreateInfo create_info = {};
+    };
+
+    static bool Memoizable(const CreateInfo *create_info, const VkAllocationCallbacks *allocator, const void *created) {
+        return create_info && !create_info->pNext && !allocator && created && MemoizableCreateInfo(*create_info);
+    }
+
+    mutable std::mutex lock_;
+    mutable std::array<Slot, kSlots> slots_;
+};
+
 class StatelessValidation : public ValidationObject {
   public:
     VkPhysicalDeviceLimits device_limits = {};
@@ -102,6 +234,7 @@ class StatelessValidation : public ValidationObject {
     // This override takes a deferred lock. i.e. it is not acquired.
     ReadLockGuard ReadLock() override;
     WriteLockGuard WriteLock() override;
+    void GetValidationCounters(ValidationCounterList &counters) const override;
 
     // Device extension properties -- storing properties gathered from VkPhysicalDeviceProperties2::pNext chain
     struct DeviceExtensionProperties {
@@ -129,6 +262,10 @@ class StatelessValidation : public ValidationObject {
     mutable std::mutex renderpass_map_mutex;
     layer_data::unordered_map<VkRenderPass, SubpassesUsageStates> renderpasses_states;
 
+    CreateInfoMemo<VkBufferCreateInfo> buffer_create_info_memo;
+    CreateInfoMemo<VkImageViewCreateInfo> image_view_create_info_memo;
+    CreateInfoMemo<VkSamplerCreateInfo> sampler_create_info_memo;
+
     // Constructor for stateles validation tracking
     StatelessValidation() : device_createinfo_pnext(nullptr) { container_type = LayerObjectTypeParameterValidation; }
     ~StatelessValidation() {
@@ -559,9 +696,6 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != nullptr) {
-            layer_data::unordered_set<const void *> cycle_check;
-            layer_data::unordered_set<VkStructureType, layer_data::hash<int>> unique_stype_check;
-
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
@@ -575,22 +709,33 @@ class StatelessValidation : public ValidationObject {
             } else {
                 const VkStructureType *start = allowed_types;
                 const VkStructureType *end = allowed_types + allowed_type_count;
+                const bool is_create_instance = strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0;
+                const bool is_create_device = strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0;
+                // The structures seen so far: a bit for each of the first 64 allowed types, and a list of the others
+                uint64_t seen_allowed = 0;
+                small_vector<VkStructureType, 8, uint32_t> seen_other;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
                 while (current != nullptr) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end() &&
-                            !IsDuplicatePnext(current->sType)) {
+                    if ((!is_create_instance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
+                        (!is_create_device || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
+                        const VkStructureType *allowed = std::find(start, end, current->sType);
+                        const size_t allowed_index = static_cast<size_t>(allowed - start);
+                        bool duplicate = false;
+                        if ((allowed != end) && (allowed_index < 64)) {
+                            const uint64_t bit = 1ULL << allowed_index;
+                            duplicate = (seen_allowed & bit) != 0;
+                            seen_allowed |= bit;
+                        } else if (std::find(seen_other.begin(), seen_other.end(), current->sType) != seen_other.end()) {
+                            duplicate = true;
+                        } else {
+                            seen_other.emplace_back(current->sType);
+                        }
+                        if (duplicate && !IsDuplicatePnext(current->sType)) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                             std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                             skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                                                  string_VkStructureType(current->sType));
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
@@ -602,8 +747,9 @@ class StatelessValidation : public ValidationObject {
                             }
                         }
                         if (!custom) {
-                            if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                            if (allowed == end) {
+                                const char *type_name = string_VkStructureType(current->sType);
+                                if (UnsupportedStructureTypeString == type_name) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
@@ -617,8 +763,8 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid, is_physdev_api,
@@ -709,10 +855,10 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
-                              const std::vector<T> &valid_values, T value, const char *vuid) const {
+                              const ValidEnumValues<T> &valid_values, T value, const char *vuid) const {
         bool skip = false;
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
+        if (!valid_values.contains(value)) {
             skip |=
                 LogError(device, vuid,
                          "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
@@ -746,7 +892,7 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const ParameterName &countName, const ParameterName &arrayName,
-                                    const char *enumName, const std::vector<T> &valid_values, uint32_t count, const T *array,
+                                    const char *enumName, const ValidEnumValues<T> &valid_values, uint32_t count, const T *array,
                                     bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -755,7 +901,7 @@ class StatelessValidation : public ValidationObject {
                                         kVUIDUndefined);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!valid_values.contains(array[i])) {
                     skip_call |= LogError(device, kVUID_PVError_UnrecognizedValue,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
@@ -43,6 +43,8 @@ using IndexType = uint64_t;
 template <typename Element>
 using Range = sparse_container::range<Element>;
 using IndexRange = Range<IndexType>;
+// Holds every range of a typical subresource range (one per selected aspect and mip level) without allocating
+using IndexRangeBuffer = small_vector<IndexRange, 16, uint32_t>;
 using WritePolicy = sparse_container::value_precedence;
 using split_op_keep_both = sparse_container::split_op_keep_both;
 using split_op_keep_lower = sparse_container::split_op_keep_lower;
@@ -95,6 +97,7 @@ class RangeEncoder {
           decode_function_(nullptr),
           lower_bound_function_(nullptr),
           lower_bound_with_start_function_(nullptr),
+          generate_ranges_function_(nullptr),
           aspect_base_{0, 0, 0} {}
 
     // Create the encoder suitable to the full range (aspect mask *must* be canonical)
@@ -120,6 +123,14 @@ class RangeEncoder {
 
     Subresource Decode(const IndexType& index) const { return (this->*decode_function_)(index); }
 
+    // Replaces the contents of ranges with all of the index ranges of range, in increasing order, in one call. Matches the
+    // ranges RangeGenerator produces, except that ranges which abut (the whole of consecutive aspects) are merged.
+    inline void GenerateRanges(const VkImageSubresourceRange& range, IndexRangeBuffer& ranges) const {
+        assert(InRange(range));
+        ranges.clear();
+        (this->*(generate_ranges_function_))(range, ranges);
+    }
+
     inline Subresource BeginSubresource(const VkImageSubresourceRange& range) const {
         const auto aspect_index = LowerBoundFromMask(range.aspectMask);
         Subresource begin(aspect_bits_[aspect_index], range.baseMipLevel, range.baseArrayLayer, aspect_index);
@@ -226,6 +237,33 @@ class RangeEncoder {
                            aspect_index);
     }
 
+    // The aspect loop is unrolled by the compiler for the single aspect and depth/stencil encoders
+    template <uint32_t N>
+    void GenerateRangesImpl(const VkImageSubresourceRange& range, IndexRangeBuffer& ranges) const {
+        assert(limits_.aspect_index == N);
+        const bool all_layers = (range.baseArrayLayer == 0) && (range.layerCount == limits_.arrayLayer);
+        const IndexType mip_offset = range.baseMipLevel * mip_size_;
+        for (uint32_t aspect_index = 0; aspect_index < N; ++aspect_index) {
+            if (0 == (range.aspectMask & aspect_bits_[aspect_index])) continue;
+            // aspect_base_[0] is always zero
+            const IndexType aspect_begin = ((aspect_index == 0) ? 0 : aspect_base_[aspect_index]) + mip_offset;
+            if (all_layers) {
+                // All selected mip levels of the aspect are contiguous
+                const IndexType aspect_end = aspect_begin + range.levelCount * mip_size_;
+                if (!ranges.empty() && (ranges.back().end == aspect_begin)) {
+                    ranges.back().end = aspect_end;
+                } else {
+                    ranges.emplace_back(aspect_begin, aspect_end);
+                }
+            } else {
+                IndexType begin = aspect_begin + range.baseArrayLayer;
+                for (uint32_t mip_index = 0; mip_index < range.levelCount; ++mip_index, begin += mip_size_) {
+                    ranges.emplace_back(begin, begin + range.layerCount);
+                }
+            }
+        }
+    }
+
     uint32_t LowerBoundImpl1(VkImageAspectFlags aspect_mask) const;
     uint32_t LowerBoundImpl2(VkImageAspectFlags aspect_mask) const;
     uint32_t LowerBoundImpl3(VkImageAspectFlags aspect_mask) const;
@@ -245,6 +283,7 @@ class RangeEncoder {
     Subresource (RangeEncoder::*decode_function_)(const IndexType&) const;
     uint32_t (RangeEncoder::*lower_bound_function_)(VkImageAspectFlags aspect_mask) const;
     uint32_t (RangeEncoder::*lower_bound_with_start_function_)(VkImageAspectFlags aspect_mask, uint32_t start) const;
+    void (RangeEncoder::*generate_ranges_function_)(const VkImageSubresourceRange& range, IndexRangeBuffer& ranges) const;
     IndexType aspect_base_[kMaxSupportedAspect];
 };
 
@@ -356,7 +395,7 @@ class ImageRangeEncoder : public RangeEncoder {
     };
 
     // The default constructor for default iterators
-    ImageRangeEncoder() : image_(nullptr) {}
+    ImageRangeEncoder() = default;
 
     ImageRangeEncoder(const IMAGE_STATE& image, const AspectParameters* param);
     explicit ImageRangeEncoder(const IMAGE_STATE& image);
@@ -384,7 +423,6 @@ class ImageRangeEncoder : public RangeEncoder {
     using SubresInfoVector = std::vector<SubresInfo>;
 
   private:
-    const IMAGE_STATE* image_;
     std::vector<double> texel_sizes_;
     SubresInfoVector subres_info_;
     small_vector<IndexType, 4, uint32_t> aspect_sizes_;
@@ -603,7 +641,7 @@ class ConstMapView {
 enum BothRangeMapMode { kTristate, kSmall, kBig };
 template <typename T, size_t N>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
+    using BigMap = sparse_container::pooled_range_map<IndexType, T>;
     using RangeType = sparse_container::range<IndexType>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
@@ -794,6 +832,15 @@ class BothRangeMap {
         }
     }
 
+    inline size_t consolidate() {
+        if (SmallMode()) {
+            return sparse_container::consolidate(*small_map_);
+        } else {
+            assert(BigMode());
+            return sparse_container::consolidate(*big_map_);
+        }
+    }
+
     template <typename SplitOp>
     iterator split(const iterator whole_it, const index_type& index, const SplitOp& split_op) {
         assert(!Tristate());
@@ -0,0 +1,101 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Set of stage/access bits, one per SyncStageAccessIndex.
+//
+// Takes the place of std::bitset<128>, whose operators loop over an array of words the compiler can't always see through.
+// Here the bits are two 64 bit words, so the combining operators and tests every hazard check leans on come down to a pair of
+// word operations (or one vector operation) with no loop. The interface is the part of std::bitset that sync validation uses.
+class SyncStageAccessFlags {
+  public:
+    static constexpr size_t kBitCount = 128;
+
+    constexpr SyncStageAccessFlags() : low_(0), high_(0) {}
+    // Implicit, as with std::bitset, so that 0 and 1 can be used as flag values
+    constexpr SyncStageAccessFlags(unsigned long long low) : low_(low), high_(0) {}
+
+    constexpr size_t size() const { return kBitCount; }
+    constexpr bool any() const { return (low_ | high_) != 0; }
+    constexpr bool none() const { return (low_ | high_) == 0; }
+    constexpr bool test(size_t pos) const {
+        return (pos < 64) ? (((low_ >> pos) & 1) != 0) : (((high_ >> (pos - 64)) & 1) != 0);
+    }
+    SyncStageAccessFlags &reset() {
+        low_ = 0;
+        high_ = 0;
+        return *this;
+    }
+
+    constexpr SyncStageAccessFlags operator~() const { return SyncStageAccessFlags(~low_, ~high_, Words()); }
+    constexpr SyncStageAccessFlags operator<<(size_t shift) const {
+        return (shift == 0)    ? *this
+               : (shift < 64)  ? SyncStageAccessFlags(low_ << shift, (high_ << shift) | (low_ >> (64 - shift)), Words())
+               : (shift < 128) ? SyncStageAccessFlags(0, low_ << (shift - 64), Words())
+                               : SyncStageAccessFlags();
+    }
+
+    friend constexpr SyncStageAccessFlags operator&(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.low_ & rhs.low_, lhs.high_ & rhs.high_, Words());
+    }
+    friend constexpr SyncStageAccessFlags operator|(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.low_ | rhs.low_, lhs.high_ | rhs.high_, Words());
+    }
+    friend constexpr SyncStageAccessFlags operator^(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.low_ ^ rhs.low_, lhs.high_ ^ rhs.high_, Words());
+    }
+    friend constexpr bool operator==(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return (lhs.low_ == rhs.low_) && (lhs.high_ == rhs.high_);
+    }
+    friend constexpr bool operator!=(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) { return !(lhs == rhs); }
+
+    SyncStageAccessFlags &operator&=(const SyncStageAccessFlags &rhs) {
+        low_ &= rhs.low_;
+        high_ &= rhs.high_;
+        return *this;
+    }
+    SyncStageAccessFlags &operator|=(const SyncStageAccessFlags &rhs) {
+        low_ |= rhs.low_;
+        high_ |= rhs.high_;
+        return *this;
+    }
+    SyncStageAccessFlags &operator^=(const SyncStageAccessFlags &rhs) {
+        low_ ^= rhs.low_;
+        high_ ^= rhs.high_;
+        return *this;
+    }
+
+    size_t Hash() const { return std::hash<uint64_t>()(low_ ^ (high_ * 0x9E3779B97F4A7C15ULL)); }
+
+  private:
+    struct Words {};
+    constexpr SyncStageAccessFlags(uint64_t low, uint64_t high, Words) : low_(low), high_(high) {}
+
+    uint64_t low_;
+    uint64_t high_;
+};
+
+namespace std {
+template <>
+struct hash<SyncStageAccessFlags> {
+    size_t operator()(const SyncStageAccessFlags &flags) const { return flags.Hash(); }
+};
+}  // namespace std
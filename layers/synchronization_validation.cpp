@@ -19,10 +19,10 @@
  * Author: Jeremy Gebben <jeremyg@lunarg.com>
  */
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 #include <memory>
-#include <bitset>
 #include "synchronization_validation.h"
 #include "sync_utils.h"
 
@@ -184,6 +184,58 @@ static std::string string_UsageIndex(SyncStageAccessIndex usage_index) {
     return std::string(stage_access_name);
 }
 
+ResourceUsageRecord AccessLog::operator[](ResourceUsageTag tag) const {
+    assert(tag < size_);
+    // Lookups are mostly for recent tags, so try the last chunk before searching
+    auto found = chunks_.end() - 1;
+    if (tag < found->begin) {
+        found = std::upper_bound(chunks_.begin(), chunks_.end(), tag,
+                                 [](ResourceUsageTag value, const ChunkRef &ref) { return value < ref.begin; }) -
+                1;
+    }
+    const Chunk &chunk = *found->chunk;
+    const uint64_t packed = chunk.records[tag - found->begin];
+    const Count sub_command_mask = (1U << kSubCommandBits) - 1;
+    return ResourceUsageRecord(static_cast<CMD_TYPE>(packed & ((1U << kCommandBits) - 1)), static_cast<Count>(packed >> 32),
+                               static_cast<Count>(packed >> kCommandBits) & sub_command_mask, chunk.cb_state, chunk.reset_count);
+}
+
+void AccessLog::emplace_back(CMD_TYPE command, Count seq_num, Count sub_command, const CMD_BUFFER_STATE *cb_state,
+                             Count reset_count) {
+    // Shared chunks are immutable, so start a new one rather than adding to them
+    if (chunks_.empty() || (chunks_.back().chunk.use_count() > 1) || (chunks_.back().chunk->cb_state != cb_state) ||
+        (chunks_.back().chunk->reset_count != reset_count)) {
+        ChunkRef ref;
+        ref.begin = size_;
+        ref.chunk = std::make_shared<Chunk>(cb_state, reset_count);
+        chunks_.emplace_back(std::move(ref));
+    }
+    const Count max_sub_command = (1U << kSubCommandBits) - 1;
+    const uint64_t packed = (static_cast<uint64_t>(seq_num) << 32) |
+                            (static_cast<uint64_t>(std::min(sub_command, max_sub_command)) << kCommandBits) |
+                            static_cast<uint64_t>(command);
+    chunks_.back().chunk->records.emplace_back(packed);
+    size_++;
+}
+
+void AccessLog::Append(const AccessLog &other) {
+    for (const auto &other_ref : other.chunks_) {
+        ChunkRef ref;
+        ref.begin = size_ + other_ref.begin;
+        ref.chunk = other_ref.chunk;
+        chunks_.emplace_back(std::move(ref));
+    }
+    size_ += other.size_;
+}
+
+size_t AccessLog::DynamicMemoryUsage() const {
+    size_t bytes = VectorMemoryUsage(chunks_);
+    for (const auto &ref : chunks_) {
+        bytes += (sizeof(Chunk) + VectorMemoryUsage(ref.chunk->records)) / static_cast<size_t>(ref.chunk.use_count());
+    }
+    return bytes;
+}
+
 struct NoopBarrierAction {
     explicit NoopBarrierAction() {}
     void operator()(ResourceAccessState *access) const {}
@@ -197,7 +249,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     cb_state_ = from.cb_state_;
     queue_flags_ = from.queue_flags_;
     destroyed_ = from.destroyed_;
-    access_log_ = from.access_log_;  // potentially large, but no choice given tagging lookup.
+    access_log_ = std::make_shared<AccessLog>(*from.access_log_);  // shares the record chunks, the copy is only of the index
     command_number_ = from.command_number_;
     subcommand_number_ = from.subcommand_number_;
     reset_count_ = from.reset_count_;
@@ -221,8 +273,8 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
 
 std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag) const {
     std::stringstream out;
-    assert(tag < access_log_.size());
-    const auto &record = access_log_[tag];
+    assert(tag < access_log_->size());
+    const auto &record = (*access_log_)[tag];
     out << string_UsageTag(record);
     if (record.cb_state != cb_state_.get()) {
         out << ", command_buffer: " << sync_state_->report_data->FormatHandle(record.cb_state->commandBuffer()).c_str();
@@ -243,11 +295,10 @@ std::string CommandBufferAccessContext::FormatUsage(const ResourceFirstAccess &a
     return out.str();
 }
 
-std::string CommandBufferAccessContext::FormatUsage(const HazardResult &hazard) const {
-    const auto &tag = hazard.tag;
+// Everything about the hazard but the tag of the prior access, which only the context that assigned the tag can describe
+static void FormatHazardState(const HazardResult &hazard, std::stringstream &out) {
     assert(hazard.usage_index < static_cast<SyncStageAccessIndex>(syncStageAccessInfoByStageAccessIndex.size()));
     const auto &usage_info = syncStageAccessInfoByStageAccessIndex[hazard.usage_index];
-    std::stringstream out;
     const auto *info = SyncStageAccessInfoFromMask(hazard.prior_access);
     const char *stage_access_name = info ? info->name : "INVALID_STAGE_ACCESS";
     out << "(";
@@ -263,9 +314,13 @@ std::string CommandBufferAccessContext::FormatUsage(const HazardResult &hazard)
         SyncStageAccessFlags write_barrier = hazard.access_state->GetWriteBarriers();
         out << ", write_barriers: " << string_SyncStageAccessFlags(write_barrier);
     }
+}
 
-    if (tag < access_log_.size()) {
-        out << ", " << FormatUsage(tag) << ")";
+std::string CommandBufferAccessContext::FormatUsage(const HazardResult &hazard) const {
+    std::stringstream out;
+    FormatHazardState(hazard, out);
+    if (hazard.tag < access_log_->size()) {
+        out << ", " << FormatUsage(hazard.tag) << ")";
     }
     return out.str();
 }
@@ -288,7 +343,9 @@ static const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
 static constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
 static const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
-ResourceAccessState::OrderingBarriers ResourceAccessState::kOrderingRules = {
+ResourceAccessStateData ResourceAccessState::kDefaultData;
+
+ResourceAccessStateData::OrderingBarriers ResourceAccessStateData::kOrderingRules = {
     {{VK_PIPELINE_STAGE_2_NONE_KHR, SyncStageAccessFlags()},
      {kColorAttachmentExecScope, kColorAttachmentAccessScope},
      {kDepthStencilAttachmentExecScope, kDepthStencilAttachmentAccessScope},
@@ -299,6 +356,12 @@ static const ResourceUsageTag kCurrentCommandTag(ResourceUsageRecord::kMaxIndex)
 
 static VkDeviceSize ResourceBaseAddress(const BINDABLE &bindable) { return bindable.GetFakeBaseAddress(); }
 
+// All of the addresses the subresources of image may be given
+static ResourceAccessRange ImageAddressSpan(const IMAGE_STATE &image) {
+    const auto base_address = ResourceBaseAddress(image);
+    return ResourceAccessRange(base_address, base_address + image.fragment_encoder->TotalSize());
+}
+
 inline VkDeviceSize GetRealWholeSize(VkDeviceSize offset, VkDeviceSize size, VkDeviceSize whole_size) {
     if (size == VK_WHOLE_SIZE) {
         return (whole_size - offset);
@@ -354,6 +417,32 @@ class SingleRangeGenerator {
     KeyType current_;
 };
 
+// A wrapper for prebuilt ranges relative to a base address, e.g. IMAGE_VIEW_STATE::fragment_ranges, with the same semantics
+class OffsetRangesGenerator {
+  public:
+    OffsetRangesGenerator(const std::vector<ResourceAccessRange> &ranges, VkDeviceSize base_address)
+        : pos_(ranges.cbegin()), end_(ranges.cend()), base_address_(base_address) {
+        SetCurrent();
+    }
+    const ResourceAccessRange &operator*() const { return current_; }
+    const ResourceAccessRange *operator->() const { return &current_; }
+    OffsetRangesGenerator &operator++() {
+        ++pos_;
+        SetCurrent();
+        return *this;
+    }
+
+  private:
+    void SetCurrent() {
+        current_ = (pos_ != end_) ? ResourceAccessRange(pos_->begin + base_address_, pos_->end + base_address_)
+                                  : ResourceAccessRange();
+    }
+    std::vector<ResourceAccessRange>::const_iterator pos_;
+    std::vector<ResourceAccessRange>::const_iterator end_;
+    VkDeviceSize base_address_;
+    ResourceAccessRange current_;
+};
+
 // Generate the ranges that are the intersection of range and the entries in the RangeMap
 template <typename RangeMap, typename KeyType = typename RangeMap::key_type>
 class MapRangesRangeGenerator {
@@ -718,9 +807,9 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
-void HazardResult::Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
+void HazardResult::Set(const ResourceAccessStateData *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
                        const SyncStageAccessFlags &prior_, const ResourceUsageTag tag_) {
-    access_state = layer_data::make_unique<const ResourceAccessState>(*access_state_);
+    access_state = layer_data::make_unique<const ResourceAccessState>(access_state_);
     usage_index = usage_index_;
     hazard = hazard_;
     prior_access = prior_;
@@ -731,19 +820,17 @@ void HazardResult::AddRecordedAccess(const ResourceFirstAccess &first_access) {
     recorded_access = layer_data::make_unique<const ResourceFirstAccess>(first_access);
 }
 
-AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
-                             const std::vector<SubpassDependencyGraphNode> &dependencies,
-                             const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
+AccessContext::AccessContext(uint32_t subpass, const SubpassDependencyGraphNode &subpass_dep,
+                             const SyncRenderPassState::SubpassBarriers &barriers, const std::vector<AccessContext> &contexts,
+                             const AccessContext *external_context) {
     Reset();
-    const auto &subpass_dep = dependencies[subpass];
-    bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
-    prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
+    bool has_barrier_from_external = barriers.from_external.size() > 0U;
+    prev_.reserve(barriers.prev.size() + (has_barrier_from_external ? 1U : 0U));
     prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
-    for (const auto &prev_dep : subpass_dep.prev) {
-        const auto prev_pass = prev_dep.first->pass;
-        const auto &prev_barriers = prev_dep.second;
+    for (const auto &prev_dep : barriers.prev) {
+        const auto prev_pass = prev_dep.first;
         assert(prev_dep.second.size());
-        prev_.emplace_back(&contexts[prev_pass], queue_flags, prev_barriers);
+        prev_.emplace_back(&contexts[prev_pass], prev_dep.second);
         prev_by_subpass_[prev_pass] = &prev_.back();
     }
 
@@ -753,11 +840,11 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
     }
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
-        prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
+        prev_.emplace_back(external_context, barriers.from_external);
         src_external_ = &prev_.back();
     }
-    if (subpass_dep.barrier_to_external.size()) {
-        dst_external_ = TrackBack(this, queue_flags, subpass_dep.barrier_to_external);
+    if (barriers.to_external.size()) {
+        dst_external_ = TrackBack(this, barriers.to_external);
     }
 }
 
@@ -774,6 +861,59 @@ HazardResult AccessContext::DetectPreviousHazard(AccessAddressType type, const D
     return hazard;
 }
 
+void AccessContext::ApplyPendingGlobalBarriersForDetection() const {
+    ApplyPendingGlobalBarriers();
+    for (const auto &prev : prev_) {
+        if (prev.context) prev.context->ApplyPendingGlobalBarriersForDetection();
+    }
+    for (const auto *async : async_) {
+        async->ApplyPendingGlobalBarriersForDetection();
+    }
+}
+
+size_t AccessContext::Coarsen(VkDeviceSize granularity) {
+    ApplyPendingGlobalBarriers();
+    NoteChange();
+    size_t removed = 0;
+    for (auto &map : access_state_maps_) {
+        removed += sparse_container::coarsen(
+            map, granularity, [](ResourceAccessState &into, const ResourceAccessState &from) { into.Resolve(from); });
+    }
+    return removed;
+}
+
+void AccessContext::ApplyGlobalBarrierSets() const {
+    std::vector<GlobalBarrierSet> barrier_sets;
+    std::swap(barrier_sets, pending_global_barriers_);
+    for (auto &accesses : access_state_maps_) {
+        // As in ApplyBarrierOpsFunctor, ranges that shared a state share the result
+        ResourceAccessState last_shared;
+        ResourceAccessState last_applied;
+        bool has_last = false;
+        for (auto &access : accesses) {
+            auto &access_state = access.second;
+            const bool shared = access_state.IsShared();
+            if (shared) {
+                if (has_last && access_state.SharesData(last_shared)) {
+                    access_state = last_applied;
+                    continue;
+                }
+                last_shared = access_state;
+            }
+            for (const auto &barrier_set : barrier_sets) {
+                for (const auto &barrier : barrier_set.barriers) {
+                    access_state.ApplyBarrier(barrier, false);
+                }
+                access_state.ApplyPendingBarriers(barrier_set.tag);
+            }
+            if (shared) {
+                last_applied = access_state;
+                has_last = true;
+            }
+        }
+    }
+}
+
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
     for (const auto address_type : kAddressTypes) {
@@ -1336,6 +1476,20 @@ HazardResult AccessContext::DetectHazard(const IMAGE_STATE &image, SyncStageAcce
     return DetectHazard(detector, image, subresource_range, DetectOptions::kDetectAll);
 }
 
+HazardResult AccessContext::DetectHazard(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage) const {
+    const IMAGE_STATE &image = *view.image_state;
+    if (view.fragment_ranges.empty()) return DetectHazard(image, current_usage, view.normalized_subresource_range);
+    if (!SimpleBinding(image)) return HazardResult();
+    HazardDetector detector(current_usage);
+    OffsetRangesGenerator range_gen(view.fragment_ranges, ResourceBaseAddress(image));
+    const auto address_type = ImageAddressType(image);
+    for (; range_gen->non_empty(); ++range_gen) {
+        HazardResult hazard = DetectHazard(address_type, detector, *range_gen, DetectOptions::kDetectAll);
+        if (hazard.hazard) return hazard;
+    }
+    return HazardResult();
+}
+
 HazardResult AccessContext::DetectHazard(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                          SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const {
     HazardDetectorWithOrdering detector(current_usage, ordering_rule);
@@ -1468,8 +1622,56 @@ SyncStageAccessFlags SyncStageAccess::AccessScopeByStage(VkPipelineStageFlags2KH
     return AccessScopeImpl(stages, syncStageAccessMaskByStageBit);
 }
 
+namespace {
+// Barrier translation depends only on the masks translated, and applications record the same few barrier patterns over and
+// over, so each thread remembers recent translations in small direct mapped caches, indexed by a hash of the masks.
+struct ExecScopeCacheEntry {
+    bool valid = false;
+    bool is_src = false;
+    VkQueueFlags queue_flags = 0;
+    VkPipelineStageFlags2KHR mask_param = 0;
+    SyncExecScope scope;
+};
+struct AccessScopeCacheEntry {
+    bool valid = false;
+    VkAccessFlags2KHR accesses = 0;
+    SyncStageAccessFlags scope;
+};
+const uint32_t kBarrierCacheSlotBits = 6;
+thread_local ExecScopeCacheEntry exec_scope_cache[1U << kBarrierCacheSlotBits];
+thread_local AccessScopeCacheEntry access_scope_cache[1U << kBarrierCacheSlotBits];
+
+uint32_t BarrierCacheSlot(uint64_t value) {
+    return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ULL) >> (64 - kBarrierCacheSlotBits));
+}
+
+const SyncExecScope &CachedExecScope(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param, bool is_src) {
+    const uint64_t hashed = mask_param ^ (static_cast<uint64_t>(queue_flags) << 48) ^ (is_src ? (1ULL << 63) : 0);
+    auto &entry = exec_scope_cache[BarrierCacheSlot(hashed)];
+    if (!entry.valid || (entry.is_src != is_src) || (entry.queue_flags != queue_flags) || (entry.mask_param != mask_param)) {
+        SyncExecScope &result = entry.scope;
+        result.mask_param = mask_param;
+        result.expanded_mask = sync_utils::ExpandPipelineStages(mask_param, queue_flags);
+        result.exec_scope = is_src ? sync_utils::WithEarlierPipelineStages(result.expanded_mask)
+                                   : sync_utils::WithLaterPipelineStages(result.expanded_mask);
+        result.valid_accesses = SyncStageAccess::AccessScopeByStage(result.exec_scope);
+        entry.valid = true;
+        entry.is_src = is_src;
+        entry.queue_flags = queue_flags;
+        entry.mask_param = mask_param;
+    }
+    return entry.scope;
+}
+}  // namespace
+
 SyncStageAccessFlags SyncStageAccess::AccessScopeByAccess(VkAccessFlags2KHR accesses) {
-    return AccessScopeImpl(sync_utils::ExpandAccessFlags(accesses), syncStageAccessMaskByAccessBit);
+    auto &entry = access_scope_cache[BarrierCacheSlot(accesses)];
+    if (!entry.valid || (entry.accesses != accesses)) {
+        entry.scope = AccessScopeImpl(sync_utils::ExpandAccessFlags(accesses), syncStageAccessMaskByAccessBit);
+        entry.valid = true;
+        entry.accesses = accesses;
+    }
+    return entry.scope;
 }
 
 // Getting from stage mask and access mask to stage/access masks is something we need to be good at...
@@ -1482,41 +1684,8 @@ SyncStageAccessFlags SyncStageAccess::AccessScope(VkPipelineStageFlags2KHR stage
 
 template <typename Action>
 void UpdateMemoryAccessState(ResourceAccessRangeMap *accesses, const ResourceAccessRange &range, const Action &action) {
-    // TODO: Optimization for operations that do a pure overwrite (i.e. WRITE usages which rewrite the state, vs READ usages
-    //       that do incrementalupdates
     assert(accesses);
-    auto pos = accesses->lower_bound(range);
-    if (pos == accesses->end() || !pos->first.intersects(range)) {
-        // The range is empty, fill it with a default value.
-        pos = action.Infill(accesses, pos, range);
-    } else if (range.begin < pos->first.begin) {
-        // Leading empty space, infill
-        pos = action.Infill(accesses, pos, ResourceAccessRange(range.begin, pos->first.begin));
-    } else if (pos->first.begin < range.begin) {
-        // Trim the beginning if needed
-        pos = accesses->split(pos, range.begin, sparse_container::split_op_keep_both());
-        ++pos;
-    }
-
-    const auto the_end = accesses->end();
-    while ((pos != the_end) && pos->first.intersects(range)) {
-        if (pos->first.end > range.end) {
-            pos = accesses->split(pos, range.end, sparse_container::split_op_keep_both());
-        }
-
-        pos = action(accesses, pos);
-        if (pos == the_end) break;
-
-        auto next = pos;
-        ++next;
-        if ((pos->first.end < range.end) && (next != the_end) && !next->first.is_subsequent_to(pos->first)) {
-            // Need to infill if next is disjoint
-            VkDeviceSize limit = (next == the_end) ? range.end : std::min(range.end, next->first.begin);
-            ResourceAccessRange new_range(pos->first.end, limit);
-            next = action.Infill(accesses, next, new_range);
-        }
-        pos = next;
-    }
+    sparse_container::infill_update_range(*accesses, range, action);
 }
 
 // Give a comparable interface for range generators and ranges
@@ -1553,18 +1722,32 @@ struct UpdateMemoryAccessStateFunctor {
 
     Iterator operator()(ResourceAccessRangeMap *accesses, Iterator pos) const {
         auto &access_state = pos->second;
-        access_state.Update(usage, ordering_rule, tag);
+        if (!access_state.IsShared()) {
+            access_state.Update(usage, ordering_rule, tag);
+        } else if (has_last_ && access_state.SharesData(last_shared_)) {
+            // Another range of the same state, which the update leaves the same as the last one
+            access_state = last_updated_;
+        } else {
+            last_shared_ = access_state;
+            access_state.Update(usage, ordering_rule, tag);
+            last_updated_ = access_state;
+            has_last_ = true;
+        }
         return pos;
     }
 
     UpdateMemoryAccessStateFunctor(AccessAddressType type_, const AccessContext &context_, SyncStageAccessIndex usage_,
                                    SyncOrdering ordering_rule_, ResourceUsageTag tag_)
-        : type(type_), context(context_), usage(usage_), ordering_rule(ordering_rule_), tag(tag_) {}
+        : type(type_), context(context_), usage(usage_), ordering_rule(ordering_rule_), tag(tag_), has_last_(false) {}
     const AccessAddressType type;
     const AccessContext &context;
     const SyncStageAccessIndex usage;
     const SyncOrdering ordering_rule;
     const ResourceUsageTag tag;
+    // The last shared state updated, and the result, so that ranges sharing a state before the update still share it after
+    mutable ResourceAccessState last_shared_;
+    mutable ResourceAccessState last_updated_;
+    mutable bool has_last_;
 };
 
 // The barrier operation for pipeline and subpass dependencies`
@@ -1607,6 +1790,15 @@ class ApplyBarrierOpsFunctor {
 
     Iterator operator()(ResourceAccessRangeMap *accesses, const Iterator &pos) const {
         auto &access_state = pos->second;
+        const bool shared = access_state.IsShared();
+        if (shared) {
+            // As in UpdateMemoryAccessStateFunctor, ranges that shared a state share the result
+            if (has_last_ && access_state.SharesData(last_shared_)) {
+                access_state = last_applied_;
+                return pos;
+            }
+            last_shared_ = access_state;
+        }
         for (const auto &op : barrier_ops_) {
             op(&access_state);
         }
@@ -1616,17 +1808,22 @@ class ApplyBarrierOpsFunctor {
             // another walk
             access_state.ApplyPendingBarriers(tag_);
         }
+        if (shared) {
+            last_applied_ = access_state;
+            has_last_ = true;
+        }
         return pos;
     }
 
     // A valid tag is required IFF layout_transition is true, as transitions are write ops
     ApplyBarrierOpsFunctor(bool resolve, typename OpVector::size_type size_hint, ResourceUsageTag tag)
-        : resolve_(resolve), infill_default_(false), barrier_ops_(), tag_(tag) {
+        : resolve_(resolve), infill_default_(false), barrier_ops_(), tag_(tag), has_last_(false) {
         barrier_ops_.reserve(size_hint);
     }
     void EmplaceBack(const BarrierOp &op) {
         barrier_ops_.emplace_back(op);
         infill_default_ |= op.layout_transition;
+        has_last_ = false;
     }
 
   private:
@@ -1634,6 +1831,9 @@ class ApplyBarrierOpsFunctor {
     bool infill_default_;
     OpVector barrier_ops_;
     const ResourceUsageTag tag_;
+    mutable ResourceAccessState last_shared_;
+    mutable ResourceAccessState last_applied_;
+    mutable bool has_last_;
 };
 
 // This functor applies a single barrier, updating the "pending state" in each touched memory range, but does not
@@ -1657,7 +1857,7 @@ class ResolvePendingBarrierFunctor : public ApplyBarrierOpsFunctor<NoopBarrierAc
 void AccessContext::UpdateAccessState(AccessAddressType type, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const ResourceAccessRange &range, const ResourceUsageTag tag) {
     UpdateMemoryAccessStateFunctor action(type, *this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessState(&GetAccessStateMap(type), range, action);
+    UpdateMemoryAccessState(&GetAccessStateMapForUpdate(type, range), range, action);
 }
 
 void AccessContext::UpdateAccessState(const BUFFER_STATE &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -1674,7 +1874,20 @@ void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessI
     subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, base_address);
     const auto address_type = ImageAddressType(image);
     UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessState(&GetAccessStateMap(address_type), action, &range_gen);
+    UpdateMemoryAccessState(&GetAccessStateMapForUpdate(address_type, ImageAddressSpan(image)), action, &range_gen);
+}
+void AccessContext::UpdateAccessState(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                                      const ResourceUsageTag &tag) {
+    const IMAGE_STATE &image = *view.image_state;
+    if (view.fragment_ranges.empty()) {
+        UpdateAccessState(image, current_usage, ordering_rule, view.normalized_subresource_range, tag);
+        return;
+    }
+    if (!SimpleBinding(image)) return;
+    OffsetRangesGenerator range_gen(view.fragment_ranges, ResourceBaseAddress(image));
+    const auto address_type = ImageAddressType(image);
+    UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
+    UpdateMemoryAccessState(&GetAccessStateMapForUpdate(address_type, ImageAddressSpan(image)), action, &range_gen);
 }
 void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
@@ -1685,7 +1898,7 @@ void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessI
                                                        base_address);
     const auto address_type = ImageAddressType(image);
     UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessState(&GetAccessStateMap(address_type), action, &range_gen);
+    UpdateMemoryAccessState(&GetAccessStateMapForUpdate(address_type, ImageAddressSpan(image)), action, &range_gen);
 }
 
 void AccessContext::UpdateAccessState(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
@@ -1695,7 +1908,8 @@ void AccessContext::UpdateAccessState(const AttachmentViewGen &view_gen, Attachm
     subresource_adapter::ImageRangeGenerator range_gen(*gen);
     const auto address_type = view_gen.GetAddressType();
     UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
-    ApplyUpdateAction(address_type, action, &range_gen);
+    const auto &image = *view_gen.GetViewState()->image_state;
+    UpdateMemoryAccessState(&GetAccessStateMapForUpdate(address_type, ImageAddressSpan(image)), action, &range_gen);
 }
 
 void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -1834,20 +2048,55 @@ void CommandBufferAccessContext::ApplyGlobalBarriersToEvents(const SyncExecScope
     events_context->ApplyBarrier(src, dst);
 }
 
-bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
-                                                                   const char *func_name) const {
-    bool skip = false;
+// Commands with fewer hazard checks than this aren't worth handing to the worker threads
+static constexpr uint32_t kMinParallelHazardChecks = 128;
+static constexpr uint32_t kHazardChecksPerTask = 32;
+
+// The hazard checks of one command, such as the regions of a copy or the descriptors of a draw, by index.
+//
+// When there are many of them and parallel_sync_hazard_detection is set, all of them are detected up front on the validation
+// batch pool. Otherwise each one is detected when it's taken, just as the loop taking them always did. The caller reports the
+// hazards in index order either way, so the errors and the point at which reporting stops don't depend on the setting.
+class HazardDetectionBatch {
+  public:
+    using Detect = std::function<HazardResult(uint32_t index)>;
+
+    HazardDetectionBatch(const SyncValidator &sync_state, const AccessContext &context, uint32_t count, Detect &&detect)
+        : detect_(std::move(detect)) {
+        if (count < kMinParallelHazardChecks || !sync_state.CanRunSyncHazardBatch()) return;
+
+        context.ApplyPendingGlobalBarriersForDetection();
+        results_.resize(count);
+        const uint32_t task_count = (count + kHazardChecksPerTask - 1) / kHazardChecksPerTask;
+        sync_state.RunSyncHazardBatch(task_count, [this, count](uint32_t task) {
+            const uint32_t end = std::min(count, (task + 1) * kHazardChecksPerTask);
+            for (uint32_t index = task * kHazardChecksPerTask; index < end; ++index) {
+                results_[index] = detect_(index);
+            }
+            return false;
+        });
+    }
+
+    HazardResult Take(uint32_t index) {
+        if (results_.empty()) return detect_(index);
+        return std::move(results_[index]);
+    }
+
+  private:
+    Detect detect_;
+    std::vector<HazardResult> results_;
+};
+
+const PIPELINE_STATE *CommandBufferAccessContext::GetDescriptorAccesses(VkPipelineBindPoint pipelineBindPoint,
+                                                                         std::vector<DescriptorAccess> &accesses) const {
     const PIPELINE_STATE *pipe = nullptr;
-    const std::vector<LAST_BOUND_STATE::PER_SET> *per_sets = nullptr;
+    const LAST_BOUND_STATE::PerSets *per_sets = nullptr;
     cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
     if (!pipe || !per_sets) {
-        return skip;
+        return nullptr;
     }
 
     using DescriptorClass = cvdescriptorset::DescriptorClass;
-    using BufferDescriptor = cvdescriptorset::BufferDescriptor;
-    using ImageDescriptor = cvdescriptorset::ImageDescriptor;
-    using TexelDescriptor = cvdescriptorset::TexelDescriptor;
 
     for (const auto &stage_state : pipe->stage_state) {
         const auto raster_state = pipe->RasterizationState();
@@ -1860,7 +2109,6 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                                                                                   set_binding.first.binding);
             const auto descriptor_type = binding_it.GetType();
             cvdescriptorset::IndexRange index_range = binding_it.GetGlobalIndexRange();
-            auto array_idx = 0;
 
             if (binding_it.IsVariableDescriptorCount()) {
                 index_range.end = index_range.start + descriptor_set->GetVariableDescriptorCount();
@@ -1868,100 +2116,18 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             SyncStageAccessIndex sync_index =
                 GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, set_binding.second, stage_state.stage_flag);
 
-            for (uint32_t i = index_range.start; i < index_range.end; ++i, ++array_idx) {
-                uint32_t index = i - index_range.start;
+            for (uint32_t i = index_range.start; i < index_range.end; ++i) {
                 const auto *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
                 switch (descriptor->GetClass()) {
                     case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
-
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
-                        HazardResult hazard;
-                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                        // Descriptors, so we do not have to worry about depth slicing here.
-                        // See: VUID 00343
-                        assert(!img_view_state->IsDepthSliced());
-                        const IMAGE_STATE *img_state = img_view_state->image_state.get();
-                        const auto &subresource_range = img_view_state->normalized_subresource_range;
-
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard = current_context_->DetectHazard(*img_state, sync_index, subresource_range,
-                                                                    SyncOrdering::kRaster, offset, extent);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_state, sync_index, subresource_range);
-                        }
-
-                        if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                img_view_state->image_view(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                func_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(img_view_state->image_view()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                set_binding.first.binding, index, FormatUsage(hazard).c_str());
+                    case DescriptorClass::Image:
+                    case DescriptorClass::TexelBuffer:
+                    case DescriptorClass::GeneralBuffer:
+                        if (!descriptor->Invalid()) {
+                            accesses.push_back(DescriptorAccess{descriptor, descriptor_set, descriptor_type, sync_index,
+                                                                set_binding.first.binding, i - index_range.start});
                         }
                         break;
-                    }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                buf_view_state->buffer_view(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                func_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(buf_view_state->buffer_view()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), set_binding.first.binding, index,
-                                FormatUsage(hazard).c_str());
-                        }
-                        break;
-                    }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                func_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), set_binding.first.binding, index,
-                                FormatUsage(hazard).c_str());
-                        }
-                        break;
-                    }
                     // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
                     default:
                         break;
@@ -1969,157 +2135,379 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             }
         }
     }
+    return pipe;
+}
+
+bool CommandBufferAccessContext::DescriptorAccessKey::operator==(const DescriptorAccessKey &rhs) const {
+    return (span.type == rhs.span.type) && (span.range == rhs.span.range) && (sync_index == rhs.sync_index) &&
+           (subresource_range.aspectMask == rhs.subresource_range.aspectMask) &&
+           (subresource_range.baseMipLevel == rhs.subresource_range.baseMipLevel) &&
+           (subresource_range.levelCount == rhs.subresource_range.levelCount) &&
+           (subresource_range.baseArrayLayer == rhs.subresource_range.baseArrayLayer) &&
+           (subresource_range.layerCount == rhs.subresource_range.layerCount);
+}
+
+bool CommandBufferAccessContext::MakeDescriptorAccessKeys(const std::vector<DescriptorAccess> &accesses,
+                                                          std::vector<DescriptorAccessKey> &keys) {
+    using DescriptorClass = cvdescriptorset::DescriptorClass;
+    using BufferDescriptor = cvdescriptorset::BufferDescriptor;
+    using ImageDescriptor = cvdescriptorset::ImageDescriptor;
+    using TexelDescriptor = cvdescriptorset::TexelDescriptor;
+
+    const VkImageSubresourceRange no_subresources = {0, 0, 0, 0, 0};
+    keys.reserve(accesses.size());
+    for (const auto &access : accesses) {
+        if (!SyncStageAccess::IsRead(access.sync_index)) return false;
+        switch (access.descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                const auto *img_view_state = static_cast<const ImageDescriptor *>(access.descriptor)->GetImageViewState();
+                const auto &image = *img_view_state->image_state;
+                if (!image.fragment_encoder) return false;
+                const AccessContext::AccessSpan span(AccessContext::ImageAddressType(image), ImageAddressSpan(image));
+                keys.push_back(DescriptorAccessKey{span, img_view_state->normalized_subresource_range, access.sync_index});
+                break;
+            }
+            case DescriptorClass::TexelBuffer: {
+                const auto *buf_view_state = static_cast<const TexelDescriptor *>(access.descriptor)->GetBufferViewState();
+                const auto range = MakeRange(*buf_view_state) + ResourceBaseAddress(*buf_view_state->buffer_state);
+                keys.push_back(DescriptorAccessKey{AccessContext::AccessSpan(AccessAddressType::kLinear, range), no_subresources,
+                                                   access.sync_index});
+                break;
+            }
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(access.descriptor);
+                const auto *buf_state = buffer_descriptor->GetBufferState();
+                const auto range = MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange()) +
+                                   ResourceBaseAddress(*buf_state);
+                keys.push_back(DescriptorAccessKey{AccessContext::AccessSpan(AccessAddressType::kLinear, range), no_subresources,
+                                                   access.sync_index});
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool CommandBufferAccessContext::IsMemoCurrent(const DescriptorAccessMemo &memo,
+                                               const std::vector<DescriptorAccessKey> &keys) const {
+    if (memo.context != current_context_ || memo.generation != current_context_->GetChangeGeneration() || !(memo.keys == keys)) {
+        return false;
+    }
+    const auto &spans = current_context_->GetUpdatedSpans();
+    for (size_t i = memo.span_count; i < spans.size(); ++i) {
+        for (const auto &key : keys) {
+            if (spans[i].Overlaps(key.span)) return false;
+        }
+    }
+    return true;
+}
+
+void CommandBufferAccessContext::SetMemo(DescriptorAccessMemo &memo, std::vector<DescriptorAccessKey> &&keys) const {
+    memo.context = current_context_;
+    memo.generation = current_context_->GetChangeGeneration();
+    memo.span_count = current_context_->GetUpdatedSpans().size();
+    memo.keys = std::move(keys);
+}
+
+bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
+                                                                   const char *func_name) const {
+    bool skip = false;
+    std::vector<DescriptorAccess> accesses;
+    const PIPELINE_STATE *pipe = GetDescriptorAccesses(pipelineBindPoint, accesses);
+    if (!pipe) {
+        return skip;
+    }
+
+    const int memo_index = DescriptorAccessMemoIndex(pipelineBindPoint);
+    std::vector<DescriptorAccessKey> keys;
+    const bool memoizable = (memo_index >= 0) && MakeDescriptorAccessKeys(accesses, keys);
+    if (memo_index >= 0) {
+        if (memoizable && IsMemoCurrent(descriptor_access_memos_[memo_index], keys)) {
+            return skip;
+        }
+        validated_descriptor_accesses_[memo_index].Clear();
+    }
+
+    using DescriptorClass = cvdescriptorset::DescriptorClass;
+    using BufferDescriptor = cvdescriptorset::BufferDescriptor;
+    using ImageDescriptor = cvdescriptorset::ImageDescriptor;
+    using TexelDescriptor = cvdescriptorset::TexelDescriptor;
+
+    auto detect = [this, &accesses](uint32_t access_index) {
+        const auto &access = accesses[access_index];
+        HazardResult hazard;
+        switch (access.descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                const auto *image_descriptor = static_cast<const ImageDescriptor *>(access.descriptor);
+                const auto *img_view_state = image_descriptor->GetImageViewState();
+                // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                // Descriptors, so we do not have to worry about depth slicing here.
+                // See: VUID 00343
+                assert(!img_view_state->IsDepthSliced());
+                const IMAGE_STATE *img_state = img_view_state->image_state.get();
+                const auto &subresource_range = img_view_state->normalized_subresource_range;
+
+                if (access.sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                    const VkExtent3D extent = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.extent);
+                    const VkOffset3D offset = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.offset);
+                    // Input attachments are subject to raster ordering rules
+                    hazard = current_context_->DetectHazard(*img_state, access.sync_index, subresource_range,
+                                                            SyncOrdering::kRaster, offset, extent);
+                } else {
+                    hazard = current_context_->DetectHazard(*img_view_state, access.sync_index);
+                }
+                break;
+            }
+            case DescriptorClass::TexelBuffer: {
+                const auto *buf_view_state = static_cast<const TexelDescriptor *>(access.descriptor)->GetBufferViewState();
+                const ResourceAccessRange range = MakeRange(*buf_view_state);
+                hazard = current_context_->DetectHazard(*buf_view_state->buffer_state, access.sync_index, range);
+                break;
+            }
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(access.descriptor);
+                const auto *buf_state = buffer_descriptor->GetBufferState();
+                const ResourceAccessRange range =
+                    MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
+                hazard = current_context_->DetectHazard(*buf_state, access.sync_index, range);
+                break;
+            }
+            default:
+                break;
+        }
+        return hazard;
+    };
+    HazardDetectionBatch hazards(*sync_state_, *current_context_, static_cast<uint32_t>(accesses.size()), detect);
+
+    bool found_hazard = false;
+    for (uint32_t access_index = 0; access_index < accesses.size(); ++access_index) {
+        const auto &access = accesses[access_index];
+        const auto hazard = hazards.Take(access_index);
+        if (!hazard.hazard) continue;
+        found_hazard = true;
+        if (sync_state_->SupressedBoundDescriptorWAW(hazard)) continue;
+
+        switch (access.descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                const auto *image_descriptor = static_cast<const ImageDescriptor *>(access.descriptor);
+                const auto *img_view_state = image_descriptor->GetImageViewState();
+                skip |= sync_state_->LogError(
+                    img_view_state->image_view(), string_SyncHazardVUID(hazard.hazard),
+                    "%s: Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32 ", index %" PRIu32
+                    ". Access info %s.",
+                    func_name, string_SyncHazard(hazard.hazard),
+                    sync_state_->report_data->FormatHandle(img_view_state->image_view()).c_str(),
+                    sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                    sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                    sync_state_->report_data->FormatHandle(access.descriptor_set->GetSet()).c_str(),
+                    string_VkDescriptorType(access.descriptor_type), string_VkImageLayout(image_descriptor->GetImageLayout()),
+                    access.binding, access.index, FormatUsage(hazard).c_str());
+                break;
+            }
+            case DescriptorClass::TexelBuffer: {
+                const auto *buf_view_state = static_cast<const TexelDescriptor *>(access.descriptor)->GetBufferViewState();
+                skip |= sync_state_->LogError(
+                    buf_view_state->buffer_view(), string_SyncHazardVUID(hazard.hazard),
+                    "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.", func_name,
+                    string_SyncHazard(hazard.hazard), sync_state_->report_data->FormatHandle(buf_view_state->buffer_view()).c_str(),
+                    sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                    sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                    sync_state_->report_data->FormatHandle(access.descriptor_set->GetSet()).c_str(),
+                    string_VkDescriptorType(access.descriptor_type), access.binding, access.index, FormatUsage(hazard).c_str());
+                break;
+            }
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buf_state = static_cast<const BufferDescriptor *>(access.descriptor)->GetBufferState();
+                skip |= sync_state_->LogError(
+                    buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
+                    "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.", func_name,
+                    string_SyncHazard(hazard.hazard), sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
+                    sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                    sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                    sync_state_->report_data->FormatHandle(access.descriptor_set->GetSet()).c_str(),
+                    string_VkDescriptorType(access.descriptor_type), access.binding, access.index, FormatUsage(hazard).c_str());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    if (memoizable && !found_hazard) {
+        SetMemo(validated_descriptor_accesses_[memo_index], std::move(keys));
+    }
     return skip;
 }
 
 void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                  const ResourceUsageTag tag) {
-    const PIPELINE_STATE *pipe = nullptr;
-    const std::vector<LAST_BOUND_STATE::PER_SET> *per_sets = nullptr;
-    cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
-    if (!pipe || !per_sets) {
+    std::vector<DescriptorAccess> accesses;
+    if (!GetDescriptorAccesses(pipelineBindPoint, accesses)) {
         return;
     }
 
+    const int memo_index = DescriptorAccessMemoIndex(pipelineBindPoint);
+    std::vector<DescriptorAccessKey> keys;
+    bool memoizable = (memo_index >= 0) && MakeDescriptorAccessKeys(accesses, keys);
+    if (memoizable) {
+        auto &memo = descriptor_access_memos_[memo_index];
+        if (IsMemoCurrent(memo, keys)) {
+            // Nothing has touched what the memo reads up to here, so the next command only needs to look at later updates
+            memo.span_count = current_context_->GetUpdatedSpans().size();
+            return;
+        }
+        // Only accesses validated against the state they're recorded into become the memo
+        memoizable = IsMemoCurrent(validated_descriptor_accesses_[memo_index], keys);
+    }
+    if (memo_index >= 0) {
+        validated_descriptor_accesses_[memo_index].Clear();
+        descriptor_access_memos_[memo_index].Clear();
+    }
+
     using DescriptorClass = cvdescriptorset::DescriptorClass;
     using BufferDescriptor = cvdescriptorset::BufferDescriptor;
     using ImageDescriptor = cvdescriptorset::ImageDescriptor;
     using TexelDescriptor = cvdescriptorset::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_state) {
-        const auto raster_state = pipe->RasterizationState();
-        if (stage_state.stage_flag == VK_SHADER_STAGE_FRAGMENT_BIT && raster_state && raster_state->rasterizerDiscardEnable) {
-            continue;
+    for (const auto &access : accesses) {
+        switch (access.descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                const auto *img_view_state = static_cast<const ImageDescriptor *>(access.descriptor)->GetImageViewState();
+                // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                // Descriptors, so we do not have to worry about depth slicing here.
+                // See: VUID 00343
+                assert(!img_view_state->IsDepthSliced());
+                const IMAGE_STATE *img_state = img_view_state->image_state.get();
+                if (access.sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                    const VkExtent3D extent = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.extent);
+                    const VkOffset3D offset = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.offset);
+                    current_context_->UpdateAccessState(*img_state, access.sync_index, SyncOrdering::kRaster,
+                                                        img_view_state->normalized_subresource_range, offset, extent, tag);
+                } else {
+                    current_context_->UpdateAccessState(*img_view_state, access.sync_index, SyncOrdering::kNonAttachment, tag);
+                }
+                break;
+            }
+            case DescriptorClass::TexelBuffer: {
+                const auto *buf_view_state = static_cast<const TexelDescriptor *>(access.descriptor)->GetBufferViewState();
+                const ResourceAccessRange range = MakeRange(*buf_view_state);
+                current_context_->UpdateAccessState(*buf_view_state->buffer_state, access.sync_index, SyncOrdering::kNonAttachment,
+                                                    range, tag);
+                break;
+            }
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(access.descriptor);
+                const auto *buf_state = buffer_descriptor->GetBufferState();
+                const ResourceAccessRange range =
+                    MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
+                current_context_->UpdateAccessState(*buf_state, access.sync_index, SyncOrdering::kNonAttachment, range, tag);
+                break;
+            }
+            default:
+                break;
         }
-        for (const auto &set_binding : stage_state.descriptor_uses) {
-            const auto *descriptor_set = (*per_sets)[set_binding.first.set].bound_descriptor_set.get();
-            cvdescriptorset::DescriptorSetLayout::ConstBindingIterator binding_it(descriptor_set->GetLayout().get(),
-                                                                                  set_binding.first.binding);
-            const auto descriptor_type = binding_it.GetType();
-            cvdescriptorset::IndexRange index_range = binding_it.GetGlobalIndexRange();
-            auto array_idx = 0;
+    }
+    if (memoizable) {
+        SetMemo(descriptor_access_memos_[memo_index], std::move(keys));
+    }
+}
 
-            if (binding_it.IsVariableDescriptorCount()) {
-                index_range.end = index_range.start + descriptor_set->GetVariableDescriptorCount();
+// Calls action with the buffer state and range of each vertex buffer binding a draw fetches from. Per vertex bindings fetch
+// vertices [first_vertex, first_vertex + vertex_count) and per instance bindings instances [first_instance, first_instance +
+// instance_count), up to the end of the attributes of the last one. A count of UINT32_MAX, for indexed and indirect draws,
+// fetches the whole bound range. Without a binding plan the elements are taken to be a stride long, and every binding fetched.
+template <typename Action>
+static void ForEachVertexBufferFetch(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipe, uint32_t vertex_count,
+                                     uint32_t first_vertex, uint32_t instance_count, uint32_t first_instance,
+                                     const Action &action) {
+    if (!pipe.vertex_input_state) return;
+    const auto &vertex_input_state = *pipe.vertex_input_state;
+    const auto &binding_buffers = cb_state.current_vertex_buffer_binding_info.vertex_buffer_bindings;
+    const bool dynamic_stride = pipe.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT);
+
+    for (const auto &binding_description : vertex_input_state.binding_descriptions) {
+        if (binding_description.binding >= binding_buffers.size()) continue;
+        const auto &binding_buffer = binding_buffers[binding_description.binding];
+        if (binding_buffer.buffer_state == nullptr || binding_buffer.buffer_state->Destroyed()) continue;
+
+        VkDeviceSize element_size = binding_description.stride;
+        uint32_t divisor = 1;
+        if (vertex_input_state.has_binding_plan) {
+            const auto &plans = vertex_input_state.binding_plans;
+            const auto plan = std::find_if(plans.begin(), plans.end(),
+                                           [&binding_description](const VertexInputState::VertexBindingPlan &entry) {
+                                               return entry.binding == binding_description.binding;
+                                           });
+            // No attribute reads from the binding
+            if (plan == plans.end()) continue;
+            element_size = plan->max_extent;
+            divisor = plan->divisor;
+        }
+        const VkDeviceSize stride = dynamic_stride ? binding_buffer.stride : binding_description.stride;
+
+        uint32_t first = first_vertex;
+        uint32_t count = vertex_count;
+        if (binding_description.inputRate == VK_VERTEX_INPUT_RATE_INSTANCE) {
+            first = first_instance;
+            count = instance_count;
+            if (count != UINT32_MAX && divisor != 1) {
+                count = (divisor == 0) ? std::min(count, 1u) : (count / divisor) + ((count % divisor) ? 1 : 0);
             }
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, set_binding.second, stage_state.stage_flag);
+        }
 
-            for (uint32_t i = index_range.start; i < index_range.end; ++i, ++array_idx) {
-                const auto *descriptor = descriptor_set->GetDescriptorFromGlobalIndex(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
-                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                        // Descriptors, so we do not have to worry about depth slicing here.
-                        // See: VUID 00343
-                        assert(!img_view_state->IsDepthSliced());
-                        const IMAGE_STATE *img_state = img_view_state->image_state.get();
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->activeRenderPassBeginInfo.renderArea.offset);
-                            current_context_->UpdateAccessState(*img_state, sync_index, SyncOrdering::kRaster,
-                                                                img_view_state->normalized_subresource_range, offset, extent, tag);
-                        } else {
-                            current_context_->UpdateAccessState(*img_state, sync_index, SyncOrdering::kNonAttachment,
-                                                                img_view_state->normalized_subresource_range, tag);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
-                        break;
-                    }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
-                        break;
-                    }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
-                }
-            }
+        const auto *buf_state = binding_buffer.buffer_state.get();
+        if (count == UINT32_MAX) {
+            action(*buf_state, MakeRange(*buf_state, binding_buffer.offset, binding_buffer.size));
+        } else if (count > 0) {
+            const VkDeviceSize range_start = binding_buffer.offset + first * stride;
+            action(*buf_state, MakeRange(range_start, (count - 1) * stride + element_size));
         }
     }
 }
 
-bool CommandBufferAccessContext::ValidateDrawVertex(uint32_t vertexCount, uint32_t firstVertex, const char *func_name) const {
+bool CommandBufferAccessContext::ValidateDrawVertex(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount,
+                                                    uint32_t firstInstance, const char *func_name) const {
     bool skip = false;
     const auto *pipe = cb_state_->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
     if (!pipe) {
         return skip;
     }
 
-    const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info.vertex_buffer_bindings;
-    const auto &binding_buffers_size = binding_buffers.size();
-    const auto &binding_descriptions_size = pipe->vertex_input_state->binding_descriptions.size();
-
-    for (size_t i = 0; i < binding_descriptions_size; ++i) {
-        const auto &binding_description = pipe->vertex_input_state->binding_descriptions[i];
-        if (binding_description.binding < binding_buffers_size) {
-            const auto &binding_buffer = binding_buffers[binding_description.binding];
-            if (binding_buffer.buffer_state == nullptr || binding_buffer.buffer_state->Destroyed()) continue;
-
-            auto *buf_state = binding_buffer.buffer_state.get();
-            const ResourceAccessRange range = GetBufferRange(binding_buffer.offset, buf_state->createInfo.size, firstVertex,
-                                                             vertexCount, binding_description.stride);
-            auto hazard = current_context_->DetectHazard(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range);
-            if (hazard.hazard) {
-                skip |= sync_state_->LogError(
-                    buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), "%s: Hazard %s for vertex %s in %s. Access info %s.",
-                    func_name, string_SyncHazard(hazard.hazard), sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
-                    sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(), FormatUsage(hazard).c_str());
-            }
+    auto detect = [&](const BUFFER_STATE &buf_state, const ResourceAccessRange &range) {
+        auto hazard = current_context_->DetectHazard(buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range);
+        if (hazard.hazard) {
+            skip |= sync_state_->LogError(
+                buf_state.buffer(), string_SyncHazardVUID(hazard.hazard), "%s: Hazard %s for vertex %s in %s. Access info %s.",
+                func_name, string_SyncHazard(hazard.hazard), sync_state_->report_data->FormatHandle(buf_state.buffer()).c_str(),
+                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(), FormatUsage(hazard).c_str());
         }
-    }
+    };
+    ForEachVertexBufferFetch(*cb_state_, *pipe, vertexCount, firstVertex, instanceCount, firstInstance, detect);
     return skip;
 }
 
-void CommandBufferAccessContext::RecordDrawVertex(uint32_t vertexCount, uint32_t firstVertex, const ResourceUsageTag tag) {
+void CommandBufferAccessContext::RecordDrawVertex(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount,
+                                                  uint32_t firstInstance, const ResourceUsageTag tag) {
     const auto *pipe = cb_state_->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
     if (!pipe) {
         return;
     }
-    const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info.vertex_buffer_bindings;
-    const auto &binding_buffers_size = binding_buffers.size();
-    const auto &binding_descriptions_size = pipe->vertex_input_state->binding_descriptions.size();
-
-    for (size_t i = 0; i < binding_descriptions_size; ++i) {
-        const auto &binding_description = pipe->vertex_input_state->binding_descriptions[i];
-        if (binding_description.binding < binding_buffers_size) {
-            const auto &binding_buffer = binding_buffers[binding_description.binding];
-            if (binding_buffer.buffer_state == nullptr || binding_buffer.buffer_state->Destroyed()) continue;
-
-            auto *buf_state = binding_buffer.buffer_state.get();
-            const ResourceAccessRange range = GetBufferRange(binding_buffer.offset, buf_state->createInfo.size, firstVertex,
-                                                             vertexCount, binding_description.stride);
-            current_context_->UpdateAccessState(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ,
-                                                SyncOrdering::kNonAttachment, range, tag);
-        }
-    }
+    auto update = [&](const BUFFER_STATE &buf_state, const ResourceAccessRange &range) {
+        current_context_->UpdateAccessState(buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ,
+                                            SyncOrdering::kNonAttachment, range, tag);
+    };
+    ForEachVertexBufferFetch(*cb_state_, *pipe, vertexCount, firstVertex, instanceCount, firstInstance, update);
 }
 
-bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, const char *func_name) const {
+bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, uint32_t instanceCount,
+                                                         uint32_t firstInstance, const char *func_name) const {
     bool skip = false;
     if (cb_state_->index_buffer_binding.buffer_state == nullptr || cb_state_->index_buffer_binding.buffer_state->Destroyed()) {
         return skip;
@@ -2137,13 +2525,14 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t indexCount, ui
             sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(), FormatUsage(hazard).c_str());
     }
 
-    // TODO: For now, we detect the whole vertex buffer. Index buffer could be changed until SubmitQueue.
-    //       We will detect more accurate range in the future.
-    skip |= ValidateDrawVertex(UINT32_MAX, 0, func_name);
+    // The vertices the indices name are only known once the index buffer is read at submission, per vertex bindings are
+    // detected over their whole bound range
+    skip |= ValidateDrawVertex(UINT32_MAX, 0, instanceCount, firstInstance, func_name);
     return skip;
 }
 
-void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, const ResourceUsageTag tag) {
+void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, uint32_t instanceCount,
+                                                       uint32_t firstInstance, const ResourceUsageTag tag) {
     if (cb_state_->index_buffer_binding.buffer_state == nullptr || cb_state_->index_buffer_binding.buffer_state->Destroyed()) return;
 
     auto *index_buf_state = cb_state_->index_buffer_binding.buffer_state.get();
@@ -2152,9 +2541,9 @@ void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint
                                                      firstIndex, indexCount, index_size);
     current_context_->UpdateAccessState(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, SyncOrdering::kNonAttachment, range, tag);
 
-    // TODO: For now, we detect the whole vertex buffer. Index buffer could be changed until SubmitQueue.
-    //       We will detect more accurate range in the future.
-    RecordDrawVertex(UINT32_MAX, 0, tag);
+    // The vertices the indices name are only known once the index buffer is read at submission, per vertex bindings are
+    // recorded over their whole bound range
+    RecordDrawVertex(UINT32_MAX, 0, instanceCount, firstInstance, tag);
 }
 
 bool CommandBufferAccessContext::ValidateDrawSubpassAttachment(const char *func_name) const {
@@ -2174,7 +2563,9 @@ void CommandBufferAccessContext::RecordBeginRenderPass(const RENDER_PASS_STATE &
                                                        const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
                                                        const ResourceUsageTag tag) {
     // Create an access context the current renderpass.
-    render_pass_contexts_.emplace_back(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_);
+    // Render passes are always created by the sync validator, and so are SyncRenderPassStates
+    render_pass_contexts_.emplace_back(static_cast<const SyncRenderPassState &>(rp_state), render_area, GetQueueFlags(),
+                                       attachment_views, &cb_access_context_);
     current_renderpass_context_ = &render_pass_contexts_.back();
     current_renderpass_context_->RecordBeginRenderPass(tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -2270,22 +2661,50 @@ void CommandBufferAccessContext::RecordExecutedCommandBuffer(const CommandBuffer
     ResolveRecordedContext(*recorded_context, tag_range.begin);
 }
 
-void CommandBufferAccessContext::ResolveRecordedContext(const AccessContext &recorded_context, ResourceUsageTag offset) {
+// Recorded maps smaller than this aren't worth handing to the worker threads
+static constexpr size_t kMinParallelResolveEntries = 4096;
+static constexpr size_t kParallelResolveWindowEntries = 1024;
+
+// Resolve a recorded command buffer's accesses into the context it's executed or submitted in, with its tags moved to offset
+static void ResolveRecordedAccesses(const SyncValidator &sync_state, const AccessContext &recorded_context, ResourceUsageTag offset,
+                                    AccessContext *access_context) {
     auto tag_offset = [offset](ResourceAccessState *access) { access->OffsetTag(offset); };
 
-    auto *access_context = GetCurrentAccessContext();
     for (auto address_type : kAddressTypes) {
-        recorded_context.ResolveAccessRange(address_type, kFullRange, tag_offset, &access_context->GetAccessStateMap(address_type),
-                                            nullptr, false);
+        auto &resolve_map = access_context->GetAccessStateMap(address_type);
+        const auto &recorded_map = recorded_context.GetAccessStateMap(address_type);
+        if (!sync_state.CanRunSyncResolveBatch() || recorded_map.size() < kMinParallelResolveEntries) {
+            recorded_context.ResolveAccessRange(address_type, kFullRange, tag_offset, &resolve_map, nullptr, false);
+            continue;
+        }
+
+        // Each window of the resolve map is moved out to a map of its own, resolved into there, and moved back, so that no two
+        // threads ever touch the same map.
+        const auto windows = sparse_container::partition_range(recorded_map, kFullRange, kParallelResolveWindowEntries);
+        std::vector<ResourceAccessRangeMap> window_maps(windows.size());
+        for (size_t i = 0; i < windows.size(); ++i) {
+            sparse_container::extract_range(resolve_map, windows[i], window_maps[i]);
+        }
+        sync_state.RunSyncResolveBatch(static_cast<uint32_t>(windows.size()), [&](uint32_t i) {
+            recorded_context.ResolveAccessRange(address_type, windows[i], tag_offset, &window_maps[i], nullptr, false);
+            return false;
+        });
+        for (auto &window_map : window_maps) {
+            sparse_container::insert_extracted(resolve_map, window_map);
+        }
     }
 }
 
+void CommandBufferAccessContext::ResolveRecordedContext(const AccessContext &recorded_context, ResourceUsageTag offset) {
+    ResolveRecordedAccesses(*sync_state_, recorded_context, offset, GetCurrentAccessContext());
+}
+
 ResourceUsageRange CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
     // The execution references ensure lifespan for the referenced child CB's...
     ResourceUsageRange tag_range(GetTagLimit(), 0);
     cbs_referenced_.emplace(recorded_context.cb_state_);
-    access_log_.insert(access_log_.end(), recorded_context.access_log_.cbegin(), recorded_context.access_log_.end());
-    tag_range.end = access_log_.size();
+    access_log_->Append(*recorded_context.access_log_);
+    tag_range.end = access_log_->size();
     return tag_range;
 }
 
@@ -2623,15 +3042,18 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     }
     return view_gens;
 }
-RenderPassAccessContext::RenderPassAccessContext(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area,
+RenderPassAccessContext::RenderPassAccessContext(const SyncRenderPassState &rp_state, const VkRect2D &render_area,
                                                  VkQueueFlags queue_flags,
                                                  const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
                                                  const AccessContext *external_context)
     : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    // The subpass barriers were translated when the render pass was created, only the contexts are built here
+    const auto subpass_barriers = rp_state.GetSubpassBarriers(queue_flags);
     // Add this for all subpasses here so that they exsist during next subpass validation
     subpass_contexts_.reserve(rp_state_->createInfo.subpassCount);
     for (uint32_t pass = 0; pass < rp_state_->createInfo.subpassCount; pass++) {
-        subpass_contexts_.emplace_back(pass, queue_flags, rp_state_->subpass_dependencies, subpass_contexts_, external_context);
+        subpass_contexts_.emplace_back(pass, rp_state_->subpass_dependencies[pass], (*subpass_barriers)[pass], subpass_contexts_,
+                                       external_context);
     }
     attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
 }
@@ -2685,21 +3107,11 @@ void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_contex
 }
 
 SyncExecScope SyncExecScope::MakeSrc(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param) {
-    SyncExecScope result;
-    result.mask_param = mask_param;
-    result.expanded_mask = sync_utils::ExpandPipelineStages(mask_param, queue_flags);
-    result.exec_scope = sync_utils::WithEarlierPipelineStages(result.expanded_mask);
-    result.valid_accesses = SyncStageAccess::AccessScopeByStage(result.exec_scope);
-    return result;
+    return CachedExecScope(queue_flags, mask_param, true);
 }
 
 SyncExecScope SyncExecScope::MakeDst(VkQueueFlags queue_flags, VkPipelineStageFlags2KHR mask_param) {
-    SyncExecScope result;
-    result.mask_param = mask_param;
-    result.expanded_mask = sync_utils::ExpandPipelineStages(mask_param, queue_flags);
-    result.exec_scope = sync_utils::WithLaterPipelineStages(result.expanded_mask);
-    result.valid_accesses = SyncStageAccess::AccessScopeByStage(result.exec_scope);
-    return result;
+    return CachedExecScope(queue_flags, mask_param, false);
 }
 
 SyncBarrier::SyncBarrier(const SyncExecScope &src, const SyncExecScope &dst) {
@@ -2717,6 +3129,61 @@ SyncBarrier::SyncBarrier(const Barrier &barrier, const SyncExecScope &src, const
     dst_access_scope = SyncStageAccess::AccessScope(dst.valid_accesses, barrier.dstAccessMask);
 }
 
+SyncRenderPassState::SyncRenderPassState(VkRenderPass rp, const VkRenderPassCreateInfo *pCreateInfo,
+                                         const std::vector<VkQueueFlags> &queue_flags)
+    : RENDER_PASS_STATE(rp, pCreateInfo) {
+    InitSubpassBarriers(queue_flags);
+}
+
+SyncRenderPassState::SyncRenderPassState(VkRenderPass rp, const VkRenderPassCreateInfo2 *pCreateInfo,
+                                         const std::vector<VkQueueFlags> &queue_flags)
+    : RENDER_PASS_STATE(rp, pCreateInfo) {
+    InitSubpassBarriers(queue_flags);
+}
+
+void SyncRenderPassState::InitSubpassBarriers(const std::vector<VkQueueFlags> &queue_flags) {
+    subpass_barriers_.reserve(queue_flags.size());
+    for (const auto flags : queue_flags) {
+        subpass_barriers_.emplace_back(flags, MakeSubpassBarriers(flags));
+    }
+}
+
+std::shared_ptr<const SyncRenderPassState::SubpassBarriersVec> SyncRenderPassState::GetSubpassBarriers(
+    VkQueueFlags queue_flags) const {
+    for (const auto &entry : subpass_barriers_) {
+        if (entry.first == queue_flags) return entry.second;
+    }
+    return MakeSubpassBarriers(queue_flags);
+}
+
+std::shared_ptr<const SyncRenderPassState::SubpassBarriersVec> SyncRenderPassState::MakeSubpassBarriers(
+    VkQueueFlags queue_flags) const {
+    auto barriers_vec = std::make_shared<SubpassBarriersVec>(subpass_dependencies.size());
+    for (size_t pass = 0; pass < subpass_dependencies.size(); ++pass) {
+        const auto &subpass_dep = subpass_dependencies[pass];
+        auto &barriers = (*barriers_vec)[pass];
+        barriers.prev.reserve(subpass_dep.prev.size());
+        for (const auto &prev_dep : subpass_dep.prev) {
+            std::vector<SyncBarrier> prev_barriers;
+            prev_barriers.reserve(prev_dep.second.size());
+            for (const VkSubpassDependency2 *dependency : prev_dep.second) {
+                assert(dependency);
+                prev_barriers.emplace_back(queue_flags, *dependency);
+            }
+            barriers.prev.emplace_back(prev_dep.first->pass, std::move(prev_barriers));
+        }
+        barriers.from_external.reserve(subpass_dep.barrier_from_external.size());
+        for (const VkSubpassDependency2 *dependency : subpass_dep.barrier_from_external) {
+            barriers.from_external.emplace_back(queue_flags, *dependency);
+        }
+        barriers.to_external.reserve(subpass_dep.barrier_to_external.size());
+        for (const VkSubpassDependency2 *dependency : subpass_dep.barrier_to_external) {
+            barriers.to_external.emplace_back(queue_flags, *dependency);
+        }
+    }
+    return barriers_vec;
+}
+
 SyncBarrier::SyncBarrier(VkQueueFlags queue_flags, const VkSubpassDependency2 &subpass) {
     const auto barrier = lvl_find_in_chain<VkMemoryBarrier2KHR>(subpass.pNext);
     if (barrier) {
@@ -2751,7 +3218,7 @@ SyncBarrier::SyncBarrier(VkQueueFlags queue_flags, const Barrier &barrier) {
 }
 
 // Apply a list of barriers, without resolving pending state, useful for subpass layout transitions
-void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
     for (const auto &barrier : barriers) {
         ApplyBarrier(barrier, layout_transition);
     }
@@ -2760,7 +3227,7 @@ void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers
 // ApplyBarriers is design for *fully* inclusive barrier lists without layout tranistions.  Designed use was for
 // inter-subpass barriers for lazy-evaluation of parent context memory ranges.  Subpass layout transistions are *not* done
 // lazily, s.t. no previous access reports should need layout transitions.
-void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers, const ResourceUsageTag tag) {
+void ResourceAccessStateData::ApplyBarriers(const std::vector<SyncBarrier> &barriers, const ResourceUsageTag tag) {
     assert(!pending_layout_transition);  // This should never be call in the middle of another barrier application
     assert(pending_write_barriers.none());
     assert(!pending_write_dep_chain);
@@ -2769,13 +3236,13 @@ void ResourceAccessState::ApplyBarriers(const std::vector<SyncBarrier> &barriers
     }
     ApplyPendingBarriers(tag);
 }
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index) const {
     HazardResult hazard;
     auto usage = FlagBit(usage_index);
     const auto usage_stage = PipelineStageBit(usage_index);
     if (IsRead(usage)) {
         if (IsRAWHazard(usage_stage, usage)) {
-            hazard.Set(this, usage_index, READ_AFTER_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, READ_AFTER_WRITE, last_write.Flags(), write_tag);
         }
     } else {
         // Write operation:
@@ -2788,32 +3255,33 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         //
         // Look for casus belli for WAR
         if (last_reads.size()) {
-            for (const auto &read_access : last_reads) {
-                if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+            const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+            for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+                if (IsReadHazard(usage_stage, read_barriers[i])) {
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, last_reads.accesses()[i].Flags(), last_reads.tags()[i]);
                     break;
                 }
             }
         } else if (last_write.any() && IsWriteHazard(usage)) {
             // Write-After-Write check -- if we have a previous write to test against
-            hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write.Flags(), write_tag);
         }
     }
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering ordering_rule) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index, const SyncOrdering ordering_rule) const {
     const auto &ordering = GetOrderingRules(ordering_rule);
     return DetectHazard(usage_index, ordering);
 }
 
-HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
+HazardResult ResourceAccessStateData::DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
     // The ordering guarantees act as barriers to the last accesses, independent of synchronization operations
     HazardResult hazard;
     const auto usage_bit = FlagBit(usage_index);
     const auto usage_stage = PipelineStageBit(usage_index);
     const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
-    const bool last_write_is_ordered = (last_write & ordering.access_scope).any();
+    const bool last_write_is_ordered = last_write.In(ordering.access_scope);
     if (IsRead(usage_bit)) {
         // Exclude RAW if no write, or write not most "most recent" operation w.r.t. usage;
         bool is_raw_hazard = IsRAWHazard(usage_stage, usage_bit);
@@ -2831,7 +3299,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
             }
         }
         if (is_raw_hazard) {
-            hazard.Set(this, usage_index, READ_AFTER_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, READ_AFTER_WRITE, last_write.Flags(), write_tag);
         }
     } else if (usage_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION) {
         // For Image layout transitions, the barrier represents the first synchronization/access scope of the layout transition
@@ -2848,30 +3316,33 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
             }
             // If we're tracking any reads that aren't ordered against the current write, got to check 'em all.
             if ((ordered_stages & last_read_stages) != last_read_stages) {
-                for (const auto &read_access : last_reads) {
-                    if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
-                    if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                const VkPipelineStageFlags2KHR *read_stages = last_reads.stages();
+                const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+                for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+                    if (read_stages[i] & ordered_stages) continue;  // but we can skip the ordered ones
+                    if (IsReadHazard(usage_stage, read_barriers[i])) {
+                        hazard.Set(this, usage_index, WRITE_AFTER_READ, last_reads.accesses()[i].Flags(), last_reads.tags()[i]);
                         break;
                     }
                 }
             }
         } else if (last_write.any() && !(last_write_is_ordered && usage_write_is_ordered)) {
             bool ilt_ilt_hazard = false;
-            if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (usage_bit == last_write)) {
+            if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (usage_index == last_write.Index())) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
                 ilt_ilt_hazard = !(write_barriers & ordering.access_scope).any();
             }
             if (ilt_ilt_hazard || IsWriteHazard(usage_bit)) {
-                hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write.Flags(), write_tag);
             }
         }
     }
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const {
+HazardResult ResourceAccessStateData::DetectHazard(const ResourceAccessStateData &recorded_use,
+                                                   const ResourceUsageRange &tag_range) const {
     HazardResult hazard;
     using Size = FirstAccesses::size_type;
     const auto &recorded_accesses = recorded_use.first_accesses_;
@@ -2927,7 +3398,7 @@ HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &record
 }
 
 // Asynchronous Hazards occur between subpasses with no connection through the DAG
-HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag start_tag) const {
+HazardResult ResourceAccessStateData::DetectAsyncHazard(SyncStageAccessIndex usage_index, const ResourceUsageTag start_tag) const {
     HazardResult hazard;
     auto usage = FlagBit(usage_index);
     // Async checks need to not go back further than the start of the subpass, as we only want to find hazards between the async
@@ -2935,16 +3406,17 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     // the raster ordering rules.
     if (IsRead(usage)) {
         if (last_write.any() && (write_tag >= start_tag)) {
-            hazard.Set(this, usage_index, READ_RACING_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, READ_RACING_WRITE, last_write.Flags(), write_tag);
         }
     } else {
         if (last_write.any() && (write_tag >= start_tag)) {
-            hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write.Flags(), write_tag);
         } else if (last_reads.size() > 0) {
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
-            for (const auto &read_access : last_reads) {
-                if (read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.access, read_access.tag);
+            const ResourceUsageTag *read_tags = last_reads.tags();
+            for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+                if (read_tags[i] >= start_tag) {
+                    hazard.Set(this, usage_index, WRITE_RACING_READ, last_reads.accesses()[i].Flags(), read_tags[i]);
                     break;
                 }
             }
@@ -2953,8 +3425,8 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
-                                                    ResourceUsageTag start_tag) const {
+HazardResult ResourceAccessStateData::DetectAsyncHazard(const ResourceAccessStateData &recorded_use,
+                                                        const ResourceUsageRange &tag_range, ResourceUsageTag start_tag) const {
     HazardResult hazard;
     for (const auto &first : recorded_use.first_accesses_) {
         // Skip and quit logic
@@ -2970,7 +3442,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &r
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
+HazardResult ResourceAccessStateData::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
                                                       const SyncStageAccessFlags &src_access_scope) const {
     // Only supporting image layout transitions for now
     assert(usage_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
@@ -2979,20 +3451,22 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
     if (last_reads.size()) {
         // Look at the reads if any
-        for (const auto &read_access : last_reads) {
-            if (read_access.IsReadBarrierHazard(src_exec_scope)) {
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+        const VkPipelineStageFlags2KHR *read_stages = last_reads.stages();
+        const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+        for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+            if (IsReadBarrierHazard(src_exec_scope, read_stages[i], read_barriers[i])) {
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, last_reads.accesses()[i].Flags(), last_reads.tags()[i]);
                 break;
             }
         }
     } else if (last_write.any() && IsWriteBarrierHazard(src_exec_scope, src_access_scope)) {
-        hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+        hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write.Flags(), write_tag);
     }
 
     return hazard;
 }
 
-HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
+HazardResult ResourceAccessStateData::DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR src_exec_scope,
                                                       const SyncStageAccessFlags &src_access_scope,
                                                       const ResourceUsageTag event_tag) const {
     // Only supporting image layout transitions for now
@@ -3004,19 +3478,22 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     if (last_reads.size()) {
         // Look at the reads if any... if reads exist, they are either the resaon the access is in the event
         // first scope, or they are a hazard.
-        for (const auto &read_access : last_reads) {
-            if (read_access.tag < event_tag) {
+        const VkPipelineStageFlags2KHR *read_stages = last_reads.stages();
+        const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+        const ResourceUsageTag *read_tags = last_reads.tags();
+        for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+            if (read_tags[i] < event_tag) {
                 // The read is in the events first synchronization scope, so we use a barrier hazard check
                 // If the read stage is not in the src sync scope
                 // *AND* not execution chained with an existing sync barrier (that's the or)
                 // then the barrier access is unsafe (R/W after R)
-                if (read_access.IsReadBarrierHazard(src_exec_scope)) {
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                if (IsReadBarrierHazard(src_exec_scope, read_stages[i], read_barriers[i])) {
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, last_reads.accesses()[i].Flags(), read_tags[i]);
                     break;
                 }
             } else {
                 // The read not in the event first sync scope and so is a hazard vs. the layout transition
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, last_reads.accesses()[i].Flags(), read_tags[i]);
             }
         }
     } else if (last_write.any()) {
@@ -3025,11 +3502,11 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
             // The write is in the first sync scope of the event (sync their aren't any reads to be the reason)
             // So do a normal barrier hazard check
             if (IsWriteBarrierHazard(src_exec_scope, src_access_scope)) {
-                hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write.Flags(), write_tag);
             }
         } else {
             // The write isn't in scope, and is thus a hazard to the layout transistion for wait
-            hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
+            hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write.Flags(), write_tag);
         }
     }
 
@@ -3039,7 +3516,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
 // The logic behind resolves is the same as update, we assume that earlier hazards have be reported, and that no
 // tranistive hazard can exists with a hazard between the earlier operations.  Yes, an early hazard can mask that another
 // exists, but if you fix *that* hazard it either fixes or unmasks the subsequent ones.
-void ResourceAccessState::Resolve(const ResourceAccessState &other) {
+void ResourceAccessStateData::Resolve(const ResourceAccessStateData &other) {
     if (write_tag < other.write_tag) {
         // If this is a later write, we've reported any exsiting hazard, and we can just overwrite as the more recent
         // operation
@@ -3054,44 +3531,38 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
         pending_layout_ordering_ |= other.pending_layout_ordering_;
 
         // Merge the read states
-        const auto pre_merge_count = last_reads.size();
         const auto pre_merge_stages = last_read_stages;
-        for (uint32_t other_read_index = 0; other_read_index < other.last_reads.size(); other_read_index++) {
-            auto &other_read = other.last_reads[other_read_index];
-            if (pre_merge_stages & other_read.stage) {
+        for (ReadStates::size_type other_read_index = 0; other_read_index < other.last_reads.size(); other_read_index++) {
+            const VkPipelineStageFlags2KHR other_stage = other.last_reads.stages()[other_read_index];
+            const ResourceUsageTag other_tag = other.last_reads.tags()[other_read_index];
+            if (pre_merge_stages & other_stage) {
                 // Merge in the barriers for read stages that exist in *both* this and other
                 // TODO: This is N^2 with stages... perhaps the ReadStates should be sorted by stage index.
                 //       but we should wait on profiling data for that.
-                for (uint32_t my_read_index = 0; my_read_index < pre_merge_count; my_read_index++) {
-                    auto &my_read = last_reads[my_read_index];
-                    if (other_read.stage == my_read.stage) {
-                        if (my_read.tag < other_read.tag) {
-                            // Other is more recent, copy in the state
-                            my_read.access = other_read.access;
-                            my_read.tag = other_read.tag;
-                            my_read.pending_dep_chain = other_read.pending_dep_chain;
-                            // TODO: Phase 2 -- review the state merge logic to avoid false positive from overwriting the barriers
-                            //                  May require tracking more than one access per stage.
-                            my_read.barriers = other_read.barriers;
-                            if (my_read.stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
-                                // Since I'm overwriting the fragement stage read, also update the input attachment info
-                                // as this is the only stage that affects it.
-                                input_attachment_read = other.input_attachment_read;
-                            }
-                        } else if (other_read.tag == my_read.tag) {
-                            // The read tags match so merge the barriers
-                            my_read.barriers |= other_read.barriers;
-                            my_read.pending_dep_chain |= other_read.pending_dep_chain;
-                        }
-
-                        break;
+                const auto my_read_index = last_reads.Find(other_stage);
+                if (last_reads.tags()[my_read_index] < other_tag) {
+                    // Other is more recent, copy in the state
+                    last_reads.accesses()[my_read_index] = other.last_reads.accesses()[other_read_index];
+                    last_reads.tags()[my_read_index] = other_tag;
+                    last_reads.pending_dep_chains()[my_read_index] = other.last_reads.pending_dep_chains()[other_read_index];
+                    // TODO: Phase 2 -- review the state merge logic to avoid false positive from overwriting the barriers
+                    //                  May require tracking more than one access per stage.
+                    last_reads.barriers()[my_read_index] = other.last_reads.barriers()[other_read_index];
+                    if (other_stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
+                        // Since I'm overwriting the fragement stage read, also update the input attachment info
+                        // as this is the only stage that affects it.
+                        input_attachment_read = other.input_attachment_read;
                     }
+                } else if (other_tag == last_reads.tags()[my_read_index]) {
+                    // The read tags match so merge the barriers
+                    last_reads.barriers()[my_read_index] |= other.last_reads.barriers()[other_read_index];
+                    last_reads.pending_dep_chains()[my_read_index] |= other.last_reads.pending_dep_chains()[other_read_index];
                 }
             } else {
                 // The other read stage doesn't exist in this, so add it.
-                last_reads.emplace_back(other_read);
-                last_read_stages |= other_read.stage;
-                if (other_read.stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
+                last_reads.push_back(other.last_reads, other_read_index);
+                last_read_stages |= other_stage;
+                if (other_stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
                     input_attachment_read = other.input_attachment_read;
                 }
             }
@@ -3124,34 +3595,28 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
     }
 }
 
-void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, const ResourceUsageTag tag) {
+void ResourceAccessStateData::Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, const ResourceUsageTag tag) {
     // Move this logic in the ResourceStateTracker as methods, thereof (or we'll repeat it for every flavor of resource...
-    const auto usage_bit = FlagBit(usage_index);
     if (IsRead(usage_index)) {
         // Mulitple outstanding reads may be of interest and do dependency chains independently
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
         const auto usage_stage = PipelineStageBit(usage_index);
         if (usage_stage & last_read_stages) {
-            for (auto &read_access : last_reads) {
-                if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag);
-                    break;
-                }
-            }
+            last_reads.Set(last_reads.Find(usage_stage), usage_stage, SyncStageAccessBit(usage_index), 0, tag);
         } else {
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            last_reads.push_back(usage_stage, SyncStageAccessBit(usage_index), 0, tag);
             last_read_stages |= usage_stage;
         }
 
         // Fragment shader reads come in two flavors, and we need to track if the one we're tracking is the special one.
         if (usage_stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
             // TODO Revisit re: multiple reads for a given stage
-            input_attachment_read = (usage_bit == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
+            input_attachment_read = (usage_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ);
         }
     } else {
         // Assume write
         // TODO determine what to do with READ-WRITE operations if any
-        SetWrite(usage_bit, tag);
+        SetWrite(usage_index, tag);
     }
     UpdateFirst(tag, usage_index, ordering_rule);
 }
@@ -3161,7 +3626,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
 // We can overwrite them as *this* write is now after them.
 //
 // Note: intentionally ignore pending barriers and chains (i.e. don't apply or clear them), let ApplyPendingBarriers handle them.
-void ResourceAccessState::SetWrite(const SyncStageAccessFlags &usage_bit, const ResourceUsageTag tag) {
+void ResourceAccessStateData::SetWrite(SyncStageAccessIndex usage_index, const ResourceUsageTag tag) {
     last_reads.clear();
     last_read_stages = 0;
     read_execution_barriers = 0;
@@ -3170,14 +3635,14 @@ void ResourceAccessState::SetWrite(const SyncStageAccessFlags &usage_bit, const
     write_barriers = 0;
     write_dependency_chain = 0;
     write_tag = tag;
-    last_write = usage_bit;
+    last_write = SyncStageAccessBit(usage_index);
 }
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
 // changes the "chaining" state, but to keep barriers independent, we defer this until all barriers
 // of the batch have been processed. Also, depending on whether layout transition happens, we'll either
 // replace the current write barriers or add to them, so accumulate to pending as well.
-void ResourceAccessState::ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) {
     // For independent barriers we need to track what the new barriers and dependency chain *will* be when we're done
     // applying the memory barriers
     // NOTE: We update the write barrier if the write is in the first access scope or if there is a layout
@@ -3197,25 +3662,28 @@ void ResourceAccessState::ApplyBarrier(const SyncBarrier &barrier, bool layout_t
     if (!pending_layout_transition) {
         // Once we're dealing with a layout transition (which is modelled as a *write*) then the last reads/writes/chains
         // don't need to be tracked as we're just going to zero them.
-        for (auto &read_access : last_reads) {
-            // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync scope
-            if (barrier.src_exec_scope.exec_scope & (read_access.stage | read_access.barriers)) {
-                read_access.pending_dep_chain |= barrier.dst_exec_scope.exec_scope;
-            }
+        // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync scope
+        const VkPipelineStageFlags2KHR src_exec_scope = barrier.src_exec_scope.exec_scope;
+        const VkPipelineStageFlags2KHR dst_exec_scope = barrier.dst_exec_scope.exec_scope;
+        const VkPipelineStageFlags2KHR *read_stages = last_reads.stages();
+        const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+        VkPipelineStageFlags2KHR *pending_dep_chains = last_reads.pending_dep_chains();
+        for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+            pending_dep_chains[i] |= (src_exec_scope & (read_stages[i] | read_barriers[i])) ? dst_exec_scope : 0;
         }
     }
 }
 
 // Apply the tag scoped memory barrier without updating the existing barriers.  The execution barrier
 // changes the "chaining" state, but to keep barriers independent. See discussion above.
-void ResourceAccessState::ApplyBarrier(const ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
+void ResourceAccessStateData::ApplyBarrier(const ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
     // The scope logic for events is, if we're here, the resource usage was flagged as "in the first execution scope" at
     // the time of the SetEvent, thus all we need check is whether the access is the same one (i.e. before the scope tag
     // in order to know if it's in the excecution scope
     // Notice that the layout transition sets the pending barriers *regardless*, as any lack of src_access_scope to
     // guard against the layout transition should be reported in the detect barrier hazard phase, and we only report
     // errors w.r.t. "most recent" accesses.
-    if (layout_transition || ((write_tag < scope_tag) && (barrier.src_access_scope & last_write).any())) {
+    if (layout_transition || ((write_tag < scope_tag) && last_write.In(barrier.src_access_scope))) {
         pending_write_barriers |= barrier.dst_access_scope;
         pending_write_dep_chain |= barrier.dst_exec_scope.exec_scope;
         if (layout_transition) {
@@ -3228,7 +3696,13 @@ void ResourceAccessState::ApplyBarrier(const ResourceUsageTag scope_tag, const S
     if (!pending_layout_transition) {
         // Once we're dealing with a layout transition (which is modelled as a *write*) then the last reads/writes/chains
         // don't need to be tracked as we're just going to zero them.
-        for (auto &read_access : last_reads) {
+        const VkPipelineStageFlags2KHR src_exec_scope = barrier.src_exec_scope.exec_scope;
+        const VkPipelineStageFlags2KHR dst_exec_scope = barrier.dst_exec_scope.exec_scope;
+        const VkPipelineStageFlags2KHR *read_stages = last_reads.stages();
+        const VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+        const ResourceUsageTag *read_tags = last_reads.tags();
+        VkPipelineStageFlags2KHR *pending_dep_chains = last_reads.pending_dep_chains();
+        for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
             // If this read is the same one we included in the set event and in scope, then apply the execution barrier...
             // NOTE: That's not really correct... this read stage might *not* have been included in the setevent, and the barriers
             // representing the chain might have changed since then (that would be an odd usage), so as a first approximation
@@ -3236,16 +3710,15 @@ void ResourceAccessState::ApplyBarrier(const ResourceUsageTag scope_tag, const S
             // positive in the case of Set; SomeBarrier; Wait; we'll live with it until we can add more state to the first scope
             // capture (the specific write and read stages that *were* in scope at the moment of SetEvents.
             // TODO: eliminate the false positive by including write/read-stages "in scope" information in SetEvents first_scope
-            if ((read_access.tag < scope_tag) && (barrier.src_exec_scope.exec_scope & (read_access.stage | read_access.barriers))) {
-                read_access.pending_dep_chain |= barrier.dst_exec_scope.exec_scope;
-            }
+            const bool in_scope = (read_tags[i] < scope_tag) && (src_exec_scope & (read_stages[i] | read_barriers[i]));
+            pending_dep_chains[i] |= in_scope ? dst_exec_scope : 0;
         }
     }
 }
-void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
+void ResourceAccessStateData::ApplyPendingBarriers(const ResourceUsageTag tag) {
     if (pending_layout_transition) {
         // SetWrite clobbers the last_reads array, and thus we don't have to clear the read_state out.
-        SetWrite(SYNC_IMAGE_LAYOUT_TRANSITION_BIT, tag);  // Side effect notes below
+        SetWrite(SYNC_IMAGE_LAYOUT_TRANSITION, tag);  // Side effect notes below
         UpdateFirst(tag, SYNC_IMAGE_LAYOUT_TRANSITION, SyncOrdering::kNonAttachment);
         TouchupFirstForLayoutTransition(tag, pending_layout_ordering_);
         pending_layout_ordering_ = OrderingBarrier();
@@ -3254,10 +3727,12 @@ void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
 
     // Apply the accumulate execution barriers (and thus update chaining information)
     // for layout transition, last_reads is reset by SetWrite, so this will be skipped.
-    for (auto &read_access : last_reads) {
-        read_access.barriers |= read_access.pending_dep_chain;
-        read_execution_barriers |= read_access.barriers;
-        read_access.pending_dep_chain = 0;
+    VkPipelineStageFlags2KHR *read_barriers = last_reads.barriers();
+    VkPipelineStageFlags2KHR *pending_dep_chains = last_reads.pending_dep_chains();
+    for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+        read_barriers[i] |= pending_dep_chains[i];
+        read_execution_barriers |= read_barriers[i];
+        pending_dep_chains[i] = 0;
     }
 
     // We OR in the accumulated write chain and barriers even in the case of a layout transition as SetWrite zeros them.
@@ -3267,19 +3742,47 @@ void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
     pending_write_barriers = 0;
 }
 
-bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
+void ResourceAccessStateData::ApplyTaggedWait(const ResourceUsageTag tag) {
+    if (last_write.any()) {
+        // Every read still held came after the write, as writes clear the reads before them
+        if (write_tag >= tag) return;
+        write_barriers = ~SyncStageAccessFlags(0);
+        write_dependency_chain = 0;
+        write_tag = ResourceUsageTag();
+        last_write = SyncStageAccessBit();
+    }
+
+    last_read_stages = 0;
+    read_execution_barriers = 0;
+    bool fragment_read = false;
+    ReadStates::size_type kept = 0;
+    for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+        if (last_reads.tags()[i] < tag) continue;
+        const VkPipelineStageFlags2KHR read_stage = last_reads.stages()[i];
+        last_read_stages |= read_stage;
+        read_execution_barriers |= last_reads.barriers()[i];
+        fragment_read |= (read_stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR);
+        last_reads.Move(kept++, i);
+    }
+    last_reads.truncate(kept);
+    input_attachment_read &= fragment_read;
+    if (!HasAccesses()) first_accesses_.clear();
+}
+
+bool ResourceAccessStateData::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
     if (!first_accesses_.size()) return false;
     const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
     return tag_range.intersects(first_access_range);
 }
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
-VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
+VkPipelineStageFlags2KHR ResourceAccessStateData::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = 0U;
 
-    for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
-            barriers = read_access.barriers;
+    const SyncStageAccessBit *read_accesses = last_reads.accesses();
+    for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+        if (read_accesses[i].In(usage_bit)) {
+            barriers = last_reads.barriers()[i];
             break;
         }
     }
@@ -3287,7 +3790,7 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
     return barriers;
 }
 
-inline bool ResourceAccessState::IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, const SyncStageAccessFlags &usage) const {
+inline bool ResourceAccessStateData::IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, const SyncStageAccessFlags &usage) const {
     assert(IsRead(usage));
     // Only RAW vs. last_write if it doesn't happen-after any other read because either:
     //    * the previous reads are not hazards, and thus last_write must be visible and available to
@@ -3297,7 +3800,7 @@ inline bool ResourceAccessState::IsRAWHazard(VkPipelineStageFlags2KHR usage_stag
     return last_write.any() && (0 == (read_execution_barriers & usage_stage)) && IsWriteHazard(usage);
 }
 
-VkPipelineStageFlags2KHR ResourceAccessState::GetOrderedStages(const OrderingBarrier &ordering) const {
+VkPipelineStageFlags2KHR ResourceAccessStateData::GetOrderedStages(const OrderingBarrier &ordering) const {
     // Whether the stage are in the ordering scope only matters if the current write is ordered
     VkPipelineStageFlags2KHR ordered_stages = last_read_stages & ordering.exec_scope;
     // Special input attachment handling as always (not encoded in exec_scop)
@@ -3310,7 +3813,8 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetOrderedStages(const OrderingBar
     return ordered_stages;
 }
 
-void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) {
+void ResourceAccessStateData::UpdateFirst(const ResourceUsageTag tag, SyncStageAccessIndex usage_index,
+                                          SyncOrdering ordering_rule) {
     // Only record until we record a write.
     if (first_accesses_.empty() || IsRead(first_accesses_.back().usage_index)) {
         const VkPipelineStageFlags2KHR usage_stage = IsRead(usage_index) ? PipelineStageBit(usage_index) : 0U;
@@ -3326,7 +3830,7 @@ void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, SyncStageAcces
     }
 }
 
-void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering) {
+void ResourceAccessStateData::TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering) {
     // Only call this after recording an image layout transition
     assert(first_accesses_.size());
     if (first_accesses_.back().tag == tag) {
@@ -3336,10 +3840,39 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
+static StateMemoryCounter &SyncAccessContextMemoryCounter() {
+    static StateMemoryCounter *counter = new StateMemoryCounter("CommandBufferAccessContext");
+    return *counter;
+}
+
+CommandBufferAccessContext::~CommandBufferAccessContext() {
+    if (memory_accounted_) {
+        SyncAccessContextMemoryCounter().Remove(accounted_bytes_);
+    }
+}
+
+void CommandBufferAccessContext::UpdateAccountedMemory() {
+    size_t bytes = sizeof(*this) + cb_access_context_.DynamicMemoryUsage() + access_log_->DynamicMemoryUsage() +
+                   VectorMemoryUsage(render_pass_contexts_) + VectorMemoryUsage(sync_ops_);
+    for (const auto &render_pass_context : render_pass_contexts_) {
+        for (const auto &subpass_context : render_pass_context.GetContexts()) {
+            bytes += subpass_context.DynamicMemoryUsage();
+        }
+    }
+    if (memory_accounted_) {
+        SyncAccessContextMemoryCounter().Resize(accounted_bytes_, bytes);
+    } else {
+        SyncAccessContextMemoryCounter().Add(bytes);
+        memory_accounted_ = true;
+    }
+    accounted_bytes_ = bytes;
+}
+
 void SyncValidator::ResetCommandBufferCallback(VkCommandBuffer command_buffer) {
     auto *access_context = GetAccessContextNoInsert(command_buffer);
     if (access_context) {
         access_context->Reset();
+        access_context->UpdateAccountedMemory();
     }
 }
 
@@ -3515,11 +4048,22 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
 
     auto src_image = Get<IMAGE_STATE>(srcImage);
     auto dst_image = Get<IMAGE_STATE>(dstImage);
+    // Two checks per region, the source and then the destination
+    HazardDetectionBatch hazards(*this, *context, 2 * regionCount, [&](uint32_t index) -> HazardResult {
+        const auto &copy_region = pRegions[index / 2];
+        // The batch may detect hazards the loop below never takes, such as for a missing image
+        if (index % 2 == 0) {
+            if (!src_image) return HazardResult();
+            return context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.srcSubresource, copy_region.srcOffset,
+                                         copy_region.extent);
+        }
+        if (!dst_image) return HazardResult();
+        return context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.dstSubresource, copy_region.dstOffset,
+                                     copy_region.extent);
+    });
     for (uint32_t region = 0; region < regionCount; region++) {
-        const auto &copy_region = pRegions[region];
         if (src_image) {
-            auto hazard = context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.srcSubresource,
-                                                copy_region.srcOffset, copy_region.extent);
+            auto hazard = hazards.Take(2 * region);
             if (hazard.hazard) {
                 skip |= LogError(srcImage, string_SyncHazardVUID(hazard.hazard),
                                  "vkCmdCopyImage: Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
@@ -3529,8 +4073,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
         }
 
         if (dst_image) {
-            auto hazard = context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.dstSubresource,
-                                                copy_region.dstOffset, copy_region.extent);
+            auto hazard = hazards.Take(2 * region + 1);
             if (hazard.hazard) {
                 skip |= LogError(dstImage, string_SyncHazardVUID(hazard.hazard),
                                  "vkCmdCopyImage: Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
@@ -3584,11 +4127,22 @@ bool SyncValidator::ValidateCmdCopyImage2(VkCommandBuffer commandBuffer, const V
     auto src_image = Get<IMAGE_STATE>(pCopyImageInfo->srcImage);
     auto dst_image = Get<IMAGE_STATE>(pCopyImageInfo->dstImage);
 
+    // Two checks per region, the source and then the destination
+    HazardDetectionBatch hazards(*this, *context, 2 * pCopyImageInfo->regionCount, [&](uint32_t index) -> HazardResult {
+        const auto &copy_region = pCopyImageInfo->pRegions[index / 2];
+        // The batch may detect hazards the loop below never takes, such as for a missing image
+        if (index % 2 == 0) {
+            if (!src_image) return HazardResult();
+            return context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.srcSubresource, copy_region.srcOffset,
+                                         copy_region.extent);
+        }
+        if (!dst_image) return HazardResult();
+        return context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.dstSubresource, copy_region.dstOffset,
+                                     copy_region.extent);
+    });
     for (uint32_t region = 0; region < pCopyImageInfo->regionCount; region++) {
-        const auto &copy_region = pCopyImageInfo->pRegions[region];
         if (src_image) {
-            auto hazard = context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.srcSubresource,
-                                                copy_region.srcOffset, copy_region.extent);
+            auto hazard = hazards.Take(2 * region);
             if (hazard.hazard) {
                 skip |= LogError(pCopyImageInfo->srcImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", func_name,
@@ -3598,8 +4152,7 @@ bool SyncValidator::ValidateCmdCopyImage2(VkCommandBuffer commandBuffer, const V
         }
 
         if (dst_image) {
-            auto hazard = context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.dstSubresource,
-                                                copy_region.dstOffset, copy_region.extent);
+            auto hazard = hazards.Take(2 * region + 1);
             if (hazard.hazard) {
                 skip |= LogError(pCopyImageInfo->dstImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", func_name,
@@ -3732,6 +4285,29 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuff
                                                            *pDependencyInfo);
 }
 
+// The distinct flags of the queue families render passes can be recorded for
+std::vector<VkQueueFlags> SyncValidator::GetRenderPassQueueFlags() const {
+    std::vector<VkQueueFlags> queue_flags;
+    if (!physical_device_state) return queue_flags;
+    for (const auto &props : physical_device_state->queue_family_properties) {
+        if ((props.queueFlags & VK_QUEUE_GRAPHICS_BIT) &&
+            std::find(queue_flags.cbegin(), queue_flags.cend(), props.queueFlags) == queue_flags.cend()) {
+            queue_flags.emplace_back(props.queueFlags);
+        }
+    }
+    return queue_flags;
+}
+
+std::shared_ptr<RENDER_PASS_STATE> SyncValidator::CreateRenderPassState(VkRenderPass render_pass,
+                                                                        const VkRenderPassCreateInfo *pCreateInfo) {
+    return std::make_shared<SyncRenderPassState>(render_pass, pCreateInfo, GetRenderPassQueueFlags());
+}
+
+std::shared_ptr<RENDER_PASS_STATE> SyncValidator::CreateRenderPassState(VkRenderPass render_pass,
+                                                                        const VkRenderPassCreateInfo2 *pCreateInfo) {
+    return std::make_shared<SyncRenderPassState>(render_pass, pCreateInfo, GetRenderPassQueueFlags());
+}
+
 void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo);
@@ -3741,6 +4317,28 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // TODO: Find a good way to do this hooklessly.
     SetCommandBufferResetCallback([this](VkCommandBuffer command_buffer) -> void { ResetCommandBufferCallback(command_buffer); });
     SetCommandBufferFreeCallback([this](VkCommandBuffer command_buffer) -> void { FreeCommandBufferCallback(command_buffer); });
+
+    housekeeping_.Register("ConsolidateQueueAccesses", [this]() {
+        std::lock_guard<std::mutex> guard(queue_sync_lock_);
+        for (auto &queue_sync_state : queue_sync_states_) {
+            queue_sync_state.second->Consolidate();
+        }
+    });
+}
+
+void SyncValidator::GetValidationCounters(ValidationCounterList &counters) const {
+    ValidationStateTracker::GetValidationCounters(counters);
+    size_t access_states = 0;
+    size_t submissions = 0;
+    {
+        std::lock_guard<std::mutex> guard(queue_sync_lock_);
+        for (const auto &queue_sync_state : queue_sync_states_) {
+            access_states += queue_sync_state.second->AccessStateCount();
+            submissions += queue_sync_state.second->SubmissionCount();
+        }
+    }
+    AddValidationCounter(counters, "SyncValidator.queue_access_states", access_states);
+    AddValidationCounter(counters, "SyncValidator.queue_pending_submissions", submissions);
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -3789,6 +4387,47 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_access_context->Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, result);
+
+    auto *cb_access_context = GetAccessContextNoInsert(commandBuffer);
+    if (cb_access_context) {
+        cb_access_context->Consolidate();
+        cb_access_context->UpdateAccountedMemory();
+        EnforceMemoryBudget(*cb_access_context);
+    }
+}
+
+void SyncValidator::EnforceMemoryBudget(CommandBufferAccessContext &cb_access_context) {
+    if (syncval_max_memory_mb == 0) return;
+    const uint64_t budget = static_cast<uint64_t>(syncval_max_memory_mb) * 1024 * 1024;
+    if (SyncAccessContextMemoryCounter().GetStats().bytes <= budget) return;
+
+    // Up to a block per page, and no coarser than would make most resources share a single state. Past that precision
+    // matters more than the budget.
+    const VkDeviceSize kMinGranularity = 4 * 1024;
+    const VkDeviceSize kMaxGranularity = 16 * 1024 * 1024;
+    VkDeviceSize granularity = std::max(memory_budget_granularity_.load(std::memory_order_relaxed), kMinGranularity);
+    while (true) {
+        cb_access_context.Coarsen(granularity);
+        cb_access_context.UpdateAccountedMemory();
+        if (SyncAccessContextMemoryCounter().GetStats().bytes <= budget || granularity >= kMaxGranularity) break;
+        granularity *= 2;
+    }
+
+    // Tell the user once per step down in precision, whichever thread takes it
+    VkDeviceSize reported = memory_budget_granularity_.load(std::memory_order_relaxed);
+    while (granularity > reported && !memory_budget_granularity_.compare_exchange_weak(reported, granularity)) {
+    }
+    if (granularity > reported) {
+        LogInfo(device, "UNASSIGNED-SYNC-MemoryBudget",
+                "Synchronization validation is over its memory budget of %" PRIu32
+                " MiB (syncval_max_memory_mb). Access state of command buffers is now tracked in blocks of %" PRIu64
+                " bytes, so hazards may be reported between accesses within a block that do not overlap.",
+                syncval_max_memory_mb, static_cast<uint64_t>(granularity));
+    }
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd) {
     auto cb_context = GetAccessContext(commandBuffer);
@@ -3967,14 +4606,23 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
     auto src_buffer = Get<BUFFER_STATE>(srcBuffer);
     auto dst_image = Get<IMAGE_STATE>(dstImage);
 
+    // Two checks per region, the source and then the destination
+    HazardDetectionBatch hazards(*this, *context, dst_image ? 2 * regionCount : 0, [&](uint32_t index) -> HazardResult {
+        const auto &copy_region = pRegions[index / 2];
+        if (index % 2 == 0) {
+            if (!src_buffer) return HazardResult();
+            ResourceAccessRange src_range =
+                MakeRange(copy_region.bufferOffset, GetBufferSizeFromCopyImage(copy_region, dst_image->createInfo.format));
+            return context->DetectHazard(*src_buffer, SYNC_COPY_TRANSFER_READ, src_range);
+        }
+        return context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.imageSubresource, copy_region.imageOffset,
+                                     copy_region.imageExtent);
+    });
     for (uint32_t region = 0; region < regionCount; region++) {
-        const auto &copy_region = pRegions[region];
         HazardResult hazard;
         if (dst_image) {
             if (src_buffer) {
-                ResourceAccessRange src_range =
-                    MakeRange(copy_region.bufferOffset, GetBufferSizeFromCopyImage(copy_region, dst_image->createInfo.format));
-                hazard = context->DetectHazard(*src_buffer, SYNC_COPY_TRANSFER_READ, src_range);
+                hazard = hazards.Take(2 * region);
                 if (hazard.hazard) {
                     // PHASE1 TODO -- add tag information to log msg when useful.
                     skip |= LogError(srcBuffer, string_SyncHazardVUID(hazard.hazard),
@@ -3984,8 +4632,7 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                 }
             }
 
-            hazard = context->DetectHazard(*dst_image, SYNC_COPY_TRANSFER_WRITE, copy_region.imageSubresource,
-                                           copy_region.imageOffset, copy_region.imageExtent);
+            hazard = hazards.Take(2 * region + 1);
             if (hazard.hazard) {
                 skip |= LogError(dstImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", func_name,
@@ -4088,11 +4735,21 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
     auto src_image = Get<IMAGE_STATE>(srcImage);
     auto dst_buffer = Get<BUFFER_STATE>(dstBuffer);
     const auto dst_mem = (dst_buffer && !dst_buffer->sparse) ? dst_buffer->MemState()->mem() : VK_NULL_HANDLE;
+    // Two checks per region, the source and then the destination
+    HazardDetectionBatch hazards(*this, *context, src_image ? 2 * regionCount : 0, [&](uint32_t index) -> HazardResult {
+        const auto &copy_region = pRegions[index / 2];
+        if (index % 2 == 0) {
+            return context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.imageSubresource,
+                                         copy_region.imageOffset, copy_region.imageExtent);
+        }
+        if (!dst_mem) return HazardResult();
+        ResourceAccessRange dst_range =
+            MakeRange(copy_region.bufferOffset, GetBufferSizeFromCopyImage(copy_region, src_image->createInfo.format));
+        return context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
+    });
     for (uint32_t region = 0; region < regionCount; region++) {
-        const auto &copy_region = pRegions[region];
         if (src_image) {
-            auto hazard = context->DetectHazard(*src_image, SYNC_COPY_TRANSFER_READ, copy_region.imageSubresource,
-                                                copy_region.imageOffset, copy_region.imageExtent);
+            auto hazard = hazards.Take(2 * region);
             if (hazard.hazard) {
                 skip |= LogError(srcImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", func_name,
@@ -4100,9 +4757,7 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                                  cb_access_context->FormatUsage(hazard).c_str());
             }
             if (dst_mem) {
-                ResourceAccessRange dst_range =
-                    MakeRange(copy_region.bufferOffset, GetBufferSizeFromCopyImage(copy_region, src_image->createInfo.format));
-                hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
+                hazard = hazards.Take(2 * region + 1);
                 if (hazard.hazard) {
                     skip |= LogError(dstBuffer, string_SyncHazardVUID(hazard.hazard),
                                      "%s: Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.", func_name,
@@ -4205,16 +4860,32 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
     auto src_image = Get<IMAGE_STATE>(srcImage);
     auto dst_image = Get<IMAGE_STATE>(dstImage);
 
-    for (uint32_t region = 0; region < regionCount; region++) {
-        const auto &blit_region = pRegions[region];
-        if (src_image) {
+    // Two checks per region, the source and then the destination
+    HazardDetectionBatch hazards(*this, *context, 2 * regionCount, [&](uint32_t index) -> HazardResult {
+        const auto &blit_region = pRegions[index / 2];
+        // The batch may detect hazards the loop below never takes, such as for a missing image
+        if (index % 2 == 0) {
+            if (!src_image) return HazardResult();
             VkOffset3D offset = {std::min(blit_region.srcOffsets[0].x, blit_region.srcOffsets[1].x),
                                  std::min(blit_region.srcOffsets[0].y, blit_region.srcOffsets[1].y),
                                  std::min(blit_region.srcOffsets[0].z, blit_region.srcOffsets[1].z)};
             VkExtent3D extent = {static_cast<uint32_t>(abs(blit_region.srcOffsets[1].x - blit_region.srcOffsets[0].x)),
                                  static_cast<uint32_t>(abs(blit_region.srcOffsets[1].y - blit_region.srcOffsets[0].y)),
                                  static_cast<uint32_t>(abs(blit_region.srcOffsets[1].z - blit_region.srcOffsets[0].z))};
-            auto hazard = context->DetectHazard(*src_image, SYNC_BLIT_TRANSFER_READ, blit_region.srcSubresource, offset, extent);
+            return context->DetectHazard(*src_image, SYNC_BLIT_TRANSFER_READ, blit_region.srcSubresource, offset, extent);
+        }
+        if (!dst_image) return HazardResult();
+        VkOffset3D offset = {std::min(blit_region.dstOffsets[0].x, blit_region.dstOffsets[1].x),
+                             std::min(blit_region.dstOffsets[0].y, blit_region.dstOffsets[1].y),
+                             std::min(blit_region.dstOffsets[0].z, blit_region.dstOffsets[1].z)};
+        VkExtent3D extent = {static_cast<uint32_t>(abs(blit_region.dstOffsets[1].x - blit_region.dstOffsets[0].x)),
+                             static_cast<uint32_t>(abs(blit_region.dstOffsets[1].y - blit_region.dstOffsets[0].y)),
+                             static_cast<uint32_t>(abs(blit_region.dstOffsets[1].z - blit_region.dstOffsets[0].z))};
+        return context->DetectHazard(*dst_image, SYNC_BLIT_TRANSFER_WRITE, blit_region.dstSubresource, offset, extent);
+    });
+    for (uint32_t region = 0; region < regionCount; region++) {
+        if (src_image) {
+            auto hazard = hazards.Take(2 * region);
             if (hazard.hazard) {
                 skip |= LogError(srcImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", apiName,
@@ -4224,13 +4895,7 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
         }
 
         if (dst_image) {
-            VkOffset3D offset = {std::min(blit_region.dstOffsets[0].x, blit_region.dstOffsets[1].x),
-                                 std::min(blit_region.dstOffsets[0].y, blit_region.dstOffsets[1].y),
-                                 std::min(blit_region.dstOffsets[0].z, blit_region.dstOffsets[1].z)};
-            VkExtent3D extent = {static_cast<uint32_t>(abs(blit_region.dstOffsets[1].x - blit_region.dstOffsets[0].x)),
-                                 static_cast<uint32_t>(abs(blit_region.dstOffsets[1].y - blit_region.dstOffsets[0].y)),
-                                 static_cast<uint32_t>(abs(blit_region.dstOffsets[1].z - blit_region.dstOffsets[0].z))};
-            auto hazard = context->DetectHazard(*dst_image, SYNC_BLIT_TRANSFER_WRITE, blit_region.dstSubresource, offset, extent);
+            auto hazard = hazards.Take(2 * region + 1);
             if (hazard.hazard) {
                 skip |= LogError(dstImage, string_SyncHazardVUID(hazard.hazard),
                                  "%s: Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", apiName,
@@ -4464,7 +5129,7 @@ bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32
     if (!cb_access_context) return skip;
 
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDraw");
-    skip |= cb_access_context->ValidateDrawVertex(vertexCount, firstVertex, "vkCmdDraw");
+    skip |= cb_access_context->ValidateDrawVertex(vertexCount, firstVertex, instanceCount, firstInstance, "vkCmdDraw");
     skip |= cb_access_context->ValidateDrawSubpassAttachment("vkCmdDraw");
     return skip;
 }
@@ -4477,7 +5142,7 @@ void SyncValidator::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t
     const auto tag = cb_access_context->NextCommandTag(CMD_DRAW);
 
     cb_access_context->RecordDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, tag);
-    cb_access_context->RecordDrawVertex(vertexCount, firstVertex, tag);
+    cb_access_context->RecordDrawVertex(vertexCount, firstVertex, instanceCount, firstInstance, tag);
     cb_access_context->RecordDrawSubpassAttachment(tag);
 }
 
@@ -4489,7 +5154,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
     if (!cb_access_context) return skip;
 
     skip |= cb_access_context->ValidateDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDrawIndexed");
-    skip |= cb_access_context->ValidateDrawVertexIndex(indexCount, firstIndex, "vkCmdDrawIndexed");
+    skip |= cb_access_context->ValidateDrawVertexIndex(indexCount, firstIndex, instanceCount, firstInstance, "vkCmdDrawIndexed");
     skip |= cb_access_context->ValidateDrawSubpassAttachment("vkCmdDrawIndexed");
     return skip;
 }
@@ -4502,7 +5167,7 @@ void SyncValidator::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, u
     const auto tag = cb_access_context->NextCommandTag(CMD_DRAWINDEXED);
 
     cb_access_context->RecordDispatchDrawDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, tag);
-    cb_access_context->RecordDrawVertexIndex(indexCount, firstIndex, tag);
+    cb_access_context->RecordDrawVertexIndex(indexCount, firstIndex, instanceCount, firstInstance, tag);
     cb_access_context->RecordDrawSubpassAttachment(tag);
 }
 
@@ -4527,7 +5192,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer
     // TODO: For now, we validate the whole vertex buffer. It might cause some false positive.
     //       VkDrawIndirectCommand buffer could be changed until SubmitQueue.
     //       We will validate the vertex buffer in SubmitQueue in the future.
-    skip |= cb_access_context->ValidateDrawVertex(UINT32_MAX, 0, "vkCmdDrawIndirect");
+    skip |= cb_access_context->ValidateDrawVertex(UINT32_MAX, 0, UINT32_MAX, 0, "vkCmdDrawIndirect");
     return skip;
 }
 
@@ -4548,7 +5213,7 @@ void SyncValidator::PreCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer,
     // TODO: For now, we record the whole vertex buffer. It might cause some false positive.
     //       VkDrawIndirectCommand buffer could be changed until SubmitQueue.
     //       We will record the vertex buffer in SubmitQueue in the future.
-    cb_access_context->RecordDrawVertex(UINT32_MAX, 0, tag);
+    cb_access_context->RecordDrawVertex(UINT32_MAX, 0, UINT32_MAX, 0, tag);
 }
 
 bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -4571,7 +5236,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
     // TODO: For now, we validate the whole index and vertex buffer. It might cause some false positive.
     //       VkDrawIndexedIndirectCommand buffer could be changed until SubmitQueue.
     //       We will validate the index and vertex buffer in SubmitQueue in the future.
-    skip |= cb_access_context->ValidateDrawVertexIndex(UINT32_MAX, 0, "vkCmdDrawIndexedIndirect");
+    skip |= cb_access_context->ValidateDrawVertexIndex(UINT32_MAX, 0, UINT32_MAX, 0, "vkCmdDrawIndexedIndirect");
     return skip;
 }
 
@@ -4591,7 +5256,7 @@ void SyncValidator::PreCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandB
     // TODO: For now, we record the whole index and vertex buffer. It might cause some false positive.
     //       VkDrawIndexedIndirectCommand buffer could be changed until SubmitQueue.
     //       We will record the index and vertex buffer in SubmitQueue in the future.
-    cb_access_context->RecordDrawVertexIndex(UINT32_MAX, 0, tag);
+    cb_access_context->RecordDrawVertexIndex(UINT32_MAX, 0, UINT32_MAX, 0, tag);
 }
 
 bool SyncValidator::ValidateCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -4615,7 +5280,7 @@ bool SyncValidator::ValidateCmdDrawIndirectCount(VkCommandBuffer commandBuffer,
     // TODO: For now, we validate the whole vertex buffer. It might cause some false positive.
     //       VkDrawIndirectCommand buffer could be changed until SubmitQueue.
     //       We will validate the vertex buffer in SubmitQueue in the future.
-    skip |= cb_access_context->ValidateDrawVertex(UINT32_MAX, 0, function);
+    skip |= cb_access_context->ValidateDrawVertex(UINT32_MAX, 0, UINT32_MAX, 0, function);
     return skip;
 }
 
@@ -4643,7 +5308,7 @@ void SyncValidator::RecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, Vk
     // TODO: For now, we record the whole vertex buffer. It might cause some false positive.
     //       VkDrawIndirectCommand buffer could be changed until SubmitQueue.
     //       We will record the vertex buffer in SubmitQueue in the future.
-    cb_access_context->RecordDrawVertex(UINT32_MAX, 0, tag);
+    cb_access_context->RecordDrawVertex(UINT32_MAX, 0, UINT32_MAX, 0, tag);
 }
 
 void SyncValidator::PreCallRecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -4707,7 +5372,7 @@ bool SyncValidator::ValidateCmdDrawIndexedIndirectCount(VkCommandBuffer commandB
     // TODO: For now, we validate the whole index and vertex buffer. It might cause some false positive.
     //       VkDrawIndexedIndirectCommand buffer could be changed until SubmitQueue.
     //       We will validate the index and vertex buffer in SubmitQueue in the future.
-    skip |= cb_access_context->ValidateDrawVertexIndex(UINT32_MAX, 0, function);
+    skip |= cb_access_context->ValidateDrawVertexIndex(UINT32_MAX, 0, UINT32_MAX, 0, function);
     return skip;
 }
 
@@ -4735,7 +5400,7 @@ void SyncValidator::RecordCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuf
     // TODO: For now, we record the whole index and vertex buffer. It might cause some false positive.
     //       VkDrawIndexedIndirectCommand buffer could be changed until SubmitQueue.
     //       We will update the index and vertex buffer in SubmitQueue in the future.
-    cb_access_context->RecordDrawVertexIndex(UINT32_MAX, 0, tag);
+    cb_access_context->RecordDrawVertexIndex(UINT32_MAX, 0, UINT32_MAX, 0, tag);
 }
 
 void SyncValidator::PreCallRecordCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -5617,7 +6282,8 @@ void SyncOpPipelineBarrier::DoRecord(const ResourceUsageTag tag, AccessContext *
     const auto &barrier_set = barriers_[0];
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, tag, access_context);
+    // Resolves the pending state of the buffer and image barriers as well, once applied
+    access_context->AddGlobalBarriers(barrier_set.memory_barriers, tag);
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope);
     } else {
@@ -6501,6 +7167,258 @@ void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
     }
 }
 
+const QueueSyncState::Submission *QueueSyncState::FindSubmission(ResourceUsageTag tag) const {
+    auto found = std::upper_bound(submissions_.cbegin(), submissions_.cend(), tag,
+                                  [](ResourceUsageTag value, const Submission &submission) { return value < submission.base_tag; });
+    if (found == submissions_.cbegin()) return nullptr;
+    --found;
+    return (tag < found->EndTag()) ? &(*found) : nullptr;
+}
+
+std::string QueueSyncState::FormatUsage(const ResourceUsageTag tag) const {
+    std::stringstream out;
+    const auto *submission = FindSubmission(tag);
+    if (!submission) {
+        out << "queue_tag: " << tag;
+        return out.str();
+    }
+    const auto &record = (*submission->access_log)[tag - submission->base_tag];
+    out << string_UsageTag(record);
+    out << ", command_buffer: " << sync_state_->report_data->FormatHandle(record.cb_state->commandBuffer()).c_str();
+    if (record.cb_state->Destroyed()) {
+        out << " (destroyed)";
+    }
+    out << ", reset_no: " << std::to_string(record.reset_count);
+    return out.str();
+}
+
+std::string QueueSyncState::FormatUsage(const ResourceFirstAccess &access) const {
+    std::stringstream out;
+    out << "(submitted_usage: " << string_UsageIndex(access.usage_index);
+    out << ", " << FormatUsage(access.tag) << ")";
+    return out.str();
+}
+
+std::string QueueSyncState::FormatUsage(const HazardResult &hazard) const {
+    std::stringstream out;
+    FormatHazardState(hazard, out);
+    if (hazard.tag < tag_limit_) {
+        out << ", " << FormatUsage(hazard.tag) << ")";
+    }
+    return out.str();
+}
+
+void QueueSyncState::WaitSemaphores(VkPipelineStageFlags2KHR dst_stage_mask) {
+    const auto src = SyncExecScope::MakeSrc(queue_flags_, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR);
+    const auto dst = SyncExecScope::MakeDst(queue_flags_, dst_stage_mask);
+    SyncBarrier barrier(src, dst);
+    barrier.src_access_scope = src.valid_accesses;
+    barrier.dst_access_scope = dst.valid_accesses;
+    ApplyBarrierOpsFunctor<PipelineBarrierOp> barrier_action(true /* resolve */, 1, tag_limit_);
+    barrier_action.EmplaceBack(PipelineBarrierOp(barrier, false));
+    access_context_.ApplyToContext(barrier_action);
+    events_context_.ApplyBarrier(src, dst);
+}
+
+// Mirrors CommandBufferAccessContext::ValidateFirstUse and RecordExecutedCommandBuffer, with this queue as the "proxy" context.
+// Sync op replay validation is skipped, as it needs a command buffer context to run against.
+void QueueSyncState::SubmitCommandBuffer(const CommandBufferAccessContext &cb_context, const char *func_name,
+                                         uint32_t submit_index, uint32_t cb_index) {
+    const AccessContext *recorded_context = cb_context.GetCurrentAccessContext();
+    assert(recorded_context);
+    const auto cb_handle = cb_context.GetCommandBufferState()->commandBuffer();
+    auto log_hazard = [this, &cb_context, cb_handle, func_name, submit_index, cb_index](const HazardResult &hazard) {
+        if (!hazard.hazard) return;
+        sync_state_->LogError(queue_, string_SyncHazardVUID(hazard.hazard),
+                              "%s: Hazard %s for pSubmits[%" PRIu32 "] command buffer %" PRIu32
+                              ", %s, Recorded access info %s. Access info %s.",
+                              func_name, string_SyncHazard(hazard.hazard), submit_index, cb_index,
+                              sync_state_->report_data->FormatHandle(cb_handle).c_str(),
+                              cb_context.FormatUsage(*hazard.recorded_access).c_str(), FormatUsage(hazard).c_str());
+    };
+
+    const ResourceUsageTag base_tag = tag_limit_;
+    ResourceUsageRange tag_range = {0, 0};
+    for (const auto &sync_op : cb_context.GetSyncOps()) {
+        // As in ValidateFirstUse, include the layout transition first use writes stored with the sync op
+        tag_range.end = sync_op.tag + 1;
+        log_hazard(recorded_context->DetectFirstUseHazard(tag_range, access_context_));
+        sync_op.sync_op->DoRecord(base_tag + sync_op.tag, &access_context_, &events_context_);
+        tag_range.begin = tag_range.end;
+    }
+    tag_range.end = ResourceUsageRecord::kMaxIndex;
+    log_hazard(recorded_context->DetectFirstUseHazard(tag_range, access_context_));
+
+    auto access_log = cb_context.GetAccessLog();
+    if (access_log->empty()) return;
+    ResolveRecordedAccesses(*sync_state_, *recorded_context, base_tag, &access_context_);
+    Submission submission;
+    submission.base_tag = base_tag;
+    submission.access_log = std::move(access_log);
+    submission.cb_state = cb_context.GetCommandBufferStateShared();
+    submission.cbs_referenced = cb_context.GetReferencedCommandBuffers();
+    submissions_.emplace_back(std::move(submission));
+    tag_limit_ = submissions_.back().EndTag();
+}
+
+void QueueSyncState::SubmitFence(VkFence fence) {
+    if (fence != VK_NULL_HANDLE) {
+        fences_.emplace_back(fence, tag_limit_);
+    }
+}
+
+void QueueSyncState::WaitFence(VkFence fence) {
+    for (const auto &fence_tag : fences_) {
+        if (fence_tag.first == fence) {
+            WaitTag(fence_tag.second);
+            return;
+        }
+    }
+}
+
+void QueueSyncState::WaitIdle() {
+    access_context_.Reset();
+    events_context_.Clear();
+    submissions_.clear();
+    fences_.clear();
+}
+
+void QueueSyncState::WaitTag(ResourceUsageTag tag) {
+    for (const auto address_type : kAddressTypes) {
+        auto &accesses = access_context_.GetAccessStateMap(address_type);
+        for (auto pos = accesses.begin(); pos != accesses.end();) {
+            pos->second.ApplyTaggedWait(tag);
+            pos = pos->second.HasAccesses() ? std::next(pos) : accesses.erase(pos);
+        }
+    }
+    access_context_.Consolidate();
+
+    // With the accesses gone, nothing refers to the logs of the completed submissions
+    while (!submissions_.empty() && submissions_.front().EndTag() <= tag) {
+        submissions_.pop_front();
+    }
+    auto waited = std::remove_if(fences_.begin(), fences_.end(),
+                                 [tag](const std::pair<VkFence, ResourceUsageTag> &fence_tag) { return fence_tag.second <= tag; });
+    fences_.erase(waited, fences_.end());
+}
+
+size_t QueueSyncState::AccessStateCount() const {
+    size_t count = 0;
+    for (const auto address_type : kAddressTypes) {
+        count += access_context_.GetAccessStateMap(address_type).size();
+    }
+    return count;
+}
+
+QueueSyncState *SyncValidator::GetQueueSyncState(VkQueue queue) {
+    auto found = queue_sync_states_.find(queue);
+    if (found != queue_sync_states_.end()) return found->second.get();
+    auto queue_state = Get<QUEUE_STATE>(queue);
+    if (!queue_state) return nullptr;
+    const auto queue_flags = physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags;
+    auto *queue_sync_state = new QueueSyncState(*this, queue, queue_flags);
+    queue_sync_states_.emplace(queue, std::unique_ptr<QueueSyncState>(queue_sync_state));
+    return queue_sync_state;
+}
+
+// Submissions are checked while they're recorded, as checking them in PreCallValidate would mean copying the queue state
+void SyncValidator::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    StateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    auto *queue_sync_state = GetQueueSyncState(queue);
+    if (!queue_sync_state) return;
+    for (uint32_t submit_index = 0; submit_index < submitCount; ++submit_index) {
+        const auto &submit = pSubmits[submit_index];
+        if (submit.waitSemaphoreCount) {
+            VkPipelineStageFlags2KHR wait_stages = 0;
+            for (uint32_t i = 0; i < submit.waitSemaphoreCount; ++i) {
+                wait_stages |= submit.pWaitDstStageMask[i];
+            }
+            queue_sync_state->WaitSemaphores(wait_stages);
+        }
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferCount; ++cb_index) {
+            const auto *cb_context = GetAccessContextNoInsert(submit.pCommandBuffers[cb_index]);
+            if (!cb_context) continue;
+            queue_sync_state->SubmitCommandBuffer(*cb_context, "vkQueueSubmit", submit_index, cb_index);
+        }
+    }
+    queue_sync_state->SubmitFence(fence);
+}
+
+void SyncValidator::RecordQueueSyncSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    auto *queue_sync_state = GetQueueSyncState(queue);
+    if (!queue_sync_state) return;
+    for (uint32_t submit_index = 0; submit_index < submitCount; ++submit_index) {
+        const auto &submit = pSubmits[submit_index];
+        if (submit.waitSemaphoreInfoCount) {
+            VkPipelineStageFlags2KHR wait_stages = 0;
+            for (uint32_t i = 0; i < submit.waitSemaphoreInfoCount; ++i) {
+                wait_stages |= submit.pWaitSemaphoreInfos[i].stageMask;
+            }
+            queue_sync_state->WaitSemaphores(wait_stages);
+        }
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferInfoCount; ++cb_index) {
+            const auto *cb_context = GetAccessContextNoInsert(submit.pCommandBufferInfos[cb_index].commandBuffer);
+            if (!cb_context) continue;
+            queue_sync_state->SubmitCommandBuffer(*cb_context, "vkQueueSubmit2", submit_index, cb_index);
+        }
+    }
+    queue_sync_state->SubmitFence(fence);
+}
+
+void SyncValidator::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                 VkFence fence) {
+    StateTracker::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    RecordQueueSyncSubmit2(queue, submitCount, pSubmits, fence);
+}
+
+void SyncValidator::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    StateTracker::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
+    RecordQueueSyncSubmit2(queue, submitCount, pSubmits, fence);
+}
+
+void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    StateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    if (result != VK_SUCCESS) return;
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    auto found = queue_sync_states_.find(queue);
+    if (found != queue_sync_states_.end()) {
+        found->second->WaitIdle();
+    }
+}
+
+void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    StateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    if (result != VK_SUCCESS) return;
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    for (auto &queue_sync_state : queue_sync_states_) {
+        queue_sync_state.second->WaitIdle();
+    }
+}
+
+void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                                uint64_t timeout, VkResult result) {
+    StateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    // As in the state tracker, only when every fence is known to be signaled
+    if (result != VK_SUCCESS || ((VK_TRUE != waitAll) && (1 != fenceCount))) return;
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        for (auto &queue_sync_state : queue_sync_states_) {
+            queue_sync_state.second->WaitFence(pFences[i]);
+        }
+    }
+}
+
+void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    StateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    if (result != VK_SUCCESS) return;
+    std::lock_guard<std::mutex> guard(queue_sync_lock_);
+    for (auto &queue_sync_state : queue_sync_states_) {
+        queue_sync_state.second->WaitFence(fence);
+    }
+}
+
 AttachmentViewGen::AttachmentViewGen(const IMAGE_VIEW_STATE *view, const VkOffset3D &offset, const VkExtent3D &extent)
     : view_(view), view_mask_(), gen_store_() {
     if (!view_ || !view_->image_state || !SimpleBinding(*view_->image_state)) return;
@@ -21,8 +21,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <vulkan/vulkan.h>
 
 #include "synchronization_validation_types.h"
@@ -35,6 +39,7 @@ class CommandBufferAccessContext;
 using CommandBufferAccessContextShared = std::shared_ptr<CommandBufferAccessContext>;
 class CommandExecutionContext;
 class ResourceAccessState;
+class ResourceAccessStateData;
 struct ResourceFirstAccess;
 class SyncValidator;
 
@@ -89,6 +94,27 @@ struct SyncStageAccess {
     }
 };
 
+// A single stage/access bit, held as its index. Used for state that never has more than one bit set, where a full
+// SyncStageAccessFlags would cost more storage and a wider test.
+class SyncStageAccessBit {
+  public:
+    SyncStageAccessBit() : index_(SYNC_ACCESS_INDEX_NONE) {}
+    explicit SyncStageAccessBit(SyncStageAccessIndex index) : index_(static_cast<uint16_t>(index)) {}
+
+    SyncStageAccessIndex Index() const { return static_cast<SyncStageAccessIndex>(index_); }
+    bool any() const { return index_ != SYNC_ACCESS_INDEX_NONE; }
+    bool none() const { return index_ == SYNC_ACCESS_INDEX_NONE; }
+    // SYNC_ACCESS_INDEX_NONE has no bit, so it is in no mask, not even ~SyncStageAccessFlags(0)
+    bool In(const SyncStageAccessFlags &mask) const { return any() && mask.test(index_); }
+    SyncStageAccessFlags Flags() const { return syncStageAccessInfoByStageAccessIndex[index_].stage_access_bit; }
+
+    bool operator==(const SyncStageAccessBit &rhs) const { return index_ == rhs.index_; }
+    bool operator!=(const SyncStageAccessBit &rhs) const { return index_ != rhs.index_; }
+
+  private:
+    uint16_t index_;
+};
+
 struct ResourceUsageRecord {
     using TagIndex = size_t;
     using Count = uint32_t;
@@ -113,6 +139,50 @@ struct ResourceUsageRecord {
 using ResourceUsageTag = ResourceUsageRecord::TagIndex;
 using ResourceUsageRange = sparse_container::range<ResourceUsageTag>;
 
+// The usage records of a command buffer (or queue), indexed by tag.
+//
+// Records are kept in chunks, each holding records from a single recording of a single command buffer, so that cb_state and
+// reset_count are stored once per chunk and the rest of a record packs into 64 bits. Chunks are shared and never change once
+// shared, so copying a log, or importing the log of an executed secondary command buffer, references the chunks instead of
+// copying records.
+class AccessLog {
+  public:
+    using Count = ResourceUsageRecord::Count;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    ResourceUsageRecord operator[](ResourceUsageTag tag) const;
+    void emplace_back(CMD_TYPE command, Count seq_num, Count sub_command, const CMD_BUFFER_STATE *cb_state, Count reset_count);
+    void clear() {
+        chunks_.clear();
+        size_ = 0;
+    }
+    // Appends the records of other, sharing its chunks
+    void Append(const AccessLog &other);
+    // Shared chunks are charged in proportion to the logs sharing them
+    size_t DynamicMemoryUsage() const;
+
+  private:
+    // seq_num in the top 32 bits, then sub_command, then command. sub_command saturates, records are only for reporting.
+    static constexpr uint32_t kCommandBits = 10;
+    static constexpr uint32_t kSubCommandBits = 22;
+    static_assert(CMD_RANGE_SIZE <= (1U << kCommandBits), "CMD_TYPE no longer fits in a packed usage record");
+
+    struct Chunk {
+        const CMD_BUFFER_STATE *cb_state;
+        Count reset_count;
+        std::vector<uint64_t> records;
+        Chunk(const CMD_BUFFER_STATE *cb_state_, Count reset_count_) : cb_state(cb_state_), reset_count(reset_count_) {}
+    };
+    struct ChunkRef {
+        ResourceUsageTag begin;  // tag of the first record of the chunk in this log
+        std::shared_ptr<Chunk> chunk;
+    };
+
+    std::vector<ChunkRef> chunks_;
+    size_t size_ = 0;
+};
+
 struct HazardResult {
     std::unique_ptr<const ResourceAccessState> access_state;
     std::unique_ptr<const ResourceFirstAccess> recorded_access;
@@ -120,7 +190,7 @@ struct HazardResult {
     SyncHazard hazard = NONE;
     SyncStageAccessFlags prior_access = 0U;  // TODO -- change to a NONE enum in ...Bits
     ResourceUsageTag tag = ResourceUsageTag();
-    void Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
+    void Set(const ResourceAccessStateData *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
              const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
     void AddRecordedAccess(const ResourceFirstAccess &first_access);
 };
@@ -167,6 +237,33 @@ struct SyncBarrier {
     }
 };
 
+// Sync validation's render pass state.
+//
+// The subpass dependencies are translated to SyncBarriers once, when the render pass is created, for the flags of each queue
+// family able to record it. Beginning a render pass instance then only has to bind the attachment views.
+class SyncRenderPassState : public RENDER_PASS_STATE {
+  public:
+    struct SubpassBarriers {
+        std::vector<std::pair<uint32_t, std::vector<SyncBarrier>>> prev;  // by previous subpass, in subpass order
+        std::vector<SyncBarrier> from_external;
+        std::vector<SyncBarrier> to_external;
+    };
+    using SubpassBarriersVec = std::vector<SubpassBarriers>;
+
+    SyncRenderPassState(VkRenderPass rp, const VkRenderPassCreateInfo *pCreateInfo, const std::vector<VkQueueFlags> &queue_flags);
+    SyncRenderPassState(VkRenderPass rp, const VkRenderPassCreateInfo2 *pCreateInfo,
+                        const std::vector<VkQueueFlags> &queue_flags);
+
+    // Translated on the spot for queue flags no queue family had at creation
+    std::shared_ptr<const SubpassBarriersVec> GetSubpassBarriers(VkQueueFlags queue_flags) const;
+
+  private:
+    void InitSubpassBarriers(const std::vector<VkQueueFlags> &queue_flags);
+    std::shared_ptr<const SubpassBarriersVec> MakeSubpassBarriers(VkQueueFlags queue_flags) const;
+
+    std::vector<std::pair<VkQueueFlags, std::shared_ptr<const SubpassBarriersVec>>> subpass_barriers_;
+};
+
 enum class AccessAddressType : uint32_t { kLinear = 0, kIdealized = 1, kMaxType = 1, kTypeCount = kMaxType + 1 };
 
 struct SyncEventState {
@@ -266,7 +363,11 @@ struct ResourceFirstAccess {
     }
 };
 
-class ResourceAccessState : public SyncStageAccess {
+// The value of a ResourceAccessState, see below. Only ever heap allocated (or the shared default), so that HazardResult can
+// keep a reference to the state it found a hazard in.
+class ResourceAccessStateData : public SyncStageAccess {
+    friend class ResourceAccessState;
+
   protected:
     struct OrderingBarrier {
         VkPipelineStageFlags2KHR exec_scope;
@@ -288,48 +389,133 @@ class ResourceAccessState : public SyncStageAccess {
     // given the only the second execution scope creates a dependency chain, we have to track each,
     // but only up to one per pipeline stage (as another read from the *same* stage become more recent,
     // and applicable one for hazard detection
-    struct ReadState {
-        VkPipelineStageFlags2KHR stage;  // The stage of this read
-        SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
-                                        // TODO: Revisit whether this needs to support multiple reads per stage
-        VkPipelineStageFlags2KHR barriers;  // all applicable barriered stages
-        ResourceUsageTag tag;
-        VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
-                                                     // Excluded from comparison
-        ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
-                  ResourceUsageTag tag_)
-            : stage(stage_), access(access_), barriers(barriers_), tag(tag_), pending_dep_chain(0) {}
-        bool operator==(const ReadState &rhs) const {
-            bool same = (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) && (tag == rhs.tag);
-            return same;
+    //
+    // The reads are stored as one array per field, so that applying barriers and looking for hazards runs over contiguous
+    // stage and barrier masks, which compilers vectorize, and only reads the access and tag of a read found to be a hazard.
+    // The first kInlineCapacity reads are stored inline, more move the arrays to a single heap block.
+    class ReadStates {
+      public:
+        using size_type = uint32_t;
+        static const size_type kInlineCapacity = 3;
+
+        ReadStates() : size_(0), capacity_(kInlineCapacity) {}
+        ReadStates(const ReadStates &other) : ReadStates() { *this = other; }
+        ReadStates &operator=(const ReadStates &other) {
+            if (this == &other) return *this;
+            size_ = 0;
+            Reserve(other.size_);
+            std::copy_n(other.stages(), other.size_, stages());
+            std::copy_n(other.barriers(), other.size_, barriers());
+            std::copy_n(other.pending_dep_chains(), other.size_, pending_dep_chains());
+            std::copy_n(other.tags(), other.size_, tags());
+            std::copy_n(other.accesses(), other.size_, accesses());
+            size_ = other.size_;
+            return *this;
+        }
+
+        size_type size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        void clear() { size_ = 0; }
+        // Keeps the first size reads
+        void truncate(size_type size) { size_ = std::min(size_, size); }
+
+        void push_back(VkPipelineStageFlags2KHR stage, SyncStageAccessBit access, VkPipelineStageFlags2KHR read_barriers,
+                       ResourceUsageTag tag) {
+            if (size_ == capacity_) Reserve(2 * capacity_);
+            size_++;
+            Set(size_ - 1, stage, access, read_barriers, tag);
         }
-        bool IsReadBarrierHazard(VkPipelineStageFlags2KHR src_exec_scope) const {
-            // If the read stage is not in the src sync scope
-            // *AND* not execution chained with an existing sync barrier (that's the or)
-            // then the barrier access is unsafe (R/W after R)
-            return (src_exec_scope & (stage | barriers)) == 0;
+        void push_back(const ReadStates &other, size_type other_index) {
+            push_back(other.stages()[other_index], other.accesses()[other_index], other.barriers()[other_index],
+                      other.tags()[other_index]);
+            pending_dep_chains()[size_ - 1] = other.pending_dep_chains()[other_index];
+        }
+        void Set(size_type index, VkPipelineStageFlags2KHR stage, SyncStageAccessBit access, VkPipelineStageFlags2KHR read_barriers,
+                 ResourceUsageTag tag) {
+            stages()[index] = stage;
+            accesses()[index] = access;
+            barriers()[index] = read_barriers;
+            tags()[index] = tag;
+            pending_dep_chains()[index] = 0;  // If this is a new read, we aren't applying a barrier set.
+        }
+        // Copies the read at index from to index to, for removing reads in place
+        void Move(size_type to, size_type from) {
+            stages()[to] = stages()[from];
+            accesses()[to] = accesses()[from];
+            barriers()[to] = barriers()[from];
+            tags()[to] = tags()[from];
+            pending_dep_chains()[to] = pending_dep_chains()[from];
+        }
+        // The index of the read of stage, or size() if there is none
+        size_type Find(VkPipelineStageFlags2KHR stage) const {
+            const VkPipelineStageFlags2KHR *read_stages = stages();
+            size_type index = 0;
+            while (index < size_ && read_stages[index] != stage) ++index;
+            return index;
         }
 
-        bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        inline void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
-                        ResourceUsageTag tag_) {
-            stage = stage_;
-            access = access_;
-            barriers = barriers_;
-            tag = tag_;
-            pending_dep_chain = 0;  // If this is a new read, we aren't applying a barrier set.
+        // The stage of each read
+        VkPipelineStageFlags2KHR *stages() { return reinterpret_cast<VkPipelineStageFlags2KHR *>(Storage()); }
+        const VkPipelineStageFlags2KHR *stages() const { return reinterpret_cast<const VkPipelineStageFlags2KHR *>(Storage()); }
+        // All applicable barriered stages
+        VkPipelineStageFlags2KHR *barriers() { return stages() + capacity_; }
+        const VkPipelineStageFlags2KHR *barriers() const { return stages() + capacity_; }
+        // Should be zero except during barrier application, excluded from comparison
+        VkPipelineStageFlags2KHR *pending_dep_chains() { return stages() + 2 * capacity_; }
+        const VkPipelineStageFlags2KHR *pending_dep_chains() const { return stages() + 2 * capacity_; }
+        ResourceUsageTag *tags() { return reinterpret_cast<ResourceUsageTag *>(stages() + 3 * capacity_); }
+        const ResourceUsageTag *tags() const { return reinterpret_cast<const ResourceUsageTag *>(stages() + 3 * capacity_); }
+        // TODO: Revisit whether this needs to support multiple reads per stage
+        SyncStageAccessBit *accesses() { return reinterpret_cast<SyncStageAccessBit *>(tags() + capacity_); }
+        const SyncStageAccessBit *accesses() const { return reinterpret_cast<const SyncStageAccessBit *>(tags() + capacity_); }
+
+        bool operator==(const ReadStates &rhs) const {
+            return (size_ == rhs.size_) && std::equal(stages(), stages() + size_, rhs.stages()) &&
+                   std::equal(accesses(), accesses() + size_, rhs.accesses()) &&
+                   std::equal(barriers(), barriers() + size_, rhs.barriers()) &&
+                   std::equal(tags(), tags() + size_, rhs.tags());
+        }
+        bool operator!=(const ReadStates &rhs) const { return !(*this == rhs); }
+
+      private:
+        static const size_t kReadBytes =
+            3 * sizeof(VkPipelineStageFlags2KHR) + sizeof(ResourceUsageTag) + sizeof(SyncStageAccessBit);
+        static const size_t kInlineWords = (kInlineCapacity * kReadBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        static size_t StorageWords(size_type capacity) { return (capacity * kReadBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t); }
+        uint64_t *Storage() { return heap_ ? heap_.get() : inline_; }
+        const uint64_t *Storage() const { return heap_ ? heap_.get() : inline_; }
+        void Reserve(size_type capacity) {
+            if (capacity <= capacity_) return;
+            ReadStates grown;
+            grown.heap_.reset(new uint64_t[StorageWords(capacity)]);
+            grown.capacity_ = capacity;
+            grown = *this;
+            std::swap(heap_, grown.heap_);
+            capacity_ = capacity;
         }
+
+        size_type size_;
+        size_type capacity_;
+        std::unique_ptr<uint64_t[]> heap_;
+        uint64_t inline_[kInlineWords];
     };
 
+    static bool IsReadBarrierHazard(VkPipelineStageFlags2KHR src_exec_scope, VkPipelineStageFlags2KHR read_stage,
+                                    VkPipelineStageFlags2KHR read_barriers) {
+        // If the read stage is not in the src sync scope
+        // *AND* not execution chained with an existing sync barrier (that's the or)
+        // then the barrier access is unsafe (R/W after R)
+        return (src_exec_scope & (read_stage | read_barriers)) == 0;
+    }
+
   public:
     HazardResult DetectHazard(SyncStageAccessIndex usage_index) const;
     HazardResult DetectHazard(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) const;
     HazardResult DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const;
-    HazardResult DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const;
+    HazardResult DetectHazard(const ResourceAccessStateData &recorded_use, const ResourceUsageRange &tag_range) const;
 
     HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, ResourceUsageTag start_tag) const;
-    HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
+    HazardResult DetectAsyncHazard(const ResourceAccessStateData &recorded_use, const ResourceUsageRange &tag_range,
                                    ResourceUsageTag start_tag) const;
 
     HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
@@ -338,29 +524,32 @@ class ResourceAccessState : public SyncStageAccess {
                                      const SyncStageAccessFlags &source_access_scope, ResourceUsageTag event_tag) const;
 
     void Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, ResourceUsageTag tag);
-    void SetWrite(const SyncStageAccessFlags &usage_bit, ResourceUsageTag tag);
-    void Resolve(const ResourceAccessState &other);
+    void SetWrite(SyncStageAccessIndex usage_index, ResourceUsageTag tag);
+    void Resolve(const ResourceAccessStateData &other);
     void ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition);
     void ApplyBarriers(const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag);
     void ApplyBarrier(const SyncBarrier &barrier, bool layout_transition);
     void ApplyBarrier(ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition);
     void ApplyPendingBarriers(ResourceUsageTag tag);
+    // Forget the accesses tagged before tag, which a host wait has shown to be complete
+    void ApplyTaggedWait(ResourceUsageTag tag);
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
 
     void OffsetTag(ResourceUsageTag offset) {
         if (last_write.any()) write_tag += offset;
-        for (auto &read_access : last_reads) {
-            read_access.tag += offset;
+        ResourceUsageTag *read_tags = last_reads.tags();
+        for (ReadStates::size_type i = 0; i < last_reads.size(); ++i) {
+            read_tags[i] += offset;
         }
         for (auto &first : first_accesses_) {
             first.tag += offset;
         }
     }
-    ResourceAccessState()
+    ResourceAccessStateData()
         : write_barriers(~SyncStageAccessFlags(0)),
           write_dependency_chain(0),
           write_tag(),
-          last_write(0),
+          last_write(),
           input_attachment_read(false),
           last_read_stages(0),
           read_execution_barriers(0),
@@ -375,15 +564,16 @@ class ResourceAccessState : public SyncStageAccess {
     bool HasPendingState() const {
         return (0 != pending_layout_transition) || pending_write_barriers.any() || (0 != pending_write_dep_chain);
     }
-    bool HasWriteOp() const { return last_write != 0; }
-    bool operator==(const ResourceAccessState &rhs) const {
+    bool HasWriteOp() const { return last_write.any(); }
+    bool HasAccesses() const { return last_write.any() || !last_reads.empty(); }
+    bool operator==(const ResourceAccessStateData &rhs) const {
         bool same = (write_barriers == rhs.write_barriers) && (write_dependency_chain == rhs.write_dependency_chain) &&
                     (last_reads == rhs.last_reads) && (last_read_stages == rhs.last_read_stages) && (write_tag == rhs.write_tag) &&
                     (input_attachment_read == rhs.input_attachment_read) &&
                     (read_execution_barriers == rhs.read_execution_barriers) && (first_accesses_ == rhs.first_accesses_);
         return same;
     }
-    bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
+    bool operator!=(const ResourceAccessStateData &rhs) const { return !(*this == rhs); }
     VkPipelineStageFlags2KHR GetReadBarriers(const SyncStageAccessFlags &usage) const;
     SyncStageAccessFlags GetWriteBarriers() const { return write_barriers; }
     bool InSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const {
@@ -400,23 +590,19 @@ class ResourceAccessState : public SyncStageAccess {
         // *AND* the current barrier is not in the dependency chain
         // *AND* the there is no prior memory barrier for the previous write in the dependency chain
         // then the barrier access is unsafe (R/W after W)
-        return (last_write != SYNC_IMAGE_LAYOUT_TRANSITION_BIT) && (last_write & src_access_scope).none() &&
+        return (last_write.Index() != SYNC_IMAGE_LAYOUT_TRANSITION) && !last_write.In(src_access_scope) &&
                (((src_exec_scope & write_dependency_chain) == 0) || (write_barriers & src_access_scope).none());
     }
     bool ReadInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope) const {
         return (0 != (src_exec_scope & (last_read_stages | read_execution_barriers)));
     }
     bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const {
-        return (src_access_scope & last_write).any() || (write_dependency_chain & src_exec_scope);
+        return last_write.In(src_access_scope) || (write_dependency_chain & src_exec_scope);
     }
 
     static bool IsReadHazard(VkPipelineStageFlags2KHR stage_mask, const VkPipelineStageFlags2KHR barriers) {
         return stage_mask != (stage_mask & barriers);
     }
-
-    bool IsReadHazard(VkPipelineStageFlags2KHR stage_mask, const ReadState &read_access) const {
-        return IsReadHazard(stage_mask, read_access.barriers);
-    }
     VkPipelineStageFlags2KHR GetOrderedStages(const OrderingBarrier &ordering) const;
 
     void UpdateFirst(ResourceUsageTag tag, SyncStageAccessIndex usage_index, SyncOrdering ordering_rule);
@@ -426,7 +612,6 @@ class ResourceAccessState : public SyncStageAccess {
         return kOrderingRules[static_cast<size_t>(ordering_enum)];
     }
 
-    // TODO: Add a NONE (zero) enum to SyncStageAccessFlags for input_attachment_read and last_write
 
     // With reads, each must be "safe" relative to it's prior write, so we need only
     // save the most recent write operation (as anything *transitively* unsafe would arleady
@@ -434,7 +619,7 @@ class ResourceAccessState : public SyncStageAccess {
     SyncStageAccessFlags write_barriers;          // union of applicable barrier masks since last write
     VkPipelineStageFlags2KHR write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
     ResourceUsageTag write_tag;
-    SyncStageAccessFlags last_write;  // only the most recent write
+    SyncStageAccessBit last_write;  // only the most recent write
 
     // TODO Input Attachment cleanup for multiple reads in a given stage
     // Tracks whether the fragment shader read is input attachment read
@@ -442,7 +627,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
-    small_vector<ReadState, 3, uint32_t> last_reads;
+    ReadStates last_reads;
 
     // Pending execution state to support independent parallel barriers
     VkPipelineStageFlags2KHR pending_write_dep_chain;
@@ -454,11 +639,141 @@ class ResourceAccessState : public SyncStageAccess {
     OrderingBarrier first_write_layout_ordering_;
 
     static OrderingBarriers kOrderingRules;
+
+    // Number of ResourceAccessState values sharing this data. A copy of the data is a new value, with a single owner.
+    struct RefCount {
+        std::atomic<uint32_t> count;
+        RefCount() : count(1) {}
+        RefCount(const RefCount &) : count(1) {}
+        RefCount &operator=(const RefCount &) { return *this; }
+    };
+    mutable RefCount ref_count_;
+};
+
+// Access state of a range of a resource, as stored in the ResourceAccessRangeMap.
+//
+// A ResourceAccessState is a reference to an immutable, intrusively reference counted ResourceAccessStateData. Copies only
+// bump the reference count, so the many ranges that splitting a map entry creates share one value, as do the ranges the
+// update and barrier functors change in the same way. The mutating operations copy the data first if it is shared (copy on
+// write), and states that share data compare equal without looking at it, which keeps range coalescing cheap.
+// Default constructed states share a single, never freed, empty value.
+//
+// The counts are atomic as maps being resolved in parallel can share data with maps other threads are reading.
+class ResourceAccessState {
+  public:
+    using OrderingBarrier = ResourceAccessStateData::OrderingBarrier;
+
+    ResourceAccessState() : data_(&kDefaultData) {}
+    // Shares data, as found by HazardResult::Set
+    explicit ResourceAccessState(const ResourceAccessStateData *data) : data_(const_cast<ResourceAccessStateData *>(data)) {
+        AddRef(data_);
+    }
+    ResourceAccessState(const ResourceAccessState &other) : data_(other.data_) { AddRef(data_); }
+    ResourceAccessState(ResourceAccessState &&other) : data_(other.data_) { other.data_ = &kDefaultData; }
+    ResourceAccessState &operator=(const ResourceAccessState &rhs) {
+        AddRef(rhs.data_);
+        Release(data_);
+        data_ = rhs.data_;
+        return *this;
+    }
+    ResourceAccessState &operator=(ResourceAccessState &&rhs) {
+        std::swap(data_, rhs.data_);
+        return *this;
+    }
+    ~ResourceAccessState() { Release(data_); }
+
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index) const { return data_->DetectHazard(usage_index); }
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule) const {
+        return data_->DetectHazard(usage_index, ordering_rule);
+    }
+    HazardResult DetectHazard(SyncStageAccessIndex usage_index, const OrderingBarrier &ordering) const {
+        return data_->DetectHazard(usage_index, ordering);
+    }
+    HazardResult DetectHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range) const {
+        return data_->DetectHazard(*recorded_use.data_, tag_range);
+    }
+
+    HazardResult DetectAsyncHazard(SyncStageAccessIndex usage_index, ResourceUsageTag start_tag) const {
+        return data_->DetectAsyncHazard(usage_index, start_tag);
+    }
+    HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
+                                   ResourceUsageTag start_tag) const {
+        return data_->DetectAsyncHazard(*recorded_use.data_, tag_range, start_tag);
+    }
+
+    HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
+                                     const SyncStageAccessFlags &source_access_scope) const {
+        return data_->DetectBarrierHazard(usage_index, source_exec_scope, source_access_scope);
+    }
+    HazardResult DetectBarrierHazard(SyncStageAccessIndex usage_index, VkPipelineStageFlags2KHR source_exec_scope,
+                                     const SyncStageAccessFlags &source_access_scope, ResourceUsageTag event_tag) const {
+        return data_->DetectBarrierHazard(usage_index, source_exec_scope, source_access_scope, event_tag);
+    }
+
+    void Update(SyncStageAccessIndex usage_index, SyncOrdering ordering_rule, ResourceUsageTag tag) {
+        Mutable().Update(usage_index, ordering_rule, tag);
+    }
+    void SetWrite(SyncStageAccessIndex usage_index, ResourceUsageTag tag) { Mutable().SetWrite(usage_index, tag); }
+    void Resolve(const ResourceAccessState &other) {
+        // Resolving a state with itself leaves it unchanged
+        if (data_ != other.data_) Mutable().Resolve(*other.data_);
+    }
+    void ApplyBarriers(const std::vector<SyncBarrier> &barriers, bool layout_transition) {
+        Mutable().ApplyBarriers(barriers, layout_transition);
+    }
+    void ApplyBarriers(const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag) { Mutable().ApplyBarriers(barriers, tag); }
+    void ApplyBarrier(const SyncBarrier &barrier, bool layout_transition) { Mutable().ApplyBarrier(barrier, layout_transition); }
+    void ApplyBarrier(ResourceUsageTag scope_tag, const SyncBarrier &barrier, bool layout_transition) {
+        Mutable().ApplyBarrier(scope_tag, barrier, layout_transition);
+    }
+    void ApplyPendingBarriers(ResourceUsageTag tag) { Mutable().ApplyPendingBarriers(tag); }
+    // Forget the accesses tagged before tag, which a host wait has shown to be complete
+    void ApplyTaggedWait(ResourceUsageTag tag) { Mutable().ApplyTaggedWait(tag); }
+    bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const { return data_->FirstAccessInTagRange(tag_range); }
+    void OffsetTag(ResourceUsageTag offset) {
+        if (data_ != &kDefaultData) Mutable().OffsetTag(offset);
+    }
+
+    bool HasPendingState() const { return data_->HasPendingState(); }
+    bool HasWriteOp() const { return data_->HasWriteOp(); }
+    bool HasAccesses() const { return data_->HasAccesses(); }
+    bool operator==(const ResourceAccessState &rhs) const { return (data_ == rhs.data_) || (*data_ == *rhs.data_); }
+    bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
+    VkPipelineStageFlags2KHR GetReadBarriers(const SyncStageAccessFlags &usage) const { return data_->GetReadBarriers(usage); }
+    SyncStageAccessFlags GetWriteBarriers() const { return data_->GetWriteBarriers(); }
+    bool InSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const {
+        return data_->InSourceScopeOrChain(src_exec_scope, src_access_scope);
+    }
+
+    bool IsShared() const { return (data_ == &kDefaultData) || (data_->ref_count_.count.load(std::memory_order_acquire) > 1); }
+    bool SharesData(const ResourceAccessState &other) const { return data_ == other.data_; }
+    // Heap memory held by the data, to be charged once for all the states sharing it
+    size_t DataMemoryUsage() const { return (data_ == &kDefaultData) ? 0 : sizeof(ResourceAccessStateData); }
+
+  private:
+    static void AddRef(const ResourceAccessStateData *data) {
+        if (data != &kDefaultData) data->ref_count_.count.fetch_add(1, std::memory_order_relaxed);
+    }
+    static void Release(const ResourceAccessStateData *data) {
+        if ((data != &kDefaultData) && (data->ref_count_.count.fetch_sub(1, std::memory_order_acq_rel) == 1)) delete data;
+    }
+    ResourceAccessStateData &Mutable() {
+        if (IsShared()) {
+            ResourceAccessStateData *copy = new ResourceAccessStateData(*data_);
+            Release(data_);
+            data_ = copy;
+        }
+        return *data_;
+    }
+
+    ResourceAccessStateData *data_;
+    static ResourceAccessStateData kDefaultData;
 };
+
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
 using ResourceAccessStateConstFunction = std::function<void(const ResourceAccessState &)>;
 
-using ResourceAccessRangeMap = sparse_container::range_map<VkDeviceSize, ResourceAccessState>;
+using ResourceAccessRangeMap = sparse_container::pooled_range_map<VkDeviceSize, ResourceAccessState>;
 using ResourceAccessRange = typename ResourceAccessRangeMap::key_type;
 using ResourceAccessRangeIndex = typename ResourceAccessRange::index_type;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
@@ -735,15 +1050,8 @@ class AccessContext {
         std::vector<SyncBarrier> barriers;
         const AccessContext *context;
         TrackBack(const TrackBack &) = default;
-        TrackBack(const AccessContext *context_, VkQueueFlags queue_flags_,
-                  const std::vector<const VkSubpassDependency2 *> &subpass_dependencies_)
-            : barriers(), context(context_) {
-            barriers.reserve(subpass_dependencies_.size());
-            for (const VkSubpassDependency2 *dependency : subpass_dependencies_) {
-                assert(dependency);
-                barriers.emplace_back(queue_flags_, *dependency);
-            }
-        }
+        TrackBack(const AccessContext *context_, const std::vector<SyncBarrier> &barriers_)
+            : barriers(barriers_), context(context_) {}
         TrackBack &operator=(const TrackBack &) = default;
         TrackBack() = default;
     };
@@ -763,6 +1071,8 @@ class AccessContext {
                               DetectOptions options) const;
     HazardResult DetectHazard(const IMAGE_STATE &image, SyncStageAccessIndex current_usage,
                               const VkImageSubresourceRange &subresource_range) const;
+    // The whole view, using the fragment_ranges of the view when it has them
+    HazardResult DetectHazard(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage) const;
     HazardResult DetectHazard(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                               SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const;
 
@@ -797,9 +1107,11 @@ class AccessContext {
         src_external_ = nullptr;
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
+        pending_global_barriers_.clear();
         for (auto &map : access_state_maps_) {
             map.clear();
         }
+        NoteChange();
     }
 
     // Follow the context previous to access the access state, supporting "lazy" import into the context. Not intended for
@@ -825,6 +1137,8 @@ class AccessContext {
                            const ResourceAccessRange &range, ResourceUsageTag tag);
     void UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const VkImageSubresourceRange &subresource_range, const ResourceUsageTag &tag);
+    void UpdateAccessState(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                           const ResourceUsageTag &tag);
     void UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset, const VkExtent3D &extent,
                            ResourceUsageTag tag);
@@ -849,20 +1163,53 @@ class AccessContext {
     void ApplyToContext(const Action &barrier_action);
     static AccessAddressType ImageAddressType(const IMAGE_STATE &image);
 
-    AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
-                  const std::vector<AccessContext> &contexts, const AccessContext *external_context);
+    AccessContext(uint32_t subpass, const SubpassDependencyGraphNode &dependency,
+                  const SyncRenderPassState::SubpassBarriers &barriers, const std::vector<AccessContext> &contexts,
+                  const AccessContext *external_context);
 
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
 
-    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) { return access_state_maps_[static_cast<size_t>(type)]; }
+    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) {
+        // Whoever writes to the map through here may change any of it
+        NoteChange();
+        ApplyPendingGlobalBarriers();
+        return access_state_maps_[static_cast<size_t>(type)];
+    }
     const ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) const {
+        ApplyPendingGlobalBarriers();
         return access_state_maps_[static_cast<size_t>(type)];
     }
     ResourceAccessRangeMap &GetLinearMap() { return GetAccessStateMap(AccessAddressType::kLinear); }
     const ResourceAccessRangeMap &GetLinearMap() const { return GetAccessStateMap(AccessAddressType::kLinear); }
     ResourceAccessRangeMap &GetIdealizedMap() { return GetAccessStateMap(AccessAddressType::kIdealized); }
     const ResourceAccessRangeMap &GetIdealizedMap() const { return GetAccessStateMap(AccessAddressType::kIdealized); }
+    // Merge neighboring ranges left with identical access state
+    void Consolidate() {
+        ApplyPendingGlobalBarriers();
+        for (auto &map : access_state_maps_) {
+            sparse_container::consolidate(map);
+        }
+    }
+    // Trade precision for memory: merge the access state of all the ranges starting within each granularity sized block, see
+    // sparse_container::coarsen. Hazards between the merged ranges may be reported where there are none, or hidden when a later
+    // write's state replaces an earlier one's. Returns the number of ranges removed.
+    size_t Coarsen(VkDeviceSize granularity);
+    // Estimate of the heap memory held by the access state maps, for memory accounting
+    size_t DynamicMemoryUsage() const {
+        ApplyPendingGlobalBarriers();
+        size_t bytes = 0;
+        for (const auto &map : access_state_maps_) {
+            bytes += NodeContainerMemoryUsage(map);
+            // Neighbouring ranges sharing a state are charged for it once
+            const ResourceAccessState *prev = nullptr;
+            for (const auto &entry : map) {
+                if (!prev || !entry.second.SharesData(*prev)) bytes += entry.second.DataMemoryUsage();
+                prev = &entry.second;
+            }
+        }
+        return bytes;
+    }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -891,8 +1238,59 @@ class AccessContext {
     void SetStartTag(ResourceUsageTag tag) { start_tag_ = tag; }
     template <typename Action>
     void ForAll(Action &&action);
+    // Global memory barriers of a barrier command, resolving the pending barrier state with tag after them. Every range of
+    // both maps is in their scope, so rather than walk the maps for each command, the barriers are queued and applied in one
+    // walk the next time the maps are used. A run of barrier commands then costs a single walk, and a context reset
+    // before it's looked at again costs none.
+    void AddGlobalBarriers(const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag) {
+        NoteChange();
+        pending_global_barriers_.emplace_back(barriers, tag);
+    }
+    // Apply the queued barriers of this context and of every context its hazard checks look back into, after which hazard
+    // detection only reads and can run on several threads at once
+    void ApplyPendingGlobalBarriersForDetection() const;
+
+    // Change tracking, for memos of what earlier hazard checks found. The generation moves on whenever the maps may have
+    // changed anywhere. Accesses recorded by UpdateAccessState instead note the address span they touched, so a memo can tell
+    // whether the memory it depends on was touched since: it's untouched if the generation is unchanged and none of the
+    // spans updated after the memo was made overlap it.
+    struct AccessSpan {
+        AccessAddressType type;
+        ResourceAccessRange range;
+        AccessSpan(AccessAddressType type_, const ResourceAccessRange &range_) : type(type_), range(range_) {}
+        bool Overlaps(const AccessSpan &other) const { return (type == other.type) && range.intersects(other.range); }
+    };
+    uint64_t GetChangeGeneration() const { return change_generation_; }
+    const std::vector<AccessSpan> &GetUpdatedSpans() const { return updated_spans_; }
 
   private:
+    // Past this many spans they're no cheaper to check than the generation
+    static constexpr size_t kMaxUpdatedSpans = 64;
+    void NoteChange() {
+        ++change_generation_;
+        updated_spans_.clear();
+    }
+    ResourceAccessRangeMap &GetAccessStateMapForUpdate(AccessAddressType type, const ResourceAccessRange &span) {
+        ApplyPendingGlobalBarriers();
+        if (updated_spans_.size() < kMaxUpdatedSpans) {
+            updated_spans_.emplace_back(type, span);
+        } else {
+            NoteChange();
+        }
+        return access_state_maps_[static_cast<size_t>(type)];
+    }
+
+    struct GlobalBarrierSet {
+        std::vector<SyncBarrier> barriers;
+        ResourceUsageTag tag;
+        GlobalBarrierSet(const std::vector<SyncBarrier> &barriers_, ResourceUsageTag tag_) : barriers(barriers_), tag(tag_) {}
+    };
+    // The maps with the pending barriers applied are the same state as without, so const accessors apply them too
+    void ApplyPendingGlobalBarriers() const {
+        if (!pending_global_barriers_.empty()) ApplyGlobalBarrierSets();
+    }
+    void ApplyGlobalBarrierSets() const;
+
     template <typename Detector>
     HazardResult DetectHazard(AccessAddressType type, const Detector &detector, const ResourceAccessRange &range,
                               DetectOptions options) const;
@@ -903,7 +1301,10 @@ class AccessContext {
     void UpdateAccessState(AccessAddressType type, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const ResourceAccessRange &range, ResourceUsageTag tag);
 
-    MapArray access_state_maps_;
+    mutable MapArray access_state_maps_;
+    mutable std::vector<GlobalBarrierSet> pending_global_barriers_;
+    uint64_t change_generation_ = 0;
+    std::vector<AccessSpan> updated_spans_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     std::vector<const AccessContext *> async_;
@@ -917,7 +1318,7 @@ class RenderPassAccessContext {
     static AttachmentViewGenVector CreateAttachmentViewGen(const VkRect2D &render_area,
                                                            const std::vector<const IMAGE_VIEW_STATE *> &attachment_views);
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
-    RenderPassAccessContext(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+    RenderPassAccessContext(const SyncRenderPassState &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
                             const std::vector<const IMAGE_VIEW_STATE *> &attachment_views, const AccessContext *external_context);
 
     bool ValidateDrawSubpassAttachment(const CommandExecutionContext &ex_context, const CMD_BUFFER_STATE &cmd,
@@ -989,7 +1390,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
           cb_state_(),
           queue_flags_(),
           destroyed_(false),
-          access_log_(),
+          access_log_(std::make_shared<AccessLog>()),
           cbs_referenced_(),
           command_number_(0),
           subcommand_number_(0),
@@ -1009,12 +1410,17 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     struct AsProxyContext {};
     CommandBufferAccessContext(const CommandBufferAccessContext &real_context, AsProxyContext dummy);
 
-    ~CommandBufferAccessContext() override = default;
+    ~CommandBufferAccessContext() override;
     CommandExecutionContext &GetExecutionContext() { return *this; }
     const CommandExecutionContext &GetExecutionContext() const { return *this; }
 
     void Reset() {
-        access_log_.clear();
+        // A log still held by a queue for a submission made from this recording must not change under it
+        if (access_log_.use_count() > 1) {
+            access_log_ = std::make_shared<AccessLog>();
+        } else {
+            access_log_->clear();
+        }
         cbs_referenced_.clear();
         sync_ops_.clear();
         command_number_ = 0;
@@ -1025,9 +1431,15 @@ class CommandBufferAccessContext : public CommandExecutionContext {
         current_context_ = &cb_access_context_;
         current_renderpass_context_ = nullptr;
         events_context_.Clear();
+        ClearDescriptorAccessMemos();
     }
     void MarkDestroyed() { destroyed_ = true; }
     bool IsDestroyed() const { return destroyed_; }
+    // Merge the ranges split by recording but left with identical access state, once recording is done
+    void Consolidate() { cb_access_context_.Consolidate(); }
+    void Coarsen(VkDeviceSize granularity) { cb_access_context_.Coarsen(granularity); }
+    // Charge the access contexts and access log recorded so far to the sync validation memory counter
+    void UpdateAccountedMemory();
 
     std::string FormatUsage(ResourceUsageTag tag) const override;
     std::string FormatUsage(const ResourceFirstAccess &access) const override;
@@ -1044,10 +1456,15 @@ class CommandBufferAccessContext : public CommandExecutionContext {
 
     bool ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint, const char *func_name) const;
     void RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint, ResourceUsageTag tag);
-    bool ValidateDrawVertex(uint32_t vertexCount, uint32_t firstVertex, const char *func_name) const;
-    void RecordDrawVertex(uint32_t vertexCount, uint32_t firstVertex, ResourceUsageTag tag);
-    bool ValidateDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, const char *func_name) const;
-    void RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, ResourceUsageTag tag);
+    // A count of UINT32_MAX accesses the whole bound buffer range
+    bool ValidateDrawVertex(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance,
+                            const char *func_name) const;
+    void RecordDrawVertex(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance,
+                          ResourceUsageTag tag);
+    bool ValidateDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, uint32_t instanceCount, uint32_t firstInstance,
+                                 const char *func_name) const;
+    void RecordDrawVertexIndex(uint32_t indexCount, uint32_t firstIndex, uint32_t instanceCount, uint32_t firstInstance,
+                               ResourceUsageTag tag);
     bool ValidateDrawSubpassAttachment(const char *func_name) const;
     void RecordDrawSubpassAttachment(ResourceUsageTag tag);
     void RecordNextSubpass(ResourceUsageTag prev_tag, ResourceUsageTag next_tag);
@@ -1061,22 +1478,28 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     ResourceUsageRange ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context);
 
     const CMD_BUFFER_STATE *GetCommandBufferState() const { return cb_state_.get(); }
+    const std::shared_ptr<CMD_BUFFER_STATE> &GetCommandBufferStateShared() const { return cb_state_; }
     VkQueueFlags GetQueueFlags() const { return queue_flags_; }
+    std::shared_ptr<const AccessLog> GetAccessLog() const { return access_log_; }
+    const layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> &GetReferencedCommandBuffers() const {
+        return cbs_referenced_;
+    }
+    const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; }
 
     inline ResourceUsageTag NextSubcommandTag(CMD_TYPE command) {
-        ResourceUsageTag next = access_log_.size();
-        access_log_.emplace_back(command, command_number_, ++subcommand_number_, cb_state_.get(), reset_count_);
+        ResourceUsageTag next = access_log_->size();
+        access_log_->emplace_back(command, command_number_, ++subcommand_number_, cb_state_.get(), reset_count_);
         return next;
     }
-    inline ResourceUsageTag GetTagLimit() const { return access_log_.size(); }
+    inline ResourceUsageTag GetTagLimit() const { return access_log_->size(); }
 
     inline ResourceUsageTag NextCommandTag(CMD_TYPE command) {
         command_number_++;
         subcommand_number_ = 0;
-        ResourceUsageTag next = access_log_.size();
+        ResourceUsageTag next = access_log_->size();
         // The lowest bit is a sub-command number used to separate operations at the end of the previous renderpass
         // from the start of the new one in VkCmdNextRenderpass().
-        access_log_.emplace_back(command, command_number_, subcommand_number_, cb_state_.get(), reset_count_);
+        access_log_->emplace_back(command, command_number_, subcommand_number_, cb_state_.get(), reset_count_);
         return next;
     }
 
@@ -1093,17 +1516,68 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     void RecordSyncOp(Args &&...args) {
         // T must be as derived from SyncOpBase or the compiler will flag the next line as an error.
         SyncOpPointer sync_op(std::make_shared<T>(std::forward<Args>(args)...));
+        // Sync ops change what later accesses are ordered against, even without touching the access maps (as setting an
+        // event does), and render pass ops change the current context
+        ClearDescriptorAccessMemos();
         auto tag = sync_op->Record(this);
         AddSyncOp(tag, std::move(sync_op));
     }
 
   private:
+    // A descriptor access of the bound pipeline, as hazard checked and recorded by draws and dispatches
+    struct DescriptorAccess {
+        const cvdescriptorset::Descriptor *descriptor;
+        const cvdescriptorset::DescriptorSet *descriptor_set;
+        VkDescriptorType descriptor_type;
+        SyncStageAccessIndex sync_index;
+        uint32_t binding;
+        uint32_t index;
+    };
+    // What a descriptor access reads or writes, independent of which descriptor it came through
+    struct DescriptorAccessKey {
+        AccessContext::AccessSpan span;  // the buffer range, or all of the image
+        VkImageSubresourceRange subresource_range;
+        SyncStageAccessIndex sync_index;
+        bool operator==(const DescriptorAccessKey &rhs) const;
+    };
+    // The descriptor accesses of the last draw or dispatch for a bind point, recorded when all of them were reads. A command
+    // with the same accesses, made while nothing has touched the memory they read, finds no hazard the last one didn't
+    // find and leaves the access state as it was. The reads keep the tag of the first command of such a run.
+    struct DescriptorAccessMemo {
+        const AccessContext *context = nullptr;
+        uint64_t generation = 0;
+        size_t span_count = 0;
+        std::vector<DescriptorAccessKey> keys;
+        void Clear() {
+            context = nullptr;
+            keys.clear();
+        }
+    };
+
+    const PIPELINE_STATE *GetDescriptorAccesses(VkPipelineBindPoint pipelineBindPoint,
+                                                std::vector<DescriptorAccess> &accesses) const;
+    // Returns false if any of the accesses write, as those are never memoized
+    static bool MakeDescriptorAccessKeys(const std::vector<DescriptorAccess> &accesses, std::vector<DescriptorAccessKey> &keys);
+    bool IsMemoCurrent(const DescriptorAccessMemo &memo, const std::vector<DescriptorAccessKey> &keys) const;
+    void SetMemo(DescriptorAccessMemo &memo, std::vector<DescriptorAccessKey> &&keys) const;
+    // Graphics and compute only, the bind points drawn or dispatched to most. -1 for the others.
+    static int DescriptorAccessMemoIndex(VkPipelineBindPoint pipelineBindPoint) {
+        return (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS || pipelineBindPoint == VK_PIPELINE_BIND_POINT_COMPUTE)
+                   ? static_cast<int>(pipelineBindPoint)
+                   : -1;
+    }
+    void ClearDescriptorAccessMemos() {
+        for (auto &memo : descriptor_access_memos_) memo.Clear();
+        for (auto &memo : validated_descriptor_accesses_) memo.Clear();
+    }
+
     void AddSyncOp(ResourceUsageTag tag, SyncOpPointer &&sync_op) { sync_ops_.emplace_back(tag, std::move(sync_op)); }
     std::shared_ptr<CMD_BUFFER_STATE> cb_state_;
     VkQueueFlags queue_flags_;
     bool destroyed_;
 
-    std::vector<ResourceUsageRecord> access_log_;
+    // Shared with the queues this recording was submitted to, see Reset()
+    std::shared_ptr<AccessLog> access_log_;
     layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> cbs_referenced_;
     uint32_t command_number_;
     uint32_t subcommand_number_;
@@ -1115,13 +1589,72 @@ class CommandBufferAccessContext : public CommandExecutionContext {
 
     // Don't need the following for an active proxy cb context
     std::vector<RenderPassAccessContext> render_pass_contexts_;
+    bool memory_accounted_ = false;
+    size_t accounted_bytes_ = 0;
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
+
+    std::array<DescriptorAccessMemo, 2> descriptor_access_memos_;
+    // Accesses found free of hazards by the last validation, which the record that follows turns into the memo
+    mutable std::array<DescriptorAccessMemo, 2> validated_descriptor_accesses_;
+};
+
+// The accesses of everything submitted to a queue that isn't yet known to be complete, tagged in a queue wide tag space.
+//
+// A submitted command buffer is checked by replaying its first access summary and sync operations against this state, the
+// same way vkCmdExecuteCommands checks a secondary command buffer. Its recorded accesses are then resolved in, so the cost of
+// a submission follows the number of resources the command buffer touched rather than the number of commands it recorded.
+// Accesses are forgotten once a fence wait or an idle wait shows them to be complete.
+class QueueSyncState : public CommandExecutionContext {
+  public:
+    QueueSyncState(SyncValidator &sync_validator, VkQueue queue, VkQueueFlags queue_flags)
+        : CommandExecutionContext(&sync_validator), queue_(queue), queue_flags_(queue_flags) {}
+
+    std::string FormatUsage(ResourceUsageTag tag) const override;
+    std::string FormatUsage(const ResourceFirstAccess &access) const override;
+    std::string FormatUsage(const HazardResult &hazard) const override;
+
+    // Semaphores are treated as signaled after all prior work, which can hide a hazard but never reports a false one
+    void WaitSemaphores(VkPipelineStageFlags2KHR dst_stage_mask);
+    void SubmitCommandBuffer(const CommandBufferAccessContext &cb_context, const char *func_name, uint32_t submit_index,
+                             uint32_t cb_index);
+    void SubmitFence(VkFence fence);
+    void WaitFence(VkFence fence);
+    void WaitIdle();
+    // Merges the adjacent ranges of equal access state left by the submissions
+    void Consolidate() { access_context_.Consolidate(); }
+    // The ranges of the access state maps, for khronos_validation.validation_counters
+    size_t AccessStateCount() const;
+    size_t SubmissionCount() const { return submissions_.size(); }
+
+  private:
+    struct Submission {
+        ResourceUsageTag base_tag;
+        std::shared_ptr<const AccessLog> access_log;
+        // Keep the command buffers named by the log records alive
+        std::shared_ptr<const CMD_BUFFER_STATE> cb_state;
+        layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> cbs_referenced;
+        ResourceUsageTag EndTag() const { return base_tag + access_log->size(); }
+    };
+    void WaitTag(ResourceUsageTag tag);
+    const Submission *FindSubmission(ResourceUsageTag tag) const;
+
+    VkQueue queue_;
+    VkQueueFlags queue_flags_;
+    ResourceUsageTag tag_limit_ = 0;
+    AccessContext access_context_;
+    SyncEventsContext events_context_;
+    std::deque<Submission> submissions_;
+    // The tag limit at each pending fence signal
+    std::vector<std::pair<VkFence, ResourceUsageTag>> fences_;
 };
 
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
-    SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
+    SyncValidator() {
+        container_type = LayerObjectTypeSyncValidation;
+        use_image_fragment_encoder = true;
+    }
     using StateTracker = ValidationStateTracker;
 
     layer_data::unordered_map<VkCommandBuffer, CommandBufferAccessContextShared> cb_access_state;
@@ -1163,6 +1696,16 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
         return found_it->second.get();
     }
 
+    // Submissions to different queues and the waits retiring them can come from different threads
+    mutable std::mutex queue_sync_lock_;
+    layer_data::unordered_map<VkQueue, std::unique_ptr<QueueSyncState>> queue_sync_states_;
+    QueueSyncState *GetQueueSyncState(VkQueue queue);
+
+    // With syncval_max_memory_mb set, command buffers ending recording past the budget have their access state coarsened.
+    // The granularity starts small and only grows, doubling whenever coarsening to it isn't enough to get back under budget.
+    std::atomic<VkDeviceSize> memory_budget_granularity_{0};
+    void EnforceMemoryBudget(CommandBufferAccessContext &cb_access_context);
+
     void ResetCommandBufferCallback(VkCommandBuffer command_buffer);
     void FreeCommandBufferCallback(VkCommandBuffer command_buffer);
     void RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -1173,6 +1716,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
+    void GetValidationCounters(ValidationCounterList &counters) const override;
+    std::shared_ptr<RENDER_PASS_STATE> CreateRenderPassState(VkRenderPass render_pass,
+                                                             const VkRenderPassCreateInfo *pCreateInfo) override;
+    std::shared_ptr<RENDER_PASS_STATE> CreateRenderPassState(VkRenderPass render_pass,
+                                                             const VkRenderPassCreateInfo2 *pCreateInfo) override;
+    std::vector<VkQueueFlags> GetRenderPassQueueFlags() const;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd) const;
@@ -1237,6 +1786,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           VkResult result) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents) override;
@@ -1518,4 +2068,15 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                            const VkCommandBuffer *pCommandBuffers) const override;
     void PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                          const VkCommandBuffer *pCommandBuffers) override;
+
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) override;
+    void RecordQueueSyncSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence);
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                      VkFence fence) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
 };
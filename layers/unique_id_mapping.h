@@ -0,0 +1,200 @@
+/* Copyright (c) 2015-2022 The Khronos Group Inc.
+ * Copyright (c) 2015-2022 Valve Corporation
+ * Copyright (c) 2015-2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "vk_layer_data.h"
+#include "vk_layer_utils.h"
+
+// To avoid re-hashing unique ids on each use, we precompute the hash and store the
+// hash's LSBs in the high 24 bits.
+struct HashedUint64 {
+    static const int HASHED_UINT64_SHIFT = 40;
+    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
+
+    static uint64_t hash(uint64_t id) {
+        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
+        id |= h << HASHED_UINT64_SHIFT;
+        return id;
+    }
+};
+
+// Generation-tagged slab of driver handles, indexed directly by the wrapped id.
+//
+// A wrapped id holds the slot index (plus one, so that an id is never 0) in the low 32 bits and the slot generation in the high
+// 32 bits. Looking up an id is a page pointer load and a slot load with no hashing and no locks. Allocating and releasing slots
+// is serialized by a mutex, these only happen on object creation and destruction. Releasing a slot bumps its generation so
+// stale ids for destroyed objects do not resolve to a recycled slot.
+class LockFreeHandleSlab {
+  public:
+    using FindResult = vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>::FindResult;
+
+    LockFreeHandleSlab() {
+        for (auto &page : pages_) {
+            page.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~LockFreeHandleSlab() {
+        for (auto &page : pages_) {
+            delete[] page.load(std::memory_order_relaxed);
+        }
+    }
+    LockFreeHandleSlab(const LockFreeHandleSlab &) = delete;
+    LockFreeHandleSlab &operator=(const LockFreeHandleSlab &) = delete;
+
+    uint64_t Insert(uint64_t handle) {
+        std::lock_guard<std::mutex> guard(alloc_lock_);
+        uint32_t index;
+        if (!free_slots_.empty()) {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            index = next_slot_++;
+            const uint32_t page_index = index >> kPageBits;
+            assert(page_index < kMaxPages);
+            if (!pages_[page_index].load(std::memory_order_relaxed)) {
+                pages_[page_index].store(new Slot[kPageSize], std::memory_order_release);
+            }
+        }
+        Slot &slot = GetSlot(index);
+        slot.handle.store(handle, std::memory_order_release);
+        ++active_slots_;
+        return MakeId(index, slot.generation.load(std::memory_order_relaxed));
+    }
+
+    FindResult find(uint64_t id) const {
+        const Slot *slot = Lookup(id);
+        if (slot) {
+            const uint64_t handle = slot->handle.load(std::memory_order_acquire);
+            if (handle) return FindResult(true, handle);
+        }
+        return end();
+    }
+
+    FindResult pop(uint64_t id) {
+        std::lock_guard<std::mutex> guard(alloc_lock_);
+        Slot *slot = const_cast<Slot *>(Lookup(id));
+        if (!slot) return end();
+        const uint64_t handle = slot->handle.exchange(0, std::memory_order_acq_rel);
+        if (!handle) return end();
+        slot->generation.fetch_add(1, std::memory_order_release);
+        free_slots_.push_back(static_cast<uint32_t>(id) - 1);
+        --active_slots_;
+        return FindResult(true, handle);
+    }
+
+    size_t erase(uint64_t id) { return pop(id) != end() ? 1 : 0; }
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> guard(alloc_lock_);
+        return active_slots_ == 0;
+    }
+
+  private:
+    static const uint32_t kPageBits = 12;
+    static const uint32_t kPageSize = 1u << kPageBits;
+    static const uint32_t kMaxPages = 1u << 14;
+
+    struct Slot {
+        std::atomic<uint64_t> handle{0};
+        std::atomic<uint32_t> generation{0};
+    };
+
+    static uint64_t MakeId(uint32_t index, uint32_t generation) {
+        return (static_cast<uint64_t>(generation) << 32) | (static_cast<uint64_t>(index) + 1);
+    }
+
+    Slot &GetSlot(uint32_t index) const {
+        return pages_[index >> kPageBits].load(std::memory_order_acquire)[index & (kPageSize - 1)];
+    }
+
+    // Returns the slot an id refers to, or nullptr if the id was never allocated or its object has since been destroyed
+    const Slot *Lookup(uint64_t id) const {
+        const uint32_t encoded_index = static_cast<uint32_t>(id);
+        if (encoded_index == 0) return nullptr;
+        const uint32_t index = encoded_index - 1;
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= kMaxPages) return nullptr;
+        const Slot *page = pages_[page_index].load(std::memory_order_acquire);
+        if (!page) return nullptr;
+        const Slot &slot = page[index & (kPageSize - 1)];
+        if (slot.generation.load(std::memory_order_acquire) != static_cast<uint32_t>(id >> 32)) return nullptr;
+        return &slot;
+    }
+
+    mutable std::mutex alloc_lock_;
+    std::atomic<Slot *> pages_[kMaxPages];
+    std::vector<uint32_t> free_slots_;
+    uint32_t next_slot_ = 0;
+    size_t active_slots_ = 0;
+};
+
+// Map from wrapped (unique id) handles to the driver handles they stand for. The default backend is a sharded hash map; the
+// lock-free handle slab can be selected by an instance created while no other one exists.
+class UniqueIdMapping {
+  public:
+    using FindResult = vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>::FindResult;
+
+    // Called for each instance created, with the backend it asks for. The backend only switches when no other instance exists,
+    // as then no thread can be wrapping or looking up handles, and the ids left by destroyed instances can no longer be used.
+    // Instances created alongside others keep the backend in use. Returns whether the requested backend is the one in use.
+    bool AddInstance(bool lock_free) {
+        std::lock_guard<std::mutex> guard(instance_lock_);
+        if (instance_count_++ == 0) {
+            lock_free_.store(lock_free, std::memory_order_relaxed);
+        }
+        return lock_free_.load(std::memory_order_relaxed) == lock_free;
+    }
+    void RemoveInstance() {
+        std::lock_guard<std::mutex> guard(instance_lock_);
+        assert(instance_count_ > 0);
+        --instance_count_;
+    }
+    // Anything using a wrapped handle happens after its instance was added, which ordered it after the last switch
+    bool IsLockFree() const { return lock_free_.load(std::memory_order_relaxed); }
+
+    // Wrap a driver handle with a new unique id, and return the new id
+    uint64_t Wrap(uint64_t handle) {
+        if (IsLockFree()) {
+            return slab_.Insert(handle);
+        }
+        auto unique_id = HashedUint64::hash(next_unique_id_++);
+        hash_map_.insert_or_assign(unique_id, handle);
+        return unique_id;
+    }
+
+    FindResult find(uint64_t unique_id) const { return IsLockFree() ? slab_.find(unique_id) : hash_map_.find(unique_id); }
+
+    FindResult pop(uint64_t unique_id) { return IsLockFree() ? slab_.pop(unique_id) : hash_map_.pop(unique_id); }
+
+    size_t erase(uint64_t unique_id) { return IsLockFree() ? slab_.erase(unique_id) : hash_map_.erase(unique_id); }
+
+    FindResult end() const { return hash_map_.end(); }
+
+  private:
+    std::mutex instance_lock_;
+    uint32_t instance_count_ = 0;
+    std::atomic<bool> lock_free_{false};
+    std::atomic<uint64_t> next_unique_id_{1};
+    vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> hash_map_;
+    LockFreeHandleSlab slab_;
+};
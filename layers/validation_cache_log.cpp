@@ -0,0 +1,343 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "validation_cache_log.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(_WIN32)
+using FileHandle = HANDLE;
+const FileHandle kNoFile = INVALID_HANDLE_VALUE;
+
+FileHandle OpenCacheFile(const std::string &path, bool write) {
+    const DWORD access = write ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    return CreateFileA(path.c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                       write ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+}
+
+FileHandle CreateCacheFile(const std::string &path) {
+    return CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+}
+
+void CloseCacheFile(FileHandle file) { CloseHandle(file); }
+
+bool LockCacheFile(FileHandle file, bool exclusive) {
+    OVERLAPPED overlapped = {};
+    return LockFileEx(file, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+}
+
+void UnlockCacheFile(FileHandle file) {
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+}
+
+bool CacheFileSize(FileHandle file, uint64_t &size) {
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) return false;
+    size = static_cast<uint64_t>(file_size.QuadPart);
+    return true;
+}
+
+bool WriteCacheFile(FileHandle file, uint64_t offset, const void *data, size_t size) {
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD written = 0;
+    return WriteFile(file, data, static_cast<DWORD>(size), &written, &overlapped) && written == size;
+}
+
+bool TruncateCacheFile(FileHandle file, uint64_t size) {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    return SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+}
+
+bool SyncCacheFile(FileHandle file) { return FlushFileBuffers(file) != 0; }
+
+bool ReplaceCacheFile(const std::string &from, const std::string &to) {
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+// A read only view of the whole file
+class MappedCacheFile {
+  public:
+    MappedCacheFile(FileHandle file, uint64_t size) {
+        if (size == 0 || size > SIZE_MAX) return;
+        mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) return;
+        data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (data_) size_ = static_cast<size_t>(size);
+    }
+    ~MappedCacheFile() {
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+    }
+    const void *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    HANDLE mapping_ = nullptr;
+    void *data_ = nullptr;
+    size_t size_ = 0;
+};
+#else
+using FileHandle = int;
+const FileHandle kNoFile = -1;
+
+FileHandle OpenCacheFile(const std::string &path, bool write) {
+    return open(path.c_str(), write ? (O_RDWR | O_CREAT | O_CLOEXEC) : (O_RDONLY | O_CLOEXEC), 0644);
+}
+
+FileHandle CreateCacheFile(const std::string &path) { return open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644); }
+
+void CloseCacheFile(FileHandle file) { close(file); }
+
+bool LockCacheFile(FileHandle file, bool exclusive) {
+    int result;
+    do {
+        result = flock(file, exclusive ? LOCK_EX : LOCK_SH);
+    } while (result != 0 && errno == EINTR);
+    return result == 0;
+}
+
+void UnlockCacheFile(FileHandle file) { flock(file, LOCK_UN); }
+
+bool CacheFileSize(FileHandle file, uint64_t &size) {
+    struct stat info;
+    if (fstat(file, &info) != 0) return false;
+    size = static_cast<uint64_t>(info.st_size);
+    return true;
+}
+
+bool WriteCacheFile(FileHandle file, uint64_t offset, const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        const ssize_t written = pwrite(file, bytes, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        offset += static_cast<uint64_t>(written);
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool TruncateCacheFile(FileHandle file, uint64_t size) { return ftruncate(file, static_cast<off_t>(size)) == 0; }
+
+bool SyncCacheFile(FileHandle file) { return fsync(file) == 0; }
+
+bool ReplaceCacheFile(const std::string &from, const std::string &to) { return rename(from.c_str(), to.c_str()) == 0; }
+
+// A read only view of the whole file
+class MappedCacheFile {
+  public:
+    MappedCacheFile(FileHandle file, uint64_t size) {
+        if (size == 0 || size > SIZE_MAX) return;
+        void *data = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, file, 0);
+        if (data == MAP_FAILED) return;
+        data_ = data;
+        size_ = static_cast<size_t>(size);
+    }
+    ~MappedCacheFile() {
+        if (data_) munmap(data_, size_);
+    }
+    const void *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    void *data_ = nullptr;
+    size_t size_ = 0;
+};
+#endif
+
+// Releases the lock on the log when leaving the scope
+class FileLockGuard {
+  public:
+    FileLockGuard(FileHandle file, bool exclusive) : file_(file), locked_(LockCacheFile(file, exclusive)) {}
+    ~FileLockGuard() {
+        if (locked_) UnlockCacheFile(file_);
+    }
+    bool Locked() const { return locked_; }
+
+  private:
+    FileHandle file_;
+    bool locked_;
+};
+
+}  // namespace
+
+uint32_t ValidationCacheLog::Checksum(const uint32_t *words, size_t count) {
+    // FNV-1a, seeded so that a zeroed record doesn't check out
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < count; ++i) {
+        hash = (hash ^ words[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void ValidationCacheLog::MakeHeader(uint32_t *header) const {
+    header[0] = kMagic;
+    header[1] = kVersion;
+    memcpy(&header[2], uuid_, VK_UUID_SIZE);
+}
+
+bool ValidationCacheLog::Open(const std::string &path, const uint8_t uuid[VK_UUID_SIZE]) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (opened_) return true;
+    path_ = path;
+    log_path_ = path + ".log";
+    memcpy(uuid_, uuid, VK_UUID_SIZE);
+
+    FileHandle file = OpenCacheFile(log_path_, true);
+    if (file == kNoFile) return false;
+    bool usable = false;
+    {
+        FileLockGuard file_lock(file, true);
+        if (file_lock.Locked()) {
+            uint32_t header[kHeaderWords];
+            MakeHeader(header);
+            uint64_t size = 0;
+            bool valid = CacheFileSize(file, size) && size >= sizeof(header);
+            if (valid) {
+                MappedCacheFile mapped(file, size);
+                valid = mapped.Data() && memcmp(mapped.Data(), header, sizeof(header)) == 0;
+            }
+            // A new log, or one of another layout or spirv-tools commit, whose snapshot is ignored as well
+            usable = valid || (TruncateCacheFile(file, 0) && WriteCacheFile(file, 0, header, sizeof(header)));
+        }
+    }
+    if (!usable) {
+        CloseCacheFile(file);
+        return false;
+    }
+    file_ = file;
+    opened_ = true;
+    return true;
+}
+
+void ValidationCacheLog::Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!opened_) return;
+    CloseCacheFile(file_);
+    file_ = kNoFile;
+    opened_ = false;
+}
+
+bool ValidationCacheLog::ReadLocked(const LoadFunction &load) {
+    uint64_t log_size = 0;
+    if (!CacheFileSize(file_, log_size)) return false;
+    std::vector<Record> records;
+    {
+        MappedCacheFile mapped_log(file_, log_size);
+        const auto *words = static_cast<const uint32_t *>(mapped_log.Data());
+        const size_t word_count = mapped_log.Size() / sizeof(uint32_t);
+        for (size_t offset = kHeaderWords; words && offset + kRecordWords <= word_count; offset += kRecordWords) {
+            const uint32_t *record_words = words + offset;
+            // Skip the records torn by a killed process
+            if (Checksum(record_words, kRecordWords - 1) != record_words[kRecordWords - 1]) continue;
+            Record record;
+            record.type = record_words[0];
+            memcpy(record.payload, record_words + 1, sizeof(record.payload));
+            records.push_back(record);
+        }
+    }
+    record_count_.store(records.size());
+
+    FileHandle snapshot_file = OpenCacheFile(path_, false);
+    if (snapshot_file == kNoFile) {
+        load(nullptr, 0, records);
+        return true;
+    }
+    uint64_t snapshot_size = 0;
+    if (!CacheFileSize(snapshot_file, snapshot_size)) snapshot_size = 0;
+    {
+        MappedCacheFile mapped_snapshot(snapshot_file, snapshot_size);
+        load(mapped_snapshot.Data(), mapped_snapshot.Size(), records);
+    }
+    CloseCacheFile(snapshot_file);
+    return true;
+}
+
+bool ValidationCacheLog::Load(const LoadFunction &load) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!opened_) return false;
+    FileLockGuard file_lock(file_, false);
+    if (!file_lock.Locked()) return false;
+    return ReadLocked(load);
+}
+
+void ValidationCacheLog::Append(const Record &record) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!opened_) return;
+    uint32_t words[kRecordWords];
+    words[0] = record.type;
+    memcpy(words + 1, record.payload, sizeof(record.payload));
+    words[kRecordWords - 1] = Checksum(words, kRecordWords - 1);
+
+    FileLockGuard file_lock(file_, true);
+    if (!file_lock.Locked()) return;
+    uint64_t size = 0;
+    if (!CacheFileSize(file_, size) || size < kHeaderWords * sizeof(uint32_t)) return;
+    // Start after the last whole record, overwriting the tail a killed process may have left
+    const uint64_t record_bytes = kRecordWords * sizeof(uint32_t);
+    const uint64_t header_bytes = kHeaderWords * sizeof(uint32_t);
+    const uint64_t offset = header_bytes + ((size - header_bytes) / record_bytes) * record_bytes;
+    if (WriteCacheFile(file_, offset, words, sizeof(words))) {
+        record_count_++;
+    }
+}
+
+bool ValidationCacheLog::Compact(const CompactFunction &compact) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!opened_) return false;
+    FileLockGuard file_lock(file_, true);
+    if (!file_lock.Locked()) return false;
+
+    std::vector<char> new_snapshot;
+    const bool read = ReadLocked([&compact, &new_snapshot](const void *snapshot, size_t snapshot_size,
+                                                            const std::vector<Record> &records) {
+        compact(snapshot, snapshot_size, records, new_snapshot);
+    });
+    if (!read) return false;
+
+    // Readers only see the old snapshot or the whole new one
+    const std::string temp_path = path_ + ".tmp";
+    FileHandle temp_file = CreateCacheFile(temp_path);
+    if (temp_file == kNoFile) return false;
+    const bool written = WriteCacheFile(temp_file, 0, new_snapshot.data(), new_snapshot.size()) && SyncCacheFile(temp_file);
+    CloseCacheFile(temp_file);
+    if (!written || !ReplaceCacheFile(temp_path, path_)) return false;
+
+    // The snapshot now holds the records
+    if (!TruncateCacheFile(file_, kHeaderWords * sizeof(uint32_t))) return false;
+    record_count_.store(0);
+    return true;
+}
@@ -0,0 +1,95 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// The on-disk form of the core validation cache, safe against killed runs and shared by the processes using the same path.
+//
+// The cache file at path holds a snapshot in the VkValidationCacheEXT data layout, and path + ".log" the entries validated
+// since, each appended as soon as it is found. Records are of a fixed size and carry a checksum, so that a record torn by a
+// killed process is skipped and the next append starts on a record boundary again. Compact() folds the log into a new
+// snapshot, written to a temporary file and renamed over the old one, and empties the log.
+//
+// Both files are only accessed with the log locked, shared to load and exclusive to append or compact, so a process compacting
+// sees every record the others appended. They are read through memory maps.
+class ValidationCacheLog {
+  public:
+    enum RecordType : uint32_t {
+        kShaderHashRecord = 1,  // the ValidationCache shader hash entry words
+        kSpecializationRecord,  // the ValidationCache specialization entry words
+    };
+    static const uint32_t kRecordPayloadWords = 5;
+    struct Record {
+        uint32_t type;
+        uint32_t payload[kRecordPayloadWords];
+    };
+    // The mapped snapshot, empty if there is none yet, and the valid records of the log
+    using LoadFunction = std::function<void(const void *snapshot, size_t snapshot_size, const std::vector<Record> &records)>;
+    // Also writes the data of the new snapshot, which must hold the snapshot and records it is given
+    using CompactFunction = std::function<void(const void *snapshot, size_t snapshot_size, const std::vector<Record> &records,
+                                               std::vector<char> &new_snapshot)>;
+
+    ValidationCacheLog() = default;
+    ValidationCacheLog(const ValidationCacheLog &) = delete;
+    ValidationCacheLog &operator=(const ValidationCacheLog &) = delete;
+    ~ValidationCacheLog() { Close(); }
+
+    // Opens the log of the cache at path, starting it over if it was written for another uuid. Returns false if it can't be
+    // used, in which case the other calls do nothing.
+    bool Open(const std::string &path, const uint8_t uuid[VK_UUID_SIZE]);
+    void Close();
+    bool IsOpen() const { return opened_; }
+
+    bool Load(const LoadFunction &load);
+    void Append(const Record &record);
+    bool Compact(const CompactFunction &compact);
+
+    // The records in the log as of the last load or compaction, and those appended by this process since
+    size_t RecordCount() const { return record_count_.load(); }
+
+  private:
+    static const uint32_t kMagic = 0x4C435656;  // "VVCL"
+    static const uint32_t kVersion = 1;
+    static const size_t kHeaderWords = 2 + VK_UUID_SIZE / sizeof(uint32_t);
+    // The record words, then the checksum
+    static const size_t kRecordWords = 1 + kRecordPayloadWords + 1;
+
+    static uint32_t Checksum(const uint32_t *words, size_t count);
+    void MakeHeader(uint32_t *header) const;
+    // The log must be locked
+    bool ReadLocked(const LoadFunction &load);
+
+    std::mutex lock_;
+    std::string path_;
+    std::string log_path_;
+    uint8_t uuid_[VK_UUID_SIZE] = {};
+    bool opened_ = false;
+#if defined(_WIN32)
+    void *file_ = nullptr;
+#else
+    int file_ = -1;
+#endif
+    std::atomic<size_t> record_count_{0};
+};
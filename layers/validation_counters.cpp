@@ -0,0 +1,80 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "validation_counters.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+std::atomic<bool> validation_counters_enabled{false};
+
+namespace {
+
+std::atomic<uint32_t> counters_present_interval{0};
+std::atomic<uint64_t> counters_presents{0};
+
+}  // namespace
+
+void AddValidationCounter(ValidationCounterList &counters, const char *name, uint64_t value) {
+    if (value != 0) counters.push_back(ValidationCounterValue{name, value});
+}
+
+void EnableValidationCounters(uint32_t present_interval) {
+    if (validation_counters_enabled.exchange(true)) return;
+    counters_present_interval.store(present_interval);
+}
+
+bool ValidationCountersFramePresented() {
+    if (!validation_counters_enabled.load(std::memory_order_relaxed)) return false;
+    const uint32_t interval = counters_present_interval.load(std::memory_order_relaxed);
+    if (interval == 0) return false;
+    return (counters_presents.fetch_add(1, std::memory_order_relaxed) + 1) % interval == 0;
+}
+
+VkResult CopyValidationCounters(const ValidationCounterList &counters, uint32_t *counter_count,
+                                VkValidationCounterLAYER *out_counters) {
+    if (!counter_count) return VK_ERROR_INITIALIZATION_FAILED;
+    const uint32_t available = static_cast<uint32_t>(counters.size());
+    if (!out_counters) {
+        *counter_count = available;
+        return VK_SUCCESS;
+    }
+    const uint32_t copied = std::min(*counter_count, available);
+    for (uint32_t i = 0; i < copied; ++i) {
+        const std::string &name = counters[i].name;
+        const size_t length = std::min(name.size(), static_cast<size_t>(VK_MAX_DESCRIPTION_SIZE - 1));
+        memcpy(out_counters[i].name, name.c_str(), length);
+        out_counters[i].name[length] = '\0';
+        out_counters[i].value = counters[i].value;
+    }
+    *counter_count = copied;
+    return copied < available ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+std::string FormatValidationCounters(const ValidationCounterList &counters) {
+    std::string text = "Validation counters:";
+    char value[32];
+    for (const auto &counter : counters) {
+        snprintf(value, sizeof(value), "%" PRIu64, counter.value);
+        text += "\n    ";
+        text += counter.name;
+        text += " = ";
+        text += value;
+    }
+    return text;
+}
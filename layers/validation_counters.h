@@ -0,0 +1,82 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// Counters of the layer's own work, collected when khronos_validation.validation_counters is set: the calls validated per
+// entry point by the chassis, the checks the layer's caches let skip, the sizes of the larger state and the latency of the
+// GPU-Assisted and debug printf readbacks.
+//
+// Applications read them with the device-level vkGetValidationCountersLAYER, which vkGetDeviceProcAddr returns while the
+// layer is enabled, with the usual two-call idiom. The declarations below are all an application needs. With
+// khronos_validation.validation_counters_interval, they are also logged as an information message every that many presents.
+// Counter names are "<validation object>.<counter>" and only counters that are not 0 are listed.
+
+#define VK_LAYER_VALIDATION_COUNTERS_FUNCTION_NAME "vkGetValidationCountersLAYER"
+
+typedef struct VkValidationCounterLAYER {
+    char name[VK_MAX_DESCRIPTION_SIZE];
+    uint64_t value;
+} VkValidationCounterLAYER;
+
+typedef VkResult(VKAPI_PTR *PFN_vkGetValidationCountersLAYER)(VkDevice device, uint32_t *pCounterCount,
+                                                              VkValidationCounterLAYER *pCounters);
+
+extern std::atomic<bool> validation_counters_enabled;
+
+// Counts while validation counters are enabled. Relaxed, as the counters are only ever read as a whole.
+class ValidationCounter {
+  public:
+    void Add(uint64_t count = 1) const {
+        if (validation_counters_enabled.load(std::memory_order_relaxed)) value_.fetch_add(count, std::memory_order_relaxed);
+    }
+    // Keeps the largest value seen
+    void Max(uint64_t value) const {
+        if (!validation_counters_enabled.load(std::memory_order_relaxed)) return;
+        uint64_t current = value_.load(std::memory_order_relaxed);
+        while (current < value && !value_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+    uint64_t Get() const { return value_.load(std::memory_order_relaxed); }
+
+  private:
+    mutable std::atomic<uint64_t> value_{0};
+};
+
+struct ValidationCounterValue {
+    std::string name;
+    uint64_t value;
+};
+using ValidationCounterList = std::vector<ValidationCounterValue>;
+
+// Appends the counter unless it is 0
+void AddValidationCounter(ValidationCounterList &counters, const char *name, uint64_t value);
+
+// Starts counting, once per process. A present_interval of 0 never logs the counters.
+void EnableValidationCounters(uint32_t present_interval);
+// Whether the counters are due to be logged at this present
+bool ValidationCountersFramePresented();
+
+VkResult CopyValidationCounters(const ValidationCounterList &counters, uint32_t *counter_count,
+                                VkValidationCounterLAYER *out_counters);
+std::string FormatValidationCounters(const ValidationCounterList &counters);
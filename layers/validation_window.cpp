@@ -0,0 +1,92 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "validation_window.h"
+
+#include <sys/stat.h>
+
+#include <mutex>
+#include <string>
+
+#include "vk_layer_config.h"
+
+namespace {
+
+std::atomic<bool> window_enabled{false};
+
+struct WindowState {
+    std::mutex lock;
+    uint32_t start_frame = 0;
+    uint32_t frame_count = 0;
+    std::string label;
+    std::string file;
+    uint64_t presents = 0;
+    // The window is open while any of the triggers is
+    bool frame_open = false;
+    bool label_open = false;
+    bool file_open = false;
+
+    void Update() { validation_window_closed.store(!(frame_open || label_open || file_open)); }
+};
+
+WindowState &GetState() {
+    static WindowState state;
+    return state;
+}
+
+}  // namespace
+
+void EnableValidationWindow(uint32_t start_frame, uint32_t frame_count) {
+    auto &state = GetState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (window_enabled.load()) return;
+    state.start_frame = start_frame;
+    state.frame_count = frame_count;
+    const char *label = getLayerOption("khronos_validation.validation_window_label");
+    state.label = label ? label : "";
+    const char *file = getLayerOption("khronos_validation.validation_window_file");
+    state.file = file ? file : "";
+    // Without any trigger the window spans the whole run
+    const bool frame_trigger = start_frame != 0 || frame_count != 0;
+    state.frame_open = frame_trigger ? start_frame == 0 : (state.label.empty() && state.file.empty());
+    state.Update();
+    window_enabled.store(true);
+}
+
+void ValidationWindowFramePresented() {
+    if (!window_enabled.load(std::memory_order_relaxed)) return;
+    auto &state = GetState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    const uint64_t presents = ++state.presents;
+    if (state.start_frame != 0 || state.frame_count != 0) {
+        const uint64_t end_frame = static_cast<uint64_t>(state.start_frame) + state.frame_count;
+        state.frame_open = presents >= state.start_frame && (state.frame_count == 0 || presents < end_frame);
+    }
+    if (!state.file.empty()) {
+        struct stat info;
+        state.file_open = stat(state.file.c_str(), &info) == 0;
+    }
+    state.Update();
+}
+
+void ValidationWindowLabel(const VkDebugUtilsLabelEXT *label_info) {
+    if (!window_enabled.load(std::memory_order_relaxed) || !label_info || !label_info->pLabelName) return;
+    auto &state = GetState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.label.empty() || state.label != label_info->pLabelName) return;
+    state.label_open = !state.label_open;
+    state.Update();
+}
@@ -0,0 +1,44 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "vk_layer_logging.h"
+
+// Validation limited to windows of a run, set up with khronos_validation.validation_window.
+//
+// Outside of the windows the layer only tracks state: the chassis skips the PreCallValidate hooks of the generated entry points
+// and error and warning messages are dropped, while the PreCallRecord and PostCallRecord hooks keep the object lifetimes,
+// bindings and layouts up to date, so that validation resumes correctly when the next window opens. The entry points whose
+// PreCallValidate hooks hand state to their record hooks, such as vkCreateGraphicsPipelines, still run them.
+//
+// The window is open while any of its triggers is:
+// - from frame validation_window_start_frame, counted in presents from 0, for validation_window_frame_count frames or, if
+//   that is 0, until the end,
+// - from one debug utils label named validation_window_label to the next, begun or inserted on a queue or command buffer,
+// - while the file validation_window_file exists, checked at each present.
+// Without any trigger it spans the whole run. The window is that of the process, shared by all instances and devices.
+
+// Closes the window until a trigger opens it, once per process
+void EnableValidationWindow(uint32_t start_frame, uint32_t frame_count);
+// Counts frames for the frame and file triggers
+void ValidationWindowFramePresented();
+// Toggles the window if the label is the one of khronos_validation.validation_window_label
+void ValidationWindowLabel(const VkDebugUtilsLabelEXT *label_info);
+
+static inline bool ValidationWindowClosed() { return validation_window_closed.load(std::memory_order_relaxed); }
@@ -0,0 +1,257 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "validation_worker_pool.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "layer_trace.h"
+
+std::shared_ptr<ValidationThreadPool> ValidationThreadPool::Get(const Settings &settings) {
+    static std::mutex pool_lock;
+    static std::weak_ptr<ValidationThreadPool> process_pool;
+    std::unique_lock<std::mutex> lock(pool_lock);
+    auto pool = process_pool.lock();
+    if (!pool) {
+        pool = std::make_shared<ValidationThreadPool>(settings);
+        process_pool = pool;
+    }
+    return pool;
+}
+
+ValidationThreadPool::ValidationThreadPool(const Settings &settings) : settings_(settings) {
+    uint32_t thread_count = settings.thread_count;
+    if (thread_count == 0) {
+        // The threads making the calls work on their batches too
+        const uint32_t hardware_threads = std::max(2u, std::thread::hardware_concurrency());
+        thread_count = std::min(7u, hardware_threads - 1);
+    }
+    workers_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; i++) {
+        workers_.emplace_back(&ValidationThreadPool::WorkerLoop, this);
+    }
+}
+
+ValidationThreadPool::~ValidationThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(queue_lock_);
+        shutdown_ = true;
+    }
+    queue_cv_.notify_all();
+    // Workers finish the queued work before exiting
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void ValidationThreadPool::Submit(Work &&work) {
+    {
+        std::unique_lock<std::mutex> lock(queue_lock_);
+        queue_.emplace_back(std::move(work));
+    }
+    queue_cv_.notify_one();
+}
+
+void ValidationThreadPool::ApplyThreadSettings() const {
+#if defined(_WIN32)
+    if (settings_.affinity_mask != 0) {
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(settings_.affinity_mask));
+    }
+    if (settings_.priority == kPriorityLow) {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+    } else if (settings_.priority == kPriorityHigh) {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_ABOVE_NORMAL);
+    }
+#elif defined(__linux__)
+    if (settings_.affinity_mask != 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (uint32_t cpu = 0; cpu < 32; cpu++) {
+            if (settings_.affinity_mask & (1u << cpu)) CPU_SET(cpu, &cpus);
+        }
+        sched_setaffinity(0, sizeof(cpus), &cpus);
+    }
+    if (settings_.priority != kPriorityDefault) {
+        // Linux keeps a nice value per thread
+        const auto tid = static_cast<id_t>(syscall(SYS_gettid));
+        const int nice_value = getpriority(PRIO_PROCESS, tid) + ((settings_.priority == kPriorityLow) ? 5 : -5);
+        setpriority(PRIO_PROCESS, tid, nice_value);
+    }
+#endif
+}
+
+void ValidationThreadPool::WorkerLoop() {
+    ApplyThreadSettings();
+    while (true) {
+        Work work;
+        {
+            std::unique_lock<std::mutex> lock(queue_lock_);
+            queue_cv_.wait(lock, [this]() { return shutdown_ || !queue_.empty(); });
+            if (queue_.empty()) return;
+            work = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        work();
+    }
+}
+
+ValidationWorkerPool::ValidationWorkerPool(const debug_report_data *report_data, std::shared_ptr<ValidationThreadPool> thread_pool)
+    : report_data_(report_data), thread_pool_(std::move(thread_pool)) {}
+
+ValidationWorkerPool::~ValidationWorkerPool() {
+    // The jobs still queued on the thread pool refer to this pool, and every message is still delivered
+    Drain();
+}
+
+uint64_t ValidationWorkerPool::Enqueue(Job &&job) {
+    uint64_t sequence;
+    {
+        std::unique_lock<std::mutex> lock(sequence_lock_);
+        sequence = next_sequence_++;
+        // Submitted under the lock, so that the thread pool starts the jobs in sequence order
+        thread_pool_->Submit([this, sequence, job]() { RunJob(sequence, job); });
+    }
+    return sequence;
+}
+
+void ValidationWorkerPool::Drain() {
+    uint64_t next_sequence;
+    {
+        std::unique_lock<std::mutex> lock(sequence_lock_);
+        next_sequence = next_sequence_;
+    }
+    if (next_sequence > 0) {
+        WaitForDelivery(next_sequence - 1);
+    }
+}
+
+void ValidationWorkerPool::WaitForDelivery(uint64_t sequence) {
+    std::unique_lock<std::mutex> lock(delivery_lock_);
+    delivery_cv_.wait(lock, [this, sequence]() { return next_delivery_ > sequence; });
+}
+
+void ValidationWorkerPool::RunJob(uint64_t sequence, const Job &job) {
+    std::vector<DeferredLogMessage> messages;
+    deferred_log_messages = &messages;
+    {
+        TraceScope trace("ValidationWorkerPool", "Job");
+        job();
+    }
+    deferred_log_messages = nullptr;
+
+    Deliver(sequence, std::move(messages));
+}
+
+void ValidationWorkerPool::Deliver(uint64_t sequence, std::vector<DeferredLogMessage> &&messages) {
+    std::unique_lock<std::mutex> lock(delivery_lock_);
+    completed_.emplace(sequence, std::move(messages));
+    // Whichever worker completes the oldest outstanding job sends it, and any later jobs that finished first, to the callbacks
+    for (auto it = completed_.find(next_delivery_); it != completed_.end(); it = completed_.find(next_delivery_)) {
+        for (const auto &message : it->second) {
+            std::unique_lock<std::mutex> output_lock(report_data_->debug_output_mutex);
+            debug_log_msg(report_data_, message.msg_flags, message.objects, message.layer_prefix, message.message.c_str(),
+                          message.text_vuid.empty() ? nullptr : message.text_vuid.c_str());
+        }
+        completed_.erase(it);
+        ++next_delivery_;
+    }
+    delivery_cv_.notify_all();
+}
+
+ValidationBatchPool::ValidationBatchPool(std::shared_ptr<ValidationThreadPool> thread_pool)
+    : thread_pool_(std::move(thread_pool)) {}
+
+void ValidationBatchPool::Batch::Work() {
+    // The calling thread may already be collecting messages for a ValidationWorkerPool job
+    auto *saved_messages = deferred_log_messages;
+    for (uint32_t index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+        deferred_log_messages = &messages[index];
+        {
+            TraceScope trace("ValidationBatchPool", "Task");
+            results[index] = task(index) ? 1 : 0;
+        }
+        deferred_log_messages = saved_messages;
+        if (completed.fetch_add(1) + 1 == count) {
+            std::unique_lock<std::mutex> lock(done_lock);
+            done_cv.notify_all();
+        }
+    }
+}
+
+bool ValidationBatchPool::Run(const debug_report_data *report_data, uint32_t count, const Task &task) {
+    bool skip = false;
+    const uint32_t helper_count = std::min(count - 1, thread_pool_->ThreadCount());
+    if (count < 2 || helper_count == 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= task(i);
+        }
+        return skip;
+    }
+
+    auto batch = std::make_shared<Batch>(count, task);
+    // Helpers that start after the tasks are all claimed find nothing left to do, the batch outlives them through the copies
+    for (uint32_t i = 0; i < helper_count; i++) {
+        thread_pool_->Submit([batch]() { batch->Work(); });
+    }
+
+    batch->Work();
+    {
+        std::unique_lock<std::mutex> lock(batch->done_lock);
+        batch->done_cv.wait(lock, [&batch]() { return batch->completed.load() == batch->count; });
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= Deliver(report_data, batch->messages[i]);
+        skip |= batch->results[i] != 0;
+    }
+    return skip;
+}
+
+void ValidationBatchPool::Collect(uint32_t count, const Task &task, std::vector<uint8_t> &results, Messages &messages) {
+    const uint32_t helper_count = count ? std::min(count - 1, thread_pool_->ThreadCount()) : 0;
+    auto batch = std::make_shared<Batch>(count, task);
+    for (uint32_t i = 0; i < helper_count; i++) {
+        thread_pool_->Submit([batch]() { batch->Work(); });
+    }
+
+    batch->Work();
+    {
+        std::unique_lock<std::mutex> lock(batch->done_lock);
+        batch->done_cv.wait(lock, [&batch]() { return batch->completed.load() == batch->count; });
+    }
+    // Helpers still starting find every task claimed and touch neither
+    results = std::move(batch->results);
+    messages = std::move(batch->messages);
+}
+
+bool ValidationBatchPool::Deliver(const debug_report_data *report_data, const std::vector<DeferredLogMessage> &messages) {
+    bool skip = false;
+    for (const auto &message : messages) {
+        std::unique_lock<std::mutex> output_lock(report_data->debug_output_mutex);
+        skip |= debug_log_msg(report_data, message.msg_flags, message.objects, message.layer_prefix, message.message.c_str(),
+                              message.text_vuid.empty() ? nullptr : message.text_vuid.c_str());
+    }
+    return skip;
+}
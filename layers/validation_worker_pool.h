@@ -0,0 +1,155 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vk_layer_logging.h"
+
+// The worker threads of the layer. One pool is shared by every instance and device of the process, and ValidationWorkerPool
+// and ValidationBatchPool queue their work on it, so the layer never runs more than thread_pool_size threads of background
+// validation however many devices and features use it.
+class ValidationThreadPool {
+  public:
+    using Work = std::function<void()>;
+
+    enum Priority : uint32_t {
+        kPriorityDefault = 0,  // That of the thread creating the pool
+        kPriorityLow = 1,
+        kPriorityHigh = 2,  // Ignored where raising the priority needs privileges the application does not have
+    };
+    struct Settings {
+        uint32_t thread_count = 0;   // 0 picks a count from the number of cores
+        uint32_t affinity_mask = 0;  // Bit i lets the threads run on core i, 0 lets them run on any core
+        uint32_t priority = kPriorityDefault;
+    };
+
+    // Returns the pool of the process, creating it with settings if there is none. While a pool exists, the settings of later
+    // calls are ignored.
+    static std::shared_ptr<ValidationThreadPool> Get(const Settings &settings);
+
+    explicit ValidationThreadPool(const Settings &settings);
+    ~ValidationThreadPool();
+    ValidationThreadPool(const ValidationThreadPool &) = delete;
+    ValidationThreadPool &operator=(const ValidationThreadPool &) = delete;
+
+    void Submit(Work &&work);
+    uint32_t ThreadCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+  private:
+    void WorkerLoop();
+    // Applies the affinity and priority of settings_ to the calling worker thread
+    void ApplyThreadSettings() const;
+
+    const Settings settings_;
+
+    std::mutex queue_lock_;
+    std::condition_variable queue_cv_;
+    std::deque<Work> queue_;
+    bool shutdown_ = false;
+
+    std::vector<std::thread> workers_;
+};
+
+// Runs validation jobs on background threads while delivering the messages they log in the order the jobs were enqueued.
+//
+// Jobs may execute concurrently and in any order. Every message a job logs is collected on its worker thread (see
+// deferred_log_messages) and sent to the debug callbacks only once all earlier jobs have been delivered, so applications see
+// errors in API order, just later than they would without the pool.
+class ValidationWorkerPool {
+  public:
+    using Job = std::function<void()>;
+
+    ValidationWorkerPool(const debug_report_data *report_data, std::shared_ptr<ValidationThreadPool> thread_pool);
+    ~ValidationWorkerPool();
+    ValidationWorkerPool(const ValidationWorkerPool &) = delete;
+    ValidationWorkerPool &operator=(const ValidationWorkerPool &) = delete;
+
+    // Returns the sequence number of the job, for WaitForDelivery()
+    uint64_t Enqueue(Job &&job);
+
+    // Wait for all enqueued jobs to run and their messages to be delivered
+    void Drain();
+    // Wait for the job with the given sequence number, and every job enqueued before it, to be delivered
+    void WaitForDelivery(uint64_t sequence);
+
+  private:
+    void RunJob(uint64_t sequence, const Job &job);
+    void Deliver(uint64_t sequence, std::vector<DeferredLogMessage> &&messages);
+
+    const debug_report_data *report_data_;
+    const std::shared_ptr<ValidationThreadPool> thread_pool_;
+
+    std::mutex sequence_lock_;
+    uint64_t next_sequence_ = 0;
+
+    std::mutex delivery_lock_;
+    std::condition_variable delivery_cv_;
+    std::map<uint64_t, std::vector<DeferredLogMessage>> completed_;
+    uint64_t next_delivery_ = 0;
+};
+
+// Runs the independent parts of a single API call, such as the pipelines of one vkCreateGraphicsPipelines call, in parallel.
+//
+// Unlike ValidationWorkerPool, Run() returns only once every task has completed, and the calling thread works on the tasks too.
+// Messages logged by the tasks are collected and delivered from the calling thread afterwards, ordered by task index, so the
+// output is identical to running the tasks in a loop.
+class ValidationBatchPool {
+  public:
+    using Task = std::function<bool(uint32_t index)>;
+    using Messages = std::vector<std::vector<DeferredLogMessage>>;
+
+    explicit ValidationBatchPool(std::shared_ptr<ValidationThreadPool> thread_pool);
+    ValidationBatchPool(const ValidationBatchPool &) = delete;
+    ValidationBatchPool &operator=(const ValidationBatchPool &) = delete;
+
+    // Runs task(0) to task(count - 1) and returns true if any task, or any debug callback a message was delivered to, returned
+    // true
+    bool Run(const debug_report_data *report_data, uint32_t count, const Task &task);
+    // Runs the tasks like Run() but hands back what each task returned and logged instead of delivering it, for callers that
+    // interleave the messages with their own. results[i] is set if task(i) returned true.
+    void Collect(uint32_t count, const Task &task, std::vector<uint8_t> &results, Messages &messages);
+    // Returns true if any debug callback the messages were delivered to returned true
+    static bool Deliver(const debug_report_data *report_data, const std::vector<DeferredLogMessage> &messages);
+
+  private:
+    struct Batch {
+        Batch(uint32_t count, const Task &task) : count(count), task(task), results(count, 0), messages(count) {}
+
+        // Runs tasks until none are left to claim
+        void Work();
+
+        const uint32_t count;
+        const Task &task;
+        std::vector<uint8_t> results;
+        std::vector<std::vector<DeferredLogMessage>> messages;
+        std::atomic<uint32_t> next{0};
+        std::atomic<uint32_t> completed{0};
+        std::mutex done_lock;
+        std::condition_variable done_cv;
+    };
+
+    const std::shared_ptr<ValidationThreadPool> thread_pool_;
+};
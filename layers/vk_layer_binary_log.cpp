@@ -0,0 +1,144 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "vk_layer_binary_log.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+const char kMagic[8] = {'V', 'V', 'L', 'B', 'L', 'O', 'G', '\0'};
+// The layer composes messages as "<severity>: [ <VUID> ] <objects> | MessageID = 0x<id> | <text> The Vulkan spec states: ..."
+const char kTextMarker[] = "| MessageID = 0x";
+const char kSpecMarker[] = " The Vulkan spec states: ";
+
+int64_t SteadyNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Small numbers are easier to follow in the decoded log than thread IDs
+uint32_t ThreadIndex() {
+    static std::atomic<uint32_t> next_index{1};
+    thread_local uint32_t index = 0;
+    if (index == 0) index = next_index.fetch_add(1);
+    return index;
+}
+
+template <typename T>
+void Append(std::string &out, T value) {
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void AppendBytes(std::string &out, const char *bytes, size_t size) {
+    Append(out, static_cast<uint32_t>(size));
+    out.append(bytes, size);
+}
+
+}  // namespace
+
+BinaryLogSink *BinaryLogSink::Create(const char *filename) {
+    FILE *file = fopen(filename, "wb");
+    if (!file) return nullptr;
+    return new BinaryLogSink(file);
+}
+
+BinaryLogSink::BinaryLogSink(FILE *file) : file_(file), buffer_(kBufferSize) {
+    setvbuf(file_, buffer_.data(), _IOFBF, buffer_.size());
+    start_ns_ = SteadyNs();
+    last_flush_ns_ = start_ns_;
+    const int64_t epoch_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::string header(kMagic, sizeof(kMagic));
+    Append(header, kVersion);
+    Append(header, uint32_t(0));
+    Append(header, static_cast<uint64_t>(epoch_ns));
+    fwrite(header.data(), 1, header.size(), file_);
+}
+
+BinaryLogSink::~BinaryLogSink() { fclose(file_); }
+
+uint32_t BinaryLogSink::Intern(const char *text, size_t size, std::string &out) {
+    if (!text || size == 0) return 0;
+    auto inserted = strings_.emplace(std::string(text, size), static_cast<uint32_t>(strings_.size() + 1));
+    if (inserted.second) {
+        Append(out, kStringRecord);
+        AppendBytes(out, text, size);
+    }
+    return inserted.first->second;
+}
+
+uint32_t BinaryLogSink::Intern(const char *text, std::string &out) { return Intern(text, text ? strlen(text) : 0, out); }
+
+void BinaryLogSink::Write(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT types,
+                          const VkDebugUtilsMessengerCallbackDataEXT *callback_data) {
+    const int64_t now_ns = SteadyNs();
+    const char *message = callback_data->pMessage ? callback_data->pMessage : "";
+    // The severity, VUID and objects are in the record already, keep only the check's text and intern the spec text
+    const char *text = message;
+    const char *text_marker = strstr(message, kTextMarker);
+    if (text_marker) {
+        const char *text_start = strstr(text_marker + sizeof(kTextMarker) - 1, " | ");
+        if (text_start) text = text_start + 3;
+    }
+    const char *spec = strstr(text, kSpecMarker);
+    const size_t text_size = spec ? static_cast<size_t>(spec - text) : strlen(text);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    // String records go ahead of the message that first uses them
+    std::string strings;
+    std::string record;
+    Append(record, kMessageRecord);
+    Append(record, static_cast<uint64_t>(now_ns - start_ns_));
+    Append(record, ThreadIndex());
+    Append(record, static_cast<uint32_t>(severity));
+    Append(record, static_cast<uint32_t>(types));
+    Append(record, callback_data->messageIdNumber);
+    Append(record, Intern(callback_data->pMessageIdName, strings));
+    Append(record, callback_data->objectCount);
+    for (uint32_t i = 0; i < callback_data->objectCount; ++i) {
+        const auto &object = callback_data->pObjects[i];
+        Append(record, static_cast<uint32_t>(object.objectType));
+        Append(record, object.objectHandle);
+        Append(record, Intern(object.pObjectName, strings));
+    }
+    Append(record, callback_data->queueLabelCount);
+    for (uint32_t i = 0; i < callback_data->queueLabelCount; ++i) {
+        Append(record, Intern(callback_data->pQueueLabels[i].pLabelName, strings));
+    }
+    Append(record, callback_data->cmdBufLabelCount);
+    for (uint32_t i = 0; i < callback_data->cmdBufLabelCount; ++i) {
+        Append(record, Intern(callback_data->pCmdBufLabels[i].pLabelName, strings));
+    }
+    Append(record, spec ? Intern(spec + sizeof(kSpecMarker) - 1, strings) : uint32_t(0));
+    AppendBytes(record, text, text_size);
+
+    fwrite(strings.data(), 1, strings.size(), file_);
+    fwrite(record.data(), 1, record.size(), file_);
+    if (now_ns - last_flush_ns_ > 1000000000) {
+        fflush(file_);
+        last_flush_ns_ = now_ns;
+    }
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL BinaryLogSink::Callback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                       VkDebugUtilsMessageTypeFlagsEXT types,
+                                                       const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                       void *user_data) {
+    static_cast<BinaryLogSink *>(user_data)->Write(severity, types, callback_data);
+    return VK_FALSE;
+}
@@ -0,0 +1,76 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include "vk_layer_data.h"
+
+// Compact binary log of validation messages, written by the VK_DBG_LAYER_ACTION_LOG_BINARY debug action and rendered as text
+// by scripts/vk_validation_log_decode.py.
+//
+// Most of the text of a message repeats from one message to the next: the VUID, object names, labels and the spec text. The
+// binary log writes each such string once, as a string record, and messages refer to it by index, leaving only the handles and
+// the checks' own text to be written per message. The file holds, in host (little endian) byte order:
+//
+//   header:  "VVLBLOG\0", u32 version, u32 reserved, u64 start time in ns since the Unix epoch
+//   string:  u8 kStringRecord, u32 length, bytes; strings are numbered from 1 in the order they appear
+//   message: u8 kMessageRecord, u64 ns since start, u32 thread, u32 severity, u32 message types, i32 message ID,
+//            u32 VUID string, u32 object count, objects (u32 object type, u64 handle, u32 name string),
+//            u32 queue label count, queue label strings, u32 command buffer label count, command buffer label strings,
+//            u32 spec text string, u32 length, text
+//
+// String 0 means none. The file is written through a large buffer and flushed at least once a second, so a crash loses at
+// most the last second of messages.
+class BinaryLogSink {
+  public:
+    static const uint32_t kVersion = 1;
+    static const uint8_t kStringRecord = 1;
+    static const uint8_t kMessageRecord = 2;
+
+    // Returns null if the file cannot be created
+    static BinaryLogSink *Create(const char *filename);
+    ~BinaryLogSink();
+
+    void Write(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT types,
+               const VkDebugUtilsMessengerCallbackDataEXT *callback_data);
+
+    // Debug utils callback, with the sink as user data
+    static VKAPI_ATTR VkBool32 VKAPI_CALL Callback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                   VkDebugUtilsMessageTypeFlagsEXT types,
+                                                   const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
+
+  private:
+    static const size_t kBufferSize = 1024 * 1024;
+
+    explicit BinaryLogSink(FILE *file);
+    // Index of the string, writing its string record to out first if the string is new
+    uint32_t Intern(const char *text, size_t size, std::string &out);
+    uint32_t Intern(const char *text, std::string &out);
+
+    FILE *file_;
+    std::vector<char> buffer_;
+    std::mutex lock_;
+    layer_data::unordered_map<std::string, uint32_t> strings_;
+    int64_t start_ns_ = 0;
+    int64_t last_flush_ns_ = 0;
+};
@@ -68,6 +68,29 @@ class ConfigFile {
 
 static ConfigFile layer_config;
 
+string GetLayerCacheFilePath(const char *base_name) {
+    auto tmp_path = GetEnvironment("XDG_CACHE_HOME");
+    if (!tmp_path.size()) {
+        auto cachepath = GetEnvironment("HOME") + "/.cache";
+        struct stat info;
+        if (stat(cachepath.c_str(), &info) == 0) {
+            if ((info.st_mode & S_IFMT) == S_IFDIR) {
+                tmp_path = cachepath;
+            }
+        }
+    }
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TMPDIR");
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TMP");
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
+    if (!tmp_path.size()) tmp_path = "/tmp";
+    string path = tmp_path + "/" + base_name;
+#if defined(__linux__) || defined(__FreeBSD__)
+    path += "-" + std::to_string(getuid());
+#endif
+    path += ".bin";
+    return path;
+}
+
 string GetEnvironment(const char *variable) {
 #if !defined(__ANDROID__) && !defined(_WIN32)
     const char *output = getenv(variable);
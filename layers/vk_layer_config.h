@@ -34,6 +34,8 @@
 #endif
 
 std::string GetEnvironment(const char *variable);
+// Path of a file named after base_name in the user's cache directory, for data the layer keeps across runs
+std::string GetLayerCacheFilePath(const char *base_name);
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,6 +69,7 @@ typedef enum VkLayerDbgActionBits {
     VK_DBG_LAYER_ACTION_LOG_MSG = 0x00000002,
     VK_DBG_LAYER_ACTION_BREAK = 0x00000004,
     VK_DBG_LAYER_ACTION_DEBUG_OUTPUT = 0x00000008,
+    VK_DBG_LAYER_ACTION_LOG_BINARY = 0x00000010,
     VK_DBG_LAYER_ACTION_DEFAULT = 0x40000000,
 } VkLayerDbgActionBits;
 typedef VkFlags VkLayerDbgActionFlags;
@@ -76,6 +79,7 @@ const layer_data::unordered_map<std::string, VkFlags> debug_actions_option_defin
     {std::string("VK_DBG_LAYER_ACTION_CALLBACK"), VK_DBG_LAYER_ACTION_CALLBACK},
     {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
     {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
+    {std::string("VK_DBG_LAYER_ACTION_LOG_BINARY"), VK_DBG_LAYER_ACTION_LOG_BINARY},
 #if defined(WIN32)
     {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
 #endif
@@ -23,15 +23,19 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
 #include <cassert>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <set>
 #include <algorithm>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #ifdef USE_ROBIN_HOOD_HASHING
 #include "robin_hood.h"
@@ -297,6 +301,12 @@ class small_vector {
         size_++;
     }
 
+    void pop_back() {
+        assert(size_ > 0);
+        size_--;
+        (GetWorkingStore() + size_)->~value_type();
+    }
+
     void reserve(size_type new_cap) {
         // Since this can't shrink, if we're growing we're newing
         if (new_cap > capacity_) {
@@ -309,10 +319,28 @@ class small_vector {
                 working_store[i].~value_type();
             }
             large_store_ = std::move(new_store);
+            capacity_ = new_cap;
         }
         // No shrink here.
     }
 
+    // Growing default constructs the new values, shrinking keeps the capacity
+    void resize(size_type count) {
+        if (count > size_) {
+            reserve(count);
+            auto working_store = GetWorkingStore();
+            for (size_type i = size_; i < count; i++) {
+                new (working_store + i) value_type();
+            }
+        } else {
+            auto working_store = GetWorkingStore();
+            for (size_type i = count; i < size_; i++) {
+                working_store[i].~value_type();
+            }
+        }
+        size_ = count;
+    }
+
     void clear() {
         auto working_store = GetWorkingStore();
         for (size_type i = 0; i < size_; i++) {
@@ -329,6 +357,7 @@ class small_vector {
     inline const_iterator cend() const { return GetWorkingStore() + size_; }
     inline const_iterator end() const { return GetWorkingStore() + size_; }
     inline size_type size() const { return size_; }
+    inline size_type capacity() const { return capacity_; }
 
   protected:
     inline const_pointer GetWorkingStore() const {
@@ -721,6 +750,142 @@ void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &laye
     layer_data_map.erase(got);
 }
 
+// Map from dispatch keys to the layer data of each instance and device, looked up at the start of every entry point. find()
+// takes no lock: the entries are a sorted array that insert() and erase() copy, change and publish whole under the map's
+// lock, and each thread remembers its last lookup until the map changes. A find() that misses its last lookup is counted
+// while it reads the array, and the replaced arrays are freed by the first insert() or erase() that finds no find() running.
+template <typename T>
+class dispatch_key_map {
+  public:
+    using value_type = std::pair<void *, T *>;
+    using Entries = std::vector<value_type>;
+
+    dispatch_key_map() { current.store(new Entries, std::memory_order_relaxed); }
+    ~dispatch_key_map() {
+        delete current.load(std::memory_order_relaxed);
+        for (auto *entries : retired) delete entries;
+    }
+    dispatch_key_map(const dispatch_key_map &) = delete;
+    dispatch_key_map &operator=(const dispatch_key_map &) = delete;
+
+    T *find(void *key) const {
+        LastLookup &last = last_lookup;
+        const uint64_t version = generation.load(std::memory_order_acquire);
+        if (last.map == this && last.key == key && last.generation == version) return last.value;
+        T *value = nullptr;
+        {
+            ReaderGuard reader(readers);
+            const Entries &entries = *current.load();
+            auto it = LowerBound(entries, key);
+            if (it != entries.end() && it->first == key) value = it->second;
+        }
+        if (!value) return nullptr;
+        last.map = this;
+        last.key = key;
+        last.generation = version;
+        last.value = value;
+        return value;
+    }
+
+    // Returns false if key is already in the map
+    bool insert(void *key, T *value) {
+        std::lock_guard<std::mutex> guard(lock);
+        const Entries &entries = *current.load(std::memory_order_relaxed);
+        auto it = LowerBound(entries, key);
+        if (it != entries.end() && it->first == key) return false;
+        Entries *new_entries = new Entries(entries);
+        new_entries->insert(new_entries->begin() + (it - entries.begin()), value_type(key, value));
+        Publish(new_entries);
+        return true;
+    }
+
+    // Returns the value key had, or nullptr if it was not in the map
+    T *erase(void *key) {
+        std::lock_guard<std::mutex> guard(lock);
+        const Entries &entries = *current.load(std::memory_order_relaxed);
+        auto it = LowerBound(entries, key);
+        if (it == entries.end() || it->first != key) return nullptr;
+        T *value = it->second;
+        Entries *new_entries = new Entries(entries);
+        new_entries->erase(new_entries->begin() + (it - entries.begin()));
+        Publish(new_entries);
+        return value;
+    }
+
+    // A copy of the entries at the time of the call
+    Entries entries() const {
+        ReaderGuard reader(readers);
+        return *current.load();
+    }
+
+  private:
+    // Counts a reader of the current entries for as long as it is in scope. The count and the load of current that follows are
+    // sequentially consistent, so that Publish() either sees the reader or the reader sees the newly published entries.
+    class ReaderGuard {
+      public:
+        explicit ReaderGuard(std::atomic<uint32_t> &count) : count_(count) { count_.fetch_add(1); }
+        ~ReaderGuard() { count_.fetch_sub(1, std::memory_order_release); }
+
+      private:
+        std::atomic<uint32_t> &count_;
+    };
+
+    struct LastLookup {
+        const dispatch_key_map *map = nullptr;
+        void *key = nullptr;
+        uint64_t generation = 0;
+        T *value = nullptr;
+    };
+
+    static typename Entries::const_iterator LowerBound(const Entries &entries, void *key) {
+        return std::lower_bound(entries.begin(), entries.end(), key,
+                                [](const value_type &entry, void *k) { return std::less<void *>()(entry.first, k); });
+    }
+
+    // Called with the lock held. The new entries are published before the generation changes, so a find() that sees the new
+    // generation also sees the new entries. A reader that starts after the entries are published can't see the retired ones,
+    // so if no reader is running then, none is left that could.
+    void Publish(Entries *new_entries) {
+        retired.push_back(current.load(std::memory_order_relaxed));
+        current.store(new_entries);
+        generation.store(generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        if (readers.load() == 0) {
+            for (auto *entries : retired) delete entries;
+            retired.clear();
+        }
+    }
+
+    std::atomic<const Entries *> current;
+    std::atomic<uint64_t> generation{0};
+    mutable std::atomic<uint32_t> readers{0};
+    std::mutex lock;
+    std::vector<const Entries *> retired;
+    static thread_local LastLookup last_lookup;
+};
+
+template <typename T>
+thread_local typename dispatch_key_map<T>::LastLookup dispatch_key_map<T>::last_lookup;
+
+// For the given data key, look up the layer_data instance from given layer_data_map, creating it if there is none
+template <typename DATA_T>
+DATA_T *GetLayerDataPtr(void *data_key, dispatch_key_map<DATA_T> &layer_data_map) {
+    DATA_T *data = layer_data_map.find(data_key);
+    if (data == nullptr) {
+        data = new DATA_T;
+        if (!layer_data_map.insert(data_key, data)) {
+            // Another thread created it first
+            delete data;
+            data = layer_data_map.find(data_key);
+        }
+    }
+    return data;
+}
+
+template <typename DATA_T>
+void FreeLayerDataPtr(void *data_key, dispatch_key_map<DATA_T> &layer_data_map) {
+    delete layer_data_map.erase(data_key);
+}
+
 namespace layer_data {
 
 struct in_place_t {};
@@ -32,10 +32,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 #include <cstring>
@@ -51,6 +55,7 @@
 #include "vk_validation_error_messages.h"
 #include "vk_layer_dispatch_table.h"
 #include "vk_safe_struct.h"
+#include "vk_layer_binary_log.h"
 #include "xxhash.h"
 
 // Suppress unused warning on Linux
@@ -101,6 +106,44 @@ struct LogObjectList {
     LogObjectList(){};
 };
 
+// A message logged by a thread that collects its messages for later delivery, see ValidationWorkerPool
+struct DeferredLogMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    const char *layer_prefix;
+    std::string message;
+    std::string text_vuid;
+};
+
+// When set, messages logged on the current thread are appended here instead of being sent to the debug callbacks
+extern thread_local std::vector<DeferredLogMessage> *deferred_log_messages;
+
+// Number of messages the current thread tried to log, counted before any filtering. Checks that cache their verdict compare it
+// before and after running to know whether they found anything.
+extern thread_local uint64_t log_message_attempts;
+
+// Set outside of the windows of khronos_validation.validation_window, where validation messages are dropped
+extern std::atomic<bool> validation_window_closed;
+
+// The VUID of a message, as handed to the Log* helpers. Checks mostly pass string literals, and nearly every message a check
+// considers is dropped by the severity, filter or duplicate tests before its VUID is needed as text, so the VUID refers to the
+// caller's string rather than copying it into a std::string. Both forms are null terminated.
+class VuidString {
+  public:
+    VuidString(const char *text) : text_(text), size_(strlen(text)) {}
+    VuidString(const std::string &text) : text_(text.c_str()), size_(text.size()) {}
+
+    const char *c_str() const { return text_; }
+    size_t size() const { return size_; }
+    std::string str() const { return std::string(text_, size_); }
+    // The ID reported as messageIdNumber and matched against khronos_validation.message_id_filter
+    uint32_t MessageId() const { return XXH32(text_, size_, 8); }
+
+  private:
+    const char *text_;
+    size_t size_;
+};
+
 typedef struct VkLayerDbgFunctionState {
     DebugCallbackStatusFlags callback_status;
 
@@ -186,14 +229,224 @@ struct LoggingLabelState {
     }
 };
 
+// Filtered message IDs and duplicate counts for the IDs seen so far, shared by all threads without a lock. Open addressing over
+// a fixed number of slots, several times the number of VUIDs a run could plausibly hit; an ID that finds no free slot is never
+// filtered or counted.
+class MessageIdTable {
+  public:
+    MessageIdTable() : slots_(new Slot[kSlotCount]) {}
+
+    void Filter(uint32_t message_id) {
+        auto *count = Find(message_id);
+        if (count) count->store(kFiltered, std::memory_order_relaxed);
+    }
+
+    // Returns true if a message with this ID should be logged, counting it against limit when limit is positive
+    bool Admit(uint32_t message_id, int32_t limit) {
+        auto *count = Find(message_id);
+        if (!count) return true;
+        const int32_t current = count->load(std::memory_order_relaxed);
+        if (current == kFiltered) return false;
+        if (limit <= 0) return true;
+        // Count for this particular message is over the limit, ignore it
+        if (current >= limit) return false;
+        return count->fetch_add(1, std::memory_order_relaxed) < limit;
+    }
+
+  private:
+    static const uint32_t kSlotCount = 1 << 14;
+    // Counts never get near this, they stop at the limit
+    static const int32_t kFiltered = INT32_MAX;
+
+    struct Slot {
+        // The message ID with bit 32 set, so that 0 marks a free slot
+        std::atomic<uint64_t> key{0};
+        std::atomic<int32_t> count{0};
+    };
+
+    std::atomic<int32_t> *Find(uint32_t message_id) {
+        const uint64_t key = (uint64_t(1) << 32) | message_id;
+        // Message IDs are hashes already, their low bits are as good a start as any
+        for (uint32_t probe = 0; probe < kSlotCount; ++probe) {
+            Slot &slot = slots_[(message_id + probe) & (kSlotCount - 1)];
+            uint64_t current = slot.key.load(std::memory_order_acquire);
+            if (current == 0 && slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                return &slot.count;
+            }
+            if (current == key) return &slot.count;
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<Slot[]> slots_;
+};
+
+// Messages waiting for delivery when khronos_validation.async_message_delivery is set. Threads logging a message push it
+// without taking a lock, and a thread of the queue's own takes everything pushed so far at once and hands it, oldest first, to
+// the deliver function. The time the debug callbacks take is spent on that thread rather than on the threads calling Vulkan.
+class AsyncLogQueue {
+  public:
+    struct Message {
+        VkFlags msg_flags;
+        LogObjectList objects;
+        std::string vuid_text;
+        // From vasprintf(), owned by the message until delivery
+        char *err_msg;
+        Message *next;
+    };
+    using DeliverFunction = std::function<void(Message &message)>;
+
+    explicit AsyncLogQueue(DeliverFunction &&deliver) : deliver_(std::move(deliver)), thread_(&AsyncLogQueue::Run, this) {}
+    AsyncLogQueue(const AsyncLogQueue &) = delete;
+    AsyncLogQueue &operator=(const AsyncLogQueue &) = delete;
+
+    // Delivers everything still queued before returning
+    ~AsyncLogQueue() {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    void Push(VkFlags msg_flags, const LogObjectList &objects, std::string &&vuid_text, char *err_msg) {
+        Message *message = new Message{msg_flags, objects, std::move(vuid_text), err_msg, nullptr};
+        pushed_.fetch_add(1);
+        Message *head = head_.load(std::memory_order_relaxed);
+        do {
+            message->next = head;
+        } while (!head_.compare_exchange_weak(head, message));
+        // Only a sleeping delivery thread needs the lock taken to wake it
+        if (sleeping_.load()) {
+            std::lock_guard<std::mutex> guard(lock_);
+            wake_.notify_one();
+        }
+    }
+
+    // Waits until every message pushed before the call has been delivered
+    void Flush() {
+        const uint64_t target = pushed_.load();
+        std::unique_lock<std::mutex> guard(lock_);
+        delivered_cv_.wait(guard, [this, target]() { return delivered_ >= target; });
+    }
+
+    // Waits for the batch being delivered, if any. Once a debug callback is removed from the list and this returns, the
+    // delivery thread no longer calls it.
+    void WaitForDelivery() { std::lock_guard<std::mutex> guard(delivery_lock_); }
+
+  private:
+    void Run() {
+        for (;;) {
+            Message *batch = head_.exchange(nullptr);
+            if (!batch) {
+                std::unique_lock<std::mutex> guard(lock_);
+                if (stop_) break;
+                sleeping_.store(true);
+                wake_.wait(guard, [this]() { return stop_ || head_.load() != nullptr; });
+                sleeping_.store(false);
+                continue;
+            }
+            // Pushed newest first
+            Message *oldest = nullptr;
+            while (batch) {
+                Message *next = batch->next;
+                batch->next = oldest;
+                oldest = batch;
+                batch = next;
+            }
+            uint64_t count = 0;
+            {
+                std::lock_guard<std::mutex> delivery_guard(delivery_lock_);
+                while (oldest) {
+                    Message *next = oldest->next;
+                    deliver_(*oldest);
+                    delete oldest;
+                    oldest = next;
+                    ++count;
+                }
+            }
+            {
+                std::lock_guard<std::mutex> guard(lock_);
+                delivered_ += count;
+            }
+            delivered_cv_.notify_all();
+        }
+    }
+
+    DeliverFunction deliver_;
+    std::atomic<Message *> head_{nullptr};
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<bool> sleeping_{false};
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::condition_variable delivered_cv_;
+    uint64_t delivered_ = 0;
+    bool stop_ = false;
+    std::mutex delivery_lock_;
+    // Last, so that everything the thread uses exists before it starts
+    std::thread thread_;
+};
+
+// Object names set through VK_EXT_debug_utils or VK_EXT_debug_marker, by handle.
+//
+// Applications that name every resource set names at the rate they create objects, while any thread formatting a message
+// looks names up. The map is split into shards by handle, each with its own lock, so that neither waits on the other or on
+// the message output lock. Names are stored as shared immutable strings, a lookup only takes a reference.
+class ObjectNameMap {
+  public:
+    // A null name removes the object's name
+    void Set(uint64_t handle, const char *name) {
+        Shard &shard = GetShard(handle);
+        std::shared_ptr<const std::string> shared_name;
+        if (name) shared_name = std::make_shared<const std::string>(name);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        if (shared_name) {
+            shard.names[handle] = std::move(shared_name);
+        } else {
+            shard.names.erase(handle);
+        }
+    }
+
+    // Null if the object has no name
+    std::shared_ptr<const std::string> Get(uint64_t handle) const {
+        const Shard &shard = GetShard(handle);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        const auto it = shard.names.find(handle);
+        return (it != shard.names.end()) ? it->second : nullptr;
+    }
+
+  private:
+    static const uint32_t kShardBits = 5;
+
+    struct Shard {
+        mutable std::mutex lock;
+        layer_data::unordered_map<uint64_t, std::shared_ptr<const std::string>> names;
+    };
+
+    // Handles are mostly aligned pointers or small counters, so mix all of their bits into the shard index
+    static uint32_t ShardIndex(uint64_t handle) {
+        return static_cast<uint32_t>((handle * 0x9E3779B97F4A7C15ULL) >> (64 - kShardBits));
+    }
+    Shard &GetShard(uint64_t handle) { return shards_[ShardIndex(handle)]; }
+    const Shard &GetShard(uint64_t handle) const { return shards_[ShardIndex(handle)]; }
+
+    std::array<Shard, 1 << kShardBits> shards_;
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
     VkDebugUtilsMessageTypeFlagsEXT active_types{0};
+    // The message types some callback would actually be called for, by severity (see DebugUtilsSeverityIndex()). Unlike the
+    // masks above, these take the pairing of severity and type in each callback, and the skipping of default callbacks, into
+    // account, so that a message is only formatted when it reaches a callback.
+    std::array<VkDebugUtilsMessageTypeFlagsEXT, 4> callback_types{};
     bool queueLabelHasInsert{false};
     bool cmdBufLabelHasInsert{false};
-    layer_data::unordered_map<uint64_t, std::string> debugObjectNameMap;
-    layer_data::unordered_map<uint64_t, std::string> debugUtilsObjectNameMap;
+    // Not guarded by debug_output_mutex, the maps have locks of their own
+    ObjectNameMap debugObjectNameMap;
+    ObjectNameMap debugUtilsObjectNameMap;
     layer_data::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
     layer_data::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
     std::vector<uint32_t> filter_message_ids{};
@@ -201,54 +454,42 @@ typedef struct _debug_report_data {
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     int32_t duplicate_message_limit = 0;
-    mutable layer_data::unordered_map<uint32_t, int32_t> duplicate_message_count_map{};
+    // Created, with filter_message_ids copied in, the first time a message needs filtering or counting
+    mutable std::unique_ptr<MessageIdTable> message_ids;
+    mutable std::once_flag message_ids_once;
+    // Set when khronos_validation.async_message_delivery is, see StartAsyncLogDelivery()
+    std::unique_ptr<AsyncLogQueue> async_log_queue;
+    // The VK_DBG_LAYER_ACTION_LOG_BINARY sink, closed along with the instance
+    std::unique_ptr<BinaryLogSink> binary_log;
     const void *instance_pnext_chain{};
     bool forceDefaultLogCallback{false};
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugUtilsObjectNameMap[pNameInfo->objectHandle] = pNameInfo->pObjectName;
-        } else {
-            debugUtilsObjectNameMap.erase(pNameInfo->objectHandle);
-        }
+        debugUtilsObjectNameMap.Set(pNameInfo->objectHandle, pNameInfo->pObjectName);
     }
 
     void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugObjectNameMap[pNameInfo->object] = pNameInfo->pObjectName;
-        } else {
-            debugObjectNameMap.erase(pNameInfo->object);
-        }
+        debugObjectNameMap.Set(pNameInfo->object, pNameInfo->pObjectName);
     }
 
     std::string DebugReportGetUtilsObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto utils_name_iter = debugUtilsObjectNameMap.find(object);
-        if (utils_name_iter != debugUtilsObjectNameMap.end()) {
-            label = utils_name_iter->second;
-        }
-        return label;
+        const auto name = debugUtilsObjectNameMap.Get(object);
+        return name ? *name : std::string();
     }
 
     std::string DebugReportGetMarkerObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto marker_name_iter = debugObjectNameMap.find(object);
-        if (marker_name_iter != debugObjectNameMap.end()) {
-            label = marker_name_iter->second;
-        }
-        return label;
+        const auto name = debugObjectNameMap.Get(object);
+        return name ? *name : std::string();
     }
 
     std::string FormatHandle(const char *handle_type_name, uint64_t handle) const {
-        std::string handle_name = DebugReportGetUtilsObjectName(handle);
-        if (handle_name.empty()) {
-            handle_name = DebugReportGetMarkerObjectName(handle);
+        auto handle_name = debugUtilsObjectNameMap.Get(handle);
+        if (!handle_name || handle_name->empty()) {
+            handle_name = debugObjectNameMap.Get(handle);
         }
 
         std::ostringstream str;
-        str << handle_type_name << " 0x" << std::hex << handle << "[" << handle_name.c_str() << "]";
+        str << handle_type_name << " 0x" << std::hex << handle << "[" << (handle_name ? handle_name->c_str() : "") << "]";
         return str.str();
     }
 
@@ -297,7 +538,16 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
 
 // Forward Declarations
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                 const char *layer_prefix, const char *message, const char *text_vuid);
+                                 const char *layer_prefix, const char *message, const char *text_vuid,
+                                 std::unique_lock<std::mutex> *callback_unlock = nullptr);
+
+// Index of a single severity bit into debug_report_data::callback_types
+static inline uint32_t DebugUtilsSeverityIndex(VkDebugUtilsMessageSeverityFlagsEXT severity) {
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) return 3;
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) return 2;
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) return 1;
+    return 0;
+}
 
 static void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks, debug_report_data *debug_data) {
     // For all callback in list, return their complete set of severities and modes
@@ -313,6 +563,34 @@ static void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &cal
             debug_data->active_types |= types;
         }
     }
+
+    // Same choice of callbacks as debug_log_msg() makes
+    bool use_default_callbacks = debug_data->forceDefaultLogCallback;
+    if (!use_default_callbacks) {
+        use_default_callbacks = true;
+        for (const auto &item : callbacks) {
+            use_default_callbacks &= item.IsDefault();
+        }
+    }
+    debug_data->callback_types.fill(0);
+    for (const auto &item : callbacks) {
+        if (item.IsDefault() && !use_default_callbacks) continue;
+        if (item.IsUtils()) {
+            for (uint32_t index = 0; index < 4; ++index) {
+                if (item.debug_utils_msg_flags & (1u << (4 * index))) {
+                    debug_data->callback_types[index] |= item.debug_utils_msg_type;
+                }
+            }
+        } else {
+            // Each report flag stands for one severity
+            for (VkFlags remaining = item.debug_report_msg_flags; remaining != 0; remaining &= remaining - 1) {
+                VkDebugUtilsMessageSeverityFlagsEXT severity = 0;
+                VkDebugUtilsMessageTypeFlagsEXT types = 0;
+                DebugReportFlagsToAnnotFlags(remaining & (~remaining + 1), true, &severity, &types);
+                if (severity) debug_data->callback_types[DebugUtilsSeverityIndex(severity)] |= types;
+            }
+        }
+    }
 }
 
 static inline void RemoveDebugUtilsCallback(debug_report_data *debug_data, std::vector<VkLayerDbgFunctionState> &callbacks,
@@ -336,24 +614,17 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, std:
     callbacks.clear();
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-static inline bool UpdateLogMsgCounts(const debug_report_data *debug_data, int32_t vuid_hash) {
-    auto vuid_count_it = debug_data->duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == debug_data->duplicate_message_count_map.end()) {
-        debug_data->duplicate_message_count_map.emplace(vuid_hash, 1);
+// With callback_unlock, the debug_output_mutex lock it holds is released before the callbacks are called. Everything they are
+// handed is copied out of debug_data first.
+static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                                 const char *layer_prefix, const char *message, const char *text_vuid,
+                                 std::unique_lock<std::mutex> *callback_unlock) {
+    if (deferred_log_messages) {
+        deferred_log_messages->emplace_back(
+            DeferredLogMessage{msg_flags, objects, layer_prefix, message, text_vuid ? text_vuid : ""});
         return false;
-    } else {
-        if (vuid_count_it->second >= debug_data->duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
-        }
     }
-}
 
-static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                 const char *layer_prefix, const char *message, const char *text_vuid) {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
@@ -455,7 +726,22 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
     oss << "| MessageID = 0x" << std::hex << location << " | " << message;
     std::string composite = oss.str();
 
-    const auto callback_list = &debug_data->debug_callback_list;
+    auto callback_list = &debug_data->debug_callback_list;
+    std::vector<VkLayerDbgFunctionState> callback_list_copy;
+    std::vector<std::string> label_names;
+    if (callback_unlock) {
+        // Reserved, so that the strings never move while label names point into them
+        label_names.reserve(queue_labels.size() + cmd_buf_labels.size());
+        for (auto *labels : {&queue_labels, &cmd_buf_labels}) {
+            for (auto &label : *labels) {
+                label_names.emplace_back(label.pLabelName);
+                label.pLabelName = label_names.back().c_str();
+            }
+        }
+        callback_list_copy = debug_data->debug_callback_list;
+        callback_list = &callback_list_copy;
+        callback_unlock->unlock();
+    }
     // We only output to default callbacks if there are no non-default callbacks
     bool use_default_callbacks = true;
     for (const auto &current_callback : *callback_list) {
@@ -528,6 +814,8 @@ static inline LogMessageTypeFlags DebugAnnotFlagsToMsgTypeFlags(VkDebugUtilsMess
 
 static inline void layer_debug_utils_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        // Delivers what is left to the callbacks before they go
+        debug_data->async_log_queue.reset();
         std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
         RemoveAllMessageCallbacks(debug_data, debug_data->debug_callback_list);
         lock.unlock();
@@ -537,8 +825,12 @@ static inline void layer_debug_utils_destroy_instance(debug_report_data *debug_d
 
 template <typename T>
 static inline void layer_destroy_callback(debug_report_data *debug_data, T callback, const VkAllocationCallbacks *allocator) {
+    // The callback still gets the messages logged before it was destroyed
+    if (debug_data->async_log_queue) debug_data->async_log_queue->Flush();
     std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
     RemoveDebugUtilsCallback(debug_data, debug_data->debug_callback_list, CastToUint64(callback));
+    lock.unlock();
+    if (debug_data->async_log_queue) debug_data->async_log_queue->WaitForDelivery();
 }
 
 template <typename TCreateInfo, typename TCallback>
@@ -661,42 +953,52 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text,
+// Takes no lock, so that threads checking messages that will be dropped never wait on each other.
+static inline bool LogMsgEnabled(const debug_report_data *debug_data, const VuidString &vuid_text,
                                  VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
+    ++log_message_attempts;
+    // Nothing is formatted, counted or looked up for a message no callback would be called for
+    if (!(debug_data->callback_types[DebugUtilsSeverityIndex(severity)] & type)) {
         return false;
     }
-    // If message is in filter list, bail out very early
-    uint32_t message_id = XXH32(vuid_text.c_str(), strlen(vuid_text.c_str()), 8);
-    if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(), message_id)
-        != debug_data->filter_message_ids.end()) {
+    // Checks run on the record side keep going outside of the validation window, their findings are not reported
+    if (validation_window_closed.load(std::memory_order_relaxed) &&
+        (severity & (VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT))) {
         return false;
     }
-    if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
-        // Count for this particular message is over the limit, ignore it
-        return false;
+    // Without filters or a duplicate limit the message ID is only needed if the message is actually logged
+    const bool limit_duplicates = debug_data->duplicate_message_limit > 0;
+    if (debug_data->filter_message_ids.empty() && !limit_duplicates) {
+        return true;
     }
-    return true;
+    std::call_once(debug_data->message_ids_once, [debug_data]() {
+        debug_data->message_ids.reset(new MessageIdTable);
+        for (const uint32_t filtered_id : debug_data->filter_message_ids) {
+            debug_data->message_ids->Filter(filtered_id);
+        }
+    });
+    return debug_data->message_ids->Admit(vuid_text.MessageId(), debug_data->duplicate_message_limit);
 }
 
 static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                const std::string &vuid_text, char *err_msg) {
+                                const VuidString &vuid_string, char *err_msg,
+                                std::unique_lock<std::mutex> *callback_unlock = nullptr) {
+    const std::string vuid_text = vuid_string.str();
     std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
     if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos) &&
         (vuid_text.rfind("SYNC-", 0) == std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        // The string table is sorted by VUID
+        const vuid_spec_text_pair *vuids_end = vuid_spec_text + sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        const vuid_spec_text_pair *entry =
+            std::lower_bound(vuid_spec_text, vuids_end, vuid_text.c_str(),
+                             [](const vuid_spec_text_pair &pair, const char *vuid) { return strcmp(pair.vuid, vuid) < 0; });
         const char *spec_text = nullptr;
         std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strcmp(vuid_text.c_str(), vuid_spec_text[i].vuid)) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        if (entry != vuids_end && 0 == strcmp(vuid_text.c_str(), entry->vuid)) {
+            spec_text = entry->spec_text;
+            spec_type = entry->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
@@ -736,9 +1038,29 @@ static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg
         }
     }
 
-    bool result = debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.c_str());
     free(err_msg);
-    return result;
+    return debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.c_str(),
+                         callback_unlock);
+}
+
+// Sends a message that passed LogMsgEnabled() to the debug callbacks, or queues it for the delivery thread. Queued messages
+// cannot ask for the call to be skipped, their callbacks' return values are ignored.
+static inline bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                          const VuidString &vuid_text, char *err_msg) {
+    // Messages collected by worker threads are already on their way to the thread that delivers them in order
+    if (debug_data->async_log_queue && !deferred_log_messages) {
+        debug_data->async_log_queue->Push(msg_flags, objects, vuid_text.str(), err_msg);
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+    return LogMsgLocked(debug_data, msg_flags, objects, vuid_text, err_msg);
+}
+
+static inline void StartAsyncLogDelivery(debug_report_data *debug_data) {
+    debug_data->async_log_queue.reset(new AsyncLogQueue([debug_data](AsyncLogQueue::Message &message) {
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        LogMsgLocked(debug_data, message.msg_flags, message.objects, message.vuid_text, message.err_msg, &lock);
+    }));
 }
 
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
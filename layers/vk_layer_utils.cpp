@@ -22,12 +22,17 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <iostream>
 #include <string>
 #include <vector>
 
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
 
+thread_local std::vector<DeferredLogMessage> *deferred_log_messages = nullptr;
+thread_local uint64_t log_message_attempts = 0;
+std::atomic<bool> validation_window_closed{false};
+
 static const uint8_t kUtF8OneByteCode = 0xC0;
 static const uint8_t kUtF8OneByteMask = 0xE0;
 static const uint8_t kUtF8TwoByteCode = 0xE0;
@@ -98,9 +103,11 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string log_binary_filename_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    log_binary_filename_key.append(".log_binary_filename");
 
     // Initialize layer options
     LogMessageTypeFlags report_flags = GetLayerOptionFlags(report_flags_key, log_msg_type_option_definitions, 0);
@@ -137,6 +144,24 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
 
     messenger = VK_NULL_HANDLE;
 
+    if (debug_action & VK_DBG_LAYER_ACTION_LOG_BINARY) {
+        std::string log_binary_filename = getLayerOption(log_binary_filename_key.c_str());
+        if (log_binary_filename.empty()) log_binary_filename = "vk_validation_log.bin";
+        report_data->binary_log.reset(BinaryLogSink::Create(log_binary_filename.c_str()));
+        if (report_data->binary_log) {
+            dbg_create_info.pfnUserCallback = BinaryLogSink::Callback;
+            dbg_create_info.pUserData = report_data->binary_log.get();
+            layer_create_messenger_callback(report_data, default_layer_callback, &dbg_create_info, pAllocator, &messenger);
+        } else {
+            std::cout << std::endl
+                      << layer_identifier << " ERROR: Bad binary log filename specified: " << log_binary_filename
+                      << ". Binary logging disabled" << std::endl
+                      << std::endl;
+        }
+    }
+
+    messenger = VK_NULL_HANDLE;
+
     if (debug_action & VK_DBG_LAYER_ACTION_DEBUG_OUTPUT) {
         dbg_create_info.pfnUserCallback = messenger_win32_debug_output_msg;
         dbg_create_info.pUserData = NULL;
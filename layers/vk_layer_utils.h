@@ -319,6 +319,13 @@ static inline int u_ffs(int val) {
 #endif
 
 #ifdef __cplusplus
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
 // clang sets _MSC_VER to 1800 and _MSC_FULL_VER to 180000000, but we only want to clean up after MSVC.
 #if defined(_MSC_FULL_VER) && !defined(__clang__)
 // Minimum Visual Studio 2015 Update 2, or libc++ with C++17
@@ -409,35 +416,60 @@ class LockedSharedPtr : public std::shared_ptr<T> {
 //
 // snapshot: Return an array of elements (key, value pairs) that satisfy an optional
 // predicate. This can be used as a substitute for iterators in exceptional cases.
+// stats: Return shard count, lock contention and shard size statistics.
+//
+// BUCKETSLOG2 is the initial number of buckets (shards). The map doubles them while
+// threads contend on the bucket locks or buckets grow large, up to 64 buckets.
 template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = layer_data::hash<Key>>
 class vl_concurrent_unordered_map {
   public:
+    vl_concurrent_unordered_map() {
+        for (auto &shard : shards) {
+            shard.store(nullptr, std::memory_order_relaxed);
+        }
+        for (uint32_t h = 0; h < (1u << BUCKETSLOG2); ++h) {
+            shards[h].store(new Shard, std::memory_order_relaxed);
+        }
+    }
+    ~vl_concurrent_unordered_map() {
+        for (auto &shard : shards) {
+            delete shard.load(std::memory_order_relaxed);
+        }
+    }
+    vl_concurrent_unordered_map(const vl_concurrent_unordered_map &) = delete;
+    vl_concurrent_unordered_map &operator=(const vl_concurrent_unordered_map &) = delete;
+
     template <typename... Args>
     void insert_or_assign(const Key &key, Args &&...args) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        maps[h][key] = {std::forward<Args>(args)...};
+        GrowIfRequested();
+        WriteLockGuard lock;
+        Shard &shard = LockShard(key, lock);
+        shard.map[key] = {std::forward<Args>(args)...};
+        CheckLoad(shard);
     }
 
     template <typename... Args>
     bool insert(const Key &key, Args &&...args) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        auto ret = maps[h].emplace(key, std::forward<Args>(args)...);
+        GrowIfRequested();
+        WriteLockGuard lock;
+        Shard &shard = LockShard(key, lock);
+        auto ret = shard.map.emplace(key, std::forward<Args>(args)...);
+        CheckLoad(shard);
         return ret.second;
     }
 
     // returns size_type
     size_t erase(const Key &key) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        return maps[h].erase(key);
+        GrowIfRequested();
+        WriteLockGuard lock;
+        Shard &shard = LockShard(key, lock);
+        return shard.map.erase(key);
     }
 
     bool contains(const Key &key) const {
-        uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
-        return maps[h].count(key) != 0;
+        ReadLockGuard lock;
+        const Shard &shard = LockShard(key, lock);
+        return shard.map.count(key) != 0;
     }
 
     // type returned by find() and end().
@@ -469,11 +501,11 @@ class vl_concurrent_unordered_map {
     FindResult cend() const { return end(); }
 
     FindResult find(const Key &key) const {
-        uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
+        ReadLockGuard lock;
+        const Shard &shard = LockShard(key, lock);
 
-        auto itr = maps[h].find(key);
-        bool found = itr != maps[h].end();
+        auto itr = shard.map.find(key);
+        bool found = itr != shard.map.end();
 
         if (found) {
             return FindResult(true, itr->second);
@@ -483,15 +515,16 @@ class vl_concurrent_unordered_map {
     }
 
     FindResult pop(const Key &key) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        GrowIfRequested();
+        WriteLockGuard lock;
+        Shard &shard = LockShard(key, lock);
 
-        auto itr = maps[h].find(key);
-        bool found = itr != maps[h].end();
+        auto itr = shard.map.find(key);
+        bool found = itr != shard.map.end();
 
         if (found) {
             auto ret = std::move(FindResult(true, itr->second));
-            maps[h].erase(itr);
+            shard.map.erase(itr);
             return ret;
         } else {
             return end();
@@ -500,9 +533,11 @@ class vl_concurrent_unordered_map {
 
     std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
         std::vector<std::pair<const Key, T>> ret;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            for (const auto &j : maps[h]) {
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        for (uint32_t h = 0; h < ShardCount(); ++h) {
+            const Shard &shard = GetShard(h);
+            ReadLockGuard lock(shard.lock);
+            for (const auto &j : shard.map) {
                 if (!f || f(j.second)) {
                     ret.emplace_back(j.first, j.second);
                 }
@@ -512,46 +547,455 @@ class vl_concurrent_unordered_map {
     }
 
     void clear() {
-        for (int h = 0; h < BUCKETS; ++h) {
-            WriteLockGuard lock(locks[h].lock);
-            maps[h].clear();
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        for (uint32_t h = 0; h < ShardCount(); ++h) {
+            Shard &shard = GetShard(h);
+            WriteLockGuard lock(shard.lock);
+            shard.map.clear();
         }
     }
 
     size_t size() const {
         size_t result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            result += maps[h].size();
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        for (uint32_t h = 0; h < ShardCount(); ++h) {
+            const Shard &shard = GetShard(h);
+            ReadLockGuard lock(shard.lock);
+            result += shard.map.size();
         }
         return result;
     }
 
     bool empty() const {
-        bool result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            result |= maps[h].empty();
+        bool result = true;
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        for (uint32_t h = 0; h < ShardCount(); ++h) {
+            const Shard &shard = GetShard(h);
+            ReadLockGuard lock(shard.lock);
+            result &= shard.map.empty();
         }
         return result;
     }
 
-  private:
-    static const int BUCKETS = (1 << BUCKETSLOG2);
+    struct Stats {
+        uint32_t shard_count;
+        uint32_t resize_count;
+        uint64_t contended_acquisitions;   // acquisitions that had to wait for another thread
+        uint64_t lock_wait_ns;             // total time spent waiting in contended acquisitions
+        size_t max_shard_size;             // largest number of elements in one shard
+        size_t size;
+    };
+
+    // Shard and lock statistics, for finding out which maps are contended
+    Stats stats() const {
+        Stats result = {};
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        result.shard_count = ShardCount();
+        result.resize_count = resize_count;
+        for (uint32_t h = 0; h < result.shard_count; ++h) {
+            const Shard &shard = GetShard(h);
+            ReadLockGuard lock(shard.lock);
+            result.contended_acquisitions += shard.contended_acquisitions.load(std::memory_order_relaxed);
+            result.lock_wait_ns += shard.wait_ns.load(std::memory_order_relaxed);
+            result.max_shard_size = std::max(result.max_shard_size, shard.map.size());
+            result.size += shard.map.size();
+        }
+        return result;
+    }
 
-    layer_data::unordered_map<Key, T, Hash> maps[BUCKETS];
-    struct {
+  private:
+    // The map starts with 2^BUCKETSLOG2 shards and doubles them, up to 2^MAX_BUCKETSLOG2, when threads keep waiting on shard
+    // locks or a shard holds too many elements.
+    static const int MAX_BUCKETSLOG2 = (BUCKETSLOG2 > 6) ? BUCKETSLOG2 : 6;
+    static const int MAX_BUCKETS = (1 << MAX_BUCKETSLOG2);
+    static const uint64_t kContendedAcquisitionsPerGrow = 1024;
+    static const size_t kMaxShardSize = 4096;
+
+    struct Shard {
         mutable ReadWriteLock lock;
-        // Put each lock on its own cache line to avoid false cache line sharing.
-        char padding[(-int(sizeof(ReadWriteLock))) & 63];
-    } locks[BUCKETS];
+        mutable std::atomic<uint64_t> contended_acquisitions{0};
+        mutable std::atomic<uint64_t> wait_ns{0};
+        layer_data::unordered_map<Key, T, Hash> map;
+        // Shards are allocated separately, keep them off each other's cache lines to avoid false sharing.
+        char padding[64];
+    };
+
+    uint32_t ShardCount() const { return 1u << buckets_log2.load(std::memory_order_acquire); }
+    Shard &GetShard(uint32_t h) const { return *shards[h].load(std::memory_order_acquire); }
+
+    // Lock the shard holding key. Only acquisitions that have to wait are counted, so uncontended lookups write no shared
+    // counters. Growing the map moves elements between shards while every shard is write locked, so if the shard count changed
+    // while waiting for the lock the key may now belong to another shard and the lookup is retried.
+    template <typename Guard>
+    Shard &LockShard(const Key &key, Guard &guard) const {
+        while (true) {
+            const int log2 = buckets_log2.load(std::memory_order_acquire);
+            Shard &shard = GetShard(ConcurrentMapHashObject(key, log2));
+            guard = Guard(shard.lock, std::try_to_lock);
+            if (!guard.owns_lock()) {
+                const auto start = std::chrono::steady_clock::now();
+                guard.lock();
+                const auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                shard.wait_ns.fetch_add(static_cast<uint64_t>(wait.count()), std::memory_order_relaxed);
+                shard.contended_acquisitions.fetch_add(1, std::memory_order_relaxed);
+                if (contention_since_grow.fetch_add(1, std::memory_order_relaxed) + 1 >= kContendedAcquisitionsPerGrow) {
+                    RequestGrow(log2);
+                }
+            }
+            if (buckets_log2.load(std::memory_order_relaxed) == log2) {
+                return shard;
+            }
+            guard.unlock();
+        }
+    }
+
+    void CheckLoad(const Shard &shard) const {
+        if (shard.map.size() > kMaxShardSize) {
+            RequestGrow(buckets_log2.load(std::memory_order_relaxed));
+        }
+    }
+
+    void RequestGrow(int log2) const {
+        if (log2 < MAX_BUCKETSLOG2) {
+            grow_requested.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    // Growing needs every shard lock, so it is done at the start of a modifying call, when the caller holds none of them.
+    void GrowIfRequested() {
+        if (!grow_requested.load(std::memory_order_relaxed)) return;
+        std::lock_guard<std::mutex> resize_guard(resize_lock);
+        if (!grow_requested.exchange(false, std::memory_order_relaxed)) return;
+        const int old_log2 = buckets_log2.load(std::memory_order_relaxed);
+        if (old_log2 >= MAX_BUCKETSLOG2) return;
+        const int new_log2 = old_log2 + 1;
+        const uint32_t old_count = 1u << old_log2;
+        const uint32_t new_count = 1u << new_log2;
+
+        for (uint32_t h = old_count; h < new_count; ++h) {
+            if (!shards[h].load(std::memory_order_relaxed)) {
+                shards[h].store(new Shard, std::memory_order_release);
+            }
+        }
+        std::vector<WriteLockGuard> guards;
+        guards.reserve(new_count);
+        for (uint32_t h = 0; h < new_count; ++h) {
+            guards.emplace_back(GetShard(h).lock);
+        }
+
+        std::vector<layer_data::unordered_map<Key, T, Hash>> old_maps(old_count);
+        for (uint32_t h = 0; h < old_count; ++h) {
+            old_maps[h].swap(GetShard(h).map);
+        }
+        for (auto &old_map : old_maps) {
+            for (auto &entry : old_map) {
+                GetShard(ConcurrentMapHashObject(entry.first, new_log2)).map.emplace(entry.first, std::move(entry.second));
+            }
+        }
+        buckets_log2.store(new_log2, std::memory_order_release);
+        contention_since_grow.store(0, std::memory_order_relaxed);
+        ++resize_count;
+    }
+
+    std::atomic<Shard *> shards[MAX_BUCKETS];
+    std::atomic<int> buckets_log2{BUCKETSLOG2};
+    mutable std::atomic<bool> grow_requested{false};
+    mutable std::atomic<uint64_t> contention_since_grow{0};
+    // Serializes growing against whole map operations (snapshot, clear, size, empty, stats)
+    mutable std::mutex resize_lock;
+    uint32_t resize_count = 0;
 
-    uint32_t ConcurrentMapHashObject(const Key &object) const {
+    static uint32_t ConcurrentMapHashObject(const Key &object, int log2) {
         uint64_t u64 = (uint64_t)(uintptr_t)object;
         uint32_t hash = (uint32_t)(u64 >> 32) + (uint32_t)u64;
-        hash ^= (hash >> BUCKETSLOG2) ^ (hash >> (2 * BUCKETSLOG2));
-        hash &= (BUCKETS - 1);
+        hash ^= (hash >> log2) ^ (hash >> (2 * log2));
+        hash &= ((1u << log2) - 1);
         return hash;
     }
 };
+
+// Map from 64-bit handles to records of T, for maps that are read far more often than they are written, like the maps of
+// every live object of a type. find() takes no lock and copies nothing: it probes an open-addressed slot array and, if a
+// rebuild reused the array meanwhile, probes again. insert() and erase() take the map's lock.
+//
+// The records are allocated in blocks that are only freed with the map, and those of erased handles are kept for later
+// inserts. So a record from find() can be read at any time, but after its handle is erased it may be reused for another one.
+// The handles 0 and ~0 are reserved. The slot array is only allocated by the first insert(), so a map that is never written to
+// costs no allocation.
+template <typename T>
+class vl_concurrent_handle_map {
+  public:
+    vl_concurrent_handle_map() = default;
+    ~vl_concurrent_handle_map() {
+        delete current.load(std::memory_order_relaxed);
+        delete spare;
+        for (auto *slots : retired) delete slots;
+    }
+    vl_concurrent_handle_map(const vl_concurrent_handle_map &) = delete;
+    vl_concurrent_handle_map &operator=(const vl_concurrent_handle_map &) = delete;
+
+    // Returns false, and leaves the record alone, if key is already in the map. Otherwise init(T &) fills in the new record
+    // before find() can see it.
+    template <typename Init>
+    bool insert(uint64_t key, const Init &init) {
+        if (key == kEmpty || key == kTombstone) return false;
+        std::lock_guard<std::mutex> guard(lock);
+        SlotArray *slots = current.load(std::memory_order_relaxed);
+        if (!slots) {
+            slots = new SlotArray(kInitialSlotsLog2);
+            current.store(slots, std::memory_order_release);
+        }
+        Slot *target = nullptr;
+        for (uint64_t i = Home(*slots, key);; i = (i + 1) & slots->mask) {
+            Slot &slot = slots->slots[i];
+            const uint64_t slot_key = slot.key.load(std::memory_order_relaxed);
+            if (slot_key == key) return false;
+            if (slot_key == kTombstone && !target) target = &slot;
+            if (slot_key == kEmpty) {
+                if (!target) {
+                    target = &slot;
+                    ++slots->used;
+                }
+                break;
+            }
+        }
+        T *record = AllocateRecord();
+        init(*record);
+        target->record.store(record, std::memory_order_relaxed);
+        target->key.store(key, std::memory_order_release);
+        ++live;
+        if (slots->used * 4 > (slots->mask + 1) * 3) Rebuild();
+        return true;
+    }
+
+    bool erase(uint64_t key) {
+        std::lock_guard<std::mutex> guard(lock);
+        return EraseLocked(key, [](const T &) { return true; });
+    }
+
+    // Erases those of keys whose records f(const T &) accepts, taking the lock once, and returns how many were erased
+    template <typename F>
+    size_t erase(const std::vector<uint64_t> &keys, const F &f) {
+        std::lock_guard<std::mutex> guard(lock);
+        size_t erased = 0;
+        for (const uint64_t key : keys) {
+            if (EraseLocked(key, f)) ++erased;
+        }
+        return erased;
+    }
+
+    T *find(uint64_t key) const {
+        for (;;) {
+            const uint64_t start_version = version.load(std::memory_order_acquire);
+            const SlotArray *slots = current.load(std::memory_order_acquire);
+            if (!slots) return nullptr;
+            T *record = nullptr;
+            // A slot array being copied into can hold anything, so don't probe it past its size
+            uint64_t i = Home(*slots, key);
+            for (uint64_t probes = 0; probes <= slots->mask; ++probes, i = (i + 1) & slots->mask) {
+                const Slot &slot = slots->slots[i];
+                const uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+                if (slot_key == key) {
+                    record = slot.record.load(std::memory_order_relaxed);
+                    break;
+                }
+                if (slot_key == kEmpty) break;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (version.load(std::memory_order_relaxed) == start_version) return record;
+        }
+    }
+
+    bool contains(uint64_t key) const { return find(key) != nullptr; }
+
+    // The handles and records for which f returns true, or all of them without f
+    std::vector<std::pair<uint64_t, T *>> snapshot(std::function<bool(const T &)> f = nullptr) const {
+        std::vector<std::pair<uint64_t, T *>> ret;
+        std::lock_guard<std::mutex> guard(lock);
+        const SlotArray *slots = current.load(std::memory_order_relaxed);
+        if (!slots) return ret;
+        for (uint64_t i = 0; i <= slots->mask; ++i) {
+            const Slot &slot = slots->slots[i];
+            const uint64_t key = slot.key.load(std::memory_order_relaxed);
+            if (key == kEmpty || key == kTombstone) continue;
+            T *record = slot.record.load(std::memory_order_relaxed);
+            if (!f || f(*record)) ret.emplace_back(key, record);
+        }
+        return ret;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return static_cast<size_t>(live);
+    }
+
+  private:
+    static const uint64_t kEmpty = 0;
+    static const uint64_t kTombstone = ~0ULL;
+    static const uint32_t kInitialSlotsLog2 = 5;
+    static const uint32_t kRecordBlockSize = 64;
+
+    struct Slot {
+        std::atomic<uint64_t> key{kEmpty};
+        std::atomic<T *> record{nullptr};
+    };
+
+    struct SlotArray {
+        SlotArray(uint32_t size_log2) : slots(new Slot[1ULL << size_log2]), mask((1ULL << size_log2) - 1), shift(64 - size_log2) {}
+        std::unique_ptr<Slot[]> slots;
+        const uint64_t mask;
+        const uint32_t shift;
+        // Slots that are not empty, tombstones included
+        uint64_t used = 0;
+    };
+
+    static uint64_t Home(const SlotArray &slots, uint64_t key) { return (key * 0x9E3779B97F4A7C15ULL) >> slots.shift; }
+
+    template <typename F>
+    bool EraseLocked(uint64_t key, const F &f) {
+        if (key == kEmpty || key == kTombstone) return false;
+        SlotArray *slots = current.load(std::memory_order_relaxed);
+        if (!slots) return false;
+        for (uint64_t i = Home(*slots, key);; i = (i + 1) & slots->mask) {
+            Slot &slot = slots->slots[i];
+            const uint64_t slot_key = slot.key.load(std::memory_order_relaxed);
+            if (slot_key == kEmpty) return false;
+            if (slot_key == key) {
+                T *record = slot.record.load(std::memory_order_relaxed);
+                if (!f(*record)) return false;
+                slot.key.store(kTombstone, std::memory_order_relaxed);
+                free_records.push_back(record);
+                --live;
+                return true;
+            }
+        }
+    }
+
+    T *AllocateRecord() {
+        if (free_records.empty()) {
+            record_blocks.emplace_back(new T[kRecordBlockSize]);
+            for (uint32_t i = kRecordBlockSize; i > 0; --i) free_records.push_back(&record_blocks.back()[i - 1]);
+        }
+        T *record = free_records.back();
+        free_records.pop_back();
+        return record;
+    }
+
+    // Copies the live slots into a slot array twice the size if at least half the slots are live, otherwise into one of the same
+    // size, which drops the tombstones. A grown-out array may still be probed by a find() and is only freed with the map.
+    void Rebuild() {
+        SlotArray *old_slots = current.load(std::memory_order_relaxed);
+        const uint32_t old_log2 = 64 - old_slots->shift;
+        const bool grow = live * 2 >= old_slots->mask + 1;
+        SlotArray *new_slots = nullptr;
+        if (grow) {
+            if (spare) retired.push_back(spare);
+            spare = nullptr;
+            new_slots = new SlotArray(old_log2 + 1);
+        } else if (spare) {
+            new_slots = spare;
+            // Announce the reuse before overwriting slots a find() may still be reading
+            version.store(version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (uint64_t i = 0; i <= new_slots->mask; ++i) new_slots->slots[i].key.store(kEmpty, std::memory_order_relaxed);
+            new_slots->used = 0;
+        } else {
+            new_slots = new SlotArray(old_log2);
+        }
+        for (uint64_t i = 0; i <= old_slots->mask; ++i) {
+            const Slot &old_slot = old_slots->slots[i];
+            const uint64_t key = old_slot.key.load(std::memory_order_relaxed);
+            if (key == kEmpty || key == kTombstone) continue;
+            uint64_t j = Home(*new_slots, key);
+            while (new_slots->slots[j].key.load(std::memory_order_relaxed) != kEmpty) j = (j + 1) & new_slots->mask;
+            new_slots->slots[j].record.store(old_slot.record.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            new_slots->slots[j].key.store(key, std::memory_order_relaxed);
+            ++new_slots->used;
+        }
+        current.store(new_slots, std::memory_order_release);
+        if (grow) {
+            retired.push_back(old_slots);
+        } else {
+            spare = old_slots;
+        }
+    }
+
+    std::atomic<SlotArray *> current{nullptr};
+    // Changes whenever a slot array is reused
+    std::atomic<uint64_t> version{0};
+    mutable std::mutex lock;
+    uint64_t live = 0;
+    // The slot array replaced by the last rebuild that kept the size, to be reused by the next one
+    SlotArray *spare = nullptr;
+    std::vector<SlotArray *> retired;
+    std::vector<std::unique_ptr<T[]>> record_blocks;
+    std::vector<T *> free_records;
+};
+
+// Bump allocator for the scratch copies a call makes and drops before it returns, such as the handle-unwrapped copies of its
+// parameters. A Mark frees everything allocated since its construction in one step when it goes out of scope, Marks can nest.
+// The blocks are kept for later calls, so a thread that keeps its arena allocates only until its largest call fits. Only
+// trivially destructible types can be allocated, nothing is destroyed.
+class ScratchArena {
+  public:
+    class Mark {
+      public:
+        explicit Mark(ScratchArena &arena) : arena_(arena), block_(arena.block_), offset_(arena.offset_) {}
+        ~Mark() {
+            arena_.block_ = block_;
+            arena_.offset_ = offset_;
+        }
+        Mark(const Mark &) = delete;
+        Mark &operator=(const Mark &) = delete;
+
+      private:
+        ScratchArena &arena_;
+        size_t block_;
+        size_t offset_;
+    };
+
+    template <typename T>
+    T *Allocate(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "ScratchArena never destroys what it allocates");
+        return static_cast<T *>(AllocateBytes(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T>
+    T *Copy(const T *source, size_t count) {
+        T *copy = Allocate<T>(count);
+        std::copy(source, source + count, copy);
+        return copy;
+    }
+
+  private:
+    static const size_t kBlockSize = 16 * 1024;
+
+    struct Block {
+        explicit Block(size_t block_size) : data(new uint8_t[block_size]), size(block_size) {}
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    void *AllocateBytes(size_t size, size_t alignment) {
+        // new[] aligns the blocks for any fundamental type
+        while (true) {
+            if (block_ == blocks_.size()) {
+                blocks_.emplace_back((size > kBlockSize) ? size : size_t(kBlockSize));
+            }
+            Block &block = blocks_[block_];
+            const size_t begin = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (begin + size <= block.size) {
+                offset_ = begin + size;
+                return block.data.get() + begin;
+            }
+            ++block_;
+            offset_ = 0;
+        }
+    }
+
+    std::vector<Block> blocks_;
+    // The block and the offset in it that the next allocation starts from
+    size_t block_ = 0;
+    size_t offset_ = 0;
+};
 #endif
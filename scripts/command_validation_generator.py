@@ -179,6 +179,8 @@ class CommandValidationOutputGenerator(OutputGenerator):
             write(self.commandQueueTypeList(), file=self.outFile)
             write(self.commandRenderPassList(), file=self.outFile)
             write(self.commandBufferLevelList(), file=self.outFile)
+            write(self.commandStateBits(), file=self.outFile)
+            write(self.commandRequirementList(), file=self.outFile)
             write(self.validateFunction(), file=self.outFile)
         # Finish processing in superclass
         OutputGenerator.endFile(self)
@@ -255,6 +257,31 @@ static const std::array<const char *, CMD_RANGE_SIZE> kGeneratedMustBeRecordingL
         output += '}};'
         return output
 
+    #
+    # The VkQueueFlagBits of the queues a command is supported on
+    def getQueueFlags(self, cmdinfo):
+        flags = []
+        queues = cmdinfo.elem.attrib.get('queues').split(',')
+        for queue in queues:
+            if queue == 'graphics':
+                flags.append("VK_QUEUE_GRAPHICS_BIT")
+            elif queue == 'compute':
+                flags.append("VK_QUEUE_COMPUTE_BIT")
+            elif queue == 'transfer':
+                flags.append("VK_QUEUE_TRANSFER_BIT")
+            elif queue == 'sparse_binding':
+                flags.append("VK_QUEUE_SPARSE_BINDING_BIT")
+            elif queue == 'protected':
+                flags.append("VK_QUEUE_PROTECTED_BIT")
+            elif queue == 'decode':
+                flags.append("VK_QUEUE_VIDEO_DECODE_BIT_KHR")
+            elif queue == 'encode':
+                flags.append("VK_QUEUE_VIDEO_ENCODE_BIT_KHR")
+            else:
+                print("A new queue type %s was added to VkQueueFlagBits and need to update generation code", queue)
+                sys.exit(1)
+        return flags
+
     #
     # For each CMD_TYPE give a queue type and string name add a *-commandBuffer-cmdpool VUID
     # Each vkCmd* will have one
@@ -269,26 +296,7 @@ static const std::array<CommandSupportedQueueType, CMD_RANGE_SIZE> kGeneratedQue
         for name, cmdinfo in sorted(self.commands.items()):
             if name in self.alias_dict:
                 name = self.alias_dict[name]
-            flags = []
-            queues = cmdinfo.elem.attrib.get('queues').split(',')
-            for queue in queues:
-                if queue == 'graphics':
-                    flags.append("VK_QUEUE_GRAPHICS_BIT")
-                elif queue == 'compute':
-                    flags.append("VK_QUEUE_COMPUTE_BIT")
-                elif queue == 'transfer':
-                    flags.append("VK_QUEUE_TRANSFER_BIT")
-                elif queue == 'sparse_binding':
-                    flags.append("VK_QUEUE_SPARSE_BINDING_BIT")
-                elif queue == 'protected':
-                    flags.append("VK_QUEUE_PROTECTED_BIT")
-                elif queue == 'decode':
-                    flags.append("VK_QUEUE_VIDEO_DECODE_BIT_KHR")
-                elif queue == 'encode':
-                    flags.append("VK_QUEUE_VIDEO_ENCODE_BIT_KHR")
-                else:
-                    print("A new queue type %s was added to VkQueueFlagBits and need to update generation code", queue)
-                    sys.exit(1)
+            flags = self.getQueueFlags(cmdinfo)
             vuid = 'VUID-' + name + '-commandBuffer-cmdpool'
             if vuid not in self.valid_vuids:
                 print("Warning: Could not find {} in validusage.json".format(vuid))
@@ -363,12 +371,117 @@ static const std::array<const char *, CMD_RANGE_SIZE> kGeneratedBufferLevelList
         output += '}};'
         return output
 
+    #
+    # The sets of queue flags of the commands, each set in the order of kQueueFlagOrder
+    kQueueFlagOrder = ['VK_QUEUE_GRAPHICS_BIT', 'VK_QUEUE_COMPUTE_BIT', 'VK_QUEUE_TRANSFER_BIT', 'VK_QUEUE_SPARSE_BINDING_BIT',
+                       'VK_QUEUE_PROTECTED_BIT', 'VK_QUEUE_VIDEO_DECODE_BIT_KHR', 'VK_QUEUE_VIDEO_ENCODE_BIT_KHR']
+    def getQueueFlagSet(self, cmdinfo):
+        flags = self.getQueueFlags(cmdinfo)
+        return tuple(flag for flag in self.kQueueFlagOrder if flag in flags)
+
+    def queueFlagSets(self):
+        flag_sets = []
+        for name, cmdinfo in sorted(self.commands.items()):
+            flag_set = self.getQueueFlagSet(cmdinfo)
+            if flag_set not in flag_sets:
+                flag_sets.append(flag_set)
+        return flag_sets
+
+    def queueStateBitName(self, flag_set):
+        names = [flag.replace('VK_QUEUE_', '').replace('VIDEO_', '').replace('_BIT_KHR', '').replace('_BIT', '')
+                 for flag in flag_set]
+        return 'CMD_STATE_NO_' + '_'.join(names) + '_QUEUE'
+
+    #
+    # The bits of the command buffer state word and the functions computing it
+    def commandStateBits(self):
+        output = '''
+// The command buffer state word ValidateCmd compares to kGeneratedCommandRequirementList, a bit for each state that makes some
+// commands invalid
+enum CMD_STATE_BITS : uint32_t {
+    CMD_STATE_NOT_RECORDING = 0x1,
+    CMD_STATE_OUTSIDE_RENDER_PASS = 0x2,
+    CMD_STATE_INSIDE_RENDER_PASS = 0x4,
+    CMD_STATE_SECONDARY = 0x8,
+    // In a subpass of a primary command buffer recorded with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+    CMD_STATE_SECONDARY_CONTENTS = 0x10,
+    // The queue family of the command pool supports none of the queues of a set\n'''
+        flag_sets = self.queueFlagSets()
+        if len(flag_sets) + 5 > 32:
+            print("The command buffer state word is out of bits, need to update generation code")
+            sys.exit(1)
+        bit = 5
+        for flag_set in flag_sets:
+            output += '    ' + self.queueStateBitName(flag_set) + ' = 0x%x,\n' % (1 << bit)
+            bit += 1
+        output += '''};
+
+// The bits of the command buffer state word that are fixed at allocation
+uint32_t CommandBufferFixedStateBits(VkCommandBufferLevel level, VkQueueFlags queue_flags) {
+    uint32_t state_bits = (level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) ? 0 : CMD_STATE_SECONDARY;\n'''
+        for flag_set in flag_sets:
+            output += '    if (!(queue_flags & (' + ' | '.join(flag_set) + '))) {\n'
+            output += '        state_bits |= ' + self.queueStateBitName(flag_set) + ';\n'
+            output += '    }\n'
+        output += '''    return state_bits;
+}
+
+static uint32_t CommandBufferStateBits(const CMD_BUFFER_STATE *cb_state) {
+    // Every command buffer of CoreChecks is a CORE_CMD_BUFFER_STATE
+    uint32_t state_bits = static_cast<const CORE_CMD_BUFFER_STATE *>(cb_state)->fixed_state_bits;
+    if (cb_state->state != CB_RECORDING) {
+        state_bits |= CMD_STATE_NOT_RECORDING;
+    }
+    if (cb_state->activeRenderPass) {
+        state_bits |= CMD_STATE_INSIDE_RENDER_PASS;
+        if (cb_state->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY &&
+            cb_state->activeSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) {
+            state_bits |= CMD_STATE_SECONDARY_CONTENTS;
+        }
+    } else if (cb_state->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ||
+               !(cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+        state_bits |= CMD_STATE_OUTSIDE_RENDER_PASS;
+    }
+    return state_bits;
+}'''
+        return output
+
+    #
+    # For each CMD_TYPE give the bits of the command buffer state word the command is invalid in
+    def commandRequirementList(self):
+        output = '''
+static const std::array<uint32_t, CMD_RANGE_SIZE> kGeneratedCommandRequirementList = {{
+    CMD_STATE_NOT_RECORDING | CMD_STATE_SECONDARY_CONTENTS, // CMD_NONE\n'''
+        # The commands ValidateCmdSubpassState allows in a subpass with secondary command buffer contents
+        secondary_contents_commands = ['vkCmdExecuteCommands', 'vkCmdNextSubpass', 'vkCmdNextSubpass2', 'vkCmdNextSubpass2KHR',
+                                       'vkCmdEndRenderPass', 'vkCmdEndRenderPass2', 'vkCmdEndRenderPass2KHR']
+        for name, cmdinfo in sorted(self.commands.items()):
+            bits = ['CMD_STATE_NOT_RECORDING']
+            if name not in secondary_contents_commands:
+                bits.append('CMD_STATE_SECONDARY_CONTENTS')
+            bits.append(self.queueStateBitName(self.getQueueFlagSet(cmdinfo)))
+            render_pass = cmdinfo.elem.attrib.get('renderpass')
+            if render_pass == 'inside':
+                bits.append('CMD_STATE_OUTSIDE_RENDER_PASS')
+            elif render_pass == 'outside':
+                bits.append('CMD_STATE_INSIDE_RENDER_PASS')
+            if cmdinfo.elem.attrib.get('cmdbufferlevel') == 'primary':
+                bits.append('CMD_STATE_SECONDARY')
+            output += '    ' + ' | '.join(bits) + ',\n'
+        output += '}};'
+        return output
+
     #
     # The main function to validate all the commands
     def validateFunction(self):
         output = '''
 // Used to handle all the implicit VUs that are autogenerated from the registry
 bool CoreChecks::ValidateCmd(const CMD_BUFFER_STATE *cb_state, const CMD_TYPE cmd) const {
+    // The command is valid if the command buffer is in none of the states it is invalid in, otherwise find out what is wrong
+    if ((CommandBufferStateBits(cb_state) & kGeneratedCommandRequirementList[cmd]) == 0) {
+        return false;
+    }
+
     bool skip = false;
     const char *caller_name = CommandTypeString(cmd);
 
@@ -151,7 +151,6 @@ class FormatUtilsOutputGenerator(OutputGenerator):
         if self.sourceFile:
             write('#include "vk_format_utils.h"', file=self.outFile)
             write('#include "vk_layer_utils.h"', file=self.outFile)
-            write('#include <map>', file=self.outFile)
             write('#include <vector>', file=self.outFile)
         elif self.headerFile:
             write('#pragma once', file=self.outFile)
@@ -183,6 +182,14 @@ extern "C" {
         # Finish processing in superclass
         OutputGenerator.endFile(self)
     #
+    # VkFormat value of a format, extension enums are given by their extension number and offset
+    def formatValue(self, formatName):
+        enum = self.registry.enumdict[formatName].elem
+        if 'value' in enum.keys():
+            return int(enum.get('value'), 0)
+        value = 1000000000 + 1000 * (int(enum.get('extnumber')) - 1) + int(enum.get('offset'))
+        return -value if enum.get('dir') == '-' else value
+    #
     # Capture all Format elements from registry
     def genFormat(self, format, formatinfo, alias):
         OutputGenerator.genFormat(self, format, formatinfo, alias)
@@ -199,6 +206,7 @@ extern "C" {
         self.classes[elem.get('class')] = classBit
 
         self.allFormats[formatName] = {
+            'value' : self.formatValue(formatName),
             'class' : classBit,
             'blockSize' : int(elem.get('blockSize')),
             'texelsPerBlock' : int(elem.get('texelsPerBlock')),
@@ -303,46 +311,102 @@ struct COMPONENT_INFO {
     COMPONENT_TYPE type;
     uint32_t size; // bits
 
-    COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
-    COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
+    constexpr COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {}
+    constexpr COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {}
 };
 
+// Index of FORMAT_INFO::multiplane for formats with a single plane
+const uint32_t NOT_MULTIPLANE = 0xFFFFFFFF;
+
 // Generic information for all formats
 struct FORMAT_INFO {
+    VkFormat format;
     FORMAT_COMPATIBILITY_CLASS compatibility;
     uint32_t block_size; // bytes
     uint32_t texel_per_block;
     VkExtent3D block_extent;
     uint32_t component_count;
     COMPONENT_INFO components[FORMAT_MAX_COMPONENTS];
+    uint32_t multiplane; // index in kVkMultiplaneCompatibilityTable
 };
 
-namespace std {
-template <>
-struct hash<VkFormat> {
-    size_t operator()(VkFormat fmt) const NOEXCEPT {
-        return hash<uint32_t>()(static_cast<uint32_t>(fmt));
-    }
-};
-}
-
+// Sorted by format value. The core formats come first, at the index of their value. Extension formats are numbered from
+// 1000000000 + 1000 * (extension number - 1), each extension's formats follow as one of kVkFormatTableRanges.
 // clang-format off
-static const layer_data::unordered_map<VkFormat, FORMAT_INFO> kVkFormatTable = {
+static constexpr FORMAT_INFO kVkFormatTable[] = {
 '''
-            for f, info in sorted(self.allFormats.items()):
-                output += '    {{{},\n'.format(f)
-                output += '        {{FORMAT_COMPATIBILITY_CLASS::{}, {}, {}, {{{}}}, {},\n        {{'.format(
-                    info['class'], info['blockSize'], info['texelsPerBlock'], info['blockExtent'].replace(',', ', '), len(info['components']))
+            formats = sorted(self.allFormats.items(), key=lambda item: item[1]['value'])
+            planarFormats = [f for f, info in formats if f in self.planarFormats]
+            output += '    {VK_FORMAT_UNDEFINED, FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {}, NOT_MULTIPLANE},\n'
+            for f, info in formats:
+                output += '    {{{}, FORMAT_COMPATIBILITY_CLASS::{}, {}, {}, {{{}}}, {},\n        {{'.format(
+                    f, info['class'], info['blockSize'], info['texelsPerBlock'], info['blockExtent'].replace(',', ', '), len(info['components']))
                 for index, component in enumerate(info['components']):
                     output += '{{COMPONENT_TYPE::{}, {}}}'.format(component['type'], component['bits'])
                     output += ', ' if (index + 1 != len(info['components'])) else ''
-                output += '} }},\n'
+                multiplane = planarFormats.index(f) if f in planarFormats else 'NOT_MULTIPLANE'
+                output += '}}, {}}},\n'.format(multiplane)
+            output += '};\n'
+            output += '// clang-format on\n'
+
+            # VK_FORMAT_UNDEFINED and the core formats, then the runs of consecutive extension format values
+            coreCount = 1 + sum(1 for f, info in formats if info['value'] < 1000000000)
+            if formats[coreCount - 2][1]['value'] != coreCount - 1:
+                self.logMsg('error', 'core format values are not consecutive')
+            ranges = []
+            for index, (f, info) in enumerate(formats[coreCount - 1:], start=coreCount):
+                if ranges and info['value'] == formats[index - 2][1]['value'] + 1:
+                    ranges[-1][1] += 1
+                else:
+                    ranges.append([f, 1, index])
+
+            output += '\nstatic constexpr uint32_t kVkCoreFormatCount = {};\n'.format(coreCount)
+            output += '''
+struct FORMAT_TABLE_RANGE {
+    VkFormat first;
+    uint32_t count;
+    uint32_t index; // of first in kVkFormatTable
+};
 
-            output += '    {VK_FORMAT_UNDEFINED, {FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {}}}'
+// clang-format off
+static constexpr FORMAT_TABLE_RANGE kVkFormatTableRanges[] = {
+'''
+            for first, count, index in ranges:
+                output += '    {{{}, {}, {}}},\n'.format(first, count, index)
             output += '};\n'
             output += '// clang-format on\n'
 
             output += '''
+// Checks at compile time that each entry of kVkFormatTable is where the lookup expects it
+static constexpr bool FormatTableHasRange(uint32_t index, uint32_t value, uint32_t count) {
+    return (count == 0) || ((static_cast<uint32_t>(kVkFormatTable[index].format) == value) &&
+                            FormatTableHasRange(index + 1, value + 1, count - 1));
+}
+static_assert(FormatTableHasRange(0, 0, kVkCoreFormatCount), "kVkFormatTable core formats out of order");
+'''
+            for first, count, index in ranges:
+                output += 'static_assert(FormatTableHasRange({}, {}, {}), "kVkFormatTable extension formats out of order");\n'.format(
+                    index, first, count)
+            output += 'static_assert(sizeof(kVkFormatTable) / sizeof(FORMAT_INFO) == {}, "kVkFormatTable has formats outside the ranges");\n'.format(
+                len(formats) + 1)
+
+            output += '''
+// nullptr for formats without an entry
+static inline const FORMAT_INFO *GetFormatInfo(VkFormat format) {
+    const uint32_t value = static_cast<uint32_t>(format);
+    if (value < kVkCoreFormatCount) {
+        return &kVkFormatTable[value];
+    }
+    for (const auto &range : kVkFormatTableRanges) {
+        // Wraps around for values below the range
+        const uint32_t offset = value - static_cast<uint32_t>(range.first);
+        if (offset < range.count) {
+            return &kVkFormatTable[range.index + offset];
+        }
+    }
+    return nullptr;
+}
+
 struct PER_PLANE_COMPATIBILITY {
     uint32_t width_divisor;
     uint32_t height_divisor;
@@ -351,8 +415,8 @@ struct PER_PLANE_COMPATIBILITY {
     // Need default otherwise if app tries to grab a plane that doesn't exist it will crash
     // if returned the value of 0 in IMAGE_STATE::GetSubresourceExtent()
     // This is ok, because there are VUs later that will catch the bad app behaviour
-    PER_PLANE_COMPATIBILITY() : width_divisor(1), height_divisor(1), compatible_format(VK_FORMAT_UNDEFINED) {}
-    PER_PLANE_COMPATIBILITY(uint32_t width_divisor, uint32_t height_divisor, VkFormat compatible_format) :
+    constexpr PER_PLANE_COMPATIBILITY() : width_divisor(1), height_divisor(1), compatible_format(VK_FORMAT_UNDEFINED) {}
+    constexpr PER_PLANE_COMPATIBILITY(uint32_t width_divisor, uint32_t height_divisor, VkFormat compatible_format) :
         width_divisor(width_divisor), height_divisor(height_divisor), compatible_format(compatible_format) {}
 };
 
@@ -362,17 +426,19 @@ struct MULTIPLANE_COMPATIBILITY {
 };
 
 // Source: Vulkan spec Table 47. Plane Format Compatibility Table
+// Indexed by FORMAT_INFO::multiplane, in the order of kVkFormatTable
 // clang-format off
-static const layer_data::unordered_map<VkFormat, MULTIPLANE_COMPATIBILITY> kVkMultiplaneCompatibilityMap {
+static constexpr MULTIPLANE_COMPATIBILITY kVkMultiplaneCompatibilityTable[] = {
 '''
 
-            for f in sorted(self.planarFormats.keys()):
-                output += '    {{ {}, {{{{\n'.format(f)
+            for f in planarFormats:
+                output += '    // {}\n'.format(f)
+                output += '    {{\n'
                 for index, plane in enumerate(self.planarFormats[f]):
                     if (index != plane['index']):
                         self.logMsg('error', 'index of planes were not added in order')
                     output += '        {{ {}, {}, {} }}'.format(plane['widthDivisor'], plane['heightDivisor'], plane['compatible'])
-                    output += ',\n' if (index + 1 != len(self.planarFormats[f])) else '\n    }}},\n'
+                    output += ',\n' if (index + 1 != len(self.planarFormats[f])) else '\n    }},\n'
             output += '};\n'
             output += '// clang-format on\n'
 
@@ -676,25 +742,26 @@ VK_LAYER_EXPORT VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImage
 // Will return VK_FORMAT_UNDEFINED if given a plane aspect that doesn't exist for the format
 VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    const FORMAT_INFO *info = GetFormatInfo(mp_fmt);
+    if (!info || (info->multiplane == NOT_MULTIPLANE) || (plane_idx >= FORMAT_MAX_PLANES)) {
         return VK_FORMAT_UNDEFINED;
     }
 
-    return it->second.per_plane[plane_idx].compatible_format;
+    return kVkMultiplaneCompatibilityTable[info->multiplane].per_plane[plane_idx].compatible_format;
 }
 
 // Will return {1, 1} if given a plane aspect that doesn't exist for the format
 VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     VkExtent2D divisors = {1, 1};
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    const FORMAT_INFO *info = GetFormatInfo(mp_fmt);
+    if (!info || (info->multiplane == NOT_MULTIPLANE) || (plane_idx >= FORMAT_MAX_PLANES)) {
         return divisors;
     }
 
-    divisors.width = it->second.per_plane[plane_idx].width_divisor;
-    divisors.height = it->second.per_plane[plane_idx].height_divisor;
+    const PER_PLANE_COMPATIBILITY &plane = kVkMultiplaneCompatibilityTable[info->multiplane].per_plane[plane_idx];
+    divisors.width = plane.width_divisor;
+    divisors.height = plane.height_divisor;
     return divisors;
 }
 '''
@@ -715,25 +782,25 @@ VK_LAYER_EXPORT double FormatTexelSize(VkFormat format, VkImageAspectFlags aspec
         elif self.sourceFile:
             output += '''
 uint32_t FormatComponentCount(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.component_count;
+    const FORMAT_INFO *format_info = GetFormatInfo(format);
+    if (format_info) {
+        return format_info->component_count;
     }
     return 0;
 }
 
 VkExtent3D FormatTexelBlockExtent(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.block_extent;
+    const FORMAT_INFO *format_info = GetFormatInfo(format);
+    if (format_info) {
+        return format_info->block_extent;
     }
     return {1, 1, 1};
 }
 
 FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.compatibility;
+    const FORMAT_INFO *format_info = GetFormatInfo(format);
+    if (format_info) {
+        return format_info->compatibility;
     }
     return FORMAT_COMPATIBILITY_CLASS::NONE;
 }
@@ -761,9 +828,9 @@ uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags aspectMask) {
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.block_size;
+    const FORMAT_INFO *format_info = GetFormatInfo(format);
+    if (format_info) {
+        return format_info->block_size;
     }
     return 0;
 }
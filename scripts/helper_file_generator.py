@@ -1944,6 +1944,13 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
             '    typedef {typename} {typedef};\n',
             '}};\n'))
 
+        pnext_indexmap = prefix + 'PNextIndexMap'
+        empty_pnext_indexmap = 'template <typename T> struct ' + pnext_indexmap + ' {};'
+        pnext_indexmap_format = ''.join((
+            'template <> struct {template}<{typename}> {{\n',
+            '    static const uint32_t kIndex = {index};\n',
+            '}};\n'))
+
         # Define the utilities (here so any renaming stays consistent), if this grows large, refactor to a fixed .h file
         utilities_format = '\n'.join((
             '// Find an entry of the given type in the const pNext chain',
@@ -2002,9 +2009,12 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
             '#include <vulkan/vulkan.h>\n',
             explanatory_comment, '',
             empty_idmap,
-            empty_typemap, '')))
+            empty_typemap,
+            '// Specialized with a compact index for each type that can extend another through pNext',
+            empty_pnext_indexmap, '')))
 
         # Generate the specializations for each type and stype
+        chain_structs = []
         for item in self.structMembers:
             typename = item.name
             info = self.structTypes.get(typename)
@@ -2018,10 +2028,32 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
             code.append(typemap_format.format(template=typemap, typename=typename, id_value=info.value,
                 id_decl=id_decl, id_member=id_member))
             code.append(idmap_format.format(template=idmap, typename=typename, id_value=info.value, typedef=type_member))
+            if typename in self.structextends_list:
+                code.append(pnext_indexmap_format.format(template=pnext_indexmap, typename=typename, index=len(chain_structs)))
+                chain_structs.append(item)
 
             if item.ifdef_protect is not None:
                 code.append('#endif // %s' % item.ifdef_protect)
 
+        # Generate the sType to pNext index lookup, in the ifdef grouping of SafePnextCopy
+        code.append('static const uint32_t kLvlPNextIndexCount = %d;\n' % len(chain_structs))
+        code.append('// Index of a pNext struct by its sType, kLvlPNextIndexCount for sTypes that do not extend another struct')
+        code.append('static inline uint32_t LvlPNextIndexOf(VkStructureType sType) {')
+        code.append('    switch (sType) {')
+        ifdefs = sorted({cs.ifdef_protect for cs in chain_structs}, key = lambda i : i if i is not None else '')
+        for ifdef in ifdefs:
+            if ifdef is not None:
+                code.append('#ifdef %s' % ifdef)
+            for struct in (s for s in chain_structs if s.ifdef_protect == ifdef):
+                code.append('        case %s:' % self.structTypes[struct.name].value)
+                code.append('            return %s<%s>::kIndex;' % (pnext_indexmap, struct.name))
+            if ifdef is not None:
+                code.append('#endif // %s' % ifdef)
+        code.append('        default:')
+        code.append('            return kLvlPNextIndexCount;')
+        code.append('    }')
+        code.append('}\n')
+
         # Generate Generate utilities for all types
         find_func = 'LvlFindInChain'
         find_mod_func = 'LvlFindModInChain'
@@ -2043,6 +2075,29 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 find_mod_func=find_mod_func, init_func=init_func), ''
             )))
 
+        code.append('\n'.join((
+            '// The structs of a const pNext chain, decoded with one walk of the chain so that looking up each of them does not',
+            '// walk it again. Find returns the first struct of the type in the chain, as LvlFindInChain does.',
+            'class LvlPNextIndex {{',
+            '  public:',
+            '    explicit LvlPNextIndex(const void *next) : structs_() {{',
+            '        for (auto current = reinterpret_cast<const {header} *>(next); current; current = current->pNext) {{',
+            '            const uint32_t index = LvlPNextIndexOf(current->sType);',
+            '            if ((index < kLvlPNextIndexCount) && !structs_[index]) {{',
+            '                structs_[index] = current;',
+            '            }}',
+            '        }}',
+            '    }}',
+            '',
+            '    template <typename T> const T *Find() const {{',
+            '        return reinterpret_cast<const T *>(structs_[{index_map}<T>::kIndex]);',
+            '    }}',
+            '',
+            '  private:',
+            '    const void *structs_[kLvlPNextIndexCount];',
+            '}};',
+            '')).format(header=generic_header, index_map=pnext_indexmap))
+
         return "\n".join(code)
 
     #
@@ -151,8 +151,6 @@ class LayerChassisDispatchOutputGenerator(OutputGenerator):
 
     inline_custom_source_preamble = """
 
-#define DISPATCH_MAX_STACK_ALLOCATIONS 32
-
 // The VK_EXT_pipeline_creation_feedback extension returns data from the driver -- we've created a copy of the pnext chain, so
 // copy the returned data to the caller before freeing the copy's data.
 void CopyCreatePipelineFeedbackData(const void *src_chain, const void *dst_chain) {
@@ -1364,6 +1362,202 @@ VkResult DispatchGetDeferredOperationResultKHR(
 
     return result;
 }
+
+// vkQueueSubmit and vkUpdateDescriptorSets run every frame, so when no pNext chain of theirs holds a handle, their structs
+// aren't deep copied into safe structs: shallow copies with unwrapped handle arrays are made in a per-thread scratch arena,
+// which keeps its memory from call to call. Chains that hold handles take the safe struct copies like other entry points.
+static ScratchArena &GetDispatchScratchArena() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+template <typename HandleType>
+static const HandleType *UnwrapToScratch(ValidationObject *layer_data, ScratchArena &arena, const HandleType *handles,
+                                         uint32_t count) {
+    HandleType *unwrapped = arena.Allocate<HandleType>(count);
+    for (uint32_t index = 0; index < count; ++index) {
+        unwrapped[index] = layer_data->Unwrap(handles[index]);
+    }
+    return unwrapped;
+}
+
+VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    bool pnext_handles = false;
+    if (pSubmits) {
+        for (uint32_t index0 = 0; (index0 < submitCount) && !pnext_handles; ++index0) {
+            pnext_handles = PnextChainHasHandles(pSubmits[index0].pNext);
+        }
+    }
+    if (!pnext_handles) {
+        ScratchArena &arena = GetDispatchScratchArena();
+        ScratchArena::Mark mark(arena);
+        VkSubmitInfo *local_pSubmits = pSubmits ? arena.Copy(pSubmits, submitCount) : nullptr;
+        for (uint32_t index0 = 0; local_pSubmits && (index0 < submitCount); ++index0) {
+            VkSubmitInfo &submit = local_pSubmits[index0];
+            if (submit.pWaitSemaphores) {
+                submit.pWaitSemaphores = UnwrapToScratch(layer_data, arena, submit.pWaitSemaphores, submit.waitSemaphoreCount);
+            }
+            if (submit.pSignalSemaphores) {
+                submit.pSignalSemaphores =
+                    UnwrapToScratch(layer_data, arena, submit.pSignalSemaphores, submit.signalSemaphoreCount);
+            }
+        }
+        return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, local_pSubmits, layer_data->Unwrap(fence));
+    }
+
+    safe_VkSubmitInfo *local_pSubmits = new safe_VkSubmitInfo[submitCount];
+    for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+        local_pSubmits[index0].initialize(&pSubmits[index0]);
+        WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
+        if (local_pSubmits[index0].pWaitSemaphores) {
+            for (uint32_t index1 = 0; index1 < local_pSubmits[index0].waitSemaphoreCount; ++index1) {
+                local_pSubmits[index0].pWaitSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pWaitSemaphores[index1]);
+            }
+        }
+        if (local_pSubmits[index0].pSignalSemaphores) {
+            for (uint32_t index1 = 0; index1 < local_pSubmits[index0].signalSemaphoreCount; ++index1) {
+                local_pSubmits[index0].pSignalSemaphores[index1] =
+                    layer_data->Unwrap(local_pSubmits[index0].pSignalSemaphores[index1]);
+            }
+        }
+    }
+    fence = layer_data->Unwrap(fence);
+    VkResult result =
+        layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, (const VkSubmitInfo *)local_pSubmits, fence);
+    delete[] local_pSubmits;
+    return result;
+}
+
+// The same descriptor info arrays as safe_VkWriteDescriptorSet copies, unwrapped
+static void UnwrapDescriptorWriteToScratch(ValidationObject *layer_data, ScratchArena &arena, VkWriteDescriptorSet &write) {
+    if (write.dstSet) {
+        write.dstSet = layer_data->Unwrap(write.dstSet);
+    }
+    const VkDescriptorImageInfo *image_info = nullptr;
+    const VkDescriptorBufferInfo *buffer_info = nullptr;
+    const VkBufferView *texel_buffer_view = nullptr;
+    switch (write.descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            if (write.descriptorCount && write.pImageInfo) {
+                VkDescriptorImageInfo *local_image_info = arena.Copy(write.pImageInfo, write.descriptorCount);
+                for (uint32_t index = 0; index < write.descriptorCount; ++index) {
+                    if (local_image_info[index].sampler) {
+                        local_image_info[index].sampler = layer_data->Unwrap(local_image_info[index].sampler);
+                    }
+                    if (local_image_info[index].imageView) {
+                        local_image_info[index].imageView = layer_data->Unwrap(local_image_info[index].imageView);
+                    }
+                }
+                image_info = local_image_info;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            if (write.descriptorCount && write.pBufferInfo) {
+                VkDescriptorBufferInfo *local_buffer_info = arena.Copy(write.pBufferInfo, write.descriptorCount);
+                for (uint32_t index = 0; index < write.descriptorCount; ++index) {
+                    if (local_buffer_info[index].buffer) {
+                        local_buffer_info[index].buffer = layer_data->Unwrap(local_buffer_info[index].buffer);
+                    }
+                }
+                buffer_info = local_buffer_info;
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            if (write.descriptorCount && write.pTexelBufferView) {
+                texel_buffer_view = UnwrapToScratch(layer_data, arena, write.pTexelBufferView, write.descriptorCount);
+            }
+            break;
+        default:
+            break;
+    }
+    write.pImageInfo = image_info;
+    write.pBufferInfo = buffer_info;
+    write.pTexelBufferView = texel_buffer_view;
+}
+
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    bool pnext_handles = false;
+    if (pDescriptorWrites) {
+        for (uint32_t index0 = 0; (index0 < descriptorWriteCount) && !pnext_handles; ++index0) {
+            pnext_handles = PnextChainHasHandles(pDescriptorWrites[index0].pNext);
+        }
+    }
+    ScratchArena &arena = GetDispatchScratchArena();
+    ScratchArena::Mark mark(arena);
+    VkCopyDescriptorSet *local_pDescriptorCopies = pDescriptorCopies ? arena.Copy(pDescriptorCopies, descriptorCopyCount) : nullptr;
+    for (uint32_t index0 = 0; local_pDescriptorCopies && (index0 < descriptorCopyCount); ++index0) {
+        if (local_pDescriptorCopies[index0].srcSet) {
+            local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(local_pDescriptorCopies[index0].srcSet);
+        }
+        if (local_pDescriptorCopies[index0].dstSet) {
+            local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(local_pDescriptorCopies[index0].dstSet);
+        }
+    }
+    if (!pnext_handles) {
+        VkWriteDescriptorSet *local_pDescriptorWrites =
+            pDescriptorWrites ? arena.Copy(pDescriptorWrites, descriptorWriteCount) : nullptr;
+        for (uint32_t index0 = 0; local_pDescriptorWrites && (index0 < descriptorWriteCount); ++index0) {
+            UnwrapDescriptorWriteToScratch(layer_data, arena, local_pDescriptorWrites[index0]);
+        }
+        layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, local_pDescriptorWrites,
+                                                               descriptorCopyCount, local_pDescriptorCopies);
+        return;
+    }
+
+    safe_VkWriteDescriptorSet *local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+    for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
+        local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
+        WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
+        if (pDescriptorWrites[index0].dstSet) {
+            local_pDescriptorWrites[index0].dstSet = layer_data->Unwrap(pDescriptorWrites[index0].dstSet);
+        }
+        if (local_pDescriptorWrites[index0].pImageInfo) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                if (pDescriptorWrites[index0].pImageInfo[index1].sampler) {
+                    local_pDescriptorWrites[index0].pImageInfo[index1].sampler =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].sampler);
+                }
+                if (pDescriptorWrites[index0].pImageInfo[index1].imageView) {
+                    local_pDescriptorWrites[index0].pImageInfo[index1].imageView =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].imageView);
+                }
+            }
+        }
+        if (local_pDescriptorWrites[index0].pBufferInfo) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                if (pDescriptorWrites[index0].pBufferInfo[index1].buffer) {
+                    local_pDescriptorWrites[index0].pBufferInfo[index1].buffer =
+                        layer_data->Unwrap(pDescriptorWrites[index0].pBufferInfo[index1].buffer);
+                }
+            }
+        }
+        if (local_pDescriptorWrites[index0].pTexelBufferView) {
+            for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
+                local_pDescriptorWrites[index0].pTexelBufferView[index1] =
+                    layer_data->Unwrap(local_pDescriptorWrites[index0].pTexelBufferView[index1]);
+            }
+        }
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount,
+                                                           (const VkWriteDescriptorSet *)local_pDescriptorWrites,
+                                                           descriptorCopyCount, local_pDescriptorCopies);
+    delete[] local_pDescriptorWrites;
+}
 """
     # Separate generated text for source and headers
     ALL_SECTIONS = ['source_file', 'header_file']
@@ -1387,6 +1581,8 @@ VkResult DispatchGetDeferredOperationResultKHR(
             'vkDestroySwapchainKHR',
             'vkQueuePresentKHR',
             'vkCreateGraphicsPipelines',
+            'vkQueueSubmit',
+            'vkUpdateDescriptorSets',
             'vkResetDescriptorPool',
             'vkDestroyDescriptorPool',
             'vkAllocateDescriptorSets',
@@ -1705,6 +1901,7 @@ VkResult DispatchGetDeferredOperationResultKHR(
     def build_extension_processing_func(self):
         # Construct helper functions to build and free pNext extension chains
         pnext_proc = ''
+        has_handles_proc = ''
         pnext_proc += 'void WrapPnextChainHandles(ValidationObject *layer_data, const void *pNext) {\n'
         pnext_proc += '    void *cur_pnext = const_cast<void *>(pNext);\n'
         pnext_proc += '    while (cur_pnext != NULL) {\n'
@@ -1727,6 +1924,11 @@ VkResult DispatchGetDeferredOperationResultKHR(
             if struct_info[0].feature_protect is not None:
                 pnext_proc += '#endif // %s \n' % struct_info[0].feature_protect
             pnext_proc += '\n'
+            if struct_info[0].feature_protect is not None:
+                has_handles_proc += '#ifdef %s\n' % struct_info[0].feature_protect
+            has_handles_proc += '            case %s:\n' % self.structTypes[item].value
+            if struct_info[0].feature_protect is not None:
+                has_handles_proc += '#endif  // %s\n' % struct_info[0].feature_protect
         pnext_proc += '            default:\n'
         pnext_proc += '                break;\n'
         pnext_proc += '        }\n\n'
@@ -1734,6 +1936,19 @@ VkResult DispatchGetDeferredOperationResultKHR(
         pnext_proc += '        cur_pnext = header->pNext;\n'
         pnext_proc += '    }\n'
         pnext_proc += '}\n'
+        pnext_proc += '\n'
+        pnext_proc += '// Whether WrapPnextChainHandles would unwrap any handle of the chain\n'
+        pnext_proc += 'bool PnextChainHasHandles(const void *pNext) {\n'
+        pnext_proc += '    for (auto header = reinterpret_cast<const VkBaseInStructure *>(pNext); header; header = header->pNext) {\n'
+        pnext_proc += '        switch (header->sType) {\n'
+        pnext_proc += has_handles_proc
+        pnext_proc += '                return true;\n'
+        pnext_proc += '            default:\n'
+        pnext_proc += '                break;\n'
+        pnext_proc += '        }\n'
+        pnext_proc += '    }\n'
+        pnext_proc += '    return false;\n'
+        pnext_proc += '}\n'
         return pnext_proc
 
     #
@@ -1844,12 +2059,11 @@ VkResult DispatchGetDeferredOperationResultKHR(
         post_call_code = ''
         if ndo_count is not None:
             if top_level == True:
-                decl_code += '%s%s var_local_%s%s[DISPATCH_MAX_STACK_ALLOCATIONS];\n' % (indent, ndo_type, prefix, ndo_name)
                 decl_code += '%s%s *local_%s%s = NULL;\n' % (indent, ndo_type, prefix, ndo_name)
             pre_call_code += '%s    if (%s%s) {\n' % (indent, prefix, ndo_name)
             indent = self.incIndent(indent)
             if top_level == True:
-                pre_call_code += '%s    local_%s%s = %s > DISPATCH_MAX_STACK_ALLOCATIONS ? new %s[%s] : var_local_%s%s;\n' % (indent, prefix, ndo_name, ndo_count, ndo_type, ndo_count, prefix, ndo_name)
+                pre_call_code += '%s    local_%s%s = scratch_arena.Allocate<%s>(%s);\n' % (indent, prefix, ndo_name, ndo_type, ndo_count)
                 pre_call_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, ndo_count, index)
                 indent = self.incIndent(indent)
                 pre_call_code += '%s    local_%s%s[%s] = layer_data->Unwrap(%s[%s]);\n' % (indent, prefix, ndo_name, index, ndo_name, index)
@@ -1861,10 +2075,6 @@ VkResult DispatchGetDeferredOperationResultKHR(
             pre_call_code += '%s    }\n' % indent
             indent = self.decIndent(indent)
             pre_call_code += '%s    }\n' % indent
-            if top_level == True:
-                post_call_code += '%sif (local_%s%s != var_local_%s%s)\n' % (indent, prefix, ndo_name, prefix, ndo_name)
-                indent = self.incIndent(indent)
-                post_call_code += '%sdelete[] local_%s;\n' % (indent, ndo_name)
         else:
             if top_level == True:
                 if (destroy_func == False) or (destroy_array == True):
@@ -1918,6 +2128,12 @@ VkResult DispatchGetDeferredOperationResultKHR(
                     if member.len is not None:
                         # Check if this function can be deferred.
                         deferred_name = next((member.name for member in members if member.type == 'VkDeferredOperationKHR'), None)
+                        # Arrays of structs without pointers, but for a pNext chain without handles, are shallow copied to the
+                        # dispatch scratch arena
+                        scratch_copy = (first_level_param == True) and (deferred_name is None) and not process_pnext and \
+                            all((not struct_member.ispointer) or (struct_member.name == 'pNext') for struct_member in struct_info)
+                        if scratch_copy:
+                            safe_type = member.type
                         # Update struct prefix
                         if first_level_param == True:
                             new_prefix = 'local_%s' % member.name
@@ -1927,7 +2143,9 @@ VkResult DispatchGetDeferredOperationResultKHR(
                             new_prefix = '%s%s' % (prefix, member.name)
                         pre_code += '%s    if (%s%s) {\n' % (indent, prefix, member.name)
                         indent = self.incIndent(indent)
-                        if first_level_param == True:
+                        if scratch_copy:
+                            pre_code += '%s    %s = scratch_arena.Allocate<%s>(%s);\n' % (indent, new_prefix, safe_type, member.len)
+                        elif first_level_param == True:
                             pre_code += '%s    %s = new %s[%s];\n' % (indent, new_prefix, safe_type, member.len)
                         pre_code += '%s    for (uint32_t %s = 0; %s < %s%s; ++%s) {\n' % (indent, index, index, prefix, member.len, index)
                         indent = self.incIndent(indent)
@@ -1948,7 +2166,7 @@ VkResult DispatchGetDeferredOperationResultKHR(
                         pre_code += '%s    }\n' % indent
                         indent = self.decIndent(indent)
                         pre_code += '%s    }\n' % indent
-                        if first_level_param == True:
+                        if (first_level_param == True) and not scratch_copy:
                             post_code += self.cleanUpLocalDeclarations(indent, prefix, member.name, member.len, deferred_name, index)
                     # Single Struct
                     elif member.ispointer:
@@ -2035,6 +2253,11 @@ VkResult DispatchGetDeferredOperationResultKHR(
             if param_pre_code:
                 if (not destroy_func) or (destroy_array):
                     param_pre_code = '%s{\n%s%s}\n' % ('    ', param_pre_code, indent)
+            # The handle arrays and flat struct arrays unwrapped into the scratch arena are freed on return
+            if 'scratch_arena.' in param_pre_code:
+                scratch_decl = '%sScratchArena &scratch_arena = GetDispatchScratchArena();\n' % indent
+                scratch_decl += '%sScratchArena::Mark scratch_mark(scratch_arena);\n' % indent
+                paramdecl = scratch_decl + paramdecl
         return paramdecl, param_pre_code, param_post_code
     #
     # Capture command parameter info needed to wrap NDOs as well as handling some boilerplate code
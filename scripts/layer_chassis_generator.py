@@ -208,6 +208,14 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkDestroyDebugUtilsMessengerEXT' : 'layer_destroy_callback(layer_data->report_data, messenger, pAllocator);',
         }
 
+    # Labels that may open or close the window of khronos_validation.validation_window
+    validation_window_label_functions = [
+        'vkQueueBeginDebugUtilsLabelEXT',
+        'vkQueueInsertDebugUtilsLabelEXT',
+        'vkCmdBeginDebugUtilsLabelEXT',
+        'vkCmdInsertDebugUtilsLabelEXT',
+        ]
+
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
@@ -238,24 +246,13 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "unique_id_mapping.h"
+#include "handle_registry.h"
+#include "call_context.h"
+#include "validation_counters.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern UniqueIdMapping unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -300,6 +297,11 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_OBJECT_IN_USE,
     VALIDATION_CHECK_DISABLE_QUERY_VALIDATION,
     VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_DESCRIPTOR_CONTENT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_SUBMIT_IMAGE_LAYOUT_VALIDATION,
+    VALIDATION_CHECK_DISABLE_DYNAMIC_STATE_VALIDATION,
+    VALIDATION_CHECK_DISABLE_VERTEX_BUFFER_VALIDATION,
+    VALIDATION_CHECK_DISABLE_RENDER_PASS_COMPATIBILITY_VALIDATION,
 } ValidationCheckDisables;
 
 typedef enum ValidationCheckEnables {
@@ -328,6 +330,11 @@ typedef enum DisableFlags {
     handle_wrapping,
     shader_validation,
     shader_validation_caching,
+    descriptor_content_validation,
+    submit_image_layout_validation,
+    dynamic_state_validation,
+    vertex_buffer_validation,
+    render_pass_compatibility_validation,
     // Insert new disables above this line
     kMaxDisableFlags,
 } DisableFlags;
@@ -353,6 +360,24 @@ typedef std::array<bool, kMaxEnableFlags> CHECK_ENABLED;
 #else
 #define DECORATE_PRINTF(_fmt_num, _first_param_num)
 #endif
+
+class ValidationThreadPool;
+
+#ifdef VVL_FIXED_CHASSIS
+class StatelessValidation;
+class ObjectLifetimes;
+class CoreChecks;
+
+// With VVL_FIXED_CHASSIS the device-level validation object set is fixed at compile time. The intercepts call through these
+// typed pointers with qualified names, so the compiler can inline the calls (or drop them when the base class no-op is used)
+// instead of going through the ValidationObject vtable. A null pointer means the object was disabled at runtime.
+struct FixedValidationObjects {
+    StatelessValidation *stateless_validation = nullptr;
+    ObjectLifetimes *object_tracker = nullptr;
+    CoreChecks *core_checks = nullptr;
+};
+#endif
+
 // Layer chassis validation object base class definition
 class ValidationObject {
     public:
@@ -368,6 +393,29 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{false};
+        bool deferred_command_validation{false};
+        bool async_validation{false};
+        bool command_buffer_fingerprinting{false};
+        uint32_t memory_report_interval{0};
+        bool parallel_pipeline_validation{false};
+        bool async_shader_validation{false};
+        uint32_t specialization_cache_size{0};
+        bool parallel_descriptor_update_validation{false};
+        bool parallel_sync_resolve{false};
+        bool parallel_sync_hazard_detection{false};
+        bool parallel_submit_validation{false};
+        uint32_t syncval_max_memory_mb{0};
+        uint32_t thread_safety_sampling{0};
+        bool stateless_create_info_memo{false};
+        bool async_submission_retirement{false};
+        uint32_t housekeeping_budget_us{0};
+        uint32_t housekeeping_submit_interval{0};
+        // The layer-wide worker threads, set at instance creation when a setting uses them
+        std::shared_ptr<ValidationThreadPool> thread_pool;
+        // The records of each wrapped handle shared by the validation objects, set when handles are wrapped by the slab
+        std::shared_ptr<HandleRegistry> handle_registry;
+        // The PreCallValidate hooks run per intercept, set on the device object with khronos_validation.validation_counters
+        std::unique_ptr<std::atomic<uint64_t>[]> validate_call_counts;
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -376,6 +424,9 @@ class ValidationObject {
 
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
+#ifdef VVL_FIXED_CHASSIS
+        FixedValidationObjects fixed_objects;
+#endif
 
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void()>>, 0> deferred_operation_post_completion;
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void(const std::vector<VkPipeline>&)>>, 0> deferred_operation_post_check;
@@ -398,6 +449,9 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Appends the counters of this validation object, see validation_counters.h
+        virtual void GetValidationCounters(ValidationCounterList &counters) const {}
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -412,6 +466,25 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            deferred_command_validation = framework->deferred_command_validation;
+            async_validation = framework->async_validation;
+            command_buffer_fingerprinting = framework->command_buffer_fingerprinting;
+            memory_report_interval = framework->memory_report_interval;
+            parallel_pipeline_validation = framework->parallel_pipeline_validation;
+            async_shader_validation = framework->async_shader_validation;
+            specialization_cache_size = framework->specialization_cache_size;
+            parallel_descriptor_update_validation = framework->parallel_descriptor_update_validation;
+            parallel_sync_resolve = framework->parallel_sync_resolve;
+            parallel_sync_hazard_detection = framework->parallel_sync_hazard_detection;
+            parallel_submit_validation = framework->parallel_submit_validation;
+            syncval_max_memory_mb = framework->syncval_max_memory_mb;
+            thread_safety_sampling = framework->thread_safety_sampling;
+            stateless_create_info_memo = framework->stateless_create_info_memo;
+            async_submission_retirement = framework->async_submission_retirement;
+            housekeeping_budget_us = framework->housekeeping_budget_us;
+            housekeeping_submit_interval = framework->housekeeping_submit_interval;
+            thread_pool = framework->thread_pool;
+            handle_registry = framework->handle_registry;
             instance = inst;
         }
 
@@ -427,6 +500,25 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                deferred_command_validation = inst_obj->deferred_command_validation;
+                async_validation = inst_obj->async_validation;
+                command_buffer_fingerprinting = inst_obj->command_buffer_fingerprinting;
+                memory_report_interval = inst_obj->memory_report_interval;
+                parallel_pipeline_validation = inst_obj->parallel_pipeline_validation;
+                async_shader_validation = inst_obj->async_shader_validation;
+                specialization_cache_size = inst_obj->specialization_cache_size;
+                parallel_descriptor_update_validation = inst_obj->parallel_descriptor_update_validation;
+                parallel_sync_resolve = inst_obj->parallel_sync_resolve;
+                parallel_sync_hazard_detection = inst_obj->parallel_sync_hazard_detection;
+                parallel_submit_validation = inst_obj->parallel_submit_validation;
+                syncval_max_memory_mb = inst_obj->syncval_max_memory_mb;
+                thread_safety_sampling = inst_obj->thread_safety_sampling;
+                stateless_create_info_memo = inst_obj->stateless_create_info_memo;
+                async_submission_retirement = inst_obj->async_submission_retirement;
+                housekeeping_budget_us = inst_obj->housekeeping_budget_us;
+                housekeeping_submit_interval = inst_obj->housekeeping_submit_interval;
+                thread_pool = inst_obj->thread_pool;
+                handle_registry = dev_obj->handle_registry;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -443,8 +535,7 @@ class ValidationObject {
         };
 
         // Debug Logging Helpers
-        bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -457,12 +548,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kErrorBit, objects, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -476,12 +566,11 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kErrorBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kErrorBit, single_object, vuid_text, str);
 
         };
 
-        bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -494,12 +583,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -513,11 +601,10 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kWarningBit, single_object, vuid_text, str);
         };
 
-        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
@@ -530,12 +617,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, objects, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)) {
@@ -549,11 +635,10 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kPerformanceWarningBit, single_object, vuid_text, str);
         };
 
-        bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -566,12 +651,11 @@ class ValidationObject {
                 str = nullptr;
             }
             va_end(argptr);
-            return LogMsgLocked(report_data, kInformationBit, objects, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, objects, vuid_text, str);
         };
 
         template <typename HANDLE_T>
-        bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
-            std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
+        bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const VuidString &vuid_text, const char *format, ...) const {
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
                                VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)) {
@@ -585,7 +669,7 @@ class ValidationObject {
             }
             va_end(argptr);
             LogObjectList single_object(src_object);
-            return LogMsgLocked(report_data, kInformationBit, single_object, vuid_text, str);
+            return LogMsg(report_data, kInformationBit, single_object, vuid_text, str);
         };
 
         // Handle Wrapping Data
@@ -618,17 +702,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -679,14 +759,16 @@ class ValidationObject {
 #include "chassis.h"
 #include "layer_options.h"
 #include "layer_chassis_dispatch.h"
+#include "hook_timing.h"
+#include "validation_worker_pool.h"
+#include "validation_window.h"
+#include "low_memory_profile.h"
 
-small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+dispatch_key_map<ValidationObject> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+UniqueIdMapping unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -710,10 +792,89 @@ bool wrap_handles = true;
 // Global list of sType,size identifiers
 std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info{};
 
+// The PreCallValidate hooks of an entry point, none outside of the window of khronos_validation.validation_window
+static const std::vector<ValidationObject *> no_validate_intercepts;
+static inline const std::vector<ValidationObject *> &ValidateIntercepts(const ValidationObject *layer_data, InterceptId id) {
+    if (ValidationWindowClosed()) return no_validate_intercepts;
+    if (layer_data->validate_call_counts) layer_data->validate_call_counts[id].fetch_add(1, std::memory_order_relaxed);
+    return layer_data->intercept_vectors[id];
+}
+
+static ValidationCounterList CollectValidationCounters(const ValidationObject *layer_data) {
+    ValidationCounterList counters;
+    if (layer_data->validate_call_counts) {
+        for (uint32_t id = 0; id < InterceptIdCount; ++id) {
+            const uint64_t count = layer_data->validate_call_counts[id].load(std::memory_order_relaxed);
+            if (count != 0) counters.push_back(ValidationCounterValue{std::string("Chassis.") + kInterceptNames[id], count});
+        }
+    }
+    // The validation objects take the locks of the state they count themselves
+    for (auto intercept : layer_data->object_dispatch) {
+        intercept->GetValidationCounters(counters);
+    }
+    return counters;
+}
+
+static void LogValidationCounters(const ValidationObject *layer_data) {
+    const std::string text = FormatValidationCounters(CollectValidationCounters(layer_data));
+    layer_data->LogInfo(layer_data->device, "UNASSIGNED-ValidationCounters", "%s", text.c_str());
+}
+
 #ifdef INSTRUMENT_OPTICK
 static const bool use_optick_instrumentation = true;
 #else
 static const bool use_optick_instrumentation = false;
+#endif
+
+#ifdef VVL_FIXED_CHASSIS
+#ifdef INSTRUMENT_OPTICK
+#error "VVL_FIXED_CHASSIS dispatches directly to CoreChecks and cannot be combined with INSTRUMENT_OPTICK"
+#endif
+
+// Call a PreCallValidate hook on each fixed validation object in dispatch order, running skip_action as soon as one of them
+// reports an error
+#define FIXED_CHASSIS_VALIDATE(layer_data, skip_action, hook, ...)                                                     \\
+    do {                                                                                                               \\
+        if (ValidationWindowClosed()) break;                                                                           \\
+        const FixedValidationObjects &fixed = (layer_data)->fixed_objects;                                             \\
+        if (fixed.stateless_validation) {                                                                              \\
+            HookTimer hook_timer(#hook, LayerObjectTypeParameterValidation);                                           \\
+            auto lock = fixed.stateless_validation->StatelessValidation::ReadLock();                                   \\
+            if (static_cast<const StatelessValidation *>(fixed.stateless_validation)->StatelessValidation::hook(__VA_ARGS__)) \\
+                skip_action;                                                                                           \\
+        }                                                                                                              \\
+        if (fixed.object_tracker) {                                                                                    \\
+            HookTimer hook_timer(#hook, LayerObjectTypeObjectTracker);                                                 \\
+            auto lock = fixed.object_tracker->ObjectLifetimes::ReadLock();                                             \\
+            if (static_cast<const ObjectLifetimes *>(fixed.object_tracker)->ObjectLifetimes::hook(__VA_ARGS__)) skip_action; \\
+        }                                                                                                              \\
+        if (fixed.core_checks) {                                                                                       \\
+            HookTimer hook_timer(#hook, LayerObjectTypeCoreValidation);                                                \\
+            auto lock = fixed.core_checks->CoreChecks::ReadLock();                                                     \\
+            if (static_cast<const CoreChecks *>(fixed.core_checks)->CoreChecks::hook(__VA_ARGS__)) skip_action;        \\
+        }                                                                                                              \\
+    } while (0)
+
+// Call a PreCallRecord or PostCallRecord hook on each fixed validation object in dispatch order
+#define FIXED_CHASSIS_RECORD(layer_data, hook, ...)                                \\
+    do {                                                                           \\
+        const FixedValidationObjects &fixed = (layer_data)->fixed_objects;         \\
+        if (fixed.stateless_validation) {                                          \\
+            HookTimer hook_timer(#hook, LayerObjectTypeParameterValidation);       \\
+            auto lock = fixed.stateless_validation->StatelessValidation::WriteLock(); \\
+            fixed.stateless_validation->StatelessValidation::hook(__VA_ARGS__);    \\
+        }                                                                          \\
+        if (fixed.object_tracker) {                                                \\
+            HookTimer hook_timer(#hook, LayerObjectTypeObjectTracker);             \\
+            auto lock = fixed.object_tracker->ObjectLifetimes::WriteLock();        \\
+            fixed.object_tracker->ObjectLifetimes::hook(__VA_ARGS__);              \\
+        }                                                                          \\
+        if (fixed.core_checks) {                                                   \\
+            HookTimer hook_timer(#hook, LayerObjectTypeCoreValidation);            \\
+            auto lock = fixed.core_checks->CoreChecks::WriteLock();                \\
+            fixed.core_checks->CoreChecks::hook(__VA_ARGS__);                      \\
+        }                                                                          \\
+    } while (0)
 #endif"""
 
     inline_custom_source_preamble_2 = """
@@ -839,8 +1000,18 @@ void OutputLayerStatusInfo(ValidationObject *context) {
 
 // Non-code-generated chassis API functions
 
+VKAPI_ATTR VkResult VKAPI_CALL GetValidationCountersLAYER(VkDevice device, uint32_t *pCounterCount,
+                                                          VkValidationCounterLAYER *pCounters) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    return CopyValidationCounters(CollectValidationCounters(layer_data), pCounterCount, pCounters);
+}
+
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    // Provided by the layer itself rather than by an extension
+    if (strcmp(funcName, VK_LAYER_VALIDATION_COUNTERS_FUNCTION_NAME) == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(GetValidationCountersLAYER);
+    }
     if (!ApiParentExtensionEnabled(funcName, &layer_data->device_extensions)) {
         return nullptr;
     }
@@ -935,38 +1106,92 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
     bool lock_setting;
+    bool lock_free_handle_setting;
+    bool deferred_validation_setting = false;
+    bool async_validation_setting = false;
+    bool command_buffer_fingerprinting_setting = false;
+    uint32_t memory_report_interval_setting = 0;
+    bool parallel_pipeline_validation_setting = false;
+    bool async_shader_validation_setting = false;
+    uint32_t specialization_cache_size_setting = 0;
+    bool parallel_descriptor_update_validation_setting = false;
+    bool parallel_sync_resolve_setting = false;
+    bool parallel_sync_hazard_detection_setting = false;
+    bool parallel_submit_validation_setting = false;
+    uint32_t syncval_max_memory_mb_setting = 0;
+    bool async_message_delivery_setting = false;
+    bool hook_timing_setting = false;
+    uint32_t hook_timing_interval_setting = 0;
+    bool layer_trace_setting = false;
+    uint32_t thread_safety_sampling_setting = 0;
+    bool stateless_create_info_memo_setting = false;
+    bool async_submission_retirement_setting = false;
+    ValidationThreadPool::Settings thread_pool_settings;
+    uint32_t housekeeping_budget_us_setting = 0;
+    uint32_t housekeeping_submit_interval_setting = 0;
+    bool validation_window_setting = false;
+    uint32_t validation_window_start_frame_setting = 0;
+    uint32_t validation_window_frame_count_setting = 0;
+    bool validation_counters_setting = false;
+    uint32_t validation_counters_interval_setting = 0;
+    bool low_memory_profile_setting = false;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting, &lock_free_handle_setting,
+        &deferred_validation_setting, &async_validation_setting, &command_buffer_fingerprinting_setting,
+        &memory_report_interval_setting,
+        &parallel_pipeline_validation_setting, &async_shader_validation_setting, &specialization_cache_size_setting,
+        &parallel_descriptor_update_validation_setting, &parallel_sync_resolve_setting,
+        &parallel_sync_hazard_detection_setting, &parallel_submit_validation_setting, &syncval_max_memory_mb_setting,
+        &async_message_delivery_setting,
+        &hook_timing_setting, &hook_timing_interval_setting, &layer_trace_setting, &thread_safety_sampling_setting,
+        &stateless_create_info_memo_setting, &async_submission_retirement_setting, &thread_pool_settings.thread_count,
+        &thread_pool_settings.affinity_mask, &thread_pool_settings.priority, &housekeeping_budget_us_setting,
+        &housekeeping_submit_interval_setting, &validation_window_setting, &validation_window_start_frame_setting,
+        &validation_window_frame_count_setting, &validation_counters_setting, &validation_counters_interval_setting,
+        &low_memory_profile_setting};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
+    if (async_message_delivery_setting) StartAsyncLogDelivery(report_data);
+    if (hook_timing_setting) EnableHookTiming(hook_timing_interval_setting);
+    if (validation_window_setting) {
+        EnableValidationWindow(validation_window_start_frame_setting, validation_window_frame_count_setting);
+    }
+    if (validation_counters_setting) EnableValidationCounters(validation_counters_interval_setting);
+    if (low_memory_profile_setting) {
+        EnableLowMemoryProfile();
+        // Coarse sync-val ranges unless a budget is set, and no memo trading memory for speed
+        if (syncval_max_memory_mb_setting == 0) syncval_max_memory_mb_setting = kLowMemorySyncvalMaxMemoryMb;
+        stateless_create_info_memo_setting = false;
+    }
+    if (layer_trace_setting) EnableLayerTrace();
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
+#ifdef VVL_FIXED_CHASSIS
+    // The fixed chassis only dispatches to StatelessValidation, ObjectLifetimes and CoreChecks
+    local_disables[thread_safety] = true;
+    local_enables[best_practices] = false;
+    local_enables[gpu_validation] = false;
+    local_enables[debug_printf] = false;
+    local_enables[sync_validation] = false;
+#endif
+
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
 
     // Add VOs to dispatch vector. Order here will be the validation dispatch order!
-    auto thread_checker_obj = new ThreadSafety(nullptr);
-    thread_checker_obj->RegisterValidationObject(!local_disables[thread_safety], api_version, report_data, local_object_dispatch);
-
-    auto parameter_validation_obj = new StatelessValidation;
-    parameter_validation_obj->RegisterValidationObject(!local_disables[stateless_checks], api_version, report_data, local_object_dispatch);
-
-    auto object_tracker_obj = new ObjectLifetimes;
-    object_tracker_obj->RegisterValidationObject(!local_disables[object_tracking], api_version, report_data, local_object_dispatch);
-
-    auto core_checks_obj = use_optick_instrumentation ? new CoreChecksOptickInstrumented : new CoreChecks;
-    core_checks_obj->RegisterValidationObject(!local_disables[core_checks], api_version, report_data, local_object_dispatch);
-
-    auto best_practices_obj = new BestPractices;
-    best_practices_obj->RegisterValidationObject(local_enables[best_practices], api_version, report_data, local_object_dispatch);
-
-    auto gpu_assisted_obj = new GpuAssisted;
-    gpu_assisted_obj->RegisterValidationObject(local_enables[gpu_validation], api_version, report_data, local_object_dispatch);
-
-    auto debug_printf_obj = new DebugPrintf;
-    debug_printf_obj->RegisterValidationObject(local_enables[debug_printf], api_version, report_data, local_object_dispatch);
-
-    auto sync_validation_obj = new SyncValidator;
-    sync_validation_obj->RegisterValidationObject(local_enables[sync_validation], api_version, report_data, local_object_dispatch);
+    // Only the enabled VOs are created, a disabled one would build its tables for nothing.
+    ValidationObject *local_objs[] = {
+        local_disables[thread_safety] ? nullptr : new ThreadSafety(nullptr),
+        local_disables[stateless_checks] ? nullptr : new StatelessValidation,
+        local_disables[object_tracking] ? nullptr : new ObjectLifetimes,
+        local_disables[core_checks] ? nullptr : use_optick_instrumentation ? new CoreChecksOptickInstrumented : new CoreChecks,
+        local_enables[best_practices] ? new BestPractices : nullptr,
+        local_enables[gpu_validation] ? new GpuAssisted : nullptr,
+        local_enables[debug_printf] ? new DebugPrintf : nullptr,
+        local_enables[sync_validation] ? new SyncValidator : nullptr,
+    };
+    for (auto obj : local_objs) {
+        if (obj) obj->RegisterValidationObject(true, api_version, report_data, local_object_dispatch);
+    }
 
     // If handle wrapping is disabled via the ValidationFeatures extension, override build flag
     if (local_disables[handle_wrapping]) {
@@ -974,19 +1199,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     }
 
     // Init dispatch array and call registration functions
+    ValidationCallContext call_context;
     bool skip = false;
     for (auto intercept : local_object_dispatch) {
+        HookTimer hook_timer("PreCallValidateCreateInstance", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : local_object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateInstance", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
 
     VkResult result = fpCreateInstance(pCreateInfo, pAllocator, pInstance);
     if (result != VK_SUCCESS) return result;
+    // Instances created while another exists keep the wrapped handle backend that one uses
+    unique_id_mapping.AddInstance(lock_free_handle_setting);
 
     auto framework = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
 
@@ -995,6 +1225,33 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    // Checks run on the worker pool, and the checks fingerprinting skips, are the ones deferred to vkEndCommandBuffer
+    framework->deferred_command_validation =
+        deferred_validation_setting || async_validation_setting || command_buffer_fingerprinting_setting;
+    framework->async_validation = async_validation_setting;
+    framework->command_buffer_fingerprinting = command_buffer_fingerprinting_setting;
+    framework->memory_report_interval = memory_report_interval_setting;
+    framework->parallel_pipeline_validation = parallel_pipeline_validation_setting;
+    framework->async_shader_validation = async_shader_validation_setting;
+    framework->specialization_cache_size = specialization_cache_size_setting;
+    framework->parallel_descriptor_update_validation = parallel_descriptor_update_validation_setting;
+    framework->parallel_sync_resolve = parallel_sync_resolve_setting;
+    framework->parallel_sync_hazard_detection = parallel_sync_hazard_detection_setting;
+    framework->parallel_submit_validation = parallel_submit_validation_setting;
+    framework->syncval_max_memory_mb = syncval_max_memory_mb_setting;
+    framework->thread_safety_sampling = thread_safety_sampling_setting;
+    framework->stateless_create_info_memo = stateless_create_info_memo_setting;
+    framework->async_submission_retirement = async_submission_retirement_setting;
+    framework->housekeeping_budget_us = housekeeping_budget_us_setting;
+    framework->housekeeping_submit_interval = housekeeping_submit_interval_setting;
+    if (async_validation_setting || async_shader_validation_setting || parallel_pipeline_validation_setting ||
+        parallel_descriptor_update_validation_setting || parallel_sync_resolve_setting || parallel_sync_hazard_detection_setting ||
+        parallel_submit_validation_setting) {
+        framework->thread_pool = ValidationThreadPool::Get(thread_pool_settings);
+    }
+    if (wrap_handles && unique_id_mapping.IsLockFree()) {
+        framework->handle_registry = std::make_shared<HandleRegistry>(unique_id_mapping);
+    }
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1004,32 +1261,16 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     OutputLayerStatusInfo(framework);
 
-    thread_checker_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    object_tracker_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    parameter_validation_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    core_checks_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    best_practices_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    gpu_assisted_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    debug_printf_obj->FinalizeInstanceValidationObject(framework, *pInstance);
-    sync_validation_obj->FinalizeInstanceValidationObject(framework, *pInstance);
+    for (auto intercept : framework->object_dispatch) {
+        intercept->FinalizeInstanceValidationObject(framework, *pInstance);
+    }
 
     for (auto intercept : framework->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateInstance", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
 
-    // Delete unused validation objects to avoid memory leak.
-    std::vector<ValidationObject*> local_objs = {
-        thread_checker_obj, object_tracker_obj, parameter_validation_obj,
-        core_checks_obj, best_practices_obj, gpu_assisted_obj, debug_printf_obj,
-        sync_validation_obj,
-    };
-    for (auto obj : local_objs) {
-        if (std::find(local_object_dispatch.begin(), local_object_dispatch.end(), obj) == local_object_dispatch.end()) {
-            delete obj;
-        }
-    }
-
     InstanceExtensionWhitelist(framework, pCreateInfo, *pInstance);
     DeactivateInstanceDebugCallbacks(report_data);
     return result;
@@ -1041,10 +1282,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     ActivateInstanceDebugCallbacks(layer_data->report_data);
 
     """ + precallvalidate_loop + """
+        HookTimer hook_timer("PreCallValidateDestroyInstance", intercept->container_type);
         auto lock = intercept->ReadLock();
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     """ + precallrecord_loop + """
+        HookTimer hook_timer("PreCallRecordDestroyInstance", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -1052,6 +1295,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
     """ + postcallrecord_loop + """
+        HookTimer hook_timer("PostCallRecordDestroyInstance", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -1065,6 +1309,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         delete *item;
     }
     FreeLayerDataPtr(key, layer_data_map);
+    unique_id_mapping.RemoveInstance();
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
@@ -1096,13 +1341,16 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     safe_VkDeviceCreateInfo modified_create_info(pCreateInfo);
 
+    ValidationCallContext call_context;
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
+        HookTimer hook_timer("PreCallValidateCreateDevice", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateDevice", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
@@ -1127,54 +1375,55 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_interceptor->physical_device = gpu;
     device_interceptor->instance = instance_interceptor->instance;
     device_interceptor->report_data = instance_interceptor->report_data;
+    if (wrap_handles && unique_id_mapping.IsLockFree()) {
+        device_interceptor->handle_registry = std::make_shared<HandleRegistry>(unique_id_mapping);
+    }
 
     // Note that this DEFINES THE ORDER IN WHICH THE LAYER VALIDATION OBJECTS ARE CALLED
     auto disables = instance_interceptor->disabled;
     auto enables = instance_interceptor->enabled;
 
-    auto thread_safety_obj = new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading)));
-    thread_safety_obj->InitDeviceValidationObject(!disables[thread_safety], instance_interceptor, device_interceptor);
-
-    auto stateless_validation_obj = new StatelessValidation;
-    stateless_validation_obj->InitDeviceValidationObject(!disables[stateless_checks], instance_interceptor, device_interceptor);
-
-    auto object_tracker_obj = new ObjectLifetimes;
-    object_tracker_obj->InitDeviceValidationObject(!disables[object_tracking], instance_interceptor, device_interceptor);
-
-    auto core_checks_obj = use_optick_instrumentation ? new CoreChecksOptickInstrumented : new CoreChecks;
-    core_checks_obj->InitDeviceValidationObject(!disables[core_checks], instance_interceptor, device_interceptor);
-
-    auto best_practices_obj = new BestPractices;
-    best_practices_obj->InitDeviceValidationObject(enables[best_practices], instance_interceptor, device_interceptor);
-
-    auto gpu_assisted_obj = new GpuAssisted;
-    gpu_assisted_obj->InitDeviceValidationObject(enables[gpu_validation], instance_interceptor, device_interceptor);
-
-    auto debug_printf_obj = new DebugPrintf;
-    debug_printf_obj->InitDeviceValidationObject(enables[debug_printf], instance_interceptor, device_interceptor);
-
-    auto sync_validation_obj = new SyncValidator;
-    sync_validation_obj->InitDeviceValidationObject(enables[sync_validation], instance_interceptor, device_interceptor);
-
-    // Delete unused validation objects to avoid memory leak.
-    std::vector<ValidationObject *> local_objs = {
-        thread_safety_obj, stateless_validation_obj, object_tracker_obj,
-        core_checks_obj, best_practices_obj, gpu_assisted_obj, debug_printf_obj,
-        sync_validation_obj,
+    // Only the enabled VOs are created
+    auto stateless_validation_obj = disables[stateless_checks] ? nullptr : new StatelessValidation;
+    auto object_tracker_obj = disables[object_tracking] ? nullptr : new ObjectLifetimes;
+    CoreChecks *core_checks_obj = nullptr;
+    if (!disables[core_checks]) {
+        core_checks_obj = use_optick_instrumentation ? new CoreChecksOptickInstrumented : new CoreChecks;
+    }
+    ValidationObject *local_objs[] = {
+        disables[thread_safety] ? nullptr : new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading))),
+        stateless_validation_obj,
+        object_tracker_obj,
+        core_checks_obj,
+        enables[best_practices] ? new BestPractices : nullptr,
+        enables[gpu_validation] ? new GpuAssisted : nullptr,
+        enables[debug_printf] ? new DebugPrintf : nullptr,
+        enables[sync_validation] ? new SyncValidator : nullptr,
     };
     for (auto obj : local_objs) {
-        if (std::find(device_interceptor->object_dispatch.begin(), device_interceptor->object_dispatch.end(), obj) ==
-            device_interceptor->object_dispatch.end()) {
-            delete obj;
-        }
+        if (obj) obj->InitDeviceValidationObject(true, instance_interceptor, device_interceptor);
     }
 
     for (auto intercept : instance_interceptor->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateDevice", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
     device_interceptor->InitObjectDispatchVectors();
+    if (validation_counters_enabled.load()) {
+        device_interceptor->validate_call_counts.reset(new std::atomic<uint64_t>[InterceptIdCount]());
+    }
+    if (LowMemoryProfile()) {
+        device_interceptor->LogInfo(device_interceptor->device, "UNASSIGNED-LowMemoryProfile", "%s",
+                                    FormatLowMemoryProfileReport().c_str());
+    }
+
+#ifdef VVL_FIXED_CHASSIS
+    device_interceptor->fixed_objects.stateless_validation = stateless_validation_obj;
+    device_interceptor->fixed_objects.object_tracker = object_tracker_obj;
+    device_interceptor->fixed_objects.core_checks = core_checks_obj;
+#endif
 
     DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
     DeviceExtensionWarnlist(device_interceptor, pCreateInfo, *pDevice);
@@ -1185,13 +1434,16 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(device);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
     """ + precallvalidate_loop + """
+        HookTimer hook_timer("PreCallValidateDestroyDevice", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
         if (skip) return;
     }
     """ + precallrecord_loop + """
+        HookTimer hook_timer("PreCallRecordDestroyDevice", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
@@ -1199,9 +1451,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     """ + postcallrecord_loop + """
+        HookTimer hook_timer("PostCallRecordDestroyDevice", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
+    WriteHookTiming();
+    WriteLayerTrace();
 
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
@@ -1220,17 +1475,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
 
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        HookTimer hook_timer("PreCallValidateCreateGraphicsPipelines", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateGraphicsPipelines", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
@@ -1238,9 +1496,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     auto usepCreateInfos = (!cgpl_state[LayerObjectTypeGpuAssisted].pCreateInfos) ? pCreateInfos : cgpl_state[LayerObjectTypeGpuAssisted].pCreateInfos;
     if (cgpl_state[LayerObjectTypeDebugPrintf].pCreateInfos) usepCreateInfos = cgpl_state[LayerObjectTypeDebugPrintf].pCreateInfos;
 
-    VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
+    const auto &gpuav_state = cgpl_state[LayerObjectTypeGpuAssisted];
+    const VkPipelineCache usePipelineCache = gpuav_state.pipeline_cache ? gpuav_state.pipeline_cache : pipelineCache;
+    VkResult result;
+    if (gpuav_state.parallel_create) {
+        result = gpuav_state.parallel_create->DispatchPipelineBatch(createInfoCount, usepCreateInfos, pPipelines,
+            [&](const VkGraphicsPipelineCreateInfo *create_info, VkPipeline *pipeline) {
+                return DispatchCreateGraphicsPipelines(device, usePipelineCache, 1, create_info, pAllocator, pipeline);
+            });
+    } else {
+        result = DispatchCreateGraphicsPipelines(device, usePipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
+    }
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateGraphicsPipelines", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
@@ -1256,17 +1525,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
 
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        HookTimer hook_timer("PreCallValidateCreateComputePipelines", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateComputePipelines", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
@@ -1274,9 +1546,20 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     auto usepCreateInfos = (!ccpl_state[LayerObjectTypeGpuAssisted].pCreateInfos) ? pCreateInfos : ccpl_state[LayerObjectTypeGpuAssisted].pCreateInfos;
     if (ccpl_state[LayerObjectTypeDebugPrintf].pCreateInfos) usepCreateInfos = ccpl_state[LayerObjectTypeDebugPrintf].pCreateInfos;
 
-    VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
+    const auto &gpuav_state = ccpl_state[LayerObjectTypeGpuAssisted];
+    const VkPipelineCache usePipelineCache = gpuav_state.pipeline_cache ? gpuav_state.pipeline_cache : pipelineCache;
+    VkResult result;
+    if (gpuav_state.parallel_create) {
+        result = gpuav_state.parallel_create->DispatchPipelineBatch(createInfoCount, usepCreateInfos, pPipelines,
+            [&](const VkComputePipelineCreateInfo *create_info, VkPipeline *pipeline) {
+                return DispatchCreateComputePipelines(device, usePipelineCache, 1, create_info, pAllocator, pipeline);
+            });
+    } else {
+        result = DispatchCreateComputePipelines(device, usePipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
+    }
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateComputePipelines", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
@@ -1291,18 +1574,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_ray_tracing_pipeline_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        HookTimer hook_timer("PreCallValidateCreateRayTracingPipelinesNV", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateRayTracingPipelinesNV", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -1311,6 +1597,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateRayTracingPipelinesNV", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -1327,18 +1614,21 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_ray_tracing_pipeline_khr_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
+        HookTimer hook_timer("PreCallValidateCreateRayTracingPipelinesKHR", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateRayTracingPipelinesKHR", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
@@ -1347,6 +1637,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     VkResult result = DispatchCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateRayTracingPipelinesKHR", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
@@ -1361,22 +1652,26 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     const VkAllocationCallbacks*                pAllocator,
     VkPipelineLayout*                           pPipelineLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_pipeline_layout_api_state cpl_state{};
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallValidateCreatePipelineLayout", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreatePipelineLayout", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreatePipelineLayout", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
@@ -1390,22 +1685,26 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     const VkAllocationCallbacks*                pAllocator,
     VkShaderModule*                             pShaderModule) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_shader_module_api_state csm_state{};
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallValidateCreateShaderModule", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateShaderModule", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateShaderModule", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
@@ -1417,23 +1716,27 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     const VkDescriptorSetAllocateInfo*          pAllocateInfo,
     VkDescriptorSet*                            pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     cvdescriptorset::AllocateDescriptorSetsData ads_state[LayerObjectTypeMaxEnum];
 
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
+        HookTimer hook_timer("PreCallValidateAllocateDescriptorSets", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordAllocateDescriptorSets", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordAllocateDescriptorSets", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
@@ -1448,22 +1751,26 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     const VkAllocationCallbacks*                pAllocator,
     VkBuffer*                                   pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     create_buffer_api_state cb_state{};
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallValidateCreateBuffer", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordCreateBuffer", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordCreateBuffer", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
@@ -1478,6 +1785,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     uint32_t*                                   pToolCount,
     VkPhysicalDeviceToolPropertiesEXT*          pToolProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
+    ValidationCallContext call_context;
     bool skip = false;
 
     static const VkPhysicalDeviceToolPropertiesEXT khronos_layer_tool_props = {
@@ -1500,12 +1808,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallValidateGetPhysicalDeviceToolPropertiesEXT", intercept->container_type);
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PreCallRecordGetPhysicalDeviceToolPropertiesEXT", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
@@ -1518,6 +1828,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     (*pToolCount)++;
 
     for (auto intercept : layer_data->object_dispatch) {
+        HookTimer hook_timer("PostCallRecordGetPhysicalDeviceToolPropertiesEXT", intercept->container_type);
         auto lock = intercept->WriteLock();
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
@@ -1810,6 +2121,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
         self.intercept_enums = ''
+        self.intercept_names = ''
         self.dispatch_vector_fcns = ''
         self.virtual_fcn_defs = ''
 
@@ -1877,7 +2189,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             chassis_hdr_content += self.virtual_fcn_defs
             chassis_hdr_content += self.inline_custom_validation_class_definitions
             chassis_hdr_content += '};\n\n'
-            chassis_hdr_content += 'extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;'
+            chassis_hdr_content += 'extern dispatch_key_map<ValidationObject> layer_data_map;'
             write(chassis_hdr_content, file=self.outFile)
         elif self.helper_header:
             self.newline()
@@ -1890,6 +2202,10 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             helper_content += self.intercept_enums
             helper_content += '    InterceptIdCount,\n'
             helper_content += '} InterceptId;\n\n'
+            helper_content += '// The names of the intercepts, for khronos_validation.validation_counters\n'
+            helper_content += 'static const char *const kInterceptNames[InterceptIdCount] = {\n'
+            helper_content += self.intercept_names
+            helper_content += '};\n\n'
             helper_content += 'void ValidationObject::InitObjectDispatchVectors() {\n'
             helper_content += self.init_object_dispatch_vector
             helper_content += '\n\n'
@@ -2012,6 +2328,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.intercept_enums += '    InterceptIdPreCallValidate%s,\n' % fcn_name
                 self.intercept_enums += '    InterceptIdPreCallRecord%s,\n' % fcn_name
                 self.intercept_enums += '    InterceptIdPostCallRecord%s,\n' % fcn_name
+                for prefix in ['PreCallValidate', 'PreCallRecord', 'PostCallRecord']:
+                    self.intercept_names += '    "%s%s",\n' % (prefix, fcn_name)
 
                 for prefix in ['PreCallValidate', 'PreCallRecord', 'PostCallRecord']:
                     self.dispatch_vector_fcns += '    BUILD_DISPATCH_VECTOR(%s%s);\n' % (prefix, name[2:])
@@ -2052,6 +2370,12 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             # Setup common to call wrappers. First parameter is always dispatchable
             dispatchable_name = cmdinfo.elem.find('param/name').text
             self.appendSection('command', '    auto layer_data = GetLayerDataPtr(get_dispatch_key(%s), layer_data_map);' % (dispatchable_name))
+            if name == 'vkQueuePresentKHR':
+                self.appendSection('command', '    HookTimingFramePresented();')
+                self.appendSection('command', '    ValidationWindowFramePresented();')
+                self.appendSection('command', '    if (ValidationCountersFramePresented()) LogValidationCounters(layer_data);')
+            if name in self.validation_window_label_functions:
+                self.appendSection('command', '    ValidationWindowLabel(pLabelInfo);')
             api_function_name = cmdinfo.elem.attrib.get('name')
             params = cmdinfo.elem.findall('param/name')
             paramstext = ', '.join([str(param.text) for param in params])
@@ -2073,14 +2397,46 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             if (resulttype.text != 'void'):
                 assignresult = resulttype.text + ' result = '
 
+            returnparam = ''
+            if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
+                returnparam = ', result'
+
+            # The fixed chassis calls its compile-time set of validation objects directly
+            is_device_function = dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice'
+            if is_device_function:
+                self.appendSection('command', '#ifdef VVL_FIXED_CHASSIS')
+                self.appendSection('command', '    ValidationCallContext call_context;')
+                self.appendSection('command', '    FIXED_CHASSIS_VALIDATE(layer_data, %s, PreCallValidate%s, %s);' % (return_map[resulttype.text][:-1], api_function_name[2:], paramstext))
+                self.appendSection('command', '    FIXED_CHASSIS_RECORD(layer_data, PreCallRecord%s, %s);' % (api_function_name[2:], paramstext))
+                if name in self.pre_dispatch_debug_utils_functions:
+                    self.appendSection('command', '    %s' % self.pre_dispatch_debug_utils_functions[name])
+                self.appendSection('command', '    ' + assignresult + API + paramstext + ');')
+                if name in self.post_dispatch_debug_utils_functions:
+                    self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
+                self.appendSection('command', '    FIXED_CHASSIS_RECORD(layer_data, PostCallRecord%s, %s%s);' % (api_function_name[2:], paramstext, returnparam))
+                if (resulttype.text != 'void'):
+                    self.appendSection('command', '    return result;')
+                self.appendSection('command', '#else')
+
+            # If no validation object overrides any of the intercepts for this entry point, call straight down the chain
+            has_debug_utils = name in self.pre_dispatch_debug_utils_functions or name in self.post_dispatch_debug_utils_functions
+            if is_device_function and not has_debug_utils:
+                self.appendSection('command', '    if (layer_data->intercept_vectors[InterceptIdPreCallValidate%s].empty() &&' % api_function_name[2:])
+                self.appendSection('command', '        layer_data->intercept_vectors[InterceptIdPreCallRecord%s].empty() &&' % api_function_name[2:])
+                self.appendSection('command', '        layer_data->intercept_vectors[InterceptIdPostCallRecord%s].empty()) {' % api_function_name[2:])
+                self.appendSection('command', '        return ' + API + paramstext + ');')
+                self.appendSection('command', '    }')
+
             # Set up skip and locking
+            self.appendSection('command', '    ValidationCallContext call_context;')
             self.appendSection('command', '    bool skip = false;')
 
             # Generate pre-call validation source code
             if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
-                self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
+                self.appendSection('command', '    for (auto intercept : ValidateIntercepts(layer_data, InterceptIdPreCallValidate%s)) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
+            self.appendSection('command', '        HookTimer hook_timer("PreCallValidate%s", intercept->container_type);' % api_function_name[2:])
             self.appendSection('command', '        auto lock = intercept->ReadLock();')
             self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
@@ -2091,6 +2447,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
+            self.appendSection('command', '        HookTimer hook_timer("PreCallRecord%s", intercept->container_type);' % api_function_name[2:])
             self.appendSection('command', '        auto lock = intercept->WriteLock();')
             self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '    }')
@@ -2111,15 +2468,15 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            returnparam = ''
-            if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
-                returnparam = ', result'
+            self.appendSection('command', '        HookTimer hook_timer("PostCallRecord%s", intercept->container_type);' % api_function_name[2:])
             self.appendSection('command', '        auto lock = intercept->WriteLock();')
             self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
             self.appendSection('command', '    }')
             # Return result variable, if any.
             if (resulttype.text != 'void'):
                 self.appendSection('command', '    return result;')
+            if is_device_function:
+                self.appendSection('command', '#endif')
             self.appendSection('command', '}')
     #
     # Override makeProtoName to drop the "vk" prefix
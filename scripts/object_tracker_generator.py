@@ -818,7 +818,7 @@ class ObjectTrackerOutputGenerator(OutputGenerator):
             indent = self.incIndent(indent)
             pre_call_code += '%sfor (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, obj_count, index)
             indent = self.incIndent(indent)
-            pre_call_code += '%sskip |= ValidateObject(%s%s[%s], %s, %s, %s, %s);\n' % (indent, prefix, obj_name, index, self.GetVulkanObjType(obj_type), null_allowed, param_vuid, parent_vuid)
+            pre_call_code += '%sskip |= ValidateObject(%s%s[%s], %s, %s, %s, %s, valid_objects);\n' % (indent, prefix, obj_name, index, self.GetVulkanObjType(obj_type), null_allowed, param_vuid, parent_vuid)
             indent = self.decIndent(indent)
             pre_call_code += '%s}\n' % indent
             indent = self.decIndent(indent)
@@ -831,7 +831,9 @@ class ObjectTrackerOutputGenerator(OutputGenerator):
                 null_allowed = 'false'
                 manual_vuid_index = parent_name + '-' + obj_name
                 param_vuid = self.manual_vuids.get(manual_vuid_index, "kVUIDUndefined")
-            pre_call_code += '%s%sskip |= ValidateObject(%s%s, %s, %s, %s, %s);\n' % (bonus_indent, indent, prefix, obj_name, self.GetVulkanObjType(obj_type), null_allowed, param_vuid, parent_vuid)
+            # Handles in arrays of structs often repeat, look each one up once
+            valid_objects = ', valid_objects' if '[' in prefix else ''
+            pre_call_code += '%s%sskip |= ValidateObject(%s%s, %s, %s, %s, %s%s);\n' % (bonus_indent, indent, prefix, obj_name, self.GetVulkanObjType(obj_type), null_allowed, param_vuid, parent_vuid, valid_objects)
         return pre_call_code
     #
     # first_level_param indicates if elements are passed directly into the function else they're below a ptr/struct
@@ -1060,6 +1062,8 @@ class ObjectTrackerOutputGenerator(OutputGenerator):
                     self.appendSection('command', '')
                     self.appendSection('command', pre_cv_func_decl)
                     self.appendSection('command', '    bool skip = false;')
+                    if ', valid_objects);' in pre_call_validate:
+                        self.appendSection('command', '    ValidObjectCache valid_objects;')
                     self.appendSection('command', pre_call_validate)
                     self.appendSection('command', '    return skip;')
                     self.appendSection('command', '}')
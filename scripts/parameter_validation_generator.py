@@ -154,6 +154,14 @@ class ParameterValidationOutputGenerator(OutputGenerator):
         inline_custom_source_preamble = """
 """
 
+        # With khronos_validation.stateless_create_info_memo, these functions skip the create infos their memo holds and add
+        # those that pass
+        self.create_info_memos = {
+            'vkCreateBuffer' : 'buffer_create_info_memo',
+            'vkCreateImageView' : 'image_view_create_info_memo',
+            'vkCreateSampler' : 'sampler_create_info_memo',
+        }
+
         # These functions have additional, custom-written checks in the utils cpp file. CodeGen will automatically add a call
         # to those functions of the form 'bool manual_PreCallValidateAPIName', where the 'vk' is dropped.
         # see 'manual_PreCallValidateCreateGraphicsPipelines' as an example.
@@ -851,7 +859,7 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                     enum_entry = '#ifdef %s\n' % self.featureExtraProtect
                 else:
                     enum_entry = ''
-                enum_entry += 'const std::vector<%s> All%sEnums = {' % (groupName, groupName)
+                enum_entry += 'const ValidEnumValues<%s> All%sEnums = {' % (groupName, groupName)
                 for enum in groupElem:
                     name = enum.get('name')
                     if name is not None and enum.get('supported') != 'disabled':
@@ -1579,6 +1587,10 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                 func_sig = func_sig.split('VKAPI_CALL vk')[1]
                 cmdDef = 'bool StatelessValidation::PreCallValidate' + func_sig
                 cmdDef += '%sbool skip = false;\n' % indent
+                memo = self.create_info_memos.get(command.name)
+                if memo is not None:
+                    memo_params = ', '.join(param.name for param in command.params[1:])
+                    cmdDef += '%sif (stateless_create_info_memo && %s.Contains(%s)) return false;\n' % (indent, memo, memo_params)
                 if isinstance(command.promotion_info, list):
                     version_flag = command.promotion_info[1]
                     version_id = version_flag.replace('VK_VERSION', 'VK_API_VERSION')
@@ -1597,6 +1609,8 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                         params_text += '%s, ' % param.name
                     params_text = params_text[:-2] + ');\n'
                     cmdDef += '    if (!skip) skip |= manual_PreCallValidate'+ command.name[2:] + '(' + params_text
+                if memo is not None:
+                    cmdDef += '%sif (!skip && stateless_create_info_memo) %s.Add(%s);\n' % (indent, memo, memo_params)
                 cmdDef += '%sreturn skip;\n' % indent
                 cmdDef += '}\n'
                 self.validation.append(cmdDef)
@@ -284,13 +284,24 @@ class SpirvGrammarHelperOutputGenerator(OutputGenerator):
             output += '};\n'
             output += '\n'
             output += '// Static table to replace having many large switch statement functions for looking up each part\n'
-            output += '// of a given SPIR-V opcode instruction\n'
+            output += '// of a given SPIR-V opcode instruction, in opcode order. The first entry is for opcodes not in the grammar.\n'
             output += '//\n'
             output += '// clang-format off\n'
-            output += 'static const layer_data::unordered_map<uint32_t, InstructionInfo> kInstructionTable {\n'
+            output += 'static constexpr InstructionInfo kInstructionTable[] = {\n'
+            output += '    {"Unhandled Opcode", false, false, 0, 0, 0},\n'
             for opcode, info in sorted(self.opcodes.items()):
-                output += f'    {{spv::{info["name"]}, {{"{info["name"]}", {info["hasType"]}, {info["hasResult"]}, {info["memoryScopePosition"]}, {info["executionScopePosition"]}, {info["imageOperandsPosition"]}}}}},\n'
+                output += f'    {{"{info["name"]}", {info["hasType"]}, {info["hasResult"]}, {info["memoryScopePosition"]}, {info["executionScopePosition"]}, {info["imageOperandsPosition"]}}},\n'
             output += '};\n'
+            output += '\n'
+            output += '// Index of the opcode in kInstructionTable. Outside of the extension ranges the opcodes are dense, so the switch is\n'
+            output += '// compiled to a jump table.\n'
+            output += 'static uint32_t InstructionTableIndex(uint32_t opcode) {\n'
+            output += '    switch (opcode) {\n'
+            for index, (opcode, info) in enumerate(sorted(self.opcodes.items())):
+                output += f'        case spv::{info["name"]}: return {index + 1};\n'
+            output += '        default: return 0;\n'
+            output += '    }\n'
+            output += '}\n'
             output += '// clang-format on\n'
         return output;
     #
@@ -374,21 +385,11 @@ class SpirvGrammarHelperOutputGenerator(OutputGenerator):
             output += 'uint32_t ImageOperandsParamCount(uint32_t opcode);\n'
         elif self.sourceFile:
             output += 'bool OpcodeHasType(uint32_t opcode) {\n'
-            output += '    bool has_type = false;\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        has_type = format_info->second.has_type;\n'
-            output += '    }\n'
-            output += '    return has_type;\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].has_type;\n'
             output += '}\n\n'
 
             output += 'bool OpcodeHasResult(uint32_t opcode) {\n'
-            output += '    bool has_result = false;\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        has_result = format_info->second.has_result;\n'
-            output += '    }\n'
-            output += '    return has_result;\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].has_result;\n'
             output += '}\n\n'
 
             output += '// Helper to get the word position of the result operand.\n'
@@ -405,32 +406,17 @@ class SpirvGrammarHelperOutputGenerator(OutputGenerator):
 
             output += '// Return operand position of Memory Scope <ID> or zero if there is none\n'
             output += 'uint32_t OpcodeMemoryScopePosition(uint32_t opcode) {\n'
-            output += '    uint32_t position = 0;\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        position = format_info->second.memory_scope_position;\n'
-            output += '    }\n'
-            output += '    return position;\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].memory_scope_position;\n'
             output += '}\n\n'
 
             output += '// Return operand position of Execution Scope <ID> or zero if there is none\n'
             output += 'uint32_t OpcodeExecutionScopePosition(uint32_t opcode) {\n'
-            output += '    uint32_t position = 0;\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        position = format_info->second.execution_scope_position;\n'
-            output += '    }\n'
-            output += '    return position;\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].execution_scope_position;\n'
             output += '}\n\n'
 
             output += '// Return operand position of Image Operands <ID> or zero if there is none\n'
             output += 'uint32_t OpcodeImageOperandsPosition(uint32_t opcode) {\n'
-            output += '    uint32_t position = 0;\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        position = format_info->second.image_operands_position;\n'
-            output += '    }\n'
-            output += '    return position;\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].image_operands_position;\n'
             output += '}\n\n'
 
             output += '// Return number of optional parameter from ImageOperands\n'
@@ -456,11 +442,6 @@ class SpirvGrammarHelperOutputGenerator(OutputGenerator):
             output =  'const char* string_SpvOpcode(uint32_t opcode);\n'
         elif self.sourceFile:
             output =  'const char* string_SpvOpcode(uint32_t opcode) {\n'
-            output += '    auto format_info = kInstructionTable.find(opcode);\n'
-            output += '    if (format_info != kInstructionTable.end()) {\n'
-            output += '        return format_info->second.name;\n'
-            output += '    } else {\n'
-            output += '        return \"Unhandled Opcode\";\n'
-            output += '    }\n'
+            output += '    return kInstructionTable[InstructionTableIndex(opcode)].name;\n'
             output += '};'
         return output
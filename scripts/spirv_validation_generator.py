@@ -97,6 +97,17 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
         self.extensionExcludeList = []
         self.capabilityExcludeList = []
 
+        # There are some capabilities that share the same value in the SPIR-V header, usually due to being the older name.
+        # Their requirements are added to those of the capability they alias, and the name is not printed out.
+        self.capabilityAliases = {
+            'ShaderViewportIndexLayerNV' : 'ShaderViewportIndexLayerEXT',
+            'ShadingRateNV' : 'FragmentDensityEXT',
+        }
+
+        # Table size of the perfect hash of the SPIR-V extension names, a power of 2 no larger than 256 so that the slots hold
+        # uint8_t indices
+        self.extensionHashSize = 256
+
         # This is a list that maps the Vulkan struct a feature field is with the internal
         # state tracker's enabled features value
         #
@@ -204,8 +215,7 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
         copyright += ' *\n'
         copyright += ' ****************************************************************************/\n'
         write(copyright, file=self.outFile)
-        write('#include <string>', file=self.outFile)
-        write('#include <functional>', file=self.outFile)
+        write('#include <cstring>', file=self.outFile)
         write('#include <spirv/unified1/spirv.hpp>', file=self.outFile)
         write('#include "vk_extension_helper.h"', file=self.outFile)
         write('#include "shader_module.h"', file=self.outFile)
@@ -272,13 +282,10 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
     #
     # Creates the Enum string helpers for better error messages. Same idea of vk_enum_string_helper.h but for SPIR-V
     def enumHelper(self):
-        # There are some enums that share the same value in the SPIR-V header.
-        # This array remove the duplicate to not print out, usually due to being the older value given
-        excludeList = ['ShaderViewportIndexLayerNV', 'ShadingRateNV']
         output =  'static inline const char* string_SpvCapability(uint32_t input_value) {\n'
         output += '    switch ((spv::Capability)input_value) {\n'
         for name, enables in sorted(self.capabilities.items()):
-            if (name not in excludeList) and (name not in self.capabilityExcludeList):
+            if (name not in self.capabilityAliases) and (name not in self.capabilityExcludeList):
                 output += '         case spv::Capability' + name + ':\n'
                 output += '            return \"' + name + '\";\n'
         output += '        default:\n'
@@ -290,24 +297,34 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
     # Creates the FeaturePointer struct to map features with those in the layers state tracker
     def featurePointer(self):
         output = '\n'
+        output += '// Tests if the feature of the given struct in the aggregate feature struct is enabled\n'
+        output += 'template <typename FeatureStruct, FeatureStruct DeviceFeatures::*feature_struct, VkBool32 FeatureStruct::*feature>\n'
+        output += 'static VkBool32 IsFeatureEnabled(const DeviceFeatures &features) {\n'
+        output += '    return (features.*feature_struct).*feature;\n'
+        output += '}\n'
+        output += '\n'
         output += 'struct FeaturePointer {\n'
-        output += '    // Callable object to test if this feature is enabled in the given aggregate feature struct\n'
-        output += '    const std::function<VkBool32(const DeviceFeatures &)> IsEnabled;\n'
+        output += '    // Function to test if this feature is enabled in the given aggregate feature struct\n'
+        output += '    VkBool32 (*IsEnabled)(const DeviceFeatures &);\n'
         output += '\n'
         output += '    // Test if feature pointer is populated\n'
-        output += '    explicit operator bool() const { return static_cast<bool>(IsEnabled); }\n'
+        output += '    constexpr explicit operator bool() const { return IsEnabled != nullptr; }\n'
         output += '\n'
-        output += '    // Default and nullptr constructor to create an empty FeaturePointer\n'
-        output += '    FeaturePointer() : IsEnabled(nullptr) {}\n'
-        output += '    FeaturePointer(std::nullptr_t ptr) : IsEnabled(nullptr) {}\n'
-        output += '\n'
-        output += '    // Constructors to populate FeaturePointer based on given pointer to member\n'
-        for feature in self.featureMap:
-            output += '    FeaturePointer(VkBool32 ' + feature['vulkan'] + '::*ptr)\n'
-            output += '        : IsEnabled([=](const DeviceFeatures &features) { return features.' + feature['layer'] + '.*ptr; }) {}\n'
+        output += '    // nullptr constructor to create an empty FeaturePointer\n'
+        output += '    constexpr FeaturePointer(std::nullptr_t) : IsEnabled(nullptr) {}\n'
+        output += '    // Constructor from an IsFeatureEnabled instantiation, so that the tables are constant initialized\n'
+        output += '    constexpr FeaturePointer(VkBool32 (*is_enabled)(const DeviceFeatures &)) : IsEnabled(is_enabled) {}\n'
         output += '};\n'
         return output
     #
+    # The IsFeatureEnabled instantiation for a feature of one of the structs in featureMap
+    def featureTest(self, struct, feature):
+        for entry in self.featureMap:
+            if entry['vulkan'] == struct:
+                return '&IsFeatureEnabled<' + struct + ', &DeviceFeatures::' + entry['layer'] + ', &' + struct + '::' + feature + '>'
+        self.logMsg('error', 'No DeviceFeatures member in featureMap for ' + struct)
+        return 'nullptr'
+    #
     # Declare the struct that contains requirement for the spirv info
     def mapStructDeclarations(self):
         output = '// Each instance of the struct will only have a singel field non-null\n'
@@ -317,6 +334,12 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
         output += '    ExtEnabled DeviceExtensions::*extension;\n'
         output += '    const char* property; // For human readability and make some capabilities unique\n'
         output += '};\n'
+        output += '\n'
+        output += '// Range of the requirements of a capability or extension in its table\n'
+        output += 'struct RequiredSpirvRange {\n'
+        output += '    uint32_t first;\n'
+        output += '    uint32_t count;\n'
+        output += '};\n'
         return output
     #
     # Creates the value of the struct declared in mapStructDeclarations()
@@ -327,7 +350,7 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
             version = enable['version'].replace('VK_VERSION', 'VK_API_VERSION')
             output = '{' + version + ', nullptr, nullptr, ""}'
         elif enable['feature'] != None:
-            output = '{0, &' + enable['feature']['struct'] + '::'  + enable['feature']['feature'] + ', nullptr, ""}'
+            output = '{0, ' + self.featureTest(enable['feature']['struct'], enable['feature']['feature']) + ', nullptr, ""}'
         elif enable['extension'] != None:
             # All fields in DeviceExtensions should just be the extension name lowercase
             output = '{0, nullptr, &DeviceExtensions::' + enable['extension'].lower() + ', ""}'
@@ -352,33 +375,111 @@ class SpirvValidationHelperOutputGenerator(OutputGenerator):
     #
     # Build the struct with all the requirments for the spirv capabilities
     def capabilityStruct(self):
-        output = '// clang-format off\n'
-        output += 'static const std::unordered_multimap<uint32_t, RequiredSpirvInfo> spirvCapabilities = {\n'
-
+        # Requirements of each capability value, aliases added to the capability they alias
         # Sort so the order is the same on Windows and Unix
+        requirements = dict()
         for name, enables in sorted(self.capabilities.items()):
-            for enable in enables:
-                # Prepend with comment and comment out line if in exclude list as explained in declaration
-                if name in self.capabilityExcludeList:
-                    output += '    // Not found in current SPIR-V Headers\n    //'
-                output += '    {spv::Capability' + name + ', ' + self.createMapValue(name, enable, False) + '},\n'
+            if name in self.capabilityExcludeList:
+                continue
+            requirements.setdefault(self.capabilityAliases.get(name, name), []).extend((name, enable) for enable in enables)
+
+        output = '// Requirements of all capabilities, those of each capability next to each other\n'
+        output += '//\n'
+        output += '// clang-format off\n'
+        output += 'static constexpr RequiredSpirvInfo kCapabilityRequirements[] = {\n'
+        ranges = []
+        first = 0
+        for name, enables in sorted(requirements.items()):
+            for enable_name, enable in enables:
+                output += '    ' + self.createMapValue(enable_name, enable, False) + ', // ' + enable_name + '\n'
+            ranges.append((name, first, len(enables)))
+            first += len(enables)
         output += '};\n'
+        output += '\n'
+        output += '// The requirements in kCapabilityRequirements of the capability, none if it is not supported by Vulkan\n'
+        output += 'static RequiredSpirvRange GetCapabilityRequirements(uint32_t capability) {\n'
+        output += '    switch (capability) {\n'
+        for name, first, count in ranges:
+            output += '        case spv::Capability' + name + ': return {' + str(first) + ', ' + str(count) + '};\n'
+        output += '        default: return {0, 0};\n'
+        output += '    }\n'
+        output += '}\n'
         output += '// clang-format on\n'
         return output
     #
+    # Hash of the SPIR-V extension names, FNV-1a from the given offset basis
+    def extensionHash(self, name, basis):
+        hash = basis
+        for c in name.encode():
+            hash = ((hash ^ c) * 16777619) & 0xffffffff
+        return hash
+    #
     # Build the struct with all the requirments for the spirv extensions
     def extensionStruct(self):
-        output = '// clang-format off\n'
-        output += 'static const std::unordered_multimap<std::string, RequiredSpirvInfo> spirvExtensions = {\n'
-
+        output = '// Requirements of all extensions, those of each extension next to each other\n'
+        output += '//\n'
+        output += '// clang-format off\n'
+        output += 'static constexpr RequiredSpirvInfo kExtensionRequirements[] = {\n'
+        ranges = []
+        first = 0
         # Sort so the order is the same on Windows and Unix
         for name, enables in sorted(self.extensions.items()):
+            if name in self.extensionExcludeList:
+                continue
             for enable in enables:
-                # Prepend with comment and comment out line if in exclude list as explained in declaration
-                if name in self.extensionExcludeList:
-                    output += '    // Not found in current SPIR-V Headers\n    //'
-                output += '    {\"' + name + '\", ' + self.createMapValue(name, enable, True) + '},\n'
+                output += '    ' + self.createMapValue(name, enable, True) + ', // ' + name + '\n'
+            ranges.append((name, first, len(enables)))
+            first += len(enables)
         output += '};\n'
+        if len(ranges) >= self.extensionHashSize:
+            self.logMsg('error', 'More SPIR-V extensions than slots in extensionHashSize')
+
+        # Find the first offset basis from that of FNV-1a that hashes every extension name to a slot of its own
+        # The slot is the high bits of the hash, the low bits only depend on the low bits of the basis and the characters
+        shift = 32 - (self.extensionHashSize.bit_length() - 1)
+        basis = 2166136261
+        while len(set(self.extensionHash(name, basis) >> shift for name, first, count in ranges)) != len(ranges):
+            basis += 1
+        slots = [0] * self.extensionHashSize
+        for index, (name, first, count) in enumerate(ranges):
+            slots[self.extensionHash(name, basis) >> shift] = index + 1
+
+        output += '\n'
+        output += '// A perfect hash of the extension names, the slot of each in kExtensionSlots\n'
+        output += 'static uint32_t SpirvExtensionSlot(const char *name) {\n'
+        output += '    uint32_t hash = ' + str(basis) + 'u;\n'
+        output += '    for (; *name != \'\\0\'; ++name) {\n'
+        output += '        hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;\n'
+        output += '    }\n'
+        output += '    return hash >> ' + str(shift) + ';\n'
+        output += '}\n'
+        output += '\n'
+        output += 'struct SpirvExtensionInfo {\n'
+        output += '    const char *name;\n'
+        output += '    RequiredSpirvRange requirements;\n'
+        output += '};\n'
+        output += '\n'
+        output += '// Each extension, after an empty entry for the slots without one\n'
+        output += 'static constexpr SpirvExtensionInfo kExtensionInfos[] = {\n'
+        output += '    {nullptr, {0, 0}},\n'
+        for name, first, count in ranges:
+            output += '    {"' + name + '", {' + str(first) + ', ' + str(count) + '}},\n'
+        output += '};\n'
+        output += '\n'
+        output += '// The index in kExtensionInfos of the extension in each slot of the hash\n'
+        output += 'static constexpr uint8_t kExtensionSlots[' + str(self.extensionHashSize) + '] = {\n'
+        for row in range(0, self.extensionHashSize, 16):
+            output += '    ' + ', '.join(str(slot) for slot in slots[row:row + 16]) + ',\n'
+        output += '};\n'
+        output += '\n'
+        output += '// The requirements in kExtensionRequirements of the extension, none if it is not supported by Vulkan\n'
+        output += 'static RequiredSpirvRange GetExtensionRequirements(const char *name) {\n'
+        output += '    const SpirvExtensionInfo &info = kExtensionInfos[kExtensionSlots[SpirvExtensionSlot(name)]];\n'
+        output += '    if ((info.name != nullptr) && (strcmp(info.name, name) == 0)) {\n'
+        output += '        return info.requirements;\n'
+        output += '    }\n'
+        output += '    return {0, 0};\n'
+        output += '}\n'
         output += '// clang-format on\n'
         return output
     #
@@ -390,7 +491,8 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
 
     if (insn.opcode() == spv::OpCapability) {
         // All capabilities are generated so if it is not in the list it is not supported by Vulkan
-        if (spirvCapabilities.count(insn.word(1)) == 0) {
+        const RequiredSpirvRange caps = GetCapabilityRequirements(insn.word(1));
+        if (caps.count == 0) {
             skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-01090",
                 "vkCreateShaderModule(): A SPIR-V Capability (%s) was declared that is not supported by Vulkan.", string_SpvCapability(insn.word(1)));
             return skip; // no known capability to validate
@@ -399,24 +501,24 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
         // Each capability has one or more requirements to check
         // Only one item has to be satisfied and an error only occurs
         // when all are not satisfied
-        auto caps = spirvCapabilities.equal_range(insn.word(1));
         bool has_support = false;
-        for (auto it = caps.first; (it != caps.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
+        for (uint32_t i = caps.first; (i < caps.first + caps.count) && (has_support == false); ++i) {
+            const RequiredSpirvInfo &requirement = kCapabilityRequirements[i];
+            if (requirement.version) {
+                if (api_version >= requirement.version) {
                     has_support = true;
                 }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
+            } else if (requirement.feature) {
+                if (requirement.feature.IsEnabled(enabled_features)) {
                     has_support = true;
                 }
-            } else if (it->second.extension) {
+            } else if (requirement.extension) {
                 // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
-                // If the new Api Level gives support, it will be caught in the "it->second.version" check instead.
-                if (IsExtEnabledByCreateinfo(device_extensions.*(it->second.extension))) {
+                // If the new Api Level gives support, it will be caught in the "requirement.version" check instead.
+                if (IsExtEnabledByCreateinfo(device_extensions.*(requirement.extension))) {
                     has_support = true;
                 }
-            } else if (it->second.property) {
+            } else if (requirement.property) {
                 // support is or'ed as only one has to be supported (if applicable)
                 switch (insn.word(1)) {'''
 
@@ -459,42 +561,42 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
             }
         }
     } else if (insn.opcode() == spv::OpExtension) {
-        static const std::string spv_prefix = "SPV_";
-        std::string extension_name = (char const *)&insn.word(1);
+        const char *extension_name = reinterpret_cast<const char *>(&insn.word(1));
+        const RequiredSpirvRange ext = GetExtensionRequirements(extension_name);
 
-        if (0 == extension_name.compare(0, spv_prefix.size(), spv_prefix)) {
-            if (spirvExtensions.count(extension_name) == 0) {
+        if (strncmp(extension_name, "SPV_", 4) == 0) {
+            if (ext.count == 0) {
                 skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-04146",
-                    "vkCreateShaderModule(): A SPIR-V Extension (%s) was declared that is not supported by Vulkan.", extension_name.c_str());
+                    "vkCreateShaderModule(): A SPIR-V Extension (%s) was declared that is not supported by Vulkan.", extension_name);
                 return skip; // no known extension to validate
             }
         } else {
             skip |= LogError(device, kVUID_Core_Shader_InvalidExtension,
                 "vkCreateShaderModule(): The SPIR-V code uses the '%s' extension which is not a SPIR-V extension. Please use a SPIR-V"
                 " extension (https://github.com/KhronosGroup/SPIRV-Registry) for OpExtension instructions. Non-SPIR-V extensions can be"
-                " recorded in SPIR-V using the OpSourceExtension instruction.", extension_name.c_str());
+                " recorded in SPIR-V using the OpSourceExtension instruction.", extension_name);
             return skip; // no known extension to validate
         }
 
         // Each SPIR-V Extension has one or more requirements to check
         // Only one item has to be satisfied and an error only occurs
         // when all are not satisfied
-        auto ext = spirvExtensions.equal_range(extension_name);
         bool has_support = false;
-        for (auto it = ext.first; (it != ext.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
+        for (uint32_t i = ext.first; (i < ext.first + ext.count) && (has_support == false); ++i) {
+            const RequiredSpirvInfo &requirement = kExtensionRequirements[i];
+            if (requirement.version) {
+                if (api_version >= requirement.version) {
                     has_support = true;
                 }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
+            } else if (requirement.feature) {
+                if (requirement.feature.IsEnabled(enabled_features)) {
                     has_support = true;
                 }
-            } else if (it->second.extension) {
-                if (IsExtEnabled(device_extensions.*(it->second.extension))) {
+            } else if (requirement.extension) {
+                if (IsExtEnabled(device_extensions.*(requirement.extension))) {
                     has_support = true;
                 }
-            } else if (it->second.property) {
+            } else if (requirement.property) {
                 // support is or'ed as only one has to be supported (if applicable)
                 switch (insn.word(1)) {'''
 
@@ -524,7 +626,7 @@ bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(spirv_inst_iter& insn)
 
         if (has_support == false) {
             skip |= LogError(device, "VUID-VkShaderModuleCreateInfo-pCode-04147",
-                "vkCreateShaderModule(): The SPIR-V Extension (%s) was declared, but none of the requirements were met to use it.", extension_name.c_str());
+                "vkCreateShaderModule(): The SPIR-V Extension (%s) was declared, but none of the requirements were met to use it.", extension_name);
         }
     } //spv::OpExtension
     return skip;
@@ -888,7 +888,6 @@ def GenSyncTypeHelper(gen, is_source) :
         'type_prefix': 'Sync',
         'enum_prefix': 'SYNC_',
         'indent': '    ',
-        'sync_mask_base_type': 'std::bitset<128>',
         'vk_stage_flags': 'VkPipelineStageFlags2',
         'vk_stage_bits': 'VkPipelineStageFlags2',
         'vk_access_flags': 'VkAccessFlags2',
@@ -901,9 +900,8 @@ def GenSyncTypeHelper(gen, is_source) :
     if config['is_source']:
         lines = ['#include "synchronization_validation_types.h"', '']
     else:
-        lines = ['#pragma once', '', '#include <array>', '#include <bitset>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
-                 '#include "vk_layer_data.h"']
-        lines.extend(('using {} = {};'.format(config['sync_mask_name'], config['sync_mask_base_type']), ''))
+        lines = ['#pragma once', '', '#include <array>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
+                 '#include "vk_layer_data.h"', '#include "sync_stage_access_flags.h"', '']
     lines.extend(['// clang-format off', ''])
 
     stage_order = pipeline_order.split()
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 The Khronos Group Inc.
+# Copyright (c) 2022 Valve Corporation
+# Copyright (c) 2022 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Renders the binary log written by VK_DBG_LAYER_ACTION_LOG_BINARY (see layers/vk_layer_binary_log.h) as the text
+# VK_DBG_LAYER_ACTION_LOG_MSG would have written, or summarizes it by VUID.
+
+import argparse
+import struct
+import sys
+from collections import Counter
+
+MAGIC = b'VVLBLOG\0'
+VERSION = 1
+STRING_RECORD = 1
+MESSAGE_RECORD = 2
+
+SEVERITY_VERBOSE = 0x1
+SEVERITY_INFO = 0x10
+SEVERITY_WARNING = 0x100
+SEVERITY_ERROR = 0x1000
+
+TYPE_GENERAL = 0x1
+TYPE_VALIDATION = 0x2
+TYPE_PERFORMANCE = 0x4
+
+# Core VkObjectType values, extension object types are printed as numbers
+OBJECT_TYPES = [
+    'VK_OBJECT_TYPE_UNKNOWN', 'VK_OBJECT_TYPE_INSTANCE', 'VK_OBJECT_TYPE_PHYSICAL_DEVICE', 'VK_OBJECT_TYPE_DEVICE',
+    'VK_OBJECT_TYPE_QUEUE', 'VK_OBJECT_TYPE_SEMAPHORE', 'VK_OBJECT_TYPE_COMMAND_BUFFER', 'VK_OBJECT_TYPE_FENCE',
+    'VK_OBJECT_TYPE_DEVICE_MEMORY', 'VK_OBJECT_TYPE_BUFFER', 'VK_OBJECT_TYPE_IMAGE', 'VK_OBJECT_TYPE_EVENT',
+    'VK_OBJECT_TYPE_QUERY_POOL', 'VK_OBJECT_TYPE_BUFFER_VIEW', 'VK_OBJECT_TYPE_IMAGE_VIEW', 'VK_OBJECT_TYPE_SHADER_MODULE',
+    'VK_OBJECT_TYPE_PIPELINE_CACHE', 'VK_OBJECT_TYPE_PIPELINE_LAYOUT', 'VK_OBJECT_TYPE_RENDER_PASS', 'VK_OBJECT_TYPE_PIPELINE',
+    'VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT', 'VK_OBJECT_TYPE_SAMPLER', 'VK_OBJECT_TYPE_DESCRIPTOR_POOL',
+    'VK_OBJECT_TYPE_DESCRIPTOR_SET', 'VK_OBJECT_TYPE_FRAMEBUFFER', 'VK_OBJECT_TYPE_COMMAND_POOL',
+]
+
+class Message:
+    pass
+
+class LogReader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+        self.strings = [None]
+
+    def read(self, fmt):
+        values = struct.unpack_from('<' + fmt, self.data, self.offset)
+        self.offset += struct.calcsize('<' + fmt)
+        return values if len(values) > 1 else values[0]
+
+    def read_bytes(self):
+        size = self.read('I')
+        text = self.data[self.offset:self.offset + size].decode('utf-8', errors='replace')
+        self.offset += size
+        return text
+
+    def read_string(self):
+        return self.strings[self.read('I')]
+
+    def header(self):
+        if self.data[:len(MAGIC)] != MAGIC:
+            sys.exit('Not a validation layer binary log')
+        self.offset = len(MAGIC)
+        version, _, start_ns = self.read('IIQ')
+        if version != VERSION:
+            sys.exit('Unsupported binary log version %d' % version)
+        return start_ns
+
+    # Yields the messages in the log, stopping quietly at a record cut short by a crash
+    def messages(self):
+        try:
+            while self.offset < len(self.data):
+                record = self.read('B')
+                if record == STRING_RECORD:
+                    self.strings.append(self.read_bytes())
+                elif record == MESSAGE_RECORD:
+                    message = Message()
+                    message.time_ns, message.thread, message.severity, message.types, message.id = self.read('QIIIi')
+                    message.vuid = self.read_string()
+                    message.objects = [(self.read('I'), self.read('Q'), self.read_string()) for _ in range(self.read('I'))]
+                    message.queue_labels = [self.read_string() for _ in range(self.read('I'))]
+                    message.cmd_buf_labels = [self.read_string() for _ in range(self.read('I'))]
+                    message.spec = self.read_string()
+                    message.text = self.read_bytes()
+                    yield message
+                else:
+                    sys.exit('Corrupt binary log at offset %d' % (self.offset - 1))
+        except struct.error:
+            return
+
+def FlagNames(flags, names):
+    return ','.join(name for bit, name in names if flags & bit)
+
+def ObjectTypeName(object_type):
+    return OBJECT_TYPES[object_type] if object_type < len(OBJECT_TYPES) else str(object_type)
+
+# Same composition as debug_log_msg() in layers/vk_layer_logging.h
+def ComposeMessage(message):
+    if message.severity & SEVERITY_ERROR:
+        text = 'Validation Error: '
+    elif message.severity & SEVERITY_WARNING:
+        text = 'Validation Performance Warning: ' if message.types & TYPE_PERFORMANCE else 'Validation Warning: '
+    elif message.severity & SEVERITY_INFO:
+        text = 'Validation Information: '
+    else:
+        text = 'DEBUG: '
+    if message.vuid:
+        text += '[ %s ] ' % message.vuid
+    for index, (object_type, handle, name) in enumerate(message.objects):
+        if handle:
+            text += 'Object %d: handle = 0x%x, ' % (index, handle)
+            if name:
+                text += 'name = %s, ' % name
+            text += 'type = %s; ' % ObjectTypeName(object_type)
+        else:
+            text += 'Object %d: VK_NULL_HANDLE, type = %s; ' % (index, ObjectTypeName(object_type))
+    text += '| MessageID = 0x%x | %s' % (message.id & 0xffffffff, message.text)
+    if message.spec:
+        text += ' The Vulkan spec states: ' + message.spec
+    return text
+
+# Same layout as messenger_log_callback() in layers/vk_layer_logging.h
+def PrintMessage(message, out, timestamps):
+    severity = FlagNames(message.severity, [(SEVERITY_VERBOSE, 'VERBOSE'), (SEVERITY_INFO, 'INFO'), (SEVERITY_WARNING, 'WARN'),
+                                            (SEVERITY_ERROR, 'ERROR')])
+    types = FlagNames(message.types, [(TYPE_GENERAL, 'GEN'), (TYPE_VALIDATION, 'SPEC'), (TYPE_PERFORMANCE, 'PERF')])
+    if timestamps:
+        out.write('[%12.6f thread %d] ' % (message.time_ns / 1e9, message.thread))
+    out.write('%s(%s / %s): msgNum: %d - %s\n' % (message.vuid, severity, types, message.id, ComposeMessage(message)))
+    out.write('    Objects: %d\n' % len(message.objects))
+    for index, (object_type, handle, name) in enumerate(message.objects):
+        handle_text = '0x%x' % handle if handle else '0'
+        out.write('        [%d] %s, type: %d, name: %s\n' % (index, handle_text, object_type, name if name else 'NULL'))
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Decode a validation layer binary log')
+    parser.add_argument('log', help='binary log written with VK_DBG_LAYER_ACTION_LOG_BINARY')
+    parser.add_argument('-o', '--output', help='write the text here instead of stdout')
+    parser.add_argument('--vuid', action='append', help='only messages with this VUID, may be repeated')
+    parser.add_argument('--timestamps', action='store_true', help='prefix messages with their time and thread')
+    parser.add_argument('--summary', action='store_true', help='print the number of messages per VUID instead')
+    args = parser.parse_args(argv)
+
+    with open(args.log, 'rb') as log_file:
+        reader = LogReader(log_file.read())
+    reader.header()
+    out = open(args.output, 'w') if args.output else sys.stdout
+    counts = Counter()
+    for message in reader.messages():
+        if args.vuid and message.vuid not in args.vuid:
+            continue
+        if args.summary:
+            counts[message.vuid] += 1
+        else:
+            PrintMessage(message, out, args.timestamps)
+    for vuid, count in counts.most_common():
+        out.write('%10d %s\n' % (count, vuid))
+    if out is not sys.stdout:
+        out.close()
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -501,7 +501,7 @@ class OutputDatabase:
 // Disable auto-formatting for generated file
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID in strcmp() order for binary search
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
@@ -684,7 +684,8 @@ static const vuid_spec_text_pair vuid_spec_text[] = {
             hfile.write(self.header_version)
             hfile.write(self.header_preamble)
             vuid_list = list(self.vj.all_vuids)
-            vuid_list.sort()
+            # Byte order, which is that of strcmp()
+            vuid_list.sort(key=lambda vuid: vuid.encode())
             minor_version = int(self.vj.apiversion.split('.')[1])
 
             for vuid in vuid_list:
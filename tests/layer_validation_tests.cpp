@@ -3797,6 +3797,7 @@ void android_main(struct android_app *app) {
 }
 #endif
 
+#if !defined(VK_LAYER_VALIDATION_TOOL)
 #if defined(_WIN32) && !defined(NDEBUG)
 #include <crtdbg.h>
 #endif
@@ -3826,3 +3827,4 @@ int main(int argc, char **argv) {
     VkTestFramework::Finish();
     return result;
 }
+#endif  // !VK_LAYER_VALIDATION_TOOL
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replays a capture of Vulkan calls through the validation layer and reports the time of each entry point. Run against the
+// mock ICD, so that the time of a call is that of the layer.
+//
+// A capture is a text file of one call per line, on objects it names; '#' starts a comment:
+//
+//   buffer <name> <size>                            uniform, storage and transfer buffer
+//   image <name> <width> <height> <mips> <layers>   R8G8B8A8_UNORM sampled, storage and transfer image with a view of layer 0
+//   descriptor_set <name> <uniform buffers> <storage buffers> <sampled images>
+//   write_descriptors <set> <buffer> [<image>]      vkUpdateDescriptorSets of every descriptor of the set
+//   pipeline <name> <set>                           vkCreateGraphicsPipelines in the framework's render pass
+//   command_buffer <name>
+//   begin <cb> | end <cb> | begin_render_pass <cb> | end_render_pass <cb>
+//   bind_pipeline <cb> <pipeline> | bind_descriptor_set <cb> <pipeline> <set>
+//   draw <cb> <vertex count> [<times>]
+//   copy_buffer <cb> <src> <dst> <size>
+//   barrier <cb> <image> <old layout> <new layout>  layouts: undefined, general, transfer_src, transfer_dst, shader_read
+//   submit <cb>... | wait_idle
+//   repeat <times> ... end_repeat
+//
+// Captures of real workloads from GFXReconstruct replay with gfxrecon-replay instead, with khronos_validation.hook_timing set
+// for the same report; see layers/vk_layer_settings.txt.
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "layer_validation_tests.h"
+
+namespace {
+
+struct Call {
+    std::vector<std::string> args;
+    uint32_t line;
+};
+
+struct EntryPointTime {
+    uint64_t calls = 0;
+    int64_t total_ns = 0;
+    int64_t max_ns = 0;
+};
+
+int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Only the Vulkan call itself is timed, the harness work around it is not
+#define REPLAY_CALL(entry_point, call)                    \
+    do {                                                  \
+        EntryPointTime &time = times_[entry_point];       \
+        const int64_t start_ns = Now();                   \
+        call;                                             \
+        const int64_t duration_ns = Now() - start_ns;     \
+        ++time.calls;                                     \
+        time.total_ns += duration_ns;                     \
+        time.max_ns = std::max(time.max_ns, duration_ns); \
+    } while (0)
+
+// Keeps its bindings, so that write_descriptors can write all of them
+struct ReplayDescriptorSet : public OneOffDescriptorSet {
+    ReplayDescriptorSet(VkDeviceObj *device, const Bindings &bindings, int buffer_count, int image_count)
+        : OneOffDescriptorSet(device, bindings, 0, nullptr, 0, nullptr, buffer_count, image_count), bindings_(bindings) {}
+    const Bindings bindings_;
+};
+
+class VkLayerReplay : public VkLayerTest {
+  public:
+    explicit VkLayerReplay(void *instance_pnext) {
+        Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, instance_pnext);
+        InitRenderTarget();
+        if (!IsPlatform(kMockICD)) {
+            printf("Not running on the mock ICD, the times include the driver.\n");
+        }
+    }
+    ~VkLayerReplay() { vk::DeviceWaitIdle(device()); }
+    void TestBody() override {}
+
+    bool Replay(const std::vector<Call> &calls, size_t begin, size_t end);
+    void Report() const;
+
+  private:
+    bool ReplayCall(const Call &call);
+
+    template <typename Object>
+    Object *Find(std::map<std::string, std::unique_ptr<Object>> &objects, const Call &call, size_t arg) {
+        if (arg >= call.args.size()) {
+            printf("line %u: %s needs more arguments\n", call.line, call.args[0].c_str());
+            return nullptr;
+        }
+        auto it = objects.find(call.args[arg]);
+        if (it == objects.end()) {
+            printf("line %u: no object named %s\n", call.line, call.args[arg].c_str());
+            return nullptr;
+        }
+        return it->second.get();
+    }
+
+    std::map<std::string, std::unique_ptr<VkBufferObj>> buffers_;
+    std::map<std::string, std::unique_ptr<VkImageObj>> images_;
+    std::map<std::string, std::unique_ptr<ReplayDescriptorSet>> descriptor_sets_;
+    std::map<std::string, std::unique_ptr<CreatePipelineHelper>> pipelines_;
+    std::map<std::string, std::unique_ptr<VkCommandBufferObj>> command_buffers_;
+    std::map<std::string, EntryPointTime> times_;
+};
+
+bool ParseLayout(const std::string &name, VkImageLayout &layout) {
+    static const std::map<std::string, VkImageLayout> layouts = {
+        {"undefined", VK_IMAGE_LAYOUT_UNDEFINED},
+        {"general", VK_IMAGE_LAYOUT_GENERAL},
+        {"transfer_src", VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL},
+        {"transfer_dst", VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL},
+        {"shader_read", VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+    };
+    auto it = layouts.find(name);
+    if (it == layouts.end()) return false;
+    layout = it->second;
+    return true;
+}
+
+uint32_t ArgValue(const Call &call, size_t arg, uint32_t default_value = 0) {
+    return (arg < call.args.size()) ? static_cast<uint32_t>(std::stoul(call.args[arg])) : default_value;
+}
+
+bool VkLayerReplay::Replay(const std::vector<Call> &calls, size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+        const Call &call = calls[index];
+        if (call.args[0] != "repeat") {
+            if (!ReplayCall(call)) return false;
+            continue;
+        }
+        // Find the matching end_repeat
+        size_t body_end = index + 1;
+        for (uint32_t depth = 1; body_end < end; ++body_end) {
+            if (calls[body_end].args[0] == "repeat") ++depth;
+            if ((calls[body_end].args[0] == "end_repeat") && (--depth == 0)) break;
+        }
+        if (body_end == end) {
+            printf("line %u: repeat without end_repeat\n", call.line);
+            return false;
+        }
+        for (uint32_t times = ArgValue(call, 1, 1); times > 0; --times) {
+            if (!Replay(calls, index + 1, body_end)) return false;
+        }
+        index = body_end;
+    }
+    return true;
+}
+
+bool VkLayerReplay::ReplayCall(const Call &call) {
+    const std::string &name = call.args[0];
+    if (name == "buffer") {
+        std::unique_ptr<VkBufferObj> buffer(new VkBufferObj);
+        buffer->init(*m_device, ArgValue(call, 2, 256), 0,
+                     VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                         VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        buffers_[call.args.at(1)] = std::move(buffer);
+    } else if (name == "image") {
+        std::unique_ptr<VkImageObj> image(new VkImageObj(m_device));
+        image->InitNoLayout(VkImageObj::ImageCreateInfo2D(
+            ArgValue(call, 2, 64), ArgValue(call, 3, 64), ArgValue(call, 4, 1), ArgValue(call, 5, 1), VK_FORMAT_R8G8B8A8_UNORM,
+            VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+            VK_IMAGE_TILING_OPTIMAL));
+        image->targetView(VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, 1);
+        images_[call.args.at(1)] = std::move(image);
+    } else if (name == "descriptor_set") {
+        OneOffDescriptorSet::Bindings bindings;
+        const VkDescriptorType types[] = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                          VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE};
+        uint32_t counts[3] = {};
+        for (uint32_t binding = 0; binding < 3; ++binding) {
+            counts[binding] = ArgValue(call, 2 + binding);
+            if (counts[binding]) bindings.push_back({binding, types[binding], counts[binding], VK_SHADER_STAGE_ALL, nullptr});
+        }
+        descriptor_sets_[call.args.at(1)].reset(
+            new ReplayDescriptorSet(m_device, bindings, static_cast<int>(counts[0] + counts[1]), static_cast<int>(counts[2])));
+    } else if (name == "write_descriptors") {
+        ReplayDescriptorSet *descriptor_set = Find(descriptor_sets_, call, 1);
+        VkBufferObj *buffer = Find(buffers_, call, 2);
+        VkImageObj *image = (call.args.size() > 3) ? Find(images_, call, 3) : nullptr;
+        if (!descriptor_set || !buffer || ((call.args.size() > 3) && !image)) return false;
+        descriptor_set->Clear();
+        for (const auto &binding : descriptor_set->bindings_) {
+            if (binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE) {
+                if (!image) {
+                    printf("line %u: %s has images, but no image was given\n", call.line, call.args[1].c_str());
+                    return false;
+                }
+                descriptor_set->WriteDescriptorImageInfo(binding.binding, image->targetView(VK_FORMAT_R8G8B8A8_UNORM),
+                                                         VK_NULL_HANDLE, binding.descriptorType, VK_IMAGE_LAYOUT_GENERAL, 0,
+                                                         binding.descriptorCount);
+            } else {
+                descriptor_set->WriteDescriptorBufferInfo(binding.binding, buffer->handle(), 0, VK_WHOLE_SIZE,
+                                                          binding.descriptorType, 0, binding.descriptorCount);
+            }
+        }
+        REPLAY_CALL("vkUpdateDescriptorSets", descriptor_set->UpdateDescriptorSets());
+    } else if (name == "pipeline") {
+        ReplayDescriptorSet *descriptor_set = Find(descriptor_sets_, call, 2);
+        if (!descriptor_set) return false;
+        std::unique_ptr<CreatePipelineHelper> pipe(new CreatePipelineHelper(*this));
+        pipe->InitInfo();
+        pipe->InitState();
+        pipe->pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set->layout_});
+        pipe->LateBindPipelineInfo();
+        REPLAY_CALL("vkCreateGraphicsPipelines",
+                    vk::CreateGraphicsPipelines(device(), pipe->pipeline_cache_, 1, &pipe->gp_ci_, nullptr, &pipe->pipeline_));
+        pipelines_[call.args.at(1)] = std::move(pipe);
+    } else if (name == "command_buffer") {
+        command_buffers_[call.args.at(1)].reset(new VkCommandBufferObj(m_device, m_commandPool));
+    } else if (name == "submit") {
+        std::vector<VkCommandBuffer> handles;
+        for (size_t arg = 1; arg < call.args.size(); ++arg) {
+            VkCommandBufferObj *command_buffer = Find(command_buffers_, call, arg);
+            if (!command_buffer) return false;
+            handles.push_back(command_buffer->handle());
+        }
+        auto submit_info = LvlInitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = static_cast<uint32_t>(handles.size());
+        submit_info.pCommandBuffers = handles.data();
+        REPLAY_CALL("vkQueueSubmit", vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    } else if (name == "wait_idle") {
+        REPLAY_CALL("vkQueueWaitIdle", vk::QueueWaitIdle(m_device->m_queue));
+    } else {
+        // The rest are recorded into a command buffer
+        VkCommandBufferObj *command_buffer = Find(command_buffers_, call, 1);
+        if (!command_buffer) return false;
+        const VkCommandBuffer cb = command_buffer->handle();
+        if (name == "begin") {
+            const auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+            REPLAY_CALL("vkBeginCommandBuffer", vk::BeginCommandBuffer(cb, &begin_info));
+        } else if (name == "end") {
+            REPLAY_CALL("vkEndCommandBuffer", vk::EndCommandBuffer(cb));
+        } else if (name == "begin_render_pass") {
+            REPLAY_CALL("vkCmdBeginRenderPass", vk::CmdBeginRenderPass(cb, &m_renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE));
+        } else if (name == "end_render_pass") {
+            REPLAY_CALL("vkCmdEndRenderPass", vk::CmdEndRenderPass(cb));
+        } else if (name == "bind_pipeline") {
+            CreatePipelineHelper *pipe = Find(pipelines_, call, 2);
+            if (!pipe) return false;
+            REPLAY_CALL("vkCmdBindPipeline", vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe->pipeline_));
+        } else if (name == "bind_descriptor_set") {
+            CreatePipelineHelper *pipe = Find(pipelines_, call, 2);
+            ReplayDescriptorSet *descriptor_set = Find(descriptor_sets_, call, 3);
+            if (!pipe || !descriptor_set) return false;
+            REPLAY_CALL("vkCmdBindDescriptorSets",
+                        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe->pipeline_layout_.handle(), 0, 1,
+                                                  &descriptor_set->set_, 0, nullptr));
+        } else if (name == "draw") {
+            const uint32_t vertex_count = ArgValue(call, 2, 3);
+            for (uint32_t times = ArgValue(call, 3, 1); times > 0; --times) {
+                REPLAY_CALL("vkCmdDraw", vk::CmdDraw(cb, vertex_count, 1, 0, 0));
+            }
+        } else if (name == "copy_buffer") {
+            VkBufferObj *src = Find(buffers_, call, 2);
+            VkBufferObj *dst = Find(buffers_, call, 3);
+            if (!src || !dst) return false;
+            const VkBufferCopy region = {0, 0, ArgValue(call, 4, 1)};
+            REPLAY_CALL("vkCmdCopyBuffer", vk::CmdCopyBuffer(cb, src->handle(), dst->handle(), 1, &region));
+        } else if (name == "barrier") {
+            VkImageObj *image = Find(images_, call, 2);
+            auto barrier = LvlInitStruct<VkImageMemoryBarrier>();
+            if (!image || (call.args.size() < 5) || !ParseLayout(call.args[3], barrier.oldLayout) ||
+                !ParseLayout(call.args[4], barrier.newLayout)) {
+                printf("line %u: barrier needs an image and two layouts\n", call.line);
+                return false;
+            }
+            barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image->handle();
+            barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+            REPLAY_CALL("vkCmdPipelineBarrier",
+                        vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                                               nullptr, 0, nullptr, 1, &barrier));
+        } else {
+            printf("line %u: unknown call %s\n", call.line, name.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+void VkLayerReplay::Report() const {
+    std::vector<std::pair<std::string, EntryPointTime>> sorted(times_.begin(), times_.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const std::pair<std::string, EntryPointTime> &a, const std::pair<std::string, EntryPointTime> &b) {
+                  return a.second.total_ns > b.second.total_ns;
+              });
+    printf("%-28s %12s %14s %12s %12s\n", "entry point", "calls", "total ms", "ns/call", "max ns");
+    for (const auto &entry : sorted) {
+        const EntryPointTime &time = entry.second;
+        printf("%-28s %12" PRIu64 " %14.3f %12" PRId64 " %12" PRId64 "\n", entry.first.c_str(), time.calls, time.total_ns / 1e6,
+               time.total_ns / static_cast<int64_t>(time.calls), time.max_ns);
+    }
+}
+
+bool ReadCapture(const char *filename, std::vector<Call> &calls) {
+    std::ifstream file(filename);
+    if (!file) {
+        printf("Cannot open %s\n", filename);
+        return false;
+    }
+    std::string text;
+    for (uint32_t line = 1; std::getline(file, text); ++line) {
+        text = text.substr(0, text.find('#'));
+        std::istringstream words(text);
+        Call call{{}, line};
+        for (std::string word; words >> word;) call.args.push_back(word);
+        if (!call.args.empty()) calls.push_back(call);
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    bool hook_timing = false;
+    uint32_t repeat = 1;
+    const char *capture = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--hook-timing") {
+            hook_timing = true;
+        } else if ((arg == "--repeat") && (i + 1 < argc)) {
+            repeat = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else if (arg[0] != '-' && !capture) {
+            capture = argv[i];
+        } else {
+            capture = nullptr;
+            break;
+        }
+    }
+    if (!capture) {
+        printf("Usage: %s [--hook-timing] [--repeat <times>] <capture>\n", argv[0]);
+        printf("  --hook-timing  also write the time of each validation object, per khronos_validation.hook_timing\n");
+        printf("  --repeat       replay the capture this many times\n");
+        return 1;
+    }
+    std::vector<Call> calls;
+    if (!ReadCapture(capture, calls)) return 1;
+
+    VkLayerSettingValueDataEXT hook_timing_value{};
+    hook_timing_value.valueBool = VK_TRUE;
+    VkLayerSettingValueEXT hook_timing_setting = {"hook_timing", VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT, hook_timing_value};
+    VkLayerSettingsEXT settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                &hook_timing_setting};
+
+    VkLayerReplay replay(hook_timing ? &settings : nullptr);
+    try {
+        for (uint32_t times = 0; times < repeat; ++times) {
+            if (!replay.Replay(calls, 0, calls.size())) return 1;
+        }
+    } catch (const std::exception &) {
+        printf("%s: a call is missing an argument or has one that is not a number\n", capture);
+        return 1;
+    }
+    replay.Report();
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time the layer takes in the hot entry points, measured through the test framework. Every benchmark runs valid usage so
+// that the timings are those of the checks rather than of error reporting; validation errors are reported as test failures.
+
+#include <benchmark/benchmark.h>
+
+#include "layer_validation_tests.h"
+
+namespace {
+
+const uint32_t kDrawsPerRecording = 100;
+
+// A VkLayerTest set up outside of a googletest run, one per benchmark run
+class VkLayerBenchmark : public VkLayerTest {
+  public:
+    explicit VkLayerBenchmark(benchmark::State &state) : state_(state) {
+        Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+        InitRenderTarget();
+        m_errorMonitor->ExpectSuccess();
+    }
+    ~VkLayerBenchmark() { m_errorMonitor->VerifyNotFound(); }
+    void TestBody() override {}
+
+    void Draw();
+    void UpdateDescriptorSets();
+    void ImageBarriers();
+    void QueueSubmit();
+    void CreateGraphicsPipelines();
+
+  private:
+    benchmark::State &state_;
+};
+
+// Draws with a pipeline using state_.range(0) uniform buffer descriptors
+void VkLayerBenchmark::Draw() {
+    const uint32_t descriptor_count = static_cast<uint32_t>(state_.range(0));
+    if (descriptor_count > m_device->props.limits.maxPerStageDescriptorUniformBuffers) {
+        state_.SkipWithError("Too many uniform buffers per stage");
+        return;
+    }
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    const OneOffDescriptorSet::Bindings bindings = {
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, bindings, 0, nullptr, 0, nullptr, descriptor_count);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 0,
+                                             descriptor_count);
+    descriptor_set.UpdateDescriptorSets();
+
+    const std::string fs_source = "#version 450\n"
+                                  "layout(location=0) out vec4 color;\n"
+                                  "layout(set=0, binding=0) uniform UBO { vec4 x; } ubos[" +
+                                  std::to_string(descriptor_count) +
+                                  "];\n"
+                                  "void main() { color = ubos[" +
+                                  std::to_string(descriptor_count - 1) + "].x; }\n";
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    for (auto _ : state_) {
+        m_commandBuffer->begin();
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        for (uint32_t i = 0; i < kDrawsPerRecording; ++i) {
+            m_commandBuffer->Draw(3, 1, 0, 0);
+        }
+        m_commandBuffer->EndRenderPass();
+        m_commandBuffer->end();
+    }
+    state_.SetItemsProcessed(state_.iterations() * kDrawsPerRecording);
+}
+
+// vkUpdateDescriptorSets calls of state_.range(0) writes, one buffer descriptor each
+void VkLayerBenchmark::UpdateDescriptorSets() {
+    const uint32_t write_count = static_cast<uint32_t>(state_.range(0));
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, write_count, VK_SHADER_STAGE_ALL, nullptr}}, 0,
+                                       nullptr, 0, nullptr, write_count);
+    for (uint32_t i = 0; i < write_count; ++i) {
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, i);
+    }
+
+    for (auto _ : state_) {
+        descriptor_set.UpdateDescriptorSets();
+    }
+    state_.SetItemsProcessed(state_.iterations() * write_count);
+}
+
+// vkCmdPipelineBarrier calls with a barrier for each of state_.range(0) array layers of a mipmapped image
+void VkLayerBenchmark::ImageBarriers() {
+    const uint32_t layer_count = static_cast<uint32_t>(state_.range(0));
+    const uint32_t mip_count = 8;
+    if (layer_count > m_device->props.limits.maxImageArrayLayers) {
+        state_.SkipWithError("Too many array layers");
+        return;
+    }
+    VkImageObj image(m_device);
+    image.InitNoLayout(VkImageObj::ImageCreateInfo2D(128, 128, mip_count, layer_count, VK_FORMAT_R8G8B8A8_UNORM,
+                                                     VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL));
+
+    std::vector<VkImageMemoryBarrier> barriers;
+    for (uint32_t layer = 0; layer < layer_count; ++layer) {
+        auto barrier = LvlInitStruct<VkImageMemoryBarrier>();
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image.handle();
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_count, layer, 1};
+        barriers.push_back(barrier);
+    }
+
+    m_commandBuffer->begin();
+    for (auto _ : state_) {
+        m_commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                         nullptr, layer_count, barriers.data());
+    }
+    m_commandBuffer->end();
+    state_.SetItemsProcessed(state_.iterations() * layer_count * mip_count);
+}
+
+// vkQueueSubmit calls of state_.range(0) command buffers, each with a render pass and a draw
+void VkLayerBenchmark::QueueSubmit() {
+    const uint32_t command_buffer_count = static_cast<uint32_t>(state_.range(0));
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    std::vector<VkCommandBuffer> handles;
+    const auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    for (uint32_t i = 0; i < command_buffer_count; ++i) {
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, m_commandPool));
+        VkCommandBufferObj &command_buffer = *command_buffers.back();
+        command_buffer.begin(&begin_info);
+        command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        command_buffer.Draw(3, 1, 0, 0);
+        command_buffer.EndRenderPass();
+        command_buffer.end();
+        handles.push_back(command_buffer.handle());
+    }
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = command_buffer_count;
+    submit_info.pCommandBuffers = handles.data();
+
+    for (auto _ : state_) {
+        vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+        state_.PauseTiming();
+        vk::QueueWaitIdle(m_device->m_queue);
+        state_.ResumeTiming();
+    }
+    state_.SetItemsProcessed(state_.iterations() * command_buffer_count);
+}
+
+// vkCreateGraphicsPipelines calls creating one pipeline each
+void VkLayerBenchmark::CreateGraphicsPipelines() {
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.LateBindPipelineInfo();
+
+    for (auto _ : state_) {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateGraphicsPipelines(device(), pipe.pipeline_cache_, 1, &pipe.gp_ci_, nullptr, &pipeline);
+        state_.PauseTiming();
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+        state_.ResumeTiming();
+    }
+    state_.SetItemsProcessed(state_.iterations());
+}
+
+void BM_Draw(benchmark::State &state) { VkLayerBenchmark(state).Draw(); }
+void BM_UpdateDescriptorSets(benchmark::State &state) { VkLayerBenchmark(state).UpdateDescriptorSets(); }
+void BM_ImageBarriers(benchmark::State &state) { VkLayerBenchmark(state).ImageBarriers(); }
+void BM_QueueSubmit(benchmark::State &state) { VkLayerBenchmark(state).QueueSubmit(); }
+void BM_CreateGraphicsPipelines(benchmark::State &state) { VkLayerBenchmark(state).CreateGraphicsPipelines(); }
+
+}  // namespace
+
+BENCHMARK(BM_Draw)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_UpdateDescriptorSets)->RangeMultiplier(8)->Range(1, 512);
+BENCHMARK(BM_ImageBarriers)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_QueueSubmit)->RangeMultiplier(8)->Range(1, 512);
+BENCHMARK(BM_CreateGraphicsPipelines);
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    VkTestFramework::InitArgs(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    VkTestFramework::Finish();
+    return 0;
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of the layer on a synthetic frame, in each validation configuration. Run against the mock ICD, so that the
+// driver costs next to nothing and the timings are those of the layer.
+//
+// A frame is kFrameRenderPasses render passes of kDrawsPerRenderPass draws each. Record/<config> times recording the frame
+// into a command buffer, Replay/<config> times submitting the recorded frame. Both report the Vulkan calls of the frame per
+// second and the time per call. Each configuration other than "none" adds one validation object to the "none" baseline, so the
+// difference to the baseline is the cost of that object.
+//
+// ThreadedRecord/<config>/<threads> records the frame on that many threads at once, each into a command buffer of its own
+// command pool, all of them with the same pipeline, descriptor set and render pass, as engines recording on many threads do.
+// The calls per second are those of all threads, in wall clock time, so that they grow with the threads as long as the layer
+// scales. Run with VK_LAYER_VALIDATION_COUNTERS=1 to also report, per frame, the waits on the locks of the state maps of each
+// validation object and which maps they were on.
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include "layer_validation_tests.h"
+#include "validation_counters.h"
+
+namespace {
+
+const uint32_t kFrameRenderPasses = 200;
+const uint32_t kDrawsPerRenderPass = 50;
+// vkCmdBeginRenderPass, vkCmdBindPipeline, vkCmdBindDescriptorSets and vkCmdEndRenderPass around the draws of each pass
+const uint32_t kFrameCalls = kFrameRenderPasses * (kDrawsPerRenderPass + 4);
+const int kMaxRecordThreads = 32;
+
+struct ValidationConfig {
+    const char *name;
+    std::vector<VkValidationFeatureEnableEXT> enables;
+    std::vector<VkValidationFeatureDisableEXT> disables;
+};
+
+const VkValidationFeatureDisableEXT kDisableThreadSafety = VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT;
+const VkValidationFeatureDisableEXT kDisableStateless = VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT;
+const VkValidationFeatureDisableEXT kDisableObjectLifetimes = VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT;
+const VkValidationFeatureDisableEXT kDisableCore = VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT;
+
+const std::vector<ValidationConfig> kValidationConfigs = {
+    {"none", {}, {kDisableThreadSafety, kDisableStateless, kDisableObjectLifetimes, kDisableCore}},
+    {"core", {}, {kDisableThreadSafety, kDisableStateless, kDisableObjectLifetimes}},
+    {"stateless", {}, {kDisableThreadSafety, kDisableObjectLifetimes, kDisableCore}},
+    {"thread_safety", {}, {kDisableStateless, kDisableObjectLifetimes, kDisableCore}},
+    {"object_lifetimes", {}, {kDisableThreadSafety, kDisableStateless, kDisableCore}},
+    {"sync",
+     {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT},
+     {kDisableThreadSafety, kDisableStateless, kDisableObjectLifetimes, kDisableCore}},
+    {"best_practices",
+     {VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT},
+     {kDisableThreadSafety, kDisableStateless, kDisableObjectLifetimes, kDisableCore}},
+    {"gpu_av",
+     {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT},
+     {kDisableThreadSafety, kDisableStateless, kDisableObjectLifetimes, kDisableCore}},
+};
+
+void SetCallCounters(benchmark::State &state, uint32_t frames = 1) {
+    const double calls = static_cast<double>(kFrameCalls) * frames;
+    state.counters["calls/s"] = benchmark::Counter(calls, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["time/call"] =
+        benchmark::Counter(calls, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+// A VkLayerTest with one validation configuration and the frame workload, set up outside of a googletest run
+class VkLayerFrameBenchmark : public VkLayerTest {
+  public:
+    VkLayerFrameBenchmark(benchmark::State &state, const ValidationConfig &config) : state_(state) {
+        auto features = LvlInitStruct<VkValidationFeaturesEXT>();
+        features.enabledValidationFeatureCount = static_cast<uint32_t>(config.enables.size());
+        features.pEnabledValidationFeatures = config.enables.data();
+        features.disabledValidationFeatureCount = static_cast<uint32_t>(config.disables.size());
+        features.pDisabledValidationFeatures = config.disables.data();
+        Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, &features);
+        InitRenderTarget();
+        if (!IsPlatform(kMockICD)) {
+            printf("             Not running on the mock ICD, the timings include the driver.\n");
+        }
+        // Best practices warns about the many small render passes and draws, only errors fail the benchmark
+        m_errorMonitor->ExpectSuccess(kErrorBit);
+        InitFrame();
+    }
+    ~VkLayerFrameBenchmark() { m_errorMonitor->VerifyNotFound(); }
+    void TestBody() override {}
+
+    void Record();
+    void Replay();
+    void ThreadedRecord(uint32_t thread_count);
+
+  private:
+    void InitFrame();
+    void RecordFrame(VkCommandBufferObj &command_buffer);
+    void SetLockWaitCounters();
+
+    benchmark::State &state_;
+    VkBufferObj uniform_buffer_;
+    std::unique_ptr<OneOffDescriptorSet> descriptor_set_;
+    std::unique_ptr<CreatePipelineHelper> pipe_;
+};
+
+void VkLayerFrameBenchmark::InitFrame() {
+    uniform_buffer_.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set_.reset(new OneOffDescriptorSet(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}));
+    descriptor_set_->WriteDescriptorBufferInfo(0, uniform_buffer_.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set_->UpdateDescriptorSets();
+
+    char const *fs_source = R"glsl(
+        #version 450
+        layout(location=0) out vec4 color;
+        layout(set=0, binding=0) uniform UBO { vec4 x; } ubo;
+        void main() { color = ubo.x; }
+    )glsl";
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+    pipe_.reset(new CreatePipelineHelper(*this));
+    pipe_->InitInfo();
+    pipe_->InitState();
+    pipe_->shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe_->pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set_->layout_});
+    pipe_->CreateGraphicsPipeline();
+}
+
+void VkLayerFrameBenchmark::RecordFrame(VkCommandBufferObj &command_buffer) {
+    const auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    command_buffer.begin(&begin_info);
+    for (uint32_t render_pass = 0; render_pass < kFrameRenderPasses; ++render_pass) {
+        command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_->pipeline_);
+        vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_->pipeline_layout_.handle(), 0,
+                                  1, &descriptor_set_->set_, 0, nullptr);
+        for (uint32_t draw = 0; draw < kDrawsPerRenderPass; ++draw) {
+            command_buffer.Draw(3, 1, 0, 0);
+        }
+        command_buffer.EndRenderPass();
+    }
+    command_buffer.end();
+}
+
+// Adds the "<validation object>.<map>_lock_wait_us" counters of the layer, per iteration, when validation counters are enabled
+void VkLayerFrameBenchmark::SetLockWaitCounters() {
+    const auto get_counters = reinterpret_cast<PFN_vkGetValidationCountersLAYER>(
+        vk::GetDeviceProcAddr(m_device->device(), VK_LAYER_VALIDATION_COUNTERS_FUNCTION_NAME));
+    if (!get_counters) return;
+    uint32_t count = 0;
+    get_counters(m_device->device(), &count, nullptr);
+    std::vector<VkValidationCounterLAYER> counters(count);
+    get_counters(m_device->device(), &count, counters.data());
+    const std::string suffix = "_lock_wait_us";
+    for (uint32_t i = 0; i < count; ++i) {
+        const std::string name = counters[i].name;
+        if (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            state_.counters[name] = benchmark::Counter(static_cast<double>(counters[i].value), benchmark::Counter::kAvgIterations);
+        }
+    }
+}
+
+void VkLayerFrameBenchmark::Record() {
+    for (auto _ : state_) {
+        RecordFrame(*m_commandBuffer);
+    }
+    SetCallCounters(state_);
+}
+
+void VkLayerFrameBenchmark::ThreadedRecord(uint32_t thread_count) {
+    std::vector<std::unique_ptr<VkCommandPoolObj>> command_pools;
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        command_pools.emplace_back(new VkCommandPoolObj(m_device, m_device->graphics_queue_node_index_));
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, command_pools.back().get()));
+    }
+
+    std::vector<std::thread> threads;
+    for (auto _ : state_) {
+        // Starting the threads costs next to nothing next to recording a frame
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            VkCommandBufferObj *command_buffer = command_buffers[i].get();
+            threads.emplace_back([this, command_buffer]() { RecordFrame(*command_buffer); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+    }
+    SetCallCounters(state_, thread_count);
+    SetLockWaitCounters();
+}
+
+void VkLayerFrameBenchmark::Replay() {
+    RecordFrame(*m_commandBuffer);
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    for (auto _ : state_) {
+        vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+        // Includes the readback of GPU-AV, which runs when the submission completes
+        vk::QueueWaitIdle(m_device->m_queue);
+    }
+    SetCallCounters(state_);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    VkTestFramework::InitArgs(&argc, argv);
+    for (const auto &config : kValidationConfigs) {
+        benchmark::RegisterBenchmark((std::string("Record/") + config.name).c_str(), [&config](benchmark::State &state) {
+            VkLayerFrameBenchmark(state, config).Record();
+        })->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark((std::string("Replay/") + config.name).c_str(), [&config](benchmark::State &state) {
+            VkLayerFrameBenchmark(state, config).Replay();
+        })->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark((std::string("ThreadedRecord/") + config.name).c_str(), [&config](benchmark::State &state) {
+            VkLayerFrameBenchmark(state, config).ThreadedRecord(static_cast<uint32_t>(state.range(0)));
+        })
+            ->RangeMultiplier(2)
+            ->Range(1, kMaxRecordThreads)
+            ->UseRealTime()
+            ->Unit(benchmark::kMicrosecond);
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    VkTestFramework::Finish();
+    return 0;
+}
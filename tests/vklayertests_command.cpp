@@ -499,6 +499,117 @@ TEST_F(VkLayerTest, Sync2CommandBufferTwoSubmits) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, QueueSubmitManyCommandBuffersImageLayouts) {
+    TEST_DESCRIPTION(
+        "Use the parallel_submit_validation setting and submit many command buffers in one call, some sharing an image and the "
+        "others each using their own. Verify the errors are reported in command buffer order.");
+
+    if (InstanceExtensionSupported(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    } else {
+        printf("%s Debug Utils Extension not supported, skipping test\n", kSkipPrefix);
+        return;
+    }
+    VkLayerSettingValueDataEXT parallel_value{};
+    parallel_value.valueBool = VK_TRUE;
+    VkLayerSettingValueEXT parallel_setting_val = {"parallel_submit_validation", VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT,
+                                                   parallel_value};
+    VkLayerSettingsEXT parallel_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                         &parallel_setting_val};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &parallel_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    PFN_vkCreateDebugUtilsMessengerEXT fpvkCreateDebugUtilsMessengerEXT =
+        (PFN_vkCreateDebugUtilsMessengerEXT)vk::GetInstanceProcAddr(instance(), "vkCreateDebugUtilsMessengerEXT");
+    ASSERT_TRUE(fpvkCreateDebugUtilsMessengerEXT);
+    PFN_vkDestroyDebugUtilsMessengerEXT fpvkDestroyDebugUtilsMessengerEXT =
+        (PFN_vkDestroyDebugUtilsMessengerEXT)vk::GetInstanceProcAddr(instance(), "vkDestroyDebugUtilsMessengerEXT");
+    ASSERT_TRUE(fpvkDestroyDebugUtilsMessengerEXT);
+
+    const uint32_t cb_count = 16;
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    std::vector<std::unique_ptr<VkImageObj>> images;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        images.emplace_back(new VkImageObj(m_device));
+        images.back()->Init(32, 32, 1, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL);
+        ASSERT_TRUE(images.back()->initialized());
+        images.back()->SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    }
+    // Not in the layout its command buffer expects
+    const uint32_t unshared_error_cb = 5;
+    images[unshared_error_cb]->SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    // Only in the expected layout once the first command buffer has transitioned it, and the last command buffer, which leaves
+    // it in another layout for no one after it, expects the layout from before the transition
+    const uint32_t shared_error_cb = cb_count - 1;
+    VkImageObj shared_image(m_device);
+    shared_image.Init(32, 32, 1, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL);
+    ASSERT_TRUE(shared_image.initialized());
+    shared_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    const VkClearColorValue clear_color = {};
+    const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    std::vector<VkCommandBuffer> handles;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, m_commandPool));
+        VkCommandBufferObj &cb = *command_buffers.back();
+        cb.begin();
+        if (i == 0) {
+            auto barrier = LvlInitStruct<VkImageMemoryBarrier>();
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = shared_image.image();
+            barrier.subresourceRange = range;
+            vk::CmdPipelineBarrier(cb.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                   nullptr, 1, &barrier);
+        } else {
+            const VkImageLayout layout = (i == shared_error_cb) ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            vk::CmdClearColorImage(cb.handle(), shared_image.image(), layout, &clear_color, 1, &range);
+        }
+        vk::CmdClearColorImage(cb.handle(), images[i]->image(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &range);
+        cb.end();
+        handles.push_back(cb.handle());
+    }
+
+    // The command buffers the layout errors are reported for, in the order they are reported
+    std::vector<uint64_t> error_command_buffers;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&error_command_buffers](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData,
+                                                      DebugUtilsLabelCheckData *data) {
+        if (pCallbackData->pMessageIdName &&
+            strcmp(pCallbackData->pMessageIdName, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout") == 0 &&
+            pCallbackData->objectCount > 0) {
+            error_command_buffers.push_back(pCallbackData->pObjects[0].objectHandle);
+        }
+        data->count++;
+    };
+    auto callback_create_info = LvlInitStruct<VkDebugUtilsMessengerCreateInfoEXT>();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    fpvkCreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &messenger);
+
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = cb_count;
+    submit_info.pCommandBuffers = handles.data();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    vk::QueueWaitIdle(m_device->m_queue);
+    fpvkDestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(error_command_buffers.size(), 2u);
+    ASSERT_EQ(error_command_buffers[0], (uint64_t)handles[unshared_error_cb]);
+    ASSERT_EQ(error_command_buffers[1], (uint64_t)handles[shared_error_cb]);
+}
+
 TEST_F(VkLayerTest, InvalidPushConstants) {
     ASSERT_NO_FATAL_FAILURE(Init());
     ASSERT_NO_FATAL_FAILURE(InitViewport());
@@ -8447,6 +8558,193 @@ TEST_F(VkLayerTest, VerifyDynamicStateSettingCommands) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkLayerTest, DynamicStateNotSetAfterCleanDraw) {
+    TEST_DESCRIPTION("Bind a pipeline needing dynamic state that was never set after a clean draw with another pipeline.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    CreatePipelineHelper static_pipe(*this);
+    static_pipe.InitInfo();
+    static_pipe.InitState();
+    static_pipe.CreateGraphicsPipeline();
+
+    CreatePipelineHelper dynamic_pipe(*this);
+    dynamic_pipe.InitInfo();
+    const VkDynamicState dyn_states[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    auto dyn_state_ci = LvlInitStruct<VkPipelineDynamicStateCreateInfo>();
+    dyn_state_ci.dynamicStateCount = size(dyn_states);
+    dyn_state_ci.pDynamicStates = dyn_states;
+    dynamic_pipe.dyn_state_ci_ = dyn_state_ci;
+    dynamic_pipe.InitState();
+    dynamic_pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, static_pipe.pipeline_);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // The new pipeline must have the dynamic state checks rerun, even though nothing else changed since the clean draw
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, dynamic_pipe.pipeline_);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit,
+                                         "Dynamic scissor(s) 0 are used by pipeline state object, but were not provided");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, DynamicStateSetAfterCleanDraw) {
+    TEST_DESCRIPTION("Set dynamic state the bound pipeline doesn't use after a clean draw with it.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    const VkDynamicState dyn_states[] = {VK_DYNAMIC_STATE_VIEWPORT};
+    auto dyn_state_ci = LvlInitStruct<VkPipelineDynamicStateCreateInfo>();
+    dyn_state_ci.dynamicStateCount = size(dyn_states);
+    dyn_state_ci.pDynamicStates = dyn_states;
+    pipe.dyn_state_ci_ = dyn_state_ci;
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // The scissor is static in the pipeline
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-02859");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, PushDescriptorSetIncompatibleAfterCleanDraw) {
+    TEST_DESCRIPTION("Push a descriptor set with an incompatible pipeline layout after a clean draw with a pushed set.");
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    } else {
+        printf("%s %s Extension not supported, skipping tests\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    } else {
+        printf("%s %s Extension not supported, skipping tests\n", kSkipPrefix, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    auto push_descriptor_prop = GetPushDescriptorProperties(instance(), gpu());
+    if (push_descriptor_prop.maxPushDescriptors < 1) {
+        // Some implementations report an invalid maxPushDescriptors of 0
+        printf("%s maxPushDescriptors is zero, skipping tests\n", kSkipPrefix);
+        return;
+    }
+
+    // Two push descriptor set layouts differing only in their stage flags
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    const VkDescriptorSetLayoutObj push_ds_layout(m_device, {binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    ASSERT_TRUE(push_ds_layout.initialized());
+    binding.stageFlags = VK_SHADER_STAGE_ALL;
+    const VkDescriptorSetLayoutObj other_push_ds_layout(m_device, {binding},
+                                                        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    ASSERT_TRUE(other_push_ds_layout.initialized());
+    const VkPipelineLayoutObj other_pipeline_layout(m_device, {&other_push_ds_layout});
+    ASSERT_TRUE(other_pipeline_layout.initialized());
+
+    VkShaderObj fs(this, bindStateFragUniformShaderText, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&push_ds_layout});
+    pipe.CreateGraphicsPipeline();
+
+    const uint32_t buffer_data[4] = {4, 5, 6, 7};
+    VkConstantBufferObj buffer_obj(m_device, sizeof(buffer_data), &buffer_data);
+    ASSERT_TRUE(buffer_obj.initialized());
+    VkDescriptorBufferInfo buffer_info = {buffer_obj.handle(), 0, VK_WHOLE_SIZE};
+    VkWriteDescriptorSet descriptor_write = vk_testing::Device::write_descriptor_set(
+        vk_testing::DescriptorSet(), 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, &buffer_info);
+
+    PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR =
+        (PFN_vkCmdPushDescriptorSetKHR)vk::GetDeviceProcAddr(m_device->device(), "vkCmdPushDescriptorSetKHR");
+    ASSERT_TRUE(vkCmdPushDescriptorSetKHR != nullptr);
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vkCmdPushDescriptorSetKHR(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_write);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Pushing replaces the bound set, whose layout no longer matches the pipeline's
+    vkCmdPushDescriptorSetKHR(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, other_pipeline_layout.handle(), 0, 1,
+                              &descriptor_write);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-02697");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-CoreValidation-DrawState-PipelineLayoutsIncompatible");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, DescriptorSetBufferDestroyedAfterCleanDraw) {
+    TEST_DESCRIPTION("Destroy the buffer of a bound descriptor set after a clean draw with it, then draw again.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkShaderObj fs(this, bindStateFragUniformShaderText, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    {
+        VkBufferObj buffer;
+        buffer.init(*m_device, 1024, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, 1024);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &pipe.descriptor_set_->set_, 0, NULL);
+        m_errorMonitor->ExpectSuccess();
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_errorMonitor->VerifyNotFound();
+    }
+
+    // The destroyed buffer invalidates the command buffer, and the draw must not reuse the clean draw's descriptor checks
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "that is invalid or has been destroyed");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkBuffer");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, VerifyFilterCubicSamplerInCmdDraw) {
     TEST_DESCRIPTION("Verify if sampler is filter cubic, image view needs to support it.");
     uint32_t version = SetTargetApiVersion(VK_API_VERSION_1_1);
@@ -4566,6 +4566,139 @@ TEST_F(VkLayerTest, InvalidDrawDescriptorSetBufferDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, InvalidDrawManyDescriptorsRewrittenBufferDestroyed) {
+    TEST_DESCRIPTION(
+        "Rewrite one descriptor of a set with many descriptors after a clean draw with it, destroy the new buffer and draw again.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // Above 64 descriptors, draws after the first only validate the descriptors written since
+    const uint32_t descriptor_count = 65;
+    if (descriptor_count > m_device->props.limits.maxPerStageDescriptorStorageBuffers) {
+        printf("%s maxPerStageDescriptorStorageBuffers is too low, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    const OneOffDescriptorSet::Bindings bindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, bindings, 0, nullptr, 0, nullptr, descriptor_count);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0,
+                                             descriptor_count);
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *fsSource = R"glsl(
+        #version 450
+        layout(location=0) out vec4 color;
+        layout(set=0, binding=0) readonly buffer SSBO { vec4 x; } ssbos[65];
+        void main() {
+           color = ssbos[64].x;
+        }
+    )glsl";
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 0, NULL);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    {
+        VkBufferObj rewritten_buffer;
+        rewritten_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        descriptor_set.Clear();
+        descriptor_set.WriteDescriptorBufferInfo(0, rewritten_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                 descriptor_count - 1);
+        descriptor_set.UpdateDescriptorSets();
+    }
+
+    // The update invalidates the command buffer. The draw still validates the set, where only the last descriptor changed.
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "that is invalid or has been destroyed");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkDescriptorSet");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkBuffer");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, InvalidDrawManyDescriptorsBufferDestroyedAfterOtherCommandBuffer) {
+    TEST_DESCRIPTION(
+        "Draw cleanly with a set of many descriptors in one command buffer, destroy one of its buffers and draw with the set in "
+        "another command buffer.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // Above 64 descriptors, buffer bindings validated clean in one command buffer count as validated in the others
+    const uint32_t descriptor_count = 65;
+    if (descriptor_count > m_device->props.limits.maxPerStageDescriptorStorageBuffers) {
+        printf("%s maxPerStageDescriptorStorageBuffers is too low, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    const OneOffDescriptorSet::Bindings bindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, bindings, 0, nullptr, 0, nullptr, descriptor_count);
+
+    char const *fsSource = R"glsl(
+        #version 450
+        layout(location=0) out vec4 color;
+        layout(set=0, binding=0) readonly buffer SSBO { vec4 x; } ssbos[65];
+        void main() {
+           color = ssbos[64].x;
+        }
+    )glsl";
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    {
+        VkBufferObj destroyed_buffer;
+        destroyed_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0,
+                                                 descriptor_count - 1);
+        descriptor_set.WriteDescriptorBufferInfo(0, destroyed_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                 descriptor_count - 1);
+        descriptor_set.UpdateDescriptorSets();
+
+        m_commandBuffer->begin();
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0,
+                                  1, &descriptor_set.set_, 0, NULL);
+        m_errorMonitor->ExpectSuccess();
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_errorMonitor->VerifyNotFound();
+        m_commandBuffer->EndRenderPass();
+        m_commandBuffer->end();
+    }
+
+    // The set's contents didn't change, but the first command buffer's clean validation no longer holds
+    VkCommandBufferObj command_buffer(m_device, m_commandPool);
+    command_buffer.begin();
+    command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "that is invalid or has been destroyed");
+    command_buffer.Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    command_buffer.EndRenderPass();
+    command_buffer.end();
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetImageSamplerDestroyed) {
     TEST_DESCRIPTION(
         "Attempt to draw with a command buffer that is invalid due to a bound descriptor sets with a combined image sampler having "
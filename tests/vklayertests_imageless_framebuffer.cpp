@@ -357,6 +357,130 @@ TEST_F(VkLayerTest, ImagelessFramebufferRenderPassBeginImageViewMismatchTests) {
     vk::DestroyImageView(m_device->device(), imageViewSubset, nullptr);
 }
 
+TEST_F(VkLayerTest, ImagelessFramebufferRenderPassBeginRepeated) {
+    TEST_DESCRIPTION(
+        "Begin a renderPass with the same image views twice, then with a view destroyed and recreated with a format that does "
+        "not match the render pass.");
+
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    } else {
+        printf("%s Did not find required device extension %s; skipped.\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_MAINTENANCE_2_EXTENSION_NAME);
+        m_device_extension_names.push_back(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME);
+        m_device_extension_names.push_back(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+    } else {
+        printf("%s test requires VK_KHR_imageless_framebuffer, not available.  Skipping.\n", kSkipPrefix);
+        return;
+    }
+
+    auto imageless_features = LvlInitStruct<VkPhysicalDeviceImagelessFramebufferFeaturesKHR>();
+    imageless_features.imagelessFramebuffer = VK_TRUE;
+    auto features2 = LvlInitStruct<VkPhysicalDeviceFeatures2>(&imageless_features);
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    const uint32_t width = 256;
+    const uint32_t height = 256;
+    VkFormat formats[2] = {VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_B8G8R8A8_UNORM};
+
+    VkAttachmentDescription attachment = {};
+    attachment.format = formats[0];
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_GENERAL;
+    VkAttachmentReference attachment_reference = {};
+    attachment_reference.layout = VK_IMAGE_LAYOUT_GENERAL;
+    VkSubpassDescription subpass = {};
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &attachment_reference;
+    auto rp_ci = LvlInitStruct<VkRenderPassCreateInfo>();
+    rp_ci.subpassCount = 1;
+    rp_ci.pSubpasses = &subpass;
+    rp_ci.attachmentCount = 1;
+    rp_ci.pAttachments = &attachment;
+    vk_testing::RenderPass render_pass(*m_device, rp_ci);
+
+    auto attachment_image_info = LvlInitStruct<VkFramebufferAttachmentImageInfoKHR>();
+    attachment_image_info.flags = VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+    attachment_image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    attachment_image_info.width = width;
+    attachment_image_info.height = height;
+    attachment_image_info.layerCount = 1;
+    attachment_image_info.viewFormatCount = 2;
+    attachment_image_info.pViewFormats = formats;
+    auto attachments_ci = LvlInitStruct<VkFramebufferAttachmentsCreateInfoKHR>();
+    attachments_ci.attachmentImageInfoCount = 1;
+    attachments_ci.pAttachmentImageInfos = &attachment_image_info;
+    auto fb_ci = LvlInitStruct<VkFramebufferCreateInfo>(&attachments_ci);
+    fb_ci.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+    fb_ci.renderPass = render_pass.handle();
+    fb_ci.attachmentCount = 1;
+    fb_ci.width = width;
+    fb_ci.height = height;
+    fb_ci.layers = 1;
+    vk_testing::Framebuffer framebuffer(*m_device, fb_ci);
+
+    auto format_list = LvlInitStruct<VkImageFormatListCreateInfoKHR>();
+    format_list.viewFormatCount = 2;
+    format_list.pViewFormats = formats;
+    auto image_ci = LvlInitStruct<VkImageCreateInfo>(&format_list);
+    image_ci.flags = VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+    image_ci.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    image_ci.extent = {width, height, 1};
+    image_ci.arrayLayers = 1;
+    image_ci.mipLevels = 1;
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.format = formats[0];
+    VkImageObj image(m_device);
+    image.init(&image_ci);
+
+    auto view_ci = LvlInitStruct<VkImageViewCreateInfo>();
+    view_ci.image = image.handle();
+    view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_ci.format = formats[0];
+    view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkImageView image_view;
+    vk::CreateImageView(m_device->device(), &view_ci, nullptr, &image_view);
+
+    auto attachment_begin_info = LvlInitStruct<VkRenderPassAttachmentBeginInfoKHR>();
+    attachment_begin_info.attachmentCount = 1;
+    attachment_begin_info.pAttachments = &image_view;
+    auto rp_begin_info = LvlInitStruct<VkRenderPassBeginInfo>(&attachment_begin_info);
+    rp_begin_info.renderPass = render_pass.handle();
+    rp_begin_info.framebuffer = framebuffer.handle();
+    rp_begin_info.renderArea.extent = {width, height};
+
+    // The second begin finds the verdict of the first
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_commandBuffer->begin();
+        vk::CmdBeginRenderPass(m_commandBuffer->handle(), &rp_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+        vk::CmdEndRenderPass(m_commandBuffer->handle());
+        m_commandBuffer->end();
+        m_commandBuffer->reset();
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    // The new view may have the handle of the destroyed one
+    vk::DestroyImageView(m_device->device(), image_view, nullptr);
+    view_ci.format = formats[1];
+    vk::CreateImageView(m_device->device(), &view_ci, nullptr, &image_view);
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkRenderPassBeginInfo-framebuffer-03216");
+    vk::CmdBeginRenderPass(m_commandBuffer->handle(), &rp_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->reset();
+
+    vk::DestroyImageView(m_device->device(), image_view, nullptr);
+}
+
 TEST_F(VkLayerTest, ImagelessFramebufferFeatureEnableTest) {
     TEST_DESCRIPTION("Use imageless framebuffer functionality without enabling the feature");
 
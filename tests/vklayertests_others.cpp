@@ -106,6 +106,25 @@ class DuplicateMsgLimit {
     VkLayerSettingsEXT limit_setting;
 };
 
+class DeferredCommandValidation {
+  public:
+    DeferredCommandValidation(const bool enable, const char *setting_name = "deferred_command_validation") {
+        deferred_value.valueBool = enable ? VK_TRUE : VK_FALSE;
+
+        strncpy(deferred_setting_val.name, setting_name, sizeof(deferred_setting_val.name));
+        deferred_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT;
+        deferred_setting_val.data = deferred_value;
+        deferred_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                            &deferred_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&deferred_setting};
+
+  private:
+    VkLayerSettingValueDataEXT deferred_value{};
+    VkLayerSettingValueEXT deferred_setting_val;
+    VkLayerSettingsEXT deferred_setting;
+};
+
 TEST_F(VkLayerTest, VersionCheckPromotedAPIs) {
     TEST_DESCRIPTION("Validate that promoted APIs are not valid in old versions.");
     SetTargetApiVersion(VK_API_VERSION_1_0);
@@ -422,6 +441,180 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkLayerTest, DeferredCommandValidation) {
+    TEST_DESCRIPTION("Use the deferred_command_validation setting and verify errors are reported at vkEndCommandBuffer");
+
+    auto deferred = DeferredCommandValidation(true);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, deferred.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)20, reqs);
+
+    m_commandBuffer->begin();
+
+    // The resource checks are not run while recording
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->FillBuffer(buffer.handle(), 40, 4, 0x11111111);
+    m_errorMonitor->VerifyNotFound();
+
+    // They are reported with the same VUIDs once recording ends
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-dstOffset-00024");
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, AsyncValidation) {
+    TEST_DESCRIPTION("Use the async_validation setting and verify errors are reported before the command buffer is submitted");
+
+    auto async = DeferredCommandValidation(true, "async_validation");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, async.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)20, reqs);
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-dstOffset-00024");
+    m_commandBuffer->begin();
+    m_commandBuffer->FillBuffer(buffer.handle(), 40, 4, 0x11111111);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, AsyncValidationResetAfterEnd) {
+    TEST_DESCRIPTION("Use the async_validation setting and reset and re-record a command buffer while its checks may be running");
+
+    auto async = DeferredCommandValidation(true, "async_validation");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, async.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)20, reqs);
+
+    // The checks of the first recording complete before the reset
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-dstOffset-00024");
+    m_commandBuffer->begin();
+    m_commandBuffer->FillBuffer(buffer.handle(), 40, 4, 0x11111111);
+    m_commandBuffer->end();
+    vk::ResetCommandBuffer(m_commandBuffer->handle(), 0);
+    m_errorMonitor->VerifyFound();
+
+    // Beginning again without a reset waits for them too, and the valid recording is not reported
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-dstOffset-00024");
+    m_commandBuffer->begin();
+    m_commandBuffer->FillBuffer(buffer.handle(), 40, 4, 0x11111111);
+    m_commandBuffer->end();
+    m_commandBuffer->begin();
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->FillBuffer(buffer.handle(), 0, 4, 0x11111111);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkLayerTest, CommandBufferFingerprinting) {
+    TEST_DESCRIPTION("Use the command_buffer_fingerprinting setting and verify re-recording different commands is still checked");
+
+    auto fingerprinting = DeferredCommandValidation(true, "command_buffer_fingerprinting");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, fingerprinting.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)20, reqs);
+
+    // The second recording matches the fingerprint of the first
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_commandBuffer->begin();
+        m_commandBuffer->FillBuffer(buffer.handle(), 0, 4, 0x11111111);
+        m_commandBuffer->end();
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdFillBuffer-dstOffset-00024");
+    m_commandBuffer->begin();
+    m_commandBuffer->FillBuffer(buffer.handle(), 40, 4, 0x11111111);
+    vk::EndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, LockFreeHandleWrapping) {
+    TEST_DESCRIPTION("Use the lock_free_handle_wrapping setting and verify wrapped handles resolve and stale ones are rejected");
+
+    auto lock_free = DeferredCommandValidation(true, "lock_free_handle_wrapping");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, lock_free.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Commands on wrapped handles reach the driver
+    m_errorMonitor->ExpectSuccess();
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)20, reqs);
+    m_commandBuffer->begin();
+    m_commandBuffer->FillBuffer(buffer.handle(), 0, 4, 0x11111111);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // A slot freed by a destroyed buffer is reused with a new handle value, so the old handle stays invalid
+    auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBuffer destroyed_buffer = VK_NULL_HANDLE;
+    VkBuffer new_buffer = VK_NULL_HANDLE;
+    m_errorMonitor->ExpectSuccess();
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &destroyed_buffer);
+    vk::DestroyBuffer(device(), destroyed_buffer, nullptr);
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &new_buffer);
+    m_errorMonitor->VerifyNotFound();
+    ASSERT_NE(destroyed_buffer, new_buffer);
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkDestroyBuffer-buffer-parameter");
+    vk::DestroyBuffer(device(), destroyed_buffer, nullptr);
+    m_errorMonitor->VerifyFound();
+    vk::DestroyBuffer(device(), new_buffer, nullptr);
+}
+
+TEST_F(VkLayerTest, StatelessCreateInfoMemo) {
+    TEST_DESCRIPTION("Use the stateless_create_info_memo setting and verify repeated and changed create infos are still checked");
+
+    auto memo = DeferredCommandValidation(true, "stateless_create_info_memo");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, memo.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // The second call is answered from the memo
+    VkBuffer buffers[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffers[i]);
+    }
+    m_errorMonitor->VerifyNotFound();
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::DestroyBuffer(device(), buffers[i], nullptr);
+    }
+
+    // Create infos that failed are never memoized, nor do ones differing from a memoized create info match it
+    VkBuffer buffer = VK_NULL_HANDLE;
+    buffer_ci.size = 0;
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkBufferCreateInfo-size-00912");
+        vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
 TEST_F(VkLayerTest, MessageIdFilterString) {
     TEST_DESCRIPTION("Validate that message id string filtering is working");
 